@@ -0,0 +1,59 @@
+# Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+# BSD-style license; see COPYING
+
+"""
+Measure the time to import modmesh and to reach each subsystem, every one
+in a fresh interpreter because the registration happens once per process.
+
+    python3 benchmarks/bench_import.py [--repeat N]
+"""
+
+import argparse
+import os
+import statistics
+import subprocess
+import sys
+
+_CASES = [
+    ('python', "pass"),
+    ('import modmesh', "import modmesh"),
+    ('+ StaticMesh', "import modmesh; modmesh.StaticMesh"),
+    ('+ onedim', "import modmesh; modmesh.onedim.euler1d"),
+    ('+ spacetime', "import modmesh; modmesh.spacetime.Solver"),
+]
+
+_TIMER = """
+import time
+t0 = time.perf_counter()
+{code}
+print(time.perf_counter() - t0)
+"""
+
+
+def measure(code, repeat):
+    env = dict(os.environ)
+    env['PYTHONPATH'] = os.pathsep.join(sys.path)
+    ret = []
+    for _ in range(repeat):
+        out = subprocess.run(
+            [sys.executable, '-c', _TIMER.format(code=code)], env=env,
+            capture_output=True, text=True, check=True)
+        ret.append(float(out.stdout))
+    return ret
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--repeat', type=int, default=10)
+    args = parser.parse_args()
+    print(f"{'case':<16} {'min (ms)':>10} {'median (ms)':>12}")
+    for name, code in _CASES:
+        times = measure(code, args.repeat)
+        print(f"{name:<16} {min(times) * 1e3:>10.2f}"
+              f" {statistics.median(times) * 1e3:>12.2f}")
+
+
+if __name__ == '__main__':
+    main()
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
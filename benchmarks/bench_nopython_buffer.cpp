@@ -0,0 +1,448 @@
+#include <modmesh/buffer/buffer.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+/*
+ * The element counts span the cache hierarchy for 8-byte elements: 1Ki (8
+ * KiB, L1), 16Ki (128 KiB, L2), 256Ki (2 MiB, L3) and 4Mi (32 MiB, DRAM).
+ */
+#define MM_BENCH_SIZES Arg(1 << 10)->Arg(1 << 14)->Arg(1 << 18)->Arg(1 << 22)
+
+namespace
+{
+
+/// Count the calls to the global operator new to report heap allocations.
+std::atomic<size_t> heap_allocation_count{0};
+
+void * counted_allocate(size_t size)
+{
+    heap_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void * ptr = std::malloc(0 == size ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+} /* end namespace */
+
+void * operator new(size_t size) { return counted_allocate(size); }
+void * operator new[](size_t size) { return counted_allocate(size); }
+void operator delete(void * ptr) noexcept { std::free(ptr); }
+void operator delete[](void * ptr) noexcept { std::free(ptr); }
+void operator delete(void * ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void * ptr, size_t) noexcept { std::free(ptr); }
+
+namespace
+{
+
+using namespace modmesh;
+
+/// Report the heap allocations per iteration since the count was taken.
+void set_heap_allocations(benchmark::State & state, size_t begin_count)
+{
+    size_t const count = heap_allocation_count.load(std::memory_order_relaxed) - begin_count;
+    state.counters["heap_allocs"] = benchmark::Counter(static_cast<double>(count) / static_cast<double>(state.iterations()));
+}
+
+template <typename T>
+SimpleArray<T> make_iota(size_t size)
+{
+    SimpleArray<T> arr(size);
+    for (size_t it = 0; it < size; ++it)
+    {
+        arr(it) = static_cast<T>(it % 127);
+    }
+    return arr;
+}
+
+template <typename T>
+void set_bytes(benchmark::State & state, size_t size)
+{
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size * sizeof(T)));
+}
+
+template <typename T>
+void SimpleArray_construct(benchmark::State & state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        SimpleArray<T> arr(size);
+        benchmark::DoNotOptimize(arr.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK_TEMPLATE(SimpleArray_construct, double)->MM_BENCH_SIZES;
+
+template <typename T>
+void SimpleArray_construct_fill(benchmark::State & state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        SimpleArray<T> arr(small_vector<size_t>{size}, T(1));
+        benchmark::DoNotOptimize(arr.data());
+    }
+    set_bytes<T>(state, size);
+}
+BENCHMARK_TEMPLATE(SimpleArray_construct_fill, double)->MM_BENCH_SIZES;
+BENCHMARK_TEMPLATE(SimpleArray_construct_fill, int32_t)->MM_BENCH_SIZES;
+
+template <typename T>
+void SimpleArray_index_call(benchmark::State & state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    SimpleArray<T> const arr = make_iota<T>(size);
+    for (auto _ : state)
+    {
+        T total = 0;
+        for (size_t it = 0; it < size; ++it)
+        {
+            total += arr(it);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    set_bytes<T>(state, size);
+}
+BENCHMARK_TEMPLATE(SimpleArray_index_call, double)->MM_BENCH_SIZES;
+
+template <typename T>
+void SimpleArray_index_at(benchmark::State & state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    SimpleArray<T> const arr = make_iota<T>(size);
+    for (auto _ : state)
+    {
+        T total = 0;
+        for (size_t it = 0; it < size; ++it)
+        {
+            total += arr.at(it);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    set_bytes<T>(state, size);
+}
+BENCHMARK_TEMPLATE(SimpleArray_index_at, double)->MM_BENCH_SIZES;
+
+/// Index a (size/16, 16) array, the shape of the per-cell arrays of a mesh.
+template <typename T>
+void SimpleArray_index_call_2d(benchmark::State & state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    size_t const ncol = 16;
+    size_t const nrow = size / ncol;
+    SimpleArray<T> arr(small_vector<size_t>{nrow, ncol}, T(1));
+    for (auto _ : state)
+    {
+        T total = 0;
+        for (size_t i = 0; i < nrow; ++i)
+        {
+            for (size_t j = 0; j < ncol; ++j)
+            {
+                total += arr(i, j);
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    set_bytes<T>(state, nrow * ncol);
+}
+BENCHMARK_TEMPLATE(SimpleArray_index_call_2d, double)->MM_BENCH_SIZES;
+
+template <typename T>
+void SimpleArray_sum(benchmark::State & state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    SimpleArray<T> const arr = make_iota<T>(size);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(arr.sum());
+    }
+    set_bytes<T>(state, size);
+}
+BENCHMARK_TEMPLATE(SimpleArray_sum, double)->MM_BENCH_SIZES;
+BENCHMARK_TEMPLATE(SimpleArray_sum, int64_t)->MM_BENCH_SIZES;
+
+template <typename T>
+void SimpleArray_min(benchmark::State & state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    SimpleArray<T> const arr = make_iota<T>(size);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(arr.min());
+    }
+    set_bytes<T>(state, size);
+}
+BENCHMARK_TEMPLATE(SimpleArray_min, double)->MM_BENCH_SIZES;
+
+template <typename T>
+void SimpleArray_max(benchmark::State & state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    SimpleArray<T> const arr = make_iota<T>(size);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(arr.max());
+    }
+    set_bytes<T>(state, size);
+}
+BENCHMARK_TEMPLATE(SimpleArray_max, double)->MM_BENCH_SIZES;
+
+/**
+ * Reduce an (n, 5) array of the variables on the cells over the given axis
+ * into a preallocated output.  Axis 0 gives the per-variable totals and axis
+ * 1 the per-cell ones.
+ */
+template <typename T, size_t Axis>
+void SimpleArray_sum_axis(benchmark::State & state)
+{
+    size_t const nvar = 5;
+    size_t const nrow = static_cast<size_t>(state.range(0)) / nvar;
+    SimpleArray<T> const arr = make_iota<T>(nrow * nvar).reshape(small_vector<size_t>{nrow, nvar});
+    SimpleArray<T> out(small_vector<size_t>{0 == Axis ? nvar : nrow});
+    for (auto _ : state)
+    {
+        arr.sum_axis(Axis, out);
+        benchmark::ClobberMemory();
+    }
+    set_bytes<T>(state, nrow * nvar);
+}
+BENCHMARK_TEMPLATE(SimpleArray_sum_axis, double, 0)->MM_BENCH_SIZES;
+BENCHMARK_TEMPLATE(SimpleArray_sum_axis, double, 1)->MM_BENCH_SIZES;
+
+/*
+ * TypeBroadcast copies the numpy array into SimpleArray with strided_copy()
+ * after checking the slices.  Benchmark the copy without Python.
+ */
+template <typename S, typename D>
+void strided_copy_contiguous(benchmark::State & state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    SimpleArray<S> const src = make_iota<S>(size);
+    SimpleArray<D> dst(size);
+    ssize_t const stride = 1;
+    for (auto _ : state)
+    {
+        strided_copy(src.data(), &stride, dst.data(), &stride, &size, 1);
+        benchmark::ClobberMemory();
+    }
+    set_bytes<D>(state, size);
+}
+BENCHMARK_TEMPLATE(strided_copy_contiguous, double, double)->MM_BENCH_SIZES;
+BENCHMARK_TEMPLATE(strided_copy_contiguous, int32_t, double)->MM_BENCH_SIZES;
+
+/// Copy a transposed 2D array, i.e., the source is traversed with a stride.
+template <typename S, typename D>
+void strided_copy_transpose(benchmark::State & state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    size_t const ncol = 64;
+    size_t const nrow = size / ncol;
+    SimpleArray<S> const src = make_iota<S>(nrow * ncol);
+    SimpleArray<D> dst(small_vector<size_t>{ncol, nrow});
+    size_t const shape[2] = {ncol, nrow};
+    ssize_t const src_strides[2] = {1, static_cast<ssize_t>(ncol)};
+    ssize_t const dst_strides[2] = {static_cast<ssize_t>(nrow), 1};
+    for (auto _ : state)
+    {
+        strided_copy(src.data(), src_strides, dst.data(), dst_strides, shape, 2);
+        benchmark::ClobberMemory();
+    }
+    set_bytes<D>(state, nrow * ncol);
+}
+BENCHMARK_TEMPLATE(strided_copy_transpose, double, double)->MM_BENCH_SIZES;
+
+/// Convert the (n, 64) layout into a preallocated (64, n) one.
+template <typename T>
+void SimpleArray_transpose(benchmark::State & state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    size_t const ncol = 64;
+    SimpleArray<T> const arr = make_iota<T>(size).reshape(small_vector<size_t>{size / ncol, ncol});
+    SimpleArray<T> out(small_vector<size_t>{ncol, size / ncol});
+    for (auto _ : state)
+    {
+        arr.transpose(out);
+        benchmark::ClobberMemory();
+    }
+    set_bytes<T>(state, size);
+}
+BENCHMARK_TEMPLATE(SimpleArray_transpose, double)->MM_BENCH_SIZES;
+BENCHMARK_TEMPLATE(SimpleArray_transpose, float)->MM_BENCH_SIZES;
+
+/// Scatter the (n, 3) coordinates into three component arrays.
+template <typename T>
+void deinterleave_3(benchmark::State & state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    size_t const nrow = size / 3;
+    SimpleArray<T> const src = make_iota<T>(nrow * 3);
+    SimpleArray<T> dst(small_vector<size_t>{3, nrow});
+    std::array<T *, 3> const components{dst.data(), dst.data() + nrow, dst.data() + 2 * nrow};
+    for (auto _ : state)
+    {
+        deinterleave(src.data(), nrow, 3, components.data(), false);
+        benchmark::ClobberMemory();
+    }
+    set_bytes<T>(state, nrow * 3);
+}
+BENCHMARK_TEMPLATE(deinterleave_3, double)->MM_BENCH_SIZES;
+
+/// Grow small_vector past the inline capacity to the given size.
+void small_vector_push_back(benchmark::State & state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        small_vector<size_t> vec;
+        for (size_t it = 0; it < size; ++it)
+        {
+            vec.push_back(it);
+        }
+        benchmark::DoNotOptimize(vec.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+BENCHMARK(small_vector_push_back)->RangeMultiplier(4)->Range(1, 4096);
+
+/// Copy small_vector of the size of an array shape, done for every SimpleArray.
+void small_vector_copy(benchmark::State & state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    small_vector<size_t> const vec(size, 1);
+    for (auto _ : state)
+    {
+        small_vector<size_t> cpy(vec);
+        benchmark::DoNotOptimize(cpy.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(small_vector_copy)->DenseRange(1, 4)->Arg(16)->Arg(64);
+
+/*
+ * The shapes of arrays of a rank up to MODMESH_SHAPE_INLINE_CAPACITY are kept
+ * inline, so that indexing and broadcasting do not allocate.  The rank past
+ * the inline capacity is included for comparison.
+ */
+#define MM_BENCH_RANKS DenseRange(1, MODMESH_SHAPE_INLINE_CAPACITY + 1)
+
+SimpleArray<double> make_rank(size_t rank)
+{
+    return SimpleArray<double>(SimpleArray<double>::shape_type(rank, 3), 1.0);
+}
+
+/// Index with the rank-generic at(), building the index every time.
+void SimpleArray_at_rank(benchmark::State & state)
+{
+    auto const rank = static_cast<size_t>(state.range(0));
+    SimpleArray<double> const arr = make_rank(rank);
+    size_t const begin_count = heap_allocation_count.load(std::memory_order_relaxed);
+    for (auto _ : state)
+    {
+        SimpleArray<double>::sshape_type idx(rank, 1);
+        benchmark::DoNotOptimize(arr.at(idx));
+    }
+    set_heap_allocations(state, begin_count);
+}
+BENCHMARK(SimpleArray_at_rank)->MM_BENCH_RANKS;
+
+/// Copy and compare the shape and stride, e.g., to check an operand.
+void SimpleArray_shape_copy_rank(benchmark::State & state)
+{
+    auto const rank = static_cast<size_t>(state.range(0));
+    SimpleArray<double> const arr = make_rank(rank);
+    size_t const begin_count = heap_allocation_count.load(std::memory_order_relaxed);
+    for (auto _ : state)
+    {
+        SimpleArray<double>::shape_type shape(arr.shape());
+        SimpleArray<double>::shape_type stride = arr.stride();
+        benchmark::DoNotOptimize(shape == arr.shape() && stride == arr.stride());
+    }
+    set_heap_allocations(state, begin_count);
+}
+BENCHMARK(SimpleArray_shape_copy_rank)->MM_BENCH_RANKS;
+
+/// The shape and stride bookkeeping of TypeBroadcast followed by the copy.
+void strided_copy_broadcast_rank(benchmark::State & state)
+{
+    auto const rank = static_cast<size_t>(state.range(0));
+    SimpleArray<double> const src = make_rank(rank);
+    SimpleArray<double> dst = make_rank(rank);
+    size_t const begin_count = heap_allocation_count.load(std::memory_order_relaxed);
+    for (auto _ : state)
+    {
+        SimpleArray<double>::shape_type shape(rank);
+        SimpleArray<double>::sshape_type src_strides(rank);
+        SimpleArray<double>::sshape_type dst_strides(rank);
+        for (size_t it = 0; it < rank; ++it)
+        {
+            shape[it] = src.shape(it);
+            src_strides[it] = static_cast<ssize_t>(src.stride(it));
+            dst_strides[it] = static_cast<ssize_t>(dst.stride(it));
+        }
+        strided_copy(src.data(), src_strides.data(), dst.data(), dst_strides.data(), shape.data(), rank);
+        benchmark::ClobberMemory();
+    }
+    set_heap_allocations(state, begin_count);
+}
+BENCHMARK(strided_copy_broadcast_rank)->MM_BENCH_RANKS;
+
+/// Sum through the single variant dispatch of SimpleArrayPlex.
+void SimpleArrayPlex_dispatch_sum(benchmark::State & state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    SimpleArrayPlex const plex(make_iota<double>(size));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(plex.sum());
+    }
+    set_bytes<double>(state, size);
+}
+BENCHMARK(SimpleArrayPlex_dispatch_sum)->MM_BENCH_SIZES;
+
+/// Construct SimpleArrayPlex from the runtime type, including the allocation.
+void SimpleArrayPlex_construct(benchmark::State & state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        SimpleArrayPlex plex(small_vector<size_t>{size}, DataType::Float64);
+        benchmark::DoNotOptimize(plex.instance_ptr());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(SimpleArrayPlex_construct)->MM_BENCH_SIZES;
+
+/// Convert float64 to the element type of the destination with copy_from.
+template <typename T>
+void SimpleArrayPlex_convert(benchmark::State & state)
+{
+    size_t const size = static_cast<size_t>(state.range(0));
+    SimpleArrayPlex const src(make_iota<double>(size));
+    SimpleArrayPlex dst(small_vector<size_t>{size}, get_data_type_from_type<T>());
+    for (auto _ : state)
+    {
+        dst.copy_from(src);
+        benchmark::DoNotOptimize(dst.instance_ptr());
+        benchmark::ClobberMemory();
+    }
+    set_bytes<double>(state, size);
+}
+BENCHMARK_TEMPLATE(SimpleArrayPlex_convert, float)->MM_BENCH_SIZES;
+BENCHMARK_TEMPLATE(SimpleArrayPlex_convert, int32_t)->MM_BENCH_SIZES;
+BENCHMARK_TEMPLATE(SimpleArrayPlex_convert, Float16)->MM_BENCH_SIZES;
+
+} /* end namespace */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
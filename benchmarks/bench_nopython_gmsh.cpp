@@ -0,0 +1,441 @@
+#include <modmesh/inout/inout.hpp>
+#include <modmesh/toggle/profile.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+#if !defined(__linux__) && !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+/*
+ * The meshes have 2n^2 triangles and (n+1)^2 nodes.  n = 512 gives 524288
+ * triangles in about 20 MB of text.
+ */
+#define MM_BENCH_GMSH_SIZES Arg(64)->Arg(256)->Arg(512)
+
+// 10^8 triangles take about 5 GB of text; raise the exponent to run them.
+#ifndef MODMESH_BENCH_GMSH_MAX_EXPONENT
+#define MODMESH_BENCH_GMSH_MAX_EXPONENT 6
+#endif
+
+namespace
+{
+
+using namespace modmesh;
+using namespace modmesh::inout;
+
+/// The text of a Gmsh 2.2 file of the n*n squares in [0, n]^2, each split into two triangles.
+std::string make_gmsh_text(size_t n)
+{
+    size_t const nnd = n + 1;
+    std::ostringstream out;
+    out << "$MeshFormat\n2.2 0 8\n$EndMeshFormat\n";
+    out << "$PhysicalNames\n1\n2 1 \"domain\"\n$EndPhysicalNames\n";
+    out << "$Nodes\n"
+        << nnd * nnd << "\n";
+    for (size_t j = 0; j < nnd; ++j)
+    {
+        for (size_t i = 0; i < nnd; ++i)
+        {
+            out << j * nnd + i + 1 << " " << i << " " << j << " 0\n";
+        }
+    }
+    out << "$EndNodes\n$Elements\n"
+        << 2 * n * n << "\n";
+    size_t iel = 1;
+    for (size_t j = 0; j < n; ++j)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            size_t const n0 = j * nnd + i + 1;
+            size_t const n1 = n0 + 1;
+            size_t const n2 = n1 + nnd;
+            size_t const n3 = n0 + nnd;
+            out << iel++ << " 2 2 1 1 " << n0 << " " << n1 << " " << n2 << "\n";
+            out << iel++ << " 2 2 1 1 " << n0 << " " << n2 << " " << n3 << "\n";
+        }
+    }
+    out << "$EndElements\n";
+    return out.str();
+}
+
+void Gmsh_parse(benchmark::State & state)
+{
+    std::string const text = make_gmsh_text(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        Gmsh gmsh(text);
+        benchmark::DoNotOptimize(&gmsh);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+}
+BENCHMARK(Gmsh_parse)->MM_BENCH_GMSH_SIZES->Unit(benchmark::kMillisecond);
+
+/// Parsing and building the interior, boundary and ghost of the mesh.
+void Gmsh_to_block(benchmark::State & state)
+{
+    std::string const text = make_gmsh_text(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        Gmsh gmsh(text);
+        std::shared_ptr<StaticMesh> mesh = gmsh.to_block();
+        benchmark::DoNotOptimize(mesh.get());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+}
+BENCHMARK(Gmsh_to_block)->MM_BENCH_GMSH_SIZES->Unit(benchmark::kMillisecond);
+
+/*
+ * Ingestion of the synthetic files of 10^4 triangles and up.  Each file is
+ * written once to the temporary directory and read by Gmsh::from_file() like
+ * a user file.  The arguments are the format and the decimal exponent of the
+ * number of triangles.  Besides the byte and element rates, the benchmarks
+ * report the seconds per iteration of the MODMESH_TIME scopes of the node and
+ * element sections, and the peak resident set size while they run.
+ */
+
+enum class GmshFormat : int64_t
+{
+    V22_ASCII,
+    V41_ASCII,
+    V41_BINARY,
+};
+
+/// Append the text of a number to the buffer.
+template <typename T>
+void append_number(std::string & buf, T value)
+{
+    char text[32]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    int const len = std::is_floating_point_v<T> ? std::snprintf(text, sizeof(text), "%.17g", static_cast<double>(value))
+                                                : std::snprintf(text, sizeof(text), "%llu", static_cast<unsigned long long>(value));
+    buf.append(text, static_cast<size_t>(len));
+}
+
+/// Append the bytes of a number in the native byte order to the buffer.
+template <typename T>
+void append_binary(std::string & buf, T value)
+{
+    char bytes[sizeof(T)]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    std::memcpy(bytes, &value, sizeof(T));
+    buf.append(bytes, sizeof(T));
+}
+
+/**
+ * Write the n*n squares of the unit square, each split into two triangles,
+ * in the format.  The buffer is flushed to the file by pieces to keep the
+ * memory flat for the large files.
+ */
+void write_gmsh_file(std::string const & path, GmshFormat format, size_t n)
+{
+    bool const v41 = GmshFormat::V22_ASCII != format;
+    bool const binary = GmshFormat::V41_BINARY == format;
+    size_t const nnd = n + 1;
+    size_t const nnode = nnd * nnd;
+    size_t const nelem = 2 * n * n;
+    double const step = 1.0 / static_cast<double>(n);
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    std::string buf;
+    auto flush = [&](bool force)
+    {
+        if (force || buf.size() > (size_t(1) << 22))
+        {
+            out.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+            buf.clear();
+        }
+    };
+    // Write the ASCII numbers separated by the spaces and ended by a newline,
+    // or their bytes in the binary mode.
+    auto integers = [&](std::initializer_list<uint64_t> values, bool as_int32 = false)
+    {
+        size_t it = 0;
+        for (uint64_t const value : values)
+        {
+            if (binary && as_int32)
+            {
+                append_binary(buf, static_cast<int32_t>(value));
+            }
+            else if (binary)
+            {
+                append_binary(buf, value);
+            }
+            else
+            {
+                buf += 0 == it++ ? "" : " ";
+                append_number(buf, value);
+            }
+        }
+        if (!binary)
+        {
+            buf += "\n";
+        }
+    };
+
+    buf += v41 ? (binary ? "$MeshFormat\n4.1 1 8\n" : "$MeshFormat\n4.1 0 8\n") : "$MeshFormat\n2.2 0 8\n";
+    if (binary)
+    {
+        append_binary(buf, int32_t(1));
+        buf += "\n";
+    }
+    buf += "$EndMeshFormat\n$PhysicalNames\n1\n2 1 \"domain\"\n$EndPhysicalNames\n";
+    if (v41)
+    {
+        // One surface of the physical tag 1 holds all the nodes and elements.
+        buf += "$Entities\n";
+        integers({0, 0, 1, 0});
+        integers({1}, true);
+        for (double const crd : {0.0, 0.0, 0.0, 1.0, 1.0, 0.0})
+        {
+            if (binary)
+            {
+                append_binary(buf, crd);
+            }
+            else
+            {
+                append_number(buf, crd);
+                buf += " ";
+            }
+        }
+        integers({1});
+        integers({1}, true);
+        integers({0});
+        buf += binary ? "\n$EndEntities\n" : "$EndEntities\n";
+        buf += "$Nodes\n";
+        integers({1, nnode, 1, nnode});
+        integers({2, 1, 0}, true);
+        integers({nnode});
+        for (size_t it = 1; it <= nnode; ++it)
+        {
+            integers({it});
+            flush(false);
+        }
+    }
+    else
+    {
+        buf += "$Nodes\n";
+        integers({nnode});
+    }
+    for (size_t j = 0; j < nnd; ++j)
+    {
+        for (size_t i = 0; i < nnd; ++i)
+        {
+            if (!v41)
+            {
+                append_number(buf, j * nnd + i + 1);
+                buf += " ";
+            }
+            double const crd[3] = {static_cast<double>(i) * step, static_cast<double>(j) * step, 0.0}; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+            for (size_t ic = 0; ic < 3; ++ic)
+            {
+                if (binary)
+                {
+                    append_binary(buf, crd[ic]);
+                }
+                else
+                {
+                    append_number(buf, crd[ic]);
+                    buf += 2 == ic ? "\n" : " ";
+                }
+            }
+            flush(false);
+        }
+    }
+    buf += binary ? "\n$EndNodes\n$Elements\n" : "$EndNodes\n$Elements\n";
+    if (v41)
+    {
+        integers({1, nelem, 1, nelem});
+        integers({2, 1, 2}, true);
+        integers({nelem});
+    }
+    else
+    {
+        integers({nelem});
+    }
+    size_t iel = 1;
+    for (size_t j = 0; j < n; ++j)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            uint64_t const n0 = j * nnd + i + 1;
+            uint64_t const n1 = n0 + 1;
+            uint64_t const n2 = n1 + nnd;
+            uint64_t const n3 = n0 + nnd;
+            if (v41)
+            {
+                integers({iel++, n0, n1, n2});
+                integers({iel++, n0, n2, n3});
+            }
+            else
+            {
+                integers({iel++, 2, 2, 1, 1, n0, n1, n2});
+                integers({iel++, 2, 2, 1, 1, n0, n2, n3});
+            }
+            flush(false);
+        }
+    }
+    buf += binary ? "\n$EndElements\n" : "$EndElements\n";
+    flush(true);
+}
+
+/// The synthetic files, kept for the benchmarks of the same arguments and removed at exit.
+class GmshFileStore
+{
+
+public:
+
+    static GmshFileStore & me()
+    {
+        static GmshFileStore store;
+        return store;
+    }
+
+    GmshFileStore(GmshFileStore const &) = delete;
+    GmshFileStore(GmshFileStore &&) = delete;
+    GmshFileStore & operator=(GmshFileStore const &) = delete;
+    GmshFileStore & operator=(GmshFileStore &&) = delete;
+
+    ~GmshFileStore()
+    {
+        for (auto const & item : m_paths)
+        {
+            std::error_code ec;
+            std::filesystem::remove(item.second, ec);
+        }
+    }
+
+    /// The path of the file and the number of the triangles.
+    std::tuple<std::string, size_t> get(GmshFormat format, int64_t exponent)
+    {
+        // 2n^2 triangles.
+        auto const n = static_cast<size_t>(std::llround(std::sqrt(std::pow(10.0, static_cast<double>(exponent)) / 2.0)));
+        auto const key = std::make_tuple(format, exponent);
+        auto it = m_paths.find(key);
+        if (it == m_paths.end())
+        {
+            std::filesystem::path const path = std::filesystem::temp_directory_path() / (Formatter() << "modmesh_bench_gmsh_" << static_cast<int64_t>(format) << "_" << exponent << ".msh").str();
+            write_gmsh_file(path.string(), format, n);
+            it = m_paths.emplace(key, path.string()).first;
+        }
+        return {it->second, 2 * n * n};
+    }
+
+private:
+
+    GmshFileStore() = default;
+
+    std::map<std::tuple<GmshFormat, int64_t>, std::string> m_paths;
+
+}; /* end class GmshFileStore */
+
+#if defined(__linux__)
+// Writing 5 to clear_refs resets the peak (VmHWM) to the current size.
+void reset_peak_rss()
+{
+    std::ofstream("/proc/self/clear_refs") << "5";
+}
+
+size_t read_peak_rss()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (0 == line.compare(0, 6, "VmHWM:"))
+        {
+            return static_cast<size_t>(std::stoull(line.substr(6))) * 1024;
+        }
+    }
+    return 0;
+}
+#elif !defined(_WIN32)
+// The peak cannot be reset, so it covers the earlier benchmarks as well.
+void reset_peak_rss() {}
+
+size_t read_peak_rss()
+{
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    // Bytes on macOS.
+    return static_cast<size_t>(usage.ru_maxrss);
+}
+#else
+void reset_peak_rss() {}
+size_t read_peak_rss() { return 0; }
+#endif
+
+void Gmsh_ingest(benchmark::State & state, bool build)
+{
+    auto const [path, nelem] = GmshFileStore::me().get(static_cast<GmshFormat>(state.range(0)), state.range(1));
+    size_t const nbyte = std::filesystem::file_size(path);
+    // The cached mesh would skip the parsing.
+    MeshCache::instance().set_directory("");
+    bool const profiling = ScopeProfilerStatus::enabled();
+    uint32_t const period = ScopeProfilerStatus::sampling_period();
+    ScopeProfilerStatus::enable();
+    ScopeProfilerStatus::set_sampling_period(1);
+    TimeRegistry::me().clear();
+    reset_peak_rss();
+    for (auto _ : state)
+    {
+        std::shared_ptr<Gmsh> gmsh = Gmsh::from_file(path);
+        if (build)
+        {
+            std::shared_ptr<StaticMesh> mesh = gmsh->to_block();
+            benchmark::DoNotOptimize(mesh.get());
+        }
+        benchmark::DoNotOptimize(gmsh.get());
+    }
+    size_t const peak = read_peak_rss();
+    ScopeProfilerStatus::set_sampling_period(period);
+    if (!profiling)
+    {
+        ScopeProfilerStatus::disable();
+    }
+
+    auto const niter = static_cast<double>(state.iterations());
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(nbyte));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nelem));
+    state.counters["nelem"] = static_cast<double>(nelem);
+    bool const v41 = GmshFormat::V22_ASCII != static_cast<GmshFormat>(state.range(0));
+    state.counters["load_nodes_s"] = TimeRegistry::me().entry(v41 ? "Gmsh::load_nodes_v4" : "Gmsh::load_nodes").time() / niter;
+    state.counters["load_elements_s"] = TimeRegistry::me().entry(v41 ? "Gmsh::load_elements_v4" : "Gmsh::load_elements").time() / niter;
+    state.counters["peak_rss"] = benchmark::Counter(static_cast<double>(peak), benchmark::Counter::kDefaults, benchmark::Counter::OneK::kIs1024);
+}
+
+void register_ingest(char const * name, bool build)
+{
+    benchmark::internal::Benchmark * bench = benchmark::RegisterBenchmark(name, Gmsh_ingest, build);
+    bench->ArgNames({"format", "exp10"})->Unit(benchmark::kMillisecond);
+    for (GmshFormat const format : {GmshFormat::V22_ASCII, GmshFormat::V41_ASCII, GmshFormat::V41_BINARY})
+    {
+        for (int64_t exponent = 4; exponent <= MODMESH_BENCH_GMSH_MAX_EXPONENT; ++exponent)
+        {
+            bench->Args({static_cast<int64_t>(format), exponent});
+        }
+    }
+}
+
+int const registered = []()
+{
+    register_ingest("Gmsh_ingest_parse", false);
+    register_ingest("Gmsh_ingest_to_block", true);
+    return 0;
+}();
+
+} /* end namespace */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,170 @@
+#include <modmesh/grid.hpp>
+
+#include <benchmark/benchmark.h>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+/*
+ * The grids have n^3 points.
+ */
+#define MM_BENCH_GRID_SIZES Arg(64)->Arg(128)->Arg(256)
+
+/*
+ * The 1D grids have n coordinates and are probed by 2^20 points.
+ */
+#define MM_BENCH_LOCATE_SIZES Arg(1 << 10)->Arg(1 << 20)
+
+namespace
+{
+
+using namespace modmesh;
+
+StaticGrid3d make_grid(size_t n, StaticGridLayout layout)
+{
+    StaticGrid3d grid(n, n, n, layout);
+    for (size_t k = 0; k < n; ++k)
+    {
+        for (size_t j = 0; j < n; ++j)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                grid(i, j, k) = static_cast<double>((i * 7 + j * 5 + k * 3) % 11);
+            }
+        }
+    }
+    return grid;
+}
+
+/// The 7-point Laplacian of the interior points of src, written to dst of the
+/// same layout, row segment by row segment.
+void sweep_laplacian(StaticGrid3d const & src, StaticGrid3d & dst)
+{
+    size_t const nx = src.nx();
+    size_t const ny = src.ny();
+    size_t const nz = src.nz();
+    double const * base = src.values().data();
+    double * out = dst.values().data();
+    src.for_each_row(
+        [&](StaticGrid3d::shape_type const & index, size_t count, double const * c)
+        {
+            size_t const i0 = index[0];
+            size_t const j = index[1];
+            size_t const k = index[2];
+            if (0 == j || 0 == k || ny - 1 == j || nz - 1 == k)
+            {
+                return;
+            }
+            // The segments of the neighboring rows are contiguous over the
+            // same x range in both layouts.
+            double const * ym = base + src.offset(i0, j - 1, k);
+            double const * yp = base + src.offset(i0, j + 1, k);
+            double const * zm = base + src.offset(i0, j, k - 1);
+            double const * zp = base + src.offset(i0, j, k + 1);
+            double * o = out + (c - base);
+            auto const point = [&](size_t ii, double xm, double xp)
+            { o[ii] = xm + xp + ym[ii] + yp[ii] + zm[ii] + zp[ii] - 6.0 * c[ii]; };
+            if (0 != i0)
+            {
+                point(0, src(i0 - 1, j, k), c[1]);
+            }
+            for (size_t ii = 1; ii + 1 < count; ++ii)
+            {
+                o[ii] = c[ii - 1] + c[ii + 1] + ym[ii] + yp[ii] + zm[ii] + zp[ii] - 6.0 * c[ii];
+            }
+            if (nx != i0 + count)
+            {
+                point(count - 1, c[count - 2], src(i0 + count, j, k));
+            }
+        });
+}
+
+void sweep(benchmark::State & state, StaticGridLayout layout)
+{
+    auto const n = static_cast<size_t>(state.range(0));
+    StaticGrid3d src = make_grid(n, layout);
+    StaticGrid3d dst(n, n, n, layout);
+    for (auto _ : state)
+    {
+        sweep_laplacian(src, dst);
+        benchmark::DoNotOptimize(dst.values().data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n * n * n));
+}
+
+void StaticGrid3d_laplacian_rowmajor(benchmark::State & state) { sweep(state, StaticGridLayout::RowMajor); }
+BENCHMARK(StaticGrid3d_laplacian_rowmajor)->MM_BENCH_GRID_SIZES->Unit(benchmark::kMicrosecond);
+
+void StaticGrid3d_laplacian_blocked(benchmark::State & state) { sweep(state, StaticGridLayout::Blocked); }
+BENCHMARK(StaticGrid3d_laplacian_blocked)->MM_BENCH_GRID_SIZES->Unit(benchmark::kMicrosecond);
+
+StaticGrid1d make_grid1d(size_t n, bool uniform)
+{
+    StaticGrid1d grid(static_cast<StaticGrid1d::serial_type>(n));
+    double x = 0.0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        grid[i] = x;
+        // A mildly stretched spacing that is not uniform.
+        x += uniform ? 1.0 : 1.0 + 0.5 * static_cast<double>(i % 3);
+    }
+    return grid;
+}
+
+SimpleArray<double> make_probes(StaticGrid1d const & grid)
+{
+    size_t const npoint = size_t(1) << 20;
+    SimpleArray<double> points(npoint);
+    double const span = grid[grid.size() - 1] - grid[0];
+    uint64_t seed = 1;
+    for (size_t i = 0; i < npoint; ++i)
+    {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        points(i) = grid[0] + span * static_cast<double>(seed >> 11) / static_cast<double>(uint64_t(1) << 53);
+    }
+    return points;
+}
+
+void locate(benchmark::State & state, bool uniform)
+{
+    StaticGrid1d const grid = make_grid1d(static_cast<size_t>(state.range(0)), uniform);
+    SimpleArray<double> const points = make_probes(grid);
+    for (auto _ : state)
+    {
+        SimpleArray<int32_t> found = grid.locate(points);
+        benchmark::DoNotOptimize(found.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+}
+
+void StaticGrid1d_locate_uniform(benchmark::State & state) { locate(state, true); }
+BENCHMARK(StaticGrid1d_locate_uniform)->MM_BENCH_LOCATE_SIZES->Unit(benchmark::kMicrosecond);
+
+void StaticGrid1d_locate_nonuniform(benchmark::State & state) { locate(state, false); }
+BENCHMARK(StaticGrid1d_locate_nonuniform)->MM_BENCH_LOCATE_SIZES->Unit(benchmark::kMicrosecond);
+
+/// The baseline of a serial std::upper_bound for each point.
+void StaticGrid1d_locate_upper_bound(benchmark::State & state)
+{
+    StaticGrid1d const grid = make_grid1d(static_cast<size_t>(state.range(0)), false);
+    SimpleArray<double> const points = make_probes(grid);
+    double const * first = grid.coord().data();
+    double const * last = first + grid.size();
+    for (auto _ : state)
+    {
+        SimpleArray<int32_t> found(points.size());
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            found(i) = static_cast<int32_t>(std::upper_bound(first, last, points(i)) - first) - 1;
+        }
+        benchmark::DoNotOptimize(found.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+}
+BENCHMARK(StaticGrid1d_locate_upper_bound)->MM_BENCH_LOCATE_SIZES->Unit(benchmark::kMicrosecond);
+
+} /* end namespace */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
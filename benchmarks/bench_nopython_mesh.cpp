@@ -0,0 +1,273 @@
+#include <modmesh/mesh/mesh.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <set>
+#include <utility>
+#include <vector>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+/*
+ * The hexahedral meshes have n^3 cells, about 3n^3 faces and 12n^3
+ * face-edges.  n = 64 gives 262144 cells.
+ */
+#define MM_BENCH_MESH_SIZES Arg(8)->Arg(16)->Arg(32)->Arg(64)
+
+namespace
+{
+
+using namespace modmesh;
+
+/// Structured n*n*n hexahedral mesh with the interior faces built.
+std::shared_ptr<StaticMesh> make_hexahedral_mesh(size_t n)
+{
+    size_t const nnd = n + 1;
+    auto const nnode = static_cast<uint_type>(nnd * nnd * nnd);
+    auto const ncell = static_cast<uint_type>(n * n * n);
+    std::shared_ptr<StaticMesh> mesh = StaticMesh::construct(/* ndim */ 3, nnode, /* nface */ 0, ncell);
+    auto node = [nnd](size_t i, size_t j, size_t k)
+    { return static_cast<int_type>((k * nnd + j) * nnd + i); };
+    for (size_t k = 0; k < nnd; ++k)
+    {
+        for (size_t j = 0; j < nnd; ++j)
+        {
+            for (size_t i = 0; i < nnd; ++i)
+            {
+                int_type const ind = node(i, j, k);
+                mesh->ndcrd(ind, 0) = static_cast<double>(i);
+                mesh->ndcrd(ind, 1) = static_cast<double>(j);
+                mesh->ndcrd(ind, 2) = static_cast<double>(k);
+            }
+        }
+    }
+    for (size_t k = 0; k < n; ++k)
+    {
+        for (size_t j = 0; j < n; ++j)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                auto const icl = static_cast<int_type>((k * n + j) * n + i);
+                mesh->cltpn(icl) = CellType::HEXAHEDRON;
+                mesh->clnds(icl, 0) = 8;
+                mesh->clnds(icl, 1) = node(i, j, k);
+                mesh->clnds(icl, 2) = node(i + 1, j, k);
+                mesh->clnds(icl, 3) = node(i + 1, j + 1, k);
+                mesh->clnds(icl, 4) = node(i, j + 1, k);
+                mesh->clnds(icl, 5) = node(i, j, k + 1);
+                mesh->clnds(icl, 6) = node(i + 1, j, k + 1);
+                mesh->clnds(icl, 7) = node(i + 1, j + 1, k + 1);
+                mesh->clnds(icl, 8) = node(i, j + 1, k + 1);
+            }
+        }
+    }
+    mesh->build_interior(/* do_metric */ false, /* do_edge */ false);
+    return mesh;
+}
+
+/// The std::set deduplication that StaticMesh::build_edge used to do, kept as the baseline.
+std::vector<std::pair<int32_t, int32_t>> build_edge_with_set(StaticMesh const & mesh)
+{
+    using etype = std::pair<int32_t, int32_t>;
+    std::set<etype> known_edges;
+    std::vector<etype> edges;
+    for (uint32_t ifc = 0; ifc < mesh.nface(); ++ifc)
+    {
+        for (int32_t inf = 1; inf <= mesh.fcnds(ifc, 0); ++inf)
+        {
+            int32_t const idx1 = (mesh.fcnds(ifc, 0) == inf) ? 1 : inf + 1;
+            int32_t nd0 = mesh.fcnds(ifc, inf);
+            int32_t nd1 = mesh.fcnds(ifc, idx1);
+            if (nd0 > nd1)
+            {
+                std::swap(nd0, nd1);
+            }
+            etype const edge(nd0, nd1);
+            if (known_edges.insert(edge).second)
+            {
+                edges.push_back(edge);
+            }
+        }
+    }
+    return edges;
+}
+
+void set_items(benchmark::State & state, StaticMesh const & mesh)
+{
+    size_t nfcedge = 0;
+    for (uint32_t ifc = 0; ifc < mesh.nface(); ++ifc)
+    {
+        nfcedge += static_cast<size_t>(mesh.fcnds(ifc, 0));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nfcedge));
+}
+
+void StaticMesh_build_edge(benchmark::State & state)
+{
+    std::shared_ptr<StaticMesh> mesh = make_hexahedral_mesh(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        mesh->build_edge();
+        benchmark::DoNotOptimize(mesh->ednds().body());
+    }
+
+    // Check against the baseline so that a faster build_edge cannot be wrong.
+    std::vector<std::pair<int32_t, int32_t>> const expected = build_edge_with_set(*mesh);
+    bool same = expected.size() == mesh->nedge();
+    for (size_t ied = 0; same && ied < expected.size(); ++ied)
+    {
+        same = expected[ied].first == mesh->ednds(ied, 0) && expected[ied].second == mesh->ednds(ied, 1);
+    }
+    if (!same)
+    {
+        state.SkipWithError("build_edge differs from the std::set baseline");
+    }
+    set_items(state, *mesh);
+}
+BENCHMARK(StaticMesh_build_edge)->MM_BENCH_MESH_SIZES->Unit(benchmark::kMillisecond);
+
+void StaticMesh_build_edge_set_baseline(benchmark::State & state)
+{
+    std::shared_ptr<StaticMesh> mesh = make_hexahedral_mesh(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::vector<std::pair<int32_t, int32_t>> edges = build_edge_with_set(*mesh);
+        benchmark::DoNotOptimize(edges.data());
+    }
+    set_items(state, *mesh);
+}
+BENCHMARK(StaticMesh_build_edge_set_baseline)->MM_BENCH_MESH_SIZES->Unit(benchmark::kMillisecond);
+
+void StaticMesh_build_faces(benchmark::State & state)
+{
+    std::shared_ptr<StaticMesh> mesh = make_hexahedral_mesh(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        mesh->build_interior(/* do_metric */ false, /* do_edge */ false);
+        benchmark::DoNotOptimize(mesh->fcnds().body());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * mesh->ncell()));
+}
+BENCHMARK(StaticMesh_build_faces)->MM_BENCH_MESH_SIZES->Unit(benchmark::kMillisecond);
+
+/// Add a boundary condition for each of the six sides of the hexahedral mesh but the last one.
+void add_side_bcs(StaticMesh & mesh, size_t n)
+{
+    std::vector<std::vector<int_type>> sides(6);
+    for (uint32_t ifc = 0; ifc < mesh.nface(); ++ifc)
+    {
+        if (mesh.fcjcl(static_cast<int_type>(ifc)) >= 0)
+        {
+            continue;
+        }
+        for (size_t idim = 0; idim < 3; ++idim)
+        {
+            bool lower = true;
+            bool upper = true;
+            for (int_type inf = 1; inf <= mesh.fcnds(ifc, 0); ++inf)
+            {
+                double const crd = mesh.ndcrd(mesh.fcnds(ifc, inf), idim);
+                lower = lower && (0.0 == crd);
+                upper = upper && (static_cast<double>(n) == crd);
+            }
+            if (lower || upper)
+            {
+                sides[idim * 2 + (upper ? 1 : 0)].push_back(static_cast<int_type>(ifc));
+            }
+        }
+    }
+    for (size_t iside = 0; iside < 5; ++iside)
+    {
+        StaticMeshBC bc(sides[iside].size());
+        for (size_t ibfc = 0; ibfc < sides[iside].size(); ++ibfc)
+        {
+            bc.facn()(ibfc, 0) = sides[iside][ibfc];
+        }
+        mesh.add_bc(std::move(bc));
+    }
+}
+
+void StaticMesh_build_boundary(benchmark::State & state)
+{
+    auto const n = static_cast<size_t>(state.range(0));
+    size_t nbound = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::shared_ptr<StaticMesh> mesh = make_hexahedral_mesh(n);
+        add_side_bcs(*mesh, n);
+        state.ResumeTiming();
+        mesh->build_boundary();
+        benchmark::DoNotOptimize(mesh->bndfcs().body());
+        nbound = mesh->nbound();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nbound));
+}
+BENCHMARK(StaticMesh_build_boundary)->MM_BENCH_MESH_SIZES->Unit(benchmark::kMillisecond);
+
+/**
+ * March the upwind advection of a scalar on the hexahedral mesh by the
+ * explicit Euler step.  The ghost cells keep the initial value as the
+ * inflow.  The rate of face_updates is the faces of which the flux is
+ * accumulated per second.
+ */
+void advect(benchmark::State & state, FaceLoopStrategy strategy)
+{
+    auto const n = static_cast<size_t>(state.range(0));
+    std::shared_ptr<StaticMesh> mesh = make_hexahedral_mesh(n);
+    mesh->build_interior(/* do_metric */ true, /* do_edge */ false);
+    mesh->build_boundary();
+    mesh->build_ghost();
+    size_t const ngstcell = mesh->ngstcell();
+    size_t const ncell = mesh->ncell();
+
+    SimpleArray<double> u(small_vector<size_t>{ngstcell + ncell, 1}, 1.0);
+    u.set_nghost(ngstcell);
+    SimpleArray<double> residual(small_vector<size_t>{ngstcell + ncell, 1});
+    residual.set_nghost(ngstcell);
+    UpwindAdvectionFlux<double> flux;
+    flux.velocity = {1.0, 0.5, 0.25};
+    double const dt = 0.5;
+    for (auto _ : state)
+    {
+        residual.fill(0.0);
+        accumulate_face_flux(*mesh, flux, u, residual, strategy);
+        for (size_t icl = 0; icl < ncell; ++icl)
+        {
+            u(icl, 0) += dt * residual(icl, 0) / mesh->clvol(icl);
+        }
+        benchmark::DoNotOptimize(u.body());
+    }
+    state.counters["face_updates"] = benchmark::Counter(
+        static_cast<double>(state.iterations() * mesh->nface()),
+        benchmark::Counter::kIsRate);
+}
+
+void StaticMesh_face_loop_color(benchmark::State & state) { advect(state, FaceLoopStrategy::COLOR); }
+BENCHMARK(StaticMesh_face_loop_color)->MM_BENCH_MESH_SIZES->Unit(benchmark::kMillisecond);
+
+void StaticMesh_face_loop_gather(benchmark::State & state) { advect(state, FaceLoopStrategy::GATHER); }
+BENCHMARK(StaticMesh_face_loop_gather)->MM_BENCH_MESH_SIZES->Unit(benchmark::kMillisecond);
+
+/// The product of the cell operator of the hexahedral mesh, of 7 entries in an interior row.
+void StaticMesh_spmv_cell(benchmark::State & state)
+{
+    std::shared_ptr<StaticMesh> mesh = make_hexahedral_mesh(static_cast<size_t>(state.range(0)));
+    SparseMatrix<double> mat = SparseMatrix<double>::from_cell_cells(*mesh);
+    mat.values().fill(1.0);
+    SimpleArray<double> x(small_vector<size_t>{mat.ncol()}, 1.0);
+    SimpleArray<double> y(small_vector<size_t>{mat.nrow()});
+    for (auto _ : state)
+    {
+        mat.multiply(x, y);
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * mat.nnz()));
+}
+BENCHMARK(StaticMesh_spmv_cell)->MM_BENCH_MESH_SIZES->Unit(benchmark::kMillisecond);
+
+} /* end namespace */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/mesh.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+/*
+ * Scaling baseline of the StaticMesh build phases over structured meshes of
+ * 10^3 cells and up.  The benchmark arguments are the cell type and the
+ * decimal exponent of the requested number of cells; the generated mesh has
+ * about that many cells.  Each phase reports the throughput in cells per
+ * second and the peak of the buffer memory recorded by AllocationTracker
+ * while it runs.  StaticMesh_scaling_generate times StaticMeshGenerator over
+ * its shapes.
+ */
+
+#ifndef MODMESH_BENCH_MESH_MAX_EXPONENT
+#define MODMESH_BENCH_MESH_MAX_EXPONENT 6
+#endif
+
+namespace
+{
+
+using namespace modmesh;
+
+/// Generator of about the number of cells in the unit square or cube, of
+/// which the blocks have as many cells as a single block.
+StaticMeshGenerator make_generator(StaticMeshGenerator::Shape shape, size_t ncell_wanted)
+{
+    bool const is3d = 3 == StaticMeshGenerator::ndim_of(shape);
+    size_t const nsplit = StaticMeshGenerator(shape, std::vector<size_t>(is3d ? 3 : 2, 1)).ncell();
+    double const nbox = static_cast<double>(ncell_wanted) / static_cast<double>(nsplit);
+    auto const n = std::max(size_t(1), static_cast<size_t>(std::llround(is3d ? std::cbrt(nbox) : std::sqrt(nbox))));
+    return StaticMeshGenerator(shape, std::vector<size_t>(is3d ? 3 : 2, n));
+}
+
+StaticMeshGenerator::Shape shape_of(uint8_t type)
+{
+    switch (type)
+    {
+    case CellType::TRIANGLE: return StaticMeshGenerator::Shape::Triangle; break;
+    case CellType::QUADRILATERAL: return StaticMeshGenerator::Shape::Quadrilateral; break;
+    case CellType::TETRAHEDRON: return StaticMeshGenerator::Shape::Tetrahedron; break;
+    default: return StaticMeshGenerator::Shape::Hexahedron; break;
+    }
+}
+
+enum class Phase
+{
+    Faces,
+    Interior,
+    Edge,
+    Boundary,
+    Ghost,
+};
+
+/// Generate the mesh and run the phases before the one to time.
+std::shared_ptr<StaticMesh> prepare(benchmark::State const & state, Phase phase)
+{
+    auto const type = static_cast<uint8_t>(state.range(0));
+    auto const ncell = static_cast<size_t>(std::llround(std::pow(10.0, static_cast<double>(state.range(1)))));
+    std::shared_ptr<StaticMesh> mesh = make_generator(shape_of(type), ncell).generate();
+    if (phase >= Phase::Interior)
+    {
+        mesh->build_interior(/* do_metric */ true, /* do_edge */ phase != Phase::Edge);
+    }
+    if (phase >= Phase::Ghost)
+    {
+        mesh->build_boundary();
+    }
+    return mesh;
+}
+
+void run_phase(StaticMesh & mesh, Phase phase)
+{
+    switch (phase)
+    {
+    case Phase::Faces:
+        mesh.build_interior(/* do_metric */ false, /* do_edge */ false);
+        break;
+    case Phase::Interior:
+        mesh.build_interior(/* do_metric */ true, /* do_edge */ false);
+        break;
+    case Phase::Edge:
+        mesh.build_edge();
+        break;
+    case Phase::Boundary:
+        mesh.build_boundary();
+        break;
+    case Phase::Ghost:
+        mesh.build_ghost();
+        break;
+    }
+}
+
+void StaticMesh_scaling(benchmark::State & state, Phase phase)
+{
+    AllocationTracker & tracker = AllocationTracker::me();
+    tracker.enable();
+    // Boundary and ghost can be built only once on a mesh, so these phases
+    // take a new mesh for each iteration.
+    bool const fresh = phase >= Phase::Boundary;
+    std::shared_ptr<StaticMesh> mesh = prepare(state, phase);
+    size_t peak = 0;
+    for (auto _ : state)
+    {
+        if (fresh && !mesh)
+        {
+            state.PauseTiming();
+            mesh = prepare(state, phase);
+            state.ResumeTiming();
+        }
+        tracker.reset();
+        run_phase(*mesh, phase);
+        peak = std::max(peak, tracker.total().peak_bytes);
+        benchmark::ClobberMemory();
+        if (fresh)
+        {
+            state.PauseTiming();
+            mesh.reset();
+            state.ResumeTiming();
+        }
+    }
+    tracker.disable();
+    std::shared_ptr<StaticMesh> const shape = mesh ? mesh : prepare(state, Phase::Faces);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * shape->ncell()));
+    state.counters["ncell"] = static_cast<double>(shape->ncell());
+    state.counters["peak_bytes"] = benchmark::Counter(static_cast<double>(peak), benchmark::Counter::kDefaults, benchmark::Counter::OneK::kIs1024);
+}
+
+void register_scaling_phase(char const * name, Phase phase)
+{
+    benchmark::internal::Benchmark * bench = benchmark::RegisterBenchmark(name, StaticMesh_scaling, phase);
+    bench->ArgNames({"type", "exp10"})->Unit(benchmark::kMillisecond);
+    for (uint8_t type : {CellType::TRIANGLE, CellType::QUADRILATERAL, CellType::TETRAHEDRON, CellType::HEXAHEDRON})
+    {
+        for (int64_t exponent = 3; exponent <= MODMESH_BENCH_MESH_MAX_EXPONENT; ++exponent)
+        {
+            bench->Args({type, exponent});
+        }
+    }
+}
+
+/// Generation of the meshes of the shapes of StaticMeshGenerator.
+void StaticMesh_scaling_generate(benchmark::State & state)
+{
+    auto const shape = static_cast<StaticMeshGenerator::Shape>(state.range(0));
+    auto const ncell = static_cast<size_t>(std::llround(std::pow(10.0, static_cast<double>(state.range(1)))));
+    StaticMeshGenerator const generator = make_generator(shape, ncell);
+    for (auto _ : state)
+    {
+        std::shared_ptr<StaticMesh> mesh = generator.generate();
+        benchmark::DoNotOptimize(mesh->clnds().data());
+        state.PauseTiming();
+        mesh.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * generator.ncell()));
+    state.counters["ncell"] = static_cast<double>(generator.ncell());
+}
+
+int const registered = []()
+{
+    benchmark::internal::Benchmark * generate = benchmark::RegisterBenchmark("StaticMesh_scaling_generate", StaticMesh_scaling_generate);
+    generate->ArgNames({"shape", "exp10"})->Unit(benchmark::kMillisecond);
+    for (int64_t shape = 0; shape <= static_cast<int64_t>(StaticMeshGenerator::Shape::Mixed3D); ++shape)
+    {
+        for (int64_t exponent = 3; exponent <= MODMESH_BENCH_MESH_MAX_EXPONENT; ++exponent)
+        {
+            generate->Args({shape, exponent});
+        }
+    }
+    register_scaling_phase("StaticMesh_scaling_faces", Phase::Faces);
+    register_scaling_phase("StaticMesh_scaling_interior", Phase::Interior);
+    register_scaling_phase("StaticMesh_scaling_edge", Phase::Edge);
+    register_scaling_phase("StaticMesh_scaling_boundary", Phase::Boundary);
+    register_scaling_phase("StaticMesh_scaling_ghost", Phase::Ghost);
+    return 0;
+}();
+
+} /* end namespace */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
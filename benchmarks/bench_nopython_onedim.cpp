@@ -0,0 +1,112 @@
+#include <modmesh/onedim/onedim.hpp>
+
+#include <benchmark/benchmark.h>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+/*
+ * The grids have n + 1 points, as Euler1DCore takes an odd number of them.
+ */
+#define MM_BENCH_ONEDIM_SIZES Arg(1 << 10)->Arg(1 << 14)->Arg(1 << 18)
+
+namespace
+{
+
+using namespace modmesh;
+using namespace modmesh::onedim;
+
+/// Set Sod's shock tube over the points in [-1, 1].
+template <typename T>
+void set_shock_tube(BasicEuler1DCore<T> & core)
+{
+    core.gamma().fill(static_cast<T>(1.4));
+    core.set_coord(T(-1.0), T(1.0));
+    SimpleArray<T> const boundaries(small_vector<size_t>{1}, T(0.0));
+    SimpleArray<T> density(2);
+    density(0) = T(1.0);
+    density(1) = T(0.125);
+    SimpleArray<T> const velocity(small_vector<size_t>{2}, T(0.0));
+    SimpleArray<T> pressure(2);
+    pressure(0) = T(1.0);
+    pressure(1) = T(0.1);
+    core.set_piecewise_primitive(boundaries, density, velocity, pressure);
+}
+
+/// Sod's shock tube over n points in [-1, 1].  n must be odd.
+template <typename T>
+std::shared_ptr<BasicEuler1DCore<T>> make_shock_tube(size_t n)
+{
+    double const dx = 2.0 / static_cast<double>(n - 1);
+    std::shared_ptr<BasicEuler1DCore<T>> core = BasicEuler1DCore<T>::construct(n, static_cast<T>(0.2 * dx));
+    set_shock_tube(*core);
+    core->setup_march();
+    return core;
+}
+
+/// The same march in float64 and float32; the difference is the throughput
+/// gained by the wider vectors and the smaller working set.
+template <typename T>
+void march_euler1d(benchmark::State & state)
+{
+    auto const n = static_cast<size_t>(state.range(0));
+    std::shared_ptr<BasicEuler1DCore<T>> core = make_shock_tube<T>(n + 1);
+    for (auto _ : state)
+    {
+        core->template march_alpha<2>(1);
+        benchmark::DoNotOptimize(core->so0().data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+
+void Euler1DCore_march_fp64(benchmark::State & state) { march_euler1d<double>(state); }
+BENCHMARK(Euler1DCore_march_fp64)->MM_BENCH_ONEDIM_SIZES->Unit(benchmark::kMicrosecond);
+
+void Euler1DCore_march_fp32(benchmark::State & state) { march_euler1d<float>(state); }
+BENCHMARK(Euler1DCore_march_fp32)->MM_BENCH_ONEDIM_SIZES->Unit(benchmark::kMicrosecond);
+
+/// The setup of Sod's shock tube, the coordinates and the piecewise-constant
+/// state, written in parallel straight into the arrays of the solver.
+void Euler1DCore_setup(benchmark::State & state)
+{
+    auto const n = static_cast<size_t>(state.range(0));
+    std::shared_ptr<Euler1DCore> core = Euler1DCore::construct(n + 1, 0.0);
+    for (auto _ : state)
+    {
+        set_shock_tube(*core);
+        benchmark::DoNotOptimize(core->so0().data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(Euler1DCore_setup)->MM_BENCH_ONEDIM_SIZES->Unit(benchmark::kMicrosecond);
+
+/// The exact solution of Sod's shock tube on the same points, all the
+/// quantities at a time the expansion wave covers a part of the points.
+void ShockTube_build_field(benchmark::State & state)
+{
+    auto const n = static_cast<size_t>(state.range(0));
+    std::shared_ptr<ShockTubeCore> st = ShockTubeCore::construct(1.4, 1.0, 1.0, 0.1, 0.125);
+    SimpleArray<double> coord(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        coord(i) = -1.0 + 2.0 * static_cast<double>(i) / static_cast<double>(n);
+    }
+    SimpleArray<double> density(n);
+    SimpleArray<double> velocity(n);
+    SimpleArray<double> pressure(n);
+    SimpleArray<double> temperature(n);
+    SimpleArray<double> internal_energy(n);
+    SimpleArray<double> entropy(n);
+    for (auto _ : state)
+    {
+        st->build_field(0.4, coord, &density, &velocity, &pressure, &temperature, &internal_energy, &entropy);
+        benchmark::DoNotOptimize(density.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(ShockTube_build_field)->MM_BENCH_ONEDIM_SIZES->Unit(benchmark::kMicrosecond);
+
+} /* end namespace */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
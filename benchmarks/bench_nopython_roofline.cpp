@@ -0,0 +1,265 @@
+#include <modmesh/mesh/mesh.hpp>
+#include <modmesh/onedim/onedim.hpp>
+#include <modmesh/spacetime/spacetime.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+/*
+ * The roofline suite: a bandwidth probe and a peak-FLOP probe for the
+ * ceilings, and the kernels on the problems that do not fit in the
+ * last-level cache.  Each kernel reports the bytes and the floating-point
+ * operations of an iteration as bytes_per_second and flops_per_second, and
+ * their ratio as intensity; "modmesh_bench.py roofline" places them under the
+ * ceilings.
+ *
+ * The operations are counted from the source, a division or a square root as
+ * one.  The bytes are those of the arrays a kernel streams, each read or
+ * written once, in whole cache lines for the strided accesses.  The gathers
+ * through the connectivity are not counted, so the intensity of calc_metric()
+ * is an upper bound.  The probes and the kernels run on ThreadPool as they
+ * do by default, and are timed in real time.
+ */
+
+namespace
+{
+
+using namespace modmesh;
+
+/// Report the bytes and the operations of an iteration.
+void set_roofline(benchmark::State & state, double bytes, double flops)
+{
+    state.SetBytesProcessed(static_cast<int64_t>(static_cast<double>(state.iterations()) * bytes));
+    state.counters["flops_per_second"] = benchmark::Counter(flops, benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["intensity"] = benchmark::Counter(flops / bytes);
+}
+
+/// STREAM triad, a = b + s * c, over 3 arrays of 128 MB.  Unlike STREAM, the
+/// write-allocate of a is counted, for the bytes that move through memory.
+void Roofline_probe_stream(benchmark::State & state)
+{
+    constexpr size_t n = size_t(1) << 24;
+    SimpleArray<double> a(small_vector<size_t>{n}, 0.0);
+    SimpleArray<double> const b(small_vector<size_t>{n}, 1.0);
+    SimpleArray<double> const c(small_vector<size_t>{n}, 2.0);
+    double * const pa = a.data();
+    double const * const pb = b.data();
+    double const * const pc = c.data();
+    double const scalar = 3.0;
+    for (auto _ : state)
+    {
+        parallel_for_chunks(
+            n,
+            /* parallel */ true,
+            ThreadPool::Schedule::STATIC,
+            [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    pa[i] = pb[i] + scalar * pc[i];
+                }
+            });
+        benchmark::DoNotOptimize(pa);
+        benchmark::ClobberMemory();
+    }
+    set_roofline(state, static_cast<double>(4 * n * sizeof(double)), static_cast<double>(2 * n));
+}
+BENCHMARK(Roofline_probe_stream)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/// Independent multiply-add chains in registers on every thread, as many as
+/// the compiler needs to fill the vectors and hide the latency.  It is the
+/// peak of the code the build flags produce, not that of the data sheet.
+void Roofline_probe_flops(benchmark::State & state)
+{
+    constexpr size_t nchain = 32;
+    constexpr size_t nrepeat = size_t(1) << 16;
+    ThreadPool & pool = ThreadPool::instance();
+    size_t const ntask = pool.nthread();
+    std::vector<double> sink(ntask, 0.0);
+    auto const body = [&](size_t itask)
+    {
+        alignas(64) double acc[nchain]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+        for (size_t k = 0; k < nchain; ++k)
+        {
+            acc[k] = static_cast<double>(k + itask);
+        }
+        for (size_t it = 0; it < nrepeat; ++it)
+        {
+            for (size_t k = 0; k < nchain; ++k)
+            {
+                acc[k] = acc[k] * 0.999999 + 1.e-6;
+            }
+        }
+        double sum = 0.0;
+        for (size_t k = 0; k < nchain; ++k)
+        {
+            sum += acc[k];
+        }
+        sink[itask] = sum;
+    };
+    for (auto _ : state)
+    {
+        if (ntask > 1)
+        {
+            pool.run(ntask, body, ThreadPool::Schedule::STATIC);
+        }
+        else
+        {
+            body(0);
+        }
+        benchmark::DoNotOptimize(sink.data());
+    }
+    double const flops = static_cast<double>(2 * nchain * nrepeat * ntask);
+    state.counters["flops_per_second"] = benchmark::Counter(flops, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(Roofline_probe_flops)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/// The gradients of a half step of Sod's shock tube over 2^21 points.
+void Roofline_Euler1DCore_march_half_so1_alpha2(benchmark::State & state)
+{
+    using onedim::Euler1DCore;
+    constexpr size_t n = (size_t(1) << 21) + 1;
+    double const dx = 2.0 / static_cast<double>(n - 1);
+    std::shared_ptr<Euler1DCore> core = Euler1DCore::construct(n, 0.2 * dx);
+    for (size_t i = 0; i < n; ++i)
+    {
+        double const x = -1.0 + dx * static_cast<double>(i);
+        bool const left = x < 0.0;
+        core->coord()(i) = x;
+        core->gamma()(i) = 1.4;
+        core->so0()(i, 0) = left ? 1.0 : 0.125;
+        core->so0()(i, 1) = 0.0;
+        core->so0()(i, 2) = (left ? 1.0 : 0.1) / 0.4;
+        for (size_t iv = 0; iv < Euler1DCore::NVAR; ++iv)
+        {
+            core->so1()(i, iv) = 0.0;
+        }
+    }
+    core->setup_march();
+    for (auto _ : state)
+    {
+        core->march_half_so1_alpha<2>(/* odd_plane */ false);
+        benchmark::DoNotOptimize(core->so1().data());
+    }
+    // A CE spans 2 points.  It derives the variables of an SE (65 operations)
+    // and limits the 3 gradients (38).  The coordinates, gamma, so0, and so1
+    // read and written are streamed.
+    size_t const nce = (n - 2 * Euler1DCore::BOUND_COUNT) / 2;
+    set_roofline(state, static_cast<double>(n * (1 + 1 + 3 + 3 + 3) * sizeof(double)), static_cast<double>(nce * (65 + 38)));
+}
+BENCHMARK(Roofline_Euler1DCore_march_half_so1_alpha2)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/// The solution of a half step of the linear scalar wave over 2^22 CEs.
+void Roofline_SolverBase_march_half_so0(benchmark::State & state)
+{
+    using namespace modmesh::spacetime; // NOLINT(google-build-using-namespace)
+    constexpr size_t n = size_t(1) << 22;
+    std::shared_ptr<Grid> grid = Grid::construct(0.0, 2 * M_PI, n);
+    double const dx = 2 * M_PI / static_cast<double>(n);
+    std::shared_ptr<LinearScalarSolver> svr = LinearScalarSolver::construct(grid, 0.4 * dx);
+    size_t const nselm = grid->nselm();
+    for (size_t it = 0; it < nselm; ++it)
+    {
+        LinearScalarSelm se = svr->selm(static_cast<int_type>(it), false);
+        se.so0(0) = std::sin(se.x());
+        se.so1(0) = std::cos(se.x());
+    }
+    svr->setup_march();
+    for (auto _ : state)
+    {
+        svr->march_half_so0(/* odd_plane */ false);
+        benchmark::ClobberMemory();
+    }
+    // A CE spans 2 points and takes the 2 fluxes of each of its SEs (39
+    // operations).  The coordinates, so0 read and written, and so1 are
+    // streamed.
+    size_t const nce = grid->ncelm();
+    set_roofline(state, static_cast<double>(nce * 2 * (1 + 1 + 1 + 1) * sizeof(double)), static_cast<double>(nce * 39));
+}
+BENCHMARK(Roofline_SolverBase_march_half_so0)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/// The metric of a 64^3 hexahedral mesh.
+void Roofline_StaticMesh_calc_metric(benchmark::State & state)
+{
+    std::shared_ptr<StaticMesh> mesh = StaticMeshGenerator(StaticMeshGenerator::Shape::Hexahedron, {64, 64, 64}).generate();
+    mesh->build_interior(/* do_metric */ true, /* do_edge */ false);
+    for (auto _ : state)
+    {
+        mesh->calc_metric();
+        benchmark::DoNotOptimize(mesh->clvol().data());
+    }
+    // The operations of the 3D passes: the centroid (40 per node + 6) and
+    // the normal (15 per node + 7) of a face, and the centroid (3 per node
+    // + 22 per face + 6) and the volume (11 per face + 1) of a cell.
+    size_t flops = 0;
+    for (size_t ifc = 0; ifc < mesh->nface(); ++ifc)
+    {
+        auto const nnd = static_cast<size_t>(mesh->fcnds(ifc, 0));
+        flops += 40 * nnd + 6 + 15 * nnd + 7;
+    }
+    for (size_t icl = 0; icl < mesh->ncell(); ++icl)
+    {
+        auto const nnd = static_cast<size_t>(mesh->clnds(icl, 0));
+        auto const nfc = static_cast<size_t>(mesh->clfcs(icl, 0));
+        flops += 3 * nnd + 22 * nfc + 6 + 11 * nfc + 1;
+    }
+    // The rows of the interior, without the ghost.
+    auto const rows = [](auto const & arr, size_t nrow)
+    { return arr.nbytes() / arr.shape(0) * nrow; };
+    size_t const bytes = rows(mesh->ndcrd(), mesh->nnode()) +
+                         rows(mesh->fcnds(), mesh->nface()) + rows(mesh->fccnd(), mesh->nface()) +
+                         rows(mesh->fcnml(), mesh->nface()) + rows(mesh->fcara(), mesh->nface()) +
+                         rows(mesh->cltpn(), mesh->ncell()) + rows(mesh->clnds(), mesh->ncell()) +
+                         rows(mesh->clfcs(), mesh->ncell()) + rows(mesh->clcnd(), mesh->ncell()) +
+                         rows(mesh->clvol(), mesh->ncell());
+    set_roofline(state, static_cast<double>(bytes), static_cast<double>(flops));
+}
+BENCHMARK(Roofline_StaticMesh_calc_metric)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/// The reductions over 2^24 elements; an operation per element.
+template <typename F>
+void reduce_roofline(benchmark::State & state, F && reduce)
+{
+    constexpr size_t n = size_t(1) << 24;
+    SimpleArray<double> arr(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        arr(i) = static_cast<double>(i % 1024);
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(reduce(arr));
+    }
+    set_roofline(state, static_cast<double>(n * sizeof(double)), static_cast<double>(n));
+}
+
+void Roofline_SimpleArray_sum(benchmark::State & state)
+{
+    reduce_roofline(state, [](SimpleArray<double> const & arr)
+                    { return arr.sum(); });
+}
+BENCHMARK(Roofline_SimpleArray_sum)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+void Roofline_SimpleArray_min(benchmark::State & state)
+{
+    reduce_roofline(state, [](SimpleArray<double> const & arr)
+                    { return arr.min(); });
+}
+BENCHMARK(Roofline_SimpleArray_min)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+void Roofline_SimpleArray_max(benchmark::State & state)
+{
+    reduce_roofline(state, [](SimpleArray<double> const & arr)
+                    { return arr.max(); });
+}
+BENCHMARK(Roofline_SimpleArray_max)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+} /* end namespace */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,191 @@
+#include <modmesh/spacetime/spacetime.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+/*
+ * The grids have n CEs and 2n+1 + 2 * BOUND_COUNT points.
+ */
+#define MM_BENCH_SPACETIME_SIZES Arg(1 << 10)->Arg(1 << 14)->Arg(1 << 18)
+
+namespace
+{
+
+using namespace modmesh;
+using namespace modmesh::spacetime;
+
+/// Smooth periodic flow of the Euler equations over n CEs.
+std::shared_ptr<BadEuler1DSolver> make_bad_euler(size_t n, Field::Layout layout)
+{
+    std::shared_ptr<Grid> grid = Grid::construct(0.0, 2 * M_PI, n);
+    double const dx = 2 * M_PI / static_cast<double>(n);
+    std::shared_ptr<BadEuler1DSolver> svr = BadEuler1DSolver::construct(grid, 0.2 * dx, layout);
+    size_t const nselm = grid->nselm();
+    for (size_t it = 0; it < nselm; ++it)
+    {
+        Selm se = svr->selm(static_cast<int_type>(it), false);
+        double const rho = 1.0 + 0.1 * std::sin(se.x());
+        se.so0(0) = rho;
+        se.so0(1) = 0.2 * rho;
+        se.so0(2) = 2.5 + 0.1 * std::cos(se.x());
+        for (size_t iv = 0; iv < BadEuler1DSolver::NVAR; ++iv)
+        {
+            se.so1(iv) = 0.0;
+        }
+    }
+    svr->setup_march();
+    return svr;
+}
+
+void march_bad_euler(benchmark::State & state, Field::Layout layout)
+{
+    auto const n = static_cast<size_t>(state.range(0));
+    std::shared_ptr<BadEuler1DSolver> svr = make_bad_euler(n, layout);
+    for (auto _ : state)
+    {
+        svr->march_alpha<2>(1);
+        benchmark::DoNotOptimize(svr->field().so0().data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+
+void BadEuler1DSolver_march_aos(benchmark::State & state) { march_bad_euler(state, Field::Layout::AoS); }
+BENCHMARK(BadEuler1DSolver_march_aos)->MM_BENCH_SPACETIME_SIZES->Unit(benchmark::kMicrosecond);
+
+void BadEuler1DSolver_march_soa(benchmark::State & state) { march_bad_euler(state, Field::Layout::SoA); }
+BENCHMARK(BadEuler1DSolver_march_soa)->MM_BENCH_SPACETIME_SIZES->Unit(benchmark::kMicrosecond);
+
+/// The same flow as make_bad_euler() with Euler1DSolver.
+void march_euler(benchmark::State & state, Field::Layout layout)
+{
+    auto const n = static_cast<size_t>(state.range(0));
+    std::shared_ptr<Grid> grid = Grid::construct(0.0, 2 * M_PI, n);
+    double const dx = 2 * M_PI / static_cast<double>(n);
+    std::shared_ptr<Euler1DSolver> svr = Euler1DSolver::construct(grid, 0.2 * dx, layout);
+    size_t const nselm = grid->nselm();
+    for (size_t it = 0; it < nselm; ++it)
+    {
+        Selm se = svr->selm(static_cast<int_type>(it), false);
+        double const rho = 1.0 + 0.1 * std::sin(se.x());
+        se.so0(0) = rho;
+        se.so0(1) = 0.2 * rho;
+        se.so0(2) = 2.5 + 0.1 * std::cos(se.x());
+        for (size_t iv = 0; iv < Euler1DSolver::NVAR; ++iv)
+        {
+            se.so1(iv) = 0.0;
+        }
+    }
+    svr->setup_march();
+    for (auto _ : state)
+    {
+        svr->march_alpha<2>(1);
+        benchmark::DoNotOptimize(svr->field().so0().data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+
+void Euler1DSolver_march_aos(benchmark::State & state) { march_euler(state, Field::Layout::AoS); }
+BENCHMARK(Euler1DSolver_march_aos)->MM_BENCH_SPACETIME_SIZES->Unit(benchmark::kMicrosecond);
+
+void Euler1DSolver_march_soa(benchmark::State & state) { march_euler(state, Field::Layout::SoA); }
+BENCHMARK(Euler1DSolver_march_soa)->MM_BENCH_SPACETIME_SIZES->Unit(benchmark::kMicrosecond);
+
+/// Linear scalar wave over n CEs, marched 8 steps per iteration.
+void march_linear_scalar(benchmark::State & state, size_t block_steps)
+{
+    auto const n = static_cast<size_t>(state.range(0));
+    std::shared_ptr<Grid> grid = Grid::construct(0.0, 2 * M_PI, n);
+    double const dx = 2 * M_PI / static_cast<double>(n);
+    std::shared_ptr<LinearScalarSolver> svr = LinearScalarSolver::construct(grid, 0.4 * dx);
+    size_t const nselm = grid->nselm();
+    for (size_t it = 0; it < nselm; ++it)
+    {
+        LinearScalarSelm se = svr->selm(static_cast<int_type>(it), false);
+        se.so0(0) = std::sin(se.x());
+        se.so1(0) = std::cos(se.x());
+    }
+    svr->setup_march();
+    svr->set_parallel(false);
+    svr->set_block_steps(block_steps);
+    for (auto _ : state)
+    {
+        svr->march_alpha<2>(8);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n * 8));
+}
+
+// The largest grid does not fit in the last-level cache.
+#define MM_BENCH_SPACETIME_BLOCK_SIZES Arg(1 << 14)->Arg(1 << 18)->Arg(1 << 22)
+
+void LinearScalarSolver_march(benchmark::State & state) { march_linear_scalar(state, 0); }
+BENCHMARK(LinearScalarSolver_march)->MM_BENCH_SPACETIME_BLOCK_SIZES->Unit(benchmark::kMicrosecond);
+
+void LinearScalarSolver_march_blocked(benchmark::State & state) { march_linear_scalar(state, 8); }
+BENCHMARK(LinearScalarSolver_march_blocked)->MM_BENCH_SPACETIME_BLOCK_SIZES->Unit(benchmark::kMicrosecond);
+
+/**
+ * Linear scalar wave over n coarse CEs, the middle eighth of which is refined
+ * by 4, marched over the time of 2 coarse steps per iteration.  The uniform
+ * march takes 8 steps of the fine time increment, and the multi-rate march 2
+ * steps with the refined CEs at level 2.
+ */
+void march_linear_scalar_refined(benchmark::State & state, bool multirate)
+{
+    auto const n = static_cast<size_t>(state.range(0));
+    std::vector<double> xloc;
+    std::vector<uint8_t> levels;
+    double const dx = 2 * M_PI / static_cast<double>(n);
+    for (size_t it = 0; it < n; ++it)
+    {
+        bool const refined = it >= n * 7 / 16 && it < n * 9 / 16;
+        size_t const nsub = refined ? 4 : 1;
+        for (size_t isub = 0; isub < nsub; ++isub)
+        {
+            xloc.push_back(dx * (static_cast<double>(it) + static_cast<double>(isub) / static_cast<double>(nsub)));
+            levels.push_back(refined ? 2 : 0);
+        }
+    }
+    xloc.push_back(2 * M_PI);
+    SimpleArray<double> xarr(xloc.size());
+    std::copy(xloc.begin(), xloc.end(), xarr.data());
+    std::shared_ptr<Grid> grid = Grid::construct(xarr);
+    std::shared_ptr<LinearScalarSolver> svr = LinearScalarSolver::construct(grid, 0.4 * dx / (multirate ? 1 : 4));
+    size_t const nselm = grid->nselm();
+    for (size_t it = 0; it < nselm; ++it)
+    {
+        LinearScalarSelm se = svr->selm(static_cast<int_type>(it), false);
+        se.so0(0) = std::sin(se.x());
+        se.so1(0) = std::cos(se.x());
+    }
+    svr->setup_march();
+    svr->set_parallel(false);
+    if (multirate)
+    {
+        SimpleArray<uint8_t> larr(levels.size());
+        std::copy(levels.begin(), levels.end(), larr.data());
+        svr->set_time_levels(larr);
+    }
+    for (auto _ : state)
+    {
+        svr->march_alpha<2>(multirate ? 2 : 8);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * grid->ncelm() * 8));
+}
+
+void LinearScalarSolver_march_refined(benchmark::State & state) { march_linear_scalar_refined(state, false); }
+BENCHMARK(LinearScalarSolver_march_refined)->MM_BENCH_SPACETIME_BLOCK_SIZES->Unit(benchmark::kMicrosecond);
+
+void LinearScalarSolver_march_multirate(benchmark::State & state) { march_linear_scalar_refined(state, true); }
+BENCHMARK(LinearScalarSolver_march_multirate)->MM_BENCH_SPACETIME_BLOCK_SIZES->Unit(benchmark::kMicrosecond);
+
+} /* end namespace */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,57 @@
+#define CALLPROFILER 1
+#include <modmesh/toggle/RadixTree.hpp>
+
+#include <benchmark/benchmark.h>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+namespace
+{
+
+using namespace modmesh;
+
+/// Enter and leave two nested callers of a tree that already has the nodes,
+/// i.e., the bookkeeping of a probe pair without reading the clock.
+void RadixTree_entry_exit(benchmark::State & state)
+{
+    RadixTree<CallerProfile> tree;
+    for (auto _ : state)
+    {
+        tree.entry(0, "outer").call_count++;
+        tree.entry(1, "inner").call_count++;
+        tree.move_current_to_parent();
+        tree.move_current_to_parent();
+    }
+    benchmark::DoNotOptimize(tree.nnode());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 2);
+}
+BENCHMARK(RadixTree_entry_exit)->Unit(benchmark::kNanosecond);
+
+void probe_leaf()
+{
+    USE_CALLPROFILER_PROFILE_THIS_FUNCTION();
+}
+
+void probe_branch()
+{
+    USE_CALLPROFILER_PROFILE_THIS_FUNCTION();
+    probe_leaf();
+}
+
+/// Two nested probes of CallProfiler, including the clock.
+void CallProfiler_probe_pair(benchmark::State & state)
+{
+    CallProfiler::instance().reset();
+    for (auto _ : state)
+    {
+        probe_branch();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 2);
+}
+BENCHMARK(CallProfiler_probe_pair)->Unit(benchmark::kNanosecond);
+
+} /* end namespace */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,395 @@
+# Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+# BSD-style license; see COPYING
+
+"""
+Run the modmesh benchmark suites and compare the results across builds.
+
+The sizes of the benchmarks are fixed in benchmarks/bench_nopython_*.cpp, so
+two outputs of the same suites time the same work:
+
+    python3 benchmarks/modmesh_bench.py run --binary path/to/bench_nopython \\
+        --suites default --out new.json
+    python3 benchmarks/modmesh_bench.py compare old.json new.json \\
+        --threshold 0.05
+
+"compare" exits with 1 when a benchmark slows down beyond the threshold.
+
+The roofline suite measures the ceilings of the machine and the bytes and
+operations of the kernels, and "roofline" ranks the kernels by the headroom
+under the ceilings:
+
+    python3 benchmarks/modmesh_bench.py run --binary path/to/bench_nopython \\
+        --suites roofline --out roofline.json
+    python3 benchmarks/modmesh_bench.py roofline roofline.json
+"""
+
+import argparse
+import datetime
+import json
+import os
+import platform
+import statistics
+import subprocess
+import sys
+
+# The benchmark name filters (regular expressions) of the suites.
+SUITES = {
+    'buffer': r'^(SimpleArray|SimpleArrayPlex|strided_copy|small_vector)_',
+    'grid': r'^StaticGrid',
+    'mesh': r'^StaticMesh_(build|face_loop|spmv)_',
+    'mesh_scaling': r'^StaticMesh_scaling_',
+    'gmsh': r'^Gmsh_(parse|to_block)/',
+    'gmsh_ingest': r'^Gmsh_ingest_',
+    'onedim': r'^(Euler1DCore|ShockTube)_',
+    'spacetime': r'^(BadEuler1DSolver|Euler1DSolver|LinearScalarSolver)_',
+    'toggle': r'^(RadixTree|CallProfiler)_',
+    'roofline': r'^Roofline_',
+}
+# The scaling benchmarks take minutes and are left to be asked for, and so
+# are the roofline ones taking gigabytes.
+DEFAULT_SUITES = ['buffer', 'grid', 'mesh', 'gmsh', 'gmsh_ingest', 'onedim',
+                  'spacetime', 'toggle']
+# The Python import timing of bench_import.py.
+IMPORT_SUITE = 'import'
+
+_TIME_UNIT = {'ns': 1.0, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+# The counters of bench_nopython_roofline.cpp.
+_ROOFLINE_COUNTERS = ('bytes_per_second', 'flops_per_second', 'intensity')
+# The names of the probes of the ceilings.
+_PROBE_BANDWIDTH = 'Roofline_probe_stream'
+_PROBE_FLOPS = 'Roofline_probe_flops'
+
+
+def _read_cpu_model():
+    try:
+        with open('/proc/cpuinfo') as fobj:
+            for line in fobj:
+                if line.startswith('model name'):
+                    return line.split(':', 1)[1].strip()
+    except OSError:
+        pass
+    if sys.platform == 'darwin':
+        out = subprocess.run(
+            ['sysctl', '-n', 'machdep.cpu.brand_string'],
+            capture_output=True, text=True)
+        if out.returncode == 0:
+            return out.stdout.strip()
+    return platform.processor()
+
+
+def _read_memory():
+    try:
+        return os.sysconf('SC_PAGE_SIZE') * os.sysconf('SC_PHYS_PAGES')
+    except (ValueError, OSError, AttributeError):
+        return None
+
+
+def _read_git_commit():
+    out = subprocess.run(
+        ['git', 'rev-parse', 'HEAD'], capture_output=True, text=True,
+        cwd=os.path.dirname(os.path.abspath(__file__)))
+    return out.stdout.strip() if out.returncode == 0 else None
+
+
+def collect_metadata():
+    return {
+        'date': datetime.datetime.now().astimezone().isoformat(),
+        'host': platform.node(),
+        'platform': platform.platform(),
+        'machine': platform.machine(),
+        'cpu_model': _read_cpu_model(),
+        'cpu_count': os.cpu_count(),
+        'memory_bytes': _read_memory(),
+        'python': platform.python_version(),
+        'git_commit': _read_git_commit(),
+        'num_threads': os.environ.get('MODMESH_NUM_THREADS'),
+        'pin_threads': os.environ.get('MODMESH_PIN_THREADS'),
+    }
+
+
+def parse_suites(text):
+    names = []
+    for name in text.split(','):
+        name = name.strip()
+        if not name:
+            continue
+        if name == 'default':
+            names.extend(DEFAULT_SUITES)
+        elif name == 'all':
+            names.extend(SUITES)
+            names.append(IMPORT_SUITE)
+        elif name in SUITES or name == IMPORT_SUITE:
+            names.append(name)
+        else:
+            raise ValueError(f"unknown suite: {name}")
+    # Keep the order and drop the duplicates.
+    return list(dict.fromkeys(names))
+
+
+def _summarize(runs):
+    """Reduce the repetitions of the Google Benchmark JSON to the results."""
+    grouped = {}
+    for run in runs:
+        if run.get('run_type') == 'aggregate' or run.get('error_occurred'):
+            continue
+        name = run.get('run_name', run['name'])
+        scale = _TIME_UNIT[run.get('time_unit', 'ns')]
+        entry = grouped.setdefault(name, {'real': [], 'cpu': []})
+        entry['real'].append(run['real_time'] * scale)
+        entry['cpu'].append(run['cpu_time'] * scale)
+        for key in _ROOFLINE_COUNTERS:
+            if key in run:
+                entry.setdefault(key, []).append(run[key])
+    results = {}
+    for name, entry in grouped.items():
+        real = entry['real']
+        results[name] = {
+            'real_ns': statistics.median(real),
+            'cpu_ns': statistics.median(entry['cpu']),
+            'stddev_ns': statistics.stdev(real) if len(real) > 1 else 0.0,
+            'repetitions': len(real),
+        }
+        for key in _ROOFLINE_COUNTERS:
+            if key in entry:
+                results[name][key] = statistics.median(entry[key])
+    return results
+
+
+def run_binary(binary, suite, repetitions, warmup):
+    cmd = [
+        binary,
+        f'--benchmark_filter={SUITES[suite]}',
+        f'--benchmark_repetitions={repetitions}',
+        f'--benchmark_min_warmup_time={warmup}',
+        '--benchmark_format=json',
+    ]
+    out = subprocess.run(cmd, capture_output=True, text=True, check=True)
+    data = json.loads(out.stdout)
+    return data.get('context', {}), _summarize(data['benchmarks'])
+
+
+def run_import(repetitions, warmup):
+    sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+    import bench_import
+    # The first import fills the file system cache.
+    if warmup > 0:
+        bench_import.measure("import modmesh", 1)
+    results = {}
+    for name, code in bench_import._CASES:
+        times = [t * 1e9 for t in bench_import.measure(code, repetitions)]
+        results[f'import/{name}'] = {
+            'real_ns': statistics.median(times),
+            'cpu_ns': None,
+            'stddev_ns': statistics.stdev(times) if len(times) > 1 else 0.0,
+            'repetitions': len(times),
+        }
+    return results
+
+
+def cmd_run(args):
+    suites = parse_suites(args.suites)
+    if any(s != IMPORT_SUITE for s in suites) and not args.binary:
+        raise SystemExit("--binary is required for the compiled suites")
+    output = {
+        'schema': 1,
+        'metadata': collect_metadata(),
+        'settings': {
+            'suites': suites,
+            'repetitions': args.repetitions,
+            'warmup': args.warmup,
+        },
+        'results': {},
+    }
+    for suite in suites:
+        print(f"running suite {suite} ...", file=sys.stderr)
+        if suite == IMPORT_SUITE:
+            results = run_import(args.repetitions, args.warmup)
+        else:
+            context, results = run_binary(
+                args.binary, suite, args.repetitions, args.warmup)
+            output['metadata'].setdefault('benchmark_context', context)
+        for name, result in results.items():
+            result['suite'] = suite
+            output['results'][name] = result
+    with open(args.out, 'w') as fobj:
+        json.dump(output, fobj, indent=2, sort_keys=True)
+    print(f"wrote {len(output['results'])} results to {args.out}",
+          file=sys.stderr)
+    return 0
+
+
+def compare(base, head, threshold, noise=2.0):
+    """
+    Return the rows of (name, base_ns, head_ns, ratio, status) of the
+    benchmarks in both results.  A change is flagged only when it exceeds the
+    threshold and the given multiple of the larger standard deviation.
+    """
+    rows = []
+    for name in sorted(set(base) & set(head)):
+        bns = base[name]['real_ns']
+        hns = head[name]['real_ns']
+        ratio = hns / bns if bns > 0 else float('inf')
+        spread = noise * max(base[name].get('stddev_ns') or 0.0,
+                             head[name].get('stddev_ns') or 0.0)
+        status = ''
+        if abs(hns - bns) > spread:
+            if ratio > 1.0 + threshold:
+                status = 'REGRESSION'
+            elif ratio < 1.0 - threshold:
+                status = 'improved'
+        rows.append((name, bns, hns, ratio, status))
+    return rows
+
+
+def cmd_compare(args):
+    with open(args.base) as fobj:
+        base = json.load(fobj)
+    with open(args.head) as fobj:
+        head = json.load(fobj)
+    for key in ('cpu_model', 'cpu_count', 'num_threads'):
+        bval = base['metadata'].get(key)
+        hval = head['metadata'].get(key)
+        if bval != hval:
+            print(f"warning: {key} differs: {bval} vs {hval}",
+                  file=sys.stderr)
+    rows = compare(base['results'], head['results'], args.threshold,
+                   args.noise)
+    nregress = 0
+    print(f"{'benchmark':<48} {'base (ms)':>11} {'head (ms)':>11}"
+          f" {'ratio':>7}")
+    for name, bns, hns, ratio, status in rows:
+        if args.only_changed and not status:
+            continue
+        print(f"{name:<48} {bns / 1e6:>11.4f} {hns / 1e6:>11.4f}"
+              f" {ratio:>7.3f} {status}")
+        if status == 'REGRESSION':
+            nregress += 1
+    missing = sorted(set(base['results']) - set(head['results']))
+    for name in missing:
+        print(f"{name:<48} missing in {args.head}")
+    print(f"{nregress} regression(s) beyond {args.threshold * 100:.1f}%"
+          f" in {len(rows)} benchmark(s)")
+    return 1 if nregress else 0
+
+
+def _find_probe(results, prefix, key):
+    for name in sorted(results):
+        if name.split('/')[0] == prefix and results[name].get(key):
+            return results[name][key]
+    return None
+
+
+def roofline(results, bandwidth=None, peak=None):
+    """
+    Place the kernels under the ceilings of the bandwidth (bytes/s) and the
+    peak (FLOP/s), taken from the probes when not given.  Return the
+    ceilings and the rows of the kernels sorted by the headroom, the ratio
+    of the attainable performance to the achieved one.
+    """
+    if bandwidth is None:
+        bandwidth = _find_probe(results, _PROBE_BANDWIDTH, 'bytes_per_second')
+    if peak is None:
+        peak = _find_probe(results, _PROBE_FLOPS, 'flops_per_second')
+    if not bandwidth or not peak:
+        raise ValueError("the ceilings are not measured; run the roofline "
+                         "suite or give --bandwidth and --peak")
+    rows = []
+    for name, result in results.items():
+        if name.split('/')[0] in (_PROBE_BANDWIDTH, _PROBE_FLOPS):
+            continue
+        flops = result.get('flops_per_second')
+        intensity = result.get('intensity')
+        if not flops or not intensity:
+            continue
+        attainable = min(peak, intensity * bandwidth)
+        rows.append({
+            'name': name,
+            'intensity': intensity,
+            'flops_per_second': flops,
+            'bytes_per_second': result.get('bytes_per_second'),
+            'attainable': attainable,
+            'bound': 'memory' if intensity * bandwidth < peak else 'compute',
+            'efficiency': flops / attainable,
+            'headroom': attainable / flops,
+        })
+    rows.sort(key=lambda row: row['headroom'], reverse=True)
+    ceilings = {
+        'bandwidth': bandwidth,
+        'peak': peak,
+        'ridge_intensity': peak / bandwidth,
+    }
+    return ceilings, rows
+
+
+def cmd_roofline(args):
+    with open(args.result) as fobj:
+        data = json.load(fobj)
+    bandwidth = args.bandwidth * 1e9 if args.bandwidth else None
+    peak = args.peak * 1e9 if args.peak else None
+    ceilings, rows = roofline(data['results'], bandwidth, peak)
+    print(f"bandwidth {ceilings['bandwidth'] / 1e9:.2f} GB/s, peak"
+          f" {ceilings['peak'] / 1e9:.2f} GFLOP/s, ridge at"
+          f" {ceilings['ridge_intensity']:.3f} FLOP/byte")
+    width = max([len('kernel')] + [len(row['name']) for row in rows])
+    print(f"{'kernel':<{width}} {'FLOP/byte':>9} {'GFLOP/s':>9} {'GB/s':>8}"
+          f" {'bound':>7} {'eff':>6} {'headroom':>8}")
+    for row in rows:
+        gbps = (row['bytes_per_second'] or 0.0) / 1e9
+        print(f"{row['name']:<{width}} {row['intensity']:>9.3f}"
+              f" {row['flops_per_second'] / 1e9:>9.3f} {gbps:>8.2f}"
+              f" {row['bound']:>7} {row['efficiency'] * 100:>5.1f}%"
+              f" {row['headroom']:>7.2f}x")
+    if args.out:
+        with open(args.out, 'w') as fobj:
+            json.dump({'ceilings': ceilings, 'kernels': rows}, fobj,
+                      indent=2, sort_keys=True)
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest='command', required=True)
+
+    prun = sub.add_parser('run', help="run the suites")
+    prun.add_argument('--binary', help="path of bench_nopython")
+    prun.add_argument(
+        '--suites', default='default',
+        help="comma-separated of %s, 'default', or 'all'"
+             % ', '.join(list(SUITES) + [IMPORT_SUITE]))
+    prun.add_argument('--repetitions', type=int, default=5)
+    prun.add_argument('--warmup', type=float, default=0.1,
+                      help="warm-up seconds before each benchmark")
+    prun.add_argument('--out', default='modmesh_bench.json')
+    prun.set_defaults(func=cmd_run)
+
+    pcmp = sub.add_parser('compare', help="compare two outputs of run")
+    pcmp.add_argument('base')
+    pcmp.add_argument('head')
+    pcmp.add_argument('--threshold', type=float, default=0.05,
+                      help="relative slow-down to flag (default 0.05)")
+    pcmp.add_argument('--noise', type=float, default=2.0,
+                      help="multiple of the standard deviation a change "
+                           "must exceed (default 2)")
+    pcmp.add_argument('--only-changed', action='store_true')
+    pcmp.set_defaults(func=cmd_compare)
+
+    proof = sub.add_parser(
+        'roofline', help="rank the kernels of the roofline suite by headroom")
+    proof.add_argument('result', help="output of run with the roofline suite")
+    proof.add_argument('--bandwidth', type=float,
+                       help="memory bandwidth in GB/s instead of the probe")
+    proof.add_argument('--peak', type=float,
+                       help="peak in GFLOP/s instead of the probe")
+    proof.add_argument('--out', help="write the coordinates as JSON")
+    proof.set_defaults(func=cmd_roofline)
+
+    args = parser.parse_args()
+    return args.func(args)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Use the buffer subsystem from C++ without Python: allocate from a pool,
+ * reduce with the SIMD kernels, slice a view, and evaluate an expression.
+ * Exit with 1 if a result is not the expected one, so that the example
+ * doubles as the test of the standalone library.
+ */
+
+#include <modmesh/buffer/buffer.hpp>
+
+#include <cstdint>
+#include <iostream>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+namespace
+{
+
+int nfailure = 0;
+
+template <typename T>
+void check(char const * name, T const & value, T const & expected)
+{
+    std::cout << name << ": " << value << std::endl;
+    if (value != expected)
+    {
+        std::cerr << name << ": expected " << expected << std::endl;
+        ++nfailure;
+    }
+}
+
+} /* end namespace */
+
+int main(int, char **)
+{
+    using namespace modmesh;
+
+    std::shared_ptr<PoolMemoryResource> pool = PoolMemoryResource::construct();
+    MemoryResourceScope const scope(pool);
+
+    size_t constexpr n = 1024;
+    SimpleArrayFloat64 a(small_vector<size_t>{n}, SimpleArrayAlignment{64});
+    SimpleArrayFloat64 b(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        a[i] = static_cast<double>(i);
+        b[i] = 2.0;
+    }
+
+    SimpleArrayFloat64 const c = evaluate(a * b + 1.0);
+    SimpleArrayFloat64 const even = a.view().slice(0, SimpleArraySlice{std::nullopt, std::nullopt, 2}).copy();
+
+    // The sums of the integers are exact in double.
+    check("alignment", a.alignment(), size_t(64));
+    check("aligned data", reinterpret_cast<std::uintptr_t>(a.data()) % 64, std::uintptr_t(0));
+    check("sum(a)", a.sum(), 523776.0);
+    check("sum(a * b + 1)", c.sum(), 1048576.0);
+    check("sum(a[::2])", even.sum(), 261632.0);
+    check("size(a[::2])", even.size(), n / 2);
+    // a, b, c, and the copy of the slice.
+    check("pool allocations", pool->stats().allocate_count, size_t(4));
+    return nfailure == 0 ? 0 : 1;
+}
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
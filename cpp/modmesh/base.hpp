@@ -46,6 +46,15 @@ typedef SSIZE_T ssize_t;
 
 #define MODMESH_EXCEPT(CLS, EXC, MSG) throw EXC(#CLS ": " MSG);
 
+/// Qualifier for pointers that do not alias other pointers in the same scope.
+#if defined(_MSC_VER)
+#define MODMESH_RESTRICT __restrict
+#elif defined(__GNUC__) || defined(__clang__)
+#define MODMESH_RESTRICT __restrict__
+#else
+#define MODMESH_RESTRICT
+#endif
+
 #ifndef MODMESH_INTSIZE
 #define MODMESH_INTSIZE 4
 #endif // MODMESH_INTSIZE
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/AllocationTracker.hpp>
+
+#include <algorithm>
+#include <sstream>
+
+namespace modmesh
+{
+
+AllocationTracker & AllocationTracker::me()
+{
+    static AllocationTracker instance;
+    return instance;
+}
+
+std::vector<char const *> & AllocationTracker::scope_stack()
+{
+    thread_local std::vector<char const *> stack;
+    return stack;
+}
+
+char const * AllocationTracker::current_scope()
+{
+    std::vector<char const *> const & stack = scope_stack();
+    return stack.empty() ? nullptr : stack.back();
+}
+
+AllocationTracker::Ticket AllocationTracker::acquire_impl(size_t nbytes)
+{
+    char const * name = current_scope();
+    std::string const scope(nullptr == name ? UNSCOPED : name);
+
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    auto it = m_index.find(scope);
+    if (it == m_index.end())
+    {
+        it = m_index.emplace(scope, m_records.size()).first;
+        m_records.emplace_back();
+        m_records.back().scope = scope;
+    }
+    for (AllocationRecord * record : {&m_records[it->second], &m_total})
+    {
+        ++record->allocate_count;
+        record->allocated_bytes += nbytes;
+        record->live_bytes += nbytes;
+        record->peak_bytes = std::max(record->peak_bytes, record->live_bytes);
+    }
+    return Ticket{it->second, nbytes};
+}
+
+void AllocationTracker::release_impl(Ticket const & ticket)
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    for (AllocationRecord * record : {&m_records[ticket.scope], &m_total})
+    {
+        ++record->deallocate_count;
+        record->live_bytes -= ticket.nbytes;
+    }
+}
+
+std::vector<AllocationRecord> AllocationTracker::records() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_records;
+}
+
+AllocationRecord AllocationTracker::total() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_total;
+}
+
+void AllocationTracker::reset()
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    // The scopes keep their indices because live tickets refer to them.
+    for (AllocationRecord * record = m_records.data(); record != m_records.data() + m_records.size(); ++record)
+    {
+        AllocationRecord cleared;
+        cleared.scope = std::move(record->scope);
+        cleared.live_bytes = record->live_bytes;
+        cleared.peak_bytes = record->live_bytes;
+        *record = std::move(cleared);
+    }
+    AllocationRecord total;
+    total.live_bytes = m_total.live_bytes;
+    total.peak_bytes = m_total.live_bytes;
+    m_total = total;
+}
+
+std::string AllocationTracker::report() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    std::ostringstream ostm;
+    for (AllocationRecord const & record : m_records)
+    {
+        ostm
+            << record.scope << " : "
+            << "count = " << record.allocate_count << " , "
+            << "live = " << record.live_bytes << " , "
+            << "peak = " << record.peak_bytes << " , "
+            << "allocated = " << record.allocated_bytes << " (byte)"
+            << std::endl;
+    }
+    return ostm.str();
+}
+
+} /* end namespace modmesh */
@@ -0,0 +1,160 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * Opt-in accounting of the memory held by ConcreteBuffer, tagged by scope.
+ */
+
+#include <modmesh/base.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace modmesh
+{
+
+/// Counters of the buffer allocations made in one scope.
+struct AllocationRecord
+{
+    std::string scope;
+    size_t allocate_count = 0;
+    size_t deallocate_count = 0;
+    size_t allocated_bytes = 0;
+    size_t live_bytes = 0;
+    size_t peak_bytes = 0;
+}; /* end struct AllocationRecord */
+
+/**
+ * Record the allocations of ConcreteBuffer data.  Each allocation is charged
+ * to the innermost AllocationScope of the allocating thread (a sampled
+ * MODMESH_TIME opens one), and the deallocation is charged back to the same scope no
+ * matter where it happens.  The tracker is disabled by default and costs an
+ * atomic load per allocation then.
+ */
+class AllocationTracker
+{
+
+public:
+
+    static constexpr size_t NO_SCOPE = static_cast<size_t>(-1);
+
+    /// Label of the allocations made outside any scope.
+    static constexpr char const * UNSCOPED = "(unscoped)";
+
+    /// What an allocation was charged to, kept with the buffer until it is freed.
+    struct Ticket
+    {
+        size_t scope = NO_SCOPE;
+        size_t nbytes = 0;
+    }; /* end struct Ticket */
+
+    /// The singleton.
+    static AllocationTracker & me();
+
+    AllocationTracker(AllocationTracker const &) = delete;
+    AllocationTracker(AllocationTracker &&) = delete;
+    AllocationTracker & operator=(AllocationTracker const &) = delete;
+    AllocationTracker & operator=(AllocationTracker &&) = delete;
+    ~AllocationTracker() = default;
+
+    bool enabled() const noexcept { return m_enabled.load(std::memory_order_relaxed); }
+    void enable() noexcept { m_enabled.store(true, std::memory_order_relaxed); }
+    void disable() noexcept { m_enabled.store(false, std::memory_order_relaxed); }
+
+    Ticket acquire(size_t nbytes)
+    {
+        return enabled() ? acquire_impl(nbytes) : Ticket{};
+    }
+
+    void release(Ticket const & ticket)
+    {
+        if (NO_SCOPE != ticket.scope)
+        {
+            release_impl(ticket);
+        }
+    }
+
+    /// Counters of every scope, in the order the scopes are first seen.
+    std::vector<AllocationRecord> records() const;
+    /// Counters summed over all the scopes.  Peak is that of the sum.
+    AllocationRecord total() const;
+    /// Clear the counters but keep the live bytes of the allocations still held.
+    void reset();
+    std::string report() const;
+
+    /// The innermost scope of the calling thread; nullptr if none.
+    static char const * current_scope();
+
+private:
+
+    friend class AllocationScope;
+
+    AllocationTracker() = default;
+
+    Ticket acquire_impl(size_t nbytes);
+    void release_impl(Ticket const & ticket);
+
+    static std::vector<char const *> & scope_stack();
+
+    std::atomic<bool> m_enabled{false};
+
+    mutable std::mutex m_mutex;
+    std::vector<AllocationRecord> m_records;
+    std::unordered_map<std::string, size_t> m_index;
+    AllocationRecord m_total;
+
+}; /* end class AllocationTracker */
+
+/**
+ * Charge the buffer allocations of the calling thread to the named scope for
+ * the lifetime of the object.  The name must outlive the object.
+ */
+class AllocationScope
+{
+
+public:
+
+    explicit AllocationScope(char const * name) { AllocationTracker::scope_stack().push_back(name); }
+
+    AllocationScope() = delete;
+    AllocationScope(AllocationScope const &) = delete;
+    AllocationScope(AllocationScope &&) = delete;
+    AllocationScope & operator=(AllocationScope const &) = delete;
+    AllocationScope & operator=(AllocationScope &&) = delete;
+
+    ~AllocationScope() { AllocationTracker::scope_stack().pop_back(); }
+
+}; /* end class AllocationScope */
+
+} /* end namespace modmesh */
@@ -0,0 +1,517 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/Checkpoint.hpp>
+#include <modmesh/buffer/MappedBuffer.hpp>
+#include <modmesh/buffer/QuantizedBuffer.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+/**
+ * Layout of a checkpoint file:
+ *
+ * 1. CheckpointHeader.
+ * 2. CheckpointArrayEntry of each array, narray of them.
+ * 3. CheckpointScalarEntry of each scalar, nscalar of them.
+ * 4. The data of each array, starting at a multiple of CHECKPOINT_ALIGNMENT.
+ *    The data of an array of CHECKPOINT_ENCODING_QUANTIZED are those of
+ *    QuantizedBuffer::serialize().
+ *
+ * All the numbers are stored in the byte order of the writer, which is
+ * recorded by byte_order.
+ */
+struct CheckpointHeader
+{
+    char magic[8]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t real_size;
+    uint32_t narray;
+    uint32_t nscalar;
+    uint32_t reserved;
+    char kind[32]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+}; /* end struct CheckpointHeader */
+
+struct CheckpointArrayEntry
+{
+    char name[32]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    uint32_t ndim;
+    uint32_t encoding;
+    uint64_t nghost;
+    uint64_t shape[4]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    uint64_t offset;
+    uint64_t nbytes;
+}; /* end struct CheckpointArrayEntry */
+
+struct CheckpointScalarEntry
+{
+    char name[32]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    double value;
+}; /* end struct CheckpointScalarEntry */
+
+static_assert(64 == sizeof(CheckpointHeader), "CheckpointHeader must not be padded");
+static_assert(96 == sizeof(CheckpointArrayEntry), "CheckpointArrayEntry must not be padded");
+static_assert(40 == sizeof(CheckpointScalarEntry), "CheckpointScalarEntry must not be padded");
+
+constexpr char CHECKPOINT_MAGIC[8] = {'M', 'M', 'C', 'K', 'P', 'T', '\0', '\0'}; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+constexpr uint32_t CHECKPOINT_BYTE_ORDER = 0x01020304;
+constexpr uint64_t CHECKPOINT_ALIGNMENT = 64;
+constexpr uint32_t CHECKPOINT_ENCODING_RAW = 0;
+constexpr uint32_t CHECKPOINT_ENCODING_QUANTIZED = 1;
+// Room for the terminating null of the names.
+constexpr size_t CHECKPOINT_NAME_MAX = 31;
+
+inline uint64_t checkpoint_align(uint64_t offset)
+{
+    return (offset + CHECKPOINT_ALIGNMENT - 1) / CHECKPOINT_ALIGNMENT * CHECKPOINT_ALIGNMENT;
+}
+
+void check_checkpoint_name(char const * what, std::string const & name)
+{
+    if (name.empty() || name.size() > CHECKPOINT_NAME_MAX)
+    {
+        throw std::invalid_argument(Formatter() << "Checkpoint: " << what << " name \"" << name
+                                                << "\" must have 1 to " << CHECKPOINT_NAME_MAX << " characters");
+    }
+}
+
+} /* end namespace detail */
+
+void Checkpoint::add_array(std::string const & name, array_type const & array)
+{
+    add_array(name, array, 0.0);
+}
+
+void Checkpoint::add_array(std::string const & name, array_type const & array, double tolerance)
+{
+    detail::check_checkpoint_name("array", name);
+    if (array.ndim() > 4)
+    {
+        throw std::invalid_argument(Formatter() << "Checkpoint: cannot save " << array.ndim() << "-dimensional array " << name);
+    }
+    if (!(tolerance >= 0.0) || !std::isfinite(tolerance))
+    {
+        throw std::invalid_argument(Formatter() << "Checkpoint: tolerance " << tolerance << " of array " << name << " must not be negative");
+    }
+    for (size_t it = 0; it < m_arrays.size(); ++it)
+    {
+        if (m_arrays[it].first == name)
+        {
+            m_arrays[it].second = array;
+            m_tolerances[it] = tolerance;
+            return;
+        }
+    }
+    m_arrays.emplace_back(name, array);
+    m_tolerances.push_back(tolerance);
+}
+
+void Checkpoint::add_scalar(std::string const & name, real_type value)
+{
+    detail::check_checkpoint_name("scalar", name);
+    for (auto & [key, old] : m_scalars)
+    {
+        if (key == name)
+        {
+            old = value;
+            return;
+        }
+    }
+    m_scalars.emplace_back(name, value);
+}
+
+std::vector<std::string> Checkpoint::array_names() const
+{
+    std::vector<std::string> ret;
+    ret.reserve(m_arrays.size());
+    for (auto const & item : m_arrays)
+    {
+        ret.push_back(item.first);
+    }
+    return ret;
+}
+
+std::vector<std::string> Checkpoint::scalar_names() const
+{
+    std::vector<std::string> ret;
+    ret.reserve(m_scalars.size());
+    for (auto const & item : m_scalars)
+    {
+        ret.push_back(item.first);
+    }
+    return ret;
+}
+
+Checkpoint::array_type const & Checkpoint::array(std::string const & name) const
+{
+    for (auto const & [key, value] : m_arrays)
+    {
+        if (key == name)
+        {
+            return value;
+        }
+    }
+    throw std::out_of_range(Formatter() << "Checkpoint: no array " << name);
+}
+
+Checkpoint::array_type & Checkpoint::array(std::string const & name)
+{
+    return const_cast<array_type &>(static_cast<Checkpoint const &>(*this).array(name));
+}
+
+double Checkpoint::tolerance(std::string const & name) const
+{
+    for (size_t it = 0; it < m_arrays.size(); ++it)
+    {
+        if (m_arrays[it].first == name)
+        {
+            return m_tolerances[it];
+        }
+    }
+    throw std::out_of_range(Formatter() << "Checkpoint: no array " << name);
+}
+
+Checkpoint::real_type Checkpoint::scalar(std::string const & name) const
+{
+    for (auto const & [key, value] : m_scalars)
+    {
+        if (key == name)
+        {
+            return value;
+        }
+    }
+    throw std::out_of_range(Formatter() << "Checkpoint: no scalar " << name);
+}
+
+void Checkpoint::check_kind(std::string const & kind) const
+{
+    if (kind != m_kind)
+    {
+        throw std::runtime_error(Formatter() << "Checkpoint: cannot restart " << kind << " from a checkpoint of " << m_kind);
+    }
+}
+
+void Checkpoint::save(std::string const & path) const
+{
+    detail::CheckpointHeader header{};
+    std::memcpy(header.magic, detail::CHECKPOINT_MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.byte_order = detail::CHECKPOINT_BYTE_ORDER;
+    header.real_size = sizeof(real_type);
+    header.narray = static_cast<uint32_t>(m_arrays.size());
+    header.nscalar = static_cast<uint32_t>(m_scalars.size());
+    std::strncpy(header.kind, m_kind.c_str(), sizeof(header.kind) - 1);
+
+    uint64_t const nmeta = sizeof(header) + m_arrays.size() * sizeof(detail::CheckpointArrayEntry) + m_scalars.size() * sizeof(detail::CheckpointScalarEntry);
+    std::vector<detail::CheckpointArrayEntry> arrays(m_arrays.size());
+    // The serialized QuantizedBuffer of each lossy array.
+    std::vector<std::vector<int8_t>> quantized(m_arrays.size());
+    uint64_t offset = detail::checkpoint_align(nmeta);
+    for (size_t it = 0; it < m_arrays.size(); ++it)
+    {
+        array_type const & array = m_arrays[it].second;
+        detail::CheckpointArrayEntry & entry = arrays[it];
+        std::strncpy(entry.name, m_arrays[it].first.c_str(), sizeof(entry.name) - 1);
+        entry.ndim = static_cast<uint32_t>(array.ndim());
+        entry.nghost = array.nghost();
+        for (size_t idim = 0; idim < array.ndim(); ++idim)
+        {
+            entry.shape[idim] = array.shape(idim);
+        }
+        entry.offset = offset;
+        if (0.0 == m_tolerances[it])
+        {
+            entry.encoding = detail::CHECKPOINT_ENCODING_RAW;
+            entry.nbytes = array.size() * sizeof(real_type);
+        }
+        else
+        {
+            std::shared_ptr<QuantizedBuffer> const buffer = QuantizedBuffer::compress(array, m_tolerances[it]);
+            quantized[it].resize(buffer->serialized_nbytes());
+            buffer->serialize(quantized[it].data());
+            entry.encoding = detail::CHECKPOINT_ENCODING_QUANTIZED;
+            entry.nbytes = quantized[it].size();
+        }
+        offset = detail::checkpoint_align(offset + entry.nbytes);
+    }
+    std::vector<detail::CheckpointScalarEntry> scalars(m_scalars.size());
+    for (size_t it = 0; it < m_scalars.size(); ++it)
+    {
+        std::strncpy(scalars[it].name, m_scalars[it].first.c_str(), sizeof(scalars[it].name) - 1);
+        scalars[it].value = m_scalars[it].second;
+    }
+
+    // Write a temporary file and rename it over the old checkpoint.
+    std::string const tmp_path = path + ".tmp";
+    {
+        std::ofstream stream(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!stream)
+        {
+            throw std::runtime_error(Formatter() << "Checkpoint: cannot open \"" << tmp_path << "\" for writing");
+        }
+        stream.write(reinterpret_cast<char const *>(&header), sizeof(header));
+        stream.write(reinterpret_cast<char const *>(arrays.data()), static_cast<std::streamsize>(arrays.size() * sizeof(detail::CheckpointArrayEntry)));
+        stream.write(reinterpret_cast<char const *>(scalars.data()), static_cast<std::streamsize>(scalars.size() * sizeof(detail::CheckpointScalarEntry)));
+        std::array<char, detail::CHECKPOINT_ALIGNMENT> const padding{};
+        uint64_t position = nmeta;
+        for (size_t it = 0; it < arrays.size(); ++it)
+        {
+            stream.write(padding.data(), static_cast<std::streamsize>(arrays[it].offset - position));
+            void const * data = quantized[it].empty() ? static_cast<void const *>(m_arrays[it].second.data()) : quantized[it].data();
+            stream.write(reinterpret_cast<char const *>(data), static_cast<std::streamsize>(arrays[it].nbytes));
+            position = arrays[it].offset + arrays[it].nbytes;
+        }
+        stream.write(padding.data(), static_cast<std::streamsize>(detail::checkpoint_align(position) - position));
+        stream.close();
+        if (!stream)
+        {
+            std::remove(tmp_path.c_str());
+            throw std::runtime_error(Formatter() << "Checkpoint: failed to write \"" << tmp_path << "\"");
+        }
+    }
+    if (0 != std::rename(tmp_path.c_str(), path.c_str()))
+    {
+        std::remove(tmp_path.c_str());
+        throw std::runtime_error(Formatter() << "Checkpoint: cannot rename \"" << tmp_path << "\" to \"" << path << "\"");
+    }
+}
+
+Checkpoint Checkpoint::load(std::string const & path, bool mmap)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream)
+    {
+        throw std::runtime_error(Formatter() << "Checkpoint: cannot open \"" << path << "\" for reading");
+    }
+    detail::CheckpointHeader header{};
+    stream.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!stream || 0 != std::memcmp(header.magic, detail::CHECKPOINT_MAGIC, sizeof(header.magic)))
+    {
+        throw std::runtime_error(Formatter() << "Checkpoint: \"" << path << "\" is not a checkpoint file");
+    }
+    if (header.version < 1 || header.version > VERSION)
+    {
+        throw std::runtime_error(Formatter() << "Checkpoint: \"" << path << "\" has version "
+                                             << header.version << " but up to " << VERSION << " is supported");
+    }
+    if (detail::CHECKPOINT_BYTE_ORDER != header.byte_order || sizeof(real_type) != header.real_size)
+    {
+        throw std::runtime_error(Formatter() << "Checkpoint: \"" << path << "\" was written by a platform of different byte order or number sizes");
+    }
+    std::vector<detail::CheckpointArrayEntry> arrays(header.narray);
+    std::vector<detail::CheckpointScalarEntry> scalars(header.nscalar);
+    stream.read(reinterpret_cast<char *>(arrays.data()), static_cast<std::streamsize>(arrays.size() * sizeof(detail::CheckpointArrayEntry)));
+    stream.read(reinterpret_cast<char *>(scalars.data()), static_cast<std::streamsize>(scalars.size() * sizeof(detail::CheckpointScalarEntry)));
+    if (!stream)
+    {
+        throw std::runtime_error(Formatter() << "Checkpoint: \"" << path << "\" is truncated");
+    }
+
+    header.kind[sizeof(header.kind) - 1] = '\0';
+    Checkpoint ret(header.kind);
+    for (detail::CheckpointScalarEntry & entry : scalars)
+    {
+        entry.name[sizeof(entry.name) - 1] = '\0';
+        ret.m_scalars.emplace_back(entry.name, entry.value);
+    }
+    for (detail::CheckpointArrayEntry & entry : arrays)
+    {
+        entry.name[sizeof(entry.name) - 1] = '\0';
+        if (0 == entry.ndim || entry.ndim > 4)
+        {
+            throw std::runtime_error(Formatter() << "Checkpoint: \"" << path << "\" has a bad entry for array " << entry.name);
+        }
+        small_vector<size_t> shape(entry.ndim);
+        size_t nelem = 1;
+        for (size_t it = 0; it < entry.ndim; ++it)
+        {
+            shape[it] = entry.shape[it];
+            nelem *= shape[it];
+        }
+        bool const quantized = detail::CHECKPOINT_ENCODING_QUANTIZED == entry.encoding;
+        if (entry.nghost > shape[0] || (!quantized && detail::CHECKPOINT_ENCODING_RAW != entry.encoding)
+            || (!quantized && nelem * sizeof(real_type) != entry.nbytes))
+        {
+            throw std::runtime_error(Formatter() << "Checkpoint: \"" << path << "\" has a bad entry for array " << entry.name);
+        }
+
+        array_type array;
+        double tolerance = 0.0;
+        if (quantized)
+        {
+            std::vector<int8_t> bytes(entry.nbytes);
+            stream.seekg(static_cast<std::streamoff>(entry.offset));
+            stream.read(reinterpret_cast<char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+            if (!stream)
+            {
+                throw std::runtime_error(Formatter() << "Checkpoint: \"" << path << "\" is truncated in array " << entry.name);
+            }
+            std::shared_ptr<QuantizedBuffer> const buffer = QuantizedBuffer::deserialize(bytes.data(), bytes.size());
+            if (!(buffer->shape() == shape))
+            {
+                throw std::runtime_error(Formatter() << "Checkpoint: \"" << path << "\" has a bad entry for array " << entry.name);
+            }
+            array = buffer->decompress_array<real_type>();
+            tolerance = buffer->tolerance();
+        }
+        else if (0 == entry.nbytes)
+        {
+            array = array_type(shape);
+        }
+        else if (mmap)
+        {
+            array = array_type(shape, map_buffer(path, MapMode::CopyOnWrite, entry.offset, entry.nbytes));
+        }
+        else
+        {
+            array = array_type(shape, SimpleArrayUninitialized{});
+            stream.seekg(static_cast<std::streamoff>(entry.offset));
+            stream.read(reinterpret_cast<char *>(array.data()), static_cast<std::streamsize>(entry.nbytes));
+            if (!stream)
+            {
+                throw std::runtime_error(Formatter() << "Checkpoint: \"" << path << "\" is truncated in array " << entry.name);
+            }
+        }
+        array.set_nghost(entry.nghost);
+        ret.m_arrays.emplace_back(entry.name, std::move(array));
+        ret.m_tolerances.push_back(tolerance);
+    }
+    return ret;
+}
+
+CheckpointWriter::CheckpointWriter()
+    : m_thread([this]()
+               { run(); })
+{
+}
+
+CheckpointWriter::~CheckpointWriter()
+{
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    m_thread.join();
+}
+
+size_t CheckpointWriter::nwritten() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_nwritten;
+}
+
+void CheckpointWriter::write(std::string path, Checkpoint checkpoint)
+{
+    rethrow();
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // Backpressure: keep at most one checkpoint waiting.
+        m_done.wait(lock, [this]()
+                    { return m_queue.empty(); });
+        m_queue.emplace_back(std::move(path), std::move(checkpoint));
+    }
+    m_wake.notify_one();
+}
+
+void CheckpointWriter::flush()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this]()
+                    { return m_queue.empty() && !m_busy; });
+    }
+    rethrow();
+}
+
+void CheckpointWriter::run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_wake.wait(lock, [this]()
+                    { return m_stop || !m_queue.empty(); });
+        if (m_queue.empty())
+        {
+            // Stop only after the queued checkpoints are saved.
+            break;
+        }
+        std::pair<std::string, Checkpoint> item = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_busy = true;
+        lock.unlock();
+        m_done.notify_all();
+        std::exception_ptr error;
+        try
+        {
+            item.second.save(item.first);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        lock.lock();
+        if (error)
+        {
+            m_error = error;
+        }
+        else
+        {
+            ++m_nwritten;
+        }
+        m_busy = false;
+        m_done.notify_all();
+    }
+}
+
+void CheckpointWriter::rethrow()
+{
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        std::swap(error, m_error);
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,178 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * The state of a solver as named arrays and scalars, saved in one binary
+ * file for restart.
+ *
+ * Every array starts at a 64-byte aligned offset in the file, so that a
+ * restart maps it copy-on-write instead of reading it.  A file is written
+ * to a temporary name and renamed into place, so that a crash while writing
+ * leaves the previous checkpoint intact.  An array may be saved with
+ * error-bounded lossy compression for the archival output of a history.
+ */
+
+#include <modmesh/buffer/SimpleArray.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace modmesh
+{
+
+class Checkpoint
+{
+
+public:
+
+    using real_type = double;
+    using array_type = SimpleArray<real_type>;
+
+    /// Version 2 adds the arrays saved by QuantizedBuffer.
+    static constexpr uint32_t VERSION = 2;
+
+    /// The kind names the solver to guard against restarting another one.
+    explicit Checkpoint(std::string kind)
+        : m_kind(std::move(kind))
+    {
+    }
+
+    Checkpoint() = delete;
+    Checkpoint(Checkpoint const &) = default;
+    Checkpoint(Checkpoint &&) = default;
+    Checkpoint & operator=(Checkpoint const &) = default;
+    Checkpoint & operator=(Checkpoint &&) = default;
+    ~Checkpoint() = default;
+
+    std::string const & kind() const { return m_kind; }
+
+    /**
+     * Add a snapshot of the array.  The copy is cheap for an array allocated
+     * by CopyOnWriteMemoryResource.
+     */
+    void add_array(std::string const & name, array_type const & array);
+    /**
+     * Add a snapshot of the array to be saved by QuantizedBuffer, so that
+     * each value loaded back is within the tolerance.  The compression runs
+     * in save(), i.e., in the thread of CheckpointWriter.  Zero tolerance
+     * saves the array as is.
+     */
+    void add_array(std::string const & name, array_type const & array, double tolerance);
+    void add_scalar(std::string const & name, real_type value);
+
+    size_t narray() const { return m_arrays.size(); }
+    size_t nscalar() const { return m_scalars.size(); }
+    std::vector<std::string> array_names() const;
+    std::vector<std::string> scalar_names() const;
+
+    /// Throw std::out_of_range when there is no such array.
+    array_type const & array(std::string const & name) const;
+    array_type & array(std::string const & name);
+    /// Throw std::out_of_range when there is no such scalar.
+    real_type scalar(std::string const & name) const;
+    /// The tolerance of the lossy array, or 0 for the exact one.  Throw std::out_of_range when there is no such array.
+    double tolerance(std::string const & name) const;
+
+    /// Throw std::runtime_error when the kind differs.
+    void check_kind(std::string const & kind) const;
+
+    void save(std::string const & path) const;
+
+    /**
+     * @param[in] path file written by save().
+     * @param[in] mmap map the arrays copy-on-write from the file instead of
+     *                 reading them into memory.
+     */
+    static Checkpoint load(std::string const & path, bool mmap = true);
+
+private:
+
+    std::string m_kind;
+    std::vector<std::pair<std::string, array_type>> m_arrays;
+    // The tolerance of each array; 0 for the exact ones.
+    std::vector<double> m_tolerances;
+    std::vector<std::pair<std::string, real_type>> m_scalars;
+
+}; /* end class Checkpoint */
+
+/**
+ * Save checkpoints in a background thread, so that the time marching does
+ * not wait for the file system.  At most one checkpoint waits for the
+ * thread; write() blocks when another is queued.
+ */
+class CheckpointWriter
+{
+
+public:
+
+    CheckpointWriter();
+
+    CheckpointWriter(CheckpointWriter const &) = delete;
+    CheckpointWriter(CheckpointWriter &&) = delete;
+    CheckpointWriter & operator=(CheckpointWriter const &) = delete;
+    CheckpointWriter & operator=(CheckpointWriter &&) = delete;
+    // Wait for the pending checkpoints without throwing their errors.
+    ~CheckpointWriter();
+
+    /// Number of the checkpoints saved by the thread.
+    size_t nwritten() const;
+
+    /// Queue the checkpoint.  An error of an earlier one is rethrown.
+    void write(std::string path, Checkpoint checkpoint);
+
+    /// Wait for the queued checkpoints and rethrow the error of the thread.
+    void flush();
+
+private:
+
+    void run();
+    void rethrow();
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    std::deque<std::pair<std::string, Checkpoint>> m_queue;
+    size_t m_nwritten = 0;
+    bool m_busy = false;
+    bool m_stop = false;
+    std::exception_ptr m_error;
+    std::thread m_thread;
+
+}; /* end class CheckpointWriter */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
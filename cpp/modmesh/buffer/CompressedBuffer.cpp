@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/CompressedBuffer.hpp>
+
+#include <cstring>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+namespace
+{
+
+template <size_t E>
+void shuffle_fixed(int8_t const * src, size_t nelem, int8_t * dst)
+{
+    for (size_t it = 0; it < nelem; ++it)
+    {
+        for (size_t ib = 0; ib < E; ++ib)
+        {
+            dst[ib * nelem + it] = src[it * E + ib];
+        }
+    }
+}
+
+template <size_t E>
+void unshuffle_fixed(int8_t const * src, size_t nelem, int8_t * dst)
+{
+    for (size_t it = 0; it < nelem; ++it)
+    {
+        for (size_t ib = 0; ib < E; ++ib)
+        {
+            dst[it * E + ib] = src[ib * nelem + it];
+        }
+    }
+}
+
+template <bool Forward>
+void transpose_bytes(int8_t const * src, size_t nbytes, size_t element_size, int8_t * dst)
+{
+    size_t const nelem = nbytes / element_size;
+    switch (element_size)
+    {
+    case 2: Forward ? shuffle_fixed<2>(src, nelem, dst) : unshuffle_fixed<2>(src, nelem, dst); break;
+    case 4: Forward ? shuffle_fixed<4>(src, nelem, dst) : unshuffle_fixed<4>(src, nelem, dst); break;
+    case 8: Forward ? shuffle_fixed<8>(src, nelem, dst) : unshuffle_fixed<8>(src, nelem, dst); break;
+    default:
+        for (size_t it = 0; it < nelem; ++it)
+        {
+            for (size_t ib = 0; ib < element_size; ++ib)
+            {
+                if (Forward)
+                {
+                    dst[ib * nelem + it] = src[it * element_size + ib];
+                }
+                else
+                {
+                    dst[it * element_size + ib] = src[ib * nelem + it];
+                }
+            }
+        }
+        break;
+    }
+    size_t const body = nelem * element_size;
+    std::memcpy(dst + body, src + body, nbytes - body);
+}
+
+// The LZ4 block format: a sequence is a token (4 bits of literal length and
+// 4 bits of match length minus 4), the literals, a 2-byte little-endian
+// offset and the extended match length.  The last 5 bytes are literals and
+// the last match starts at least 12 bytes before the end.
+constexpr size_t LZ4_MIN_MATCH = 4;
+constexpr size_t LZ4_LAST_LITERALS = 5;
+constexpr size_t LZ4_MF_LIMIT = 12;
+constexpr size_t LZ4_MAX_OFFSET = 65535;
+constexpr size_t LZ4_HASH_LOG = 12;
+
+inline uint32_t read32(uint8_t const * p)
+{
+    uint32_t ret;
+    std::memcpy(&ret, p, sizeof(ret));
+    return ret;
+}
+
+inline uint32_t lz4_hash(uint32_t sequence) { return (sequence * 2654435761U) >> (32 - LZ4_HASH_LOG); }
+
+/// Write the extended length and return the advanced output pointer.
+inline uint8_t * write_length(uint8_t * op, size_t length)
+{
+    for (; length >= 255; length -= 255)
+    {
+        *op++ = 255;
+    }
+    *op++ = static_cast<uint8_t>(length);
+    return op;
+}
+
+} /* end namespace */
+
+void shuffle_bytes(int8_t const * src, size_t nbytes, size_t element_size, int8_t * dst)
+{
+    transpose_bytes<true>(src, nbytes, element_size, dst);
+}
+
+void unshuffle_bytes(int8_t const * src, size_t nbytes, size_t element_size, int8_t * dst)
+{
+    transpose_bytes<false>(src, nbytes, element_size, dst);
+}
+
+size_t lz4_compress(int8_t const * src_in, size_t nbytes, int8_t * dst_in, size_t capacity)
+{
+    auto const * src = reinterpret_cast<uint8_t const *>(src_in);
+    auto * const dst = reinterpret_cast<uint8_t *>(dst_in);
+    uint8_t * op = dst;
+    uint8_t * const oend = dst + capacity;
+    size_t anchor = 0;
+
+    // Emit the literals [anchor, ip) and the match; a zero match_length ends the block.
+    auto emit = [&](size_t ip, size_t offset, size_t match_length)
+    {
+        size_t const nliteral = ip - anchor;
+        // Token, extended lengths, literals and offset.
+        if (static_cast<size_t>(oend - op) < 1 + nliteral / 255 + 1 + nliteral + 2 + match_length / 255 + 1)
+        {
+            return false;
+        }
+        uint8_t * token = op++;
+        *token = static_cast<uint8_t>(std::min(nliteral, size_t(15)) << 4);
+        if (nliteral >= 15)
+        {
+            op = write_length(op, nliteral - 15);
+        }
+        std::memcpy(op, src + anchor, nliteral);
+        op += nliteral;
+        if (0 != match_length)
+        {
+            *op++ = static_cast<uint8_t>(offset & 0xff);
+            *op++ = static_cast<uint8_t>(offset >> 8);
+            size_t const code = match_length - LZ4_MIN_MATCH;
+            *token |= static_cast<uint8_t>(std::min(code, size_t(15)));
+            if (code >= 15)
+            {
+                op = write_length(op, code - 15);
+            }
+        }
+        return true;
+    };
+
+    if (nbytes > LZ4_MF_LIMIT)
+    {
+        std::vector<uint32_t> table(size_t(1) << LZ4_HASH_LOG, 0);
+        size_t const match_start_limit = nbytes - LZ4_MF_LIMIT;
+        size_t const match_end_limit = nbytes - LZ4_LAST_LITERALS;
+        size_t ip = 0;
+        while (ip < match_start_limit)
+        {
+            uint32_t const sequence = read32(src + ip);
+            uint32_t & slot = table[lz4_hash(sequence)];
+            size_t const ref = slot;
+            slot = static_cast<uint32_t>(ip);
+            if (ref < ip && ip - ref <= LZ4_MAX_OFFSET && read32(src + ref) == sequence)
+            {
+                size_t length = LZ4_MIN_MATCH;
+                while (ip + length < match_end_limit && src[ref + length] == src[ip + length])
+                {
+                    ++length;
+                }
+                if (!emit(ip, ip - ref, length))
+                {
+                    return 0;
+                }
+                ip += length;
+                anchor = ip;
+            }
+            else
+            {
+                // Skip faster over the data that does not match.
+                ip += 1 + ((ip - anchor) >> 6);
+            }
+        }
+    }
+    if (!emit(nbytes, 0, 0))
+    {
+        return 0;
+    }
+    return static_cast<size_t>(op - dst);
+}
+
+void lz4_decompress(int8_t const * src_in, size_t src_nbytes, int8_t * dst_in, size_t dst_nbytes)
+{
+    auto const * src = reinterpret_cast<uint8_t const *>(src_in);
+    auto * dst = reinterpret_cast<uint8_t *>(dst_in);
+    size_t ip = 0;
+    size_t op = 0;
+    auto read_length = [&](size_t length)
+    {
+        uint8_t byte = 255;
+        while (255 == byte)
+        {
+            if (ip >= src_nbytes)
+            {
+                throw std::runtime_error("CompressedBuffer: corrupt block (truncated length)");
+            }
+            byte = src[ip++];
+            length += byte;
+        }
+        return length;
+    };
+    while (true)
+    {
+        if (ip >= src_nbytes)
+        {
+            throw std::runtime_error("CompressedBuffer: corrupt block (missing token)");
+        }
+        uint8_t const token = src[ip++];
+        size_t nliteral = token >> 4;
+        if (15 == nliteral)
+        {
+            nliteral = read_length(nliteral);
+        }
+        if (nliteral > src_nbytes - ip || nliteral > dst_nbytes - op)
+        {
+            throw std::runtime_error("CompressedBuffer: corrupt block (literals overflow)");
+        }
+        std::memcpy(dst + op, src + ip, nliteral);
+        ip += nliteral;
+        op += nliteral;
+        if (ip == src_nbytes)
+        {
+            break; // The last sequence has no match.
+        }
+        if (src_nbytes - ip < 2)
+        {
+            throw std::runtime_error("CompressedBuffer: corrupt block (truncated offset)");
+        }
+        size_t const offset = src[ip] | (static_cast<size_t>(src[ip + 1]) << 8);
+        ip += 2;
+        size_t length = token & 15;
+        if (15 == length)
+        {
+            length = read_length(length);
+        }
+        length += LZ4_MIN_MATCH;
+        if (0 == offset || offset > op || length > dst_nbytes - op)
+        {
+            throw std::runtime_error("CompressedBuffer: corrupt block (bad match)");
+        }
+        // The match may overlap the output being written.
+        uint8_t const * ref = dst + op - offset;
+        if (offset >= length)
+        {
+            std::memcpy(dst + op, ref, length);
+        }
+        else
+        {
+            for (size_t it = 0; it < length; ++it)
+            {
+                dst[op + it] = ref[it];
+            }
+        }
+        op += length;
+    }
+    if (op != dst_nbytes)
+    {
+        throw std::runtime_error(Formatter() << "CompressedBuffer: corrupt block (" << op << " bytes decompressed, "
+                                             << dst_nbytes << " expected)");
+    }
+}
+
+} /* end namespace detail */
+
+std::shared_ptr<CompressedBuffer> CompressedBuffer::compress(
+    int8_t const * data, size_t nbytes, size_t element_size, size_t block_size, bool parallel)
+{
+    if (0 == element_size)
+    {
+        throw std::invalid_argument("CompressedBuffer: element size must be positive");
+    }
+    if (0 == block_size || 0 != block_size % element_size)
+    {
+        throw std::invalid_argument(Formatter() << "CompressedBuffer: block size " << block_size
+                                                << " must be a positive multiple of the element size " << element_size);
+    }
+
+    std::shared_ptr<CompressedBuffer> ret = std::make_shared<CompressedBuffer>(nbytes, element_size, block_size, ctor_passkey());
+    size_t const nblock = (nbytes + block_size - 1) / block_size;
+    ret->m_blocks.resize(nblock);
+    std::vector<std::vector<int8_t>> packed(nblock);
+    auto body = [&](size_t iblock)
+    {
+        size_t const n = ret->block_nbytes(iblock);
+        int8_t const * src = data + iblock * block_size;
+        std::vector<int8_t> shuffled;
+        if (1 != element_size)
+        {
+            shuffled.resize(n);
+            detail::shuffle_bytes(src, n, element_size, shuffled.data());
+        }
+        std::vector<int8_t> & out = packed[iblock];
+        out.resize(n);
+        // Keep the compressed block only when it is smaller.
+        size_t const ncompressed = detail::lz4_compress(shuffled.empty() ? src : shuffled.data(), n, out.data(), n - 1);
+        Block & block = ret->m_blocks[iblock];
+        block.compressed = 0 != ncompressed;
+        if (block.compressed)
+        {
+            out.resize(ncompressed);
+        }
+        else
+        {
+            std::memcpy(out.data(), src, n);
+        }
+        block.nbytes = out.size();
+    };
+    if (parallel && nblock > 1)
+    {
+        ThreadPool::instance().run(nblock, body);
+    }
+    else
+    {
+        for (size_t iblock = 0; iblock < nblock; ++iblock)
+        {
+            body(iblock);
+        }
+    }
+
+    size_t offset = 0;
+    for (Block & block : ret->m_blocks)
+    {
+        block.offset = offset;
+        offset += block.nbytes;
+    }
+    ret->m_storage = ConcreteBuffer::construct(offset);
+    for (size_t iblock = 0; iblock < nblock; ++iblock)
+    {
+        std::memcpy(ret->m_storage->data() + ret->m_blocks[iblock].offset, packed[iblock].data(), packed[iblock].size());
+    }
+    return ret;
+}
+
+void CompressedBuffer::decompress_block(size_t iblock, int8_t * dst) const
+{
+    if (iblock >= m_blocks.size())
+    {
+        throw std::out_of_range(Formatter() << "CompressedBuffer: block " << iblock << " >= nblock " << m_blocks.size());
+    }
+    Block const & block = m_blocks[iblock];
+    size_t const n = block_nbytes(iblock);
+    int8_t const * src = m_storage->data() + block.offset;
+    if (!block.compressed)
+    {
+        std::memcpy(dst, src, n);
+    }
+    else if (1 == m_element_size)
+    {
+        detail::lz4_decompress(src, block.nbytes, dst, n);
+    }
+    else
+    {
+        std::vector<int8_t> shuffled(n);
+        detail::lz4_decompress(src, block.nbytes, shuffled.data(), n);
+        detail::unshuffle_bytes(shuffled.data(), n, m_element_size, dst);
+    }
+}
+
+void CompressedBuffer::decompress_into(int8_t * dst, bool parallel) const
+{
+    auto body = [&](size_t iblock)
+    { decompress_block(iblock, dst + iblock * m_block_size); };
+    if (parallel && m_blocks.size() > 1)
+    {
+        ThreadPool::instance().run(m_blocks.size(), body);
+    }
+    else
+    {
+        for (size_t iblock = 0; iblock < m_blocks.size(); ++iblock)
+        {
+            body(iblock);
+        }
+    }
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
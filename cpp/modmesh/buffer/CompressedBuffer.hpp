@@ -0,0 +1,206 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Blockwise lossless compression of a buffer for data kept only for later
+ * use, e.g., the history of a field.
+ *
+ * The bytes are split into independent blocks.  Each block is shuffled by
+ * byte significance (all the first bytes of the elements, then all the
+ * second bytes, etc.) so that the slowly varying sign and exponent bytes of
+ * floating-point data are adjacent, and then compressed in the LZ4 block
+ * format.  A block that does not shrink is stored as is.  The blocks are
+ * compressed and decompressed in parallel with the ThreadPool.
+ */
+
+#include <modmesh/buffer/ConcreteBuffer.hpp>
+#include <modmesh/buffer/SimpleArray.hpp>
+#include <modmesh/buffer/ThreadPool.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+/// Transpose the bytes of the elements of size element_size.  The trailing bytes short of an element are copied.
+void shuffle_bytes(int8_t const * src, size_t nbytes, size_t element_size, int8_t * dst);
+/// Undo shuffle_bytes().
+void unshuffle_bytes(int8_t const * src, size_t nbytes, size_t element_size, int8_t * dst);
+
+/// Compress to the LZ4 block format.  Return 0 when the output does not fit in capacity.
+size_t lz4_compress(int8_t const * src, size_t nbytes, int8_t * dst, size_t capacity);
+/// Decompress an LZ4 block of exactly dst_nbytes bytes.  Throw std::runtime_error for corrupt input.
+void lz4_decompress(int8_t const * src, size_t src_nbytes, int8_t * dst, size_t dst_nbytes);
+
+} /* end namespace detail */
+
+class CompressedBuffer
+    : public std::enable_shared_from_this<CompressedBuffer>
+{
+
+private:
+
+    struct ctor_passkey
+    {
+    };
+
+public:
+
+    using shape_type = detail::shape_type;
+
+    /// Uncompressed bytes per block.
+    static constexpr size_t DEFAULT_BLOCK_SIZE = size_t(1) << 18;
+
+    struct Block
+    {
+        size_t offset; // in the compressed storage
+        size_t nbytes; // compressed bytes
+        bool compressed; // false when stored as is
+    }; /* end struct Block */
+
+    /**
+     * Compress nbytes bytes of elements of element_size bytes.  The shape is
+     * that of a 1D array of the elements.
+     */
+    static std::shared_ptr<CompressedBuffer> compress(
+        int8_t const * data, size_t nbytes, size_t element_size, size_t block_size, bool parallel);
+
+    static std::shared_ptr<CompressedBuffer> compress(ConcreteBuffer const & buffer, size_t element_size = 1, size_t block_size = DEFAULT_BLOCK_SIZE)
+    {
+        return compress(buffer.data(), buffer.nbytes(), element_size, block_size, ThreadPool::instance().use_parallel(buffer.nbytes() / element_size));
+    }
+
+    /// Compress the whole buffer of the array and keep its shape and ghost count.
+    template <typename T>
+    static std::shared_ptr<CompressedBuffer> compress(SimpleArray<T> const & array, size_t block_size, bool parallel)
+    {
+        int8_t const * data = array.buffer().data();
+        std::shared_ptr<CompressedBuffer> ret = compress(data, array.nbytes(), sizeof(T), block_size, parallel);
+        ret->m_shape = array.shape();
+        ret->m_nghost = array.nghost();
+        return ret;
+    }
+
+    template <typename T>
+    static std::shared_ptr<CompressedBuffer> compress(SimpleArray<T> const & array)
+    {
+        return compress(array, DEFAULT_BLOCK_SIZE, ThreadPool::instance().use_parallel(array.size()));
+    }
+
+    CompressedBuffer(size_t nbytes, size_t element_size, size_t block_size, ctor_passkey const &)
+        : m_nbytes(nbytes)
+        , m_element_size(element_size)
+        , m_block_size(block_size)
+        , m_shape{nbytes / element_size}
+    {
+    }
+
+    CompressedBuffer() = delete;
+    CompressedBuffer(CompressedBuffer const &) = delete;
+    CompressedBuffer(CompressedBuffer &&) = delete;
+    CompressedBuffer & operator=(CompressedBuffer const &) = delete;
+    CompressedBuffer & operator=(CompressedBuffer &&) = delete;
+    ~CompressedBuffer() = default;
+
+    /// Number of the uncompressed bytes.
+    size_t nbytes() const noexcept { return m_nbytes; }
+    /// Number of the bytes of the compressed storage.
+    size_t compressed_nbytes() const noexcept { return m_storage ? m_storage->nbytes() : 0; }
+    /// Uncompressed bytes over the compressed bytes.
+    double ratio() const
+    {
+        return 0 == compressed_nbytes() ? 1.0 : static_cast<double>(m_nbytes) / static_cast<double>(compressed_nbytes());
+    }
+    size_t element_size() const noexcept { return m_element_size; }
+    size_t block_size() const noexcept { return m_block_size; }
+    size_t nblock() const noexcept { return m_blocks.size(); }
+    Block const & block(size_t iblock) const { return m_blocks.at(iblock); }
+    shape_type const & shape() const noexcept { return m_shape; }
+    size_t nghost() const noexcept { return m_nghost; }
+
+    /// Decompress block iblock into dst, which holds at least block_size() bytes.
+    void decompress_block(size_t iblock, int8_t * dst) const;
+    /// Decompress all the blocks into dst, which holds at least nbytes() bytes.
+    void decompress_into(int8_t * dst, bool parallel) const;
+
+    std::shared_ptr<ConcreteBuffer> decompress(bool parallel) const
+    {
+        std::shared_ptr<ConcreteBuffer> ret = ConcreteBuffer::construct(m_nbytes);
+        decompress_into(ret->data(), parallel);
+        return ret;
+    }
+
+    std::shared_ptr<ConcreteBuffer> decompress() const
+    {
+        return decompress(ThreadPool::instance().use_parallel(m_nbytes / m_element_size));
+    }
+
+    /// Decompress into a new array of the recorded shape and ghost count.
+    template <typename T>
+    SimpleArray<T> decompress_array(bool parallel) const
+    {
+        if (sizeof(T) != m_element_size)
+        {
+            throw std::invalid_argument(Formatter() << "CompressedBuffer: element size " << m_element_size
+                                                    << " differs from the array item size " << sizeof(T));
+        }
+        SimpleArray<T> ret(m_shape, decompress(parallel));
+        ret.set_nghost(m_nghost);
+        return ret;
+    }
+
+    template <typename T>
+    SimpleArray<T> decompress_array() const
+    {
+        return decompress_array<T>(ThreadPool::instance().use_parallel(m_nbytes / m_element_size));
+    }
+
+private:
+
+    size_t block_nbytes(size_t iblock) const { return std::min(m_block_size, m_nbytes - iblock * m_block_size); }
+
+    size_t m_nbytes = 0;
+    size_t m_element_size = 1;
+    size_t m_block_size = DEFAULT_BLOCK_SIZE;
+    shape_type m_shape;
+    size_t m_nghost = 0;
+    std::vector<Block> m_blocks;
+    std::shared_ptr<ConcreteBuffer> m_storage;
+
+}; /* end class CompressedBuffer */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -30,11 +30,17 @@
 
 #include <modmesh/base.hpp>
 #include <modmesh/buffer/small_vector.hpp>
+#include <modmesh/buffer/MemoryResource.hpp>
+#include <modmesh/buffer/AllocationTracker.hpp>
+#include <modmesh/buffer/DeviceBackend.hpp>
 
 #include <stdexcept>
 #include <memory>
+#include <new>
+#include <atomic>
 #include <algorithm>
 #include <sstream>
+#include <typeinfo>
 
 namespace modmesh
 {
@@ -67,6 +73,9 @@ struct ConcreteBufferRemover
         delete[] p;
     }
 
+    /// Return true if the memory must not be written, e.g., a read-only map.
+    virtual bool is_readonly() const { return false; }
+
 }; /* end struct ConcreteBufferRemover */
 
 struct ConcreteBufferNoRemove : public ConcreteBufferRemover
@@ -77,6 +86,60 @@ struct ConcreteBufferNoRemove : public ConcreteBufferRemover
 
 }; /* end struct ConcreteBufferNoRemove */
 
+/**
+ * Release the memory allocated by the aligned operator new[] in
+ * ConcreteBuffer::allocate().  The alignment is kept because the matching
+ * operator delete[] needs it.
+ */
+struct ConcreteBufferAlignedRemover : public ConcreteBufferRemover
+{
+
+    explicit ConcreteBufferAlignedRemover(size_t alignment_in)
+        : alignment(alignment_in)
+    {
+    }
+
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays,readability-non-const-parameter)
+    void operator()(int8_t * p) const override
+    {
+        ::operator delete[](p, std::align_val_t(alignment));
+    }
+
+    size_t alignment;
+
+}; /* end struct ConcreteBufferAlignedRemover */
+
+/**
+ * Return the memory to the MemoryResource it was allocated from.  The remover
+ * holds a reference to the resource to keep it alive.
+ */
+struct ConcreteBufferResourceRemover : public ConcreteBufferRemover
+{
+
+    ConcreteBufferResourceRemover(std::shared_ptr<MemoryResource> resource_in, size_t nbytes_in, size_t alignment_in)
+        : resource(std::move(resource_in))
+        , nbytes(nbytes_in)
+        , alignment(alignment_in)
+    {
+    }
+
+    static bool is_same_type(ConcreteBufferRemover const & other)
+    {
+        return typeid(other) == typeid(ConcreteBufferResourceRemover);
+    }
+
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays,readability-non-const-parameter)
+    void operator()(int8_t * p) const override
+    {
+        resource->deallocate(p, nbytes, alignment);
+    }
+
+    std::shared_ptr<MemoryResource> resource;
+    size_t nbytes;
+    size_t alignment;
+
+}; /* end struct ConcreteBufferResourceRemover */
+
 struct ConcreteBufferDataDeleter
 {
 
@@ -106,9 +169,12 @@ struct ConcreteBufferDataDeleter
         {
             (*remover)(p);
         }
+        AllocationTracker::me().release(ticket);
     }
 
     std::unique_ptr<remover_type> remover{nullptr};
+    // Scope the allocation is charged to when AllocationTracker is enabled.
+    AllocationTracker::Ticket ticket;
 
 }; /* end struct ConcreteBufferDataDeleter */
 
@@ -133,9 +199,37 @@ public:
 
     using remover_type = detail::ConcreteBufferRemover;
 
+    /// Alignment to the cache line of most x86-64 and arm64 processors.
+    static constexpr size_t CACHELINE_ALIGNMENT = 64;
+    /// Alignment to the 2 MiB huge page.
+    static constexpr size_t HUGEPAGE_ALIGNMENT = 2 * 1024 * 1024;
+
+    /**
+     * Allocate the buffer using the global default alignment.  Like all the
+     * allocating factories, the memory is left uninitialized.
+     */
     static std::shared_ptr<ConcreteBuffer> construct(size_t nbytes)
     {
-        return std::make_shared<ConcreteBuffer>(nbytes, ctor_passkey());
+        return std::make_shared<ConcreteBuffer>(nbytes, default_alignment(), ctor_passkey());
+    }
+
+    /**
+     * Allocate the buffer whose data pointer is aligned to the given number of
+     * bytes.  The alignment 0 means no requirement other than that of the
+     * plain operator new[].
+     */
+    static std::shared_ptr<ConcreteBuffer> construct(size_t nbytes, size_t alignment)
+    {
+        return std::make_shared<ConcreteBuffer>(nbytes, alignment, ctor_passkey());
+    }
+
+    /**
+     * Allocate the buffer from the given memory resource instead of the
+     * current one of the thread (MemoryResource::get_current()).
+     */
+    static std::shared_ptr<ConcreteBuffer> construct(size_t nbytes, size_t alignment, std::shared_ptr<MemoryResource> const & resource)
+    {
+        return std::make_shared<ConcreteBuffer>(nbytes, alignment, resource, ctor_passkey());
     }
 
     /*
@@ -156,20 +250,81 @@ public:
 
     static std::shared_ptr<ConcreteBuffer> construct() { return construct(0); }
 
+    /**
+     * Copy the buffer.  When the buffer is allocated from a memory resource
+     * that supports cloning (e.g., CopyOnWriteMemoryResource), the copy is
+     * made by the resource from the same resource; otherwise it is allocated
+     * as construct(nbytes, alignment) does and copied.
+     */
     std::shared_ptr<ConcreteBuffer> clone() const
     {
-        std::shared_ptr<ConcreteBuffer> ret = construct(nbytes());
+        if (has_remover() && detail::ConcreteBufferResourceRemover::is_same_type(get_remover()))
+        {
+            auto const & remover = static_cast<detail::ConcreteBufferResourceRemover const &>(get_remover());
+            int8_t * ptr = remover.resource->clone(data(), nbytes(), alignment());
+            if (nullptr != ptr)
+            {
+                std::shared_ptr<ConcreteBuffer> ret = construct(nbytes(), ptr, std::make_unique<detail::ConcreteBufferResourceRemover>(remover.resource, nbytes(), alignment()));
+                ret->m_alignment = alignment();
+                ret->m_data.get_deleter().ticket = AllocationTracker::me().acquire(nbytes());
+                return ret;
+            }
+        }
+        std::shared_ptr<ConcreteBuffer> ret = construct(nbytes(), alignment());
         std::copy_n(data(), size(), (*ret).data());
         return ret;
     }
 
+    /**
+     * Get the alignment used by construct(nbytes) when no alignment is
+     * specified.  The default is 0 (no requirement).
+     */
+    static size_t default_alignment() noexcept { return default_alignment_storage(); }
+
+    /**
+     * Set the alignment used by construct(nbytes) when no alignment is
+     * specified.  It affects all buffers allocated afterwards, including
+     * those allocated by SimpleArray.
+     */
+    static void set_default_alignment(size_t alignment)
+    {
+        validate_alignment(alignment);
+        default_alignment_storage() = alignment;
+    }
+
+    static void validate_alignment(size_t alignment)
+    {
+        if (0 != (alignment & (alignment - 1)))
+        {
+            throw std::invalid_argument(Formatter() << "ConcreteBuffer: alignment " << alignment << " is not a power of 2");
+        }
+    }
+
     /**
      * \param[in] nbytes
      *      Size of the memory buffer in bytes.
+     * \param[in] alignment
+     *      Alignment of the memory buffer in bytes.  0 for no requirement.
      */
-    ConcreteBuffer(size_t nbytes, const ctor_passkey &)
+    ConcreteBuffer(size_t nbytes, size_t alignment, const ctor_passkey &)
         : m_nbytes(nbytes)
-        , m_data(allocate(nbytes))
+        , m_alignment(alignment)
+        , m_data(allocate(nbytes, alignment))
+    {
+    }
+
+    /**
+     * \param[in] nbytes
+     *      Size of the memory buffer in bytes.
+     * \param[in] alignment
+     *      Alignment of the memory buffer in bytes.  0 for no requirement.
+     * \param[in] resource
+     *      The memory resource to allocate from.  Null for operator new[].
+     */
+    ConcreteBuffer(size_t nbytes, size_t alignment, std::shared_ptr<MemoryResource> const & resource, const ctor_passkey &)
+        : m_nbytes(nbytes)
+        , m_alignment(alignment)
+        , m_data(allocate(nbytes, alignment, resource))
     {
     }
 
@@ -202,7 +357,8 @@ public:
     // NOLINTNEXTLINE(bugprone-copy-constructor-init)
     ConcreteBuffer(ConcreteBuffer const & other)
         : m_nbytes(other.m_nbytes)
-        , m_data(allocate(other.m_nbytes))
+        , m_alignment(other.m_alignment)
+        , m_data(allocate(other.m_nbytes, other.m_alignment))
     {
         if (size() != other.size())
         {
@@ -222,6 +378,7 @@ public:
                 throw std::out_of_range("Buffer size mismatch");
             }
             std::copy_n(other.data(), size(), data());
+            bump_epoch();
         }
         return *this;
     }
@@ -230,6 +387,8 @@ public:
 
     size_t nbytes() const noexcept { return m_nbytes; }
     size_t size() const noexcept { return nbytes(); }
+    /// The alignment requested when allocating the buffer; 0 if none.
+    size_t alignment() const noexcept { return m_alignment; }
 
     using iterator = int8_t *;
     using const_iterator = int8_t const *;
@@ -268,9 +427,65 @@ public:
     // clang-format on
 
     bool has_remover() const noexcept { return bool(m_data.get_deleter().remover); }
+    bool is_readonly() const { return has_remover() && get_remover().is_readonly(); }
     remover_type const & get_remover() const { return *m_data.get_deleter().remover; }
     remover_type & get_remover() { return *m_data.get_deleter().remover; }
 
+    /**
+     * The modification epoch of the buffer.  It is drawn from a process-wide
+     * counter, so two buffers never share an epoch and a consumer notices
+     * both a modified buffer and a replaced one by comparing the epoch it
+     * saw last.  Copy assignment, to_host() and the SimpleArray modifiers
+     * bump it; a write through data() or an element reference does not, and
+     * the writer should call bump_epoch() when done.
+     */
+    uint64_t epoch() const noexcept { return m_epoch.load(std::memory_order_relaxed); }
+    void bump_epoch() noexcept { m_epoch.store(next_epoch(), std::memory_order_relaxed); }
+
+    /**
+     * The device copy of the buffer made by to_device(), or null.  A copy of
+     * the buffer takes the host data only; call to_host() before copying a
+     * buffer modified on the device.
+     */
+    DeviceMirror * mirror() const noexcept { return m_mirror.get(); }
+
+    /**
+     * Copy the buffer to the device of the backend if the host is modified,
+     * and return the device memory.  The first call makes the mirror, with
+     * DeviceBackend::get_default() if the backend is null; a buffer is
+     * mirrored on one backend only.
+     */
+    void * to_device(std::shared_ptr<DeviceBackend> const & backend = nullptr)
+    {
+        if (!m_mirror)
+        {
+            m_mirror = std::make_unique<DeviceMirror>(backend ? backend : DeviceBackend::get_default(), nbytes());
+        }
+        else if (backend && backend != m_mirror->backend())
+        {
+            throw std::invalid_argument(Formatter() << "ConcreteBuffer: already mirrored on " << m_mirror->backend()->name()
+                                                    << ", not " << backend->name());
+        }
+        return m_mirror->sync_device(data());
+    }
+
+    /// Copy the device memory back if the device is modified.  No-op without a mirror.
+    void to_host()
+    {
+        if (m_mirror)
+        {
+            if (is_readonly() && DeviceMirror::State::DEVICE_MODIFIED == m_mirror->state())
+            {
+                throw std::runtime_error("ConcreteBuffer: cannot copy the device memory to a read-only buffer");
+            }
+            if (DeviceMirror::State::DEVICE_MODIFIED == m_mirror->state())
+            {
+                bump_epoch();
+            }
+            m_mirror->sync_host(data());
+        }
+    }
+
     // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
     using unique_ptr_type = std::unique_ptr<int8_t, data_deleter_type>;
 
@@ -282,18 +497,55 @@ public:
         }
     }
 
-    static unique_ptr_type allocate(size_t nbytes)
+    static unique_ptr_type allocate(size_t nbytes, size_t alignment = 0)
     {
+        return allocate(nbytes, alignment, MemoryResource::get_current());
+    }
+
+    static unique_ptr_type allocate(size_t nbytes, size_t alignment, std::shared_ptr<MemoryResource> const & resource)
+    {
+        validate_alignment(alignment);
         unique_ptr_type ret(nullptr, data_deleter_type());
         if (0 != nbytes)
         {
-            ret = unique_ptr_type(new int8_t[nbytes], data_deleter_type());
+            if (resource)
+            {
+                int8_t * ptr = resource->allocate(nbytes, alignment);
+                ret = unique_ptr_type(ptr, data_deleter_type(std::make_unique<detail::ConcreteBufferResourceRemover>(resource, nbytes, alignment)));
+            }
+            else if (0 == alignment)
+            {
+                ret = unique_ptr_type(new int8_t[nbytes], data_deleter_type());
+            }
+            else
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+                auto * ptr = static_cast<int8_t *>(::operator new[](nbytes, std::align_val_t(alignment)));
+                ret = unique_ptr_type(ptr, data_deleter_type(std::make_unique<detail::ConcreteBufferAlignedRemover>(alignment)));
+            }
+            ret.get_deleter().ticket = AllocationTracker::me().acquire(nbytes);
         }
         return ret;
     }
 
+    static std::atomic<size_t> & default_alignment_storage() noexcept
+    {
+        static std::atomic<size_t> value{0};
+        return value;
+    }
+
+    static uint64_t next_epoch() noexcept
+    {
+        static std::atomic<uint64_t> value{0};
+        return value.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
     size_t m_nbytes;
+    size_t m_alignment = 0;
     unique_ptr_type m_data;
+    // Destroyed before the data, after waiting for the copies.
+    std::unique_ptr<DeviceMirror> m_mirror;
+    std::atomic<uint64_t> m_epoch{next_epoch()};
 
 }; /* end class ConcreteBuffer */
 
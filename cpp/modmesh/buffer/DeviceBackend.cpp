@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/DeviceBackend.hpp>
+
+#ifdef MODMESH_CUDA
+#include <modmesh/device/cuda/CudaDeviceBackend.hpp>
+#endif // MODMESH_CUDA
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+namespace modmesh
+{
+
+void * DeviceBackend::allocate(size_t nbytes)
+{
+    void * ret = do_allocate(nbytes);
+    std::lock_guard<std::mutex> const lock(m_stats_mutex);
+    m_stats.device_bytes_in_use += nbytes;
+    return ret;
+}
+
+void DeviceBackend::deallocate(void * p, size_t nbytes)
+{
+    do_deallocate(p, nbytes);
+    std::lock_guard<std::mutex> const lock(m_stats_mutex);
+    m_stats.device_bytes_in_use -= nbytes;
+}
+
+void * DeviceBackend::allocate_pinned(size_t nbytes)
+{
+    void * ret = do_allocate_pinned(nbytes);
+    std::lock_guard<std::mutex> const lock(m_stats_mutex);
+    m_stats.pinned_bytes_in_use += nbytes;
+    return ret;
+}
+
+void DeviceBackend::deallocate_pinned(void * p, size_t nbytes)
+{
+    do_deallocate_pinned(p, nbytes);
+    std::lock_guard<std::mutex> const lock(m_stats_mutex);
+    m_stats.pinned_bytes_in_use -= nbytes;
+}
+
+void DeviceBackend::copy_to_device(void * device, void const * pinned, size_t nbytes, stream_type stream)
+{
+    do_copy_to_device(device, pinned, nbytes, stream);
+    std::lock_guard<std::mutex> const lock(m_stats_mutex);
+    ++m_stats.to_device_count;
+    m_stats.to_device_bytes += nbytes;
+}
+
+void DeviceBackend::copy_to_host(void * pinned, void const * device, size_t nbytes, stream_type stream)
+{
+    do_copy_to_host(pinned, device, nbytes, stream);
+    std::lock_guard<std::mutex> const lock(m_stats_mutex);
+    ++m_stats.to_host_count;
+    m_stats.to_host_bytes += nbytes;
+}
+
+DeviceBackendStats DeviceBackend::stats() const
+{
+    std::lock_guard<std::mutex> const lock(m_stats_mutex);
+    return m_stats;
+}
+
+void DeviceBackend::reset_stats()
+{
+    std::lock_guard<std::mutex> const lock(m_stats_mutex);
+    // The memory in use is not a counter to reset.
+    DeviceBackendStats stats;
+    stats.device_bytes_in_use = m_stats.device_bytes_in_use;
+    stats.pinned_bytes_in_use = m_stats.pinned_bytes_in_use;
+    m_stats = stats;
+}
+
+namespace
+{
+
+std::mutex & default_backend_mutex()
+{
+    static std::mutex o;
+    return o;
+}
+
+std::shared_ptr<DeviceBackend> & default_backend_storage()
+{
+    static std::shared_ptr<DeviceBackend> o;
+    return o;
+}
+
+} /* end namespace */
+
+std::shared_ptr<DeviceBackend> DeviceBackend::get_default()
+{
+    std::lock_guard<std::mutex> const lock(default_backend_mutex());
+    std::shared_ptr<DeviceBackend> & ret = default_backend_storage();
+    if (!ret)
+    {
+#ifdef MODMESH_CUDA
+        if (device::CudaDeviceBackend::device_count() > 0)
+        {
+            ret = device::CudaDeviceBackend::construct();
+        }
+#endif // MODMESH_CUDA
+        if (!ret)
+        {
+            ret = EmulatedDeviceBackend::construct();
+        }
+    }
+    return ret;
+}
+
+void DeviceBackend::set_default(std::shared_ptr<DeviceBackend> backend)
+{
+    std::lock_guard<std::mutex> const lock(default_backend_mutex());
+    default_backend_storage() = std::move(backend);
+}
+
+void * EmulatedDeviceBackend::do_allocate(size_t nbytes)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    return ::operator new[](std::max(nbytes, size_t(1)), std::align_val_t(64));
+}
+
+void EmulatedDeviceBackend::do_deallocate(void * p, size_t)
+{
+    ::operator delete[](p, std::align_val_t(64));
+}
+
+DeviceBackend::stream_type EmulatedDeviceBackend::do_create_stream()
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    return new Stream();
+}
+
+void EmulatedDeviceBackend::do_destroy_stream(stream_type stream)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    delete static_cast<Stream *>(stream);
+}
+
+void EmulatedDeviceBackend::do_synchronize(stream_type stream)
+{
+    static_cast<Stream *>(stream)->wait();
+}
+
+void EmulatedDeviceBackend::do_copy_to_device(void * device, void const * pinned, size_t nbytes, stream_type stream)
+{
+    static_cast<Stream *>(stream)->enqueue([=]()
+                                          { std::memcpy(device, pinned, nbytes); });
+}
+
+void EmulatedDeviceBackend::do_copy_to_host(void * pinned, void const * device, size_t nbytes, stream_type stream)
+{
+    static_cast<Stream *>(stream)->enqueue([=]()
+                                          { std::memcpy(pinned, device, nbytes); });
+}
+
+EmulatedDeviceBackend::Stream::Stream()
+    : m_thread([this]()
+               { work(); })
+{
+}
+
+EmulatedDeviceBackend::Stream::~Stream()
+{
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    m_thread.join();
+}
+
+void EmulatedDeviceBackend::Stream::enqueue(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+    m_cv.notify_all();
+}
+
+void EmulatedDeviceBackend::Stream::wait()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this]()
+              { return m_tasks.empty() && !m_busy; });
+}
+
+void EmulatedDeviceBackend::Stream::work()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_cv.wait(lock, [this]()
+                  { return m_stop || !m_tasks.empty(); });
+        if (m_tasks.empty())
+        {
+            // Stopped with the queue drained.
+            return;
+        }
+        std::function<void()> task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+        m_busy = true;
+        lock.unlock();
+        task();
+        lock.lock();
+        m_busy = false;
+        m_cv.notify_all();
+    }
+}
+
+DeviceMirror::DeviceMirror(std::shared_ptr<DeviceBackend> backend, size_t nbytes)
+    : m_backend(std::move(backend))
+    , m_nbytes(nbytes)
+{
+    if (!m_backend)
+    {
+        throw std::invalid_argument("DeviceMirror: the backend is null");
+    }
+}
+
+DeviceMirror::~DeviceMirror()
+{
+    if (nullptr != m_stream)
+    {
+        m_backend->synchronize(m_stream);
+        m_backend->destroy_stream(m_stream);
+    }
+    if (nullptr != m_staging)
+    {
+        m_backend->deallocate_pinned(m_staging, m_nbytes);
+    }
+    if (nullptr != m_device)
+    {
+        m_backend->deallocate(m_device, m_nbytes);
+    }
+}
+
+DeviceMirror::State DeviceMirror::state() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_state;
+}
+
+void DeviceMirror::modify_host()
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    if (State::DEVICE_MODIFIED == m_state)
+    {
+        throw std::runtime_error("DeviceMirror: cannot modify the host when the device is modified; sync the host first");
+    }
+    m_state = State::HOST_MODIFIED;
+}
+
+void DeviceMirror::modify_device()
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    if (State::HOST_MODIFIED == m_state)
+    {
+        throw std::runtime_error("DeviceMirror: cannot modify the device when the host is modified; sync the device first");
+    }
+    m_state = State::DEVICE_MODIFIED;
+}
+
+void * DeviceMirror::sync_device(void const * host)
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    if (nullptr == m_device)
+    {
+        m_stream = m_backend->create_stream();
+        m_staging = m_backend->allocate_pinned(m_nbytes);
+        m_device = m_backend->allocate(m_nbytes);
+    }
+    if (State::HOST_MODIFIED == m_state)
+    {
+        // The staging buffer may still be read by the last copy.
+        m_backend->synchronize(m_stream);
+        std::memcpy(m_staging, host, m_nbytes);
+        m_backend->copy_to_device(m_device, m_staging, m_nbytes, m_stream);
+        m_state = State::SYNCED;
+    }
+    return m_device;
+}
+
+void DeviceMirror::sync_host(void * host)
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    if (State::DEVICE_MODIFIED == m_state)
+    {
+        m_backend->copy_to_host(m_staging, m_device, m_nbytes, m_stream);
+        m_backend->synchronize(m_stream);
+        std::memcpy(host, m_staging, m_nbytes);
+        m_state = State::SYNCED;
+    }
+}
+
+void DeviceMirror::wait()
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    if (nullptr != m_stream)
+    {
+        m_backend->synchronize(m_stream);
+    }
+}
+
+char const * DeviceMirror::to_string(State state)
+{
+    switch (state)
+    {
+    case State::SYNCED:
+        return "synced";
+    case State::HOST_MODIFIED:
+        return "host_modified";
+    case State::DEVICE_MODIFIED:
+        return "device_modified";
+    }
+    return "unknown";
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,251 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/base.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace modmesh
+{
+
+/**
+ * Counters kept by a DeviceBackend, to tell the copies between the host and
+ * the device.
+ */
+struct DeviceBackendStats
+{
+    size_t device_bytes_in_use = 0;
+    size_t pinned_bytes_in_use = 0;
+    size_t to_device_count = 0;
+    size_t to_device_bytes = 0;
+    size_t to_host_count = 0;
+    size_t to_host_bytes = 0;
+}; /* end struct DeviceBackendStats */
+
+/**
+ * The memory and the copy streams of a compute device that does not share
+ * the memory with the host, e.g., a CUDA GPU.  The public member functions
+ * maintain the statistics; the derived classes implement the do_*() hooks.
+ *
+ * A stream is an opaque handle.  The copies enqueued on a stream run in
+ * order and asynchronously to the host; synchronize() waits for them.  The
+ * host memory of an asynchronous copy must be pinned, i.e., allocated by
+ * allocate_pinned(), and must not be touched until the copy completes.
+ */
+class DeviceBackend
+    : public std::enable_shared_from_this<DeviceBackend>
+{
+
+public:
+
+    using stream_type = void *;
+
+    DeviceBackend() = default;
+    DeviceBackend(DeviceBackend const &) = delete;
+    DeviceBackend(DeviceBackend &&) = delete;
+    DeviceBackend & operator=(DeviceBackend const &) = delete;
+    DeviceBackend & operator=(DeviceBackend &&) = delete;
+    virtual ~DeviceBackend() = default;
+
+    virtual char const * name() const = 0;
+
+    void * allocate(size_t nbytes);
+    void deallocate(void * p, size_t nbytes);
+    void * allocate_pinned(size_t nbytes);
+    void deallocate_pinned(void * p, size_t nbytes);
+
+    stream_type create_stream() { return do_create_stream(); }
+    void destroy_stream(stream_type stream) { do_destroy_stream(stream); }
+    void synchronize(stream_type stream) { do_synchronize(stream); }
+
+    /// Enqueue the copy of nbytes from the pinned host memory to the device.
+    void copy_to_device(void * device, void const * pinned, size_t nbytes, stream_type stream);
+    /// Enqueue the copy of nbytes from the device to the pinned host memory.
+    void copy_to_host(void * pinned, void const * device, size_t nbytes, stream_type stream);
+
+    DeviceBackendStats stats() const;
+    void reset_stats();
+
+    /**
+     * The backend used by ConcreteBuffer::to_device() without one.  It is the
+     * CUDA backend when modmesh is built with CUDA and a device is present,
+     * or an EmulatedDeviceBackend otherwise.
+     */
+    static std::shared_ptr<DeviceBackend> get_default();
+    static void set_default(std::shared_ptr<DeviceBackend> backend);
+
+protected:
+
+    virtual void * do_allocate(size_t nbytes) = 0;
+    virtual void do_deallocate(void * p, size_t nbytes) = 0;
+    virtual void * do_allocate_pinned(size_t nbytes) = 0;
+    virtual void do_deallocate_pinned(void * p, size_t nbytes) = 0;
+    virtual stream_type do_create_stream() = 0;
+    virtual void do_destroy_stream(stream_type stream) = 0;
+    virtual void do_synchronize(stream_type stream) = 0;
+    virtual void do_copy_to_device(void * device, void const * pinned, size_t nbytes, stream_type stream) = 0;
+    virtual void do_copy_to_host(void * pinned, void const * device, size_t nbytes, stream_type stream) = 0;
+
+private:
+
+    mutable std::mutex m_stats_mutex;
+    DeviceBackendStats m_stats;
+
+}; /* end class DeviceBackend */
+
+/**
+ * Emulate a device with separate host memory and a worker thread per stream
+ * doing the copies.  It runs the lazy synchronization of the device mirrors
+ * without a GPU, for testing and for the builds without one.
+ */
+class EmulatedDeviceBackend
+    : public DeviceBackend
+{
+
+public:
+
+    static std::shared_ptr<EmulatedDeviceBackend> construct() { return std::make_shared<EmulatedDeviceBackend>(); }
+
+    char const * name() const override { return "EmulatedDeviceBackend"; }
+
+protected:
+
+    void * do_allocate(size_t nbytes) override;
+    void do_deallocate(void * p, size_t nbytes) override;
+    void * do_allocate_pinned(size_t nbytes) override { return do_allocate(nbytes); }
+    void do_deallocate_pinned(void * p, size_t nbytes) override { do_deallocate(p, nbytes); }
+    stream_type do_create_stream() override;
+    void do_destroy_stream(stream_type stream) override;
+    void do_synchronize(stream_type stream) override;
+    void do_copy_to_device(void * device, void const * pinned, size_t nbytes, stream_type stream) override;
+    void do_copy_to_host(void * pinned, void const * device, size_t nbytes, stream_type stream) override;
+
+private:
+
+    class Stream
+    {
+
+    public:
+
+        Stream();
+        Stream(Stream const &) = delete;
+        Stream(Stream &&) = delete;
+        Stream & operator=(Stream const &) = delete;
+        Stream & operator=(Stream &&) = delete;
+        ~Stream();
+
+        void enqueue(std::function<void()> task);
+        void wait();
+
+    private:
+
+        void work();
+
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        std::deque<std::function<void()>> m_tasks;
+        bool m_busy = false;
+        bool m_stop = false;
+        std::thread m_thread;
+
+    }; /* end class Stream */
+
+}; /* end class EmulatedDeviceBackend */
+
+/**
+ * The device copy of a host buffer and the flags telling which side was
+ * modified since the last synchronization.  Nothing is copied implicitly:
+ * sync_device() and sync_host() copy only when the other side is modified,
+ * and a kernel writing the device copy calls modify_device(), as the host
+ * code writing the host buffer calls modify_host().
+ *
+ * The host data go through a pinned staging buffer, so that sync_device()
+ * returns once the host data are staged and the copy overlaps the host work
+ * until the kernels on stream() use it.  sync_host() waits for the copy.
+ */
+class DeviceMirror
+{
+
+public:
+
+    enum class State
+    {
+        SYNCED,
+        HOST_MODIFIED,
+        DEVICE_MODIFIED
+    }; /* end enum class State */
+
+    /// The new mirror takes the host as modified, and the device memory is allocated on the first sync_device().
+    DeviceMirror(std::shared_ptr<DeviceBackend> backend, size_t nbytes);
+    DeviceMirror(DeviceMirror const &) = delete;
+    DeviceMirror(DeviceMirror &&) = delete;
+    DeviceMirror & operator=(DeviceMirror const &) = delete;
+    DeviceMirror & operator=(DeviceMirror &&) = delete;
+    ~DeviceMirror();
+
+    std::shared_ptr<DeviceBackend> const & backend() const { return m_backend; }
+    size_t nbytes() const { return m_nbytes; }
+    /// Null before the first sync_device().
+    void * device_data() const { return m_device; }
+    DeviceBackend::stream_type stream() const { return m_stream; }
+
+    State state() const;
+    void modify_host();
+    void modify_device();
+
+    /// Copy the host data to the device if the host is modified, without waiting for the copy.
+    void * sync_device(void const * host);
+    /// Copy the device data to the host if the device is modified, and wait for the copy.
+    void sync_host(void * host);
+    /// Wait for the copies enqueued on the stream.
+    void wait();
+
+    static char const * to_string(State state);
+
+private:
+
+    std::shared_ptr<DeviceBackend> m_backend;
+    size_t m_nbytes;
+    mutable std::mutex m_mutex;
+    State m_state = State::HOST_MODIFIED;
+    void * m_device = nullptr;
+    void * m_staging = nullptr;
+    DeviceBackend::stream_type m_stream = nullptr;
+
+}; /* end class DeviceMirror */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,440 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/MappedBuffer.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <new>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace modmesh
+{
+
+MapMode get_map_mode_from_string(std::string const & mode)
+{
+    if (mode == "r")
+    {
+        return MapMode::ReadOnly;
+    }
+    if (mode == "r+")
+    {
+        return MapMode::ReadWrite;
+    }
+    if (mode == "c")
+    {
+        return MapMode::CopyOnWrite;
+    }
+    throw std::invalid_argument(Formatter() << "map_buffer: unsupported mode \"" << mode << "\" (use \"r\", \"r+\", or \"c\")");
+}
+
+namespace detail
+{
+
+/**
+ * The first page of a shared memory segment, followed by the data.  The
+ * atomics are lock-free and hence work across the processes mapping them.
+ */
+struct SharedMemoryHeader
+{
+    char magic[8]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    std::atomic<uint64_t> refcount;
+    std::atomic<uint32_t> published;
+    uint32_t reserved;
+    uint64_t data_offset;
+    uint64_t nbytes;
+}; /* end struct SharedMemoryHeader */
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free,
+              "SharedMemoryHeader needs lock-free atomics");
+
+constexpr char SHARED_MEMORY_MAGIC[8] = {'M', 'M', 'S', 'H', 'M', '\0', '\0', '\0'}; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+
+void validate_shared_name(std::string const & name)
+{
+    if (name.size() < 2 || '/' != name[0] || std::string::npos != name.find('/', 1))
+    {
+        throw std::invalid_argument(Formatter() << "SharedMemory: name \"" << name << "\" is not a slash followed by no more slashes");
+    }
+}
+
+} /* end namespace detail */
+
+SharedMemory::SharedMemory(std::string name, void * header, size_t header_length, void * data, size_t nbytes, bool readonly, ctor_passkey const &)
+    : m_name(std::move(name))
+    , m_header(header)
+    , m_header_length(header_length)
+    , m_data(data)
+    , m_nbytes(nbytes)
+    , m_readonly(readonly)
+{
+}
+
+uint64_t SharedMemory::refcount() const
+{
+    return static_cast<detail::SharedMemoryHeader const *>(m_header)->refcount.load(std::memory_order_acquire);
+}
+
+bool SharedMemory::is_published() const
+{
+    return 0 != static_cast<detail::SharedMemoryHeader const *>(m_header)->published.load(std::memory_order_acquire);
+}
+
+void SharedMemory::publish()
+{
+    if (m_readonly)
+    {
+        throw std::runtime_error(Formatter() << "SharedMemory: cannot publish \"" << m_name << "\" attached read-only");
+    }
+    static_cast<detail::SharedMemoryHeader *>(m_header)->published.store(1, std::memory_order_release);
+}
+
+std::shared_ptr<ConcreteBuffer> SharedMemory::buffer(size_t offset, size_t nbytes)
+{
+    if (offset > m_nbytes || nbytes > m_nbytes - offset)
+    {
+        throw std::out_of_range(Formatter() << "SharedMemory: range [" << offset << ", " << offset + nbytes
+                                            << ") exceeds size " << m_nbytes);
+    }
+    if (0 == nbytes)
+    {
+        return ConcreteBuffer::construct(0);
+    }
+    return ConcreteBuffer::construct(
+        nbytes,
+        data() + offset,
+        std::make_unique<detail::ConcreteBufferSharedRemover>(shared_from_this()));
+}
+
+#ifdef _WIN32
+
+namespace detail
+{
+
+// NOLINTNEXTLINE(readability-non-const-parameter)
+void ConcreteBufferMmapRemover::operator()(int8_t *) const
+{
+    UnmapViewOfFile(address);
+}
+
+} /* end namespace detail */
+
+std::shared_ptr<ConcreteBuffer> map_buffer(std::string const & path, MapMode mode, size_t offset, size_t nbytes)
+{
+    DWORD const access = MapMode::ReadWrite == mode ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ;
+    HANDLE file = CreateFileA(path.c_str(), access, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (INVALID_HANDLE_VALUE == file)
+    {
+        throw std::runtime_error(Formatter() << "map_buffer: cannot open \"" << path << "\" (error " << GetLastError() << ")");
+    }
+    LARGE_INTEGER file_size;
+    GetFileSizeEx(file, &file_size);
+    auto const fsize = static_cast<size_t>(file_size.QuadPart);
+    if (offset > fsize || (0 != nbytes && offset + nbytes > fsize))
+    {
+        CloseHandle(file);
+        throw std::out_of_range(Formatter() << "map_buffer: range [" << offset << ", " << offset + nbytes
+                                            << ") exceeds file size " << fsize);
+    }
+    if (0 == nbytes)
+    {
+        nbytes = fsize - offset;
+    }
+    if (0 == nbytes)
+    {
+        CloseHandle(file);
+        return ConcreteBuffer::construct(0);
+    }
+
+    DWORD const protect = MapMode::ReadWrite == mode ? PAGE_READWRITE : (MapMode::CopyOnWrite == mode ? PAGE_WRITECOPY : PAGE_READONLY);
+    HANDLE mapping = CreateFileMappingA(file, nullptr, protect, 0, 0, nullptr);
+    CloseHandle(file);
+    if (nullptr == mapping)
+    {
+        throw std::runtime_error(Formatter() << "map_buffer: cannot map \"" << path << "\" (error " << GetLastError() << ")");
+    }
+
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    size_t const granularity = info.dwAllocationGranularity;
+    size_t const base = offset / granularity * granularity;
+    size_t const length = offset - base + nbytes;
+    DWORD const view_access = MapMode::ReadWrite == mode ? FILE_MAP_WRITE : (MapMode::CopyOnWrite == mode ? FILE_MAP_COPY : FILE_MAP_READ);
+    void * address = MapViewOfFile(mapping, view_access, static_cast<DWORD>(base >> 32), static_cast<DWORD>(base & 0xffffffff), length);
+    CloseHandle(mapping);
+    if (nullptr == address)
+    {
+        throw std::runtime_error(Formatter() << "map_buffer: cannot map view of \"" << path << "\" (error " << GetLastError() << ")");
+    }
+
+    return ConcreteBuffer::construct(
+        nbytes,
+        static_cast<int8_t *>(address) + (offset - base),
+        std::make_unique<detail::ConcreteBufferMmapRemover>(address, length, MapMode::ReadOnly == mode));
+}
+
+std::shared_ptr<SharedMemory> SharedMemory::create(std::string const &, size_t)
+{
+    throw std::runtime_error("SharedMemory: POSIX shared memory is not available on Windows");
+}
+
+std::shared_ptr<SharedMemory> SharedMemory::attach(std::string const &)
+{
+    throw std::runtime_error("SharedMemory: POSIX shared memory is not available on Windows");
+}
+
+bool SharedMemory::remove(std::string const &)
+{
+    throw std::runtime_error("SharedMemory: POSIX shared memory is not available on Windows");
+}
+
+SharedMemory::~SharedMemory() = default;
+
+#else // _WIN32
+
+namespace detail
+{
+
+// NOLINTNEXTLINE(readability-non-const-parameter)
+void ConcreteBufferMmapRemover::operator()(int8_t *) const
+{
+    munmap(address, length);
+}
+
+} /* end namespace detail */
+
+std::shared_ptr<ConcreteBuffer> map_buffer(std::string const & path, MapMode mode, size_t offset, size_t nbytes)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+    int const fd = open(path.c_str(), MapMode::ReadWrite == mode ? O_RDWR : O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::runtime_error(Formatter() << "map_buffer: cannot open \"" << path << "\": " << std::strerror(errno));
+    }
+    struct stat st
+    {
+    };
+    if (0 != fstat(fd, &st))
+    {
+        close(fd);
+        throw std::runtime_error(Formatter() << "map_buffer: cannot stat \"" << path << "\": " << std::strerror(errno));
+    }
+    auto const fsize = static_cast<size_t>(st.st_size);
+    if (offset > fsize || (0 != nbytes && offset + nbytes > fsize))
+    {
+        close(fd);
+        throw std::out_of_range(Formatter() << "map_buffer: range [" << offset << ", " << offset + nbytes
+                                            << ") exceeds file size " << fsize);
+    }
+    if (0 == nbytes)
+    {
+        nbytes = fsize - offset;
+    }
+    if (0 == nbytes)
+    {
+        close(fd);
+        return ConcreteBuffer::construct(0);
+    }
+
+    auto const page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t const base = offset / page * page;
+    size_t const length = offset - base + nbytes;
+    int const prot = MapMode::ReadOnly == mode ? PROT_READ : (PROT_READ | PROT_WRITE);
+    int const flags = MapMode::ReadWrite == mode ? MAP_SHARED : MAP_PRIVATE;
+    void * address = mmap(nullptr, length, prot, flags, fd, static_cast<off_t>(base));
+    // The mapping stays valid after the descriptor is closed.
+    close(fd);
+    if (MAP_FAILED == address)
+    {
+        throw std::runtime_error(Formatter() << "map_buffer: cannot map \"" << path << "\": " << std::strerror(errno));
+    }
+
+    return ConcreteBuffer::construct(
+        nbytes,
+        static_cast<int8_t *>(address) + (offset - base),
+        std::make_unique<detail::ConcreteBufferMmapRemover>(address, length, MapMode::ReadOnly == mode));
+}
+
+std::shared_ptr<SharedMemory> SharedMemory::create(std::string const & name, size_t nbytes)
+{
+    detail::validate_shared_name(name);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+    int const fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0)
+    {
+        throw std::runtime_error(Formatter() << "SharedMemory: cannot create \"" << name << "\": " << std::strerror(errno));
+    }
+    // The header takes the first page, so that the data are mapped apart.
+    auto const page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    void * header = MAP_FAILED;
+    auto const fail = [&](char const * what)
+    {
+        int const error = errno;
+        if (MAP_FAILED != header)
+        {
+            munmap(header, page);
+        }
+        close(fd);
+        shm_unlink(name.c_str());
+        throw std::runtime_error(Formatter() << "SharedMemory: cannot " << what << " \"" << name << "\": " << std::strerror(error));
+    };
+    if (0 != ftruncate(fd, static_cast<off_t>(page + nbytes)))
+    {
+        fail("resize");
+    }
+    header = mmap(nullptr, page, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (MAP_FAILED == header)
+    {
+        fail("map");
+    }
+    void * data = nullptr;
+    if (0 != nbytes)
+    {
+        data = mmap(nullptr, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, static_cast<off_t>(page));
+        if (MAP_FAILED == data)
+        {
+            fail("map");
+        }
+    }
+    close(fd);
+
+    auto * hdr = new (header) detail::SharedMemoryHeader();
+    std::memcpy(hdr->magic, detail::SHARED_MEMORY_MAGIC, sizeof(hdr->magic));
+    hdr->data_offset = page;
+    hdr->nbytes = nbytes;
+    hdr->refcount.store(1, std::memory_order_release);
+    return std::make_shared<SharedMemory>(name, header, page, data, nbytes, /* readonly */ false, ctor_passkey());
+}
+
+std::shared_ptr<SharedMemory> SharedMemory::attach(std::string const & name)
+{
+    detail::validate_shared_name(name);
+    // The header is mapped writable for the reference count.
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+    int const fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0)
+    {
+        throw std::runtime_error(Formatter() << "SharedMemory: cannot open \"" << name << "\": " << std::strerror(errno));
+    }
+    auto const page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    struct stat st
+    {
+    };
+    void * header = MAP_FAILED;
+    if (0 == fstat(fd, &st) && static_cast<size_t>(st.st_size) >= page)
+    {
+        header = mmap(nullptr, page, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    auto * hdr = static_cast<detail::SharedMemoryHeader *>(header);
+    auto const fail = [&](char const * why)
+    {
+        if (MAP_FAILED != header)
+        {
+            munmap(header, page);
+        }
+        close(fd);
+        throw std::runtime_error(Formatter() << "SharedMemory: \"" << name << "\" " << why);
+    };
+    if (MAP_FAILED == header || 0 != std::memcmp(hdr->magic, detail::SHARED_MEMORY_MAGIC, sizeof(hdr->magic))
+        || page != hdr->data_offset || page + hdr->nbytes > static_cast<size_t>(st.st_size))
+    {
+        fail("is not made by SharedMemory::create()");
+    }
+    if (0 == hdr->published.load(std::memory_order_acquire))
+    {
+        fail("is not published");
+    }
+    // A count dropped to zero means the segment is being unlinked.
+    uint64_t count = hdr->refcount.load(std::memory_order_acquire);
+    do
+    {
+        if (0 == count)
+        {
+            fail("is being released");
+        }
+    } while (!hdr->refcount.compare_exchange_weak(count, count + 1, std::memory_order_acq_rel));
+
+    auto const nbytes = static_cast<size_t>(hdr->nbytes);
+    void * data = nullptr;
+    if (0 != nbytes)
+    {
+        data = mmap(nullptr, nbytes, PROT_READ, MAP_SHARED, fd, static_cast<off_t>(page));
+        if (MAP_FAILED == data)
+        {
+            int const error = errno;
+            if (1 == hdr->refcount.fetch_sub(1, std::memory_order_acq_rel))
+            {
+                shm_unlink(name.c_str());
+            }
+            munmap(header, page);
+            close(fd);
+            throw std::runtime_error(Formatter() << "SharedMemory: cannot map \"" << name << "\": " << std::strerror(error));
+        }
+    }
+    close(fd);
+    return std::make_shared<SharedMemory>(name, header, page, data, nbytes, /* readonly */ true, ctor_passkey());
+}
+
+bool SharedMemory::remove(std::string const & name)
+{
+    detail::validate_shared_name(name);
+    return 0 == shm_unlink(name.c_str());
+}
+
+SharedMemory::~SharedMemory()
+{
+    if (0 != m_nbytes)
+    {
+        munmap(m_data, m_nbytes);
+    }
+    auto * hdr = static_cast<detail::SharedMemoryHeader *>(m_header);
+    bool const last = 1 == hdr->refcount.fetch_sub(1, std::memory_order_acq_rel);
+    munmap(m_header, m_header_length);
+    if (last)
+    {
+        shm_unlink(m_name.c_str());
+    }
+}
+
+#endif // _WIN32
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,209 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/ConcreteBuffer.hpp>
+
+#include <string>
+#include <typeinfo>
+
+namespace modmesh
+{
+
+/**
+ * How a file is mapped into a ConcreteBuffer.  The modes follow those of
+ * numpy.memmap:
+ *
+ * - ReadOnly ("r"): Writing to the buffer is not allowed.
+ * - ReadWrite ("r+"): Writing to the buffer modifies the file and is visible
+ *   to the other processes mapping the same file.
+ * - CopyOnWrite ("c"): Writing to the buffer creates private pages and does
+ *   not modify the file.
+ */
+enum class MapMode
+{
+    ReadOnly,
+    ReadWrite,
+    CopyOnWrite,
+}; /* end enum class MapMode */
+
+MapMode get_map_mode_from_string(std::string const & mode);
+
+namespace detail
+{
+
+/**
+ * Unmap the memory of a file-backed ConcreteBuffer.  The mapping may start
+ * before the data pointer of the buffer because the file offset of a mapping
+ * needs to be aligned to the allocation granularity.
+ */
+struct ConcreteBufferMmapRemover : public ConcreteBufferRemover
+{
+
+    ConcreteBufferMmapRemover(void * address_in, size_t length_in, bool readonly_in)
+        : address(address_in)
+        , length(length_in)
+        , readonly(readonly_in)
+    {
+    }
+
+    static bool is_same_type(ConcreteBufferRemover const & other)
+    {
+        return typeid(other) == typeid(ConcreteBufferMmapRemover);
+    }
+
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays,readability-non-const-parameter)
+    void operator()(int8_t * p) const override;
+
+    bool is_readonly() const override { return readonly; }
+
+    void * address;
+    size_t length;
+    bool readonly;
+
+}; /* end struct ConcreteBufferMmapRemover */
+
+} /* end namespace detail */
+
+/**
+ * Create a ConcreteBuffer backed by a memory-mapped file.  The pages are read
+ * from the file when they are first accessed.
+ *
+ * \param[in] path
+ *      Path to the file.
+ * \param[in] mode
+ *      How the file is mapped.
+ * \param[in] offset
+ *      Offset in bytes in the file where the buffer starts.
+ * \param[in] nbytes
+ *      Size of the buffer in bytes.  0 maps to the end of the file.
+ */
+std::shared_ptr<ConcreteBuffer> map_buffer(std::string const & path, MapMode mode = MapMode::ReadOnly, size_t offset = 0, size_t nbytes = 0);
+
+/**
+ * A named POSIX shared memory segment mapped into the process, for the
+ * processes on a host to share the same pages.  One process creates the
+ * segment, fills data(), and calls publish(); the others attach to it by
+ * name and see the data read-only.
+ *
+ * Every handle in every process is counted in the segment, and the segment
+ * is unlinked when the last handle is released.  The buffers made by
+ * buffer() hold the handle, so the arrays on the segment keep it alive.  A
+ * segment left by a process that crashed is removed by remove().  Not
+ * available on Windows.
+ */
+class SharedMemory
+    : public std::enable_shared_from_this<SharedMemory>
+{
+
+private:
+
+    struct ctor_passkey
+    {
+    };
+
+public:
+
+    /**
+     * Create the segment of nbytes writable bytes.  The name is like
+     * "/modmesh_mesh", a slash followed by no more slashes; the name must not
+     * be in use.
+     */
+    static std::shared_ptr<SharedMemory> create(std::string const & name, size_t nbytes);
+    /// Attach read-only to a published segment.
+    static std::shared_ptr<SharedMemory> attach(std::string const & name);
+    /// Unlink the name regardless of the handles.  Returns false if it does not exist.
+    static bool remove(std::string const & name);
+
+    SharedMemory(std::string name, void * header, size_t header_length, void * data, size_t nbytes, bool readonly, ctor_passkey const &);
+    SharedMemory() = delete;
+    SharedMemory(SharedMemory const &) = delete;
+    SharedMemory(SharedMemory &&) = delete;
+    SharedMemory & operator=(SharedMemory const &) = delete;
+    SharedMemory & operator=(SharedMemory &&) = delete;
+    ~SharedMemory();
+
+    std::string const & name() const { return m_name; }
+    size_t nbytes() const noexcept { return m_nbytes; }
+    bool is_readonly() const noexcept { return m_readonly; }
+    /// Number of the handles to the segment in all processes.
+    uint64_t refcount() const;
+    bool is_published() const;
+    /// Let attach() find the segment.  The data should not be written afterwards.
+    void publish();
+
+    int8_t const * data() const noexcept { return static_cast<int8_t const *>(m_data); }
+    int8_t * data() noexcept { return static_cast<int8_t *>(m_data); }
+
+    /// A buffer over [offset, offset + nbytes) of the data without copying.
+    std::shared_ptr<ConcreteBuffer> buffer(size_t offset, size_t nbytes);
+
+private:
+
+    std::string m_name;
+    void * m_header;
+    size_t m_header_length;
+    void * m_data;
+    size_t m_nbytes;
+    bool m_readonly;
+
+}; /* end class SharedMemory */
+
+namespace detail
+{
+
+/// Hold the shared memory segment a ConcreteBuffer is on.
+struct ConcreteBufferSharedRemover : public ConcreteBufferRemover
+{
+
+    explicit ConcreteBufferSharedRemover(std::shared_ptr<SharedMemory> segment_in)
+        : segment(std::move(segment_in))
+    {
+    }
+
+    static bool is_same_type(ConcreteBufferRemover const & other)
+    {
+        return typeid(other) == typeid(ConcreteBufferSharedRemover);
+    }
+
+    // The segment is released with the remover.
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays,readability-non-const-parameter)
+    void operator()(int8_t *) const override {}
+
+    bool is_readonly() const override { return segment->is_readonly(); }
+
+    std::shared_ptr<SharedMemory> segment;
+
+}; /* end struct ConcreteBufferSharedRemover */
+
+} /* end namespace detail */
+
+} /* end namespace modmesh */
+
+/* vim: set et ts=4 sw=4: */
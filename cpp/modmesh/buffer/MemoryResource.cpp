@@ -0,0 +1,717 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/MemoryResource.hpp>
+#include <modmesh/buffer/ThreadPool.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <fcntl.h>
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+inline size_t ceil_log2(size_t value)
+{
+    size_t ret = 0;
+    while ((size_t(1) << ret) < value)
+    {
+        ++ret;
+    }
+    return ret;
+}
+
+inline size_t system_alignment(size_t alignment)
+{
+    return 0 == alignment ? alignof(std::max_align_t) : alignment;
+}
+
+} /* end namespace detail */
+
+int8_t * MemoryResource::allocate(size_t nbytes, size_t alignment)
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    int8_t * ret = do_allocate(nbytes, alignment);
+    ++m_stats.allocate_count;
+    m_stats.bytes_in_use += nbytes;
+    m_stats.peak_bytes_in_use = std::max(m_stats.peak_bytes_in_use, m_stats.bytes_in_use);
+    return ret;
+}
+
+void MemoryResource::deallocate(int8_t * p, size_t nbytes, size_t alignment)
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    do_deallocate(p, nbytes, alignment);
+    ++m_stats.deallocate_count;
+    m_stats.bytes_in_use -= nbytes;
+}
+
+int8_t * MemoryResource::clone(int8_t const * p, size_t nbytes, size_t alignment)
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    int8_t * ret = do_clone(p, nbytes, alignment);
+    if (nullptr != ret)
+    {
+        ++m_stats.allocate_count;
+        m_stats.bytes_in_use += nbytes;
+        m_stats.peak_bytes_in_use = std::max(m_stats.peak_bytes_in_use, m_stats.bytes_in_use);
+    }
+    return ret;
+}
+
+MemoryResourceStats MemoryResource::stats() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_stats;
+}
+
+void MemoryResource::reset_stats()
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    // Keep the gauges and clear the counters.
+    MemoryResourceStats stats;
+    stats.bytes_in_use = m_stats.bytes_in_use;
+    stats.peak_bytes_in_use = m_stats.bytes_in_use;
+    stats.upstream_bytes = m_stats.upstream_bytes;
+    m_stats = stats;
+}
+
+namespace
+{
+
+std::shared_ptr<MemoryResource> & current_memory_resource()
+{
+    thread_local std::shared_ptr<MemoryResource> resource;
+    return resource;
+}
+
+} /* end namespace */
+
+std::shared_ptr<MemoryResource> const & MemoryResource::get_current()
+{
+    return current_memory_resource();
+}
+
+void MemoryResource::set_current(std::shared_ptr<MemoryResource> resource)
+{
+    current_memory_resource() = std::move(resource);
+}
+
+int8_t * MemoryResource::upstream_allocate(size_t nbytes, size_t alignment)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    auto * ret = static_cast<int8_t *>(::operator new[](nbytes, std::align_val_t(detail::system_alignment(alignment))));
+    record_upstream_allocate(nbytes);
+    return ret;
+}
+
+void MemoryResource::upstream_deallocate(int8_t * p, size_t nbytes, size_t alignment)
+{
+    ::operator delete[](p, std::align_val_t(detail::system_alignment(alignment)));
+    record_upstream_deallocate(nbytes);
+}
+
+void MemoryResource::record_upstream_allocate(size_t nbytes)
+{
+    ++m_stats.upstream_allocate_count;
+    m_stats.upstream_bytes += nbytes;
+}
+
+void MemoryResource::record_upstream_deallocate(size_t nbytes)
+{
+    ++m_stats.upstream_deallocate_count;
+    m_stats.upstream_bytes -= nbytes;
+}
+
+std::shared_ptr<PoolMemoryResource> const & PoolMemoryResource::thread_local_instance()
+{
+    thread_local std::shared_ptr<PoolMemoryResource> instance = PoolMemoryResource::construct();
+    return instance;
+}
+
+PoolMemoryResource::PoolMemoryResource(size_t max_block_size)
+    : m_max_block_size(block_size(max_block_size))
+    , m_free_lists(size_class(m_max_block_size) + 1)
+{
+}
+
+PoolMemoryResource::~PoolMemoryResource()
+{
+    release_locked();
+}
+
+size_t PoolMemoryResource::block_size(size_t nbytes)
+{
+    return size_t(1) << size_class(nbytes);
+}
+
+size_t PoolMemoryResource::size_class(size_t nbytes)
+{
+    return detail::ceil_log2(std::max(nbytes, MIN_BLOCK_SIZE));
+}
+
+size_t PoolMemoryResource::cached_bytes() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    size_t ret = 0;
+    for (size_t it = 0; it < m_free_lists.size(); ++it)
+    {
+        ret += m_free_lists[it].size() << it;
+    }
+    return ret;
+}
+
+void PoolMemoryResource::release()
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    release_locked();
+}
+
+void PoolMemoryResource::release_locked()
+{
+    for (size_t it = 0; it < m_free_lists.size(); ++it)
+    {
+        for (int8_t * p : m_free_lists[it])
+        {
+            upstream_deallocate(p, size_t(1) << it, BLOCK_ALIGNMENT);
+        }
+        m_free_lists[it].clear();
+    }
+}
+
+int8_t * PoolMemoryResource::do_allocate(size_t nbytes, size_t alignment)
+{
+    if (!is_pooled(nbytes, alignment))
+    {
+        return upstream_allocate(nbytes, alignment);
+    }
+    std::vector<int8_t *> & free_list = m_free_lists[size_class(nbytes)];
+    if (free_list.empty())
+    {
+        return upstream_allocate(block_size(nbytes), BLOCK_ALIGNMENT);
+    }
+    int8_t * ret = free_list.back();
+    free_list.pop_back();
+    return ret;
+}
+
+void PoolMemoryResource::do_deallocate(int8_t * p, size_t nbytes, size_t alignment)
+{
+    if (!is_pooled(nbytes, alignment))
+    {
+        upstream_deallocate(p, nbytes, alignment);
+        return;
+    }
+    m_free_lists[size_class(nbytes)].push_back(p);
+}
+
+ArenaMemoryResource::ArenaMemoryResource(size_t chunk_size)
+    : m_chunk_size(chunk_size)
+{
+    if (0 == chunk_size)
+    {
+        throw std::invalid_argument("ArenaMemoryResource: chunk size cannot be 0");
+    }
+}
+
+ArenaMemoryResource::~ArenaMemoryResource()
+{
+    for (Chunk const & chunk : m_chunks)
+    {
+        upstream_deallocate(chunk.data, chunk.nbytes, chunk.alignment);
+    }
+}
+
+size_t ArenaMemoryResource::nchunk() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_chunks.size();
+}
+
+size_t ArenaMemoryResource::live_count() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_live_count;
+}
+
+void ArenaMemoryResource::check_no_live(char const * action) const
+{
+    if (0 != m_live_count)
+    {
+        throw std::runtime_error(Formatter() << "ArenaMemoryResource: cannot " << action << " with "
+                                             << m_live_count << " live allocation(s)");
+    }
+}
+
+void ArenaMemoryResource::reset()
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    check_no_live("reset");
+    m_current = 0;
+    m_offset = 0;
+}
+
+void ArenaMemoryResource::release()
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    check_no_live("release");
+    for (Chunk const & chunk : m_chunks)
+    {
+        upstream_deallocate(chunk.data, chunk.nbytes, chunk.alignment);
+    }
+    m_chunks.clear();
+    m_current = 0;
+    m_offset = 0;
+}
+
+int8_t * ArenaMemoryResource::do_allocate(size_t nbytes, size_t alignment)
+{
+    size_t const align = std::max(alignment, MIN_ALIGNMENT);
+    for (; m_current < m_chunks.size(); ++m_current, m_offset = 0)
+    {
+        Chunk const & chunk = m_chunks[m_current];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto const address = reinterpret_cast<uintptr_t>(chunk.data + m_offset);
+        size_t const padding = (align - (address % align)) % align;
+        if (m_offset + padding + nbytes <= chunk.nbytes)
+        {
+            int8_t * ret = chunk.data + m_offset + padding;
+            m_offset += padding + nbytes;
+            ++m_live_count;
+            return ret;
+        }
+    }
+    Chunk chunk;
+    chunk.nbytes = std::max(m_chunk_size, nbytes);
+    chunk.alignment = align;
+    chunk.data = upstream_allocate(chunk.nbytes, chunk.alignment);
+    m_chunks.push_back(chunk);
+    m_current = m_chunks.size() - 1;
+    m_offset = nbytes;
+    ++m_live_count;
+    return chunk.data;
+}
+
+void ArenaMemoryResource::do_deallocate(int8_t *, size_t, size_t)
+{
+    --m_live_count;
+}
+
+NumaMemoryResource::NumaMemoryResource(Policy policy, size_t node)
+    : m_policy(policy)
+    , m_node(node)
+{
+    if (!is_supported(policy))
+    {
+        throw std::runtime_error(Formatter() << "NumaMemoryResource: policy " << to_string(policy)
+                                             << " is not supported on this platform");
+    }
+    if (Policy::Bind == policy && node >= node_count())
+    {
+        throw std::invalid_argument(Formatter() << "NumaMemoryResource: node " << node << " >= node count "
+                                                << node_count());
+    }
+}
+
+size_t NumaMemoryResource::node_count()
+{
+#ifdef __linux__
+    // The file lists the online nodes in ranges, e.g., "0-1,4".
+    static size_t const count = []()
+    {
+        std::ifstream stream("/sys/devices/system/node/online");
+        size_t max_node = 0;
+        size_t value = 0;
+        char sep = 0;
+        while (stream >> value)
+        {
+            max_node = std::max(max_node, value);
+            if (!(stream >> sep))
+            {
+                break;
+            }
+        }
+        return max_node + 1;
+    }();
+    return count;
+#else
+    return 1;
+#endif
+}
+
+size_t NumaMemoryResource::page_size()
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+#else
+    static size_t const size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+#endif
+}
+
+bool NumaMemoryResource::is_supported(Policy policy)
+{
+#ifdef __linux__
+    (void)policy;
+    return true;
+#else
+    return Policy::FirstTouch == policy;
+#endif
+}
+
+NumaMemoryResource::Policy NumaMemoryResource::policy_from_string(std::string const & value)
+{
+    if ("first_touch" == value)
+    {
+        return Policy::FirstTouch;
+    }
+    if ("interleave" == value)
+    {
+        return Policy::Interleave;
+    }
+    if ("bind" == value)
+    {
+        return Policy::Bind;
+    }
+    throw std::invalid_argument(Formatter() << "NumaMemoryResource: unknown policy \"" << value
+                                            << "\" (expect first_touch, interleave or bind)");
+}
+
+char const * NumaMemoryResource::to_string(Policy policy)
+{
+    switch (policy)
+    {
+    case Policy::FirstTouch: return "first_touch";
+    case Policy::Interleave: return "interleave";
+    case Policy::Bind: return "bind";
+    default: return "unknown";
+    }
+}
+
+size_t NumaMemoryResource::mapped_size(size_t nbytes) const
+{
+    size_t const page = page_size();
+    return (nbytes + page - 1) / page * page;
+}
+
+void NumaMemoryResource::first_touch(int8_t * p, size_t nbytes) const
+{
+    size_t const page = page_size();
+    // Use the element chunks of the 8-byte types so that the thread that
+    // touches a page is the one that processes it in the chunked loops.
+    parallel_for_chunks(
+        nbytes / sizeof(double),
+        ThreadPool::instance().nthread() > 1,
+        [p, page](size_t begin, size_t end)
+        {
+            size_t const first = (begin * sizeof(double) + page - 1) / page * page;
+            for (size_t offset = first; offset < end * sizeof(double); offset += page)
+            {
+                p[offset] = 0;
+            }
+        });
+}
+
+int8_t * NumaMemoryResource::do_allocate(size_t nbytes, size_t alignment)
+{
+    if (alignment > page_size())
+    {
+        throw std::invalid_argument(Formatter() << "NumaMemoryResource: alignment " << alignment
+                                                << " exceeds the page size " << page_size());
+    }
+    size_t const size = mapped_size(nbytes);
+#ifdef _WIN32
+    auto * ret = static_cast<int8_t *>(VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+    if (nullptr == ret)
+    {
+        throw std::bad_alloc();
+    }
+#else
+    void * addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == addr)
+    {
+        throw std::bad_alloc();
+    }
+    auto * ret = static_cast<int8_t *>(addr);
+#endif
+#ifdef __linux__
+    if (Policy::FirstTouch != m_policy)
+    {
+        // Call mbind(2) directly to avoid depending on libnuma.
+        size_t const nbits = 8 * sizeof(unsigned long);
+        size_t const nnode = node_count();
+        // The kernel reads maxnode - 1 bits, so it is one more than the node count.
+        std::vector<unsigned long> mask((nnode + 1 + nbits - 1) / nbits, 0);
+        for (size_t it = 0; it < nnode; ++it)
+        {
+            if (Policy::Interleave == m_policy || it == m_node)
+            {
+                mask[it / nbits] |= 1UL << (it % nbits);
+            }
+        }
+        int const mode = Policy::Interleave == m_policy ? MPOL_INTERLEAVE : MPOL_BIND;
+        if (0 != syscall(SYS_mbind, ret, size, mode, mask.data(), nnode + 1, 0))
+        {
+            int const error = errno;
+            munmap(ret, size);
+            throw std::runtime_error(Formatter() << "NumaMemoryResource: mbind failed: " << std::strerror(error));
+        }
+    }
+#endif
+    record_upstream_allocate(size);
+    if (Policy::FirstTouch == m_policy)
+    {
+        first_touch(ret, size);
+    }
+    return ret;
+}
+
+void NumaMemoryResource::do_deallocate(int8_t * p, size_t nbytes, size_t)
+{
+    size_t const size = mapped_size(nbytes);
+#ifdef _WIN32
+    VirtualFree(p, 0, MEM_RELEASE);
+#else
+    munmap(p, size);
+#endif
+    record_upstream_deallocate(size);
+}
+
+bool CopyOnWriteMemoryResource::is_supported()
+{
+#ifdef __linux__
+    return true;
+#else
+    return false;
+#endif
+}
+
+size_t CopyOnWriteMemoryResource::shared_clone_count() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_shared_clone_count;
+}
+
+size_t CopyOnWriteMemoryResource::copied_clone_count() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_copied_clone_count;
+}
+
+#ifdef __linux__
+
+std::shared_ptr<int> CopyOnWriteMemoryResource::create_file(size_t length) const
+{
+    int const fd = static_cast<int>(syscall(SYS_memfd_create, "modmesh_cow", MFD_CLOEXEC));
+    if (fd < 0)
+    {
+        throw std::runtime_error(Formatter() << "CopyOnWriteMemoryResource: memfd_create failed: " << std::strerror(errno));
+    }
+    if (0 != ftruncate(fd, static_cast<off_t>(length)))
+    {
+        int const error = errno;
+        close(fd);
+        throw std::runtime_error(Formatter() << "CopyOnWriteMemoryResource: ftruncate failed: " << std::strerror(error));
+    }
+    return std::shared_ptr<int>(new int(fd),
+                                [](int * pfd)
+                                {
+                                    close(*pfd);
+                                    delete pfd;
+                                });
+}
+
+int8_t * CopyOnWriteMemoryResource::map(std::shared_ptr<int> const & file, size_t length, bool shared, int8_t * fixed)
+{
+    int const flags = (shared ? MAP_SHARED : MAP_PRIVATE) | (nullptr == fixed ? 0 : MAP_FIXED);
+    void * addr = mmap(fixed, length, PROT_READ | PROT_WRITE, flags, *file, 0);
+    if (MAP_FAILED == addr)
+    {
+        if (nullptr != fixed)
+        {
+            // The old pages are gone when MAP_FIXED fails.  Nothing can recover
+            // the content.
+            throw std::runtime_error(Formatter() << "CopyOnWriteMemoryResource: remapping failed: " << std::strerror(errno));
+        }
+        throw std::bad_alloc();
+    }
+    auto * ret = static_cast<int8_t *>(addr);
+    Mapping & mapping = m_mappings[ret];
+    mapping.file = file;
+    mapping.length = length;
+    mapping.shared = shared;
+    return ret;
+}
+
+bool CopyOnWriteMemoryResource::is_clean(int8_t const * p, size_t length)
+{
+    // A page written in a private file mapping becomes anonymous, so it is
+    // clean if it is not present or is still a file page (bit 61 of
+    // /proc/self/pagemap).
+    int const fd = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return false;
+    }
+    size_t const page = NumaMemoryResource::page_size();
+    size_t const npage = length / page;
+    std::vector<uint64_t> entries(npage);
+    auto const offset = static_cast<off_t>(reinterpret_cast<uintptr_t>(p) / page * sizeof(uint64_t));
+    ssize_t const nread = pread(fd, entries.data(), npage * sizeof(uint64_t), offset);
+    close(fd);
+    if (nread != static_cast<ssize_t>(npage * sizeof(uint64_t)))
+    {
+        return false;
+    }
+    uint64_t const present = uint64_t(1) << 63;
+    uint64_t const swapped = uint64_t(1) << 62;
+    uint64_t const file_page = uint64_t(1) << 61;
+    return std::all_of(
+        entries.begin(),
+        entries.end(),
+        [&](uint64_t entry)
+        { return 0 == (entry & swapped) && (0 == (entry & present) || 0 != (entry & file_page)); });
+}
+
+int8_t * CopyOnWriteMemoryResource::do_allocate(size_t nbytes, size_t alignment)
+{
+    size_t const page = NumaMemoryResource::page_size();
+    if (alignment > page)
+    {
+        throw std::invalid_argument(Formatter() << "CopyOnWriteMemoryResource: alignment " << alignment
+                                                << " exceeds the page size " << page);
+    }
+    size_t const length = (nbytes + page - 1) / page * page;
+    int8_t * ret = map(create_file(length), length, /* shared */ true);
+    record_upstream_allocate(length);
+    return ret;
+}
+
+void CopyOnWriteMemoryResource::do_deallocate(int8_t * p, size_t, size_t)
+{
+    auto it = m_mappings.find(p);
+    size_t const length = it->second.length;
+    munmap(p, length);
+    m_mappings.erase(it);
+    record_upstream_deallocate(length);
+}
+
+int8_t * CopyOnWriteMemoryResource::do_clone(int8_t const * p, size_t, size_t)
+{
+    auto it = m_mappings.find(p);
+    if (it == m_mappings.end())
+    {
+        return nullptr;
+    }
+    // Copy the mapping because map() may rehash the table.
+    Mapping const source = it->second;
+    auto * source_ptr = const_cast<int8_t *>(p); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    std::shared_ptr<int> file = source.file;
+    if (source.shared)
+    {
+        // The file holds the content.  Remap the source privately at the same
+        // address so that its later writes do not reach the clone.
+        map(file, source.length, /* shared */ false, source_ptr);
+        ++m_shared_clone_count;
+    }
+    else if (is_clean(p, source.length))
+    {
+        ++m_shared_clone_count;
+    }
+    else
+    {
+        // The source has private pages.  Freeze its content in a new file and
+        // let the source map it too.
+        file = create_file(source.length);
+        size_t written = 0;
+        while (written < source.length)
+        {
+            ssize_t const ret = pwrite(*file, p + written, source.length - written, static_cast<off_t>(written));
+            if (ret < 0)
+            {
+                if (EINTR == errno)
+                {
+                    continue;
+                }
+                throw std::runtime_error(Formatter() << "CopyOnWriteMemoryResource: pwrite failed: " << std::strerror(errno));
+            }
+            written += static_cast<size_t>(ret);
+        }
+        map(file, source.length, /* shared */ false, source_ptr);
+        ++m_copied_clone_count;
+    }
+    int8_t * ret = map(file, source.length, /* shared */ false);
+    record_upstream_allocate(source.length);
+    return ret;
+}
+
+#else // __linux__
+
+int8_t * CopyOnWriteMemoryResource::do_allocate(size_t nbytes, size_t alignment)
+{
+    return upstream_allocate(nbytes, alignment);
+}
+
+void CopyOnWriteMemoryResource::do_deallocate(int8_t * p, size_t nbytes, size_t alignment)
+{
+    upstream_deallocate(p, nbytes, alignment);
+}
+
+int8_t * CopyOnWriteMemoryResource::do_clone(int8_t const *, size_t, size_t)
+{
+    return nullptr;
+}
+
+#endif // __linux__
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
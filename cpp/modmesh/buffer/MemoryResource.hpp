@@ -0,0 +1,430 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/base.hpp>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace modmesh
+{
+
+/**
+ * Counters kept by a MemoryResource.  The upstream counters record the
+ * requests that actually reach the system allocator.
+ */
+struct MemoryResourceStats
+{
+    size_t allocate_count = 0;
+    size_t deallocate_count = 0;
+    size_t bytes_in_use = 0;
+    size_t peak_bytes_in_use = 0;
+    size_t upstream_allocate_count = 0;
+    size_t upstream_deallocate_count = 0;
+    size_t upstream_bytes = 0;
+}; /* end struct MemoryResourceStats */
+
+/**
+ * The base class of the memory resources that ConcreteBuffer may allocate its
+ * data buffer from.  The public allocate() and deallocate() lock the resource
+ * and maintain the statistics; the derived classes implement do_allocate()
+ * and do_deallocate().
+ *
+ * A resource is always held by std::shared_ptr, so that the buffer allocated
+ * from it keeps it alive until the memory is returned.
+ */
+class MemoryResource
+    : public std::enable_shared_from_this<MemoryResource>
+{
+
+public:
+
+    MemoryResource() = default;
+    MemoryResource(MemoryResource const &) = delete;
+    MemoryResource(MemoryResource &&) = delete;
+    MemoryResource & operator=(MemoryResource const &) = delete;
+    MemoryResource & operator=(MemoryResource &&) = delete;
+    virtual ~MemoryResource() = default;
+
+    int8_t * allocate(size_t nbytes, size_t alignment);
+    void deallocate(int8_t * p, size_t nbytes, size_t alignment);
+    /**
+     * Make a copy of the block p allocated from this resource, to be returned
+     * by deallocate() like an allocated block.  Return nullptr if the
+     * resource does not support it; the caller then allocates and copies.
+     */
+    int8_t * clone(int8_t const * p, size_t nbytes, size_t alignment);
+
+    MemoryResourceStats stats() const;
+    void reset_stats();
+
+    virtual char const * name() const = 0;
+
+    /**
+     * The resource that ConcreteBuffer allocates from in the calling thread.
+     * A null pointer means the plain operator new[].
+     */
+    static std::shared_ptr<MemoryResource> const & get_current();
+    static void set_current(std::shared_ptr<MemoryResource> resource);
+
+protected:
+
+    virtual int8_t * do_allocate(size_t nbytes, size_t alignment) = 0;
+    virtual void do_deallocate(int8_t * p, size_t nbytes, size_t alignment) = 0;
+    virtual int8_t * do_clone(int8_t const * /* p */, size_t /* nbytes */, size_t /* alignment */) { return nullptr; }
+
+    /// Get memory from the system and record it in the upstream counters.
+    int8_t * upstream_allocate(size_t nbytes, size_t alignment);
+    /// Return memory to the system and record it in the upstream counters.
+    void upstream_deallocate(int8_t * p, size_t nbytes, size_t alignment);
+    /// Record the memory a derived class gets from the system by itself.
+    void record_upstream_allocate(size_t nbytes);
+    void record_upstream_deallocate(size_t nbytes);
+
+    // Both the public entry points and the derived-class hooks run with the
+    // mutex locked.
+    mutable std::mutex m_mutex;
+
+private:
+
+    MemoryResourceStats m_stats;
+
+}; /* end class MemoryResource */
+
+/**
+ * Forward every request to the system allocator.  It provides the same
+ * behavior as the default allocation but with the statistics.
+ */
+class SystemMemoryResource
+    : public MemoryResource
+{
+
+public:
+
+    static std::shared_ptr<SystemMemoryResource> construct() { return std::make_shared<SystemMemoryResource>(); }
+
+    char const * name() const override { return "SystemMemoryResource"; }
+
+protected:
+
+    int8_t * do_allocate(size_t nbytes, size_t alignment) override { return upstream_allocate(nbytes, alignment); }
+    void do_deallocate(int8_t * p, size_t nbytes, size_t alignment) override { upstream_deallocate(p, nbytes, alignment); }
+
+}; /* end class SystemMemoryResource */
+
+/**
+ * Cache the returned blocks in power-of-2 size classes and hand them out
+ * again for later requests of the same class.  Requests larger than
+ * max_block_size or aligned more strictly than BLOCK_ALIGNMENT bypass the pool.
+ */
+class PoolMemoryResource
+    : public MemoryResource
+{
+
+public:
+
+    static constexpr size_t MIN_BLOCK_SIZE = 64;
+    static constexpr size_t BLOCK_ALIGNMENT = 64;
+    static constexpr size_t DEFAULT_MAX_BLOCK_SIZE = size_t(1) << 28; // 256 MiB
+
+    static std::shared_ptr<PoolMemoryResource> construct(size_t max_block_size = DEFAULT_MAX_BLOCK_SIZE)
+    {
+        return std::make_shared<PoolMemoryResource>(max_block_size);
+    }
+
+    /**
+     * The pool owned by the calling thread.  It is created on first use and
+     * outlives the thread as long as any buffer allocated from it is alive.
+     */
+    static std::shared_ptr<PoolMemoryResource> const & thread_local_instance();
+
+    explicit PoolMemoryResource(size_t max_block_size);
+    PoolMemoryResource(PoolMemoryResource const &) = delete;
+    PoolMemoryResource(PoolMemoryResource &&) = delete;
+    PoolMemoryResource & operator=(PoolMemoryResource const &) = delete;
+    PoolMemoryResource & operator=(PoolMemoryResource &&) = delete;
+    ~PoolMemoryResource() override;
+
+    char const * name() const override { return "PoolMemoryResource"; }
+
+    size_t max_block_size() const { return m_max_block_size; }
+    /// Number of bytes held in the free lists.
+    size_t cached_bytes() const;
+    /// Return all cached blocks to the system.
+    void release();
+
+    static size_t block_size(size_t nbytes);
+
+protected:
+
+    int8_t * do_allocate(size_t nbytes, size_t alignment) override;
+    void do_deallocate(int8_t * p, size_t nbytes, size_t alignment) override;
+
+private:
+
+    bool is_pooled(size_t nbytes, size_t alignment) const
+    {
+        return nbytes <= m_max_block_size && alignment <= BLOCK_ALIGNMENT;
+    }
+
+    static size_t size_class(size_t nbytes);
+
+    void release_locked();
+
+    size_t m_max_block_size;
+    std::vector<std::vector<int8_t *>> m_free_lists;
+
+}; /* end class PoolMemoryResource */
+
+/**
+ * Bump-pointer arena.  Allocation advances an offset in the current chunk and
+ * deallocation only counts the live blocks.  reset() rewinds the arena for
+ * reuse once all the blocks are returned, e.g., at the end of a time step.
+ */
+class ArenaMemoryResource
+    : public MemoryResource
+{
+
+public:
+
+    static constexpr size_t DEFAULT_CHUNK_SIZE = size_t(1) << 20; // 1 MiB
+    static constexpr size_t MIN_ALIGNMENT = 16;
+
+    static std::shared_ptr<ArenaMemoryResource> construct(size_t chunk_size = DEFAULT_CHUNK_SIZE)
+    {
+        return std::make_shared<ArenaMemoryResource>(chunk_size);
+    }
+
+    explicit ArenaMemoryResource(size_t chunk_size);
+    ArenaMemoryResource(ArenaMemoryResource const &) = delete;
+    ArenaMemoryResource(ArenaMemoryResource &&) = delete;
+    ArenaMemoryResource & operator=(ArenaMemoryResource const &) = delete;
+    ArenaMemoryResource & operator=(ArenaMemoryResource &&) = delete;
+    ~ArenaMemoryResource() override;
+
+    char const * name() const override { return "ArenaMemoryResource"; }
+
+    size_t chunk_size() const { return m_chunk_size; }
+    size_t nchunk() const;
+    size_t live_count() const;
+
+    /// Rewind the arena.  Throw if any block is still alive.
+    void reset();
+    /// Return all the chunks to the system.  Throw if any block is still alive.
+    void release();
+
+protected:
+
+    int8_t * do_allocate(size_t nbytes, size_t alignment) override;
+    void do_deallocate(int8_t * p, size_t nbytes, size_t alignment) override;
+
+private:
+
+    struct Chunk
+    {
+        int8_t * data = nullptr;
+        size_t nbytes = 0;
+        size_t alignment = 0;
+    }; /* end struct Chunk */
+
+    void check_no_live(char const * action) const;
+
+    size_t m_chunk_size;
+    std::vector<Chunk> m_chunks;
+    size_t m_current = 0; ///< Index of the chunk being bumped.
+    size_t m_offset = 0; ///< Offset in the current chunk.
+    size_t m_live_count = 0;
+
+}; /* end class ArenaMemoryResource */
+
+/**
+ * Place the pages of the buffers on NUMA nodes.  The memory is mapped from
+ * the system page by page and one of the policies applies:
+ *
+ *  - FirstTouch: the pages are touched by the ThreadPool with the chunk
+ *    partitioning of the 8-byte element loops, so each page lands on the node
+ *    of a thread that processes it.  Without the pool the pages land on the
+ *    node of the first writer.
+ *  - Interleave: the pages are spread round-robin over all the nodes.
+ *  - Bind: the pages are placed on the given node.
+ *
+ * Interleave and Bind are supported on Linux only.  Set the resource as the
+ * current one to apply the policy to all the arrays allocated afterwards
+ * (including those of StaticMesh), or pass it to ConcreteBuffer::construct()
+ * for a single buffer.
+ */
+class NumaMemoryResource
+    : public MemoryResource
+{
+
+public:
+
+    enum class Policy
+    {
+        FirstTouch,
+        Interleave,
+        Bind,
+    }; /* end enum class Policy */
+
+    static std::shared_ptr<NumaMemoryResource> construct(Policy policy, size_t node = 0)
+    {
+        return std::make_shared<NumaMemoryResource>(policy, node);
+    }
+
+    NumaMemoryResource(Policy policy, size_t node);
+
+    char const * name() const override { return "NumaMemoryResource"; }
+
+    Policy policy() const { return m_policy; }
+    /// The node the Bind policy places the pages on.
+    size_t node() const { return m_node; }
+
+    /// Number of NUMA nodes of the system.  It is 1 when unknown.
+    static size_t node_count();
+    static size_t page_size();
+    static bool is_supported(Policy policy);
+
+    static Policy policy_from_string(std::string const & value);
+    static char const * to_string(Policy policy);
+
+protected:
+
+    int8_t * do_allocate(size_t nbytes, size_t alignment) override;
+    void do_deallocate(int8_t * p, size_t nbytes, size_t alignment) override;
+
+private:
+
+    size_t mapped_size(size_t nbytes) const;
+    void first_touch(int8_t * p, size_t nbytes) const;
+
+    Policy m_policy;
+    size_t m_node;
+
+}; /* end class NumaMemoryResource */
+
+/**
+ * Make ConcreteBuffer::clone() (and thus the copy of SimpleArray and of the
+ * solvers holding them) copy on write.  Each block is a file in memory
+ * (memfd) mapped into the process.  A clone maps the same file privately, so
+ * the clone and the source share the pages until one of them writes a page,
+ * and the kernel copies only the page being written.
+ *
+ * A block that has been written since it was last shared cannot share the
+ * file anymore; cloning it writes its content to a new file first, which
+ * costs a copy.  Repeated clones of an unmodified block are free.
+ *
+ * Copy on write is supported on Linux only.  On the other platforms the
+ * resource allocates from the system and clone() copies.
+ */
+class CopyOnWriteMemoryResource
+    : public MemoryResource
+{
+
+public:
+
+    static std::shared_ptr<CopyOnWriteMemoryResource> construct() { return std::make_shared<CopyOnWriteMemoryResource>(); }
+
+    CopyOnWriteMemoryResource() = default;
+    CopyOnWriteMemoryResource(CopyOnWriteMemoryResource const &) = delete;
+    CopyOnWriteMemoryResource(CopyOnWriteMemoryResource &&) = delete;
+    CopyOnWriteMemoryResource & operator=(CopyOnWriteMemoryResource const &) = delete;
+    CopyOnWriteMemoryResource & operator=(CopyOnWriteMemoryResource &&) = delete;
+    ~CopyOnWriteMemoryResource() override = default;
+
+    char const * name() const override { return "CopyOnWriteMemoryResource"; }
+
+    static bool is_supported();
+
+    /// Number of clones that shared the file of the source without copying.
+    size_t shared_clone_count() const;
+    /// Number of clones that had to write the source to a new file.
+    size_t copied_clone_count() const;
+
+protected:
+
+    int8_t * do_allocate(size_t nbytes, size_t alignment) override;
+    void do_deallocate(int8_t * p, size_t nbytes, size_t alignment) override;
+    int8_t * do_clone(int8_t const * p, size_t nbytes, size_t alignment) override;
+
+private:
+
+    struct Mapping
+    {
+        /// The file descriptor shared by all the blocks mapping the file.
+        std::shared_ptr<int> file;
+        size_t length = 0;
+        /// True if the block is the only mapping of the file and writes to it.
+        bool shared = false;
+    }; /* end struct Mapping */
+
+    std::shared_ptr<int> create_file(size_t length) const;
+    int8_t * map(std::shared_ptr<int> const & file, size_t length, bool shared, int8_t * fixed = nullptr);
+    static bool is_clean(int8_t const * p, size_t length);
+
+    std::unordered_map<int8_t const *, Mapping> m_mappings;
+    size_t m_shared_clone_count = 0;
+    size_t m_copied_clone_count = 0;
+
+}; /* end class CopyOnWriteMemoryResource */
+
+/**
+ * Switch the current memory resource of the calling thread for the lifetime
+ * of the object.
+ */
+class MemoryResourceScope
+{
+
+public:
+
+    explicit MemoryResourceScope(std::shared_ptr<MemoryResource> resource)
+        : m_previous(MemoryResource::get_current())
+    {
+        MemoryResource::set_current(std::move(resource));
+    }
+
+    MemoryResourceScope(MemoryResourceScope const &) = delete;
+    MemoryResourceScope(MemoryResourceScope &&) = delete;
+    MemoryResourceScope & operator=(MemoryResourceScope const &) = delete;
+    MemoryResourceScope & operator=(MemoryResourceScope &&) = delete;
+
+    ~MemoryResourceScope() { MemoryResource::set_current(std::move(m_previous)); }
+
+private:
+
+    std::shared_ptr<MemoryResource> m_previous;
+
+}; /* end class MemoryResourceScope */
+
+} /* end namespace modmesh */
+
+/* vim: set et ts=4 sw=4: */
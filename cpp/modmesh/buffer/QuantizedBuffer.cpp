@@ -0,0 +1,477 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/QuantizedBuffer.hpp>
+#include <modmesh/buffer/CompressedBuffer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+namespace
+{
+
+// Keep the predicted integers and the residuals inside int64_t.
+constexpr double QUANTIZED_LIMIT = 1152921504606846976.0; // 2^60
+constexpr int64_t QUANTIZED_RESIDUAL_LIMIT = int64_t(1) << 30;
+
+/// The integer of the value, or 0 when it does not fit.
+inline int64_t quantize(double x, double inverse_step)
+{
+    double const scaled = std::nearbyint(x * inverse_step);
+    return (std::isfinite(scaled) && std::fabs(scaled) < QUANTIZED_LIMIT) ? static_cast<int64_t>(scaled) : 0;
+}
+
+template <typename T>
+inline T dequantize(int64_t k, double step)
+{
+    return static_cast<T>(static_cast<double>(k) * step);
+}
+
+/// Extrapolate linearly from the previous two rows, or take the previous value in the first row.
+inline int64_t predict(int64_t const * k, size_t i, size_t stride)
+{
+    if (i >= 2 * stride)
+    {
+        return 2 * k[i - stride] - k[i - 2 * stride];
+    }
+    if (i >= stride)
+    {
+        return k[i - stride];
+    }
+    return 0 == i ? 0 : k[i - 1];
+}
+
+// Code 0 marks an outlier, and the others are the zigzag residuals plus 1.
+inline uint32_t encode_residual(int64_t r) { return static_cast<uint32_t>(r < 0 ? -2 * r - 1 : 2 * r) + 1; }
+inline int64_t decode_residual(uint32_t code)
+{
+    uint32_t const z = code - 1;
+    return (z & 1) ? -static_cast<int64_t>(z >> 1) - 1 : static_cast<int64_t>(z >> 1);
+}
+
+inline uint8_t bit_width(uint32_t value)
+{
+    uint8_t ret = 0;
+    for (; value; value >>= 1)
+    {
+        ++ret;
+    }
+    return ret;
+}
+
+/// Append the codes in groups of a width byte followed by the bits.
+void pack_codes(uint32_t const * codes, size_t ncode, std::vector<int8_t> & out)
+{
+    for (size_t begin = 0; begin < ncode; begin += QuantizedBuffer::GROUP_SIZE)
+    {
+        size_t const end = std::min(begin + QuantizedBuffer::GROUP_SIZE, ncode);
+        uint32_t largest = 0;
+        for (size_t i = begin; i < end; ++i)
+        {
+            largest = std::max(largest, codes[i]);
+        }
+        uint8_t const width = bit_width(largest);
+        out.push_back(static_cast<int8_t>(width));
+        uint64_t acc = 0;
+        size_t nbit = 0;
+        for (size_t i = begin; i < end && width; ++i)
+        {
+            acc |= static_cast<uint64_t>(codes[i]) << nbit;
+            nbit += width;
+            for (; nbit >= 8; nbit -= 8, acc >>= 8)
+            {
+                out.push_back(static_cast<int8_t>(acc & 0xff));
+            }
+        }
+        if (nbit)
+        {
+            out.push_back(static_cast<int8_t>(acc & 0xff));
+        }
+    }
+}
+
+/// Undo pack_codes() and return the number of bytes read.
+size_t unpack_codes(int8_t const * src_in, size_t nbytes, uint32_t * codes, size_t ncode)
+{
+    auto const * src = reinterpret_cast<uint8_t const *>(src_in);
+    size_t ip = 0;
+    for (size_t begin = 0; begin < ncode; begin += QuantizedBuffer::GROUP_SIZE)
+    {
+        size_t const end = std::min(begin + QuantizedBuffer::GROUP_SIZE, ncode);
+        if (ip >= nbytes || src[ip] > 32)
+        {
+            throw std::runtime_error("QuantizedBuffer: corrupt block (bad group width)");
+        }
+        uint8_t const width = src[ip++];
+        if ((width * (end - begin) + 7) / 8 > nbytes - ip)
+        {
+            throw std::runtime_error("QuantizedBuffer: corrupt block (truncated group)");
+        }
+        uint64_t const mask = (uint64_t(1) << width) - 1;
+        uint64_t acc = 0;
+        size_t nbit = 0;
+        for (size_t i = begin; i < end; ++i)
+        {
+            for (; nbit < width; nbit += 8)
+            {
+                acc |= static_cast<uint64_t>(src[ip++]) << nbit;
+            }
+            codes[i] = static_cast<uint32_t>(acc & mask);
+            acc >>= width;
+            nbit -= width;
+        }
+    }
+    return ip;
+}
+
+struct QuantizedHeader
+{
+    char magic[8]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    uint64_t element_size;
+    uint64_t nelem;
+    uint64_t stride;
+    double tolerance;
+    uint64_t block_size;
+    uint64_t nghost;
+    uint64_t ndim;
+    uint64_t nblock;
+}; /* end struct QuantizedHeader */
+
+struct QuantizedBlockEntry
+{
+    uint64_t nbytes;
+    uint64_t payload_nbytes;
+    uint64_t noutlier;
+    uint64_t compressed;
+}; /* end struct QuantizedBlockEntry */
+
+constexpr char QUANTIZED_MAGIC[8] = {'M', 'M', 'Q', 'N', 'T', 'Z', '\0', '\0'}; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+
+} /* end namespace */
+
+} /* end namespace detail */
+
+template <typename T>
+std::shared_ptr<QuantizedBuffer> QuantizedBuffer::compress(
+    T const * data, size_t nelem, size_t stride, double tolerance, size_t block_size, bool parallel)
+{
+    if (!(tolerance > 0.0) || !std::isfinite(tolerance))
+    {
+        throw std::invalid_argument(Formatter() << "QuantizedBuffer: tolerance " << tolerance << " must be positive");
+    }
+    if (0 == stride)
+    {
+        throw std::invalid_argument("QuantizedBuffer: stride must be positive");
+    }
+    // A block holds whole rows.
+    block_size = std::max(block_size / stride, size_t(1)) * stride;
+
+    std::shared_ptr<QuantizedBuffer> ret = std::make_shared<QuantizedBuffer>(nelem, sizeof(T), stride, tolerance, block_size, ctor_passkey());
+    double const step = 2.0 * tolerance;
+    double const inverse_step = 1.0 / step;
+    size_t const nblock = (nelem + block_size - 1) / block_size;
+    ret->m_blocks.resize(nblock);
+    std::vector<std::vector<int8_t>> packed(nblock);
+    auto body = [&](size_t iblock)
+    {
+        size_t const n = ret->block_nelem(iblock);
+        T const * src = data + iblock * block_size;
+        std::vector<int64_t> k(n);
+        std::vector<uint32_t> codes(n);
+        std::vector<T> outliers;
+        for (size_t i = 0; i < n; ++i)
+        {
+            int64_t const pred = detail::predict(k.data(), i, stride);
+            double const x = static_cast<double>(src[i]);
+            int64_t const ki = detail::quantize(x, inverse_step);
+            int64_t const r = ki - pred;
+            if (r > -detail::QUANTIZED_RESIDUAL_LIMIT && r < detail::QUANTIZED_RESIDUAL_LIMIT
+                && std::fabs(static_cast<double>(detail::dequantize<T>(ki, step)) - x) <= tolerance)
+            {
+                codes[i] = detail::encode_residual(r);
+            }
+            else
+            {
+                codes[i] = 0;
+                outliers.push_back(src[i]);
+            }
+            k[i] = ki;
+        }
+        std::vector<int8_t> payload;
+        payload.reserve(n / 4 + n / GROUP_SIZE + 1 + outliers.size() * sizeof(T));
+        detail::pack_codes(codes.data(), n, payload);
+        size_t const ncode_bytes = payload.size();
+        payload.resize(ncode_bytes + outliers.size() * sizeof(T));
+        if (!outliers.empty())
+        {
+            std::memcpy(payload.data() + ncode_bytes, outliers.data(), outliers.size() * sizeof(T));
+        }
+
+        Block & block = ret->m_blocks[iblock];
+        block.payload_nbytes = payload.size();
+        block.noutlier = outliers.size();
+        std::vector<int8_t> & out = packed[iblock];
+        out.resize(payload.size());
+        // Keep the LZ4 block only when it is smaller.
+        size_t const ncompressed = payload.size() > 1 ? detail::lz4_compress(payload.data(), payload.size(), out.data(), payload.size() - 1) : 0;
+        block.compressed = 0 != ncompressed;
+        if (block.compressed)
+        {
+            out.resize(ncompressed);
+        }
+        else
+        {
+            out.swap(payload);
+        }
+        block.nbytes = out.size();
+    };
+    if (parallel && nblock > 1)
+    {
+        ThreadPool::instance().run(nblock, body);
+    }
+    else
+    {
+        for (size_t iblock = 0; iblock < nblock; ++iblock)
+        {
+            body(iblock);
+        }
+    }
+
+    size_t offset = 0;
+    for (Block & block : ret->m_blocks)
+    {
+        block.offset = offset;
+        offset += block.nbytes;
+    }
+    ret->m_storage = ConcreteBuffer::construct(offset);
+    for (size_t iblock = 0; iblock < nblock; ++iblock)
+    {
+        std::memcpy(ret->m_storage->data() + ret->m_blocks[iblock].offset, packed[iblock].data(), packed[iblock].size());
+    }
+    return ret;
+}
+
+template <typename T>
+void QuantizedBuffer::check_type() const
+{
+    if (sizeof(T) != m_element_size)
+    {
+        throw std::invalid_argument(Formatter() << "QuantizedBuffer: element size " << m_element_size
+                                                << " differs from the array item size " << sizeof(T));
+    }
+}
+
+template <typename T>
+void QuantizedBuffer::decompress_into(T * dst, bool parallel) const
+{
+    check_type<T>();
+    double const step = 2.0 * m_tolerance;
+    double const inverse_step = 1.0 / step;
+    auto body = [&](size_t iblock)
+    {
+        Block const & block = m_blocks[iblock];
+        size_t const n = block_nelem(iblock);
+        int8_t const * stored = m_storage->data() + block.offset;
+        std::vector<int8_t> payload;
+        if (block.compressed)
+        {
+            payload.resize(block.payload_nbytes);
+            detail::lz4_decompress(stored, block.nbytes, payload.data(), payload.size());
+            stored = payload.data();
+        }
+        std::vector<uint32_t> codes(n);
+        size_t const ncode_bytes = detail::unpack_codes(stored, block.payload_nbytes, codes.data(), n);
+        if (block.payload_nbytes - ncode_bytes != block.noutlier * sizeof(T))
+        {
+            throw std::runtime_error(Formatter() << "QuantizedBuffer: corrupt block " << iblock << " (outliers do not match)");
+        }
+        int8_t const * outliers = stored + ncode_bytes;
+        size_t ioutlier = 0;
+        std::vector<int64_t> k(n);
+        T * out = dst + iblock * m_block_size;
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (0 == codes[i])
+            {
+                if (ioutlier >= block.noutlier)
+                {
+                    throw std::runtime_error(Formatter() << "QuantizedBuffer: corrupt block " << iblock << " (too many outliers)");
+                }
+                T value;
+                std::memcpy(&value, outliers + ioutlier * sizeof(T), sizeof(T));
+                ++ioutlier;
+                out[i] = value;
+                k[i] = detail::quantize(static_cast<double>(value), inverse_step);
+            }
+            else
+            {
+                k[i] = detail::predict(k.data(), i, m_stride) + detail::decode_residual(codes[i]);
+                out[i] = detail::dequantize<T>(k[i], step);
+            }
+        }
+    };
+    if (parallel && m_blocks.size() > 1)
+    {
+        ThreadPool::instance().run(m_blocks.size(), body);
+    }
+    else
+    {
+        for (size_t iblock = 0; iblock < m_blocks.size(); ++iblock)
+        {
+            body(iblock);
+        }
+    }
+}
+
+size_t QuantizedBuffer::noutlier() const
+{
+    size_t ret = 0;
+    for (Block const & block : m_blocks)
+    {
+        ret += block.noutlier;
+    }
+    return ret;
+}
+
+size_t QuantizedBuffer::serialized_nbytes() const
+{
+    return sizeof(detail::QuantizedHeader) + m_shape.size() * sizeof(uint64_t)
+           + m_blocks.size() * sizeof(detail::QuantizedBlockEntry) + compressed_nbytes();
+}
+
+void QuantizedBuffer::serialize(int8_t * dst) const
+{
+    detail::QuantizedHeader header{};
+    std::memcpy(header.magic, detail::QUANTIZED_MAGIC, sizeof(header.magic));
+    header.element_size = m_element_size;
+    header.nelem = m_nelem;
+    header.stride = m_stride;
+    header.tolerance = m_tolerance;
+    header.block_size = m_block_size;
+    header.nghost = m_nghost;
+    header.ndim = m_shape.size();
+    header.nblock = m_blocks.size();
+    std::memcpy(dst, &header, sizeof(header));
+    dst += sizeof(header);
+    for (size_t const extent : m_shape)
+    {
+        uint64_t const value = extent;
+        std::memcpy(dst, &value, sizeof(value));
+        dst += sizeof(value);
+    }
+    for (Block const & block : m_blocks)
+    {
+        detail::QuantizedBlockEntry const entry{block.nbytes, block.payload_nbytes, block.noutlier, block.compressed ? 1U : 0U};
+        std::memcpy(dst, &entry, sizeof(entry));
+        dst += sizeof(entry);
+    }
+    if (m_storage)
+    {
+        std::memcpy(dst, m_storage->data(), m_storage->nbytes());
+    }
+}
+
+std::shared_ptr<QuantizedBuffer> QuantizedBuffer::deserialize(int8_t const * src, size_t nbytes)
+{
+    detail::QuantizedHeader header{};
+    if (nbytes < sizeof(header))
+    {
+        throw std::runtime_error("QuantizedBuffer: corrupt data (truncated header)");
+    }
+    std::memcpy(&header, src, sizeof(header));
+    if (0 != std::memcmp(header.magic, detail::QUANTIZED_MAGIC, sizeof(header.magic)))
+    {
+        throw std::runtime_error("QuantizedBuffer: corrupt data (bad magic)");
+    }
+    if ((4 != header.element_size && 8 != header.element_size) || 0 == header.stride || 0 == header.block_size
+        || header.ndim > 64 || !(header.tolerance > 0.0)
+        || header.nblock != (header.nelem + header.block_size - 1) / header.block_size)
+    {
+        throw std::runtime_error("QuantizedBuffer: corrupt data (bad header)");
+    }
+    size_t const nmeta = sizeof(header) + header.ndim * sizeof(uint64_t) + header.nblock * sizeof(detail::QuantizedBlockEntry);
+    if (nbytes < nmeta)
+    {
+        throw std::runtime_error("QuantizedBuffer: corrupt data (truncated layout)");
+    }
+    std::shared_ptr<QuantizedBuffer> ret = std::make_shared<QuantizedBuffer>(
+        header.nelem, header.element_size, header.stride, header.tolerance, header.block_size, ctor_passkey());
+    src += sizeof(header);
+    ret->m_shape = shape_type(header.ndim);
+    size_t nelem = 1;
+    for (size_t it = 0; it < header.ndim; ++it)
+    {
+        uint64_t value;
+        std::memcpy(&value, src, sizeof(value));
+        src += sizeof(value);
+        ret->m_shape[it] = value;
+        nelem *= value;
+    }
+    if (nelem != header.nelem || (header.ndim && header.nghost > ret->m_shape[0]))
+    {
+        throw std::runtime_error("QuantizedBuffer: corrupt data (bad shape)");
+    }
+    ret->m_nghost = header.nghost;
+    ret->m_blocks.resize(header.nblock);
+    size_t offset = 0;
+    for (Block & block : ret->m_blocks)
+    {
+        detail::QuantizedBlockEntry entry;
+        std::memcpy(&entry, src, sizeof(entry));
+        src += sizeof(entry);
+        block = Block{offset, entry.nbytes, entry.payload_nbytes, entry.noutlier, 0 != entry.compressed};
+        if (!block.compressed && block.nbytes != block.payload_nbytes)
+        {
+            throw std::runtime_error("QuantizedBuffer: corrupt data (bad block)");
+        }
+        offset += block.nbytes;
+    }
+    if (nbytes - nmeta != offset)
+    {
+        throw std::runtime_error(Formatter() << "QuantizedBuffer: corrupt data (" << nbytes - nmeta << " bytes of blocks, " << offset << " expected)");
+    }
+    ret->m_storage = ConcreteBuffer::construct(offset);
+    std::memcpy(ret->m_storage->data(), src, offset);
+    return ret;
+}
+
+template std::shared_ptr<QuantizedBuffer> QuantizedBuffer::compress<float>(float const *, size_t, size_t, double, size_t, bool);
+template std::shared_ptr<QuantizedBuffer> QuantizedBuffer::compress<double>(double const *, size_t, size_t, double, size_t, bool);
+template void QuantizedBuffer::decompress_into<float>(float *, bool) const;
+template void QuantizedBuffer::decompress_into<double>(double *, bool) const;
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,197 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Error-bounded lossy compression of floating-point arrays for archival
+ * output, e.g., the history of a field.
+ *
+ * Each value x is quantized to the integer k = round(x / (2 * tolerance)),
+ * so that k * 2 * tolerance is within the tolerance of x.  The integers are
+ * predicted from those of the previous two rows (linear extrapolation), and
+ * the residuals are packed in groups of GROUP_SIZE with the bit width of the
+ * largest one, and then compressed in the LZ4 block format.  A value that
+ * does not meet the tolerance after the quantization, e.g., infinity or NaN,
+ * is stored as is.  The blocks of rows are independent and compressed and
+ * decompressed in parallel with the ThreadPool.
+ */
+
+#include <modmesh/buffer/ConcreteBuffer.hpp>
+#include <modmesh/buffer/SimpleArray.hpp>
+#include <modmesh/buffer/ThreadPool.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace modmesh
+{
+
+class QuantizedBuffer
+    : public std::enable_shared_from_this<QuantizedBuffer>
+{
+
+private:
+
+    struct ctor_passkey
+    {
+    };
+
+public:
+
+    using shape_type = detail::shape_type;
+
+    /// Elements per block, rounded down to whole rows.
+    static constexpr size_t DEFAULT_BLOCK_SIZE = size_t(1) << 16;
+    /// Residuals sharing a bit width.
+    static constexpr size_t GROUP_SIZE = 64;
+
+    struct Block
+    {
+        size_t offset; // in the compressed storage
+        size_t nbytes; // stored bytes
+        size_t payload_nbytes; // packed bytes before LZ4
+        size_t noutlier; // values stored as is
+        bool compressed; // false when the packed bytes are stored as is
+    }; /* end struct Block */
+
+    /**
+     * Compress nelem values in rows of stride values.  The shape is that of
+     * a 1D array of the values.  T is float or double.
+     */
+    template <typename T>
+    static std::shared_ptr<QuantizedBuffer> compress(
+        T const * data, size_t nelem, size_t stride, double tolerance, size_t block_size, bool parallel);
+
+    /// Compress the whole buffer of the array by its rows and keep its shape and ghost count.
+    template <typename T>
+    static std::shared_ptr<QuantizedBuffer> compress(SimpleArray<T> const & array, double tolerance, size_t block_size, bool parallel)
+    {
+        size_t const stride = (array.ndim() < 2 || 0 == array.shape(0)) ? 1 : array.size() / array.shape(0);
+        std::shared_ptr<QuantizedBuffer> ret = compress(array.data(), array.size(), std::max(stride, size_t(1)), tolerance, block_size, parallel);
+        ret->m_shape = array.shape();
+        ret->m_nghost = array.nghost();
+        return ret;
+    }
+
+    template <typename T>
+    static std::shared_ptr<QuantizedBuffer> compress(SimpleArray<T> const & array, double tolerance)
+    {
+        return compress(array, tolerance, DEFAULT_BLOCK_SIZE, ThreadPool::instance().use_parallel(array.size()));
+    }
+
+    QuantizedBuffer(size_t nelem, size_t element_size, size_t stride, double tolerance, size_t block_size, ctor_passkey const &)
+        : m_nelem(nelem)
+        , m_element_size(element_size)
+        , m_stride(stride)
+        , m_tolerance(tolerance)
+        , m_block_size(block_size)
+        , m_shape{nelem}
+    {
+    }
+
+    QuantizedBuffer() = delete;
+    QuantizedBuffer(QuantizedBuffer const &) = delete;
+    QuantizedBuffer(QuantizedBuffer &&) = delete;
+    QuantizedBuffer & operator=(QuantizedBuffer const &) = delete;
+    QuantizedBuffer & operator=(QuantizedBuffer &&) = delete;
+    ~QuantizedBuffer() = default;
+
+    size_t nelem() const noexcept { return m_nelem; }
+    /// Number of the uncompressed bytes.
+    size_t nbytes() const noexcept { return m_nelem * m_element_size; }
+    /// Number of the bytes of the compressed storage.
+    size_t compressed_nbytes() const noexcept { return m_storage ? m_storage->nbytes() : 0; }
+    /// Uncompressed bytes over the compressed bytes.
+    double ratio() const
+    {
+        return 0 == compressed_nbytes() ? 1.0 : static_cast<double>(nbytes()) / static_cast<double>(compressed_nbytes());
+    }
+    size_t element_size() const noexcept { return m_element_size; }
+    size_t stride() const noexcept { return m_stride; }
+    /// The largest absolute error of a decompressed value.
+    double tolerance() const noexcept { return m_tolerance; }
+    size_t block_size() const noexcept { return m_block_size; }
+    size_t nblock() const noexcept { return m_blocks.size(); }
+    Block const & block(size_t iblock) const { return m_blocks.at(iblock); }
+    /// Number of the values stored as is.
+    size_t noutlier() const;
+    shape_type const & shape() const noexcept { return m_shape; }
+    size_t nghost() const noexcept { return m_nghost; }
+
+    /// Decompress all the blocks into dst, which holds at least nelem() values.
+    template <typename T>
+    void decompress_into(T * dst, bool parallel) const;
+
+    /// Decompress into a new array of the recorded shape and ghost count.
+    template <typename T>
+    SimpleArray<T> decompress_array(bool parallel) const
+    {
+        SimpleArray<T> ret(m_shape, SimpleArrayUninitialized{});
+        decompress_into(ret.data(), parallel);
+        ret.set_nghost(m_nghost);
+        return ret;
+    }
+
+    template <typename T>
+    SimpleArray<T> decompress_array() const
+    {
+        return decompress_array<T>(ThreadPool::instance().use_parallel(m_nelem));
+    }
+
+    /// Number of the bytes written by serialize().
+    size_t serialized_nbytes() const;
+    /// Write the compressed data and the layout to dst for deserialize().
+    void serialize(int8_t * dst) const;
+    /// Throw std::runtime_error for corrupt input.
+    static std::shared_ptr<QuantizedBuffer> deserialize(int8_t const * src, size_t nbytes);
+
+private:
+
+    size_t block_nelem(size_t iblock) const { return std::min(m_block_size, m_nelem - iblock * m_block_size); }
+
+    template <typename T>
+    void check_type() const;
+
+    size_t m_nelem = 0;
+    size_t m_element_size = 8;
+    size_t m_stride = 1;
+    double m_tolerance = 0.0;
+    size_t m_block_size = DEFAULT_BLOCK_SIZE;
+    shape_type m_shape;
+    size_t m_nghost = 0;
+    std::vector<Block> m_blocks;
+    std::shared_ptr<ConcreteBuffer> m_storage;
+
+}; /* end class QuantizedBuffer */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
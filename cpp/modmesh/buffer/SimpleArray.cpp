@@ -51,7 +51,7 @@ DataType get_data_type_from_string(const std::string & data_type_string)
     }
     if (data_type_string == "int64")
     {
-        return DataType::Uint64;
+        return DataType::Int64;
     }
     if (data_type_string == "uint8")
     {
@@ -77,9 +77,42 @@ DataType get_data_type_from_string(const std::string & data_type_string)
     {
         return DataType::Float64;
     }
+    if (data_type_string == "float16")
+    {
+        return DataType::Float16;
+    }
+    if (data_type_string == "bfloat16")
+    {
+        return DataType::BFloat16;
+    }
     throw std::runtime_error("Unsupported datatype");
 }
 
+std::string const & get_string_from_data_type(DataType data_type)
+{
+    static std::array<std::string, 14> const names = {
+        "undefined",
+        "bool",
+        "int8",
+        "int16",
+        "int32",
+        "int64",
+        "uint8",
+        "uint16",
+        "uint32",
+        "uint64",
+        "float32",
+        "float64",
+        "float16",
+        "bfloat16"};
+    size_t const index = static_cast<size_t>(data_type);
+    if (index >= names.size())
+    {
+        throw std::runtime_error("Unsupported datatype");
+    }
+    return names[index];
+}
+
 template <>
 DataType get_data_type_from_type<bool>()
 {
@@ -146,373 +179,101 @@ DataType get_data_type_from_type<double>()
     return DataType::Float64;
 }
 
-// According to the `DataType`, create the corresponding `SimpleArray<T>` instance
-// and assign it to `m_instance_ptr`. The `m_instance_ptr` is a void pointer, so
-// we need to use `reinterpret_cast` to convert the pointer of the array instance.
-#define MM_DECL_CREATE_SIMPLE_ARRAY(DataType, ArrayType, ...)                  \
-    case DataType:                                                             \
-        /* NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) */      \
-        m_instance_ptr = reinterpret_cast<void *>(new ArrayType(__VA_ARGS__)); \
-        break;
-
-SimpleArrayPlex::SimpleArrayPlex(const shape_type & shape, const DataType data_type)
-    : m_data_type(data_type)
-    , m_has_instance_ownership(true)
+template <>
+DataType get_data_type_from_type<Float16>()
 {
-    switch (data_type)
-    {
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Bool, SimpleArrayBool, shape)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Int8, SimpleArrayInt8, shape)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Int16, SimpleArrayInt16, shape)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Int32, SimpleArrayInt32, shape)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Int64, SimpleArrayInt64, shape)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Uint8, SimpleArrayUint8, shape)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Uint16, SimpleArrayUint16, shape)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Uint32, SimpleArrayUint32, shape)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Uint64, SimpleArrayUint64, shape)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Float32, SimpleArrayFloat32, shape)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Float64, SimpleArrayFloat64, shape)
-    default:
-        throw std::runtime_error("Unsupported datatype");
-    }
+    return DataType::Float16;
 }
 
-SimpleArrayPlex::SimpleArrayPlex(const shape_type & shape, const std::shared_ptr<ConcreteBuffer> & buffer, const DataType data_type)
-    : m_data_type(data_type)
-    , m_has_instance_ownership(true)
+template <>
+DataType get_data_type_from_type<BFloat16>()
 {
-    switch (data_type)
-    {
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Bool, SimpleArrayBool, shape, buffer)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Int8, SimpleArrayInt8, shape, buffer)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Int16, SimpleArrayInt16, shape, buffer)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Int32, SimpleArrayInt32, shape, buffer)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Int64, SimpleArrayInt64, shape, buffer)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Uint8, SimpleArrayUint8, shape, buffer)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Uint16, SimpleArrayUint16, shape, buffer)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Uint32, SimpleArrayUint32, shape, buffer)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Uint64, SimpleArrayUint64, shape, buffer)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Float32, SimpleArrayFloat32, shape, buffer)
-        MM_DECL_CREATE_SIMPLE_ARRAY(DataType::Float64, SimpleArrayFloat64, shape, buffer)
-    default:
-        throw std::runtime_error("Unsupported datatype");
-    }
+    return DataType::BFloat16;
 }
 
-#undef MM_DECL_CREATE_SIMPLE_ARRAY
+static_assert(std::variant_size_v<SimpleArrayPlex::variant_type> == static_cast<size_t>(DataType::BFloat16) + 1,
+              "SimpleArrayPlex::variant_type must have an alternative for each DataType");
+static_assert(std::is_same_v<std::variant_alternative_t<static_cast<size_t>(DataType::Bool), SimpleArrayPlex::variant_type>, SimpleArrayBool>);
+static_assert(std::is_same_v<std::variant_alternative_t<static_cast<size_t>(DataType::Float64), SimpleArrayPlex::variant_type>, SimpleArrayFloat64>);
 
-SimpleArrayPlex::SimpleArrayPlex(SimpleArrayPlex const & other)
-    : m_data_type(other.m_data_type)
+namespace
 {
-    if (!other.m_instance_ptr)
-    {
-        return; // other does not have instance
-    }
 
-    m_has_instance_ownership = true;
-
-    switch (other.m_data_type)
-    {
-    case DataType::Bool:
-    {
-        const auto * array = static_cast<SimpleArrayBool *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayBool(*array));
-        break;
-    }
-    case DataType::Int8:
-    {
-        const auto * array = static_cast<SimpleArrayInt8 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayInt8(*array));
-        break;
-    }
-    case DataType::Int16:
-    {
-        const auto * array = static_cast<SimpleArrayInt16 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayInt16(*array));
-        break;
-    }
-    case DataType::Int32:
-    {
-        const auto * array = static_cast<SimpleArrayInt32 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayInt32(*array));
-        break;
-    }
-    case DataType::Int64:
-    {
-        const auto * array = static_cast<SimpleArrayInt64 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayInt64(*array));
-        break;
-    }
-    case DataType::Uint8:
-    {
-        const auto * array = static_cast<SimpleArrayUint8 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayUint8(*array));
-        break;
-    }
-    case DataType::Uint16:
-    {
-        const auto * array = static_cast<SimpleArrayUint16 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayUint16(*array));
-        break;
-    }
-    case DataType::Uint32:
-    {
-        const auto * array = static_cast<SimpleArrayUint32 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayUint32(*array));
-        break;
-    }
-    case DataType::Uint64:
-    {
-        const auto * array = static_cast<SimpleArrayUint64 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayUint64(*array));
-        break;
-    }
-    case DataType::Float32:
-    {
-        const auto * array = static_cast<SimpleArrayFloat32 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayFloat32(*array));
-        break;
-    }
-    case DataType::Float64:
-    {
-        const auto * array = static_cast<SimpleArrayFloat64 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayFloat64(*array));
-        break;
-    }
-    default:
+/// Emplace the typed array of the data type with a fold over the alternatives.
+template <size_t... I, typename... Args>
+void emplace_array(SimpleArrayPlex::variant_type & array, DataType data_type, std::index_sequence<I...>, Args const &... args)
+{
+    size_t const index = static_cast<size_t>(data_type);
+    bool const found = ((index == I + 1 && (array.template emplace<I + 1>(args...), true)) || ...);
+    if (!found)
     {
         throw std::runtime_error("Unsupported datatype");
     }
-    }
 }
 
-SimpleArrayPlex::SimpleArrayPlex(SimpleArrayPlex && other)
-    : m_data_type(other.m_data_type)
+template <typename... Args>
+void emplace_array(SimpleArrayPlex::variant_type & array, DataType data_type, Args const &... args)
 {
-    if (!other.m_instance_ptr)
-    {
-        return; // other does not have instance
-    }
-
-    // take onwership
-    m_has_instance_ownership = true;
-    other.m_has_instance_ownership = false;
-
-    m_instance_ptr = other.m_instance_ptr;
+    emplace_array(array, data_type, std::make_index_sequence<std::variant_size_v<SimpleArrayPlex::variant_type> - 1>(), args...);
 }
 
-SimpleArrayPlex & SimpleArrayPlex::operator=(SimpleArrayPlex const & other)
+template <typename D, typename S>
+void convert_array(SimpleArray<S> const & src, SimpleArray<D> & dst)
 {
-    if (this == &other)
-    {
-        return *this;
-    }
-
-    m_data_type = other.m_data_type;
-
-    if (!other.m_instance_ptr)
-    {
-        return *this; // other does not have instance
-    }
+    size_t const size = src.size();
+    S const * sdata = src.data();
+    D * ddata = dst.data();
+    parallel_for_chunks(
+        size,
+        ThreadPool::instance().use_parallel(size),
+        [sdata, ddata](size_t begin, size_t end)
+        { detail::convert_range(sdata + begin, end - begin, ddata + begin); });
+}
 
-    m_has_instance_ownership = true;
+} /* end namespace */
 
-    switch (other.m_data_type)
-    {
-    case DataType::Bool:
-    {
-        const auto * array = static_cast<SimpleArrayBool *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayBool(*array));
-        break;
-    }
-    case DataType::Int8:
-    {
-        const auto * array = static_cast<SimpleArrayInt8 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayInt8(*array));
-        break;
-    }
-    case DataType::Int16:
-    {
-        const auto * array = static_cast<SimpleArrayInt16 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayInt16(*array));
-        break;
-    }
-    case DataType::Int32:
-    {
-        const auto * array = static_cast<SimpleArrayInt32 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayInt32(*array));
-        break;
-    }
-    case DataType::Int64:
-    {
-        const auto * array = static_cast<SimpleArrayInt64 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayInt64(*array));
-        break;
-    }
-    case DataType::Uint8:
-    {
-        const auto * array = static_cast<SimpleArrayUint8 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayUint8(*array));
-        break;
-    }
-    case DataType::Uint16:
-    {
-        const auto * array = static_cast<SimpleArrayUint16 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayUint16(*array));
-        break;
-    }
-    case DataType::Uint32:
-    {
-        const auto * array = static_cast<SimpleArrayUint32 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayUint32(*array));
-        break;
-    }
-    case DataType::Uint64:
-    {
-        const auto * array = static_cast<SimpleArrayUint64 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayUint64(*array));
-        break;
-    }
-    case DataType::Float32:
-    {
-        const auto * array = static_cast<SimpleArrayFloat32 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayFloat32(*array));
-        break;
-    }
-    case DataType::Float64:
-    {
-        const auto * array = static_cast<SimpleArrayFloat64 *>(other.m_instance_ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArrayFloat64(*array));
-        break;
-    }
-    default:
-    {
-        throw std::runtime_error("Unsupported datatype");
-    }
-    }
-    return *this;
+SimpleArrayPlex::SimpleArrayPlex(const shape_type & shape, const DataType data_type)
+{
+    emplace_array(m_array, data_type, shape);
 }
 
-SimpleArrayPlex & SimpleArrayPlex::operator=(SimpleArrayPlex && other)
+SimpleArrayPlex::SimpleArrayPlex(const shape_type & shape, const std::shared_ptr<ConcreteBuffer> & buffer, const DataType data_type)
 {
-    m_data_type = other.m_data_type;
-
-    if (!other.m_instance_ptr)
-    {
-        return *this; // other does not have instance
-    }
-
-    // take onwership
-    m_has_instance_ownership = true;
-    other.m_has_instance_ownership = false;
+    emplace_array(m_array, data_type, shape, buffer);
+}
 
-    m_instance_ptr = other.m_instance_ptr;
+SimpleArrayPlex & SimpleArrayPlex::copy_from(SimpleArrayPlex const & other)
+{
+    if (size() != other.size())
+    {
+        throw std::invalid_argument(Formatter() << "SimpleArrayPlex::copy_from: size " << other.size()
+                                                << " differs from " << size());
+    }
+    // Dispatch once on the pair of the types and convert the whole buffer.
+    std::visit(
+        [](auto & dst, auto const & src)
+        {
+            using dst_type = std::decay_t<decltype(dst)>;
+            using src_type = std::decay_t<decltype(src)>;
+            if constexpr (!std::is_same_v<dst_type, std::monostate> && !std::is_same_v<src_type, std::monostate>)
+            {
+                convert_array(src, dst);
+            }
+        },
+        m_array,
+        other.m_array);
     return *this;
 }
 
-SimpleArrayPlex::~SimpleArrayPlex()
+SimpleArrayPlex SimpleArrayPlex::astype(DataType data_type) const
 {
-    if (m_instance_ptr == nullptr || !m_has_instance_ownership)
-    {
-        return;
-    }
-
-    switch (m_data_type)
-    {
-    case DataType::Bool:
-    {
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        delete reinterpret_cast<SimpleArrayBool *>(m_instance_ptr);
-        break;
-    }
-    case DataType::Int8:
-    {
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        delete reinterpret_cast<SimpleArrayInt8 *>(m_instance_ptr);
-        break;
-    }
-    case DataType::Int16:
-    {
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        delete reinterpret_cast<SimpleArrayInt16 *>(m_instance_ptr);
-        break;
-    }
-    case DataType::Int32:
-    {
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        delete reinterpret_cast<SimpleArrayInt32 *>(m_instance_ptr);
-        break;
-    }
-    case DataType::Int64:
-    {
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        delete reinterpret_cast<SimpleArrayInt64 *>(m_instance_ptr);
-        break;
-    }
-    case DataType::Uint8:
-    {
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        delete reinterpret_cast<SimpleArrayUint8 *>(m_instance_ptr);
-        break;
-    }
-    case DataType::Uint16:
-    {
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        delete reinterpret_cast<SimpleArrayUint16 *>(m_instance_ptr);
-        break;
-    }
-    case DataType::Uint32:
-    {
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        delete reinterpret_cast<SimpleArrayUint32 *>(m_instance_ptr);
-        break;
-    }
-    case DataType::Uint64:
-    {
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        delete reinterpret_cast<SimpleArrayUint64 *>(m_instance_ptr);
-        break;
-    }
-    case DataType::Float32:
-    {
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        delete reinterpret_cast<SimpleArrayFloat32 *>(m_instance_ptr);
-        break;
-    }
-    case DataType::Float64:
-    {
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        delete reinterpret_cast<SimpleArrayFloat64 *>(m_instance_ptr);
-        break;
-    }
-    default:
-        break;
-    }
-
-    m_instance_ptr = nullptr;
-    m_has_instance_ownership = false;
+    size_t const nghost = visit([](auto const & array)
+                                { return array.nghost(); });
+    SimpleArrayPlex ret(shape(), data_type);
+    ret.visit([nghost](auto & array)
+              { array.set_nghost(nghost); });
+    ret.copy_from(*this);
+    return ret;
 }
 
 } /* end namespace modmesh */
@@ -29,9 +29,22 @@
  */
 
 #include <modmesh/buffer/ConcreteBuffer.hpp>
-
+#include <modmesh/buffer/half.hpp>
+#include <modmesh/buffer/simd.hpp>
+#include <modmesh/buffer/ThreadPool.hpp>
+#include <modmesh/buffer/sort.hpp>
+#include <modmesh/buffer/strided_copy.hpp>
+#include <modmesh/buffer/transpose.hpp>
+
+#include <algorithm>
+#include <array>
+#include <functional>
 #include <limits>
+#include <numeric>
+#include <optional>
 #include <stdexcept>
+#include <utility>
+#include <variant>
 
 #if defined(_MSC_VER)
 #include <BaseTsd.h>
@@ -64,7 +77,8 @@ size_t buffer_offset(S const & strides, Args... args)
     return detail::buffer_offset_impl<0>(strides, args...);
 }
 
-inline size_t buffer_offset(small_vector<size_t> const & stride, small_vector<size_t> const & idx)
+template <size_t N, size_t M>
+size_t buffer_offset(small_vector<size_t, N> const & stride, small_vector<size_t, M> const & idx)
 {
     if (stride.size() != idx.size())
     {
@@ -82,8 +96,8 @@ inline size_t buffer_offset(small_vector<size_t> const & stride, small_vector<si
 namespace detail
 {
 
-using shape_type = small_vector<size_t>;
-using sshape_type = small_vector<ssize_t>;
+using shape_type = small_vector<size_t, MODMESH_SHAPE_INLINE_CAPACITY>;
+using sshape_type = small_vector<ssize_t, MODMESH_SHAPE_INLINE_CAPACITY>;
 
 template <typename T>
 struct SimpleArrayInternalTypes
@@ -94,6 +108,40 @@ struct SimpleArrayInternalTypes
     using buffer_type = ConcreteBuffer;
 }; /* end class SimpleArrayInternalType */
 
+} /* end namespace detail */
+
+/**
+ * Request the data buffer of a SimpleArray to be aligned to the number of
+ * bytes, e.g., ConcreteBuffer::CACHELINE_ALIGNMENT.
+ */
+struct SimpleArrayAlignment
+{
+    size_t value = 0;
+}; /* end struct SimpleArrayAlignment */
+
+/**
+ * Tag the construction of a SimpleArray whose elements are left
+ * uninitialized, for the callers that overwrite the whole array right after.
+ * Untouched pages are not faulted in until the first write.
+ */
+struct SimpleArrayUninitialized
+{
+}; /* end struct SimpleArrayUninitialized */
+
+namespace detail
+{
+
+/// Specialized in SimpleArrayExpression.hpp for the expression nodes.
+template <typename E>
+struct is_array_expression : std::false_type
+{
+}; /* end struct is_array_expression */
+
+} /* end namespace detail */
+
+namespace detail
+{
+
 template <typename A, typename T>
 class SimpleArrayMixinModifiers
 {
@@ -109,7 +157,22 @@ public:
     A & fill(value_type const & value)
     {
         auto athis = static_cast<A *>(this);
-        std::fill(athis->begin(), athis->end(), value);
+        return fill(value, ThreadPool::instance().use_parallel(athis->size()));
+    }
+
+    A & fill(value_type const & value, bool parallel)
+    {
+        auto athis = static_cast<A *>(this);
+        if (0 != athis->size())
+        {
+            value_type * data = athis->data();
+            parallel_for_chunks(
+                athis->size(),
+                parallel,
+                [data, &value](size_t begin, size_t end)
+                { std::fill(data + begin, data + end, value); });
+            athis->bump_epoch();
+        }
         return *athis;
     }
 
@@ -128,67 +191,1372 @@ public:
     using value_type = typename internal_types::value_type;
 
     value_type min(value_type initial = std::numeric_limits<value_type>::max()) const
+    {
+        return min(initial, default_parallel());
+    }
+
+    value_type min(value_type initial, bool parallel) const
+    {
+        return reduce(
+            initial,
+            parallel,
+            [initial](raw_value_type const * data, size_t size)
+            { return simd::min<raw_value_type>(data, size, initial); },
+            [](raw_value_type lhs, raw_value_type rhs)
+            { return rhs < lhs ? rhs : lhs; });
+    }
+
+    value_type max(value_type initial = std::numeric_limits<value_type>::lowest()) const
+    {
+        return max(initial, default_parallel());
+    }
+
+    value_type max(value_type initial, bool parallel) const
+    {
+        return reduce(
+            initial,
+            parallel,
+            [initial](raw_value_type const * data, size_t size)
+            { return simd::max<raw_value_type>(data, size, initial); },
+            [](raw_value_type lhs, raw_value_type rhs)
+            { return rhs > lhs ? rhs : lhs; });
+    }
+
+    value_type sum(value_type initial = 0) const
+    {
+        return sum(initial, default_parallel());
+    }
+
+    value_type sum(value_type initial, bool parallel) const
     {
         auto athis = static_cast<A const *>(this);
-        for (size_t i = 0; i < athis->size(); ++i)
+        if (detail::chunk_count(athis->size()) <= 1)
         {
-            if (athis->data(i) < initial)
+            // A single chunk keeps the summation order of the serial kernel.
+            return 0 == athis->size() ? initial : simd::sum<raw_value_type>(athis->data(), athis->size(), initial);
+        }
+        return reduce(
+            initial,
+            parallel,
+            [](raw_value_type const * data, size_t size)
+            { return simd::sum<raw_value_type>(data, size, raw_value_type(0)); },
+            [](raw_value_type lhs, raw_value_type rhs)
             {
-                initial = athis->data(i);
-            }
+                if constexpr (std::is_same_v<bool, raw_value_type>)
+                {
+                    return lhs || rhs;
+                }
+                else
+                {
+                    return static_cast<raw_value_type>(lhs + rhs);
+                }
+            });
+    }
+
+    /**
+     * Reduce over the axis into a new array of the shape without the axis,
+     * e.g., the per-variable sums of an (ncell, nvar) array with axis 0.  The
+     * ghost elements are included as in sum().  Each output element is
+     * reduced in the same order with or without the pool, and the elements
+     * along the axis are read with unit stride in the inner loop.
+     */
+    A sum_axis(size_t axis) const { return sum_axis(axis, default_parallel()); }
+    A sum_axis(size_t axis, bool parallel) const { return reduce_axis_new(axis, AxisOp::SUM, parallel); }
+    /// Reduce over the axis into out of the shape without the axis, and return it.
+    A & sum_axis(size_t axis, A & out) const { return sum_axis(axis, out, default_parallel()); }
+    A & sum_axis(size_t axis, A & out, bool parallel) const { return reduce_axis(axis, AxisOp::SUM, out, parallel); }
+
+    A min_axis(size_t axis) const { return min_axis(axis, default_parallel()); }
+    A min_axis(size_t axis, bool parallel) const { return reduce_axis_new(axis, AxisOp::MIN, parallel); }
+    A & min_axis(size_t axis, A & out) const { return min_axis(axis, out, default_parallel()); }
+    A & min_axis(size_t axis, A & out, bool parallel) const { return reduce_axis(axis, AxisOp::MIN, out, parallel); }
+
+    A max_axis(size_t axis) const { return max_axis(axis, default_parallel()); }
+    A max_axis(size_t axis, bool parallel) const { return reduce_axis_new(axis, AxisOp::MAX, parallel); }
+    A & max_axis(size_t axis, A & out) const { return max_axis(axis, out, default_parallel()); }
+    A & max_axis(size_t axis, A & out, bool parallel) const { return reduce_axis(axis, AxisOp::MAX, out, parallel); }
+
+    /// The sum over the axis divided by its extent in the value type.
+    A mean_axis(size_t axis) const { return mean_axis(axis, default_parallel()); }
+    A mean_axis(size_t axis, bool parallel) const { return reduce_axis_new(axis, AxisOp::MEAN, parallel); }
+    A & mean_axis(size_t axis, A & out) const { return mean_axis(axis, out, default_parallel()); }
+    A & mean_axis(size_t axis, A & out, bool parallel) const { return reduce_axis(axis, AxisOp::MEAN, out, parallel); }
+
+    A abs() const
+    {
+        auto athis = static_cast<A const *>(this);
+        if constexpr (std::is_same_v<bool, raw_value_type> || !std::numeric_limits<raw_value_type>::is_signed)
+        {
+            return A(*athis);
+        }
+        else
+        {
+            A ret(athis->shape(), SimpleArrayAlignment{athis->alignment()});
+            ret.set_nghost(athis->nghost());
+            abs_into(ret);
+            return ret;
         }
-        return initial;
     }
 
-    value_type max(value_type initial = std::numeric_limits<value_type>::lowest()) const
+    /// Write the absolute values into the array of the same shape and return it.
+    A & abs(A & out) const
+    {
+        auto athis = static_cast<A const *>(this);
+        if (!(out.shape() == athis->shape()) || out.nghost() != athis->nghost())
+        {
+            throw std::invalid_argument("SimpleArray: abs output must have the same shape and nghost as the input");
+        }
+        abs_into(out);
+        out.bump_epoch();
+        return out;
+    }
+
+    A & abs_inplace()
+    {
+        auto athis = static_cast<A *>(this);
+        abs_into(*athis);
+        athis->bump_epoch();
+        return *athis;
+    }
+
+private:
+
+    using raw_value_type = std::remove_const_t<value_type>;
+
+    enum class AxisOp
+    {
+        SUM,
+        MIN,
+        MAX,
+        MEAN
+    }; /* end enum class AxisOp */
+
+    // Output elements of a task that reduces over the slabs of an inner axis.
+    static constexpr size_t AXIS_BLOCK_SIZE = 1024;
+
+    bool default_parallel() const
+    {
+        return ThreadPool::instance().use_parallel(static_cast<A const *>(this)->size());
+    }
+
+    /// The shape without the axis.  Throw for an axis out of range.
+    typename internal_types::shape_type axis_shape(size_t axis) const
     {
         auto athis = static_cast<A const *>(this);
-        for (size_t i = 0; i < athis->size(); ++i)
+        if (athis->ndim() < 2)
+        {
+            throw std::invalid_argument(Formatter() << "SimpleArray: cannot reduce an axis of a " << athis->ndim()
+                                                    << "-dimensional array");
+        }
+        if (axis >= athis->ndim())
+        {
+            throw std::out_of_range(Formatter() << "SimpleArray: axis " << axis << " >= ndim " << athis->ndim());
+        }
+        typename internal_types::shape_type ret;
+        for (size_t it = 0; it < athis->ndim(); ++it)
         {
-            if (athis->data(i) > initial)
+            if (it != axis)
             {
-                initial = athis->data(i);
+                ret.push_back(athis->shape(it));
             }
         }
-        return initial;
+        return ret;
     }
 
-    value_type sum(value_type initial = 0) const
+    A reduce_axis_new(size_t axis, AxisOp op, bool parallel) const
+    {
+        auto athis = static_cast<A const *>(this);
+        A ret(axis_shape(axis), SimpleArrayUninitialized{});
+        if (0 != axis)
+        {
+            ret.set_nghost(athis->nghost());
+        }
+        reduce_axis(axis, op, ret, parallel);
+        return ret;
+    }
+
+    A & reduce_axis(size_t axis, AxisOp op, A & out, bool parallel) const
+    {
+        if (!(out.shape() == axis_shape(axis)))
+        {
+            throw std::invalid_argument(Formatter() << "SimpleArray: the output of the reduction over axis " << axis
+                                                    << " has a wrong shape");
+        }
+        switch (op)
+        {
+        case AxisOp::SUM:
+        case AxisOp::MEAN:
+            reduce_axis_with(
+                axis,
+                out,
+                parallel,
+                AxisOp::MEAN == op,
+                AxisOp::SUM == op,
+                [](raw_value_type const * data, size_t size)
+                { return simd::sum<raw_value_type>(data, size, raw_value_type(0)); },
+                [](raw_value_type lhs, raw_value_type rhs)
+                {
+                    if constexpr (std::is_same_v<bool, raw_value_type>)
+                    {
+                        return lhs || rhs;
+                    }
+                    else
+                    {
+                        return static_cast<raw_value_type>(lhs + rhs);
+                    }
+                });
+            break;
+        case AxisOp::MIN:
+            reduce_axis_with(
+                axis,
+                out,
+                parallel,
+                false,
+                false,
+                [](raw_value_type const * data, size_t size)
+                { return simd::min<raw_value_type>(data + 1, size - 1, data[0]); },
+                [](raw_value_type lhs, raw_value_type rhs)
+                { return rhs < lhs ? rhs : lhs; });
+            break;
+        case AxisOp::MAX:
+            reduce_axis_with(
+                axis,
+                out,
+                parallel,
+                false,
+                false,
+                [](raw_value_type const * data, size_t size)
+                { return simd::max<raw_value_type>(data + 1, size - 1, data[0]); },
+                [](raw_value_type lhs, raw_value_type rhs)
+                { return rhs > lhs ? rhs : lhs; });
+            break;
+        }
+        out.bump_epoch();
+        return out;
+    }
+
+    /**
+     * Take the array as (nouter, n, ninner) with n along the axis.  With
+     * ninner of 1, the kernel reduces each contiguous row of n.  Otherwise
+     * each output row of ninner is initialized by the first slab and
+     * combined with the following ones, so that both are read with unit
+     * stride.  The tasks take blocks of the rows or of the output columns.
+     */
+    template <typename K, typename C>
+    void reduce_axis_with(size_t axis, A & out, bool parallel, bool mean, bool sum_of_empty, K && kernel, C && combine) const
     {
         auto athis = static_cast<A const *>(this);
-        if constexpr (!std::is_same_v<bool, std::remove_const_t<value_type>>)
+        size_t const n = athis->shape(axis);
+        size_t nouter = 1;
+        for (size_t it = 0; it < axis; ++it)
+        {
+            nouter *= athis->shape(it);
+        }
+        size_t const ninner = 0 == n ? 0 : athis->size() / (nouter * n);
+        if (0 == out.size())
         {
-            for (size_t i = 0; i < athis->size(); ++i)
+            return;
+        }
+        raw_value_type * dst = out.data();
+        if (0 == n)
+        {
+            // Only the sum of nothing is defined.
+            if (sum_of_empty)
             {
-                initial += athis->data(i);
+                std::fill(dst, dst + out.size(), raw_value_type(0));
+                return;
             }
+            throw std::invalid_argument(Formatter() << "SimpleArray: cannot reduce the empty axis " << axis);
         }
-        else
+        if constexpr (std::is_same_v<bool, raw_value_type>)
+        {
+            if (mean)
+            {
+                throw std::invalid_argument("SimpleArray: cannot take the mean of a bool array");
+            }
+        }
+        raw_value_type const * src = athis->data();
+        auto finish = [&](size_t begin, size_t end)
+        {
+            if constexpr (!std::is_same_v<bool, raw_value_type>)
+            {
+                if (mean)
+                {
+                    for (size_t it = begin; it < end; ++it)
+                    {
+                        dst[it] = static_cast<raw_value_type>(dst[it] / static_cast<raw_value_type>(n));
+                    }
+                }
+            }
+        };
+
+        auto run = [parallel](size_t ntask, std::function<void(size_t)> const & body)
+        {
+            if (parallel && ntask > 1)
+            {
+                ThreadPool::instance().run(ntask, body);
+            }
+            else
+            {
+                for (size_t itask = 0; itask < ntask; ++itask)
+                {
+                    body(itask);
+                }
+            }
+        };
+        // Fold the slabs [kbegin, kend) of the output row io into acc[begin:end).
+        auto fold = [&](size_t io, size_t kbegin, size_t kend, raw_value_type * acc, size_t begin, size_t end)
+        {
+            raw_value_type const * slab = src + (io * n + kbegin) * ninner;
+            std::copy(slab + begin, slab + end, acc + begin);
+            for (size_t ik = kbegin + 1; ik < kend; ++ik)
+            {
+                slab += ninner;
+                for (size_t it = begin; it < end; ++it)
+                {
+                    acc[it] = combine(acc[it], slab[it]);
+                }
+            }
+        };
+
+        if (1 == ninner)
+        {
+            size_t const nrow_task = std::max(ThreadPool::CHUNK_SIZE / n, size_t(1));
+            run((nouter + nrow_task - 1) / nrow_task,
+                [&, nrow_task](size_t itask)
+                {
+                    size_t const begin = itask * nrow_task;
+                    size_t const end = std::min(begin + nrow_task, nouter);
+                    for (size_t io = begin; io < end; ++io)
+                    {
+                        dst[io] = kernel(src + io * n, n);
+                    }
+                    finish(begin, end);
+                });
+            return;
+        }
+
+        // Narrow rows along a long axis are folded in fixed groups of slabs
+        // into partial rows, which are then combined in the group order.  The
+        // grouping does not depend on the number of threads.
+        size_t const nslab = ninner <= AXIS_BLOCK_SIZE ? std::max(ThreadPool::CHUNK_SIZE / ninner, size_t(1)) : n;
+        size_t const ngroup = (n + nslab - 1) / nslab;
+        if (ngroup > 1)
         {
-            for (size_t i = 0; i < athis->size(); ++i)
+            A partials(small_vector<size_t>{nouter, ngroup, ninner}, SimpleArrayUninitialized{});
+            raw_value_type * pdata = partials.data();
+            run(nouter * ngroup,
+                [&, ngroup, nslab](size_t itask)
+                {
+                    size_t const io = itask / ngroup;
+                    size_t const ig = itask % ngroup;
+                    fold(io, ig * nslab, std::min((ig + 1) * nslab, n), pdata + itask * ninner, 0, ninner);
+                });
+            for (size_t io = 0; io < nouter; ++io)
             {
-                initial |= athis->data(i);
+                raw_value_type * acc = dst + io * ninner;
+                raw_value_type const * part = pdata + io * ngroup * ninner;
+                std::copy(part, part + ninner, acc);
+                for (size_t ig = 1; ig < ngroup; ++ig)
+                {
+                    part += ninner;
+                    for (size_t it = 0; it < ninner; ++it)
+                    {
+                        acc[it] = combine(acc[it], part[it]);
+                    }
+                }
             }
+            finish(0, out.size());
+            return;
         }
-        return initial;
+
+        size_t const nblock = (ninner + AXIS_BLOCK_SIZE - 1) / AXIS_BLOCK_SIZE;
+        run(nouter * nblock,
+            [&, nblock](size_t itask)
+            {
+                size_t const io = itask / nblock;
+                size_t const begin = (itask % nblock) * AXIS_BLOCK_SIZE;
+                size_t const end = std::min(begin + AXIS_BLOCK_SIZE, ninner);
+                fold(io, 0, n, dst + io * ninner, begin, end);
+                finish(io * ninner + begin, io * ninner + end);
+            });
     }
 
-    A abs() const
+    /// Fold the per-chunk results of kernel in chunk order.
+    template <typename K, typename C>
+    value_type reduce(value_type initial, bool parallel, K && kernel, C && combine) const
+    {
+        auto athis = static_cast<A const *>(this);
+        if (0 == athis->size())
+        {
+            return initial;
+        }
+        raw_value_type const * data = athis->data();
+        return parallel_reduce_chunks<raw_value_type>(
+            athis->size(),
+            parallel,
+            initial,
+            [data, &kernel](size_t begin, size_t end)
+            { return kernel(data + begin, end - begin); },
+            combine);
+    }
+
+    void abs_into(A & out) const
+    {
+        auto athis = static_cast<A const *>(this);
+        if (0 != athis->size())
+        {
+            raw_value_type const * src = athis->data();
+            raw_value_type * dst = out.data();
+            parallel_for_chunks(
+                athis->size(),
+                default_parallel(),
+                [src, dst](size_t begin, size_t end)
+                { simd::abs<raw_value_type>(src + begin, end - begin, dst + begin); });
+        }
+    }
+
+}; /* end class SimpleArrayMixinCalculators */
+
+} /* end namespace detail */
+
+template <typename T>
+class SimpleArray;
+
+template <typename T, size_t ND>
+class SimpleArrayFixedView;
+
+namespace detail
+{
+
+template <typename A, typename T>
+class SimpleArrayMixinSort
+{
+
+private:
+
+    using internal_types = detail::SimpleArrayInternalTypes<T>;
+
+public:
+
+    using value_type = typename internal_types::value_type;
+
+    /// Sort the elements in place in the flattened order.
+    A & sort() { return sort(default_parallel()); }
+
+    A & sort(bool parallel)
+    {
+        auto athis = static_cast<A *>(this);
+        parallel_sort(athis->data(), athis->size(), parallel);
+        athis->bump_epoch();
+        return *athis;
+    }
+
+    /// Return the flattened positions that sort the elements stably.
+    template <typename I = uint64_t>
+    SimpleArray<I> argsort() const { return argsort<I>(default_parallel()); }
+
+    template <typename I = uint64_t>
+    SimpleArray<I> argsort(bool parallel) const
+    {
+        auto athis = static_cast<A const *>(this);
+        SimpleArray<I> ret(athis->size());
+        parallel_argsort(athis->data(), athis->size(), ret.data(), parallel);
+        return ret;
+    }
+
+    /// Return the sorted unique elements in a one-dimensional array.
+    A unique() const { return unique(default_parallel()); }
+
+    A unique(bool parallel) const
+    {
+        auto athis = static_cast<A const *>(this);
+        A values(athis->size());
+        std::copy_n(athis->data(), athis->size(), values.data());
+        size_t const nunique = parallel_sort_unique(values.data(), values.size(), parallel);
+        A ret(nunique);
+        std::copy_n(values.data(), nunique, ret.data());
+        return ret;
+    }
+
+    /**
+     * Return the positions in this sorted array where the values would be
+     * inserted to keep the order.  The result has the shape of values.
+     *
+     * \param[in] right
+     *      Return the last suitable position instead of the first.
+     */
+    template <typename I = uint64_t>
+    SimpleArray<I> searchsorted(A const & values, bool right = false) const
+    {
+        return searchsorted<I>(values, right, ThreadPool::instance().use_parallel(values.size()));
+    }
+
+    template <typename I = uint64_t>
+    SimpleArray<I> searchsorted(A const & values, bool right, bool parallel) const
+    {
+        auto athis = static_cast<A const *>(this);
+        SimpleArray<I> ret(values.shape());
+        parallel_searchsorted(athis->data(), athis->size(), values.data(), values.size(), ret.data(), right, parallel);
+        return ret;
+    }
+
+private:
+
+    bool default_parallel() const
+    {
+        return ThreadPool::instance().use_parallel(static_cast<A const *>(this)->size());
+    }
+
+}; /* end class SimpleArrayMixinSort */
+
+/**
+ * Gather and scatter the rows, i.e., the sub-arrays of the first dimension,
+ * by an index array or a boolean mask, in place of the round trips through
+ * numpy.  An index counts from the body as the element access does, so the
+ * ghost rows take the negative indices.  A mask either has one flag for
+ * every row, ghost included, or has the shape of the array to pick the
+ * elements.  The array is taken as C-contiguous, as the sorting does.
+ */
+template <typename A, typename T>
+class SimpleArrayMixinIndexing
+{
+
+private:
+
+    using internal_types = detail::SimpleArrayInternalTypes<T>;
+
+public:
+
+    using value_type = typename internal_types::value_type;
+    using shape_type = typename internal_types::shape_type;
+    /// Dependent on T to be instantiated after SimpleArray is complete.
+    using mask_type = SimpleArray<std::enable_if_t<sizeof(T) != 0, bool>>;
+
+    /// Gather the rows at the indices into an array of the shape of the indices followed by the row shape.
+    template <typename I>
+    A take(SimpleArray<I> const & indices) const { return take(indices, use_parallel(indices.size())); }
+
+    template <typename I>
+    A take(SimpleArray<I> const & indices, bool parallel) const
+    {
+        A ret(gathered_shape(indices.shape()), SimpleArrayUninitialized{});
+        take(indices, ret, parallel);
+        return ret;
+    }
+
+    /// Gather into the preallocated output and return it.
+    template <typename I>
+    A & take(SimpleArray<I> const & indices, A & out, bool parallel) const
     {
         auto athis = static_cast<A const *>(this);
-        A ret(*athis);
-        if constexpr (!std::is_same_v<bool, std::remove_const_t<value_type>> && std::is_signed_v<value_type>)
+        check_shape(out.shape(), gathered_shape(indices.shape()), "take output");
+        check_indices(indices, parallel);
+        size_t const nrow = row_size();
+        I const * index = indices.data();
+        value_type const * src = athis->data();
+        value_type * dst = out.data();
+        size_t const nghost = athis->nghost();
+        parallel_for_chunks(
+            indices.size(),
+            parallel,
+            [=](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    size_t const row = static_cast<size_t>(static_cast<int64_t>(index[i]) + static_cast<int64_t>(nghost));
+                    std::copy_n(src + row * nrow, nrow, dst + i * nrow);
+                }
+            });
+        out.bump_epoch();
+        return out;
+    }
+
+    /**
+     * Scatter the rows of values to the indices in place.  values has the
+     * shape of the indices followed by the row shape.  Of the duplicated
+     * indices the last value is kept unless in parallel, when it may be any.
+     */
+    template <typename I>
+    A & put(SimpleArray<I> const & indices, A const & values) { return put(indices, values, use_parallel(indices.size())); }
+
+    template <typename I>
+    A & put(SimpleArray<I> const & indices, A const & values, bool parallel)
+    {
+        auto athis = static_cast<A *>(this);
+        check_shape(values.shape(), gathered_shape(indices.shape()), "put values");
+        check_indices(indices, parallel);
+        size_t const nrow = row_size();
+        I const * index = indices.data();
+        value_type const * src = values.data();
+        value_type * dst = athis->data();
+        size_t const nghost = athis->nghost();
+        parallel_for_chunks(
+            indices.size(),
+            parallel,
+            [=](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    size_t const row = static_cast<size_t>(static_cast<int64_t>(index[i]) + static_cast<int64_t>(nghost));
+                    std::copy_n(src + i * nrow, nrow, dst + row * nrow);
+                }
+            });
+        athis->bump_epoch();
+        return *athis;
+    }
+
+    /// Return the rows (or the elements) where the mask is true, in order.
+    A select(mask_type const & mask) const { return select(mask, use_parallel(mask.size())); }
+
+    A select(mask_type const & mask, bool parallel) const
+    {
+        std::vector<size_t> const offsets = mask_offsets(mask, parallel);
+        A ret(selected_shape(mask, offsets.back()), SimpleArrayUninitialized{});
+        gather_masked(mask, offsets, ret.data(), parallel);
+        return ret;
+    }
+
+    /// Select into the preallocated output, whose first dimension is the number of the true flags.
+    A & select(mask_type const & mask, A & out, bool parallel) const
+    {
+        std::vector<size_t> const offsets = mask_offsets(mask, parallel);
+        check_shape(out.shape(), selected_shape(mask, offsets.back()), "select output");
+        gather_masked(mask, offsets, out.data(), parallel);
+        out.bump_epoch();
+        return out;
+    }
+
+    /// Set the rows (or the elements) where the mask is true to the value.
+    A & assign(mask_type const & mask, value_type const & value, bool parallel)
+    {
+        auto athis = static_cast<A *>(this);
+        size_t const nrow = mask_row_size(mask);
+        bool const * flag = mask.data();
+        value_type * dst = athis->data();
+        parallel_for_chunks(
+            mask.size(),
+            parallel,
+            [=](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    if (flag[i])
+                    {
+                        std::fill_n(dst + i * nrow, nrow, value);
+                    }
+                }
+            });
+        athis->bump_epoch();
+        return *athis;
+    }
+
+    /// Set the rows (or the elements) where the mask is true to the rows of values in order.
+    A & assign(mask_type const & mask, A const & values, bool parallel)
+    {
+        auto athis = static_cast<A *>(this);
+        std::vector<size_t> const offsets = mask_offsets(mask, parallel);
+        check_shape(values.shape(), selected_shape(mask, offsets.back()), "assign values");
+        size_t const nrow = mask_row_size(mask);
+        value_type const * src = values.data();
+        value_type * dst = athis->data();
+        for_each_masked(
+            mask,
+            offsets,
+            parallel,
+            [=](size_t i, size_t ipacked)
+            { std::copy_n(src + ipacked * nrow, nrow, dst + i * nrow); });
+        athis->bump_epoch();
+        return *athis;
+    }
+
+private:
+
+    static bool use_parallel(size_t n) { return ThreadPool::instance().use_parallel(n); }
+
+    /// The number of elements in a row.
+    size_t row_size() const
+    {
+        auto athis = static_cast<A const *>(this);
+        if (athis->shape().empty() || 0 == athis->shape(0))
+        {
+            return 0;
+        }
+        return athis->size() / athis->shape(0);
+    }
+
+    shape_type gathered_shape(shape_type const & index_shape) const
+    {
+        auto athis = static_cast<A const *>(this);
+        if (athis->shape().empty())
+        {
+            throw std::invalid_argument("SimpleArray: cannot index the rows of a zero-dimensional array");
+        }
+        shape_type ret(index_shape);
+        for (size_t it = 1; it < athis->shape().size(); ++it)
+        {
+            ret.push_back(athis->shape(it));
+        }
+        return ret;
+    }
+
+    static void check_shape(shape_type const & shape, shape_type const & expected, char const * name)
+    {
+        if (!(shape == expected))
+        {
+            Formatter msg;
+            msg << "SimpleArray: " << name << " shape (";
+            for (size_t it = 0; it < shape.size(); ++it)
+            {
+                msg << (0 == it ? "" : ", ") << shape[it];
+            }
+            msg << ") differs from the expected (";
+            for (size_t it = 0; it < expected.size(); ++it)
+            {
+                msg << (0 == it ? "" : ", ") << expected[it];
+            }
+            msg << ")";
+            throw std::invalid_argument(msg >> Formatter::to_str);
+        }
+    }
+
+    /// Throw std::out_of_range for the first index out of [-nghost, nbody).
+    template <typename I>
+    void check_indices(SimpleArray<I> const & indices, bool parallel) const
+    {
+        auto athis = static_cast<A const *>(this);
+        int64_t const lower = -static_cast<int64_t>(athis->nghost());
+        int64_t const upper = static_cast<int64_t>(athis->nbody());
+        auto const bad = [lower, upper](I index)
+        {
+            if constexpr (std::is_unsigned_v<I>)
+            {
+                return index >= static_cast<uint64_t>(upper);
+            }
+            else
+            {
+                return static_cast<int64_t>(index) < lower || static_cast<int64_t>(index) >= upper;
+            }
+        };
+        I const * index = indices.data();
+        size_t const nbad = parallel_reduce_chunks(
+            indices.size(),
+            parallel,
+            size_t(0),
+            [&](size_t begin, size_t end)
+            { return static_cast<size_t>(std::count_if(index + begin, index + end, bad)); },
+            [](size_t a, size_t b)
+            { return a + b; });
+        if (0 != nbad)
+        {
+            I const * first = std::find_if(index, index + indices.size(), bad);
+            throw std::out_of_range(Formatter() << "SimpleArray: index " << static_cast<int64_t>(*first) << " at " << (first - index)
+                                                << " is out of range [" << lower << ", " << upper << ")");
+        }
+    }
+
+    /// The number of elements a flag of the mask covers.
+    size_t mask_row_size(mask_type const & mask) const
+    {
+        auto athis = static_cast<A const *>(this);
+        if (mask.shape() == athis->shape())
+        {
+            return 1;
+        }
+        if (1 == mask.ndim() && !athis->shape().empty() && mask.size() == athis->shape(0))
+        {
+            return row_size();
+        }
+        throw std::invalid_argument("SimpleArray: mask must have the shape of the array or one flag for each row");
+    }
+
+    shape_type selected_shape(mask_type const & mask, size_t count) const
+    {
+        auto athis = static_cast<A const *>(this);
+        shape_type ret{count};
+        if (!(mask.shape() == athis->shape()))
+        {
+            for (size_t it = 1; it < athis->shape().size(); ++it)
+            {
+                ret.push_back(athis->shape(it));
+            }
+        }
+        return ret;
+    }
+
+    /// The positions of the true flags of the chunks, and the total count at the end.
+    std::vector<size_t> mask_offsets(mask_type const & mask, bool parallel) const
+    {
+        mask_row_size(mask);
+        bool const * flag = mask.data();
+        size_t const nchunk = (mask.size() + ThreadPool::CHUNK_SIZE - 1) / ThreadPool::CHUNK_SIZE;
+        std::vector<size_t> ret(nchunk + 1, 0);
+        size_t * counts = ret.data() + 1;
+        parallel_for_chunks(
+            mask.size(),
+            parallel,
+            [=](size_t begin, size_t end)
+            { counts[begin / ThreadPool::CHUNK_SIZE] = static_cast<size_t>(std::count(flag + begin, flag + end, true)); });
+        std::partial_sum(ret.begin(), ret.end(), ret.begin());
+        return ret;
+    }
+
+    /// Call f(flag position, packed position) for every true flag of the mask.
+    template <typename F>
+    static void for_each_masked(mask_type const & mask, std::vector<size_t> const & offsets, bool parallel, F && f)
+    {
+        bool const * flag = mask.data();
+        size_t const * offset = offsets.data();
+        parallel_for_chunks(
+            mask.size(),
+            parallel,
+            [&](size_t begin, size_t end)
+            {
+                size_t ipacked = offset[begin / ThreadPool::CHUNK_SIZE];
+                for (size_t i = begin; i < end; ++i)
+                {
+                    if (flag[i])
+                    {
+                        f(i, ipacked);
+                        ++ipacked;
+                    }
+                }
+            });
+    }
+
+    void gather_masked(mask_type const & mask, std::vector<size_t> const & offsets, value_type * packed, bool parallel) const
+    {
+        size_t const nrow = mask_row_size(mask);
+        value_type const * data = static_cast<A const *>(this)->data();
+        for_each_masked(
+            mask,
+            offsets,
+            parallel,
+            [=](size_t i, size_t ipacked)
+            { std::copy_n(data + i * nrow, nrow, packed + ipacked * nrow); });
+    }
+
+}; /* end class SimpleArrayMixinIndexing */
+
+} /* end namespace detail */
+
+/**
+ * Slice of one dimension with the Python semantics: the stop is exclusive, a
+ * negative index counts from the end, and an empty start or stop spans to
+ * the end in the direction of the step.
+ */
+struct SimpleArraySlice
+{
+    std::optional<ssize_t> start;
+    std::optional<ssize_t> stop;
+    ssize_t step = 1;
+}; /* end struct SimpleArraySlice */
+
+/**
+ * Contiguous span of elements in a SimpleArray.  The span is a raw pointer
+ * and a length, so loops over it compile to plain pointer arithmetic.  Spans
+ * taken from distinct arrays never overlap, and a kernel may bind their
+ * data() to MODMESH_RESTRICT pointers to let the compiler vectorize.
+ */
+template <typename T>
+class SimpleArraySpan
+{
+
+public:
+
+    using value_type = T;
+    using iterator = T *;
+
+    SimpleArraySpan() = default;
+    SimpleArraySpan(T * data, size_t size)
+        : m_data(data)
+        , m_size(size)
+    {
+    }
+
+    T * data() const noexcept { return m_data; }
+    size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return 0 == m_size; }
+
+    T * begin() const noexcept { return m_data; }
+    T * end() const noexcept { return m_data + m_size; }
+
+    T & operator[](size_t it) const noexcept { return m_data[it]; }
+
+private:
+
+    T * m_data = nullptr;
+    size_t m_size = 0;
+
+}; /* end class SimpleArraySpan */
+
+/**
+ * Range of the rows of a SimpleArray of rank 2 or higher.  A row is the
+ * contiguous span of stride(0) elements addressed by one index in the first
+ * dimension, so kernels can run a tight inner loop on each row.
+ */
+template <typename T>
+class SimpleArrayRows
+{
+
+public:
+
+    class iterator
+    {
+
+    public:
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = SimpleArraySpan<T>;
+        using difference_type = ssize_t;
+        using pointer = void;
+        using reference = SimpleArraySpan<T>;
+
+        iterator() = default;
+        iterator(T * first, size_t width, size_t index)
+            : m_first(first)
+            , m_width(width)
+            , m_index(index)
+        {
+        }
+
+        SimpleArraySpan<T> operator*() const noexcept { return SimpleArraySpan<T>(m_first + m_index * m_width, m_width); }
+        SimpleArraySpan<T> operator[](ssize_t it) const noexcept { return *(*this + it); }
+
+        iterator & operator++() noexcept
+        {
+            ++m_index;
+            return *this;
+        }
+        iterator operator++(int) noexcept
+        {
+            iterator ret(*this);
+            ++m_index;
+            return ret;
+        }
+        iterator & operator--() noexcept
+        {
+            --m_index;
+            return *this;
+        }
+        iterator operator--(int) noexcept
+        {
+            iterator ret(*this);
+            --m_index;
+            return ret;
+        }
+        iterator & operator+=(ssize_t it) noexcept
+        {
+            m_index += it;
+            return *this;
+        }
+        iterator & operator-=(ssize_t it) noexcept
+        {
+            m_index -= it;
+            return *this;
+        }
+
+        friend iterator operator+(iterator lhs, ssize_t it) noexcept { return lhs += it; }
+        friend iterator operator-(iterator lhs, ssize_t it) noexcept { return lhs -= it; }
+        friend ssize_t operator-(iterator const & lhs, iterator const & rhs) noexcept
+        {
+            return static_cast<ssize_t>(lhs.m_index) - static_cast<ssize_t>(rhs.m_index);
+        }
+
+        // Iterators are only comparable within the same range.
+        friend bool operator==(iterator const & lhs, iterator const & rhs) noexcept { return lhs.m_index == rhs.m_index; }
+        friend bool operator!=(iterator const & lhs, iterator const & rhs) noexcept { return lhs.m_index != rhs.m_index; }
+        friend bool operator<(iterator const & lhs, iterator const & rhs) noexcept { return lhs.m_index < rhs.m_index; }
+
+    private:
+
+        T * m_first = nullptr;
+        size_t m_width = 0;
+        size_t m_index = 0;
+
+    }; /* end class iterator */
+
+    SimpleArrayRows() = default;
+    SimpleArrayRows(T * first, size_t nrow, size_t width)
+        : m_first(first)
+        , m_nrow(nrow)
+        , m_width(width)
+    {
+    }
+
+    size_t size() const noexcept { return m_nrow; }
+    bool empty() const noexcept { return 0 == m_nrow; }
+    /// Number of elements in each row.
+    size_t width() const noexcept { return m_width; }
+
+    iterator begin() const noexcept { return iterator(m_first, m_width, 0); }
+    iterator end() const noexcept { return iterator(m_first, m_width, m_nrow); }
+
+    SimpleArraySpan<T> operator[](size_t it) const noexcept { return SimpleArraySpan<T>(m_first + it * m_width, m_width); }
+
+private:
+
+    T * m_first = nullptr;
+    size_t m_nrow = 0;
+    size_t m_width = 0;
+
+}; /* end class SimpleArrayRows */
+
+/**
+ * Strided view sharing the buffer of a SimpleArray.  A view carries its own
+ * origin, shape and strides in elements, which may be negative.  Slicing,
+ * transposing and reshaping a view do not copy data; copy() materializes a
+ * contiguous SimpleArray.
+ */
+template <typename T>
+class SimpleArrayView
+{
+
+public:
+
+    using value_type = T;
+    using shape_type = detail::shape_type;
+    using sstride_type = detail::sshape_type;
+    using buffer_type = ConcreteBuffer;
+    using array_type = SimpleArray<std::remove_const_t<T>>;
+
+    static constexpr size_t ITEMSIZE = sizeof(value_type);
+
+    SimpleArrayView() = default;
+
+    SimpleArrayView(std::shared_ptr<buffer_type> buffer, value_type * origin, shape_type shape, sstride_type stride)
+        : m_buffer(std::move(buffer))
+        , m_origin(origin)
+        , m_shape(std::move(shape))
+        , m_stride(std::move(stride))
+    {
+        if (m_shape.size() != m_stride.size())
+        {
+            throw std::invalid_argument(Formatter() << "SimpleArrayView: shape size " << m_shape.size()
+                                                    << " != stride size " << m_stride.size());
+        }
+        validate_extent();
+    }
+
+    size_t ndim() const noexcept { return m_shape.size(); }
+    shape_type const & shape() const { return m_shape; }
+    size_t shape(size_t it) const noexcept { return m_shape[it]; }
+    sstride_type const & stride() const { return m_stride; }
+    ssize_t stride(size_t it) const noexcept { return m_stride[it]; }
+    size_t size() const noexcept
+    {
+        size_t ret = 1;
+        for (size_t const extent : m_shape)
+        {
+            ret *= extent;
+        }
+        return m_shape.empty() ? 0 : ret;
+    }
+
+    std::shared_ptr<buffer_type> const & buffer() const { return m_buffer; }
+    value_type * origin() const { return m_origin; }
+
+    /// Whether the view is C-contiguous.
+    bool is_contiguous() const noexcept
+    {
+        ssize_t expected = 1;
+        for (size_t it = ndim(); it > 0; --it)
+        {
+            if (m_shape[it - 1] != 1 && m_stride[it - 1] != expected)
+            {
+                return false;
+            }
+            expected *= static_cast<ssize_t>(m_shape[it - 1]);
+        }
+        return true;
+    }
+
+    template <typename... Args>
+    value_type & operator()(Args... args) const
+    {
+        return m_origin[offset_impl<0>(args...)];
+    }
+
+    /// Element access with bounds check.  Negative indices count from the end.
+    value_type & at(sstride_type const & idx) const
+    {
+        if (idx.size() != ndim())
+        {
+            throw std::out_of_range(Formatter() << "SimpleArrayView: dimension of input indices " << idx.size()
+                                                << " != view dimension " << ndim());
+        }
+        ssize_t offset = 0;
+        for (size_t it = 0; it < ndim(); ++it)
+        {
+            offset += normalize_index(it, idx[it]) * m_stride[it];
+        }
+        return m_origin[offset];
+    }
+
+    /// View of the range selected by slice in dimension dim.
+    SimpleArrayView slice(size_t dim, SimpleArraySlice const & slice) const
+    {
+        validate_dim(dim);
+        if (0 == slice.step)
+        {
+            throw std::invalid_argument("SimpleArrayView: slice step cannot be zero");
+        }
+        auto const extent = static_cast<ssize_t>(m_shape[dim]);
+        ssize_t const step = slice.step;
+        auto adjust = [extent, step](std::optional<ssize_t> const & value, ssize_t fallback)
+        {
+            if (!value)
+            {
+                return fallback;
+            }
+            ssize_t ret = *value < 0 ? *value + extent : *value;
+            if (ret < 0)
+            {
+                ret = step < 0 ? -1 : 0;
+            }
+            else if (ret >= extent)
+            {
+                ret = step < 0 ? extent - 1 : extent;
+            }
+            return ret;
+        };
+        ssize_t const start = adjust(slice.start, step < 0 ? extent - 1 : 0);
+        ssize_t const stop = adjust(slice.stop, step < 0 ? -1 : extent);
+        ssize_t count = 0;
+        if (step > 0 && start < stop)
+        {
+            count = (stop - start + step - 1) / step;
+        }
+        else if (step < 0 && start > stop)
+        {
+            count = (start - stop - step - 1) / -step;
+        }
+
+        SimpleArrayView ret(*this);
+        if (count > 0)
+        {
+            ret.m_origin += start * m_stride[dim];
+        }
+        ret.m_shape[dim] = static_cast<size_t>(count);
+        ret.m_stride[dim] = m_stride[dim] * step;
+        return ret;
+    }
+
+    /// View of the leading dimensions selected by the slices.
+    SimpleArrayView slice(std::vector<SimpleArraySlice> const & slices) const
+    {
+        if (slices.size() > ndim())
+        {
+            throw std::out_of_range(Formatter() << "SimpleArrayView: " << slices.size() << " slices for "
+                                                << ndim() << "-dimensional view");
+        }
+        SimpleArrayView ret(*this);
+        for (size_t it = 0; it < slices.size(); ++it)
+        {
+            ret = ret.slice(it, slices[it]);
+        }
+        return ret;
+    }
+
+    /// View with dimension dim removed at index.
+    SimpleArrayView select(size_t dim, ssize_t index) const
+    {
+        validate_dim(dim);
+        ssize_t const normalized = normalize_index(dim, index);
+        shape_type shape;
+        sstride_type stride;
+        for (size_t it = 0; it < ndim(); ++it)
+        {
+            if (it != dim)
+            {
+                shape.push_back(m_shape[it]);
+                stride.push_back(m_stride[it]);
+            }
+        }
+        return SimpleArrayView(m_buffer, m_origin + normalized * m_stride[dim], std::move(shape), std::move(stride));
+    }
+
+    /// View with the order of the dimensions reversed.
+    SimpleArrayView transpose() const
+    {
+        shape_type axes(ndim());
+        for (size_t it = 0; it < ndim(); ++it)
+        {
+            axes[it] = ndim() - 1 - it;
+        }
+        return transpose(axes);
+    }
+
+    /// View with the dimensions permuted by axes.
+    SimpleArrayView transpose(shape_type const & axes) const
+    {
+        if (axes.size() != ndim())
+        {
+            throw std::invalid_argument(Formatter() << "SimpleArrayView: " << axes.size() << " axes for "
+                                                    << ndim() << "-dimensional view");
+        }
+        small_vector<bool, MODMESH_SHAPE_INLINE_CAPACITY> used(ndim(), false);
+        SimpleArrayView ret(*this);
+        for (size_t it = 0; it < ndim(); ++it)
+        {
+            if (axes[it] >= ndim() || used[axes[it]])
+            {
+                throw std::invalid_argument("SimpleArrayView: axes is not a permutation of the dimensions");
+            }
+            used[axes[it]] = true;
+            ret.m_shape[it] = m_shape[axes[it]];
+            ret.m_stride[it] = m_stride[axes[it]];
+        }
+        return ret;
+    }
+
+    /// View with a new shape.  Only a contiguous view can be reshaped without copying.
+    SimpleArrayView reshape(shape_type const & shape) const
+    {
+        size_t nelem = shape.empty() ? 0 : 1;
+        for (size_t const extent : shape)
+        {
+            nelem *= extent;
+        }
+        if (nelem != size())
+        {
+            throw std::invalid_argument(Formatter() << "SimpleArrayView: cannot reshape " << size()
+                                                    << " elements into " << nelem);
+        }
+        if (!is_contiguous())
+        {
+            throw std::invalid_argument("SimpleArrayView: cannot reshape a non-contiguous view without copying");
+        }
+        sstride_type stride(shape.size());
+        ssize_t step = 1;
+        for (size_t it = shape.size(); it > 0; --it)
+        {
+            stride[it - 1] = step;
+            step *= static_cast<ssize_t>(shape[it - 1]);
+        }
+        return SimpleArrayView(m_buffer, m_origin, shape, std::move(stride));
+    }
+
+    /// Copy the elements into a new contiguous array.
+    array_type copy() const
+    {
+        array_type ret(m_shape);
+        if (0 != size())
+        {
+            sstride_type const dst_stride = contiguous_stride();
+            strided_copy(m_origin, m_stride.data(), ret.data(), dst_stride.data(), m_shape.data(), ndim());
+        }
+        return ret;
+    }
+
+    /// Copy the elements of src, which has the same shape, into the view.
+    template <typename U>
+    SimpleArrayView const & assign(SimpleArrayView<U> const & src) const
+    {
+        if (!(src.shape() == m_shape))
+        {
+            throw std::invalid_argument("SimpleArrayView: shape of the source differs from the view");
+        }
+        if (0 != size())
+        {
+            strided_copy(src.origin(), src.stride().data(), m_origin, m_stride.data(), m_shape.data(), ndim());
+            bump_epoch();
+        }
+        return *this;
+    }
+
+    SimpleArrayView const & fill(std::remove_const_t<value_type> const & value) const
+    {
+        if (0 != size())
+        {
+            // A zero stride broadcasts the value over the source.
+            sstride_type const src_stride(ndim(), 0);
+            strided_copy(&value, src_stride.data(), m_origin, m_stride.data(), m_shape.data(), ndim());
+            bump_epoch();
+        }
+        return *this;
+    }
+
+    /// Mark the viewed buffer modified; see ConcreteBuffer::epoch().
+    void bump_epoch() const noexcept
+    {
+        if (m_buffer)
+        {
+            m_buffer->bump_epoch();
+        }
+    }
+
+private:
+
+    template <size_t D>
+    ssize_t offset_impl() const { return 0; }
+
+    template <size_t D, typename Arg, typename... Args>
+    ssize_t offset_impl(Arg arg, Args... args) const
+    {
+        return static_cast<ssize_t>(arg) * m_stride[D] + offset_impl<D + 1>(args...);
+    }
+
+    sstride_type contiguous_stride() const
+    {
+        sstride_type ret(ndim());
+        ssize_t step = 1;
+        for (size_t it = ndim(); it > 0; --it)
+        {
+            ret[it - 1] = step;
+            step *= static_cast<ssize_t>(m_shape[it - 1]);
+        }
+        return ret;
+    }
+
+    void validate_dim(size_t dim) const
+    {
+        if (dim >= ndim())
+        {
+            throw std::out_of_range(Formatter() << "SimpleArrayView: dimension " << dim << " >= " << ndim());
+        }
+    }
+
+    ssize_t normalize_index(size_t dim, ssize_t index) const
+    {
+        auto const extent = static_cast<ssize_t>(m_shape[dim]);
+        ssize_t const normalized = index < 0 ? index + extent : index;
+        if (normalized < 0 || normalized >= extent)
+        {
+            throw std::out_of_range(Formatter() << "SimpleArrayView: index " << index << " out of range in dimension "
+                                                << dim << " of size " << extent);
+        }
+        return normalized;
+    }
+
+    /// Make sure every element of the view lies in the buffer.
+    void validate_extent() const
+    {
+        if (0 == size())
+        {
+            return;
+        }
+        ssize_t low = 0;
+        ssize_t high = 0;
+        for (size_t it = 0; it < ndim(); ++it)
+        {
+            ssize_t const reach = static_cast<ssize_t>(m_shape[it] - 1) * m_stride[it];
+            (reach < 0 ? low : high) += reach;
+        }
+        auto const * begin = reinterpret_cast<int8_t const *>(m_origin + low); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto const * end = reinterpret_cast<int8_t const *>(m_origin + high + 1); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        if (!m_buffer || begin < m_buffer->data() || end > m_buffer->data() + m_buffer->nbytes())
         {
-            for (size_t i = 0; i < athis->size(); ++i)
-            {
-                ret.data(i) = std::abs(athis->data(i));
-            }
+            throw std::out_of_range("SimpleArrayView: view exceeds the buffer");
         }
-        return ret;
     }
-}; /* end class SimpleArrayMixinCalculators */
 
-} /* end namespace detail */
+    std::shared_ptr<buffer_type> m_buffer;
+    value_type * m_origin = nullptr;
+    shape_type m_shape;
+    sstride_type m_stride;
+
+}; /* end class SimpleArrayView */
 
 /**
  * Simple array type for contiguous memory storage. Size does not change. The
@@ -199,6 +1567,8 @@ template <typename T>
 class SimpleArray
     : public detail::SimpleArrayMixinModifiers<SimpleArray<T>, T>
     , public detail::SimpleArrayMixinCalculators<SimpleArray<T>, T>
+    , public detail::SimpleArrayMixinSort<SimpleArray<T>, T>
+    , public detail::SimpleArrayMixinIndexing<SimpleArray<T>, T>
 {
 
 private:
@@ -232,7 +1602,7 @@ public:
     }
 
     // NOLINTNEXTLINE(modernize-pass-by-value)
-    explicit SimpleArray(small_vector<size_t> const & shape)
+    explicit SimpleArray(shape_type const & shape)
         : m_shape(shape)
         , m_stride(calc_stride(m_shape))
     {
@@ -244,12 +1614,29 @@ public:
     }
 
     // NOLINTNEXTLINE(modernize-pass-by-value)
-    explicit SimpleArray(small_vector<size_t> const & shape, value_type const & value)
+    explicit SimpleArray(shape_type const & shape, value_type const & value)
         : SimpleArray(shape)
     {
         std::fill(begin(), end(), value);
     }
 
+    explicit SimpleArray(shape_type const & shape, SimpleArrayUninitialized const &)
+        : SimpleArray(shape)
+    {
+    }
+
+    // NOLINTNEXTLINE(modernize-pass-by-value)
+    explicit SimpleArray(shape_type const & shape, SimpleArrayAlignment const & alignment)
+        : m_shape(shape)
+        , m_stride(calc_stride(m_shape))
+    {
+        if (!m_shape.empty())
+        {
+            m_buffer = buffer_type::construct(m_shape[0] * m_stride[0] * ITEMSIZE, alignment.value);
+            m_body = m_buffer->template data<T>();
+        }
+    }
+
     explicit SimpleArray(std::vector<size_t> const & shape)
         : m_shape(shape)
         , m_stride(calc_stride(m_shape))
@@ -287,7 +1674,7 @@ public:
         }
     }
 
-    explicit SimpleArray(small_vector<size_t> const & shape, std::shared_ptr<buffer_type> const & buffer)
+    explicit SimpleArray(shape_type const & shape, std::shared_ptr<buffer_type> const & buffer)
         : SimpleArray(buffer)
     {
         if (buffer)
@@ -358,6 +1745,15 @@ public:
         return *this;
     }
 
+    /// Evaluate an element-wise expression into the array in a single pass.
+    template <typename E, typename = std::enable_if_t<detail::is_array_expression<E>::value>>
+    SimpleArray & operator=(E const & expr)
+    {
+        expr.assign_to(*this);
+        bump_epoch();
+        return *this;
+    }
+
     ~SimpleArray() = default;
 
     template <typename... Args>
@@ -400,6 +1796,7 @@ public:
 
     size_t nbytes() const noexcept { return m_buffer ? m_buffer->nbytes() : 0; }
     size_t size() const noexcept { return nbytes() / ITEMSIZE; }
+    size_t alignment() const noexcept { return m_buffer ? m_buffer->alignment() : 0; }
 
     using iterator = T *;
     using const_iterator = T const *;
@@ -457,21 +1854,15 @@ public:
     value_type const & at(std::vector<ssize_t> const & idx) const { return at(sshape_type(idx)); }
     value_type & at(std::vector<ssize_t> const & idx) { return at(sshape_type(idx)); }
 
-    value_type const & at(sshape_type sidx) const
+    value_type const & at(sshape_type const & sidx) const
     {
         validate_shape(sidx);
-        sidx[0] += m_nghost;
-        shape_type const idx(sidx.begin(), sidx.end());
-        const size_t offset = buffer_offset(m_stride, idx);
-        return data(offset);
+        return data(ghost_offset(sidx));
     }
-    value_type & at(sshape_type sidx)
+    value_type & at(sshape_type const & sidx)
     {
         validate_shape(sidx);
-        sidx[0] += m_nghost;
-        shape_type const idx(sidx.begin(), sidx.end());
-        const size_t offset = buffer_offset(m_stride, idx);
-        return data(offset);
+        return data(ghost_offset(sidx));
     }
 
     size_t ndim() const noexcept { return m_shape.size(); }
@@ -484,6 +1875,51 @@ public:
 
     size_t nghost() const { return m_nghost; }
     size_t nbody() const { return m_shape.empty() ? 0 : m_shape[0] - m_nghost; }
+
+    /// View of the whole array, ghost included, sharing the buffer.
+    SimpleArrayView<T> view() { return make_view(data(), m_shape); }
+    SimpleArrayView<T const> view() const { return make_view(data(), m_shape); }
+
+    /// View of the body, excluding the ghost, in the first dimension.
+    SimpleArrayView<T> view_body()
+    {
+        return make_view(m_body, first_extent(nbody()));
+    }
+    SimpleArrayView<T const> view_body() const
+    {
+        return make_view(static_cast<value_type const *>(m_body), first_extent(nbody()));
+    }
+
+    /// View of the ghost in the first dimension.
+    SimpleArrayView<T> view_ghost() { return make_view(data(), first_extent(m_nghost)); }
+    SimpleArrayView<T const> view_ghost() const { return make_view(data(), first_extent(m_nghost)); }
+
+    /// Contiguous span over the body, i.e., all elements past the ghost.
+    SimpleArraySpan<T> body_range() { return SimpleArraySpan<T>(m_body, nbody() * row_width()); }
+    SimpleArraySpan<T const> body_range() const { return SimpleArraySpan<T const>(m_body, nbody() * row_width()); }
+
+    /// Contiguous span over the ghost in front of the body.
+    SimpleArraySpan<T> ghost_range() { return SimpleArraySpan<T>(data(), m_nghost * row_width()); }
+    SimpleArraySpan<T const> ghost_range() const { return SimpleArraySpan<T const>(data(), m_nghost * row_width()); }
+
+    /// Rows of the whole array, ghost included.  The array must have rank 2 or higher.
+    SimpleArrayRows<T> rows() { return SimpleArrayRows<T>(data(), checked_row_count(m_shape.empty() ? 0 : m_shape[0]), row_width()); }
+    SimpleArrayRows<T const> rows() const { return SimpleArrayRows<T const>(data(), checked_row_count(m_shape.empty() ? 0 : m_shape[0]), row_width()); }
+
+    /// Rows of the body.  The array must have rank 2 or higher.
+    SimpleArrayRows<T> body_rows() { return SimpleArrayRows<T>(m_body, checked_row_count(nbody()), row_width()); }
+    SimpleArrayRows<T const> body_rows() const { return SimpleArrayRows<T const>(m_body, checked_row_count(nbody()), row_width()); }
+
+    /// Rows of the ghost.  The array must have rank 2 or higher.
+    SimpleArrayRows<T> ghost_rows() { return SimpleArrayRows<T>(data(), checked_row_count(m_nghost), row_width()); }
+    SimpleArrayRows<T const> ghost_rows() const { return SimpleArrayRows<T const>(data(), checked_row_count(m_nghost), row_width()); }
+
+    /// Fixed-rank view with compile-time unrolled indexing.
+    template <size_t ND>
+    SimpleArrayFixedView<T, ND> fixed_view() { return SimpleArrayFixedView<T, ND>(*this); }
+    template <size_t ND>
+    SimpleArrayFixedView<T const, ND> fixed_view() const { return SimpleArrayFixedView<T const, ND>(*this); }
+
     bool has_ghost() const { return m_nghost != 0; }
     void set_nghost(size_t nghost)
     {
@@ -523,6 +1959,34 @@ public:
         return SimpleArray(m_shape, m_buffer);
     }
 
+    /**
+     * Copy a 2D array of shape (n, k) into a new array of shape (k, n), e.g.,
+     * from the interleaved to the per-component layout.  The ghost count is
+     * not kept because the first axis changes.
+     */
+    SimpleArray transpose() const { return transpose(ThreadPool::instance().use_parallel(size())); }
+
+    SimpleArray transpose(bool parallel) const
+    {
+        SimpleArray ret(transposed_shape(), SimpleArrayUninitialized{});
+        transpose(ret, parallel);
+        return ret;
+    }
+
+    /// Transpose into out of shape (k, n), and return it.
+    SimpleArray & transpose(SimpleArray & out) const { return transpose(out, ThreadPool::instance().use_parallel(size())); }
+
+    SimpleArray & transpose(SimpleArray & out, bool parallel) const
+    {
+        if (!(out.shape() == transposed_shape()))
+        {
+            throw std::invalid_argument("SimpleArray: the output of transpose has a wrong shape");
+        }
+        modmesh::transpose(data(), m_shape[0], m_shape[1], out.data(), parallel);
+        out.bump_epoch();
+        return out;
+    }
+
     void swap(SimpleArray & other) noexcept
     {
         if (this != &other)
@@ -554,11 +2018,49 @@ public:
     buffer_type const & buffer() const { return *m_buffer; }
     buffer_type & buffer() { return *m_buffer; }
 
+    /// The modification epoch of the buffer; see ConcreteBuffer::epoch().
+    uint64_t epoch() const noexcept { return m_buffer ? m_buffer->epoch() : 0; }
+    /// Mark the buffer modified after writing through data() or elements.
+    SimpleArray & bump_epoch() noexcept
+    {
+        if (m_buffer)
+        {
+            m_buffer->bump_epoch();
+        }
+        return *this;
+    }
+
+    /**
+     * Mirror the buffer on the device as ConcreteBuffer::to_device() does,
+     * and return the device address of data().  The arrays sharing the buffer
+     * share the mirror.
+     */
+    value_type * to_device(std::shared_ptr<DeviceBackend> const & backend = nullptr)
+    {
+        return static_cast<value_type *>(buffer().to_device(backend));
+    }
+
+    /// Copy the device data back if modified, as ConcreteBuffer::to_host() does.
+    SimpleArray & to_host()
+    {
+        buffer().to_host();
+        return *this;
+    }
+
     value_type const * body() const { return m_body; }
     value_type * body() { return m_body; }
 
 private:
 
+    shape_type transposed_shape() const
+    {
+        if (2 != ndim())
+        {
+            throw std::invalid_argument(Formatter() << "SimpleArray: cannot transpose a " << ndim() << "-dimensional array");
+        }
+        return shape_type{m_shape[1], m_shape[0]};
+    }
+
     void validate_range(ssize_t it) const
     {
         if (m_nghost != 0 && ndim() != 1)
@@ -579,7 +2081,7 @@ private:
         }
     }
 
-    void validate_shape(small_vector<ssize_t> const & idx) const
+    void validate_shape(sshape_type const & idx) const
     {
         auto index2string = [&idx]()
         {
@@ -635,6 +2137,55 @@ private:
         }
     }
 
+    /// Buffer offset of a validated index counted from the body.
+    size_t ghost_offset(sshape_type const & sidx) const
+    {
+        size_t offset = m_nghost * m_stride[0];
+        for (size_t it = 0; it < sidx.size(); ++it)
+        {
+            offset += static_cast<size_t>(sidx[it]) * m_stride[it];
+        }
+        return offset;
+    }
+
+    template <typename U>
+    SimpleArrayView<U> make_view(U * origin, shape_type shape) const
+    {
+        if (!m_buffer || 0 == nbytes())
+        {
+            return SimpleArrayView<U>();
+        }
+        sshape_type stride(m_stride.size());
+        for (size_t it = 0; it < m_stride.size(); ++it)
+        {
+            stride[it] = static_cast<ssize_t>(m_stride[it]);
+        }
+        return SimpleArrayView<U>(m_buffer, origin, std::move(shape), std::move(stride));
+    }
+
+    /// Number of elements addressed by one index in the first dimension.
+    size_t row_width() const noexcept { return m_stride.empty() ? 0 : m_stride[0]; }
+
+    size_t checked_row_count(size_t nrow) const
+    {
+        if (ndim() < 2)
+        {
+            throw std::out_of_range(Formatter() << "SimpleArray: cannot iterate rows of a " << ndim() << "-dimensional array");
+        }
+        return nrow;
+    }
+
+    shape_type first_extent(size_t extent) const
+    {
+        shape_type ret(m_shape);
+        if (ret.empty())
+        {
+            throw std::out_of_range("SimpleArray: cannot view the body or ghost of a 0-dimensional array");
+        }
+        ret[0] = extent;
+        return ret;
+    }
+
     /// Contiguous data buffer for the array.
     std::shared_ptr<buffer_type> m_buffer;
     /// Each element in this vector is the number of element in the
@@ -648,6 +2199,139 @@ private:
     value_type * m_body = nullptr;
 }; /* end class SimpleArray */
 
+/**
+ * Fixed-rank view of a SimpleArray.  The shape and strides live in
+ * std::array and the offset computation unrolls at compile time, so hot
+ * loops do not pay for rank-generic indexing.  Like SimpleArray, the view
+ * is C-contiguous and indexed from the body, so the first index may be
+ * negative to reach the ghost.
+ */
+template <typename T, size_t ND>
+class SimpleArrayFixedView
+{
+
+    static_assert(ND > 0, "SimpleArrayFixedView: rank must be positive");
+
+public:
+
+    using value_type = T;
+    using array_type = SimpleArray<std::remove_const_t<T>>;
+    using source_type = std::conditional_t<std::is_const_v<T>, array_type const, array_type>;
+    using buffer_type = ConcreteBuffer;
+
+    explicit SimpleArrayFixedView(source_type & array)
+    {
+        if (array.ndim() != ND)
+        {
+            throw std::invalid_argument(Formatter() << "SimpleArrayFixedView: array dimension " << array.ndim()
+                                                    << " != view rank " << ND);
+        }
+        m_buffer = std::const_pointer_cast<buffer_type>(array.buffer().shared_from_this());
+        m_body = array.body();
+        m_nghost = array.nghost();
+        for (size_t it = 0; it < ND; ++it)
+        {
+            m_shape[it] = array.shape(it);
+            m_stride[it] = static_cast<ssize_t>(array.stride(it));
+        }
+    }
+
+    static constexpr size_t ndim() noexcept { return ND; }
+    std::array<size_t, ND> const & shape() const noexcept { return m_shape; }
+    size_t shape(size_t it) const noexcept { return m_shape[it]; }
+    std::array<ssize_t, ND> const & stride() const noexcept { return m_stride; }
+    ssize_t stride(size_t it) const noexcept { return m_stride[it]; }
+    size_t size() const noexcept
+    {
+        size_t ret = 1;
+        for (size_t const extent : m_shape)
+        {
+            ret *= extent;
+        }
+        return ret;
+    }
+
+    size_t nghost() const noexcept { return m_nghost; }
+    size_t nbody() const noexcept { return m_shape[0] - m_nghost; }
+
+    value_type * body() const noexcept { return m_body; }
+    value_type * data() const noexcept { return m_body - static_cast<ssize_t>(m_nghost) * m_stride[0]; }
+    std::shared_ptr<buffer_type> const & buffer() const noexcept { return m_buffer; }
+
+    template <typename... Args>
+    value_type & operator()(Args... args) const noexcept
+    {
+        static_assert(sizeof...(Args) == ND, "SimpleArrayFixedView: number of indices must equal the rank");
+        return m_body[offset(std::index_sequence_for<Args...>{}, args...)];
+    }
+
+    /// Element access with bounds check.  The first index ranges over [-nghost, nbody).
+    template <typename... Args>
+    value_type & at(Args... args) const
+    {
+        static_assert(sizeof...(Args) == ND, "SimpleArrayFixedView: number of indices must equal the rank");
+        std::array<ssize_t, ND> const idx{static_cast<ssize_t>(args)...};
+        for (size_t it = 0; it < ND; ++it)
+        {
+            ssize_t const low = 0 == it ? -static_cast<ssize_t>(m_nghost) : 0;
+            ssize_t const high = 0 == it ? static_cast<ssize_t>(nbody()) : static_cast<ssize_t>(m_shape[it]);
+            if (idx[it] < low || idx[it] >= high)
+            {
+                throw std::out_of_range(Formatter() << "SimpleArrayFixedView: index " << idx[it]
+                                                    << " is out of bounds [" << low << ", " << high
+                                                    << ") in dimension " << it);
+            }
+        }
+        return (*this)(args...);
+    }
+
+    /// Dynamic-rank array sharing the buffer.
+    array_type to_array() const
+    {
+        typename array_type::shape_type const shape(m_shape.begin(), m_shape.end());
+        array_type ret(shape, m_buffer);
+        ret.set_nghost(m_nghost);
+        return ret;
+    }
+
+    /// Dynamic-rank strided view of the whole array, ghost included.
+    SimpleArrayView<T> view() const
+    {
+        typename SimpleArrayView<T>::shape_type const shape(m_shape.begin(), m_shape.end());
+        typename SimpleArrayView<T>::sstride_type const stride(m_stride.begin(), m_stride.end());
+        return SimpleArrayView<T>(m_buffer, data(), shape, stride);
+    }
+
+private:
+
+    template <size_t I>
+    ssize_t stride_of() const noexcept
+    {
+        // The last dimension of a C-contiguous array has unit stride.
+        if constexpr (I + 1 == ND)
+        {
+            return 1;
+        }
+        else
+        {
+            return m_stride[I];
+        }
+    }
+
+    template <size_t... I, typename... Args>
+    ssize_t offset(std::index_sequence<I...>, Args... args) const noexcept
+    {
+        return ((static_cast<ssize_t>(args) * stride_of<I>()) + ...);
+    }
+
+    std::shared_ptr<buffer_type> m_buffer;
+    value_type * m_body = nullptr;
+    std::array<size_t, ND> m_shape{};
+    std::array<ssize_t, ND> m_stride{};
+    size_t m_nghost = 0;
+
+}; /* end class SimpleArrayFixedView */
+
 template <typename S>
 using is_simple_array = std::is_same<
     std::remove_reference_t<S>,
@@ -667,6 +2351,8 @@ using SimpleArrayUint32 = SimpleArray<uint32_t>;
 using SimpleArrayUint64 = SimpleArray<uint64_t>;
 using SimpleArrayFloat32 = SimpleArray<float>;
 using SimpleArrayFloat64 = SimpleArray<double>;
+using SimpleArrayFloat16 = SimpleArray<Float16>;
+using SimpleArrayBFloat16 = SimpleArray<BFloat16>;
 
 enum class DataType
 {
@@ -682,18 +2368,134 @@ enum class DataType
     Uint64,
     Float32,
     Float64,
+    Float16,
+    BFloat16,
 }; /* end enum class DataType */
 
 DataType get_data_type_from_string(const std::string & data_type_string);
 
+std::string const & get_string_from_data_type(DataType data_type);
+
 template <typename T>
 DataType get_data_type_from_type();
 
+namespace detail
+{
+
+/// Convert a single element.  The half types only convert explicitly to float.
+template <typename D, typename S>
+D convert_element(S const & value)
+{
+    if constexpr (is_half_v<S> && !std::is_same_v<D, S>)
+    {
+        return static_cast<D>(static_cast<float>(value));
+    }
+    else
+    {
+        return static_cast<D>(value);
+    }
+}
+
+/**
+ * Convert a contiguous range of elements.  The same type is copied as is, the
+ * half types use the SIMD widening and narrowing through float, and the other
+ * pairs use a plain cast loop for the compiler to vectorize.
+ */
+template <typename D, typename S>
+void convert_range(S const * src, size_t size, D * dst)
+{
+    if constexpr (std::is_same_v<D, S>)
+    {
+        std::copy_n(src, size, dst);
+    }
+    else if constexpr ((is_half_v<S> && std::is_floating_point_v<D>) || (is_half_v<D> && std::is_floating_point_v<S>))
+    {
+        simd::convert(src, size, dst);
+    }
+    else if constexpr (is_half_v<S> || is_half_v<D>)
+    {
+        constexpr size_t block = simd::detail::CONVERT_BLOCK_SIZE;
+        float buffer[block]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+        for (size_t it = 0; it < size; it += block)
+        {
+            size_t const count = std::min(block, size - it);
+            if constexpr (is_half_v<S>)
+            {
+                simd::convert(src + it, count, buffer);
+            }
+            else
+            {
+                std::transform(src + it, src + it + count, buffer, [](S v)
+                               { return static_cast<float>(v); });
+            }
+            if constexpr (is_half_v<D>)
+            {
+                simd::convert(buffer, count, dst + it);
+            }
+            else
+            {
+                std::transform(buffer, buffer + count, dst + it, [](float v)
+                               { return static_cast<D>(v); });
+            }
+        }
+    }
+    else
+    {
+        for (size_t it = 0; it < size; ++it)
+        {
+            dst[it] = static_cast<D>(src[it]);
+        }
+    }
+}
+
+/// Wrap func for std::visit over SimpleArrayPlex::variant_type, throwing on
+/// std::monostate.
+template <typename R, typename F>
+auto make_plex_visitor(F & func)
+{
+    return [&func](auto && array) -> R
+    {
+        if constexpr (std::is_same_v<std::decay_t<decltype(array)>, std::monostate>)
+        {
+            throw std::runtime_error("SimpleArrayPlex: no array instance");
+        }
+        else
+        {
+            return func(array);
+        }
+    };
+}
+
+} /* end namespace detail */
+
+/**
+ * SimpleArray of the element type chosen at runtime.  The typed arrays are the
+ * alternatives of a std::variant, and visit() dispatches to the typed array
+ * once for the whole call, so that the bulk operations run the typed kernels.
+ */
 class SimpleArrayPlex
 {
 public:
     using shape_type = detail::shape_type;
 
+    /// The alternatives follow the order of DataType, so that the variant
+    /// index is the data type.
+    using variant_type = std::variant<
+        std::monostate,
+        SimpleArrayBool,
+        SimpleArrayInt8,
+        SimpleArrayInt16,
+        SimpleArrayInt32,
+        SimpleArrayInt64,
+        SimpleArrayUint8,
+        SimpleArrayUint16,
+        SimpleArrayUint32,
+        SimpleArrayUint64,
+        SimpleArrayFloat32,
+        SimpleArrayFloat64,
+        SimpleArrayFloat16,
+        SimpleArrayBFloat16>;
+
     SimpleArrayPlex() = default;
 
     explicit SimpleArrayPlex(const shape_type & shape, const std::string & data_type)
@@ -711,42 +2513,145 @@ public:
 
     template <typename T>
     SimpleArrayPlex(const SimpleArray<T> & array)
+        : m_array(array)
+    {
+    }
+
+    template <typename T>
+    SimpleArrayPlex(SimpleArray<T> && array)
+        : m_array(std::move(array))
     {
-        m_data_type = get_data_type_from_type<T>();
-        m_has_instance_ownership = true;
-        m_instance_ptr = reinterpret_cast<void *>(new SimpleArray<T>(array));
     }
 
-    SimpleArrayPlex(SimpleArrayPlex const & other);
-    SimpleArrayPlex(SimpleArrayPlex && other);
-    SimpleArrayPlex & operator=(SimpleArrayPlex const & other);
-    SimpleArrayPlex & operator=(SimpleArrayPlex && other);
+    SimpleArrayPlex(SimpleArrayPlex const & other) = default;
+    SimpleArrayPlex(SimpleArrayPlex && other) = default;
+    SimpleArrayPlex & operator=(SimpleArrayPlex const & other) = default;
+    SimpleArrayPlex & operator=(SimpleArrayPlex && other) = default;
 
-    ~SimpleArrayPlex();
+    ~SimpleArrayPlex() = default;
 
     DataType data_type() const
     {
-        return m_data_type;
+        return static_cast<DataType>(m_array.index());
     }
 
+    bool has_instance() const noexcept { return !std::holds_alternative<std::monostate>(m_array); }
+
     /// Get the pointer to the const instance of SimpleArray<T>.
     const void * instance_ptr() const
     {
-        return m_instance_ptr;
+        return std::visit(
+            [](auto const & array) -> void const *
+            {
+                if constexpr (std::is_same_v<std::decay_t<decltype(array)>, std::monostate>)
+                {
+                    return nullptr;
+                }
+                else
+                {
+                    return &array;
+                }
+            },
+            m_array);
     }
 
     /// Get the pointer to the mutable instance of SimpleArray<T>.
     void * mutable_instance_ptr() const
     {
-        return m_instance_ptr;
+        return const_cast<void *>(instance_ptr()); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    }
+
+    variant_type const & variant() const { return m_array; }
+    variant_type & variant() { return m_array; }
+
+    /// Get the typed array, or nullptr when the plex holds another type.
+    template <typename A>
+    A const * get_if() const noexcept { return std::get_if<A>(&m_array); }
+    template <typename A>
+    A * get_if() noexcept { return std::get_if<A>(&m_array); }
+
+    /// Call func with the typed array.  All the alternatives should return the
+    /// same type.  Throw when the plex does not hold an array.
+    template <typename F>
+    decltype(auto) visit(F && func)
+    {
+        return std::visit(detail::make_plex_visitor<std::invoke_result_t<F, SimpleArrayFloat64 &>>(func), m_array);
+    }
+
+    template <typename F>
+    decltype(auto) visit(F && func) const
+    {
+        return std::visit(detail::make_plex_visitor<std::invoke_result_t<F, SimpleArrayFloat64 const &>>(func), m_array);
+    }
+
+    shape_type const & shape() const
+    {
+        return visit([](auto const & array) -> shape_type const &
+                     { return array.shape(); });
+    }
+
+    size_t ndim() const { return shape().size(); }
+
+    size_t size() const
+    {
+        return has_instance() ? visit([](auto const & array)
+                                      { return array.size(); })
+                              : 0;
+    }
+
+    size_t nbytes() const
+    {
+        return has_instance() ? visit([](auto const & array)
+                                      { return array.nbytes(); })
+                              : 0;
     }
 
-    /// TODO: add all SimpleArray public methods
+    /// Fill with the value converted to the element type.
+    template <typename V>
+    SimpleArrayPlex & fill(V const & value)
+    {
+        visit(
+            [&value](auto & array)
+            {
+                using value_type = typename std::decay_t<decltype(array)>::value_type;
+                array.fill(detail::convert_element<value_type>(value));
+            });
+        return *this;
+    }
+
+    template <typename R = double>
+    R sum() const
+    {
+        return visit([](auto const & array)
+                     { return detail::convert_element<R>(array.sum()); });
+    }
+
+    template <typename R = double>
+    R min() const
+    {
+        return visit([](auto const & array)
+                     { return detail::convert_element<R>(array.min()); });
+    }
+
+    template <typename R = double>
+    R max() const
+    {
+        return visit([](auto const & array)
+                     { return detail::convert_element<R>(array.max()); });
+    }
+
+    /// Copy the elements of other, converting the element type.  The two
+    /// arrays must have the same number of elements.
+    SimpleArrayPlex & copy_from(SimpleArrayPlex const & other);
+
+    /// Return a new array of the same shape with the elements converted to
+    /// the data type.
+    SimpleArrayPlex astype(DataType data_type) const;
+    SimpleArrayPlex astype(std::string const & data_type) const { return astype(get_data_type_from_string(data_type)); }
 
 private:
-    bool m_has_instance_ownership = false; /// ownership of the instance
-    void * m_instance_ptr = nullptr; /// the pointer of the SimpleArray<T> instance
-    DataType m_data_type = DataType::Undefined; /// the data type for array casting
+
+    variant_type m_array; /// the typed array, or std::monostate for none
 }; /* end class SimpleArrayPlex */
 
 } /* end namespace modmesh */
@@ -0,0 +1,459 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Lazy element-wise expressions over SimpleArray.
+ *
+ * The arithmetic and comparison operators build a tree of expression nodes
+ * instead of computing.  Assigning the tree into a SimpleArray, or calling
+ * evaluate(), computes every element in a single pass without temporary
+ * arrays.  The operands are referenced, not copied, so an expression must
+ * not outlive the arrays it refers to.
+ *
+ *   SimpleArray<double> d = evaluate(a + b * c);
+ *   d = where(a > 0.0, a, -a); // no temporary for the mask
+ */
+
+#include <modmesh/buffer/SimpleArray.hpp>
+#include <modmesh/buffer/ThreadPool.hpp>
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace modmesh
+{
+
+template <typename D>
+class ArrayExpression;
+
+template <typename T>
+class ArrayTerminal;
+
+template <typename T>
+class ScalarTerminal;
+
+namespace detail
+{
+
+template <typename E>
+struct is_expression_node : std::is_base_of<ArrayExpression<E>, E>
+{
+}; /* end struct is_expression_node */
+
+template <typename E>
+struct is_expression_operand : is_expression_node<E>
+{
+}; /* end struct is_expression_operand */
+
+template <typename T>
+struct is_expression_operand<SimpleArray<T>> : std::true_type
+{
+}; /* end struct is_expression_operand */
+
+template <typename E>
+inline constexpr bool is_expression_operand_v = is_expression_operand<std::decay_t<E>>::value;
+
+template <typename E>
+inline constexpr bool is_scalar_operand_v = std::is_arithmetic_v<std::decay_t<E>>;
+
+/// An operator applies when one side is an array or expression and the other is an array, expression or scalar.
+template <typename L, typename R>
+inline constexpr bool is_binary_operands_v =
+    (is_expression_operand_v<L> || is_expression_operand_v<R>) &&
+    (is_expression_operand_v<L> || is_scalar_operand_v<L>) &&
+    (is_expression_operand_v<R> || is_scalar_operand_v<R>);
+
+template <typename E>
+E const & make_operand(ArrayExpression<E> const & expr) { return static_cast<E const &>(expr); }
+
+template <typename T>
+ArrayTerminal<T> make_operand(SimpleArray<T> const & arr) { return ArrayTerminal<T>(arr); }
+
+template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+ScalarTerminal<T> make_operand(T value) { return ScalarTerminal<T>(value); }
+
+template <typename E>
+using operand_t = std::decay_t<decltype(make_operand(std::declval<E const &>()))>;
+
+// clang-format off
+struct Plus { template <typename L, typename R> auto operator()(L l, R r) const { return l + r; } };
+struct Minus { template <typename L, typename R> auto operator()(L l, R r) const { return l - r; } };
+struct Multiplies { template <typename L, typename R> auto operator()(L l, R r) const { return l * r; } };
+struct Divides { template <typename L, typename R> auto operator()(L l, R r) const { return l / r; } };
+struct Less { template <typename L, typename R> bool operator()(L l, R r) const { return l < r; } };
+struct LessEqual { template <typename L, typename R> bool operator()(L l, R r) const { return l <= r; } };
+struct Greater { template <typename L, typename R> bool operator()(L l, R r) const { return l > r; } };
+struct GreaterEqual { template <typename L, typename R> bool operator()(L l, R r) const { return l >= r; } };
+struct EqualTo { template <typename L, typename R> bool operator()(L l, R r) const { return l == r; } };
+struct NotEqualTo { template <typename L, typename R> bool operator()(L l, R r) const { return l != r; } };
+struct Negate { template <typename V> auto operator()(V v) const { return -v; } };
+// clang-format on
+
+} /* end namespace detail */
+
+/**
+ * Base of the expression nodes.  A node exposes value_type, the element at a
+ * flat index with operator[], and the shape of the array operands.
+ */
+template <typename D>
+class ArrayExpression
+{
+
+public:
+
+    using shape_type = detail::shape_type;
+
+    D const & derived() const { return static_cast<D const &>(*this); }
+
+    /// Evaluate into out.  An empty out is allocated with the shape of the expression.
+    template <typename U>
+    void assign_to(SimpleArray<U> & out) const
+    {
+        D const & self = derived();
+        if (!out)
+        {
+            SimpleArray<U>(self.shape()).swap(out);
+            out.set_nghost(self.nghost());
+        }
+        else if (!(out.shape() == self.shape()) || out.nghost() != self.nghost())
+        {
+            throw std::invalid_argument("ArrayExpression: shape of the output array differs from the expression");
+        }
+        size_t const size = out.size();
+        if (0 == size)
+        {
+            return;
+        }
+        U * data = out.data();
+        parallel_for_chunks(
+            size,
+            ThreadPool::instance().use_parallel(size),
+            [&self, data](size_t begin, size_t end)
+            {
+                for (size_t it = begin; it < end; ++it)
+                {
+                    data[it] = static_cast<U>(self[it]);
+                }
+            });
+    }
+
+}; /* end class ArrayExpression */
+
+template <typename T>
+class ArrayTerminal
+    : public ArrayExpression<ArrayTerminal<T>>
+{
+
+public:
+
+    using value_type = T;
+    using shape_type = detail::shape_type;
+
+    explicit ArrayTerminal(SimpleArray<T> const & arr)
+        : m_array(&arr)
+        , m_data(arr.size() ? arr.data() : nullptr)
+    {
+    }
+
+    value_type operator[](size_t it) const { return m_data[it]; }
+
+    static constexpr bool is_scalar() { return false; }
+    shape_type const & shape() const { return m_array->shape(); }
+    size_t nghost() const { return m_array->nghost(); }
+
+private:
+
+    SimpleArray<T> const * m_array;
+    T const * m_data;
+
+}; /* end class ArrayTerminal */
+
+template <typename T>
+class ScalarTerminal
+    : public ArrayExpression<ScalarTerminal<T>>
+{
+
+public:
+
+    using value_type = T;
+    using shape_type = detail::shape_type;
+
+    explicit ScalarTerminal(T value)
+        : m_value(value)
+    {
+    }
+
+    value_type operator[](size_t) const { return m_value; }
+
+    static constexpr bool is_scalar() { return true; }
+    shape_type const & shape() const
+    {
+        static shape_type const empty;
+        return empty;
+    }
+    size_t nghost() const { return 0; }
+
+private:
+
+    T m_value;
+
+}; /* end class ScalarTerminal */
+
+namespace detail
+{
+
+/// Throw if two non-scalar operands have different shapes.
+template <typename L, typename R>
+void check_conform(L const & lhs, R const & rhs)
+{
+    if constexpr (!L::is_scalar() && !R::is_scalar())
+    {
+        if (!(lhs.shape() == rhs.shape()) || lhs.nghost() != rhs.nghost())
+        {
+            throw std::invalid_argument("ArrayExpression: shape of the operands differ");
+        }
+    }
+}
+
+/// The non-scalar of the two operands, which provides the shape.
+template <typename L, typename R>
+auto const & shaped_operand(L const & lhs, R const & rhs)
+{
+    if constexpr (L::is_scalar())
+    {
+        return rhs;
+    }
+    else
+    {
+        return lhs;
+    }
+}
+
+} /* end namespace detail */
+
+template <typename Op, typename E>
+class UnaryArrayExpression
+    : public ArrayExpression<UnaryArrayExpression<Op, E>>
+{
+
+public:
+
+    using value_type = decltype(Op()(std::declval<typename E::value_type>()));
+    using shape_type = detail::shape_type;
+
+    explicit UnaryArrayExpression(E const & operand)
+        : m_operand(operand)
+    {
+    }
+
+    value_type operator[](size_t it) const { return Op()(m_operand[it]); }
+
+    static constexpr bool is_scalar() { return E::is_scalar(); }
+    shape_type const & shape() const { return m_operand.shape(); }
+    size_t nghost() const { return m_operand.nghost(); }
+
+private:
+
+    E m_operand;
+
+}; /* end class UnaryArrayExpression */
+
+template <typename Op, typename L, typename R>
+class BinaryArrayExpression
+    : public ArrayExpression<BinaryArrayExpression<Op, L, R>>
+{
+
+public:
+
+    using value_type = decltype(Op()(std::declval<typename L::value_type>(), std::declval<typename R::value_type>()));
+    using shape_type = detail::shape_type;
+
+    BinaryArrayExpression(L const & lhs, R const & rhs)
+        : m_lhs(lhs)
+        , m_rhs(rhs)
+    {
+        detail::check_conform(m_lhs, m_rhs);
+    }
+
+    value_type operator[](size_t it) const { return Op()(m_lhs[it], m_rhs[it]); }
+
+    static constexpr bool is_scalar() { return L::is_scalar() && R::is_scalar(); }
+    shape_type const & shape() const { return detail::shaped_operand(m_lhs, m_rhs).shape(); }
+    size_t nghost() const { return detail::shaped_operand(m_lhs, m_rhs).nghost(); }
+
+private:
+
+    L m_lhs;
+    R m_rhs;
+
+}; /* end class BinaryArrayExpression */
+
+/// Element-wise selection of lhs where cond is true and rhs elsewhere.
+template <typename C, typename L, typename R>
+class WhereArrayExpression
+    : public ArrayExpression<WhereArrayExpression<C, L, R>>
+{
+
+public:
+
+    using value_type = std::common_type_t<typename L::value_type, typename R::value_type>;
+    using shape_type = detail::shape_type;
+
+    WhereArrayExpression(C const & cond, L const & lhs, R const & rhs)
+        : m_cond(cond)
+        , m_lhs(lhs)
+        , m_rhs(rhs)
+    {
+        detail::check_conform(m_cond, m_lhs);
+        detail::check_conform(m_cond, m_rhs);
+        detail::check_conform(m_lhs, m_rhs);
+    }
+
+    value_type operator[](size_t it) const
+    {
+        return m_cond[it] ? static_cast<value_type>(m_lhs[it]) : static_cast<value_type>(m_rhs[it]);
+    }
+
+    static constexpr bool is_scalar() { return false; }
+    shape_type const & shape() const { return operand().shape(); }
+    size_t nghost() const { return operand().nghost(); }
+
+private:
+
+    auto const & operand() const
+    {
+        if constexpr (!C::is_scalar())
+        {
+            return m_cond;
+        }
+        else if constexpr (!L::is_scalar())
+        {
+            return m_lhs;
+        }
+        else
+        {
+            return m_rhs;
+        }
+    }
+
+    C m_cond;
+    L m_lhs;
+    R m_rhs;
+
+}; /* end class WhereArrayExpression */
+
+namespace detail
+{
+
+template <typename D>
+struct is_expression_node<ArrayExpression<D>> : std::false_type
+{
+}; /* end struct is_expression_node */
+
+template <typename T>
+struct is_array_expression<ArrayTerminal<T>> : std::true_type
+{
+}; /* end struct is_array_expression */
+
+template <typename Op, typename E>
+struct is_array_expression<UnaryArrayExpression<Op, E>> : std::true_type
+{
+}; /* end struct is_array_expression */
+
+template <typename Op, typename L, typename R>
+struct is_array_expression<BinaryArrayExpression<Op, L, R>> : std::true_type
+{
+}; /* end struct is_array_expression */
+
+template <typename C, typename L, typename R>
+struct is_array_expression<WhereArrayExpression<C, L, R>> : std::true_type
+{
+}; /* end struct is_array_expression */
+
+template <typename Op, typename L, typename R>
+auto make_binary(L const & lhs, R const & rhs)
+{
+    using lhs_type = operand_t<L>;
+    using rhs_type = operand_t<R>;
+    return BinaryArrayExpression<Op, lhs_type, rhs_type>(make_operand(lhs), make_operand(rhs));
+}
+
+} /* end namespace detail */
+
+#define MM_DECL_ARRAY_EXPRESSION_OPERATOR(OPERATOR, OP)                          \
+    template <typename L, typename R, typename = std::enable_if_t<detail::is_binary_operands_v<L, R>>> \
+    auto OPERATOR(L const & lhs, R const & rhs)                                  \
+    {                                                                            \
+        return detail::make_binary<detail::OP>(lhs, rhs);                        \
+    }
+
+MM_DECL_ARRAY_EXPRESSION_OPERATOR(operator+, Plus)
+MM_DECL_ARRAY_EXPRESSION_OPERATOR(operator-, Minus)
+MM_DECL_ARRAY_EXPRESSION_OPERATOR(operator*, Multiplies)
+MM_DECL_ARRAY_EXPRESSION_OPERATOR(operator/, Divides)
+MM_DECL_ARRAY_EXPRESSION_OPERATOR(operator<, Less)
+MM_DECL_ARRAY_EXPRESSION_OPERATOR(operator<=, LessEqual)
+MM_DECL_ARRAY_EXPRESSION_OPERATOR(operator>, Greater)
+MM_DECL_ARRAY_EXPRESSION_OPERATOR(operator>=, GreaterEqual)
+MM_DECL_ARRAY_EXPRESSION_OPERATOR(operator==, EqualTo)
+MM_DECL_ARRAY_EXPRESSION_OPERATOR(operator!=, NotEqualTo)
+
+#undef MM_DECL_ARRAY_EXPRESSION_OPERATOR
+
+template <typename E, typename = std::enable_if_t<detail::is_expression_operand_v<E>>>
+auto operator-(E const & operand)
+{
+    using operand_type = detail::operand_t<E>;
+    return UnaryArrayExpression<detail::Negate, operand_type>(detail::make_operand(operand));
+}
+
+template <typename C, typename L, typename R>
+auto where(C const & cond, L const & lhs, R const & rhs)
+{
+    static_assert(detail::is_expression_operand_v<C>, "the condition of where() must be an array or expression");
+    using cond_type = detail::operand_t<C>;
+    using lhs_type = detail::operand_t<L>;
+    using rhs_type = detail::operand_t<R>;
+    return WhereArrayExpression<cond_type, lhs_type, rhs_type>(detail::make_operand(cond), detail::make_operand(lhs), detail::make_operand(rhs));
+}
+
+/// Materialize an expression into a new array of its value type.
+template <typename E>
+SimpleArray<typename E::value_type> evaluate(ArrayExpression<E> const & expr)
+{
+    SimpleArray<typename E::value_type> ret;
+    expr.assign_to(ret);
+    return ret;
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,325 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Extract probes, line cuts, and reductions from a field while a solver
+ * marches, instead of copying the whole field out for every sample.
+ */
+
+#include <modmesh/base.hpp>
+#include <modmesh/buffer/SimpleArray.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace modmesh
+{
+
+enum class MonitorReduction : uint8_t
+{
+    MIN,
+    MAX,
+    MEAN,
+    SUM
+}; /* end enum class MonitorReduction */
+
+/**
+ * Time series of the items registered on a 1D or 2D field.  A probe takes
+ * the value at a row, a line takes a column over a range of rows, and a
+ * reduction takes the minimum, maximum, mean, or sum of a column over a
+ * range of rows.  The rows count from the body of the field, so that the
+ * ghost rows are negative.  For a 1D field the column is 0.
+ *
+ * Each evaluate() appends the time and the values of all the items as one
+ * row of a contiguous buffer.  The items are registered before the first
+ * sample and checked against the field at each evaluate().
+ */
+template <typename T>
+class SimpleArrayMonitor
+{
+
+public:
+
+    using value_type = T;
+    using array_type = SimpleArray<T>;
+
+    SimpleArrayMonitor() = default;
+    SimpleArrayMonitor(SimpleArrayMonitor const &) = default;
+    SimpleArrayMonitor(SimpleArrayMonitor &&) = default;
+    SimpleArrayMonitor & operator=(SimpleArrayMonitor const &) = default;
+    SimpleArrayMonitor & operator=(SimpleArrayMonitor &&) = default;
+    ~SimpleArrayMonitor() = default;
+
+    void add_probe(std::string const & name, ssize_t row, size_t column = 0)
+    {
+        add_item(name, Kind::PROBE, row, row + 1, column, MonitorReduction::SUM);
+    }
+
+    /// Take the column over the rows [begin, end).
+    void add_line(std::string const & name, ssize_t begin, ssize_t end, size_t column = 0)
+    {
+        add_item(name, Kind::LINE, begin, end, column, MonitorReduction::SUM);
+    }
+
+    /// Reduce the column over the rows [begin, end).
+    void add_reduction(std::string const & name, ssize_t begin, ssize_t end, size_t column, MonitorReduction op)
+    {
+        add_item(name, Kind::REDUCTION, begin, end, column, op);
+    }
+
+    /// Append a sample of the field at the time.
+    void evaluate(array_type const & field, double time);
+
+    /// Reserve the buffer for the number of samples.
+    void reserve(size_t nsample)
+    {
+        m_times.reserve(nsample);
+        m_values.reserve(nsample * m_width);
+    }
+
+    /// Drop the samples and keep the items.
+    void clear()
+    {
+        m_times.clear();
+        m_values.clear();
+    }
+
+    size_t nitem() const { return m_items.size(); }
+    size_t nsample() const { return m_times.size(); }
+    /// Number of the values in a sample.
+    size_t width() const { return m_width; }
+
+    std::vector<std::string> names() const;
+
+    /// The times of the samples, in the shape of (nsample,).
+    SimpleArray<double> times() const;
+
+    /**
+     * The series of the item, in the shape of (nsample,) for a probe or a
+     * reduction, and (nsample, end - begin) for a line.
+     */
+    array_type series(std::string const & name) const;
+
+    /// All the values, in the shape of (nsample, width()).
+    array_type values() const;
+
+private:
+
+    enum class Kind : uint8_t
+    {
+        PROBE,
+        LINE,
+        REDUCTION
+    }; /* end enum class Kind */
+
+    struct Item
+    {
+        std::string name;
+        Kind kind;
+        MonitorReduction op;
+        ssize_t begin;
+        ssize_t end;
+        size_t column;
+        // The offset of the values in a sample.
+        size_t offset;
+    }; /* end struct Item */
+
+    void add_item(std::string const & name, Kind kind, ssize_t begin, ssize_t end, size_t column, MonitorReduction op);
+    Item const & find(std::string const & name) const;
+
+    std::vector<Item> m_items;
+    size_t m_width = 0;
+    std::vector<double> m_times;
+    std::vector<T> m_values;
+
+}; /* end class SimpleArrayMonitor */
+
+template <typename T>
+void SimpleArrayMonitor<T>::add_item(std::string const & name, Kind kind, ssize_t begin, ssize_t end, size_t column, MonitorReduction op)
+{
+    if (!m_times.empty())
+    {
+        throw std::runtime_error(Formatter() << "SimpleArrayMonitor: cannot add \"" << name << "\" after " << m_times.size() << " samples");
+    }
+    if (begin >= end)
+    {
+        throw std::invalid_argument(Formatter() << "SimpleArrayMonitor: \"" << name << "\" has an empty range [" << begin << ", " << end << ")");
+    }
+    for (Item const & item : m_items)
+    {
+        if (item.name == name)
+        {
+            throw std::invalid_argument(Formatter() << "SimpleArrayMonitor: duplicate name \"" << name << "\"");
+        }
+    }
+    size_t const width = Kind::LINE == kind ? static_cast<size_t>(end - begin) : 1;
+    m_items.push_back(Item{name, kind, op, begin, end, column, m_width});
+    m_width += width;
+}
+
+template <typename T>
+void SimpleArrayMonitor<T>::evaluate(array_type const & field, double time)
+{
+    if (field.ndim() < 1 || field.ndim() > 2)
+    {
+        throw std::invalid_argument(Formatter() << "SimpleArrayMonitor::evaluate(): field ndim " << field.ndim() << " is not 1 or 2");
+    }
+    ssize_t const lower = -static_cast<ssize_t>(field.nghost());
+    ssize_t const upper = static_cast<ssize_t>(field.nbody());
+    size_t const ncolumn = 2 == field.ndim() ? field.shape(1) : 1;
+    size_t const rstride = field.stride(0);
+    size_t const cstride = 2 == field.ndim() ? field.stride(1) : 0;
+    // Check all the items before appending, to keep the buffer consistent.
+    for (Item const & item : m_items)
+    {
+        if (item.begin < lower || item.end > upper || item.column >= ncolumn)
+        {
+            throw std::out_of_range(Formatter() << "SimpleArrayMonitor::evaluate(): \"" << item.name << "\" rows [" << item.begin << ", " << item.end << ") column " << item.column << " out of rows [" << lower << ", " << upper << ") columns " << ncolumn);
+        }
+    }
+
+    size_t const base = m_values.size();
+    m_values.resize(base + m_width);
+    T * out = m_values.data() + base;
+    T const * body = field.body();
+    for (Item const & item : m_items)
+    {
+        T const * ptr = body + item.begin * static_cast<ssize_t>(rstride) + item.column * cstride;
+        size_t const nrow = static_cast<size_t>(item.end - item.begin);
+        T * dst = out + item.offset;
+        if (Kind::REDUCTION != item.kind)
+        {
+            for (size_t i = 0; i < nrow; ++i)
+            {
+                dst[i] = ptr[i * rstride];
+            }
+            continue;
+        }
+        T acc = ptr[0];
+        switch (item.op)
+        {
+        case MonitorReduction::MIN:
+            for (size_t i = 1; i < nrow; ++i)
+            {
+                acc = std::min(acc, ptr[i * rstride]);
+            }
+            break;
+        case MonitorReduction::MAX:
+            for (size_t i = 1; i < nrow; ++i)
+            {
+                acc = std::max(acc, ptr[i * rstride]);
+            }
+            break;
+        case MonitorReduction::MEAN:
+        case MonitorReduction::SUM:
+            for (size_t i = 1; i < nrow; ++i)
+            {
+                acc += ptr[i * rstride];
+            }
+            if (MonitorReduction::MEAN == item.op)
+            {
+                acc /= static_cast<T>(nrow);
+            }
+            break;
+        }
+        *dst = acc;
+    }
+    m_times.push_back(time);
+}
+
+template <typename T>
+std::vector<std::string> SimpleArrayMonitor<T>::names() const
+{
+    std::vector<std::string> ret;
+    ret.reserve(m_items.size());
+    for (Item const & item : m_items)
+    {
+        ret.push_back(item.name);
+    }
+    return ret;
+}
+
+template <typename T>
+typename SimpleArrayMonitor<T>::Item const & SimpleArrayMonitor<T>::find(std::string const & name) const
+{
+    for (Item const & item : m_items)
+    {
+        if (item.name == name)
+        {
+            return item;
+        }
+    }
+    throw std::out_of_range(Formatter() << "SimpleArrayMonitor: no item \"" << name << "\"");
+}
+
+template <typename T>
+SimpleArray<double> SimpleArrayMonitor<T>::times() const
+{
+    SimpleArray<double> ret(small_vector<size_t>{m_times.size()}, SimpleArrayUninitialized{});
+    std::copy(m_times.begin(), m_times.end(), ret.data());
+    return ret;
+}
+
+template <typename T>
+typename SimpleArrayMonitor<T>::array_type SimpleArrayMonitor<T>::series(std::string const & name) const
+{
+    Item const & item = find(name);
+    size_t const nsample = m_times.size();
+    size_t const width = Kind::LINE == item.kind ? static_cast<size_t>(item.end - item.begin) : 1;
+    small_vector<size_t> shape{nsample};
+    if (Kind::LINE == item.kind)
+    {
+        shape.push_back(width);
+    }
+    array_type ret(shape, SimpleArrayUninitialized{});
+    for (size_t it = 0; it < nsample; ++it)
+    {
+        std::copy_n(m_values.data() + it * m_width + item.offset, width, ret.data() + it * width);
+    }
+    return ret;
+}
+
+template <typename T>
+typename SimpleArrayMonitor<T>::array_type SimpleArrayMonitor<T>::values() const
+{
+    array_type ret(small_vector<size_t>{m_times.size(), m_width}, SimpleArrayUninitialized{});
+    std::copy(m_values.begin(), m_values.end(), ret.data());
+    return ret;
+}
+
+using SimpleArrayMonitorFloat32 = SimpleArrayMonitor<float>;
+using SimpleArrayMonitorFloat64 = SimpleArrayMonitor<double>;
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
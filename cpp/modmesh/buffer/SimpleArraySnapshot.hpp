@@ -0,0 +1,154 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Hand the latest state of a running solver to a reader on another thread,
+ * e.g., the viewer, without making either wait for the other.
+ */
+
+#include <modmesh/buffer/SimpleArray.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+namespace modmesh
+{
+
+/**
+ * Snapshots of an array double buffered between a writer and a reader.  The
+ * writer copies into its back buffer and swaps it with the ready one, and
+ * the reader swaps the ready one into its front buffer.  The lock is held
+ * only for the swaps, so that the writer never waits for the reader to
+ * finish with the front buffer.  A snapshot published before the reader
+ * takes it is replaced by the next.
+ *
+ * There should be one writer thread and one reader thread.
+ */
+template <typename T>
+class SimpleArraySnapshot
+{
+
+public:
+
+    using value_type = T;
+    using array_type = SimpleArray<T>;
+
+    SimpleArraySnapshot() = default;
+    SimpleArraySnapshot(SimpleArraySnapshot const &) = delete;
+    SimpleArraySnapshot(SimpleArraySnapshot &&) = delete;
+    SimpleArraySnapshot & operator=(SimpleArraySnapshot const &) = delete;
+    SimpleArraySnapshot & operator=(SimpleArraySnapshot &&) = delete;
+    ~SimpleArraySnapshot() = default;
+
+    /**
+     * Copy the array and the time into the back buffer and publish them.
+     * The back buffer is reallocated only when the shape changes.
+     *
+     * @return the serial number of the snapshot, counted from 1.
+     */
+    size_t publish(array_type const & array, double time = 0.0);
+
+    /**
+     * Take the latest published snapshot into the front buffer.
+     *
+     * @return false when nothing is published since the last acquire().
+     */
+    bool acquire();
+
+    /// The array taken by acquire(), for the reader thread.
+    array_type const & front() const { return m_slots[m_front].array; }
+    /// The serial number of front(); 0 before the first snapshot.
+    size_t serial() const { return m_slots[m_front].serial; }
+    double time() const { return m_slots[m_front].time; }
+
+    /// Number of the snapshots published.
+    size_t npublished() const { return m_npublished.load(std::memory_order_relaxed); }
+
+private:
+
+    struct Slot
+    {
+        array_type array;
+        size_t serial = 0;
+        double time = 0.0;
+    }; /* end struct Slot */
+
+    std::mutex m_mutex;
+    Slot m_slots[3];
+    // The slots owned by the writer and the reader, and the one handed over.
+    size_t m_back = 0;
+    size_t m_ready = 1;
+    size_t m_front = 2;
+    // The ready slot is newer than the front one.
+    bool m_fresh = false;
+    std::atomic<size_t> m_npublished{0};
+
+}; /* end class SimpleArraySnapshot */
+
+template <typename T>
+size_t SimpleArraySnapshot<T>::publish(array_type const & array, double time)
+{
+    Slot & back = m_slots[m_back];
+    if (!(back.array.shape() == array.shape()))
+    {
+        back.array = array_type(array.shape(), SimpleArrayUninitialized{});
+    }
+    std::copy_n(array.data(), array.size(), back.array.data());
+    back.time = time;
+    back.serial = m_npublished.load(std::memory_order_relaxed) + 1;
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        std::swap(m_back, m_ready);
+        m_fresh = true;
+    }
+    m_npublished.store(back.serial, std::memory_order_relaxed);
+    return back.serial;
+}
+
+template <typename T>
+bool SimpleArraySnapshot<T>::acquire()
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    if (!m_fresh)
+    {
+        return false;
+    }
+    std::swap(m_front, m_ready);
+    m_fresh = false;
+    return true;
+}
+
+using SimpleArraySnapshotFloat32 = SimpleArraySnapshot<float>;
+using SimpleArraySnapshotFloat64 = SimpleArraySnapshot<double>;
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/ThreadPool.hpp>
+
+#include <cstdlib>
+#include <string>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif // __linux__
+
+namespace modmesh
+{
+
+namespace
+{
+
+// Set while a thread executes tasks, to run nested calls serially.
+thread_local bool in_task = false;
+
+// The CPUs allowed for the calling thread, or empty when they cannot be
+// pinned on the platform.
+std::vector<int> allowed_cpus()
+{
+    std::vector<int> ret;
+#ifdef __linux__
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (0 == sched_getaffinity(0, sizeof(allowed), &allowed))
+    {
+        for (int icpu = 0; icpu < CPU_SETSIZE; ++icpu)
+        {
+            if (CPU_ISSET(icpu, &allowed))
+            {
+                ret.push_back(icpu);
+            }
+        }
+    }
+#endif // __linux__
+    return ret;
+}
+
+void pin_thread(std::thread & thread, int icpu)
+{
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(icpu, &set);
+    // Pinning is a hint; a failure leaves the thread to the OS.
+    pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#else // __linux__
+    static_cast<void>(thread);
+    static_cast<void>(icpu);
+#endif // __linux__
+}
+
+} /* end namespace */
+
+ThreadPool & ThreadPool::instance()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+ThreadPool::~ThreadPool()
+{
+    stop_workers();
+}
+
+size_t ThreadPool::default_nthread()
+{
+    char const * env = std::getenv("MODMESH_NUM_THREADS");
+    if (env != nullptr)
+    {
+        try
+        {
+            size_t const value = std::stoul(env);
+            if (value > 0)
+            {
+                return value;
+            }
+        }
+        catch (std::exception const &)
+        {
+            // Ignore a malformed value and fall back to the hardware concurrency.
+        }
+    }
+    size_t const hardware = std::thread::hardware_concurrency();
+    return hardware > 0 ? hardware : 1;
+}
+
+bool ThreadPool::default_pin()
+{
+    char const * env = std::getenv("MODMESH_PIN_THREADS");
+    if (env != nullptr)
+    {
+        try
+        {
+            return 0 != std::stol(env);
+        }
+        catch (std::exception const &)
+        {
+            // Ignore a malformed value and leave the threads unpinned.
+        }
+    }
+    return false;
+}
+
+void ThreadPool::set_nthread(size_t value)
+{
+    std::lock_guard<std::mutex> const run_lock(m_run_mutex);
+    stop_workers();
+    m_nthread.store(value > 0 ? value : default_nthread(), std::memory_order_relaxed);
+}
+
+void ThreadPool::set_pin(bool value)
+{
+    std::lock_guard<std::mutex> const run_lock(m_run_mutex);
+    stop_workers();
+    m_pin.store(value, std::memory_order_relaxed);
+}
+
+void ThreadPool::start_workers(size_t nworker)
+{
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_stop = false;
+    }
+    std::vector<int> const cpus = pin() ? allowed_cpus() : std::vector<int>();
+    m_workers.reserve(nworker);
+    for (size_t it = 0; it < nworker; ++it)
+    {
+        // Slot 0 is the calling thread.
+        m_workers.emplace_back([this, it]()
+                               { worker_loop(it + 1); });
+        if (!cpus.empty())
+        {
+            pin_thread(m_workers.back(), cpus[(it + 1) % cpus.size()]);
+        }
+    }
+}
+
+void ThreadPool::stop_workers()
+{
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (std::thread & worker : m_workers)
+    {
+        worker.join();
+    }
+    m_workers.clear();
+}
+
+void ThreadPool::take_tasks(size_t islot)
+{
+    auto execute = [this](size_t itask)
+    {
+        try
+        {
+            (*m_func)(itask);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> const lock(m_mutex);
+            if (!m_error)
+            {
+                m_error = std::current_exception();
+            }
+        }
+    };
+    if (Schedule::DYNAMIC == m_schedule)
+    {
+        for (size_t itask = m_next.fetch_add(1); itask < m_ntask; itask = m_next.fetch_add(1))
+        {
+            execute(itask);
+        }
+        return;
+    }
+    size_t itask = 0;
+    while (take_from(islot, /* front */ true, itask))
+    {
+        execute(itask);
+    }
+    // Steal from the others, starting from the next slot.
+    for (size_t it = 1; it < m_nblock; ++it)
+    {
+        size_t const victim = (islot + it) % m_nblock;
+        while (take_from(victim, /* front */ false, itask))
+        {
+            execute(itask);
+        }
+    }
+}
+
+bool ThreadPool::take_from(size_t islot, bool front, size_t & itask)
+{
+    Block & block = m_blocks[islot];
+    std::lock_guard<std::mutex> const lock(block.mutex);
+    if (block.begin >= block.end)
+    {
+        return false;
+    }
+    itask = front ? block.begin++ : --block.end;
+    m_next.fetch_add(1);
+    return true;
+}
+
+void ThreadPool::worker_loop(size_t islot)
+{
+    in_task = true;
+    size_t seen = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&]()
+                        { return m_stop || m_generation != seen; });
+            if (m_stop)
+            {
+                return;
+            }
+            seen = m_generation;
+            ++m_nbusy;
+        }
+        take_tasks(islot);
+        {
+            std::lock_guard<std::mutex> const lock(m_mutex);
+            --m_nbusy;
+        }
+        m_done.notify_all();
+    }
+}
+
+void ThreadPool::run(size_t ntask, std::function<void(size_t)> const & func, Schedule schedule)
+{
+    if (in_task || ntask < 2 || nthread() < 2)
+    {
+        for (size_t itask = 0; itask < ntask; ++itask)
+        {
+            func(itask);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> const run_lock(m_run_mutex);
+    size_t const nworker = nthread() - 1;
+    if (m_workers.size() != nworker)
+    {
+        stop_workers();
+        start_workers(nworker);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // A worker woken late for the previous run may still be taking tasks.
+        m_done.wait(lock, [&]()
+                    { return 0 == m_nbusy; });
+        m_func = &func;
+        m_ntask = ntask;
+        m_schedule = schedule;
+        m_next.store(0);
+        if (Schedule::STATIC == schedule)
+        {
+            if (m_nblock != nworker + 1)
+            {
+                m_nblock = nworker + 1;
+                m_blocks = std::make_unique<Block[]>(m_nblock);
+            }
+            for (size_t islot = 0; islot < m_nblock; ++islot)
+            {
+                m_blocks[islot].begin = islot * ntask / m_nblock;
+                m_blocks[islot].end = (islot + 1) * ntask / m_nblock;
+            }
+        }
+        m_error = nullptr;
+        ++m_generation;
+    }
+    m_wake.notify_all();
+
+    in_task = true;
+    take_tasks(0);
+    in_task = false;
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [&]()
+                    { return 0 == m_nbusy && m_next.load() >= m_ntask; });
+        m_func = nullptr;
+        m_ntask = 0;
+        std::swap(error, m_error);
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
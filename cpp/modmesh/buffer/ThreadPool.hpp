@@ -0,0 +1,235 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Fixed-size worker pool shared by the array operations.
+ *
+ * Work is divided into chunks whose boundaries depend only on the problem
+ * size, never on the number of threads.  Reductions combine the per-chunk
+ * results in chunk order, so a parallel result is bit-identical to the
+ * serial result of the same chunked algorithm regardless of the thread count.
+ *
+ * The pool is safe to use from Python with the GIL released: the tasks never
+ * touch Python objects, and a run() from another thread waits for the one in
+ * progress.
+ */
+
+#include <modmesh/base.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace modmesh
+{
+
+class ThreadPool
+{
+
+public:
+
+    /// The process-wide pool used by SimpleArray.
+    static ThreadPool & instance();
+
+    /// Elements processed by one task of the chunked loops.
+    static constexpr size_t CHUNK_SIZE = size_t(1) << 16;
+
+    /**
+     * How run() hands out the tasks.  DYNAMIC takes the next task from a
+     * shared counter, which balances uneven tasks.  STATIC gives each thread
+     * a contiguous block of the tasks, the same for the same ntask and thread
+     * count, and a thread done with its block steals from the back of the
+     * others'.  With pinned threads, a STATIC loop over the pages written by
+     * a STATIC fill mostly reads the memory first touched by the same core,
+     * i.e., of its NUMA node.
+     */
+    enum class Schedule
+    {
+        DYNAMIC,
+        STATIC
+    }; /* end enum class Schedule */
+
+    ThreadPool() = default;
+    ThreadPool(ThreadPool const &) = delete;
+    ThreadPool(ThreadPool &&) = delete;
+    ThreadPool & operator=(ThreadPool const &) = delete;
+    ThreadPool & operator=(ThreadPool &&) = delete;
+    ~ThreadPool();
+
+    /// Number of threads, including the calling thread, used by run().
+    size_t nthread() const { return m_nthread.load(std::memory_order_relaxed); }
+    /**
+     * Set the number of threads.  Zero selects the hardware concurrency.
+     * The workers are started lazily by the next parallel run().
+     */
+    void set_nthread(size_t value);
+
+    /// Arrays with fewer elements than the threshold are processed serially.
+    size_t threshold() const { return m_threshold.load(std::memory_order_relaxed); }
+    void set_threshold(size_t value) { m_threshold.store(value, std::memory_order_relaxed); }
+
+    /// Whether an operation over nelem elements should use the pool.
+    bool use_parallel(size_t nelem) const { return nthread() > 1 && nelem >= threshold(); }
+
+    /// Whether the workers are pinned to the CPUs; only takes effect on Linux.
+    bool pin() const { return m_pin.load(std::memory_order_relaxed); }
+    /**
+     * Pin worker i to the (i+1)-th CPU allowed for the process, wrapping
+     * around, and leave the calling thread to the OS.  The workers are
+     * restarted lazily by the next parallel run().
+     */
+    void set_pin(bool value);
+
+    /**
+     * Call func(itask) for itask in [0, ntask) and wait for all of them.  The
+     * calling thread takes tasks too.  A nested call from inside a task runs
+     * serially.  The first exception thrown by a task is rethrown.
+     */
+    void run(size_t ntask, std::function<void(size_t)> const & func, Schedule schedule = Schedule::DYNAMIC);
+
+    /// MODMESH_NUM_THREADS, or the hardware concurrency.
+    static size_t default_nthread();
+    /// Whether MODMESH_PIN_THREADS is set to a non-zero integer.
+    static bool default_pin();
+
+private:
+
+    // The range of the tasks left in the block of a thread for
+    // Schedule::STATIC.  The owner takes from the front and the others steal
+    // from the back.
+    struct Block
+    {
+        std::mutex mutex;
+        size_t begin = 0;
+        size_t end = 0;
+    }; /* end struct Block */
+
+    void start_workers(size_t nworker);
+    void stop_workers();
+    void worker_loop(size_t islot);
+    // Run the tasks as the thread of the slot; 0 is the calling thread.
+    void take_tasks(size_t islot);
+    bool take_from(size_t islot, bool front, size_t & itask);
+
+    std::atomic<size_t> m_nthread{default_nthread()};
+    std::atomic<size_t> m_threshold{size_t(1) << 20};
+    std::atomic<bool> m_pin{default_pin()};
+
+    std::mutex m_run_mutex; // serializes run()
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    std::vector<std::thread> m_workers;
+    bool m_stop = false;
+    size_t m_generation = 0;
+
+    std::function<void(size_t)> const * m_func = nullptr;
+    size_t m_ntask = 0;
+    Schedule m_schedule = Schedule::DYNAMIC;
+    // The next task of Schedule::DYNAMIC, and the count of the taken tasks
+    // of Schedule::STATIC.
+    std::atomic<size_t> m_next{0};
+    std::unique_ptr<Block[]> m_blocks;
+    size_t m_nblock = 0;
+    size_t m_nbusy = 0;
+    std::exception_ptr m_error;
+
+}; /* end class ThreadPool */
+
+namespace detail
+{
+
+inline size_t chunk_count(size_t nelem) { return (nelem + ThreadPool::CHUNK_SIZE - 1) / ThreadPool::CHUNK_SIZE; }
+
+} /* end namespace detail */
+
+/**
+ * Call func(begin, end) over the chunks of [0, nelem), on the pool with the
+ * schedule when parallel is true.
+ */
+template <typename F>
+void parallel_for_chunks(size_t nelem, bool parallel, ThreadPool::Schedule schedule, F && func)
+{
+    size_t const nchunk = detail::chunk_count(nelem);
+    auto body = [&](size_t ichunk)
+    {
+        size_t const begin = ichunk * ThreadPool::CHUNK_SIZE;
+        size_t const end = std::min(begin + ThreadPool::CHUNK_SIZE, nelem);
+        func(begin, end);
+    };
+    if (parallel && nchunk > 1)
+    {
+        ThreadPool::instance().run(nchunk, body, schedule);
+    }
+    else
+    {
+        for (size_t ichunk = 0; ichunk < nchunk; ++ichunk)
+        {
+            body(ichunk);
+        }
+    }
+}
+
+template <typename F>
+void parallel_for_chunks(size_t nelem, bool parallel, F && func)
+{
+    parallel_for_chunks(nelem, parallel, ThreadPool::Schedule::DYNAMIC, std::forward<F>(func));
+}
+
+/**
+ * Deterministic chunked reduction.  reduce(begin, end) computes the partial
+ * result of a chunk, and the partial results are folded in chunk order with
+ * combine(accumulated, partial) starting from initial.
+ */
+template <typename R, typename F, typename C>
+R parallel_reduce_chunks(size_t nelem, bool parallel, R initial, F && reduce, C && combine)
+{
+    std::vector<R> partials(detail::chunk_count(nelem));
+    parallel_for_chunks(
+        nelem,
+        parallel,
+        [&](size_t begin, size_t end)
+        { partials[begin / ThreadPool::CHUNK_SIZE] = reduce(begin, end); });
+    for (R const & partial : partials)
+    {
+        initial = combine(initial, partial);
+    }
+    return initial;
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -33,7 +33,19 @@
  */
 
 #include <modmesh/buffer/small_vector.hpp>
+#include <modmesh/buffer/strided_copy.hpp>
+#include <modmesh/buffer/MemoryResource.hpp>
+#include <modmesh/buffer/AllocationTracker.hpp>
+#include <modmesh/buffer/DeviceBackend.hpp>
 #include <modmesh/buffer/ConcreteBuffer.hpp>
+#include <modmesh/buffer/MappedBuffer.hpp>
+#include <modmesh/buffer/ThreadPool.hpp>
 #include <modmesh/buffer/SimpleArray.hpp>
+#include <modmesh/buffer/SimpleArrayExpression.hpp>
+#include <modmesh/buffer/SimpleArraySnapshot.hpp>
+#include <modmesh/buffer/SimpleArrayMonitor.hpp>
+#include <modmesh/buffer/CompressedBuffer.hpp>
+#include <modmesh/buffer/QuantizedBuffer.hpp>
+#include <modmesh/buffer/Checkpoint.hpp>
 
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,549 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * 16-bit floating-point element types and their bulk conversion.
+ *
+ * Float16 is the IEEE 754 binary16 format and BFloat16 the upper half of
+ * binary32.  Both are storage types: the arithmetic is carried out in float
+ * and rounded back to nearest-even.  The bulk conversion between the 16-bit
+ * types and float uses F16C (or AVX2 for BFloat16) on x86-64 and NEON on
+ * aarch64, selected with the instruction set of simd::level().
+ *
+ * A double is first rounded to float with round-to-odd so that the final
+ * rounding to 16 bits is the same as a direct rounding.
+ */
+
+#include <modmesh/buffer/simd.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+#if defined(MODMESH_SIMD_X86)
+#define MODMESH_SIMD_TARGET_F16C __attribute__((target("avx,f16c")))
+#endif
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+inline uint32_t float_to_bits(float value)
+{
+    uint32_t ret;
+    std::memcpy(&ret, &value, sizeof(ret));
+    return ret;
+}
+
+inline float bits_to_float(uint32_t bits)
+{
+    float ret;
+    std::memcpy(&ret, &bits, sizeof(ret));
+    return ret;
+}
+
+/**
+ * Round a double to a float with round-to-odd: an inexact result takes the
+ * neighbor with the odd significand.  Rounding the float again to a format
+ * of at most 22 bits of precision then equals the direct rounding.
+ */
+inline float round_to_odd_float(double value)
+{
+    float const ret = static_cast<float>(value);
+    uint32_t bits = float_to_bits(ret);
+    bool const inexact = static_cast<double>(ret) != value && value == value; // NOLINT(misc-redundant-expression)
+    if (inexact && (bits & 1) == 0 && (bits & 0x7fffffff) < 0x7f800000)
+    {
+        bits = std::fabs(static_cast<double>(ret)) < std::fabs(value) ? bits + 1 : bits - 1;
+    }
+    return bits_to_float(bits);
+}
+
+struct Float16Traits
+{
+    static constexpr uint16_t INFINITY_BITS = 0x7c00;
+
+    // Round to nearest-even.  See https://gist.github.com/rygorous/2156668.
+    static uint16_t from_float(float value)
+    {
+        uint32_t fbits = float_to_bits(value);
+        auto const sign = static_cast<uint16_t>((fbits >> 16) & 0x8000);
+        fbits &= 0x7fffffff;
+        if (fbits >= 0x7f800000) // Inf or NaN; NaN is quieted.
+        {
+            return sign | 0x7c00 | (fbits > 0x7f800000 ? (0x200 | ((fbits >> 13) & 0x3ff)) : 0);
+        }
+        if (fbits >= 0x477ff000) // Rounds to or overflows 65520.
+        {
+            return sign | 0x7c00;
+        }
+        if (fbits < 0x38800000) // Subnormal or zero; round with the FPU.
+        {
+            float const denorm_magic = 0.5f;
+            uint32_t const rounded = float_to_bits(bits_to_float(fbits) + denorm_magic);
+            return sign | static_cast<uint16_t>(rounded - float_to_bits(denorm_magic));
+        }
+        uint32_t const odd = (fbits >> 13) & 1;
+        fbits += 0xc8000fff + odd; // Rebias the exponent and round.
+        return sign | static_cast<uint16_t>(fbits >> 13);
+    }
+
+    static float to_float(uint16_t bits)
+    {
+        uint32_t const shifted_exp = 0x7c00 << 13;
+        uint32_t ret = static_cast<uint32_t>(bits & 0x7fff) << 13;
+        uint32_t const exp = shifted_exp & ret;
+        ret += (127 - 15) << 23;
+        if (exp == shifted_exp) // Inf or NaN; NaN is quieted like F16C.
+        {
+            ret += (128 - 16) << 23;
+            ret |= (ret & 0x7fffff) ? 0x400000 : 0;
+        }
+        else if (exp == 0) // Subnormal or zero
+        {
+            ret += 1 << 23;
+            ret = float_to_bits(bits_to_float(ret) - bits_to_float(113 << 23));
+        }
+        ret |= static_cast<uint32_t>(bits & 0x8000) << 16;
+        return bits_to_float(ret);
+    }
+}; /* end struct Float16Traits */
+
+struct BFloat16Traits
+{
+    static constexpr uint16_t INFINITY_BITS = 0x7f80;
+
+    static uint16_t from_float(float value)
+    {
+        uint32_t const fbits = float_to_bits(value);
+        if ((fbits & 0x7fffffff) > 0x7f800000) // NaN is quieted.
+        {
+            return static_cast<uint16_t>((fbits >> 16) | 0x40);
+        }
+        return static_cast<uint16_t>((fbits + 0x7fff + ((fbits >> 16) & 1)) >> 16);
+    }
+
+    static float to_float(uint16_t bits) { return bits_to_float(static_cast<uint32_t>(bits) << 16); }
+}; /* end struct BFloat16Traits */
+
+} /* end namespace detail */
+
+/**
+ * 16-bit floating-point value of the format described by the traits.  It
+ * converts implicitly from arithmetic types and explicitly to them.
+ */
+template <typename Traits>
+class BasicHalf
+{
+
+public:
+
+    using traits_type = Traits;
+
+    BasicHalf() = default;
+
+    // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions)
+    BasicHalf(float value)
+        : m_bits(traits_type::from_float(value))
+    {
+    }
+
+    // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions)
+    BasicHalf(double value)
+        : BasicHalf(detail::round_to_odd_float(value))
+    {
+    }
+
+    template <typename I, typename std::enable_if_t<std::is_integral_v<I>, int> = 0>
+    // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions)
+    BasicHalf(I value)
+        : BasicHalf(static_cast<double>(value))
+    {
+    }
+
+    static constexpr BasicHalf from_bits(uint16_t bits) { return BasicHalf(bits, bits_tag{}); }
+
+    constexpr uint16_t bits() const { return m_bits; }
+
+    explicit operator float() const { return traits_type::to_float(m_bits); }
+
+    BasicHalf operator-() const { return from_bits(m_bits ^ 0x8000); }
+    BasicHalf operator+() const { return *this; }
+
+    BasicHalf & operator+=(BasicHalf other) { return *this = BasicHalf(float(*this) + float(other)); }
+    BasicHalf & operator-=(BasicHalf other) { return *this = BasicHalf(float(*this) - float(other)); }
+    BasicHalf & operator*=(BasicHalf other) { return *this = BasicHalf(float(*this) * float(other)); }
+    BasicHalf & operator/=(BasicHalf other) { return *this = BasicHalf(float(*this) / float(other)); }
+
+    friend BasicHalf operator+(BasicHalf lhs, BasicHalf rhs) { return lhs += rhs; }
+    friend BasicHalf operator-(BasicHalf lhs, BasicHalf rhs) { return lhs -= rhs; }
+    friend BasicHalf operator*(BasicHalf lhs, BasicHalf rhs) { return lhs *= rhs; }
+    friend BasicHalf operator/(BasicHalf lhs, BasicHalf rhs) { return lhs /= rhs; }
+
+    friend bool operator==(BasicHalf lhs, BasicHalf rhs) { return float(lhs) == float(rhs); }
+    friend bool operator!=(BasicHalf lhs, BasicHalf rhs) { return float(lhs) != float(rhs); }
+    friend bool operator<(BasicHalf lhs, BasicHalf rhs) { return float(lhs) < float(rhs); }
+    friend bool operator<=(BasicHalf lhs, BasicHalf rhs) { return float(lhs) <= float(rhs); }
+    friend bool operator>(BasicHalf lhs, BasicHalf rhs) { return float(lhs) > float(rhs); }
+    friend bool operator>=(BasicHalf lhs, BasicHalf rhs) { return float(lhs) >= float(rhs); }
+
+    friend bool isnan(BasicHalf value) { return (value.m_bits & 0x7fff) > traits_type::INFINITY_BITS; }
+    friend bool isinf(BasicHalf value) { return (value.m_bits & 0x7fff) == traits_type::INFINITY_BITS; }
+    friend bool isfinite(BasicHalf value) { return (value.m_bits & traits_type::INFINITY_BITS) != traits_type::INFINITY_BITS; }
+
+    friend std::ostream & operator<<(std::ostream & os, BasicHalf value) { return os << float(value); }
+
+private:
+
+    struct bits_tag
+    {
+    };
+
+    constexpr BasicHalf(uint16_t bits, bits_tag)
+        : m_bits(bits)
+    {
+    }
+
+    uint16_t m_bits;
+
+}; /* end class BasicHalf */
+
+using Float16 = BasicHalf<detail::Float16Traits>;
+using BFloat16 = BasicHalf<detail::BFloat16Traits>;
+
+static_assert(sizeof(Float16) == 2 && std::is_trivially_copyable_v<Float16>, "Float16 must be a 2-byte trivial type");
+static_assert(sizeof(BFloat16) == 2 && std::is_trivially_copyable_v<BFloat16>, "BFloat16 must be a 2-byte trivial type");
+
+template <typename T>
+inline constexpr bool is_half_v = std::is_same_v<T, Float16> || std::is_same_v<T, BFloat16>;
+
+namespace simd
+{
+
+namespace detail
+{
+
+/// Number of double elements converted through a float buffer at a time.
+constexpr size_t CONVERT_BLOCK_SIZE = 256;
+
+template <typename H>
+void widen_generic(H const * src, size_t size, float * dst)
+{
+    for (size_t it = 0; it < size; ++it)
+    {
+        dst[it] = static_cast<float>(src[it]);
+    }
+}
+
+template <typename H>
+void narrow_generic(float const * src, size_t size, H * dst)
+{
+    for (size_t it = 0; it < size; ++it)
+    {
+        dst[it] = H(src[it]);
+    }
+}
+
+#if defined(MODMESH_SIMD_X86)
+
+inline bool has_f16c()
+{
+    static bool const value = __builtin_cpu_supports("f16c");
+    return value;
+}
+
+MODMESH_SIMD_TARGET_F16C inline void widen_f16c(Float16 const * src, size_t size, float * dst)
+{
+    size_t it = 0;
+    for (; it + 8 <= size; it += 8)
+    {
+        __m128i const half = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + it));
+        _mm256_storeu_ps(dst + it, _mm256_cvtph_ps(half));
+    }
+    widen_generic(src + it, size - it, dst + it);
+}
+
+MODMESH_SIMD_TARGET_F16C inline void narrow_f16c(float const * src, size_t size, Float16 * dst)
+{
+    size_t it = 0;
+    for (; it + 8 <= size; it += 8)
+    {
+        __m128i const half = _mm256_cvtps_ph(_mm256_loadu_ps(src + it), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + it), half);
+    }
+    narrow_generic(src + it, size - it, dst + it);
+}
+
+MODMESH_SIMD_TARGET_AVX2 inline void widen_bf16_avx2(BFloat16 const * src, size_t size, float * dst)
+{
+    size_t it = 0;
+    for (; it + 8 <= size; it += 8)
+    {
+        __m256i const wide = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(src + it)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + it), _mm256_slli_epi32(wide, 16));
+    }
+    widen_generic(src + it, size - it, dst + it);
+}
+
+MODMESH_SIMD_TARGET_AVX2 inline void narrow_bf16_avx2(float const * src, size_t size, BFloat16 * dst)
+{
+    size_t it = 0;
+    __m256i const one = _mm256_set1_epi32(1);
+    __m256i const bias = _mm256_set1_epi32(0x7fff);
+    __m256i const quiet = _mm256_set1_epi32(0x40);
+    for (; it + 8 <= size; it += 8)
+    {
+        __m256 const value = _mm256_loadu_ps(src + it);
+        __m256i const bits = _mm256_castps_si256(value);
+        __m256i const upper = _mm256_srli_epi32(bits, 16);
+        __m256i const odd = _mm256_and_si256(upper, one);
+        __m256i const rounded = _mm256_srli_epi32(_mm256_add_epi32(bits, _mm256_add_epi32(bias, odd)), 16);
+        __m256i const nan = _mm256_castps_si256(_mm256_cmp_ps(value, value, _CMP_UNORD_Q));
+        __m256i const result = _mm256_blendv_epi8(rounded, _mm256_or_si256(upper, quiet), nan);
+        // Pack the 32-bit lanes of both 128-bit halves into the lower half.
+        __m256i const packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(result, result), 0xd8);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + it), _mm256_castsi256_si128(packed));
+    }
+    narrow_generic(src + it, size - it, dst + it);
+}
+
+#elif defined(MODMESH_SIMD_NEON)
+
+inline void widen_f16_neon(Float16 const * src, size_t size, float * dst)
+{
+    size_t it = 0;
+    for (; it + 4 <= size; it += 4)
+    {
+        float16x4_t const half = vld1_f16(reinterpret_cast<float16_t const *>(src + it));
+        vst1q_f32(dst + it, vcvt_f32_f16(half));
+    }
+    widen_generic(src + it, size - it, dst + it);
+}
+
+inline void narrow_f16_neon(float const * src, size_t size, Float16 * dst)
+{
+    size_t it = 0;
+    for (; it + 4 <= size; it += 4)
+    {
+        vst1_f16(reinterpret_cast<float16_t *>(dst + it), vcvt_f16_f32(vld1q_f32(src + it)));
+    }
+    narrow_generic(src + it, size - it, dst + it);
+}
+
+inline void widen_bf16_neon(BFloat16 const * src, size_t size, float * dst)
+{
+    size_t it = 0;
+    for (; it + 4 <= size; it += 4)
+    {
+        uint16x4_t const half = vld1_u16(reinterpret_cast<uint16_t const *>(src + it));
+        vst1q_f32(dst + it, vreinterpretq_f32_u32(vshll_n_u16(half, 16)));
+    }
+    widen_generic(src + it, size - it, dst + it);
+}
+
+inline void narrow_bf16_neon(float const * src, size_t size, BFloat16 * dst)
+{
+    size_t it = 0;
+    for (; it + 4 <= size; it += 4)
+    {
+        float32x4_t const value = vld1q_f32(src + it);
+        uint32x4_t const bits = vreinterpretq_u32_f32(value);
+        uint32x4_t const odd = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+        uint16x4_t const rounded = vshrn_n_u32(vaddq_u32(bits, vaddq_u32(odd, vdupq_n_u32(0x7fff))), 16);
+        uint16x4_t const quieted = vorr_u16(vshrn_n_u32(bits, 16), vdup_n_u16(0x40));
+        uint16x4_t const number = vmovn_u32(vceqq_f32(value, value));
+        vst1_u16(reinterpret_cast<uint16_t *>(dst + it), vbsl_u16(number, rounded, quieted));
+    }
+    narrow_generic(src + it, size - it, dst + it);
+}
+
+#endif
+
+} /* end namespace detail */
+
+inline void convert(Float16 const * src, size_t size, float * dst)
+{
+#if defined(MODMESH_SIMD_X86)
+    if (SimdLevel::Generic != level() && detail::has_f16c())
+    {
+        detail::widen_f16c(src, size, dst);
+        return;
+    }
+#elif defined(MODMESH_SIMD_NEON)
+    if (SimdLevel::NEON == level())
+    {
+        detail::widen_f16_neon(src, size, dst);
+        return;
+    }
+#endif
+    detail::widen_generic(src, size, dst);
+}
+
+inline void convert(float const * src, size_t size, Float16 * dst)
+{
+#if defined(MODMESH_SIMD_X86)
+    if (SimdLevel::Generic != level() && detail::has_f16c())
+    {
+        detail::narrow_f16c(src, size, dst);
+        return;
+    }
+#elif defined(MODMESH_SIMD_NEON)
+    if (SimdLevel::NEON == level())
+    {
+        detail::narrow_f16_neon(src, size, dst);
+        return;
+    }
+#endif
+    detail::narrow_generic(src, size, dst);
+}
+
+inline void convert(BFloat16 const * src, size_t size, float * dst)
+{
+#if defined(MODMESH_SIMD_X86)
+    if (SimdLevel::Generic != level())
+    {
+        detail::widen_bf16_avx2(src, size, dst);
+        return;
+    }
+#elif defined(MODMESH_SIMD_NEON)
+    if (SimdLevel::NEON == level())
+    {
+        detail::widen_bf16_neon(src, size, dst);
+        return;
+    }
+#endif
+    detail::widen_generic(src, size, dst);
+}
+
+inline void convert(float const * src, size_t size, BFloat16 * dst)
+{
+#if defined(MODMESH_SIMD_X86)
+    if (SimdLevel::Generic != level())
+    {
+        detail::narrow_bf16_avx2(src, size, dst);
+        return;
+    }
+#elif defined(MODMESH_SIMD_NEON)
+    if (SimdLevel::NEON == level())
+    {
+        detail::narrow_bf16_neon(src, size, dst);
+        return;
+    }
+#endif
+    detail::narrow_generic(src, size, dst);
+}
+
+/// Widen to double through a float buffer; both steps are exact.
+template <typename H>
+std::enable_if_t<is_half_v<H>> convert(H const * src, size_t size, double * dst)
+{
+    float buffer[detail::CONVERT_BLOCK_SIZE]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    for (size_t it = 0; it < size; it += detail::CONVERT_BLOCK_SIZE)
+    {
+        size_t const count = std::min(detail::CONVERT_BLOCK_SIZE, size - it);
+        convert(src + it, count, buffer);
+        std::copy_n(buffer, count, dst + it);
+    }
+}
+
+/// Narrow from double through a float buffer rounded to odd.
+template <typename H>
+std::enable_if_t<is_half_v<H>> convert(double const * src, size_t size, H * dst)
+{
+    float buffer[detail::CONVERT_BLOCK_SIZE]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    for (size_t it = 0; it < size; it += detail::CONVERT_BLOCK_SIZE)
+    {
+        size_t const count = std::min(detail::CONVERT_BLOCK_SIZE, size - it);
+        for (size_t k = 0; k < count; ++k)
+        {
+            buffer[k] = modmesh::detail::round_to_odd_float(src[it + k]);
+        }
+        convert(buffer, count, dst + it);
+    }
+}
+
+} /* end namespace simd */
+
+} /* end namespace modmesh */
+
+namespace std
+{
+
+template <typename Traits>
+class numeric_limits<modmesh::BasicHalf<Traits>>
+{
+
+public:
+
+    using value_type = modmesh::BasicHalf<Traits>;
+
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr bool has_signaling_NaN = true;
+    static constexpr bool is_iec559 = std::is_same_v<Traits, modmesh::detail::Float16Traits>;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = false;
+    static constexpr int radix = 2;
+    static constexpr int digits = std::is_same_v<Traits, modmesh::detail::Float16Traits> ? 11 : 8;
+    static constexpr int min_exponent = std::is_same_v<Traits, modmesh::detail::Float16Traits> ? -13 : -125;
+    static constexpr int max_exponent = std::is_same_v<Traits, modmesh::detail::Float16Traits> ? 16 : 128;
+    static constexpr float_round_style round_style = round_to_nearest;
+
+    static constexpr value_type min() noexcept { return pick(0x0400, 0x0080); }
+    static constexpr value_type lowest() noexcept { return pick(0xfbff, 0xff7f); }
+    static constexpr value_type max() noexcept { return pick(0x7bff, 0x7f7f); }
+    static constexpr value_type epsilon() noexcept { return pick(0x1400, 0x3c00); }
+    static constexpr value_type round_error() noexcept { return pick(0x3800, 0x3f00); }
+    static constexpr value_type infinity() noexcept { return pick(0x7c00, 0x7f80); }
+    static constexpr value_type quiet_NaN() noexcept { return pick(0x7e00, 0x7fc0); }
+    static constexpr value_type signaling_NaN() noexcept { return pick(0x7d00, 0x7fa0); }
+    static constexpr value_type denorm_min() noexcept { return pick(0x0001, 0x0001); }
+
+private:
+
+    static constexpr value_type pick(uint16_t float16, uint16_t bfloat16)
+    {
+        return value_type::from_bits(std::is_same_v<Traits, modmesh::detail::Float16Traits> ? float16 : bfloat16);
+    }
+
+}; /* end class numeric_limits */
+
+} /* end namespace std */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,231 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <pybind11/pybind11.h> // Must be the first include.
+
+#include <modmesh/buffer/buffer.hpp>
+
+#include <vector>
+
+namespace modmesh
+{
+
+namespace python
+{
+
+/**
+ * The DLPack ABI (https://dmlc.github.io/dlpack/latest/c_api.html), declared
+ * here so that no header of the specification is required at build time.
+ */
+namespace dlpack
+{
+
+enum DLDeviceType : int32_t
+{
+    kDLCPU = 1,
+}; /* end enum DLDeviceType */
+
+enum DLDataTypeCode : uint8_t
+{
+    kDLInt = 0,
+    kDLUInt = 1,
+    kDLFloat = 2,
+    kDLBool = 6,
+}; /* end enum DLDataTypeCode */
+
+struct DLDevice
+{
+    int32_t device_type;
+    int32_t device_id;
+}; /* end struct DLDevice */
+
+struct DLDataType
+{
+    uint8_t code;
+    uint8_t bits;
+    uint16_t lanes;
+}; /* end struct DLDataType */
+
+struct DLTensor
+{
+    void * data;
+    DLDevice device;
+    int32_t ndim;
+    DLDataType dtype;
+    int64_t * shape;
+    int64_t * strides;
+    uint64_t byte_offset;
+}; /* end struct DLTensor */
+
+struct DLManagedTensor
+{
+    DLTensor dl_tensor;
+    void * manager_ctx;
+    void (*deleter)(DLManagedTensor * self);
+}; /* end struct DLManagedTensor */
+
+/// Name of a capsule holding an unconsumed DLManagedTensor.
+inline constexpr char const * CAPSULE_NAME = "dltensor";
+/// Name a consumer gives the capsule after taking over the tensor.
+inline constexpr char const * USED_CAPSULE_NAME = "used_dltensor";
+
+template <typename T>
+DLDataType make_dtype()
+{
+    uint8_t code = kDLFloat;
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        code = kDLBool;
+    }
+    else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+    {
+        code = kDLInt;
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        code = kDLUInt;
+    }
+    return DLDataType{code, static_cast<uint8_t>(sizeof(T) * 8), 1};
+}
+
+/**
+ * Owner of an exported tensor.  It keeps the buffer alive until the consumer
+ * calls the deleter.
+ */
+struct ExportContext
+{
+    std::shared_ptr<ConcreteBuffer> buffer;
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides;
+    DLManagedTensor tensor{};
+
+    static void deleter(DLManagedTensor * self)
+    {
+        // The buffer may be owned by an ndarray, whose release needs the GIL.
+        pybind11::gil_scoped_acquire const gil;
+        delete static_cast<ExportContext *>(self->manager_ctx); // NOLINT(cppcoreguidelines-owning-memory)
+    }
+}; /* end struct ExportContext */
+
+/**
+ * Borrow the memory of an imported tensor.  The deleter of the producer is
+ * called when the ConcreteBuffer is destroyed.
+ */
+struct ConcreteBufferDLPackRemover : ConcreteBuffer::remover_type
+{
+
+    explicit ConcreteBufferDLPackRemover(DLManagedTensor * tensor_in)
+        : tensor(tensor_in)
+    {
+    }
+
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays,readability-non-const-parameter)
+    void operator()(int8_t *) const override
+    {
+        if (tensor->deleter)
+        {
+            pybind11::gil_scoped_acquire const gil;
+            tensor->deleter(tensor);
+        }
+    }
+
+    DLManagedTensor * tensor;
+
+}; /* end struct ConcreteBufferDLPackRemover */
+
+/**
+ * Export the whole array, ghost included, as a DLPack capsule sharing the
+ * buffer.  A read-only buffer cannot be exported because DLPack has no way
+ * to tell the consumer not to write.
+ */
+template <typename T>
+pybind11::capsule to_capsule(SimpleArray<T> const & array)
+{
+    namespace py = pybind11;
+
+    if (array && array.buffer().is_readonly())
+    {
+        throw py::buffer_error("SimpleArray: cannot export a read-only buffer through DLPack");
+    }
+    auto ctx = std::make_unique<ExportContext>();
+    if (array)
+    {
+        ctx->buffer = std::const_pointer_cast<ConcreteBuffer>(array.buffer().shared_from_this());
+    }
+    ctx->shape.assign(array.shape().begin(), array.shape().end());
+    ctx->strides.assign(array.stride().begin(), array.stride().end());
+
+    DLTensor & tensor = ctx->tensor.dl_tensor;
+    tensor.data = array ? const_cast<T *>(array.data()) : nullptr; // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    tensor.device = DLDevice{kDLCPU, 0};
+    tensor.ndim = static_cast<int32_t>(array.ndim());
+    tensor.dtype = make_dtype<T>();
+    tensor.shape = ctx->shape.data();
+    tensor.strides = ctx->strides.data();
+    tensor.byte_offset = 0;
+    ctx->tensor.manager_ctx = ctx.get();
+    ctx->tensor.deleter = &ExportContext::deleter;
+
+    PyObject * capsule = PyCapsule_New(
+        &ctx->tensor,
+        CAPSULE_NAME,
+        [](PyObject * self)
+        {
+            // A consumed capsule is renamed and the consumer owns the tensor.
+            if (PyCapsule_IsValid(self, CAPSULE_NAME))
+            {
+                auto * managed = static_cast<DLManagedTensor *>(PyCapsule_GetPointer(self, CAPSULE_NAME));
+                managed->deleter(managed);
+            }
+        });
+    if (nullptr == capsule)
+    {
+        throw py::error_already_set();
+    }
+    ctx.release(); // NOLINT(bugprone-unused-return-value) owned by the capsule now
+    return py::reinterpret_steal<py::capsule>(capsule);
+}
+
+/// Import a DLPack capsule or an object with __dlpack__ as a SimpleArray of the matching type.
+pybind11::object from_dlpack(pybind11::object const & obj);
+
+pybind11::capsule to_capsule(SimpleArrayPlex const & array_plex);
+
+inline pybind11::tuple device()
+{
+    return pybind11::make_tuple(static_cast<int32_t>(kDLCPU), 0);
+}
+
+} /* end namespace dlpack */
+
+} /* end namespace python */
+
+} /* end namespace modmesh */
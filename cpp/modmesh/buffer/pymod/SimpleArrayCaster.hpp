@@ -64,19 +64,12 @@ namespace detail
                 return false;                                                                                                                                 \
             }                                                                                                                                                 \
                                                                                                                                                               \
-            /* Get the SimpleArrayPlex object from the source handle */                                                                                       \
-            modmesh::SimpleArrayPlex arrayplex = src.cast<modmesh::SimpleArrayPlex>();                                                                        \
+            /* Borrow the typed array held by the SimpleArrayPlex object; it lives as long as src */                                                          \
+            modmesh::SimpleArrayPlex & arrayplex = src.cast<modmesh::SimpleArrayPlex &>();                                                                    \
                                                                                                                                                               \
-            /* Check if the data type is matched */                                                                                                           \
-            if (arrayplex.data_type() != modmesh::DataType::DATATYPE)                                                                                         \
-            {                                                                                                                                                 \
-                return false;                                                                                                                                 \
-            }                                                                                                                                                 \
-                                                                                                                                                              \
-            /* construct the new array from the arrayplex */                                                                                                  \
-            const modmesh::SimpleArray##DATATYPE * array_from_arrayplex = reinterpret_cast<const modmesh::SimpleArray##DATATYPE *>(arrayplex.instance_ptr()); \
-            value = const_cast<modmesh::SimpleArray##DATATYPE *>(array_from_arrayplex);                                                                       \
-            return true;                                                                                                                                      \
+            /* The typed array is null if the data type is not matched */                                                                                     \
+            value = arrayplex.get_if<modmesh::SimpleArray##DATATYPE>();                                                                                       \
+            return value != nullptr;                                                                                                                          \
         }                                                                                                                                                     \
                                                                                                                                                               \
         /* Conversion from C++ to Python object */                                                                                                            \
@@ -31,6 +31,7 @@
 #include <pybind11/pybind11.h> // Must be the first include.
 #include <pybind11/numpy.h>
 #include <modmesh/buffer/SimpleArray.hpp>
+#include <modmesh/buffer/strided_copy.hpp>
 
 namespace modmesh
 {
@@ -43,68 +44,50 @@ struct TypeBroadcastImpl
     using slice_type = small_vector<int>;
     using shape_type = typename SimpleArray<T>::shape_type;
 
-    // NOLINTNEXTLINE(misc-no-recursion)
-    static void copy_idx(SimpleArray<T> & arr_out, std::vector<slice_type> const & slices, pybind11::array_t<D> const * arr_in, shape_type left_shape, shape_type sidx, int dim)
-    {
-        using out_type = typename std::remove_reference_t<decltype(arr_out[0])>;
-
-        if (dim < 0)
-        {
-            return;
-        }
-
-        for (size_t i = 0; i < left_shape[dim]; ++i)
-        {
-            sidx[dim] = i;
-
-            size_t offset_in = 0;
-            for (pybind11::ssize_t it = 0; it < arr_in->ndim(); ++it)
-            {
-                offset_in += arr_in->strides(it) / arr_in->itemsize() * sidx[it];
-            }
-            const D * ptr_in = arr_in->data() + offset_in;
-
-            size_t offset_out = 0;
-            for (size_t it = 0; it < arr_out.ndim(); ++it)
-            {
-                auto step = slices[it][2];
-                offset_out += arr_out.stride(it) * sidx[it] * step;
-            }
-
-            // NOLINTNEXTLINE(bugprone-signed-char-misuse, cert-str34-c)
-            arr_out.at(offset_out) = static_cast<out_type>(*ptr_in);
-            // recursion here
-            copy_idx(arr_out, slices, arr_in, left_shape, sidx, dim - 1);
-        }
-    }
-
     static void broadcast(SimpleArray<T> & arr_out, std::vector<slice_type> const & slices, pybind11::array const & arr_in)
     {
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        auto * arr_new = reinterpret_cast<pybind11::array_t<D> const *>(&arr_in);
-
-        shape_type left_shape(arr_out.ndim());
-        for (size_t i = 0; i < arr_out.ndim(); i++)
+        size_t const ndim = arr_out.ndim();
+        shape_type left_shape(ndim);
+        typename SimpleArray<T>::sshape_type stride_out(ndim);
+        typename SimpleArray<T>::sshape_type stride_in(ndim);
+        ssize_t offset_out = 0;
+        for (size_t i = 0; i < ndim; ++i)
         {
             slice_type const & slice = slices[i];
-            if ((slice[1] - slice[0]) % slice[2] == 0)
+            left_shape[i] = count_slice(slice);
+            stride_out[i] = static_cast<ssize_t>(arr_out.stride(i)) * slice[2];
+            stride_in[i] = arr_in.strides(static_cast<pybind11::ssize_t>(i)) / static_cast<ssize_t>(sizeof(D));
+            offset_out += static_cast<ssize_t>(arr_out.stride(i)) * slice[0];
+            // Check the range of the slice once instead of for every element.
+            if (left_shape[i] > 0)
             {
-                left_shape[i] = (slice[1] - slice[0]) / slice[2];
-            }
-            else
-            {
-                left_shape[i] = (slice[1] - slice[0]) / slice[2] + 1;
+                ssize_t const last = slice[0] + static_cast<ssize_t>(left_shape[i] - 1) * slice[2];
+                if (slice[0] < 0 || last < 0 || slice[0] >= static_cast<ssize_t>(arr_out.shape(i)) || last >= static_cast<ssize_t>(arr_out.shape(i)))
+                {
+                    throw std::out_of_range(Formatter() << "SimpleArray: slice [" << slice[0] << ":" << slice[1] << ":" << slice[2]
+                                                        << "] out of range in dimension " << i << " of size " << arr_out.shape(i));
+                }
             }
         }
+        if (0 == arr_out.size())
+        {
+            return;
+        }
 
-        shape_type sidx_init(arr_out.ndim());
+        D const * ptr_in = static_cast<D const *>(arr_in.data());
+        T * ptr_out = arr_out.data() + offset_out;
+
+        pybind11::gil_scoped_release const release;
+        strided_copy(ptr_in, stride_in.data(), ptr_out, stride_out.data(), left_shape.data(), ndim);
+    }
 
-        for (size_t i = 0; i < arr_out.ndim(); ++i)
+    static size_t count_slice(slice_type const & slice)
+    {
+        if ((slice[1] - slice[0]) % slice[2] == 0)
         {
-            sidx_init[i] = 0;
+            return (slice[1] - slice[0]) / slice[2];
         }
-
-        copy_idx(arr_out, slices, arr_new, left_shape, sidx_init, static_cast<int>(arr_out.ndim()) - 1);
+        return (slice[1] - slice[0]) / slice[2] + 1;
     }
 }; /* end struct TypeBroadcastImpl */
 
@@ -173,9 +156,9 @@ struct TypeBroadcast
         {
             TypeBroadcastImpl<T, int64_t>::broadcast(arr_out, slices, arr_in);
         }
-        else if (dtype_is_type<uint32_t>(arr_in))
+        else if (dtype_is_type<uint8_t>(arr_in))
         {
-            TypeBroadcastImpl<T, uint32_t>::broadcast(arr_out, slices, arr_in);
+            TypeBroadcastImpl<T, uint8_t>::broadcast(arr_out, slices, arr_in);
         }
         else if (dtype_is_type<uint16_t>(arr_in))
         {
@@ -49,9 +49,20 @@ void initialize_buffer(pybind11::module & mod)
     {
         import_numpy();
 
+        wrap_MemoryResource(mod);
+        wrap_DeviceBackend(mod);
+        wrap_MetalArrayKernel(mod);
         wrap_ConcreteBuffer(mod);
+        wrap_CompressedBuffer(mod);
+        wrap_QuantizedBuffer(mod);
         wrap_SimpleArray(mod);
         wrap_SimpleArrayPlex(mod);
+        wrap_SimpleArraySnapshot(mod);
+        wrap_SimpleArrayMonitor(mod);
+        wrap_Checkpoint(mod);
+        wrap_SimpleArrayView(mod);
+        wrap_ArrayExpression(mod);
+        wrap_DLPack(mod);
     };
 
     OneTimeInitializer<buffer_pymod_tag>::me()(mod, initialize_impl);
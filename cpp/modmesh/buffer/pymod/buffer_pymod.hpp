@@ -40,9 +40,20 @@ namespace python
 {
 
 void initialize_buffer(pybind11::module & mod);
+void wrap_MemoryResource(pybind11::module & mod);
+void wrap_DeviceBackend(pybind11::module & mod);
+void wrap_MetalArrayKernel(pybind11::module & mod);
 void wrap_ConcreteBuffer(pybind11::module & mod);
+void wrap_CompressedBuffer(pybind11::module & mod);
+void wrap_QuantizedBuffer(pybind11::module & mod);
+void wrap_Checkpoint(pybind11::module & mod);
 void wrap_SimpleArray(pybind11::module & mod);
 void wrap_SimpleArrayPlex(pybind11::module & mod);
+void wrap_SimpleArraySnapshot(pybind11::module & mod);
+void wrap_SimpleArrayMonitor(pybind11::module & mod);
+void wrap_SimpleArrayView(pybind11::module & mod);
+void wrap_ArrayExpression(pybind11::module & mod);
+void wrap_DLPack(pybind11::module & mod);
 
 } /* end namespace python */
 
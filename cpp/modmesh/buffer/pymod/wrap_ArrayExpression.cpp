@@ -0,0 +1,729 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/pymod/buffer_pymod.hpp> // Must be the first include.
+#include <modmesh/buffer/buffer.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace modmesh
+{
+
+namespace python
+{
+
+namespace detail
+{
+
+/**
+ * Node of an element-wise expression built from Python.  The element types
+ * are known only at runtime, so the tree is interpreted block by block: every
+ * node computes a small block of elements into a buffer that stays in cache,
+ * and only the result is written to memory.
+ */
+class ExpressionNode
+{
+
+public:
+
+    using shape_type = modmesh::detail::shape_type;
+
+    enum class Kind
+    {
+        Array,
+        Scalar,
+        Unary,
+        Binary,
+        Where,
+    }; /* end enum class Kind */
+
+    enum class OpCode
+    {
+        None,
+        Add,
+        Sub,
+        Mul,
+        Div,
+        Less,
+        LessEqual,
+        Greater,
+        GreaterEqual,
+        Equal,
+        NotEqual,
+        Negate,
+        Abs,
+    }; /* end enum class OpCode */
+
+    /// Elements computed by each node at a time.
+    static constexpr size_t BLOCK_SIZE = 256;
+
+    static std::shared_ptr<ExpressionNode> make(pybind11::object const & operand);
+    static std::shared_ptr<ExpressionNode> make_unary(OpCode op, std::shared_ptr<ExpressionNode> operand);
+    static std::shared_ptr<ExpressionNode> make_binary(OpCode op, std::shared_ptr<ExpressionNode> lhs, std::shared_ptr<ExpressionNode> rhs);
+    static std::shared_ptr<ExpressionNode> make_where(std::shared_ptr<ExpressionNode> cond, std::shared_ptr<ExpressionNode> lhs, std::shared_ptr<ExpressionNode> rhs);
+
+    bool is_scalar() const
+    {
+        return m_shape.empty() && m_kind != Kind::Array;
+    }
+    shape_type const & shape() const { return m_shape; }
+    size_t nghost() const { return m_nghost; }
+
+    /// Element type of the default result.
+    DataType result_type() const;
+
+    /// Evaluate into a new array of result_type().
+    pybind11::object evaluate() const;
+    /// Evaluate into an existing array of any element type.
+    void evaluate(pybind11::object const & out) const;
+
+private:
+
+    ExpressionNode() = default;
+
+    /// Element type the tree computes in: int64, float32, or float64.
+    DataType compute_type() const;
+    bool has_division() const;
+    bool is_comparison() const;
+    void collect_array_type(DataType & widest, bool & has_float_scalar, bool with_condition) const;
+    void set_shape_from(std::vector<ExpressionNode const *> const & operands);
+
+    template <typename C>
+    void compute(size_t begin, size_t count, C * out) const;
+
+    template <typename C, typename U>
+    void run(U * data, size_t size) const;
+
+    template <typename U>
+    void dispatch_compute(U * data, size_t size) const;
+
+    Kind m_kind = Kind::Scalar;
+    OpCode m_op = OpCode::None;
+
+    // Array terminal.  The Python object keeps the array alive.
+    pybind11::object m_holder;
+    DataType m_data_type = DataType::Undefined;
+    void const * m_data = nullptr;
+
+    // Scalar terminal.
+    double m_float_value = 0;
+    int64_t m_int_value = 0;
+    bool m_is_float = false;
+
+    std::shared_ptr<ExpressionNode> m_first;
+    std::shared_ptr<ExpressionNode> m_second;
+    std::shared_ptr<ExpressionNode> m_third;
+
+    shape_type m_shape;
+    size_t m_nghost = 0;
+
+}; /* end class ExpressionNode */
+
+namespace
+{
+
+// Promotion rank of the element types for the default result type.
+int type_rank(DataType type)
+{
+    switch (type)
+    {
+    case DataType::Bool: return 1;
+    case DataType::Int8: return 2;
+    case DataType::Uint8: return 3;
+    case DataType::Int16: return 4;
+    case DataType::Uint16: return 5;
+    case DataType::Int32: return 6;
+    case DataType::Uint32: return 7;
+    case DataType::Int64: return 8;
+    case DataType::Uint64: return 9;
+    case DataType::Float32: return 10;
+    case DataType::Float64: return 11;
+    default: return 0;
+    }
+}
+
+char const * type_name(DataType type)
+{
+    switch (type)
+    {
+    case DataType::Bool: return "bool";
+    case DataType::Int8: return "int8";
+    case DataType::Int16: return "int16";
+    case DataType::Int32: return "int32";
+    case DataType::Int64: return "int64";
+    case DataType::Uint8: return "uint8";
+    case DataType::Uint16: return "uint16";
+    case DataType::Uint32: return "uint32";
+    case DataType::Uint64: return "uint64";
+    case DataType::Float32: return "float32";
+    case DataType::Float64: return "float64";
+    default: return "undefined";
+    }
+}
+
+template <typename S, typename C>
+void load_block(void const * data, size_t begin, size_t count, C * out)
+{
+    S const * src = static_cast<S const *>(data) + begin;
+    for (size_t it = 0; it < count; ++it)
+    {
+        out[it] = static_cast<C>(src[it]);
+    }
+}
+
+template <typename C, typename F>
+void apply_binary(size_t count, C * lhs, C const * rhs, F && func)
+{
+    for (size_t it = 0; it < count; ++it)
+    {
+        lhs[it] = static_cast<C>(func(lhs[it], rhs[it]));
+    }
+}
+
+// Call func with a typed pointer of the array held by obj; return false if
+// obj is not a SimpleArray.
+template <typename F>
+bool visit_array(pybind11::object const & obj, F && func)
+{
+#define MM_DECL_VISIT(T)                                   \
+    if (pybind11::isinstance<SimpleArray<T>>(obj))         \
+    {                                                      \
+        func(obj.cast<SimpleArray<T> &>());                \
+        return true;                                       \
+    }
+    MM_DECL_VISIT(bool)
+    MM_DECL_VISIT(int8_t)
+    MM_DECL_VISIT(int16_t)
+    MM_DECL_VISIT(int32_t)
+    MM_DECL_VISIT(int64_t)
+    MM_DECL_VISIT(uint8_t)
+    MM_DECL_VISIT(uint16_t)
+    MM_DECL_VISIT(uint32_t)
+    MM_DECL_VISIT(uint64_t)
+    MM_DECL_VISIT(float)
+    MM_DECL_VISIT(double)
+#undef MM_DECL_VISIT
+    return false;
+}
+
+} /* end namespace */
+
+std::shared_ptr<ExpressionNode> ExpressionNode::make(pybind11::object const & operand)
+{
+    namespace py = pybind11;
+
+    if (py::isinstance<ExpressionNode>(operand))
+    {
+        return operand.cast<std::shared_ptr<ExpressionNode>>();
+    }
+    std::shared_ptr<ExpressionNode> node(new ExpressionNode());
+    bool const is_array = visit_array(
+        operand,
+        [&](auto & arr)
+        {
+            using value_type = typename std::remove_reference_t<decltype(arr)>::value_type;
+            node->m_kind = Kind::Array;
+            node->m_holder = operand;
+            node->m_data_type = get_data_type_from_type<value_type>();
+            node->m_data = arr.size() ? arr.data() : nullptr;
+            node->m_shape = arr.shape();
+            node->m_nghost = arr.nghost();
+        });
+    if (is_array)
+    {
+        return node;
+    }
+    node->m_kind = Kind::Scalar;
+    if (py::isinstance<py::bool_>(operand) || py::isinstance<py::int_>(operand))
+    {
+        node->m_int_value = operand.cast<int64_t>();
+        node->m_float_value = static_cast<double>(node->m_int_value);
+    }
+    else if (py::isinstance<py::float_>(operand))
+    {
+        node->m_float_value = operand.cast<double>();
+        node->m_is_float = true;
+    }
+    else
+    {
+        throw py::type_error(Formatter() << "ArrayExpression: unsupported operand type "
+                                         << py::str(py::type::of(operand)).cast<std::string>());
+    }
+    return node;
+}
+
+void ExpressionNode::set_shape_from(std::vector<ExpressionNode const *> const & operands)
+{
+    ExpressionNode const * shaped = nullptr;
+    for (ExpressionNode const * operand : operands)
+    {
+        if (operand->is_scalar())
+        {
+            continue;
+        }
+        if (shaped && (!(shaped->shape() == operand->shape()) || shaped->nghost() != operand->nghost()))
+        {
+            throw std::invalid_argument("ArrayExpression: shape of the operands differ");
+        }
+        shaped = operand;
+    }
+    if (shaped)
+    {
+        m_shape = shaped->shape();
+        m_nghost = shaped->nghost();
+    }
+}
+
+std::shared_ptr<ExpressionNode> ExpressionNode::make_unary(OpCode op, std::shared_ptr<ExpressionNode> operand)
+{
+    std::shared_ptr<ExpressionNode> node(new ExpressionNode());
+    node->m_kind = Kind::Unary;
+    node->m_op = op;
+    node->set_shape_from({operand.get()});
+    node->m_first = std::move(operand);
+    return node;
+}
+
+std::shared_ptr<ExpressionNode> ExpressionNode::make_binary(OpCode op, std::shared_ptr<ExpressionNode> lhs, std::shared_ptr<ExpressionNode> rhs)
+{
+    std::shared_ptr<ExpressionNode> node(new ExpressionNode());
+    node->m_kind = Kind::Binary;
+    node->m_op = op;
+    node->set_shape_from({lhs.get(), rhs.get()});
+    node->m_first = std::move(lhs);
+    node->m_second = std::move(rhs);
+    return node;
+}
+
+std::shared_ptr<ExpressionNode> ExpressionNode::make_where(std::shared_ptr<ExpressionNode> cond, std::shared_ptr<ExpressionNode> lhs, std::shared_ptr<ExpressionNode> rhs)
+{
+    std::shared_ptr<ExpressionNode> node(new ExpressionNode());
+    node->m_kind = Kind::Where;
+    node->set_shape_from({cond.get(), lhs.get(), rhs.get()});
+    node->m_first = std::move(cond);
+    node->m_second = std::move(lhs);
+    node->m_third = std::move(rhs);
+    return node;
+}
+
+bool ExpressionNode::is_comparison() const
+{
+    switch (m_op)
+    {
+    case OpCode::Less:
+    case OpCode::LessEqual:
+    case OpCode::Greater:
+    case OpCode::GreaterEqual:
+    case OpCode::Equal:
+    case OpCode::NotEqual:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool ExpressionNode::has_division() const
+{
+    return OpCode::Div == m_op ||
+           (m_first && m_first->has_division()) ||
+           (m_second && m_second->has_division()) ||
+           (m_third && m_third->has_division());
+}
+
+void ExpressionNode::collect_array_type(DataType & widest, bool & has_float_scalar, bool with_condition) const
+{
+    if (Kind::Array == m_kind && type_rank(m_data_type) > type_rank(widest))
+    {
+        widest = m_data_type;
+    }
+    if (Kind::Scalar == m_kind && m_is_float)
+    {
+        has_float_scalar = true;
+    }
+    if (m_first && (with_condition || Kind::Where != m_kind))
+    {
+        m_first->collect_array_type(widest, has_float_scalar, with_condition);
+    }
+    if (m_second)
+    {
+        m_second->collect_array_type(widest, has_float_scalar, with_condition);
+    }
+    if (m_third)
+    {
+        m_third->collect_array_type(widest, has_float_scalar, with_condition);
+    }
+}
+
+DataType ExpressionNode::compute_type() const
+{
+    DataType widest = DataType::Undefined;
+    bool has_float_scalar = false;
+    // Comparisons inside the condition of where() also need the wide type.
+    collect_array_type(widest, has_float_scalar, /* with_condition */ true);
+    if (DataType::Float64 == widest || DataType::Float32 == widest)
+    {
+        return widest;
+    }
+    // Python scalars are weak: a float scalar promotes integers to float64
+    // but keeps float32 arrays in float32.  True division also gives float64.
+    if (has_float_scalar || has_division())
+    {
+        return DataType::Float64;
+    }
+    return DataType::Int64;
+}
+
+DataType ExpressionNode::result_type() const
+{
+    if (is_comparison())
+    {
+        return DataType::Bool;
+    }
+    // The condition of where() does not affect the type of the values.
+    DataType widest = DataType::Undefined;
+    bool has_float_scalar = false;
+    collect_array_type(widest, has_float_scalar, /* with_condition */ false);
+    if (DataType::Float64 == widest || DataType::Float32 == widest)
+    {
+        return widest;
+    }
+    if (has_float_scalar || has_division())
+    {
+        return DataType::Float64;
+    }
+    return DataType::Undefined == widest ? DataType::Int64 : widest;
+}
+
+template <typename C>
+void ExpressionNode::compute(size_t begin, size_t count, C * out) const
+{
+    switch (m_kind)
+    {
+    case Kind::Array:
+    {
+        switch (m_data_type)
+        {
+        case DataType::Bool: load_block<bool>(m_data, begin, count, out); break;
+        case DataType::Int8: load_block<int8_t>(m_data, begin, count, out); break;
+        case DataType::Int16: load_block<int16_t>(m_data, begin, count, out); break;
+        case DataType::Int32: load_block<int32_t>(m_data, begin, count, out); break;
+        case DataType::Int64: load_block<int64_t>(m_data, begin, count, out); break;
+        case DataType::Uint8: load_block<uint8_t>(m_data, begin, count, out); break;
+        case DataType::Uint16: load_block<uint16_t>(m_data, begin, count, out); break;
+        case DataType::Uint32: load_block<uint32_t>(m_data, begin, count, out); break;
+        case DataType::Uint64: load_block<uint64_t>(m_data, begin, count, out); break;
+        case DataType::Float32: load_block<float>(m_data, begin, count, out); break;
+        case DataType::Float64: load_block<double>(m_data, begin, count, out); break;
+        default: throw std::runtime_error("ArrayExpression: unsupported array type");
+        }
+        break;
+    }
+    case Kind::Scalar:
+    {
+        C const value = m_is_float ? static_cast<C>(m_float_value) : static_cast<C>(m_int_value);
+        std::fill(out, out + count, value);
+        break;
+    }
+    case Kind::Unary:
+    {
+        m_first->compute(begin, count, out);
+        if (OpCode::Negate == m_op)
+        {
+            for (size_t it = 0; it < count; ++it)
+            {
+                out[it] = -out[it];
+            }
+        }
+        else // OpCode::Abs
+        {
+            for (size_t it = 0; it < count; ++it)
+            {
+                out[it] = out[it] < 0 ? -out[it] : out[it];
+            }
+        }
+        break;
+    }
+    case Kind::Binary:
+    {
+        C rhs[BLOCK_SIZE]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+        m_first->compute(begin, count, out);
+        m_second->compute(begin, count, rhs);
+        // clang-format off
+        switch (m_op)
+        {
+        case OpCode::Add: apply_binary(count, out, rhs, [](C l, C r) { return l + r; }); break;
+        case OpCode::Sub: apply_binary(count, out, rhs, [](C l, C r) { return l - r; }); break;
+        case OpCode::Mul: apply_binary(count, out, rhs, [](C l, C r) { return l * r; }); break;
+        case OpCode::Div: apply_binary(count, out, rhs, [](C l, C r) { return l / r; }); break;
+        case OpCode::Less: apply_binary(count, out, rhs, [](C l, C r) { return l < r; }); break;
+        case OpCode::LessEqual: apply_binary(count, out, rhs, [](C l, C r) { return l <= r; }); break;
+        case OpCode::Greater: apply_binary(count, out, rhs, [](C l, C r) { return l > r; }); break;
+        case OpCode::GreaterEqual: apply_binary(count, out, rhs, [](C l, C r) { return l >= r; }); break;
+        case OpCode::Equal: apply_binary(count, out, rhs, [](C l, C r) { return l == r; }); break;
+        case OpCode::NotEqual: apply_binary(count, out, rhs, [](C l, C r) { return l != r; }); break;
+        default: throw std::runtime_error("ArrayExpression: unsupported binary operator");
+        }
+        // clang-format on
+        break;
+    }
+    case Kind::Where:
+    {
+        C cond[BLOCK_SIZE]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+        C rhs[BLOCK_SIZE]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+        m_first->compute(begin, count, cond);
+        m_second->compute(begin, count, out);
+        m_third->compute(begin, count, rhs);
+        for (size_t it = 0; it < count; ++it)
+        {
+            out[it] = cond[it] != 0 ? out[it] : rhs[it];
+        }
+        break;
+    }
+    }
+}
+
+template <typename C, typename U>
+void ExpressionNode::run(U * data, size_t size) const
+{
+    parallel_for_chunks(
+        size,
+        ThreadPool::instance().use_parallel(size),
+        [this, data](size_t begin, size_t end)
+        {
+            C block[BLOCK_SIZE]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+            for (size_t it = begin; it < end; it += BLOCK_SIZE)
+            {
+                size_t const count = std::min(BLOCK_SIZE, end - it);
+                compute(it, count, block);
+                for (size_t jt = 0; jt < count; ++jt)
+                {
+                    if constexpr (std::is_same_v<bool, U>)
+                    {
+                        data[it + jt] = block[jt] != 0;
+                    }
+                    else
+                    {
+                        data[it + jt] = static_cast<U>(block[jt]);
+                    }
+                }
+            }
+        });
+}
+
+template <typename U>
+void ExpressionNode::dispatch_compute(U * data, size_t size) const
+{
+    switch (compute_type())
+    {
+    case DataType::Float64: run<double>(data, size); break;
+    case DataType::Float32: run<float>(data, size); break;
+    default: run<int64_t>(data, size); break;
+    }
+}
+
+void ExpressionNode::evaluate(pybind11::object const & out) const
+{
+    namespace py = pybind11;
+
+    if (is_scalar())
+    {
+        throw std::invalid_argument("ArrayExpression: cannot evaluate an expression without arrays");
+    }
+    bool const is_array = visit_array(
+        out,
+        [&](auto & arr)
+        {
+            if (!(arr.shape() == m_shape) || arr.nghost() != m_nghost)
+            {
+                throw std::invalid_argument("ArrayExpression: shape of the output array differs from the expression");
+            }
+            if (arr && arr.buffer().is_readonly())
+            {
+                throw std::runtime_error("ArrayExpression: cannot write to read-only buffer");
+            }
+            if (arr.size() != 0)
+            {
+                auto * data = arr.data();
+                size_t const size = arr.size();
+                py::gil_scoped_release const release;
+                dispatch_compute(data, size);
+            }
+        });
+    if (!is_array)
+    {
+        throw py::type_error("ArrayExpression: out must be a SimpleArray");
+    }
+}
+
+pybind11::object ExpressionNode::evaluate() const
+{
+    namespace py = pybind11;
+
+    if (is_scalar())
+    {
+        throw std::invalid_argument("ArrayExpression: cannot evaluate an expression without arrays");
+    }
+    py::object ret;
+    switch (result_type())
+    {
+#define MM_DECL_CREATE(DTYPE, T)                      \
+    case DTYPE:                                       \
+    {                                                 \
+        SimpleArray<T> arr(m_shape);                  \
+        arr.set_nghost(m_nghost);                     \
+        ret = py::cast(std::move(arr));               \
+        break;                                        \
+    }
+        MM_DECL_CREATE(DataType::Bool, bool)
+        MM_DECL_CREATE(DataType::Int8, int8_t)
+        MM_DECL_CREATE(DataType::Int16, int16_t)
+        MM_DECL_CREATE(DataType::Int32, int32_t)
+        MM_DECL_CREATE(DataType::Int64, int64_t)
+        MM_DECL_CREATE(DataType::Uint8, uint8_t)
+        MM_DECL_CREATE(DataType::Uint16, uint16_t)
+        MM_DECL_CREATE(DataType::Uint32, uint32_t)
+        MM_DECL_CREATE(DataType::Uint64, uint64_t)
+        MM_DECL_CREATE(DataType::Float32, float)
+        MM_DECL_CREATE(DataType::Float64, double)
+#undef MM_DECL_CREATE
+    default:
+        throw std::runtime_error("ArrayExpression: unsupported result type");
+    }
+    evaluate(ret);
+    return ret;
+}
+
+} /* end namespace detail */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapArrayExpression
+    : public WrapBase<WrapArrayExpression, detail::ExpressionNode, std::shared_ptr<detail::ExpressionNode>>
+{
+
+    using holder_type = std::shared_ptr<wrapped_type>;
+    using OpCode = wrapped_type::OpCode;
+
+    friend root_base_type;
+
+    WrapArrayExpression(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(
+                py::init(
+                    [](py::object const & operand)
+                    { return wrapped_type::make(operand); }),
+                py::arg("operand"))
+            .def_property_readonly(
+                "shape",
+                [](wrapped_type const & self)
+                {
+                    py::tuple ret(self.shape().size());
+                    for (size_t i = 0; i < self.shape().size(); ++i)
+                    {
+                        ret[i] = self.shape()[i];
+                    }
+                    return ret;
+                })
+            .def_property_readonly(
+                "dtype",
+                [](wrapped_type const & self)
+                { return detail::type_name(self.result_type()); })
+            .def(
+                "evaluate",
+                [](wrapped_type const & self, py::object const & out) -> py::object
+                {
+                    if (out.is_none())
+                    {
+                        return self.evaluate();
+                    }
+                    self.evaluate(out);
+                    return out;
+                },
+                py::arg("out") = py::none())
+            .def_static(
+                "where",
+                [](py::object const & cond, py::object const & lhs, py::object const & rhs)
+                { return wrapped_type::make_where(wrapped_type::make(cond), wrapped_type::make(lhs), wrapped_type::make(rhs)); },
+                py::arg("cond"),
+                py::arg("lhs"),
+                py::arg("rhs"))
+            .def("__neg__", [](holder_type const & self)
+                 { return wrapped_type::make_unary(OpCode::Negate, self); })
+            .def("__abs__", [](holder_type const & self)
+                 { return wrapped_type::make_unary(OpCode::Abs, self); })
+            //
+            ;
+
+        def_binary("__add__", "__radd__", OpCode::Add);
+        def_binary("__sub__", "__rsub__", OpCode::Sub);
+        def_binary("__mul__", "__rmul__", OpCode::Mul);
+        def_binary("__truediv__", "__rtruediv__", OpCode::Div);
+        def_binary("__lt__", nullptr, OpCode::Less);
+        def_binary("__le__", nullptr, OpCode::LessEqual);
+        def_binary("__gt__", nullptr, OpCode::Greater);
+        def_binary("__ge__", nullptr, OpCode::GreaterEqual);
+        def_binary("__eq__", nullptr, OpCode::Equal);
+        def_binary("__ne__", nullptr, OpCode::NotEqual);
+    }
+
+private:
+
+    void def_binary(char const * name, char const * rname, OpCode op)
+    {
+        namespace py = pybind11;
+
+        (*this).def(
+            name,
+            [op](holder_type const & self, py::object const & other)
+            { return wrapped_type::make_binary(op, self, wrapped_type::make(other)); },
+            py::is_operator());
+        if (rname)
+        {
+            (*this).def(
+                rname,
+                [op](holder_type const & self, py::object const & other)
+                { return wrapped_type::make_binary(op, wrapped_type::make(other), self); },
+                py::is_operator());
+        }
+    }
+
+}; /* end class WrapArrayExpression */
+
+void wrap_ArrayExpression(pybind11::module & mod)
+{
+    WrapArrayExpression::commit(mod, "ArrayExpression", "Lazy element-wise expression over SimpleArray");
+}
+
+} /* end namespace python */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/pymod/buffer_pymod.hpp> // Must be the first include.
+#include <modmesh/buffer/buffer.hpp>
+
+namespace modmesh
+{
+
+namespace python
+{
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapCheckpoint
+    : public WrapBase<WrapCheckpoint, Checkpoint>
+{
+
+    friend root_base_type;
+
+    WrapCheckpoint(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(py::init<std::string>(), py::arg("kind"))
+            .def_property_readonly("kind", &wrapped_type::kind)
+            .def_property_readonly("narray", &wrapped_type::narray)
+            .def_property_readonly("nscalar", &wrapped_type::nscalar)
+            .def_property_readonly("array_names", &wrapped_type::array_names)
+            .def_property_readonly("scalar_names", &wrapped_type::scalar_names)
+            .def(
+                "add_array",
+                py::overload_cast<std::string const &, wrapped_type::array_type const &, double>(&wrapped_type::add_array),
+                py::arg("name"),
+                py::arg("array"),
+                py::arg("tolerance") = 0.0)
+            .def("add_scalar", &wrapped_type::add_scalar, py::arg("name"), py::arg("value"))
+            .def(
+                "array",
+                [](wrapped_type const & self, std::string const & name)
+                { return self.array(name); },
+                py::arg("name"))
+            .def("scalar", &wrapped_type::scalar, py::arg("name"))
+            .def("tolerance", &wrapped_type::tolerance, py::arg("name"))
+            .def("save", &wrapped_type::save, py::arg("path"), py::call_guard<py::gil_scoped_release>())
+            .def_static("load", &wrapped_type::load, py::arg("path"), py::arg("mmap") = true, py::call_guard<py::gil_scoped_release>())
+            //
+            ;
+    }
+
+}; /* end class WrapCheckpoint */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapCheckpointWriter
+    : public WrapBase<WrapCheckpointWriter, CheckpointWriter, std::shared_ptr<CheckpointWriter>>
+{
+
+    friend root_base_type;
+
+    WrapCheckpointWriter(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(py::init([]()
+                          { return std::make_shared<wrapped_type>(); }))
+            .def_property_readonly("nwritten", &wrapped_type::nwritten)
+            .def("write", &wrapped_type::write, py::arg("path"), py::arg("checkpoint"), py::call_guard<py::gil_scoped_release>())
+            .def("flush", &wrapped_type::flush, py::call_guard<py::gil_scoped_release>())
+            //
+            ;
+    }
+
+}; /* end class WrapCheckpointWriter */
+
+void wrap_Checkpoint(pybind11::module & mod)
+{
+    WrapCheckpoint::commit(mod, "Checkpoint", "Named arrays and scalars of the state of a solver");
+    WrapCheckpointWriter::commit(mod, "CheckpointWriter", "Save checkpoints in a background thread");
+}
+
+} /* end namespace python */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -56,6 +56,12 @@ WrapConcreteBuffer::WrapConcreteBuffer(pybind11::module & mod, char const * pyna
                 [](size_t nbytes)
                 { return wrapped_type::construct(nbytes); }),
             py::arg("nbytes"))
+        .def_timed(
+            py::init(
+                [](size_t nbytes, size_t alignment)
+                { return wrapped_type::construct(nbytes, alignment); }),
+            py::arg("nbytes"),
+            py::arg("alignment"))
         .def(
             py::init(
                 [](py::array & arr_in)
@@ -64,8 +70,19 @@ WrapConcreteBuffer::WrapConcreteBuffer(pybind11::module & mod, char const * pyna
                         arr_in.nbytes(), arr_in.mutable_data(), std::make_unique<ConcreteBufferNdarrayRemover>(arr_in));
                 }),
             py::arg("array"))
+        .def_static(
+            "mmap",
+            [](std::string const & path, std::string const & mode, size_t offset, size_t nbytes)
+            { return map_buffer(path, get_map_mode_from_string(mode), offset, nbytes); },
+            py::arg("path"),
+            py::arg("mode") = "r",
+            py::arg("offset") = 0,
+            py::arg("nbytes") = 0)
         .def_timed("clone", &wrapped_type::clone)
         .def_property_readonly("nbytes", &wrapped_type::nbytes)
+        .def_property_readonly("alignment", &wrapped_type::alignment)
+        .def_static("get_default_alignment", &wrapped_type::default_alignment)
+        .def_static("set_default_alignment", &wrapped_type::set_default_alignment, py::arg("alignment"))
         .def("__len__", &wrapped_type::size)
         .def(
             "__getitem__",
@@ -74,7 +91,14 @@ WrapConcreteBuffer::WrapConcreteBuffer(pybind11::module & mod, char const * pyna
         .def(
             "__setitem__",
             [](wrapped_type & self, size_t it, int8_t val)
-            { self.at(it) = val; })
+            {
+                if (self.is_readonly())
+                {
+                    throw std::runtime_error("ConcreteBuffer: cannot write to read-only buffer");
+                }
+                self.at(it) = val;
+                self.bump_epoch();
+            })
         .def_buffer(
             [](wrapped_type & self)
             {
@@ -84,7 +108,8 @@ WrapConcreteBuffer::WrapConcreteBuffer(pybind11::module & mod, char const * pyna
                     py::format_descriptor<int8_t>::format(), /* Python struct-style format descriptor */
                     1, /* Number of dimensions */
                     {self.size()}, /* Buffer dimensions */
-                    {1} /* Strides (in bytes) for each index */
+                    {1}, /* Strides (in bytes) for each index */
+                    self.is_readonly() /* Read-only memory */
                 );
             })
         .def_property_readonly(
@@ -92,13 +117,32 @@ WrapConcreteBuffer::WrapConcreteBuffer(pybind11::module & mod, char const * pyna
             [](wrapped_type & self)
             {
                 namespace py = pybind11;
-                return py::array(
+                py::array ret(
                     py::detail::npy_format_descriptor<int8_t>::dtype(), /* Numpy dtype */
                     {self.size()}, /* Buffer dimensions */
                     {1}, /* Strides (in bytes) for each index */
                     self.data(), /* Pointer to buffer */
                     py::cast(self.shared_from_this()) /* Owning Python object */
                 );
+                if (self.is_readonly())
+                {
+                    ret.attr("flags").attr("writeable") = false;
+                }
+                else
+                {
+                    // A writable view counts as a modification.
+                    self.bump_epoch();
+                }
+                return ret;
+            })
+        .def_property_readonly("is_readonly", &wrapped_type::is_readonly)
+        .def_property_readonly("epoch", &wrapped_type::epoch)
+        .def("bump_epoch", &wrapped_type::bump_epoch)
+        .def_property_readonly(
+            "is_mapped",
+            [](wrapped_type const & self)
+            {
+                return self.has_remover() && modmesh::detail::ConcreteBufferMmapRemover::is_same_type(self.get_remover());
             })
         .def_property_readonly(
             "is_from_python",
@@ -106,6 +150,42 @@ WrapConcreteBuffer::WrapConcreteBuffer(pybind11::module & mod, char const * pyna
             {
                 return self.has_remover() && ConcreteBufferNdarrayRemover::is_same_type(self.get_remover());
             })
+        .def_property_readonly(
+            "is_shared",
+            [](wrapped_type const & self)
+            {
+                return self.has_remover() && modmesh::detail::ConcreteBufferSharedRemover::is_same_type(self.get_remover());
+            })
+        //
+        ;
+}
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapSharedMemory
+    : public WrapBase<WrapSharedMemory, SharedMemory, std::shared_ptr<SharedMemory>>
+{
+
+    friend root_base_type;
+
+    WrapSharedMemory(pybind11::module & mod, char const * pyname, char const * pydoc);
+
+}; /* end class WrapSharedMemory */
+
+WrapSharedMemory::WrapSharedMemory(pybind11::module & mod, char const * pyname, char const * pydoc)
+    : root_base_type(mod, pyname, pydoc)
+{
+    namespace py = pybind11;
+
+    (*this)
+        .def_static("create", &wrapped_type::create, py::arg("name"), py::arg("nbytes"))
+        .def_static("attach", &wrapped_type::attach, py::arg("name"))
+        .def_static("remove", &wrapped_type::remove, py::arg("name"))
+        .def_property_readonly("name", &wrapped_type::name)
+        .def_property_readonly("nbytes", &wrapped_type::nbytes)
+        .def_property_readonly("is_readonly", &wrapped_type::is_readonly)
+        .def_property_readonly("refcount", &wrapped_type::refcount)
+        .def_property_readonly("is_published", &wrapped_type::is_published)
+        .def("publish", &wrapped_type::publish)
+        .def("buffer", &wrapped_type::buffer, py::arg("offset"), py::arg("nbytes"))
         //
         ;
 }
@@ -113,6 +193,7 @@ WrapConcreteBuffer::WrapConcreteBuffer(pybind11::module & mod, char const * pyna
 void wrap_ConcreteBuffer(pybind11::module & mod)
 {
     WrapConcreteBuffer::commit(mod, "ConcreteBuffer", "ConcreteBuffer");
+    WrapSharedMemory::commit(mod, "SharedMemory", "SharedMemory");
 }
 
 } /* end namespace python */
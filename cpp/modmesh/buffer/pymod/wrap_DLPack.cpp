@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/pymod/buffer_pymod.hpp> // Must be the first include.
+#include <modmesh/buffer/pymod/DLPack.hpp>
+
+namespace modmesh
+{
+
+namespace python
+{
+
+namespace dlpack
+{
+
+namespace
+{
+
+DataType get_data_type(DLDataType const & dtype)
+{
+    if (1 != dtype.lanes)
+    {
+        throw std::invalid_argument(Formatter() << "from_dlpack: vector dtype with " << dtype.lanes
+                                                << " lanes is not supported");
+    }
+    switch (dtype.code)
+    {
+    case kDLBool:
+        if (8 == dtype.bits) { return DataType::Bool; }
+        break;
+    case kDLInt:
+        if (8 == dtype.bits) { return DataType::Int8; }
+        if (16 == dtype.bits) { return DataType::Int16; }
+        if (32 == dtype.bits) { return DataType::Int32; }
+        if (64 == dtype.bits) { return DataType::Int64; }
+        break;
+    case kDLUInt:
+        if (8 == dtype.bits) { return DataType::Uint8; }
+        if (16 == dtype.bits) { return DataType::Uint16; }
+        if (32 == dtype.bits) { return DataType::Uint32; }
+        if (64 == dtype.bits) { return DataType::Uint64; }
+        break;
+    case kDLFloat:
+        if (32 == dtype.bits) { return DataType::Float32; }
+        if (64 == dtype.bits) { return DataType::Float64; }
+        break;
+    default:
+        break;
+    }
+    throw std::invalid_argument(Formatter() << "from_dlpack: unsupported dtype code " << static_cast<int>(dtype.code)
+                                            << " with " << static_cast<int>(dtype.bits) << " bits");
+}
+
+template <typename T>
+pybind11::object make_array(modmesh::detail::shape_type const & shape, std::shared_ptr<ConcreteBuffer> const & buffer)
+{
+    return pybind11::cast(SimpleArray<T>(shape, buffer));
+}
+
+} /* end namespace */
+
+pybind11::object from_dlpack(pybind11::object const & obj)
+{
+    namespace py = pybind11;
+
+    py::object capsule = obj;
+    if (py::hasattr(obj, "__dlpack__"))
+    {
+        capsule = obj.attr("__dlpack__")();
+    }
+    if (!PyCapsule_IsValid(capsule.ptr(), CAPSULE_NAME))
+    {
+        throw std::invalid_argument("from_dlpack: expect an unconsumed DLPack capsule or an object with __dlpack__");
+    }
+    auto * managed = static_cast<DLManagedTensor *>(PyCapsule_GetPointer(capsule.ptr(), CAPSULE_NAME));
+    DLTensor const & tensor = managed->dl_tensor;
+
+    if (kDLCPU != tensor.device.device_type)
+    {
+        throw std::invalid_argument(Formatter() << "from_dlpack: only CPU tensors are supported, got device type "
+                                                << tensor.device.device_type);
+    }
+    if (0 == tensor.ndim)
+    {
+        throw std::invalid_argument("from_dlpack: 0-dimensional tensors are not supported");
+    }
+    DataType const data_type = get_data_type(tensor.dtype);
+
+    // SimpleArray is C-contiguous.  Strides of dimensions of extent 1 do not matter.
+    modmesh::detail::shape_type shape(static_cast<size_t>(tensor.ndim));
+    size_t nelem = 1;
+    for (int32_t it = tensor.ndim; it > 0; --it)
+    {
+        auto const extent = tensor.shape[it - 1];
+        if (tensor.strides && 1 != extent && static_cast<int64_t>(nelem) != tensor.strides[it - 1])
+        {
+            throw std::invalid_argument("from_dlpack: only C-contiguous tensors are supported; make the tensor contiguous first");
+        }
+        shape[it - 1] = static_cast<size_t>(extent);
+        nelem *= static_cast<size_t>(extent);
+    }
+    size_t const nbytes = nelem * tensor.dtype.bits / 8;
+
+    std::shared_ptr<ConcreteBuffer> buffer;
+    if (nullptr == tensor.data)
+    {
+        // An empty tensor may have no memory to borrow.
+        buffer = ConcreteBuffer::construct(0);
+    }
+    else
+    {
+        buffer = ConcreteBuffer::construct(
+            nbytes,
+            static_cast<int8_t *>(tensor.data) + tensor.byte_offset,
+            std::make_unique<ConcreteBufferDLPackRemover>(managed));
+    }
+    // The buffer owns the tensor from now on; the empty one releases it right away.
+    if (0 != PyCapsule_SetName(capsule.ptr(), USED_CAPSULE_NAME))
+    {
+        throw py::error_already_set();
+    }
+    if (nullptr == tensor.data && managed->deleter)
+    {
+        managed->deleter(managed);
+    }
+
+    switch (data_type)
+    {
+    case DataType::Bool: return make_array<bool>(shape, buffer);
+    case DataType::Int8: return make_array<int8_t>(shape, buffer);
+    case DataType::Int16: return make_array<int16_t>(shape, buffer);
+    case DataType::Int32: return make_array<int32_t>(shape, buffer);
+    case DataType::Int64: return make_array<int64_t>(shape, buffer);
+    case DataType::Uint8: return make_array<uint8_t>(shape, buffer);
+    case DataType::Uint16: return make_array<uint16_t>(shape, buffer);
+    case DataType::Uint32: return make_array<uint32_t>(shape, buffer);
+    case DataType::Uint64: return make_array<uint64_t>(shape, buffer);
+    case DataType::Float32: return make_array<float>(shape, buffer);
+    case DataType::Float64: return make_array<double>(shape, buffer);
+    default: break;
+    }
+    throw std::runtime_error("from_dlpack: unsupported datatype");
+}
+
+pybind11::capsule to_capsule(SimpleArrayPlex const & array_plex)
+{
+    return array_plex.visit(
+        [](auto const & array) -> pybind11::capsule
+        {
+            if constexpr (is_half_v<typename std::decay_t<decltype(array)>::value_type>)
+            {
+                throw std::runtime_error("Unsupported datatype");
+            }
+            else
+            {
+                return to_capsule(array);
+            }
+        });
+}
+
+} /* end namespace dlpack */
+
+void wrap_DLPack(pybind11::module & mod)
+{
+    mod.def(
+        "from_dlpack",
+        &dlpack::from_dlpack,
+        pybind11::arg("obj"),
+        "Borrow the memory of a DLPack tensor as a SimpleArray without copying");
+}
+
+} /* end namespace python */
+
+} /* end namespace modmesh */
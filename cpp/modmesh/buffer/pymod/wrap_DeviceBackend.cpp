@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/pymod/buffer_pymod.hpp> // Must be the first include.
+#include <modmesh/buffer/buffer.hpp>
+
+namespace modmesh
+{
+
+namespace python
+{
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapDeviceBackend
+    : public WrapBase<WrapDeviceBackend, DeviceBackend, std::shared_ptr<DeviceBackend>>
+{
+
+    friend root_base_type;
+
+    WrapDeviceBackend(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def_property_readonly("name", &wrapped_type::name)
+            .def_property_readonly(
+                "stats",
+                [](wrapped_type const & self)
+                {
+                    DeviceBackendStats const stats = self.stats();
+                    py::dict ret;
+                    ret["device_bytes_in_use"] = stats.device_bytes_in_use;
+                    ret["pinned_bytes_in_use"] = stats.pinned_bytes_in_use;
+                    ret["to_device_count"] = stats.to_device_count;
+                    ret["to_device_bytes"] = stats.to_device_bytes;
+                    ret["to_host_count"] = stats.to_host_count;
+                    ret["to_host_bytes"] = stats.to_host_bytes;
+                    return ret;
+                })
+            .def("reset_stats", &wrapped_type::reset_stats)
+            .def_static("get_default", &wrapped_type::get_default)
+            .def_static(
+                "set_default",
+                [](std::shared_ptr<DeviceBackend> backend)
+                { wrapped_type::set_default(std::move(backend)); },
+                py::arg("backend").none(true))
+            //
+            ;
+    }
+
+}; /* end class WrapDeviceBackend */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapEmulatedDeviceBackend
+    : public WrapBase<WrapEmulatedDeviceBackend, EmulatedDeviceBackend, std::shared_ptr<EmulatedDeviceBackend>, DeviceBackend>
+{
+
+    friend root_base_type;
+
+    WrapEmulatedDeviceBackend(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(py::init([]()
+                          { return wrapped_type::construct(); }))
+            //
+            ;
+    }
+
+}; /* end class WrapEmulatedDeviceBackend */
+
+void wrap_DeviceBackend(pybind11::module & mod)
+{
+    WrapDeviceBackend::commit(mod, "DeviceBackend", "DeviceBackend");
+    WrapEmulatedDeviceBackend::commit(mod, "EmulatedDeviceBackend", "EmulatedDeviceBackend");
+}
+
+} /* end namespace python */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
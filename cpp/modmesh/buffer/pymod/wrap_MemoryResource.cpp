@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/pymod/buffer_pymod.hpp> // Must be the first include.
+#include <modmesh/buffer/buffer.hpp>
+
+namespace modmesh
+{
+
+namespace python
+{
+
+namespace detail
+{
+
+/**
+ * Python context manager switching the current memory resource of the
+ * calling thread between __enter__ and __exit__.
+ */
+class MemoryResourceContext
+{
+
+public:
+
+    explicit MemoryResourceContext(std::shared_ptr<MemoryResource> resource)
+        : m_resource(std::move(resource))
+    {
+    }
+
+    std::shared_ptr<MemoryResource> const & enter()
+    {
+        m_previous = MemoryResource::get_current();
+        MemoryResource::set_current(m_resource);
+        return m_resource;
+    }
+
+    void exit()
+    {
+        MemoryResource::set_current(std::move(m_previous));
+        m_previous.reset();
+    }
+
+private:
+
+    std::shared_ptr<MemoryResource> m_resource;
+    std::shared_ptr<MemoryResource> m_previous;
+
+}; /* end class MemoryResourceContext */
+
+} /* end namespace detail */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapMemoryResource
+    : public WrapBase<WrapMemoryResource, MemoryResource, std::shared_ptr<MemoryResource>>
+{
+
+    friend root_base_type;
+
+    WrapMemoryResource(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def_property_readonly("name", &wrapped_type::name)
+            .def_property_readonly(
+                "stats",
+                [](wrapped_type const & self)
+                {
+                    MemoryResourceStats const stats = self.stats();
+                    py::dict ret;
+                    ret["allocate_count"] = stats.allocate_count;
+                    ret["deallocate_count"] = stats.deallocate_count;
+                    ret["bytes_in_use"] = stats.bytes_in_use;
+                    ret["peak_bytes_in_use"] = stats.peak_bytes_in_use;
+                    ret["upstream_allocate_count"] = stats.upstream_allocate_count;
+                    ret["upstream_deallocate_count"] = stats.upstream_deallocate_count;
+                    ret["upstream_bytes"] = stats.upstream_bytes;
+                    return ret;
+                })
+            .def("reset_stats", &wrapped_type::reset_stats)
+            //
+            ;
+
+        mod.def(
+            "get_memory_resource",
+            []()
+            { return MemoryResource::get_current(); });
+        mod.def(
+            "set_memory_resource",
+            [](std::shared_ptr<MemoryResource> resource)
+            { MemoryResource::set_current(std::move(resource)); },
+            py::arg("resource").none(true));
+    }
+
+}; /* end class WrapMemoryResource */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapSystemMemoryResource
+    : public WrapBase<WrapSystemMemoryResource, SystemMemoryResource, std::shared_ptr<SystemMemoryResource>, MemoryResource>
+{
+
+    friend root_base_type;
+
+    WrapSystemMemoryResource(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(py::init([]()
+                          { return wrapped_type::construct(); }))
+            //
+            ;
+    }
+
+}; /* end class WrapSystemMemoryResource */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapPoolMemoryResource
+    : public WrapBase<WrapPoolMemoryResource, PoolMemoryResource, std::shared_ptr<PoolMemoryResource>, MemoryResource>
+{
+
+    friend root_base_type;
+
+    WrapPoolMemoryResource(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(
+                py::init(
+                    [](size_t max_block_size)
+                    { return wrapped_type::construct(max_block_size); }),
+                py::arg("max_block_size") = wrapped_type::DEFAULT_MAX_BLOCK_SIZE)
+            .def_static("thread_local_instance", &wrapped_type::thread_local_instance)
+            .def_property_readonly("max_block_size", &wrapped_type::max_block_size)
+            .def_property_readonly("cached_bytes", &wrapped_type::cached_bytes)
+            .def("release", &wrapped_type::release)
+            //
+            ;
+    }
+
+}; /* end class WrapPoolMemoryResource */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapArenaMemoryResource
+    : public WrapBase<WrapArenaMemoryResource, ArenaMemoryResource, std::shared_ptr<ArenaMemoryResource>, MemoryResource>
+{
+
+    friend root_base_type;
+
+    WrapArenaMemoryResource(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(
+                py::init(
+                    [](size_t chunk_size)
+                    { return wrapped_type::construct(chunk_size); }),
+                py::arg("chunk_size") = wrapped_type::DEFAULT_CHUNK_SIZE)
+            .def_property_readonly("chunk_size", &wrapped_type::chunk_size)
+            .def_property_readonly("nchunk", &wrapped_type::nchunk)
+            .def_property_readonly("live_count", &wrapped_type::live_count)
+            .def("reset", &wrapped_type::reset)
+            .def("release", &wrapped_type::release)
+            //
+            ;
+    }
+
+}; /* end class WrapArenaMemoryResource */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapNumaMemoryResource
+    : public WrapBase<WrapNumaMemoryResource, NumaMemoryResource, std::shared_ptr<NumaMemoryResource>, MemoryResource>
+{
+
+    friend root_base_type;
+
+    WrapNumaMemoryResource(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(
+                py::init(
+                    [](std::string const & policy, size_t node)
+                    { return wrapped_type::construct(wrapped_type::policy_from_string(policy), node); }),
+                py::arg("policy") = "first_touch",
+                py::arg("node") = 0)
+            .def_property_readonly(
+                "policy",
+                [](wrapped_type const & self)
+                { return wrapped_type::to_string(self.policy()); })
+            .def_property_readonly("node", &wrapped_type::node)
+            .def_static("node_count", &wrapped_type::node_count)
+            .def_static("page_size", &wrapped_type::page_size)
+            .def_static(
+                "is_supported",
+                [](std::string const & policy)
+                { return wrapped_type::is_supported(wrapped_type::policy_from_string(policy)); },
+                py::arg("policy"))
+            //
+            ;
+    }
+
+}; /* end class WrapNumaMemoryResource */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapCopyOnWriteMemoryResource
+    : public WrapBase<WrapCopyOnWriteMemoryResource, CopyOnWriteMemoryResource, std::shared_ptr<CopyOnWriteMemoryResource>, MemoryResource>
+{
+
+    friend root_base_type;
+
+    WrapCopyOnWriteMemoryResource(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(py::init([]()
+                          { return wrapped_type::construct(); }))
+            .def_static("is_supported", &wrapped_type::is_supported)
+            .def_property_readonly("shared_clone_count", &wrapped_type::shared_clone_count)
+            .def_property_readonly("copied_clone_count", &wrapped_type::copied_clone_count)
+            //
+            ;
+    }
+
+}; /* end class WrapCopyOnWriteMemoryResource */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapMemoryResourceContext
+    : public WrapBase<WrapMemoryResourceContext, detail::MemoryResourceContext>
+{
+
+    friend root_base_type;
+
+    WrapMemoryResourceContext(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(py::init<std::shared_ptr<MemoryResource>>(), py::arg("resource").none(true))
+            .def("__enter__", &wrapped_type::enter)
+            .def(
+                "__exit__",
+                [](wrapped_type & self, py::object const &, py::object const &, py::object const &)
+                { self.exit(); })
+            //
+            ;
+    }
+
+}; /* end class WrapMemoryResourceContext */
+
+void wrap_MemoryResource(pybind11::module & mod)
+{
+    WrapMemoryResource::commit(mod, "MemoryResource", "MemoryResource");
+    WrapSystemMemoryResource::commit(mod, "SystemMemoryResource", "SystemMemoryResource");
+    WrapPoolMemoryResource::commit(mod, "PoolMemoryResource", "PoolMemoryResource");
+    WrapArenaMemoryResource::commit(mod, "ArenaMemoryResource", "ArenaMemoryResource");
+    WrapNumaMemoryResource::commit(mod, "NumaMemoryResource", "NumaMemoryResource");
+    WrapCopyOnWriteMemoryResource::commit(mod, "CopyOnWriteMemoryResource", "CopyOnWriteMemoryResource");
+    WrapMemoryResourceContext::commit(mod, "MemoryResourceScope", "MemoryResourceScope");
+}
+
+} /* end namespace python */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
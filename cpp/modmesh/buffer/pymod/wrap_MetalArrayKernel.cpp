@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/pymod/buffer_pymod.hpp> // Must be the first include.
+
+#ifdef MODMESH_METAL_KERNELS
+#include <modmesh/device/metal/MetalArrayKernel.hpp>
+#endif // MODMESH_METAL_KERNELS
+
+namespace modmesh
+{
+
+namespace python
+{
+
+#ifdef MODMESH_METAL_KERNELS
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapMetalMemoryResource
+    : public WrapBase<WrapMetalMemoryResource, device::MetalMemoryResource, std::shared_ptr<device::MetalMemoryResource>, MemoryResource>
+{
+
+    friend root_base_type;
+
+    WrapMetalMemoryResource(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(py::init([]()
+                          { return wrapped_type::construct(); }))
+            //
+            ;
+    }
+
+}; /* end class WrapMetalMemoryResource */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapMetalArrayKernel
+    : public WrapBase<WrapMetalArrayKernel, device::MetalArrayKernel>
+{
+
+    friend root_base_type;
+
+    WrapMetalArrayKernel(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            // clang-format off
+            .def_property_readonly_static("me", [](py::object const &) -> wrapped_type & { return wrapped_type::instance(); })
+            // clang-format on
+            .def_property("threshold", &wrapped_type::threshold, &wrapped_type::set_threshold)
+            .def(
+                "offloadable",
+                [](wrapped_type const & self, SimpleArray<float> const & arr)
+                { return self.offloadable(arr); },
+                py::arg("arr"))
+            .def(
+                "offloadable",
+                [](wrapped_type const & self, SimpleArray<double> const & arr)
+                { return self.offloadable(arr); },
+                py::arg("arr"))
+            .wrap_typed<float>()
+            .wrap_typed<double>()
+            //
+            ;
+    }
+
+    /// None offloads the arrays that are offloadable().
+    template <typename... Arrays>
+    static bool use_offload(wrapped_type const & self, pybind11::object const & offload, Arrays const &... arrs)
+    {
+        if (offload.is_none())
+        {
+            return self.offloadable(arrs...);
+        }
+        return offload.cast<bool>();
+    }
+
+    template <typename T>
+    wrapper_type & wrap_typed()
+    {
+        namespace py = pybind11;
+
+        using array_type = SimpleArray<T>;
+
+        (*this)
+            .def(
+                "fill",
+                [](wrapped_type & self, array_type & arr, T value, py::object const & offload)
+                {
+                    check_writable(arr);
+                    bool const use = use_offload(self, offload, arr);
+                    py::gil_scoped_release const release;
+                    self.fill(arr, value, use);
+                },
+                py::arg("arr"),
+                py::arg("value"),
+                py::arg("offload") = py::none())
+            .def(
+                "axpby",
+                [](wrapped_type & self, T a, array_type const & x, T b, array_type & y, py::object const & offload)
+                {
+                    check_writable(y);
+                    bool const use = use_offload(self, offload, x, y);
+                    py::gil_scoped_release const release;
+                    self.axpby(a, x, b, y, use);
+                },
+                py::arg("a"),
+                py::arg("x"),
+                py::arg("b"),
+                py::arg("y"),
+                py::arg("offload") = py::none())
+            .def(
+                "min",
+                [](wrapped_type & self, array_type const & arr, T initial, py::object const & offload)
+                {
+                    bool const use = use_offload(self, offload, arr);
+                    py::gil_scoped_release const release;
+                    return self.min(arr, initial, use);
+                },
+                py::arg("arr"),
+                py::arg("initial") = std::numeric_limits<T>::max(),
+                py::arg("offload") = py::none())
+            .def(
+                "max",
+                [](wrapped_type & self, array_type const & arr, T initial, py::object const & offload)
+                {
+                    bool const use = use_offload(self, offload, arr);
+                    py::gil_scoped_release const release;
+                    return self.max(arr, initial, use);
+                },
+                py::arg("arr"),
+                py::arg("initial") = std::numeric_limits<T>::lowest(),
+                py::arg("offload") = py::none())
+            .def(
+                "sum",
+                [](wrapped_type & self, array_type const & arr, T initial, py::object const & offload)
+                {
+                    bool const use = use_offload(self, offload, arr);
+                    py::gil_scoped_release const release;
+                    return self.sum(arr, initial, use);
+                },
+                py::arg("arr"),
+                py::arg("initial") = 0,
+                py::arg("offload") = py::none())
+            //
+            ;
+
+        return *this;
+    }
+
+    template <typename T>
+    static void check_writable(SimpleArray<T> const & arr)
+    {
+        if (arr && arr.buffer().is_readonly())
+        {
+            throw std::runtime_error("SimpleArray: cannot write to read-only buffer");
+        }
+    }
+
+}; /* end class WrapMetalArrayKernel */
+#endif // MODMESH_METAL_KERNELS
+
+void wrap_MetalArrayKernel(pybind11::module & mod)
+{
+#ifdef MODMESH_METAL_KERNELS
+    WrapMetalMemoryResource::commit(mod, "MetalMemoryResource", "Allocate the buffers in the Metal shared storage");
+    WrapMetalArrayKernel::commit(mod, "MetalArrayKernel", "Element-wise operations and reductions of SimpleArray with Metal");
+#else // MODMESH_METAL_KERNELS
+    static_cast<void>(mod);
+#endif // MODMESH_METAL_KERNELS
+}
+
+} /* end namespace python */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
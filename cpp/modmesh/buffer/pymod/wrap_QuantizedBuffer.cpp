@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/pymod/buffer_pymod.hpp> // Must be the first include.
+#include <modmesh/buffer/buffer.hpp>
+
+namespace modmesh
+{
+
+namespace python
+{
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapQuantizedBuffer
+    : public WrapBase<WrapQuantizedBuffer, QuantizedBuffer, std::shared_ptr<QuantizedBuffer>>
+{
+
+    friend root_base_type;
+
+    WrapQuantizedBuffer(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(
+                py::init(
+                    [](SimpleArray<double> const & array, double tolerance, size_t block_size, py::object const & parallel)
+                    {
+                        bool const use = parallel.is_none() ? ThreadPool::instance().use_parallel(array.size()) : parallel.cast<bool>();
+                        py::gil_scoped_release const release;
+                        return wrapped_type::compress(array, tolerance, block_size, use);
+                    }),
+                py::arg("array"),
+                py::arg("tolerance"),
+                py::arg("block_size") = wrapped_type::DEFAULT_BLOCK_SIZE,
+                py::arg("parallel") = py::none())
+            .def(
+                py::init(
+                    [](SimpleArray<float> const & array, double tolerance, size_t block_size, py::object const & parallel)
+                    {
+                        bool const use = parallel.is_none() ? ThreadPool::instance().use_parallel(array.size()) : parallel.cast<bool>();
+                        py::gil_scoped_release const release;
+                        return wrapped_type::compress(array, tolerance, block_size, use);
+                    }),
+                py::arg("array"),
+                py::arg("tolerance"),
+                py::arg("block_size") = wrapped_type::DEFAULT_BLOCK_SIZE,
+                py::arg("parallel") = py::none())
+            .def_property_readonly("nelem", &wrapped_type::nelem)
+            .def_property_readonly("nbytes", &wrapped_type::nbytes)
+            .def_property_readonly("compressed_nbytes", &wrapped_type::compressed_nbytes)
+            .def_property_readonly("ratio", &wrapped_type::ratio)
+            .def_property_readonly("element_size", &wrapped_type::element_size)
+            .def_property_readonly("stride", &wrapped_type::stride)
+            .def_property_readonly("tolerance", &wrapped_type::tolerance)
+            .def_property_readonly("block_size", &wrapped_type::block_size)
+            .def_property_readonly("nblock", &wrapped_type::nblock)
+            .def_property_readonly("noutlier", &wrapped_type::noutlier)
+            .def_property_readonly(
+                "shape",
+                [](wrapped_type const & self)
+                {
+                    py::tuple ret(self.shape().size());
+                    for (size_t it = 0; it < self.shape().size(); ++it)
+                    {
+                        ret[it] = self.shape()[it];
+                    }
+                    return ret;
+                })
+            .def_property_readonly("nghost", &wrapped_type::nghost)
+            .def(
+                "decompress",
+                [](wrapped_type const & self, py::object const & parallel) -> py::object
+                {
+                    bool const use = parallel.is_none() ? ThreadPool::instance().use_parallel(self.nelem()) : parallel.cast<bool>();
+                    if (sizeof(float) == self.element_size())
+                    {
+                        SimpleArray<float> ret;
+                        {
+                            py::gil_scoped_release const release;
+                            ret = self.decompress_array<float>(use);
+                        }
+                        return py::cast(std::move(ret));
+                    }
+                    SimpleArray<double> ret;
+                    {
+                        py::gil_scoped_release const release;
+                        ret = self.decompress_array<double>(use);
+                    }
+                    return py::cast(std::move(ret));
+                },
+                py::arg("parallel") = py::none())
+            //
+            ;
+    }
+
+}; /* end class WrapQuantizedBuffer */
+
+void wrap_QuantizedBuffer(pybind11::module & mod)
+{
+    WrapQuantizedBuffer::commit(mod, "QuantizedBuffer", "Error-bounded lossy compression of a floating-point array");
+}
+
+} /* end namespace python */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -27,6 +27,7 @@
  */
 
 #include <modmesh/buffer/pymod/buffer_pymod.hpp> // Must be the first include.
+#include <modmesh/buffer/pymod/DLPack.hpp>
 
 #include <modmesh/buffer/buffer.hpp>
 #include <modmesh/buffer/pymod/TypeBroadcast.hpp>
@@ -68,6 +69,13 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapSimpleArray
                     { return wrapped_type(make_shape(shape), value); }),
                 py::arg("shape"),
                 py::arg("value"))
+            .def_timed(
+                py::init(
+                    [](py::object const & shape, size_t alignment)
+                    { return wrapped_type(make_shape(shape), SimpleArrayAlignment{alignment}); }),
+                py::arg("shape"),
+                py::kw_only(),
+                py::arg("alignment"))
             .def(
                 py::init(
                     [](py::array & arr_in)
@@ -88,9 +96,16 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapSimpleArray
                         return wrapped_type(shape, buffer);
                     }),
                 py::arg("array"))
+            .def(
+                py::init(
+                    [](py::object const & shape, std::shared_ptr<ConcreteBuffer> const & buffer)
+                    { return wrapped_type(make_shape(shape), buffer); }),
+                py::arg("shape"),
+                py::arg("buffer"))
             .def_buffer(
                 [](wrapped_type & self)
                 {
+                    bump_if_writable(self);
                     std::vector<size_t> stride;
                     for (size_t const i : self.stride())
                     {
@@ -102,20 +117,42 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapSimpleArray
                         py::format_descriptor<T>::format(), /* Python struct-style format descriptor */
                         self.ndim(), /* Number of dimensions */
                         std::vector<size_t>(self.shape().begin(), self.shape().end()), /* Buffer dimensions */
-                        stride /* Strides (in bytes) for each index */
+                        stride, /* Strides (in bytes) for each index */
+                        bool(self) && self.buffer().is_readonly() /* Read-only memory */
                     );
                 })
             .def_property_readonly(
                 "ndarray",
                 [](wrapped_type & self)
-                { return to_ndarray(self); })
+                {
+                    bump_if_writable(self);
+                    return to_ndarray(self);
+                })
+            .def(
+                "__dlpack__",
+                [](wrapped_type const & self, py::object const &, py::object const &)
+                { return dlpack::to_capsule(self); },
+                py::kw_only(),
+                py::arg("stream") = py::none(),
+                py::arg("max_version") = py::none())
+            .def("__dlpack_device__", [](wrapped_type const &)
+                 { return dlpack::device(); })
             .def_property_readonly(
                 "is_from_python",
                 [](wrapped_type const & self)
                 {
                     return self.buffer().has_remover() && ConcreteBufferNdarrayRemover::is_same_type(self.buffer().get_remover());
                 })
+            .def_property_readonly("epoch", &wrapped_type::epoch)
+            .def(
+                "bump_epoch",
+                [](py::object const & self)
+                {
+                    self.cast<wrapped_type &>().bump_epoch();
+                    return self;
+                })
             .def_property_readonly("nbytes", &wrapped_type::nbytes)
+            .def_property_readonly("alignment", &wrapped_type::alignment)
             .def_property_readonly("size", &wrapped_type::size)
             .def_property_readonly("itemsize", &wrapped_type::itemsize)
             .def_property_readonly(
@@ -149,18 +186,52 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapSimpleArray
                 "__getitem__",
                 [](wrapped_type const & self, std::vector<ssize_t> const & key)
                 { return self.at(key); })
-            .def("__setitem__", &setitem_parser)
+            .def(
+                "__setitem__",
+                [](wrapped_type & self, py::args const & args)
+                {
+                    setitem_parser(self, args);
+                    self.bump_epoch();
+                })
             .def(
                 "reshape",
                 [](wrapped_type const & self, py::object const & shape)
                 { return self.reshape(make_shape(shape)); })
+            .def(
+                "transpose",
+                [](wrapped_type const & self, py::object const & out, py::object const & parallel) -> py::object
+                {
+                    bool const use = use_parallel(self, parallel);
+                    if (out.is_none())
+                    {
+                        wrapped_type ret = [&]()
+                        {
+                            py::gil_scoped_release const release;
+                            return self.transpose(use);
+                        }();
+                        return py::cast(std::move(ret));
+                    }
+                    wrapped_type & dst = check_writable(out.cast<wrapped_type &>());
+                    {
+                        py::gil_scoped_release const release;
+                        self.transpose(dst, use);
+                    }
+                    return out;
+                },
+                py::arg("out") = py::none(),
+                py::arg("parallel") = py::none())
             .def_property_readonly("has_ghost", &wrapped_type::has_ghost)
             .def_property("nghost", &wrapped_type::nghost, &wrapped_type::set_nghost)
             .def_property_readonly("nbody", &wrapped_type::nbody)
             .def_property_readonly("plex", [](wrapped_type const & arr)
                                    { return pybind11::cast(SimpleArrayPlex(arr)); })
+            .def("view", py::overload_cast<>(&wrapped_type::view))
+            .def("view_body", py::overload_cast<>(&wrapped_type::view_body))
+            .def("view_ghost", py::overload_cast<>(&wrapped_type::view_ghost))
             .wrap_modifiers()
+            .wrap_device()
             .wrap_calculators()
+            .wrap_indexing()
             //
             ;
     }
@@ -170,7 +241,87 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapSimpleArray
         namespace py = pybind11; // NOLINT(misc-unused-alias-decls)
 
         (*this)
-            .def("fill", &wrapped_type::fill, py::arg("value"))
+            .def(
+                "fill",
+                [](wrapped_type & self, value_type value, py::object const & parallel)
+                { self.fill(value, use_parallel(self, parallel)); },
+                py::arg("value"),
+                py::arg("parallel") = py::none())
+            //
+            ;
+
+        return *this;
+    }
+
+    wrapper_type & wrap_device()
+    {
+        namespace py = pybind11; // NOLINT(misc-unused-alias-decls)
+
+        (*this)
+            .def(
+                "to_device",
+                [](py::object const & self, std::shared_ptr<DeviceBackend> const & backend)
+                {
+                    wrapped_type & arr = self.cast<wrapped_type &>();
+                    {
+                        py::gil_scoped_release const release;
+                        arr.to_device(backend);
+                    }
+                    return self;
+                },
+                py::arg("backend") = py::none())
+            .def(
+                "to_host",
+                [](py::object const & self)
+                {
+                    wrapped_type & arr = self.cast<wrapped_type &>();
+                    {
+                        py::gil_scoped_release const release;
+                        arr.to_host();
+                    }
+                    return self;
+                })
+            .def_property_readonly(
+                "device_state",
+                [](wrapped_type const & self) -> py::object
+                {
+                    DeviceMirror const * mirror = self.buffer().mirror();
+                    if (nullptr == mirror)
+                    {
+                        return py::none();
+                    }
+                    return py::str(DeviceMirror::to_string(mirror->state()));
+                })
+            .def_property_readonly(
+                "device_address",
+                [](wrapped_type const & self) -> uintptr_t
+                {
+                    DeviceMirror const * mirror = self.buffer().mirror();
+                    return nullptr == mirror ? 0 : reinterpret_cast<uintptr_t>(mirror->device_data());
+                })
+            .def(
+                "modify_host",
+                [](py::object const & self)
+                {
+                    DeviceMirror * mirror = self.cast<wrapped_type &>().buffer().mirror();
+                    if (nullptr != mirror)
+                    {
+                        mirror->modify_host();
+                    }
+                    return self;
+                })
+            .def(
+                "modify_device",
+                [](py::object const & self)
+                {
+                    DeviceMirror * mirror = self.cast<wrapped_type &>().buffer().mirror();
+                    if (nullptr == mirror)
+                    {
+                        throw std::runtime_error("SimpleArray: cannot modify the device before to_device()");
+                    }
+                    mirror->modify_device();
+                    return self;
+                })
             //
             ;
 
@@ -182,20 +333,349 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapSimpleArray
         namespace py = pybind11; // NOLINT(misc-unused-alias-decls)
 
         (*this)
-            .def("min", &wrapped_type::min, py::arg("initial") = std::numeric_limits<value_type>::max())
-            .def("max", &wrapped_type::max, py::arg("initial") = std::numeric_limits<value_type>::lowest())
-            .def("sum", &wrapped_type::sum, py::arg("initial") = 0)
-            .def("abs", &wrapped_type::abs)
+            .def(
+                "min",
+                [](wrapped_type const & self, value_type initial, py::object const & parallel)
+                { return self.min(initial, use_parallel(self, parallel)); },
+                py::arg("initial") = std::numeric_limits<value_type>::max(),
+                py::arg("parallel") = py::none())
+            .def(
+                "max",
+                [](wrapped_type const & self, value_type initial, py::object const & parallel)
+                { return self.max(initial, use_parallel(self, parallel)); },
+                py::arg("initial") = std::numeric_limits<value_type>::lowest(),
+                py::arg("parallel") = py::none())
+            .def(
+                "sum",
+                [](wrapped_type const & self, value_type initial, py::object const & parallel)
+                { return self.sum(initial, use_parallel(self, parallel)); },
+                py::arg("initial") = 0,
+                py::arg("parallel") = py::none())
+            .def(
+                "sum_axis",
+                [](wrapped_type const & self, size_t axis, py::object const & out, py::object const & parallel)
+                {
+                    return reduce_axis(
+                        self,
+                        out,
+                        parallel,
+                        [axis](wrapped_type const & arr, bool use)
+                        { return arr.sum_axis(axis, use); },
+                        [axis](wrapped_type const & arr, wrapped_type & dst, bool use) -> wrapped_type &
+                        { return arr.sum_axis(axis, dst, use); });
+                },
+                py::arg("axis"),
+                py::arg("out") = py::none(),
+                py::arg("parallel") = py::none())
+            .def(
+                "min_axis",
+                [](wrapped_type const & self, size_t axis, py::object const & out, py::object const & parallel)
+                {
+                    return reduce_axis(
+                        self,
+                        out,
+                        parallel,
+                        [axis](wrapped_type const & arr, bool use)
+                        { return arr.min_axis(axis, use); },
+                        [axis](wrapped_type const & arr, wrapped_type & dst, bool use) -> wrapped_type &
+                        { return arr.min_axis(axis, dst, use); });
+                },
+                py::arg("axis"),
+                py::arg("out") = py::none(),
+                py::arg("parallel") = py::none())
+            .def(
+                "max_axis",
+                [](wrapped_type const & self, size_t axis, py::object const & out, py::object const & parallel)
+                {
+                    return reduce_axis(
+                        self,
+                        out,
+                        parallel,
+                        [axis](wrapped_type const & arr, bool use)
+                        { return arr.max_axis(axis, use); },
+                        [axis](wrapped_type const & arr, wrapped_type & dst, bool use) -> wrapped_type &
+                        { return arr.max_axis(axis, dst, use); });
+                },
+                py::arg("axis"),
+                py::arg("out") = py::none(),
+                py::arg("parallel") = py::none())
+            .def(
+                "mean_axis",
+                [](wrapped_type const & self, size_t axis, py::object const & out, py::object const & parallel)
+                {
+                    return reduce_axis(
+                        self,
+                        out,
+                        parallel,
+                        [axis](wrapped_type const & arr, bool use)
+                        { return arr.mean_axis(axis, use); },
+                        [axis](wrapped_type const & arr, wrapped_type & dst, bool use) -> wrapped_type &
+                        { return arr.mean_axis(axis, dst, use); });
+                },
+                py::arg("axis"),
+                py::arg("out") = py::none(),
+                py::arg("parallel") = py::none())
+            .def(
+                "abs",
+                [](wrapped_type const & self, py::object const & out) -> py::object
+                {
+                    if (out.is_none())
+                    {
+                        return py::cast(self.abs());
+                    }
+                    self.abs(check_writable(out.cast<wrapped_type &>()));
+                    return out;
+                },
+                py::arg("out") = py::none())
+            .def(
+                "abs_inplace",
+                [](py::object const & self)
+                {
+                    check_writable(self.cast<wrapped_type &>()).abs_inplace();
+                    return self;
+                })
+            .def(
+                "sort",
+                [](py::object const & self, py::object const & parallel)
+                {
+                    wrapped_type & arr = check_writable(self.cast<wrapped_type &>());
+                    bool const use = use_parallel(arr, parallel);
+                    py::gil_scoped_release const release;
+                    arr.sort(use);
+                    return self;
+                },
+                py::arg("parallel") = py::none())
+            .def(
+                "argsort",
+                [](wrapped_type const & self, py::object const & parallel)
+                {
+                    bool const use = use_parallel(self, parallel);
+                    py::gil_scoped_release const release;
+                    return self.argsort(use);
+                },
+                py::arg("parallel") = py::none())
+            .def(
+                "unique",
+                [](wrapped_type const & self, py::object const & parallel)
+                {
+                    bool const use = use_parallel(self, parallel);
+                    py::gil_scoped_release const release;
+                    return self.unique(use);
+                },
+                py::arg("parallel") = py::none())
+            .def(
+                "searchsorted",
+                [](wrapped_type const & self, wrapped_type const & values, std::string const & side, py::object const & parallel)
+                {
+                    if (side != "left" && side != "right")
+                    {
+                        throw std::invalid_argument(Formatter() << "SimpleArray: side must be 'left' or 'right', not '" << side << "'");
+                    }
+                    bool const use = use_parallel(values, parallel);
+                    py::gil_scoped_release const release;
+                    return self.searchsorted(values, side == "right", use);
+                },
+                py::arg("values"),
+                py::arg("side") = "left",
+                py::arg("parallel") = py::none())
+            .def(
+                "compress",
+                [](wrapped_type const & self, size_t block_size, py::object const & parallel)
+                {
+                    bool const use = use_parallel(self, parallel);
+                    py::gil_scoped_release const release;
+                    return CompressedBuffer::compress(self, block_size, use);
+                },
+                py::arg("block_size") = CompressedBuffer::DEFAULT_BLOCK_SIZE,
+                py::arg("parallel") = py::none())
+            .def_static(
+                "from_compressed",
+                [](CompressedBuffer const & compressed, py::object const & parallel)
+                {
+                    bool const use = parallel.is_none() ? ThreadPool::instance().use_parallel(compressed.nbytes() / compressed.element_size())
+                                                        : parallel.cast<bool>();
+                    py::gil_scoped_release const release;
+                    return compressed.decompress_array<value_type>(use);
+                },
+                py::arg("compressed"),
+                py::arg("parallel") = py::none())
+            //
+            ;
+
+        return *this;
+    }
+
+    wrapper_type & wrap_indexing()
+    {
+        namespace py = pybind11; // NOLINT(misc-unused-alias-decls)
+
+        using mask_type = SimpleArray<bool>;
+
+        (*this)
+            .template wrap_indexing_with<int32_t>()
+            .template wrap_indexing_with<int64_t>()
+            .template wrap_indexing_with<uint32_t>()
+            .template wrap_indexing_with<uint64_t>()
+            .def(
+                "select",
+                [](wrapped_type const & self, mask_type const & mask, py::object const & out, py::object const & parallel) -> py::object
+                {
+                    bool const use = use_parallel(mask, parallel);
+                    if (out.is_none())
+                    {
+                        py::gil_scoped_release const release;
+                        return py::cast(self.select(mask, use));
+                    }
+                    wrapped_type & arr = check_writable(out.cast<wrapped_type &>());
+                    {
+                        py::gil_scoped_release const release;
+                        self.select(mask, arr, use);
+                    }
+                    return out;
+                },
+                py::arg("mask"),
+                py::arg("out") = py::none(),
+                py::arg("parallel") = py::none())
+            .def(
+                "assign",
+                [](py::object const & self, mask_type const & mask, wrapped_type const & values, py::object const & parallel)
+                {
+                    wrapped_type & arr = check_writable(self.cast<wrapped_type &>());
+                    bool const use = use_parallel(mask, parallel);
+                    py::gil_scoped_release const release;
+                    arr.assign(mask, values, use);
+                    return self;
+                },
+                py::arg("mask"),
+                py::arg("values"),
+                py::arg("parallel") = py::none())
+            .def(
+                "assign",
+                [](py::object const & self, mask_type const & mask, value_type value, py::object const & parallel)
+                {
+                    wrapped_type & arr = check_writable(self.cast<wrapped_type &>());
+                    bool const use = use_parallel(mask, parallel);
+                    py::gil_scoped_release const release;
+                    arr.assign(mask, value, use);
+                    return self;
+                },
+                py::arg("mask"),
+                py::arg("value"),
+                py::arg("parallel") = py::none())
+            //
+            ;
+
+        return *this;
+    }
+
+    /// Overload take and put for the indices of the integer type I.
+    template <typename I>
+    wrapper_type & wrap_indexing_with()
+    {
+        namespace py = pybind11; // NOLINT(misc-unused-alias-decls)
+
+        (*this)
+            .def(
+                "take",
+                [](wrapped_type const & self, SimpleArray<I> const & indices, py::object const & out, py::object const & parallel) -> py::object
+                {
+                    bool const use = use_parallel(indices, parallel);
+                    if (out.is_none())
+                    {
+                        py::gil_scoped_release const release;
+                        return py::cast(self.take(indices, use));
+                    }
+                    wrapped_type & arr = check_writable(out.cast<wrapped_type &>());
+                    {
+                        py::gil_scoped_release const release;
+                        self.take(indices, arr, use);
+                    }
+                    return out;
+                },
+                py::arg("indices"),
+                py::arg("out") = py::none(),
+                py::arg("parallel") = py::none())
+            .def(
+                "put",
+                [](py::object const & self, SimpleArray<I> const & indices, wrapped_type const & values, py::object const & parallel)
+                {
+                    wrapped_type & arr = check_writable(self.cast<wrapped_type &>());
+                    bool const use = use_parallel(indices, parallel);
+                    py::gil_scoped_release const release;
+                    arr.put(indices, values, use);
+                    return self;
+                },
+                py::arg("indices"),
+                py::arg("values"),
+                py::arg("parallel") = py::none())
             //
             ;
 
         return *this;
     }
 
+    /// None follows the size threshold of the global thread pool.
+    template <typename U>
+    static bool use_parallel(SimpleArray<U> const & arr, pybind11::object const & parallel)
+    {
+        if (parallel.is_none())
+        {
+            return ThreadPool::instance().use_parallel(arr.size());
+        }
+        return parallel.cast<bool>();
+    }
+
+    static wrapped_type & check_writable(wrapped_type & arr)
+    {
+        if (arr && arr.buffer().is_readonly())
+        {
+            throw std::runtime_error("SimpleArray: cannot write to read-only buffer");
+        }
+        return arr;
+    }
+
+    /**
+     * A writable ndarray or buffer view may be written without telling the
+     * array, so handing one out counts as a modification.
+     */
+    static void bump_if_writable(wrapped_type & arr)
+    {
+        if (arr && !arr.buffer().is_readonly())
+        {
+            arr.bump_epoch();
+        }
+    }
+
+    /// Reduce an axis into a new array or into the writable out.
+    template <typename N, typename O>
+    static pybind11::object reduce_axis(wrapped_type const & self, pybind11::object const & out, pybind11::object const & parallel, N && to_new, O && to_out)
+    {
+        namespace py = pybind11; // NOLINT(misc-unused-alias-decls)
+
+        bool const use = use_parallel(self, parallel);
+        if (out.is_none())
+        {
+            wrapped_type ret = [&]()
+            {
+                py::gil_scoped_release const release;
+                return to_new(self, use);
+            }();
+            return py::cast(std::move(ret));
+        }
+        wrapped_type & dst = check_writable(out.cast<wrapped_type &>());
+        {
+            py::gil_scoped_release const release;
+            to_out(self, dst, use);
+        }
+        return out;
+    }
+
     static void setitem_parser(wrapped_type & arr_out, pybind11::args const & args)
     {
         namespace py = pybind11;
 
+        check_writable(arr_out);
+
         if (args.size() == 2)
         {
             // sarr[K] = V
@@ -414,6 +894,36 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapSimpleArray
 
 void wrap_SimpleArray(pybind11::module & mod)
 {
+    namespace py = pybind11; // NOLINT(misc-unused-alias-decls)
+
+    mod.def(
+        "get_num_threads",
+        []()
+        { return ThreadPool::instance().nthread(); });
+    mod.def(
+        "set_num_threads",
+        [](size_t value)
+        { ThreadPool::instance().set_nthread(value); },
+        py::arg("value"));
+    mod.def(
+        "get_pin_threads",
+        []()
+        { return ThreadPool::instance().pin(); });
+    mod.def(
+        "set_pin_threads",
+        [](bool value)
+        { ThreadPool::instance().set_pin(value); },
+        py::arg("value"));
+    mod.def(
+        "get_parallel_threshold",
+        []()
+        { return ThreadPool::instance().threshold(); });
+    mod.def(
+        "set_parallel_threshold",
+        [](size_t value)
+        { ThreadPool::instance().set_threshold(value); },
+        py::arg("value"));
+
     WrapSimpleArray<bool>::commit(mod, "SimpleArrayBool", "SimpleArrayBool");
     WrapSimpleArray<int8_t>::commit(mod, "SimpleArrayInt8", "SimpleArrayInt8");
     WrapSimpleArray<int16_t>::commit(mod, "SimpleArrayInt16", "SimpleArrayInt16");
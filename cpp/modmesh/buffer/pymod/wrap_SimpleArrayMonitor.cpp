@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/pymod/buffer_pymod.hpp> // Must be the first include.
+#include <modmesh/buffer/buffer.hpp>
+#include <modmesh/buffer/pymod/buffer_pymod.hpp> // Must be the first include.
+#include <modmesh/buffer/buffer.hpp>
+
+namespace modmesh
+{
+
+namespace python
+{
+
+namespace detail
+{
+
+inline MonitorReduction make_monitor_reduction(std::string const & op)
+{
+    if ("min" == op)
+    {
+        return MonitorReduction::MIN;
+    }
+    if ("max" == op)
+    {
+        return MonitorReduction::MAX;
+    }
+    if ("mean" == op)
+    {
+        return MonitorReduction::MEAN;
+    }
+    if ("sum" == op)
+    {
+        return MonitorReduction::SUM;
+    }
+    throw std::invalid_argument(Formatter() << "SimpleArrayMonitor: unknown reduction \"" << op << "\"");
+}
+
+} /* end namespace detail */
+
+template <typename T>
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapSimpleArrayMonitor
+    : public WrapBase<WrapSimpleArrayMonitor<T>, SimpleArrayMonitor<T>, std::shared_ptr<SimpleArrayMonitor<T>>>
+{
+
+    using root_base_type = WrapBase<WrapSimpleArrayMonitor<T>, SimpleArrayMonitor<T>, std::shared_ptr<SimpleArrayMonitor<T>>>;
+    using wrapped_type = typename root_base_type::wrapped_type;
+
+    friend root_base_type;
+
+    WrapSimpleArrayMonitor(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(py::init([]()
+                          { return std::make_shared<wrapped_type>(); }))
+            .def_property_readonly("nitem", &wrapped_type::nitem)
+            .def_property_readonly("nsample", &wrapped_type::nsample)
+            .def_property_readonly("width", &wrapped_type::width)
+            .def_property_readonly("names", &wrapped_type::names)
+            .def_property_readonly("times", &wrapped_type::times)
+            .def_property_readonly("values", &wrapped_type::values)
+            .def("add_probe", &wrapped_type::add_probe, py::arg("name"), py::arg("row"), py::arg("column") = 0)
+            .def("add_line", &wrapped_type::add_line, py::arg("name"), py::arg("begin"), py::arg("end"), py::arg("column") = 0)
+            .def(
+                "add_reduction",
+                [](wrapped_type & self, std::string const & name, ssize_t begin, ssize_t end, std::string const & op, size_t column)
+                {
+                    self.add_reduction(name, begin, end, column, detail::make_monitor_reduction(op));
+                },
+                py::arg("name"),
+                py::arg("begin"),
+                py::arg("end"),
+                py::arg("op"),
+                py::arg("column") = 0)
+            .def("evaluate", &wrapped_type::evaluate, py::arg("field"), py::arg("time") = 0.0)
+            .def("series", &wrapped_type::series, py::arg("name"))
+            .def("reserve", &wrapped_type::reserve, py::arg("nsample"))
+            .def("clear", &wrapped_type::clear)
+            //
+            ;
+    }
+
+}; /* end class WrapSimpleArrayMonitor */
+
+void wrap_SimpleArrayMonitor(pybind11::module & mod)
+{
+    WrapSimpleArrayMonitor<float>::commit(mod, "SimpleArrayMonitorFloat32", "Probes and reductions of SimpleArrayFloat32 over time");
+    WrapSimpleArrayMonitor<double>::commit(mod, "SimpleArrayMonitorFloat64", "Probes and reductions of SimpleArrayFloat64 over time");
+}
+
+} /* end namespace python */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -27,6 +27,7 @@
  */
 
 #include <modmesh/buffer/pymod/buffer_pymod.hpp> // Must be the first include.
+#include <modmesh/buffer/pymod/DLPack.hpp>
 
 namespace modmesh
 {
@@ -75,202 +76,150 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapSimpleArrayPlex : public WrapBase<Wr
                     }),
                 pybind11::arg("array"))
             .def_property_readonly("typed", &get_typed_array)
+            .def_property_readonly(
+                "dtype",
+                [](wrapped_type const & self)
+                { return get_string_from_data_type(self.data_type()); })
+            .def_property_readonly("shape", &get_shape)
+            .def_property_readonly("ndim", &wrapped_type::ndim)
+            .def_property_readonly("size", &wrapped_type::size)
+            .def_property_readonly("nbytes", &wrapped_type::nbytes)
+            .def_timed("fill", &fill, pybind11::arg("value"))
+            .def_timed(
+                "sum",
+                [](wrapped_type const & self)
+                {
+                    return self.visit([](auto const & array)
+                                      { return to_python(array.sum()); });
+                })
+            .def_timed(
+                "min",
+                [](wrapped_type const & self)
+                {
+                    return self.visit([](auto const & array)
+                                      { return to_python(array.min()); });
+                })
+            .def_timed(
+                "max",
+                [](wrapped_type const & self)
+                {
+                    return self.visit([](auto const & array)
+                                      { return to_python(array.max()); });
+                })
+            .def_timed(
+                "astype",
+                [](wrapped_type const & self, std::string const & datatype)
+                { return self.astype(datatype); },
+                pybind11::arg("dtype"))
+            .def_timed(
+                "copy_from",
+                [](wrapped_type & self, wrapped_type const & other)
+                { self.copy_from(other); },
+                pybind11::arg("other"))
+            .def(
+                "__dlpack__",
+                [](wrapped_type const & self, pybind11::object const &, pybind11::object const &)
+                { return dlpack::to_capsule(self); },
+                pybind11::kw_only(),
+                pybind11::arg("stream") = pybind11::none(),
+                pybind11::arg("max_version") = pybind11::none())
+            .def("__dlpack_device__", [](wrapped_type const &)
+                 { return dlpack::device(); })
             /// TODO: should have the same interface as WrapSimpleArray
             ;
     }
 
-    /// Initialize the arrayplex with the given value
-    // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
-    static wrapped_type init_array_plex_with_value(pybind11::object const & shape_in, pybind11::object const & value, std::string const & datatype)
+    /// Cast the Python value to the element type, requiring the matching Python type.
+    template <typename T>
+    static T cast_value(pybind11::object const & value)
     {
-        const shape_type shape = make_shape(shape_in);
-        wrapped_type array_plex(shape, datatype);
-
-        // cast value to correct type based on the datatype
-        switch (array_plex.data_type())
-        {
-        case DataType::Bool:
+        if constexpr (std::is_same_v<T, bool>)
         {
             if (!pybind11::isinstance<pybind11::bool_>(value))
             {
                 throw std::runtime_error("Data type mismatch, expected Python bool");
             }
-            auto * array = static_cast<SimpleArrayBool *>(array_plex.mutable_instance_ptr());
-            array->fill(value.cast<bool>());
-            break;
-        }
-        case DataType::Int8:
-        {
-            if (!pybind11::isinstance<pybind11::int_>(value))
-            {
-                throw std::runtime_error("Data type mismatch, expected Python int");
-            }
-            auto * array = static_cast<SimpleArrayInt8 *>(array_plex.mutable_instance_ptr());
-            array->fill(value.cast<int8_t>());
-            break;
-        }
-        case DataType::Int16:
-        {
-            if (!pybind11::isinstance<pybind11::int_>(value))
-            {
-                throw std::runtime_error("Data type mismatch, expected Python int");
-            }
-            auto * array = static_cast<SimpleArrayInt16 *>(array_plex.mutable_instance_ptr());
-            array->fill(value.cast<int16_t>());
-            break;
-        }
-        case DataType::Int32:
-        {
-            if (!pybind11::isinstance<pybind11::int_>(value))
-            {
-                throw std::runtime_error("Data type mismatch, expected Python int");
-            }
-            auto * array = static_cast<SimpleArrayInt32 *>(array_plex.mutable_instance_ptr());
-            array->fill(value.cast<int32_t>());
-            break;
-        }
-        case DataType::Int64:
-        {
-            if (!pybind11::isinstance<pybind11::int_>(value))
-            {
-                throw std::runtime_error("Data type mismatch, expected Python int");
-            }
-            auto * array = static_cast<SimpleArrayInt64 *>(array_plex.mutable_instance_ptr());
-            array->fill(value.cast<int64_t>());
-            break;
-        }
-        case DataType::Uint8:
-        {
-            if (!pybind11::isinstance<pybind11::int_>(value))
-            {
-                throw std::runtime_error("Data type mismatch, expected Python int");
-            }
-            auto * array = static_cast<SimpleArrayUint8 *>(array_plex.mutable_instance_ptr());
-            array->fill(value.cast<uint8_t>());
-            break;
-        }
-        case DataType::Uint16:
-        {
-            if (!pybind11::isinstance<pybind11::int_>(value))
-            {
-                throw std::runtime_error("Data type mismatch, expected Python int");
-            }
-            auto * array = static_cast<SimpleArrayUint16 *>(array_plex.mutable_instance_ptr());
-            array->fill(value.cast<uint16_t>());
-            break;
-        }
-        case DataType::Uint32:
-        {
-            if (!pybind11::isinstance<pybind11::int_>(value))
-            {
-                throw std::runtime_error("Data type mismatch, expected Python int");
-            }
-            auto * array = static_cast<SimpleArrayUint32 *>(array_plex.mutable_instance_ptr());
-            array->fill(value.cast<int32_t>());
-            break;
+            return value.cast<bool>();
         }
-        case DataType::Uint64:
+        else if constexpr (std::is_integral_v<T>)
         {
             if (!pybind11::isinstance<pybind11::int_>(value))
             {
                 throw std::runtime_error("Data type mismatch, expected Python int");
             }
-            auto * array = static_cast<SimpleArrayUint64 *>(array_plex.mutable_instance_ptr());
-            array->fill(value.cast<int64_t>());
-            break;
+            return value.cast<T>();
         }
-        case DataType::Float32:
+        else
         {
             if (!pybind11::isinstance<pybind11::float_>(value))
             {
                 throw std::runtime_error("Data type mismatch, expected Python float");
             }
-            auto * array = static_cast<SimpleArrayFloat32 *>(array_plex.mutable_instance_ptr());
-            array->fill(value.cast<float>());
-            break;
+            return T(value.cast<double>());
         }
-        case DataType::Float64:
+    }
+
+    /// Convert the element to the Python scalar.
+    template <typename T>
+    static pybind11::object to_python(T const & value)
+    {
+        if constexpr (is_half_v<T>)
         {
-            if (!pybind11::isinstance<pybind11::float_>(value))
-            {
-                throw std::runtime_error("Data type mismatch, expected Python float");
-            }
-            auto * array = static_cast<SimpleArrayFloat64 *>(array_plex.mutable_instance_ptr());
-            array->fill(value.cast<double>());
-            break;
+            return pybind11::float_(static_cast<float>(value));
         }
-        default:
-            throw std::runtime_error("Unsupported datatype");
+        else
+        {
+            return pybind11::cast(value);
         }
+    }
+
+    /// Initialize the arrayplex with the given value
+    // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    static wrapped_type init_array_plex_with_value(pybind11::object const & shape_in, pybind11::object const & value, std::string const & datatype)
+    {
+        wrapped_type array_plex(make_shape(shape_in), datatype);
+        fill(array_plex, value);
         return array_plex;
     }
 
+    static void fill(wrapped_type & array_plex, pybind11::object const & value)
+    {
+        array_plex.visit(
+            [&value](auto & array)
+            {
+                using value_type = typename std::decay_t<decltype(array)>::value_type;
+                array.fill(cast_value<value_type>(value));
+            });
+    }
+
     /// Return the typed function from the arrayplex
     static pybind11::object
     get_typed_array(wrapped_type const & array_plex)
     {
-        switch (array_plex.data_type())
-        {
-        case DataType::Bool:
-        {
-            const auto * array = static_cast<const SimpleArrayBool *>(array_plex.instance_ptr());
-            return pybind11::cast(std::move(SimpleArrayBool(*array)));
-        }
-        case DataType::Int8:
-        {
-            const auto * array = static_cast<const SimpleArrayInt8 *>(array_plex.instance_ptr());
-            return pybind11::cast(std::move(SimpleArrayInt8(*array)));
-        }
-        case DataType::Int16:
-        {
-            const auto * array = static_cast<const SimpleArrayInt16 *>(array_plex.instance_ptr());
-            return pybind11::cast(std::move(SimpleArrayInt16(*array)));
-        }
-        case DataType::Int32:
-        {
-            const auto * array = static_cast<const SimpleArrayInt32 *>(array_plex.instance_ptr());
-            return pybind11::cast(std::move(SimpleArrayInt32(*array)));
-        }
-        case DataType::Int64:
-        {
-            const auto * array = static_cast<const SimpleArrayInt64 *>(array_plex.instance_ptr());
-            return pybind11::cast(std::move(SimpleArrayInt64(*array)));
-        }
-        case DataType::Uint8:
-        {
-            const auto * array = static_cast<const SimpleArrayUint8 *>(array_plex.instance_ptr());
-            return pybind11::cast(std::move(SimpleArrayUint8(*array)));
-        }
-        case DataType::Uint16:
-        {
-            const auto * array = static_cast<const SimpleArrayUint16 *>(array_plex.instance_ptr());
-            return pybind11::cast(std::move(SimpleArrayUint16(*array)));
-        }
-        case DataType::Uint32:
-        {
-            const auto * array = static_cast<const SimpleArrayUint32 *>(array_plex.instance_ptr());
-            return pybind11::cast(std::move(SimpleArrayUint32(*array)));
-        }
-        case DataType::Uint64:
-        {
-            const auto * array = static_cast<const SimpleArrayUint64 *>(array_plex.instance_ptr());
-            return pybind11::cast(std::move(SimpleArrayUint64(*array)));
-        }
-        case DataType::Float32:
-        {
-            const auto * array = static_cast<const SimpleArrayFloat32 *>(array_plex.instance_ptr());
-            return pybind11::cast(std::move(SimpleArrayFloat32(*array)));
-        }
-        case DataType::Float64:
-        {
-            const auto * array = static_cast<const SimpleArrayFloat64 *>(array_plex.instance_ptr());
-            return pybind11::cast(std::move(SimpleArrayFloat64(*array)));
-        }
-        default:
+        return array_plex.visit(
+            [](auto const & array) -> pybind11::object
+            {
+                using array_type = std::decay_t<decltype(array)>;
+                if constexpr (is_half_v<typename array_type::value_type>)
+                {
+                    throw std::runtime_error("Unsupported datatype");
+                }
+                else
+                {
+                    return pybind11::cast(array_type(array));
+                }
+            });
+    }
+
+    static pybind11::tuple get_shape(wrapped_type const & array_plex)
+    {
+        shape_type const & shape = array_plex.shape();
+        pybind11::tuple ret(shape.size());
+        for (size_t i = 0; i < shape.size(); ++i)
         {
-            throw std::runtime_error("Unsupported datatype");
-        }
+            ret[i] = shape[i];
         }
+        return ret;
     }
 
     static shape_type make_shape(pybind11::object const & shape_in)
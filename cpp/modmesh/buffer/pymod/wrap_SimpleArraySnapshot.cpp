@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/pymod/buffer_pymod.hpp> // Must be the first include.
+#include <modmesh/buffer/buffer.hpp>
+
+namespace modmesh
+{
+
+namespace python
+{
+
+template <typename T>
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapSimpleArraySnapshot
+    : public WrapBase<WrapSimpleArraySnapshot<T>, SimpleArraySnapshot<T>, std::shared_ptr<SimpleArraySnapshot<T>>>
+{
+
+    using root_base_type = WrapBase<WrapSimpleArraySnapshot<T>, SimpleArraySnapshot<T>, std::shared_ptr<SimpleArraySnapshot<T>>>;
+    using wrapped_type = typename root_base_type::wrapped_type;
+
+    friend root_base_type;
+
+    WrapSimpleArraySnapshot(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(py::init([]()
+                          { return std::make_shared<wrapped_type>(); }))
+            .def_property_readonly("npublished", &wrapped_type::npublished)
+            .def_property_readonly("serial", &wrapped_type::serial)
+            .def_property_readonly("time", &wrapped_type::time)
+            .def_property_readonly("front", &wrapped_type::front)
+            .def("publish", &wrapped_type::publish, py::arg("array"), py::arg("time") = 0.0, py::call_guard<py::gil_scoped_release>())
+            .def("acquire", &wrapped_type::acquire)
+            //
+            ;
+    }
+
+}; /* end class WrapSimpleArraySnapshot */
+
+void wrap_SimpleArraySnapshot(pybind11::module & mod)
+{
+    WrapSimpleArraySnapshot<float>::commit(mod, "SimpleArraySnapshotFloat32", "Double-buffered snapshots of SimpleArrayFloat32");
+    WrapSimpleArraySnapshot<double>::commit(mod, "SimpleArraySnapshotFloat64", "Double-buffered snapshots of SimpleArrayFloat64");
+}
+
+} /* end namespace python */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
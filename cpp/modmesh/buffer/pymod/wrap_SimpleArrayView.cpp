@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/pymod/buffer_pymod.hpp> // Must be the first include.
+#include <modmesh/buffer/buffer.hpp>
+
+namespace modmesh
+{
+
+namespace python
+{
+
+namespace detail
+{
+
+/**
+ * Apply a Python index key (int, slice, Ellipsis or a tuple of them) to a
+ * view.  Integers drop the dimension; slices keep it.
+ */
+template <typename V>
+V index_view(V view, pybind11::object const & key)
+{
+    namespace py = pybind11;
+
+    py::tuple const keys = py::isinstance<py::tuple>(key) ? key.cast<py::tuple>() : py::make_tuple(key);
+    size_t nkey = 0;
+    bool has_ellipsis = false;
+    for (py::handle const item : keys)
+    {
+        if (item.is(py::ellipsis()))
+        {
+            if (has_ellipsis)
+            {
+                throw py::index_error("SimpleArrayView: an index can only have a single ellipsis");
+            }
+            has_ellipsis = true;
+        }
+        else
+        {
+            ++nkey;
+        }
+    }
+    if (nkey > view.ndim())
+    {
+        throw py::index_error(Formatter() << "SimpleArrayView: too many indices (" << nkey << ") for "
+                                          << view.ndim() << "-dimensional view");
+    }
+
+    // The ellipsis stands for the dimensions not covered by the other keys.
+    size_t const nskip = view.ndim() - nkey;
+    size_t dim = 0;
+    for (py::handle const item : keys)
+    {
+        if (item.is(py::ellipsis()))
+        {
+            dim += nskip;
+        }
+        else if (py::isinstance<py::slice>(item))
+        {
+            py::slice const pyslice = item.cast<py::slice>();
+            SimpleArraySlice slice;
+            if (!pyslice.attr("start").is_none())
+            {
+                slice.start = pyslice.attr("start").cast<ssize_t>();
+            }
+            if (!pyslice.attr("stop").is_none())
+            {
+                slice.stop = pyslice.attr("stop").cast<ssize_t>();
+            }
+            if (!pyslice.attr("step").is_none())
+            {
+                slice.step = pyslice.attr("step").cast<ssize_t>();
+            }
+            view = view.slice(dim, slice);
+            ++dim;
+        }
+        else
+        {
+            // Selecting removes the dimension, so dim stays.
+            view = view.select(dim, item.cast<ssize_t>());
+        }
+    }
+    return view;
+}
+
+} /* end namespace detail */
+
+template <typename T>
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapSimpleArrayView
+    : public WrapBase<WrapSimpleArrayView<T>, SimpleArrayView<T>>
+{
+
+    using root_base_type = WrapBase<WrapSimpleArrayView<T>, SimpleArrayView<T>>;
+    using wrapped_type = typename root_base_type::wrapped_type;
+    using value_type = typename wrapped_type::value_type;
+    using shape_type = typename wrapped_type::shape_type;
+
+    friend root_base_type;
+
+    WrapSimpleArrayView(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(
+                py::init(
+                    [](SimpleArray<T> & array)
+                    { return array.view(); }),
+                py::arg("array"))
+            .def_property_readonly("ndim", &wrapped_type::ndim)
+            .def_property_readonly("size", &wrapped_type::size)
+            .def_property_readonly("is_contiguous", &wrapped_type::is_contiguous)
+            .def_property_readonly(
+                "shape",
+                [](wrapped_type const & self)
+                {
+                    py::tuple ret(self.ndim());
+                    for (size_t i = 0; i < self.ndim(); ++i)
+                    {
+                        ret[i] = self.shape(i);
+                    }
+                    return ret;
+                })
+            .def_property_readonly(
+                "stride",
+                [](wrapped_type const & self)
+                {
+                    py::tuple ret(self.ndim());
+                    for (size_t i = 0; i < self.ndim(); ++i)
+                    {
+                        ret[i] = self.stride(i);
+                    }
+                    return ret;
+                })
+            .def_property_readonly(
+                "ndarray",
+                [](wrapped_type const & self)
+                {
+                    if (!self.buffer())
+                    {
+                        return py::array(py::dtype::of<T>(), std::vector<ssize_t>{0});
+                    }
+                    std::vector<ssize_t> const shape(self.shape().begin(), self.shape().end());
+                    std::vector<ssize_t> stride(self.stride().begin(), self.stride().end());
+                    for (ssize_t & v : stride) { v *= static_cast<ssize_t>(sizeof(T)); }
+                    py::array ret(
+                        py::detail::npy_format_descriptor<T>::dtype(), // Numpy dtype
+                        shape, // View dimensions
+                        stride, // Strides (in bytes, possibly negative) for each index
+                        self.origin(), // Pointer to the first element of the view
+                        py::cast(self.buffer()) // Python object owning the buffer
+                    );
+                    if (self.buffer()->is_readonly())
+                    {
+                        ret.attr("flags").attr("writeable") = false;
+                    }
+                    return ret;
+                })
+            .def("__len__", [](wrapped_type const & self)
+                 { return self.ndim() ? self.shape(0) : 0; })
+            .def(
+                "__getitem__",
+                [](wrapped_type const & self, py::object const & key) -> py::object
+                {
+                    wrapped_type const ret = detail::index_view(self, key);
+                    if (0 == ret.ndim())
+                    {
+                        return py::cast(*ret.origin());
+                    }
+                    return py::cast(ret);
+                })
+            .def(
+                "__setitem__",
+                [](wrapped_type const & self, py::object const & key, py::object const & value)
+                {
+                    check_writable(self);
+                    wrapped_type const target = detail::index_view(self, key);
+                    if (0 == target.ndim())
+                    {
+                        *target.origin() = value.cast<value_type>();
+                    }
+                    else if (py::isinstance<py::array>(value))
+                    {
+                        auto src = py::array_t<T, py::array::forcecast>::ensure(value);
+                        if (!src)
+                        {
+                            throw py::value_error("SimpleArrayView: cannot convert the value to the view type");
+                        }
+                        shape_type shape;
+                        typename wrapped_type::sstride_type stride;
+                        for (ssize_t i = 0; i < src.ndim(); ++i)
+                        {
+                            shape.push_back(src.shape(i));
+                            stride.push_back(src.strides(i) / static_cast<ssize_t>(sizeof(T)));
+                        }
+                        if (!(shape == target.shape()))
+                        {
+                            throw py::value_error("SimpleArrayView: shape of the value differs from the view");
+                        }
+                        if (0 != target.size())
+                        {
+                            strided_copy(src.data(), stride.data(), target.origin(), target.stride().data(),
+                                         shape.data(), shape.size());
+                        }
+                    }
+                    else
+                    {
+                        target.fill(value.cast<value_type>());
+                    }
+                    self.bump_epoch();
+                })
+            .def(
+                "transpose",
+                [](wrapped_type const & self, py::object const & axes)
+                {
+                    if (axes.is_none())
+                    {
+                        return self.transpose();
+                    }
+                    return self.transpose(make_shape(axes));
+                },
+                py::arg("axes") = py::none())
+            .def_property_readonly(
+                "T",
+                [](wrapped_type const & self)
+                { return self.transpose(); })
+            .def(
+                "reshape",
+                [](wrapped_type const & self, py::object const & shape)
+                { return self.reshape(make_shape(shape)); },
+                py::arg("shape"))
+            .def("copy", &wrapped_type::copy)
+            .def(
+                "fill",
+                [](wrapped_type const & self, value_type const & value)
+                {
+                    check_writable(self);
+                    self.fill(value);
+                },
+                py::arg("value"))
+            //
+            ;
+    }
+
+    static void check_writable(wrapped_type const & self)
+    {
+        if (self.buffer() && self.buffer()->is_readonly())
+        {
+            throw std::runtime_error("SimpleArrayView: cannot write to read-only buffer");
+        }
+    }
+
+    static shape_type make_shape(pybind11::object const & shape_in)
+    {
+        namespace py = pybind11; // NOLINT(misc-unused-alias-decls)
+        shape_type shape;
+        try
+        {
+            shape.push_back(shape_in.cast<size_t>());
+        }
+        catch (const py::cast_error &)
+        {
+            shape = shape_in.cast<std::vector<size_t>>();
+        }
+        return shape;
+    }
+
+}; /* end class WrapSimpleArrayView */
+
+void wrap_SimpleArrayView(pybind11::module & mod)
+{
+    WrapSimpleArrayView<bool>::commit(mod, "SimpleArrayViewBool", "SimpleArrayViewBool");
+    WrapSimpleArrayView<int8_t>::commit(mod, "SimpleArrayViewInt8", "SimpleArrayViewInt8");
+    WrapSimpleArrayView<int16_t>::commit(mod, "SimpleArrayViewInt16", "SimpleArrayViewInt16");
+    WrapSimpleArrayView<int32_t>::commit(mod, "SimpleArrayViewInt32", "SimpleArrayViewInt32");
+    WrapSimpleArrayView<int64_t>::commit(mod, "SimpleArrayViewInt64", "SimpleArrayViewInt64");
+    WrapSimpleArrayView<uint8_t>::commit(mod, "SimpleArrayViewUint8", "SimpleArrayViewUint8");
+    WrapSimpleArrayView<uint16_t>::commit(mod, "SimpleArrayViewUint16", "SimpleArrayViewUint16");
+    WrapSimpleArrayView<uint32_t>::commit(mod, "SimpleArrayViewUint32", "SimpleArrayViewUint32");
+    WrapSimpleArrayView<uint64_t>::commit(mod, "SimpleArrayViewUint64", "SimpleArrayViewUint64");
+    WrapSimpleArrayView<float>::commit(mod, "SimpleArrayViewFloat32", "SimpleArrayViewFloat32");
+    WrapSimpleArrayView<double>::commit(mod, "SimpleArrayViewFloat64", "SimpleArrayViewFloat64");
+}
+
+} /* end namespace python */
+
+} /* end namespace modmesh */
@@ -0,0 +1,658 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Vectorized kernels for the contiguous reductions and element-wise
+ * operations of SimpleArray.
+ *
+ * The generic kernels use multiple independent accumulators so that the
+ * compiler can vectorize them for any element type.  For float and double,
+ * explicit AVX2 and AVX-512 kernels are selected at runtime on x86-64 with
+ * GCC or Clang, and NEON kernels are used on aarch64.
+ *
+ * All the kernels keep the semantics of the scalar loops: min/max skip NaN
+ * elements unless the initial value is NaN, and a summation of fewer
+ * elements than one unrolled block is carried out in sequence.
+ */
+
+#include <modmesh/base.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define MODMESH_SIMD_X86 1
+#include <immintrin.h>
+#define MODMESH_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#define MODMESH_SIMD_TARGET_AVX512 __attribute__((target("avx512f")))
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define MODMESH_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace modmesh
+{
+
+namespace simd
+{
+
+enum class SimdLevel
+{
+    Generic,
+    NEON,
+    AVX2,
+    AVX512,
+}; /* end enum class SimdLevel */
+
+inline char const * to_string(SimdLevel level)
+{
+    switch (level)
+    {
+    case SimdLevel::NEON: return "neon";
+    case SimdLevel::AVX2: return "avx2";
+    case SimdLevel::AVX512: return "avx512";
+    case SimdLevel::Generic:
+    default: return "generic";
+    }
+}
+
+/// The best instruction set supported by the running processor.
+inline SimdLevel detect_level()
+{
+#if defined(MODMESH_SIMD_X86)
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return SimdLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return SimdLevel::AVX2;
+    }
+    return SimdLevel::Generic;
+#elif defined(MODMESH_SIMD_NEON)
+    return SimdLevel::NEON;
+#else
+    return SimdLevel::Generic;
+#endif
+}
+
+namespace detail
+{
+
+inline std::atomic<SimdLevel> & level_storage()
+{
+    static std::atomic<SimdLevel> value{detect_level()};
+    return value;
+}
+
+} /* end namespace detail */
+
+/// The instruction set used by the kernels.
+inline SimdLevel level() { return detail::level_storage().load(std::memory_order_relaxed); }
+
+/**
+ * Select the instruction set used by the kernels, e.g., to compare the
+ * generic and the explicitly vectorized code.  It is an error to select an
+ * instruction set the processor does not support.
+ */
+inline void set_level(SimdLevel value)
+{
+    SimdLevel const detected = detect_level();
+    bool const supported = (SimdLevel::Generic == value) || (value == detected) || (SimdLevel::AVX2 == value && SimdLevel::AVX512 == detected);
+    if (!supported)
+    {
+        throw std::invalid_argument(Formatter() << "simd: " << to_string(value) << " is not supported (detected "
+                                                << to_string(detected) << ")");
+    }
+    detail::level_storage().store(value, std::memory_order_relaxed);
+}
+
+namespace detail
+{
+
+/// Number of independent accumulators in the generic kernels.
+constexpr size_t NACC = 8;
+
+/// Summations shorter than this are not reordered.
+constexpr size_t SERIAL_SUM_SIZE = 32;
+
+template <typename T>
+T sum_generic(T const * data, size_t size, T initial)
+{
+    size_t it = 0;
+    if (size >= SERIAL_SUM_SIZE)
+    {
+        T acc[NACC] = {}; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+        for (; it + NACC <= size; it += NACC)
+        {
+            for (size_t k = 0; k < NACC; ++k)
+            {
+                acc[k] += data[it + k];
+            }
+        }
+        for (size_t half = NACC / 2; half > 0; half /= 2)
+        {
+            for (size_t k = 0; k < half; ++k)
+            {
+                acc[k] += acc[k + half];
+            }
+        }
+        initial += acc[0];
+    }
+    for (; it < size; ++it)
+    {
+        initial += data[it];
+    }
+    return initial;
+}
+
+template <typename T, typename C>
+T select_generic(T const * data, size_t size, T initial, C && comp)
+{
+    size_t it = 0;
+    if (size >= NACC)
+    {
+        T acc[NACC]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+        std::fill(acc, acc + NACC, initial);
+        for (; it + NACC <= size; it += NACC)
+        {
+            for (size_t k = 0; k < NACC; ++k)
+            {
+                acc[k] = comp(data[it + k], acc[k]) ? data[it + k] : acc[k];
+            }
+        }
+        for (size_t k = 0; k < NACC; ++k)
+        {
+            initial = comp(acc[k], initial) ? acc[k] : initial;
+        }
+    }
+    for (; it < size; ++it)
+    {
+        initial = comp(data[it], initial) ? data[it] : initial;
+    }
+    return initial;
+}
+
+template <typename T>
+void abs_generic(T const * src, size_t size, T * dst)
+{
+    for (size_t it = 0; it < size; ++it)
+    {
+        dst[it] = src[it] < 0 ? -src[it] : src[it];
+    }
+}
+
+template <>
+inline void abs_generic<float>(float const * src, size_t size, float * dst)
+{
+    for (size_t it = 0; it < size; ++it)
+    {
+        dst[it] = std::fabs(src[it]);
+    }
+}
+
+template <>
+inline void abs_generic<double>(double const * src, size_t size, double * dst)
+{
+    for (size_t it = 0; it < size; ++it)
+    {
+        dst[it] = std::fabs(src[it]);
+    }
+}
+
+/// Fold a lane array into the scalar result with the scalar comparison.
+template <typename T, size_t N, typename C>
+T fold_lanes(T const (&lanes)[N], T initial, C && comp) // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+{
+    for (size_t k = 0; k < N; ++k)
+    {
+        initial = comp(lanes[k], initial) ? lanes[k] : initial;
+    }
+    return initial;
+}
+
+struct Less
+{
+    template <typename T>
+    bool operator()(T const & lhs, T const & rhs) const { return lhs < rhs; }
+}; /* end struct Less */
+
+struct Greater
+{
+    template <typename T>
+    bool operator()(T const & lhs, T const & rhs) const { return lhs > rhs; }
+}; /* end struct Greater */
+
+#if defined(MODMESH_SIMD_X86)
+
+// The x86 min/max instructions return the second operand when either operand
+// is NaN.  Passing the accumulator as the second operand keeps the scalar
+// semantics.
+
+struct Avx2Double
+{
+    using value_type = double;
+    using vector_type = __m256d;
+    static constexpr size_t WIDTH = 4;
+    MODMESH_SIMD_TARGET_AVX2 static vector_type load(double const * p) { return _mm256_loadu_pd(p); }
+    MODMESH_SIMD_TARGET_AVX2 static void store(double * p, vector_type v) { _mm256_storeu_pd(p, v); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type set1(double v) { return _mm256_set1_pd(v); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type add(vector_type a, vector_type b) { return _mm256_add_pd(a, b); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type sub(vector_type a, vector_type b) { return _mm256_sub_pd(a, b); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type mul(vector_type a, vector_type b) { return _mm256_mul_pd(a, b); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type div(vector_type a, vector_type b) { return _mm256_div_pd(a, b); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type sqrt(vector_type a) { return _mm256_sqrt_pd(a); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type min(vector_type a, vector_type b) { return _mm256_min_pd(a, b); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type max(vector_type a, vector_type b) { return _mm256_max_pd(a, b); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type abs(vector_type a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+}; /* end struct Avx2Double */
+
+struct Avx2Float
+{
+    using value_type = float;
+    using vector_type = __m256;
+    static constexpr size_t WIDTH = 8;
+    MODMESH_SIMD_TARGET_AVX2 static vector_type load(float const * p) { return _mm256_loadu_ps(p); }
+    MODMESH_SIMD_TARGET_AVX2 static void store(float * p, vector_type v) { _mm256_storeu_ps(p, v); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type set1(float v) { return _mm256_set1_ps(v); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type add(vector_type a, vector_type b) { return _mm256_add_ps(a, b); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type sub(vector_type a, vector_type b) { return _mm256_sub_ps(a, b); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type mul(vector_type a, vector_type b) { return _mm256_mul_ps(a, b); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type div(vector_type a, vector_type b) { return _mm256_div_ps(a, b); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type sqrt(vector_type a) { return _mm256_sqrt_ps(a); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type min(vector_type a, vector_type b) { return _mm256_min_ps(a, b); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type max(vector_type a, vector_type b) { return _mm256_max_ps(a, b); }
+    MODMESH_SIMD_TARGET_AVX2 static vector_type abs(vector_type a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+}; /* end struct Avx2Float */
+
+// The masked forms of min/max avoid the uninitialized pass-through operand
+// which some GCC versions warn about in the unmasked intrinsics.
+struct Avx512Double
+{
+    using value_type = double;
+    using vector_type = __m512d;
+    static constexpr size_t WIDTH = 8;
+    MODMESH_SIMD_TARGET_AVX512 static vector_type load(double const * p) { return _mm512_loadu_pd(p); }
+    MODMESH_SIMD_TARGET_AVX512 static void store(double * p, vector_type v) { _mm512_storeu_pd(p, v); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type set1(double v) { return _mm512_set1_pd(v); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type add(vector_type a, vector_type b) { return _mm512_add_pd(a, b); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type sub(vector_type a, vector_type b) { return _mm512_sub_pd(a, b); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type mul(vector_type a, vector_type b) { return _mm512_mul_pd(a, b); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type div(vector_type a, vector_type b) { return _mm512_div_pd(a, b); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type sqrt(vector_type a) { return _mm512_mask_sqrt_pd(a, 0xff, a); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type min(vector_type a, vector_type b) { return _mm512_mask_min_pd(b, 0xff, a, b); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type max(vector_type a, vector_type b) { return _mm512_mask_max_pd(b, 0xff, a, b); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type abs(vector_type a) { return _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(a), _mm512_set1_epi64(0x7fffffffffffffff))); }
+}; /* end struct Avx512Double */
+
+struct Avx512Float
+{
+    using value_type = float;
+    using vector_type = __m512;
+    static constexpr size_t WIDTH = 16;
+    MODMESH_SIMD_TARGET_AVX512 static vector_type load(float const * p) { return _mm512_loadu_ps(p); }
+    MODMESH_SIMD_TARGET_AVX512 static void store(float * p, vector_type v) { _mm512_storeu_ps(p, v); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type set1(float v) { return _mm512_set1_ps(v); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type add(vector_type a, vector_type b) { return _mm512_add_ps(a, b); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type sub(vector_type a, vector_type b) { return _mm512_sub_ps(a, b); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type mul(vector_type a, vector_type b) { return _mm512_mul_ps(a, b); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type div(vector_type a, vector_type b) { return _mm512_div_ps(a, b); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type sqrt(vector_type a) { return _mm512_mask_sqrt_ps(a, 0xffff, a); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type min(vector_type a, vector_type b) { return _mm512_mask_min_ps(b, 0xffff, a, b); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type max(vector_type a, vector_type b) { return _mm512_mask_max_ps(b, 0xffff, a, b); }
+    MODMESH_SIMD_TARGET_AVX512 static vector_type abs(vector_type a) { return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a), _mm512_set1_epi32(0x7fffffff))); }
+}; /* end struct Avx512Float */
+
+// The kernel bodies are shared by the instruction sets through the macro
+// because the target attribute cannot be a template parameter.
+// clang-format off
+#define MM_DECL_SIMD_KERNELS(SUFFIX, TARGET)                                                                   \
+    template <typename V>                                                                                      \
+    TARGET typename V::value_type sum_##SUFFIX(typename V::value_type const * data, size_t size,               \
+                                               typename V::value_type initial)                                 \
+    {                                                                                                          \
+        using T = typename V::value_type;                                                                      \
+        constexpr size_t W = V::WIDTH;                                                                         \
+        size_t it = 0;                                                                                         \
+        if (size >= SERIAL_SUM_SIZE && size >= 4 * W)                                                          \
+        {                                                                                                      \
+            auto a0 = V::set1(0), a1 = V::set1(0), a2 = V::set1(0), a3 = V::set1(0);                           \
+            for (; it + 4 * W <= size; it += 4 * W)                                                            \
+            {                                                                                                  \
+                a0 = V::add(a0, V::load(data + it));                                                           \
+                a1 = V::add(a1, V::load(data + it + W));                                                       \
+                a2 = V::add(a2, V::load(data + it + 2 * W));                                                   \
+                a3 = V::add(a3, V::load(data + it + 3 * W));                                                   \
+            }                                                                                                  \
+            T lanes[W]; /* NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays) */                \
+            V::store(lanes, V::add(V::add(a0, a1), V::add(a2, a3)));                                           \
+            T acc = 0;                                                                                         \
+            for (size_t k = 0; k < W; ++k) { acc += lanes[k]; }                                                \
+            initial += acc;                                                                                    \
+        }                                                                                                      \
+        for (; it < size; ++it) { initial += data[it]; }                                                       \
+        return initial;                                                                                        \
+    }                                                                                                          \
+                                                                                                               \
+    template <typename V, bool IsMin>                                                                          \
+    TARGET typename V::value_type select_##SUFFIX(typename V::value_type const * data, size_t size,            \
+                                                  typename V::value_type initial)                              \
+    {                                                                                                          \
+        using T = typename V::value_type;                                                                      \
+        constexpr size_t W = V::WIDTH;                                                                         \
+        size_t it = 0;                                                                                         \
+        if (size >= 2 * W)                                                                                     \
+        {                                                                                                      \
+            auto a0 = V::set1(initial), a1 = V::set1(initial);                                                 \
+            for (; it + 2 * W <= size; it += 2 * W)                                                            \
+            {                                                                                                  \
+                if constexpr (IsMin)                                                                           \
+                {                                                                                              \
+                    a0 = V::min(V::load(data + it), a0);                                                       \
+                    a1 = V::min(V::load(data + it + W), a1);                                                   \
+                }                                                                                              \
+                else                                                                                           \
+                {                                                                                              \
+                    a0 = V::max(V::load(data + it), a0);                                                       \
+                    a1 = V::max(V::load(data + it + W), a1);                                                   \
+                }                                                                                              \
+            }                                                                                                  \
+            T lanes[2 * W]; /* NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays) */            \
+            V::store(lanes, a0);                                                                               \
+            V::store(lanes + W, a1);                                                                           \
+            initial = IsMin ? fold_lanes(lanes, initial, Less()) : fold_lanes(lanes, initial, Greater());     \
+        }                                                                                                      \
+        for (; it < size; ++it)                                                                                \
+        {                                                                                                      \
+            bool const take = IsMin ? (data[it] < initial) : (data[it] > initial);                             \
+            initial = take ? data[it] : initial;                                                               \
+        }                                                                                                      \
+        return initial;                                                                                        \
+    }                                                                                                          \
+                                                                                                               \
+    template <typename V>                                                                                      \
+    TARGET void abs_##SUFFIX(typename V::value_type const * src, size_t size, typename V::value_type * dst)    \
+    {                                                                                                          \
+        constexpr size_t W = V::WIDTH;                                                                         \
+        size_t it = 0;                                                                                         \
+        for (; it + W <= size; it += W) { V::store(dst + it, V::abs(V::load(src + it))); }                     \
+        for (; it < size; ++it) { dst[it] = std::fabs(src[it]); }                                              \
+    }
+// clang-format on
+
+MM_DECL_SIMD_KERNELS(avx2, MODMESH_SIMD_TARGET_AVX2)
+MM_DECL_SIMD_KERNELS(avx512, MODMESH_SIMD_TARGET_AVX512)
+
+#undef MM_DECL_SIMD_KERNELS
+
+template <typename T>
+using avx2_traits = std::conditional_t<std::is_same_v<T, double>, Avx2Double, Avx2Float>;
+template <typename T>
+using avx512_traits = std::conditional_t<std::is_same_v<T, double>, Avx512Double, Avx512Float>;
+
+#endif // MODMESH_SIMD_X86
+
+#if defined(MODMESH_SIMD_NEON)
+
+struct NeonDouble
+{
+    using value_type = double;
+    using vector_type = float64x2_t;
+    static constexpr size_t WIDTH = 2;
+    static vector_type load(double const * p) { return vld1q_f64(p); }
+    static void store(double * p, vector_type v) { vst1q_f64(p, v); }
+    static vector_type set1(double v) { return vdupq_n_f64(v); }
+    static vector_type add(vector_type a, vector_type b) { return vaddq_f64(a, b); }
+    static vector_type sub(vector_type a, vector_type b) { return vsubq_f64(a, b); }
+    static vector_type mul(vector_type a, vector_type b) { return vmulq_f64(a, b); }
+    static vector_type div(vector_type a, vector_type b) { return vdivq_f64(a, b); }
+    static vector_type sqrt(vector_type a) { return vsqrtq_f64(a); }
+    // Select with comparison masks to keep the NaN semantics of the scalar code.
+    static vector_type min(vector_type a, vector_type b) { return vbslq_f64(vcltq_f64(a, b), a, b); }
+    static vector_type max(vector_type a, vector_type b) { return vbslq_f64(vcgtq_f64(a, b), a, b); }
+    static vector_type abs(vector_type a) { return vabsq_f64(a); }
+}; /* end struct NeonDouble */
+
+struct NeonFloat
+{
+    using value_type = float;
+    using vector_type = float32x4_t;
+    static constexpr size_t WIDTH = 4;
+    static vector_type load(float const * p) { return vld1q_f32(p); }
+    static void store(float * p, vector_type v) { vst1q_f32(p, v); }
+    static vector_type set1(float v) { return vdupq_n_f32(v); }
+    static vector_type add(vector_type a, vector_type b) { return vaddq_f32(a, b); }
+    static vector_type sub(vector_type a, vector_type b) { return vsubq_f32(a, b); }
+    static vector_type mul(vector_type a, vector_type b) { return vmulq_f32(a, b); }
+    static vector_type div(vector_type a, vector_type b) { return vdivq_f32(a, b); }
+    static vector_type sqrt(vector_type a) { return vsqrtq_f32(a); }
+    static vector_type min(vector_type a, vector_type b) { return vbslq_f32(vcltq_f32(a, b), a, b); }
+    static vector_type max(vector_type a, vector_type b) { return vbslq_f32(vcgtq_f32(a, b), a, b); }
+    static vector_type abs(vector_type a) { return vabsq_f32(a); }
+}; /* end struct NeonFloat */
+
+template <typename V>
+typename V::value_type sum_neon(typename V::value_type const * data, size_t size, typename V::value_type initial)
+{
+    using T = typename V::value_type;
+    constexpr size_t W = V::WIDTH;
+    size_t it = 0;
+    if (size >= SERIAL_SUM_SIZE && size >= 4 * W)
+    {
+        auto a0 = V::set1(0), a1 = V::set1(0), a2 = V::set1(0), a3 = V::set1(0);
+        for (; it + 4 * W <= size; it += 4 * W)
+        {
+            a0 = V::add(a0, V::load(data + it));
+            a1 = V::add(a1, V::load(data + it + W));
+            a2 = V::add(a2, V::load(data + it + 2 * W));
+            a3 = V::add(a3, V::load(data + it + 3 * W));
+        }
+        T lanes[W]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+        V::store(lanes, V::add(V::add(a0, a1), V::add(a2, a3)));
+        T acc = 0;
+        for (size_t k = 0; k < W; ++k)
+        {
+            acc += lanes[k];
+        }
+        initial += acc;
+    }
+    for (; it < size; ++it)
+    {
+        initial += data[it];
+    }
+    return initial;
+}
+
+template <typename V, bool IsMin>
+typename V::value_type select_neon(typename V::value_type const * data, size_t size, typename V::value_type initial)
+{
+    using T = typename V::value_type;
+    constexpr size_t W = V::WIDTH;
+    size_t it = 0;
+    if (size >= 2 * W)
+    {
+        auto a0 = V::set1(initial);
+        auto a1 = V::set1(initial);
+        for (; it + 2 * W <= size; it += 2 * W)
+        {
+            a0 = IsMin ? V::min(V::load(data + it), a0) : V::max(V::load(data + it), a0);
+            a1 = IsMin ? V::min(V::load(data + it + W), a1) : V::max(V::load(data + it + W), a1);
+        }
+        T lanes[2 * W]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+        V::store(lanes, a0);
+        V::store(lanes + W, a1);
+        initial = IsMin ? fold_lanes(lanes, initial, Less()) : fold_lanes(lanes, initial, Greater());
+    }
+    for (; it < size; ++it)
+    {
+        bool const take = IsMin ? (data[it] < initial) : (data[it] > initial);
+        initial = take ? data[it] : initial;
+    }
+    return initial;
+}
+
+template <typename V>
+void abs_neon(typename V::value_type const * src, size_t size, typename V::value_type * dst)
+{
+    constexpr size_t W = V::WIDTH;
+    size_t it = 0;
+    for (; it + W <= size; it += W)
+    {
+        V::store(dst + it, V::abs(V::load(src + it)));
+    }
+    for (; it < size; ++it)
+    {
+        dst[it] = std::fabs(src[it]);
+    }
+}
+
+template <typename T>
+using neon_traits = std::conditional_t<std::is_same_v<T, double>, NeonDouble, NeonFloat>;
+
+#endif // MODMESH_SIMD_NEON
+
+template <typename T>
+inline constexpr bool is_simd_float_v = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+} /* end namespace detail */
+
+template <typename T>
+T sum(T const * data, size_t size, T initial)
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        for (size_t it = 0; it < size && !initial; ++it)
+        {
+            initial |= data[it];
+        }
+        return initial;
+    }
+    else
+    {
+        if constexpr (detail::is_simd_float_v<T>)
+        {
+#if defined(MODMESH_SIMD_X86)
+            switch (level())
+            {
+            case SimdLevel::AVX512: return detail::sum_avx512<detail::avx512_traits<T>>(data, size, initial);
+            case SimdLevel::AVX2: return detail::sum_avx2<detail::avx2_traits<T>>(data, size, initial);
+            default: break;
+            }
+#elif defined(MODMESH_SIMD_NEON)
+            if (SimdLevel::NEON == level())
+            {
+                return detail::sum_neon<detail::neon_traits<T>>(data, size, initial);
+            }
+#endif
+        }
+        return detail::sum_generic(data, size, initial);
+    }
+}
+
+template <typename T, bool IsMin>
+T select(T const * data, size_t size, T initial)
+{
+    if constexpr (detail::is_simd_float_v<T>)
+    {
+#if defined(MODMESH_SIMD_X86)
+        switch (level())
+        {
+        case SimdLevel::AVX512: return detail::select_avx512<detail::avx512_traits<T>, IsMin>(data, size, initial);
+        case SimdLevel::AVX2: return detail::select_avx2<detail::avx2_traits<T>, IsMin>(data, size, initial);
+        default: break;
+        }
+#elif defined(MODMESH_SIMD_NEON)
+        if (SimdLevel::NEON == level())
+        {
+            return detail::select_neon<detail::neon_traits<T>, IsMin>(data, size, initial);
+        }
+#endif
+    }
+    if constexpr (IsMin)
+    {
+        return detail::select_generic(data, size, initial, detail::Less());
+    }
+    else
+    {
+        return detail::select_generic(data, size, initial, detail::Greater());
+    }
+}
+
+template <typename T>
+T min(T const * data, size_t size, T initial) { return select<T, true>(data, size, initial); }
+
+template <typename T>
+T max(T const * data, size_t size, T initial) { return select<T, false>(data, size, initial); }
+
+/// Write the absolute values of src to dst.  The two ranges may be the same.
+template <typename T>
+void abs(T const * src, size_t size, T * dst)
+{
+    if constexpr (std::is_same_v<T, bool> || std::is_unsigned_v<T>)
+    {
+        if (src != dst)
+        {
+            std::copy_n(src, size, dst);
+        }
+    }
+    else
+    {
+        if constexpr (detail::is_simd_float_v<T>)
+        {
+#if defined(MODMESH_SIMD_X86)
+            switch (level())
+            {
+            case SimdLevel::AVX512: detail::abs_avx512<detail::avx512_traits<T>>(src, size, dst); return;
+            case SimdLevel::AVX2: detail::abs_avx2<detail::avx2_traits<T>>(src, size, dst); return;
+            default: break;
+            }
+#elif defined(MODMESH_SIMD_NEON)
+            if (SimdLevel::NEON == level())
+            {
+                detail::abs_neon<detail::neon_traits<T>>(src, size, dst);
+                return;
+            }
+#endif
+        }
+        detail::abs_generic(src, size, dst);
+    }
+}
+
+} /* end namespace simd */
+
+} /* end namespace modmesh */
+
+/* vim: set et ts=4 sw=4: */
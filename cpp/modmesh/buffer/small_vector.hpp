@@ -32,10 +32,26 @@
 #include <array>
 #include <vector>
 #include <algorithm>
+#include <type_traits>
+
+/*
+ * Number of dimensions whose extents and strides an array keeps without heap
+ * allocation.  Arrays of a rank up to it do not allocate for the shape in
+ * construction, copy, indexing and broadcasting.
+ */
+#ifndef MODMESH_SHAPE_INLINE_CAPACITY
+#define MODMESH_SHAPE_INLINE_CAPACITY 6
+#endif
 
 namespace modmesh
 {
 
+/**
+ * Vector storing up to N elements inline without heap allocation.  The
+ * inline capacity N is chosen per use, e.g., the shape of SimpleArray keeps
+ * MODMESH_SHAPE_INLINE_CAPACITY extents inline.  Vectors of different inline
+ * capacities convert to each other and compare equal by their elements.
+ */
 template <typename T, size_t N = 3>
 class small_vector
 {
@@ -46,6 +62,8 @@ public:
     using iterator = T *;
     using const_iterator = T const *;
 
+    static constexpr size_t inline_capacity = N;
+
     explicit small_vector(size_t size)
         : m_size(static_cast<unsigned int>(size))
     {
@@ -89,6 +107,13 @@ public:
 
     small_vector() { m_head = m_data.data(); }
 
+    template <size_t M, typename std::enable_if_t<M != N, int> = 0>
+    // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions)
+    small_vector(small_vector<T, M> const & other)
+        : small_vector(other.begin(), other.end())
+    {
+    }
+
     small_vector(small_vector const & other)
         : m_size(other.m_size)
     {
@@ -117,7 +142,7 @@ public:
         }
         else
         {
-            m_capacity = m_size;
+            m_capacity = other.m_capacity;
             m_head = other.m_head;
             other.m_size = 0;
             other.m_capacity = N;
@@ -176,6 +201,10 @@ public:
             }
             else
             {
+                if (m_head != m_data.data())
+                {
+                    delete[] m_head;
+                }
                 m_size = other.m_size;
                 m_capacity = other.m_capacity;
                 m_head = other.m_head;
@@ -287,10 +316,16 @@ private:
 
 }; /* end class small_vector */
 
-template <typename T>
-bool operator==(small_vector<T> const & lhs, small_vector<T> const & rhs)
+template <typename T, size_t N, size_t M>
+bool operator==(small_vector<T, N> const & lhs, small_vector<T, M> const & rhs)
+{
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename T, size_t N, size_t M>
+bool operator!=(small_vector<T, N> const & lhs, small_vector<T, M> const & rhs)
 {
-    return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    return !(lhs == rhs);
 }
 
 static_assert(sizeof(small_vector<size_t>) == 40, "small_vector<size_t> should use 40 bytes");
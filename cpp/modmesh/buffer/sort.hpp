@@ -0,0 +1,386 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * Parallel sorting kernels on contiguous ranges.
+ *
+ * Integers are sorted by LSD radix sort on bytes.  Each pass builds the
+ * histograms of the ThreadPool chunks in parallel, takes the prefix sums in
+ * chunk order and scatters the chunks in parallel, so the sort is stable and
+ * the result does not depend on the thread count.  A pass is skipped when all
+ * the keys have the same byte.
+ *
+ * Floating-point values (and bool) are sorted by merge sort.  The chunks are
+ * sorted in parallel with std::stable_sort and merged pairwise; every merge
+ * is split at the chunk boundaries of the output with a binary search (merge
+ * path), so the last rounds keep all the threads busy.  NaN is ordered after
+ * all the other values like numpy.
+ */
+
+#include <modmesh/base.hpp>
+#include <modmesh/buffer/ThreadPool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+/// The order of sort(): NaN is greater than everything else.
+template <typename T>
+struct SortLess
+{
+    bool operator()(T const & lhs, T const & rhs) const
+    {
+        if constexpr (std::numeric_limits<T>::has_quiet_NaN)
+        {
+            using std::isnan; // Float16 and BFloat16 provide isnan() for ADL.
+            return lhs < rhs || (isnan(rhs) && !isnan(lhs));
+        }
+        else
+        {
+            return lhs < rhs;
+        }
+    }
+}; /* end struct SortLess */
+
+template <typename T>
+inline constexpr bool use_radix_sort_v = std::is_integral_v<T> && !std::is_same_v<T, bool>;
+
+/// Map an integer to the unsigned key of the same order.
+template <typename T>
+std::make_unsigned_t<T> to_radix_key(T value)
+{
+    using key_type = std::make_unsigned_t<T>;
+    auto ret = static_cast<key_type>(value);
+    if constexpr (std::is_signed_v<T>)
+    {
+        ret ^= key_type(1) << (8 * sizeof(T) - 1);
+    }
+    return ret;
+}
+
+template <typename T>
+T from_radix_key(std::make_unsigned_t<T> key)
+{
+    if constexpr (std::is_signed_v<T>)
+    {
+        key ^= std::make_unsigned_t<T>(1) << (8 * sizeof(T) - 1);
+    }
+    return static_cast<T>(key);
+}
+
+/**
+ * Stable LSD radix sort of the unsigned keys, carrying the values along if
+ * vals is not null.  The buffers ktmp and vtmp hold n elements.
+ */
+template <typename K, typename V>
+void radix_sort_pairs(K * keys, V * vals, size_t n, K * ktmp, V * vtmp, bool parallel)
+{
+    static_assert(std::is_unsigned_v<K>);
+    constexpr size_t NBUCKET = 256;
+    size_t const nchunk = chunk_count(n);
+    std::vector<std::array<size_t, NBUCKET>> offsets(nchunk);
+
+    K * ksrc = keys;
+    K * kdst = ktmp;
+    V * vsrc = vals;
+    V * vdst = vtmp;
+    for (size_t shift = 0; shift < 8 * sizeof(K); shift += 8)
+    {
+        parallel_for_chunks(
+            n,
+            parallel,
+            [&](size_t begin, size_t end)
+            {
+                std::array<size_t, NBUCKET> & hist = offsets[begin / ThreadPool::CHUNK_SIZE];
+                hist.fill(0);
+                for (size_t it = begin; it < end; ++it)
+                {
+                    ++hist[(ksrc[it] >> shift) & 0xff];
+                }
+            });
+
+        // Turn the histograms into the output positions of each chunk and bucket.
+        size_t running = 0;
+        bool trivial = false;
+        for (size_t ibucket = 0; ibucket < NBUCKET; ++ibucket)
+        {
+            size_t total = 0;
+            for (size_t ichunk = 0; ichunk < nchunk; ++ichunk)
+            {
+                size_t const count = offsets[ichunk][ibucket];
+                offsets[ichunk][ibucket] = running + total;
+                total += count;
+            }
+            trivial = trivial || total == n;
+            running += total;
+        }
+        if (trivial)
+        {
+            continue;
+        }
+
+        parallel_for_chunks(
+            n,
+            parallel,
+            [&](size_t begin, size_t end)
+            {
+                std::array<size_t, NBUCKET> & pos = offsets[begin / ThreadPool::CHUNK_SIZE];
+                for (size_t it = begin; it < end; ++it)
+                {
+                    size_t const dst = pos[(ksrc[it] >> shift) & 0xff]++;
+                    kdst[dst] = ksrc[it];
+                    if (nullptr != vals)
+                    {
+                        vdst[dst] = vsrc[it];
+                    }
+                }
+            });
+        std::swap(ksrc, kdst);
+        std::swap(vsrc, vdst);
+    }
+    if (ksrc != keys)
+    {
+        std::copy_n(ksrc, n, keys);
+        if (nullptr != vals)
+        {
+            std::copy_n(vsrc, n, vals);
+        }
+    }
+}
+
+/**
+ * Number of elements of a to take in the first p elements of the stable
+ * merge of a[0:na] and b[0:nb].
+ */
+template <typename T, typename L>
+size_t merge_path(T const * a, size_t na, T const * b, size_t nb, size_t p, L const & less)
+{
+    size_t lo = p > nb ? p - nb : 0;
+    size_t hi = std::min(p, na);
+    while (lo < hi)
+    {
+        size_t const ia = (lo + hi) / 2;
+        size_t const ib = p - ia;
+        // The element a[ia] goes before b[ib - 1] if they tie, so more of a is needed.
+        if (ib > 0 && !less(b[ib - 1], a[ia]))
+        {
+            lo = ia + 1;
+        }
+        else
+        {
+            hi = ia;
+        }
+    }
+    return lo;
+}
+
+/// Stable parallel merge sort.  The buffer tmp holds n elements.
+template <typename T, typename L>
+void merge_sort(T * data, size_t n, T * tmp, L const & less, bool parallel)
+{
+    constexpr size_t CHUNK = ThreadPool::CHUNK_SIZE;
+    parallel_for_chunks(
+        n,
+        parallel,
+        [data, &less](size_t begin, size_t end)
+        { std::stable_sort(data + begin, data + end, less); });
+
+    T * src = data;
+    T * dst = tmp;
+    for (size_t width = CHUNK; width < n; width *= 2)
+    {
+        // Each task writes one chunk of the output of a pair of runs.
+        size_t const ntask = chunk_count(n);
+        auto body = [&](size_t itask)
+        {
+            size_t const out_begin = itask * CHUNK;
+            size_t const out_end = std::min(out_begin + CHUNK, n);
+            size_t const lo = out_begin / (2 * width) * (2 * width);
+            size_t const mid = std::min(lo + width, n);
+            size_t const hi = std::min(lo + 2 * width, n);
+            T const * a = src + lo;
+            T const * b = src + mid;
+            size_t const na = mid - lo;
+            size_t const nb = hi - mid;
+            size_t const ia0 = merge_path(a, na, b, nb, out_begin - lo, less);
+            size_t const ia1 = merge_path(a, na, b, nb, out_end - lo, less);
+            std::merge(a + ia0, a + ia1, b + (out_begin - lo - ia0), b + (out_end - lo - ia1), dst + out_begin, less);
+        };
+        if (parallel && ntask > 1)
+        {
+            ThreadPool::instance().run(ntask, body);
+        }
+        else
+        {
+            for (size_t itask = 0; itask < ntask; ++itask)
+            {
+                body(itask);
+            }
+        }
+        std::swap(src, dst);
+    }
+    if (src != data)
+    {
+        std::copy_n(src, n, data);
+    }
+}
+
+} /* end namespace detail */
+
+/// Sort data[0:n] in ascending order.
+template <typename T>
+void parallel_sort(T * data, size_t n, bool parallel)
+{
+    if (n < 2)
+    {
+        return;
+    }
+    if constexpr (detail::use_radix_sort_v<T>)
+    {
+        using key_type = std::make_unsigned_t<T>;
+        std::vector<key_type> keys(n);
+        std::vector<key_type> ktmp(n);
+        parallel_for_chunks(
+            n,
+            parallel,
+            [&](size_t begin, size_t end)
+            { std::transform(data + begin, data + end, keys.data() + begin, detail::to_radix_key<T>); });
+        detail::radix_sort_pairs<key_type, size_t>(keys.data(), nullptr, n, ktmp.data(), nullptr, parallel);
+        parallel_for_chunks(
+            n,
+            parallel,
+            [&](size_t begin, size_t end)
+            { std::transform(keys.data() + begin, keys.data() + end, data + begin, detail::from_radix_key<T>); });
+    }
+    else
+    {
+        // Not std::vector for the lack of vector<bool>::data().
+        // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+        std::unique_ptr<T[]> tmp(new T[n]);
+        detail::merge_sort(data, n, tmp.get(), detail::SortLess<T>(), parallel);
+    }
+}
+
+/// Write to index[0:n] the positions that sort data[0:n] stably.
+template <typename T, typename I>
+void parallel_argsort(T const * data, size_t n, I * index, bool parallel)
+{
+    parallel_for_chunks(
+        n,
+        parallel,
+        [index](size_t begin, size_t end)
+        {
+            for (size_t it = begin; it < end; ++it)
+            {
+                index[it] = static_cast<I>(it);
+            }
+        });
+    if (n < 2)
+    {
+        return;
+    }
+    std::vector<I> itmp(n);
+    if constexpr (detail::use_radix_sort_v<T>)
+    {
+        using key_type = std::make_unsigned_t<T>;
+        std::vector<key_type> keys(n);
+        std::vector<key_type> ktmp(n);
+        parallel_for_chunks(
+            n,
+            parallel,
+            [&](size_t begin, size_t end)
+            { std::transform(data + begin, data + end, keys.data() + begin, detail::to_radix_key<T>); });
+        detail::radix_sort_pairs(keys.data(), index, n, ktmp.data(), itmp.data(), parallel);
+    }
+    else
+    {
+        detail::SortLess<T> const less;
+        detail::merge_sort(
+            index,
+            n,
+            itmp.data(),
+            [data, &less](I lhs, I rhs)
+            { return less(data[lhs], data[rhs]); },
+            parallel);
+    }
+}
+
+/**
+ * Write to index[0:nvalue] the positions in the sorted sorted[0:n] where
+ * values[0:nvalue] would be inserted to keep the order, the first such
+ * position if right is false and the last if true.
+ */
+template <typename T, typename I>
+void parallel_searchsorted(T const * sorted, size_t n, T const * values, size_t nvalue, I * index, bool right, bool parallel)
+{
+    detail::SortLess<T> const less;
+    parallel_for_chunks(
+        nvalue,
+        parallel,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t it = begin; it < end; ++it)
+            {
+                T const * pos = right ? std::upper_bound(sorted, sorted + n, values[it], less)
+                                      : std::lower_bound(sorted, sorted + n, values[it], less);
+                index[it] = static_cast<I>(pos - sorted);
+            }
+        });
+}
+
+/// Sort data[0:n] and remove the duplicates.  Return the number of unique values.
+template <typename T>
+size_t parallel_sort_unique(T * data, size_t n, bool parallel)
+{
+    parallel_sort(data, n, parallel);
+    // NaN does not compare equal to itself but is collapsed like numpy.unique.
+    return static_cast<size_t>(std::unique(
+                                   data,
+                                   data + n,
+                                   [](T const & lhs, T const & rhs)
+                                   {
+                                       detail::SortLess<T> const less;
+                                       return !less(lhs, rhs) && !less(rhs, lhs);
+                                   })
+                               - data);
+}
+
+} /* end namespace modmesh */
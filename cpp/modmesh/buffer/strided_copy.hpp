@@ -0,0 +1,190 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Iterative copy between strided multi-dimensional ranges.
+ *
+ * Dimensions of extent 1 are dropped and adjacent dimensions that are
+ * contiguous with each other are merged before the copy, so that the inner
+ * loop runs over the longest possible stretch.  A contiguous inner stretch of
+ * the same element type is copied with memcpy, a contiguous stretch of a
+ * different type with a plain conversion loop that the compiler vectorizes,
+ * and anything else with a strided loop.  A transposed matrix of the same
+ * element type is handed to the blocked transpose of transpose.hpp.
+ */
+
+#include <modmesh/base.hpp>
+#include <modmesh/buffer/small_vector.hpp>
+#include <modmesh/buffer/transpose.hpp>
+
+#include <cstring>
+#include <type_traits>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+struct StridedDimension
+{
+    size_t extent;
+    ssize_t src_stride;
+    ssize_t dst_stride;
+}; /* end struct StridedDimension */
+
+/// Drop unit dimensions and merge contiguous neighbors.  The result is ordered from outer to inner.
+inline small_vector<StridedDimension, MODMESH_SHAPE_INLINE_CAPACITY> coalesce_dimensions(
+    size_t ndim, size_t const * shape, ssize_t const * src_strides, ssize_t const * dst_strides)
+{
+    small_vector<StridedDimension, MODMESH_SHAPE_INLINE_CAPACITY> dims;
+    for (size_t it = 0; it < ndim; ++it)
+    {
+        if (1 == shape[it])
+        {
+            continue;
+        }
+        if (!dims.empty())
+        {
+            StridedDimension & last = dims[dims.size() - 1];
+            auto const extent = static_cast<ssize_t>(shape[it]);
+            if (last.src_stride == src_strides[it] * extent && last.dst_stride == dst_strides[it] * extent)
+            {
+                last.extent *= shape[it];
+                last.src_stride = src_strides[it];
+                last.dst_stride = dst_strides[it];
+                continue;
+            }
+        }
+        dims.push_back(StridedDimension{shape[it], src_strides[it], dst_strides[it]});
+    }
+    return dims;
+}
+
+template <typename S, typename D>
+void copy_stretch(S const * src, ssize_t src_stride, D * dst, ssize_t dst_stride, size_t extent)
+{
+    if (1 == src_stride && 1 == dst_stride)
+    {
+        if constexpr (std::is_same_v<S, D>)
+        {
+            std::memcpy(dst, src, extent * sizeof(D));
+        }
+        else
+        {
+            for (size_t it = 0; it < extent; ++it)
+            {
+                dst[it] = static_cast<D>(src[it]); // NOLINT(bugprone-signed-char-misuse,cert-str34-c)
+            }
+        }
+    }
+    else
+    {
+        for (size_t it = 0; it < extent; ++it)
+        {
+            // NOLINTNEXTLINE(bugprone-signed-char-misuse,cert-str34-c)
+            dst[static_cast<ssize_t>(it) * dst_stride] = static_cast<D>(src[static_cast<ssize_t>(it) * src_stride]);
+        }
+    }
+}
+
+} /* end namespace detail */
+
+/**
+ * Copy the elements of src into dst over the index space of shape.  The
+ * strides are counted in elements and may be negative.  src and dst must not
+ * overlap.
+ */
+template <typename S, typename D>
+void strided_copy(
+    S const * src, ssize_t const * src_strides, D * dst, ssize_t const * dst_strides, size_t const * shape, size_t ndim)
+{
+    for (size_t it = 0; it < ndim; ++it)
+    {
+        if (0 == shape[it])
+        {
+            return;
+        }
+    }
+
+    small_vector<detail::StridedDimension, MODMESH_SHAPE_INLINE_CAPACITY> const dims = detail::coalesce_dimensions(ndim, shape, src_strides, dst_strides);
+    if (dims.empty())
+    {
+        *dst = static_cast<D>(*src); // NOLINT(bugprone-signed-char-misuse,cert-str34-c)
+        return;
+    }
+
+    if constexpr (std::is_same_v<S, D>)
+    {
+        // A transposed matrix takes the cache-blocked kernel.
+        if (2 == dims.size() && 1 == dims[0].src_stride && 1 == dims[1].dst_stride && dims[1].src_stride > 0 && dims[0].dst_stride > 0)
+        {
+            detail::transpose_recursive(
+                src, static_cast<size_t>(dims[1].src_stride), dst, static_cast<size_t>(dims[0].dst_stride), dims[1].extent, dims[0].extent);
+            return;
+        }
+    }
+
+    size_t const nouter = dims.size() - 1;
+    detail::StridedDimension const & inner = dims[nouter];
+    small_vector<size_t, MODMESH_SHAPE_INLINE_CAPACITY> counter(nouter, 0);
+    while (true)
+    {
+        detail::copy_stretch(src, inner.src_stride, dst, inner.dst_stride, inner.extent);
+
+        // Advance the odometer of the outer dimensions.
+        size_t dim = nouter;
+        while (dim > 0)
+        {
+            --dim;
+            src += dims[dim].src_stride;
+            dst += dims[dim].dst_stride;
+            if (++counter[dim] < dims[dim].extent)
+            {
+                break;
+            }
+            src -= dims[dim].src_stride * static_cast<ssize_t>(dims[dim].extent);
+            dst -= dims[dim].dst_stride * static_cast<ssize_t>(dims[dim].extent);
+            counter[dim] = 0;
+            if (0 == dim)
+            {
+                return;
+            }
+        }
+        if (0 == nouter)
+        {
+            return;
+        }
+    }
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
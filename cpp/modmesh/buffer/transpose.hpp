@@ -0,0 +1,442 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Layout conversion between the [n, k] (array of structures, AoS) and the
+ * [k, n] (structure of arrays, SoA) forms of contiguous data.
+ *
+ * transpose() divides the matrix recursively along the longer side until a
+ * tile fits in the L1 cache, so that no cache size is tuned for, and the
+ * tiles of 4- and 8-byte elements are transposed in registers by blocks of
+ * AVX2 or NEON vectors.  A small k (up to SMALL_K) takes the dedicated
+ * interleave()/deinterleave() loops instead, which are unrolled over k and
+ * read or write the [n, k] side with unit stride.  With parallel, the tasks
+ * take independent blocks of rows or columns of the thread pool chunk size,
+ * so the output is the same as in serial.
+ */
+
+#include <modmesh/base.hpp>
+#include <modmesh/buffer/ThreadPool.hpp>
+#include <modmesh/buffer/simd.hpp>
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+struct TransposeConstants
+{
+    // The edge of a base tile of the recursive transpose.
+    static constexpr size_t TILE = 32;
+    // The largest k of the unrolled interleave and deinterleave.
+    static constexpr size_t SMALL_K = 4;
+    // The rows of a block of the generic deinterleave.
+    static constexpr size_t DEINTERLEAVE_BLOCK = 64;
+}; /* end struct TransposeConstants */
+
+template <typename T>
+void transpose_tile_generic(T const * src, size_t lds, T * dst, size_t ldd, size_t nrow, size_t ncol)
+{
+    for (size_t irow = 0; irow < nrow; ++irow)
+    {
+        for (size_t icol = 0; icol < ncol; ++icol)
+        {
+            dst[icol * ldd + irow] = src[irow * lds + icol];
+        }
+    }
+}
+
+#if defined(MODMESH_SIMD_X86)
+
+MODMESH_SIMD_TARGET_AVX2 inline void transpose_block_avx2(double const * src, size_t lds, double * dst, size_t ldd)
+{
+    __m256d const r0 = _mm256_loadu_pd(src);
+    __m256d const r1 = _mm256_loadu_pd(src + lds);
+    __m256d const r2 = _mm256_loadu_pd(src + 2 * lds);
+    __m256d const r3 = _mm256_loadu_pd(src + 3 * lds);
+    __m256d const t0 = _mm256_unpacklo_pd(r0, r1);
+    __m256d const t1 = _mm256_unpackhi_pd(r0, r1);
+    __m256d const t2 = _mm256_unpacklo_pd(r2, r3);
+    __m256d const t3 = _mm256_unpackhi_pd(r2, r3);
+    _mm256_storeu_pd(dst, _mm256_permute2f128_pd(t0, t2, 0x20));
+    _mm256_storeu_pd(dst + ldd, _mm256_permute2f128_pd(t1, t3, 0x20));
+    _mm256_storeu_pd(dst + 2 * ldd, _mm256_permute2f128_pd(t0, t2, 0x31));
+    _mm256_storeu_pd(dst + 3 * ldd, _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+MODMESH_SIMD_TARGET_AVX2 inline void transpose_block_avx2(float const * src, size_t lds, float * dst, size_t ldd)
+{
+    __m256 const r0 = _mm256_loadu_ps(src);
+    __m256 const r1 = _mm256_loadu_ps(src + lds);
+    __m256 const r2 = _mm256_loadu_ps(src + 2 * lds);
+    __m256 const r3 = _mm256_loadu_ps(src + 3 * lds);
+    __m256 const r4 = _mm256_loadu_ps(src + 4 * lds);
+    __m256 const r5 = _mm256_loadu_ps(src + 5 * lds);
+    __m256 const r6 = _mm256_loadu_ps(src + 6 * lds);
+    __m256 const r7 = _mm256_loadu_ps(src + 7 * lds);
+    __m256 const t0 = _mm256_unpacklo_ps(r0, r1);
+    __m256 const t1 = _mm256_unpackhi_ps(r0, r1);
+    __m256 const t2 = _mm256_unpacklo_ps(r2, r3);
+    __m256 const t3 = _mm256_unpackhi_ps(r2, r3);
+    __m256 const t4 = _mm256_unpacklo_ps(r4, r5);
+    __m256 const t5 = _mm256_unpackhi_ps(r4, r5);
+    __m256 const t6 = _mm256_unpacklo_ps(r6, r7);
+    __m256 const t7 = _mm256_unpackhi_ps(r6, r7);
+    __m256 const u0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 const u1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 const u2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 const u3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 const u4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 const u5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 const u6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 const u7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+    _mm256_storeu_ps(dst, _mm256_permute2f128_ps(u0, u4, 0x20));
+    _mm256_storeu_ps(dst + ldd, _mm256_permute2f128_ps(u1, u5, 0x20));
+    _mm256_storeu_ps(dst + 2 * ldd, _mm256_permute2f128_ps(u2, u6, 0x20));
+    _mm256_storeu_ps(dst + 3 * ldd, _mm256_permute2f128_ps(u3, u7, 0x20));
+    _mm256_storeu_ps(dst + 4 * ldd, _mm256_permute2f128_ps(u0, u4, 0x31));
+    _mm256_storeu_ps(dst + 5 * ldd, _mm256_permute2f128_ps(u1, u5, 0x31));
+    _mm256_storeu_ps(dst + 6 * ldd, _mm256_permute2f128_ps(u2, u6, 0x31));
+    _mm256_storeu_ps(dst + 7 * ldd, _mm256_permute2f128_ps(u3, u7, 0x31));
+}
+
+template <typename V>
+MODMESH_SIMD_TARGET_AVX2 void transpose_tile_avx2(V const * src, size_t lds, V * dst, size_t ldd, size_t nrow, size_t ncol)
+{
+    constexpr size_t W = 32 / sizeof(V);
+    size_t const nrow_block = nrow - nrow % W;
+    size_t const ncol_block = ncol - ncol % W;
+    for (size_t irow = 0; irow < nrow_block; irow += W)
+    {
+        for (size_t icol = 0; icol < ncol_block; icol += W)
+        {
+            transpose_block_avx2(src + irow * lds + icol, lds, dst + icol * ldd + irow, ldd);
+        }
+    }
+    // The remaining right columns and bottom rows.
+    transpose_tile_generic(src + ncol_block, lds, dst + ncol_block * ldd, ldd, nrow_block, ncol - ncol_block);
+    transpose_tile_generic(src + nrow_block * lds, lds, dst + nrow_block, ldd, nrow - nrow_block, ncol);
+}
+
+#elif defined(MODMESH_SIMD_NEON)
+
+inline void transpose_block_neon(double const * src, size_t lds, double * dst, size_t ldd)
+{
+    float64x2_t const r0 = vld1q_f64(src);
+    float64x2_t const r1 = vld1q_f64(src + lds);
+    vst1q_f64(dst, vtrn1q_f64(r0, r1));
+    vst1q_f64(dst + ldd, vtrn2q_f64(r0, r1));
+}
+
+inline void transpose_block_neon(float const * src, size_t lds, float * dst, size_t ldd)
+{
+    float32x4_t const r0 = vld1q_f32(src);
+    float32x4_t const r1 = vld1q_f32(src + lds);
+    float32x4_t const r2 = vld1q_f32(src + 2 * lds);
+    float32x4_t const r3 = vld1q_f32(src + 3 * lds);
+    float64x2_t const t0 = vreinterpretq_f64_f32(vtrn1q_f32(r0, r1));
+    float64x2_t const t1 = vreinterpretq_f64_f32(vtrn2q_f32(r0, r1));
+    float64x2_t const t2 = vreinterpretq_f64_f32(vtrn1q_f32(r2, r3));
+    float64x2_t const t3 = vreinterpretq_f64_f32(vtrn2q_f32(r2, r3));
+    vst1q_f32(dst, vreinterpretq_f32_f64(vtrn1q_f64(t0, t2)));
+    vst1q_f32(dst + ldd, vreinterpretq_f32_f64(vtrn1q_f64(t1, t3)));
+    vst1q_f32(dst + 2 * ldd, vreinterpretq_f32_f64(vtrn2q_f64(t0, t2)));
+    vst1q_f32(dst + 3 * ldd, vreinterpretq_f32_f64(vtrn2q_f64(t1, t3)));
+}
+
+template <typename V>
+void transpose_tile_neon(V const * src, size_t lds, V * dst, size_t ldd, size_t nrow, size_t ncol)
+{
+    constexpr size_t W = 16 / sizeof(V);
+    size_t const nrow_block = nrow - nrow % W;
+    size_t const ncol_block = ncol - ncol % W;
+    for (size_t irow = 0; irow < nrow_block; irow += W)
+    {
+        for (size_t icol = 0; icol < ncol_block; icol += W)
+        {
+            transpose_block_neon(src + irow * lds + icol, lds, dst + icol * ldd + irow, ldd);
+        }
+    }
+    transpose_tile_generic(src + ncol_block, lds, dst + ncol_block * ldd, ldd, nrow_block, ncol - ncol_block);
+    transpose_tile_generic(src + nrow_block * lds, lds, dst + nrow_block, ldd, nrow - nrow_block, ncol);
+}
+
+#endif // MODMESH_SIMD_X86, MODMESH_SIMD_NEON
+
+/// The vector element of the same size as the arithmetic T, or void.
+template <typename T>
+using transpose_vector_t = std::conditional_t<
+    std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && sizeof(T) == sizeof(double),
+    double,
+    std::conditional_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && sizeof(T) == sizeof(float), float, void>>;
+
+template <typename T>
+void transpose_tile(T const * src, size_t lds, T * dst, size_t ldd, size_t nrow, size_t ncol)
+{
+    // Moving the bits does not depend on the element type, so the vectors of
+    // floating-point are used for the integers of the same size.
+    using V = transpose_vector_t<T>;
+    if constexpr (!std::is_void_v<V>)
+    {
+#if defined(MODMESH_SIMD_X86)
+        if (simd::level() >= simd::SimdLevel::AVX2)
+        {
+            transpose_tile_avx2(reinterpret_cast<V const *>(src), lds, reinterpret_cast<V *>(dst), ldd, nrow, ncol);
+            return;
+        }
+#elif defined(MODMESH_SIMD_NEON)
+        if (simd::SimdLevel::NEON == simd::level())
+        {
+            transpose_tile_neon(reinterpret_cast<V const *>(src), lds, reinterpret_cast<V *>(dst), ldd, nrow, ncol);
+            return;
+        }
+#endif
+    }
+    transpose_tile_generic(src, lds, dst, ldd, nrow, ncol);
+}
+
+/// Split the longer side at a multiple of the tile until a tile is left.
+template <typename T>
+void transpose_recursive(T const * src, size_t lds, T * dst, size_t ldd, size_t nrow, size_t ncol)
+{
+    constexpr size_t TILE = TransposeConstants::TILE;
+    if (nrow <= TILE && ncol <= TILE)
+    {
+        transpose_tile(src, lds, dst, ldd, nrow, ncol);
+    }
+    else if (nrow >= ncol)
+    {
+        size_t const half = std::max(nrow / 2 / TILE * TILE, TILE);
+        transpose_recursive(src, lds, dst, ldd, half, ncol);
+        transpose_recursive(src + half * lds, lds, dst + half, ldd, nrow - half, ncol);
+    }
+    else
+    {
+        size_t const half = std::max(ncol / 2 / TILE * TILE, TILE);
+        transpose_recursive(src, lds, dst, ldd, nrow, half);
+        transpose_recursive(src + half, lds, dst + half * ldd, ldd, nrow, ncol - half);
+    }
+}
+
+template <size_t K, typename T>
+void deinterleave_fixed(T const * src, size_t begin, size_t end, T * const * dst)
+{
+    for (size_t irow = begin; irow < end; ++irow)
+    {
+        for (size_t icol = 0; icol < K; ++icol)
+        {
+            dst[icol][irow] = src[irow * K + icol];
+        }
+    }
+}
+
+template <size_t K, typename T>
+void interleave_fixed(T const * const * src, size_t begin, size_t end, T * dst)
+{
+    for (size_t irow = begin; irow < end; ++irow)
+    {
+        for (size_t icol = 0; icol < K; ++icol)
+        {
+            dst[irow * K + icol] = src[icol][irow];
+        }
+    }
+}
+
+/// Call func(begin, end) on the chunks of n rows of k elements.
+template <typename F>
+void for_row_chunks(size_t n, size_t k, bool parallel, F && func)
+{
+    size_t const nrow_chunk = std::max(ThreadPool::CHUNK_SIZE / std::max(k, size_t(1)), size_t(1));
+    size_t const nchunk = (n + nrow_chunk - 1) / nrow_chunk;
+    auto body = [&](size_t ichunk)
+    {
+        func(ichunk * nrow_chunk, std::min((ichunk + 1) * nrow_chunk, n));
+    };
+    if (parallel && nchunk > 1)
+    {
+        ThreadPool::instance().run(nchunk, body);
+    }
+    else
+    {
+        for (size_t ichunk = 0; ichunk < nchunk; ++ichunk)
+        {
+            body(ichunk);
+        }
+    }
+}
+
+} /* end namespace detail */
+
+/**
+ * Scatter the k components of the n rows of src in [n, k] into the k arrays
+ * of dst, i.e., dst[j][i] = src[i * k + j].
+ */
+template <typename T>
+void deinterleave(T const * src, size_t n, size_t k, T * const * dst, bool parallel)
+{
+    detail::for_row_chunks(
+        n,
+        k,
+        parallel,
+        [&](size_t begin, size_t end)
+        {
+            switch (k)
+            {
+            case 1: std::copy(src + begin, src + end, dst[0] + begin); break;
+            case 2: detail::deinterleave_fixed<2>(src, begin, end, dst); break;
+            case 3: detail::deinterleave_fixed<3>(src, begin, end, dst); break;
+            case 4: detail::deinterleave_fixed<4>(src, begin, end, dst); break;
+            default:
+                // A block of rows stays in the cache while it is read k times.
+                for (size_t block = begin; block < end; block += detail::TransposeConstants::DEINTERLEAVE_BLOCK)
+                {
+                    size_t const block_end = std::min(block + detail::TransposeConstants::DEINTERLEAVE_BLOCK, end);
+                    for (size_t icol = 0; icol < k; ++icol)
+                    {
+                        T * MODMESH_RESTRICT out = dst[icol];
+                        for (size_t irow = block; irow < block_end; ++irow)
+                        {
+                            out[irow] = src[irow * k + icol];
+                        }
+                    }
+                }
+                break;
+            }
+        });
+}
+
+/// Gather the k arrays of n elements in src into dst in [n, k], i.e., dst[i * k + j] = src[j][i].
+template <typename T>
+void interleave(T const * const * src, size_t n, size_t k, T * dst, bool parallel)
+{
+    detail::for_row_chunks(
+        n,
+        k,
+        parallel,
+        [&](size_t begin, size_t end)
+        {
+            switch (k)
+            {
+            case 1: std::copy(src[0] + begin, src[0] + end, dst + begin); break;
+            case 2: detail::interleave_fixed<2>(src, begin, end, dst); break;
+            case 3: detail::interleave_fixed<3>(src, begin, end, dst); break;
+            case 4: detail::interleave_fixed<4>(src, begin, end, dst); break;
+            default:
+                for (size_t block = begin; block < end; block += detail::TransposeConstants::DEINTERLEAVE_BLOCK)
+                {
+                    size_t const block_end = std::min(block + detail::TransposeConstants::DEINTERLEAVE_BLOCK, end);
+                    for (size_t icol = 0; icol < k; ++icol)
+                    {
+                        T const * MODMESH_RESTRICT in = src[icol];
+                        for (size_t irow = block; irow < block_end; ++irow)
+                        {
+                            dst[irow * k + icol] = in[irow];
+                        }
+                    }
+                }
+                break;
+            }
+        });
+}
+
+/**
+ * Transpose the contiguous nrow-by-ncol matrix src into the ncol-by-nrow
+ * matrix dst.  src and dst must not overlap.
+ */
+template <typename T>
+void transpose(T const * src, size_t nrow, size_t ncol, T * dst, bool parallel)
+{
+    constexpr size_t SMALL_K = detail::TransposeConstants::SMALL_K;
+    if (0 == nrow || 0 == ncol)
+    {
+        return;
+    }
+    if (ncol <= SMALL_K)
+    {
+        std::array<T *, SMALL_K> rows{};
+        for (size_t icol = 0; icol < ncol; ++icol)
+        {
+            rows[icol] = dst + icol * nrow;
+        }
+        deinterleave(src, nrow, ncol, rows.data(), parallel);
+        return;
+    }
+    if (nrow <= SMALL_K)
+    {
+        std::array<T const *, SMALL_K> rows{};
+        for (size_t irow = 0; irow < nrow; ++irow)
+        {
+            rows[irow] = src + irow * ncol;
+        }
+        interleave(rows.data(), ncol, nrow, dst, parallel);
+        return;
+    }
+
+    // The tasks take blocks of whole tiles along the longer side.
+    constexpr size_t TILE = detail::TransposeConstants::TILE;
+    bool const by_row = nrow >= ncol;
+    size_t const nlong = by_row ? nrow : ncol;
+    size_t const nshort = by_row ? ncol : nrow;
+    size_t const nblock_elem = std::max(ThreadPool::CHUNK_SIZE / nshort / TILE * TILE, TILE);
+    size_t const ntask = (nlong + nblock_elem - 1) / nblock_elem;
+    auto body = [&](size_t itask)
+    {
+        size_t const begin = itask * nblock_elem;
+        size_t const count = std::min(nblock_elem, nlong - begin);
+        if (by_row)
+        {
+            detail::transpose_recursive(src + begin * ncol, ncol, dst + begin, nrow, count, ncol);
+        }
+        else
+        {
+            detail::transpose_recursive(src + begin, ncol, dst + begin * nrow, nrow, nrow, count);
+        }
+    };
+    if (parallel && ntask > 1)
+    {
+        ThreadPool::instance().run(ntask, body);
+    }
+    else
+    {
+        for (size_t itask = 0; itask < ntask; ++itask)
+        {
+            body(itask);
+        }
+    }
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
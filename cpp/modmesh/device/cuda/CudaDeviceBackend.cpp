@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/device/cuda/CudaDeviceBackend.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <new>
+#include <stdexcept>
+
+namespace modmesh
+{
+
+namespace device
+{
+
+namespace
+{
+
+void check(cudaError_t error, char const * what)
+{
+    if (cudaSuccess != error)
+    {
+        throw std::runtime_error(Formatter() << "CudaDeviceBackend: " << what << ": " << cudaGetErrorString(error));
+    }
+}
+
+} /* end namespace */
+
+int CudaDeviceBackend::device_count()
+{
+    int ret = 0;
+    if (cudaSuccess != cudaGetDeviceCount(&ret))
+    {
+        // Clear the error of the missing driver.
+        cudaGetLastError();
+        return 0;
+    }
+    return ret;
+}
+
+void * CudaDeviceBackend::do_allocate(size_t nbytes)
+{
+    void * ret = nullptr;
+    if (cudaSuccess != cudaMalloc(&ret, nbytes))
+    {
+        cudaGetLastError();
+        throw std::bad_alloc();
+    }
+    return ret;
+}
+
+void CudaDeviceBackend::do_deallocate(void * p, size_t)
+{
+    check(cudaFree(p), "cudaFree");
+}
+
+void * CudaDeviceBackend::do_allocate_pinned(size_t nbytes)
+{
+    void * ret = nullptr;
+    if (cudaSuccess != cudaMallocHost(&ret, nbytes))
+    {
+        cudaGetLastError();
+        throw std::bad_alloc();
+    }
+    return ret;
+}
+
+void CudaDeviceBackend::do_deallocate_pinned(void * p, size_t)
+{
+    check(cudaFreeHost(p), "cudaFreeHost");
+}
+
+DeviceBackend::stream_type CudaDeviceBackend::do_create_stream()
+{
+    cudaStream_t ret = nullptr;
+    check(cudaStreamCreateWithFlags(&ret, cudaStreamNonBlocking), "cudaStreamCreateWithFlags");
+    return ret;
+}
+
+void CudaDeviceBackend::do_destroy_stream(stream_type stream)
+{
+    check(cudaStreamDestroy(static_cast<cudaStream_t>(stream)), "cudaStreamDestroy");
+}
+
+void CudaDeviceBackend::do_synchronize(stream_type stream)
+{
+    check(cudaStreamSynchronize(static_cast<cudaStream_t>(stream)), "cudaStreamSynchronize");
+}
+
+void CudaDeviceBackend::do_copy_to_device(void * device, void const * pinned, size_t nbytes, stream_type stream)
+{
+    check(cudaMemcpyAsync(device, pinned, nbytes, cudaMemcpyHostToDevice, static_cast<cudaStream_t>(stream)), "cudaMemcpyAsync");
+}
+
+void CudaDeviceBackend::do_copy_to_host(void * pinned, void const * device, size_t nbytes, stream_type stream)
+{
+    check(cudaMemcpyAsync(pinned, device, nbytes, cudaMemcpyDeviceToHost, static_cast<cudaStream_t>(stream)), "cudaMemcpyAsync");
+}
+
+} /* end namespace device */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,74 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/DeviceBackend.hpp>
+
+namespace modmesh
+{
+
+namespace device
+{
+
+/**
+ * DeviceBackend of the current CUDA device with the runtime API.  A stream
+ * is a cudaStream_t, and the pinned memory is from cudaMallocHost().
+ */
+class CudaDeviceBackend
+    : public DeviceBackend
+{
+
+public:
+
+    static std::shared_ptr<CudaDeviceBackend> construct() { return std::make_shared<CudaDeviceBackend>(); }
+
+    /// The number of CUDA devices; 0 if the driver is not available.
+    static int device_count();
+
+    char const * name() const override { return "CudaDeviceBackend"; }
+
+protected:
+
+    void * do_allocate(size_t nbytes) override;
+    void do_deallocate(void * p, size_t nbytes) override;
+    void * do_allocate_pinned(size_t nbytes) override;
+    void do_deallocate_pinned(void * p, size_t nbytes) override;
+    stream_type do_create_stream() override;
+    void do_destroy_stream(stream_type stream) override;
+    void do_synchronize(stream_type stream) override;
+    void do_copy_to_device(void * device, void const * pinned, size_t nbytes, stream_type stream) override;
+    void do_copy_to_host(void * pinned, void const * device, size_t nbytes, stream_type stream) override;
+
+}; /* end class CudaDeviceBackend */
+
+} /* end namespace device */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,636 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#include <Metal/Metal.hpp>
+#pragma GCC diagnostic pop
+
+#include <modmesh/device/metal/Euler1DMetal.hpp>
+#include <modmesh/device/metal/metal.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace modmesh
+{
+
+namespace device
+{
+
+namespace
+{
+
+// The kernels follow the float instantiation of Euler1DCore operation by
+// operation.  They are compiled from the source when Euler1DMetal is
+// constructed, so that no Metal toolchain is needed to build modmesh.
+constexpr char const * EULER1D_METAL_SOURCE = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+// The points start + 2 * i of a plane, for i in [0, npoint).
+struct Euler1DPlane
+{
+    uint start;
+    uint npoint;
+    float hdt;
+    float qdt;
+};
+
+constant float TINY = 1.e-30f;
+
+// The variables of the SE at ic, as Euler1DKernel::derive() calculates.
+struct Euler1DSe
+{
+    float x;
+    float xneg;
+    float xpos;
+    float xctr;
+    float u[3];
+    float ux[3];
+    float f[3];
+    float ut[3];
+    float ft[3];
+};
+
+Euler1DSe derive(
+    uint ic,
+    device float const * gamma,
+    device float const * coord,
+    device float const * so0,
+    device float const * so1)
+{
+    Euler1DSe s;
+    float const ga = gamma[ic];
+    s.x = coord[ic];
+    s.xneg = coord[ic - 1];
+    s.xpos = coord[ic + 1];
+    s.xctr = (s.xpos + s.xneg) * 0.5f;
+    for (uint iv = 0; iv < 3; ++iv)
+    {
+        s.u[iv] = so0[ic * 3 + iv];
+        s.ux[iv] = so1[ic * 3 + iv];
+    }
+    float const u0 = s.u[0];
+    float const u1 = s.u[1];
+    float const u2 = s.u[2];
+
+    float jac[3][3];
+    jac[0][0] = 0.0f;
+    jac[0][1] = 1.0f;
+    jac[0][2] = 0.0f;
+    jac[1][0] = (ga - 3.0f) / 2.0f * u1 * u1 / (u0 * u0 + TINY);
+    jac[1][1] = -(ga - 3.0f) * u1 / (u0 + TINY);
+    jac[1][2] = ga - 1.0f;
+    jac[2][0] = (ga - 1.0f) * u1 * u1 * u1 / (u0 * u0 * u0 + TINY) - ga * u1 * u2 / (u0 * u0 + TINY);
+    jac[2][1] = ga * u2 / (u0 + TINY) - 3.0f / 2.0f * (ga - 1.0f) * u1 * u1 / (u0 * u0 + TINY);
+    jac[2][2] = ga * u1 / (u0 + TINY);
+
+    s.f[0] = u1;
+    s.f[1] = (ga - 1.0f) * u2 + (3.0f - ga) / 2.0f * u1 * u1 / (u0 + TINY);
+    s.f[2] = ga * u1 * u2 / (u0 + TINY) - (ga - 1.0f) / 2.0f * u1 * u1 * u1 / (u0 * u0 + TINY);
+
+    for (uint iv = 0; iv < 3; ++iv)
+    {
+        s.ut[iv] = -jac[iv][0] * s.ux[0] - jac[iv][1] * s.ux[1] - jac[iv][2] * s.ux[2];
+    }
+    for (uint iv = 0; iv < 3; ++iv)
+    {
+        s.ft[iv] = jac[iv][0] * s.ut[0] + jac[iv][1] * s.ut[1] + jac[iv][2] * s.ut[2];
+    }
+    return s;
+}
+
+kernel void euler1d_update_cfl(
+    device float const * gamma [[buffer(0)]],
+    device float const * coord [[buffer(1)]],
+    device float const * so0 [[buffer(2)]],
+    device float * cfl [[buffer(3)]],
+    device float * cfl_max [[buffer(4)]],
+    constant Euler1DPlane & plane [[buffer(5)]],
+    uint i [[thread_position_in_grid]],
+    uint igroup [[threadgroup_position_in_grid]],
+    uint isimd [[simdgroup_index_in_threadgroup]],
+    uint ilane [[thread_index_in_simdgroup]],
+    uint nsimd [[simdgroups_per_threadgroup]])
+{
+    threadgroup float simd_max_values[32];
+    float value = 0.0f;
+    if (i < plane.npoint)
+    {
+        uint const it = plane.start + 2 * i;
+        float const ga = gamma[it];
+        float wspd = so0[it * 3 + 1];
+        wspd *= wspd;
+        float const ke = wspd / (2.0f * so0[it * 3]);
+        float pr = (ga - 1.0f) * (so0[it * 3 + 2] - ke);
+        pr = (pr + abs(pr)) / 2.0f;
+        wspd = sqrt(ga * pr / so0[it * 3]) + sqrt(wspd) / so0[it * 3];
+        float const dxpos = coord[it + 1] - coord[it];
+        float const dxneg = coord[it] - coord[it - 1];
+        value = plane.hdt * wspd / (dxpos < dxneg ? dxpos : dxneg);
+        cfl[it] = value;
+    }
+    // The maximum of the threadgroup, to be reduced on the CPU.
+    value = simd_max(value);
+    if (0 == ilane)
+    {
+        simd_max_values[isimd] = value;
+    }
+    threadgroup_barrier(mem_flags::mem_threadgroup);
+    if (0 == isimd)
+    {
+        value = simd_max(ilane < nsimd ? simd_max_values[ilane] : 0.0f);
+        if (0 == ilane)
+        {
+            cfl_max[igroup] = value;
+        }
+    }
+}
+
+kernel void euler1d_march_half_so0(
+    device float const * gamma [[buffer(0)]],
+    device float const * coord [[buffer(1)]],
+    device float * so0 [[buffer(2)]],
+    device float const * so1 [[buffer(3)]],
+    constant Euler1DPlane & plane [[buffer(4)]],
+    uint i [[thread_position_in_grid]])
+{
+    if (i >= plane.npoint)
+    {
+        return;
+    }
+    // The CE between the SEs at ic and ic + 2 writes the point ic + 1.
+    uint const ic = plane.start + 2 * i;
+    Euler1DSe const sn = derive(ic, gamma, coord, so0, so1);
+    Euler1DSe const sp = derive(ic + 2, gamma, coord, so0, so1);
+    float const dx = coord[ic + 2] - coord[ic];
+    for (uint iv = 0; iv < 3; ++iv)
+    {
+        float const ll = (sn.xpos - sn.x) * (sn.u[iv] + (0.5f * (sn.x + sn.xpos) - sn.xctr) * sn.ux[iv])
+                         + plane.hdt * (sn.f[iv] - ((sn.x - sn.xctr) * sn.ut[iv]) + (plane.qdt * sn.ft[iv]));
+        float const lr = (sp.x - sp.xneg) * (sp.u[iv] + (0.5f * (sp.x + sp.xneg) - sp.xctr) * sp.ux[iv])
+                         - plane.hdt * (sp.f[iv] - ((sp.x - sp.xctr) * sp.ut[iv]) + (plane.qdt * sp.ft[iv]));
+        so0[(ic + 1) * 3 + iv] = (ll + lr) / dx;
+    }
+}
+
+template <uint ALPHA>
+float pow_alpha(float v)
+{
+    float ret = v;
+    for (uint k = 1; k < ALPHA; ++k)
+    {
+        ret *= v;
+    }
+    return ret;
+}
+
+template <uint ALPHA>
+void march_half_so1(
+    device float const * gamma,
+    device float const * coord,
+    device float const * so0,
+    device float * so1,
+    constant Euler1DPlane & plane,
+    uint i)
+{
+    if (i >= plane.npoint)
+    {
+        return;
+    }
+    uint const ic = plane.start + 2 * i;
+    uint const it = ic + 1;
+    Euler1DSe const sn = derive(ic, gamma, coord, so0, so1);
+    Euler1DSe const sp = derive(ic + 2, gamma, coord, so0, so1);
+    float const dxn = coord[it] - coord[it - 1];
+    float const dxp = coord[it + 1] - coord[it];
+    for (uint iv = 0; iv < 3; ++iv)
+    {
+        float const upn = sn.u[iv] + (sn.x - sn.xctr) * sn.ux[iv] + plane.hdt * sn.ut[iv];
+        float const upp = sp.u[iv] + (sp.x - sp.xctr) * sp.ux[iv] + plane.hdt * sp.ut[iv];
+        float const utp = so0[it * 3 + iv];
+        float const duxn = (utp - upn) / dxn;
+        float const duxp = (upp - utp) / dxp;
+        float const fan = pow_alpha<ALPHA>(abs(duxn));
+        float const fap = pow_alpha<ALPHA>(abs(duxp));
+        so1[it * 3 + iv] = (fap * duxn + fan * duxp) / (fap + fan + TINY);
+    }
+}
+
+kernel void euler1d_march_half_so1_alpha1(
+    device float const * gamma [[buffer(0)]],
+    device float const * coord [[buffer(1)]],
+    device float const * so0 [[buffer(2)]],
+    device float * so1 [[buffer(3)]],
+    constant Euler1DPlane & plane [[buffer(4)]],
+    uint i [[thread_position_in_grid]])
+{
+    march_half_so1<1>(gamma, coord, so0, so1, plane, i);
+}
+
+kernel void euler1d_march_half_so1_alpha2(
+    device float const * gamma [[buffer(0)]],
+    device float const * coord [[buffer(1)]],
+    device float const * so0 [[buffer(2)]],
+    device float * so1 [[buffer(3)]],
+    constant Euler1DPlane & plane [[buffer(4)]],
+    uint i [[thread_position_in_grid]])
+{
+    march_half_so1<2>(gamma, coord, so0, so1, plane, i);
+}
+
+// Set the outside values from the inside ones, a thread per variable at
+// each end.
+kernel void euler1d_treat_boundary(
+    device float * arr [[buffer(0)]],
+    constant uint & ncoord [[buffer(1)]],
+    uint i [[thread_position_in_grid]])
+{
+    if (i >= 6)
+    {
+        return;
+    }
+    uint const iv = i % 3;
+    if (i < 3)
+    {
+        arr[iv] = arr[2 * 3 + iv];
+    }
+    else
+    {
+        arr[(ncoord - 1) * 3 + iv] = arr[(ncoord - 3) * 3 + iv];
+    }
+}
+)";
+
+// A multiple of the SIMD width, and not more than 32 SIMD groups for the
+// reduction of euler1d_update_cfl.
+constexpr size_t THREADGROUP_SIZE = 256;
+
+// The steps encoded into a command buffer by march_alpha().
+constexpr size_t STEPS_PER_COMMAND = 256;
+
+// Euler1DPlane of the kernel source.
+struct Euler1DPlane
+{
+    uint32_t start;
+    uint32_t npoint;
+    float hdt;
+    float qdt;
+}; /* end struct Euler1DPlane */
+
+Euler1DPlane make_plane(size_t ncoord, bool odd_plane, float time_increment)
+{
+    constexpr size_t bound = Euler1DMetal::core_type::BOUND_COUNT;
+    size_t const start = bound - (odd_plane ? 1 : 0);
+    size_t const stop = ncoord - bound - (odd_plane ? 0 : 1);
+    Euler1DPlane ret{};
+    ret.start = static_cast<uint32_t>(start);
+    ret.npoint = static_cast<uint32_t>(start < stop ? (stop - start + 1) / 2 : 0);
+    ret.hdt = time_increment / 2.0f;
+    ret.qdt = ret.hdt / 2.0f;
+    return ret;
+}
+
+void dispatch(MTL::ComputeCommandEncoder * encoder, size_t nthread)
+{
+    size_t const ngroup = (nthread + THREADGROUP_SIZE - 1) / THREADGROUP_SIZE;
+    encoder->dispatchThreadgroups(MTL::Size(ngroup, 1, 1), MTL::Size(THREADGROUP_SIZE, 1, 1));
+}
+
+MTL::ComputePipelineState * make_pipeline(MTL::Device * device, MTL::Library * library, char const * name)
+{
+    MTL::Function * function = library->newFunction(NS::String::string(name, NS::UTF8StringEncoding));
+    if (nullptr == function)
+    {
+        throw std::runtime_error(Formatter() << "Euler1DMetal: kernel " << name << " is not found");
+    }
+    NS::Error * error = nullptr;
+    MTL::ComputePipelineState * ret = device->newComputePipelineState(function, &error);
+    function->release();
+    if (nullptr == ret)
+    {
+        throw std::runtime_error(Formatter() << "Euler1DMetal: cannot create the pipeline of " << name << ": "
+                                             << error->localizedDescription()->utf8String());
+    }
+    if (ret->maxTotalThreadsPerThreadgroup() < THREADGROUP_SIZE)
+    {
+        ret->release();
+        throw std::runtime_error(Formatter() << "Euler1DMetal: kernel " << name << " cannot run "
+                                             << THREADGROUP_SIZE << " threads in a threadgroup");
+    }
+    return ret;
+}
+
+} /* end namespace */
+
+Euler1DMetal::Euler1DMetal(size_t ncoord, float time_increment, ctor_passkey const &)
+    : m_resource(MetalMemoryResource::construct())
+{
+    MTL::Device * device = MetalManager::instance().device();
+    if (nullptr == device)
+    {
+        throw std::runtime_error("Euler1DMetal: no Metal device");
+    }
+    if (ncoord > std::numeric_limits<uint32_t>::max() / core_type::NVAR)
+    {
+        throw std::invalid_argument(Formatter() << "Euler1DMetal: ncoord " << ncoord << " is too large for the kernels");
+    }
+    {
+        MemoryResourceScope const scope(m_resource);
+        m_core = core_type::construct(ncoord, time_increment);
+    }
+
+    NS::AutoreleasePool * pool = NS::AutoreleasePool::alloc()->init();
+    MTL::CompileOptions * options = MTL::CompileOptions::alloc()->init();
+    // Keep the IEEE 754 arithmetic of the CPU.
+    options->setFastMathEnabled(false);
+    NS::Error * error = nullptr;
+    MTL::Library * library = device->newLibrary(NS::String::string(EULER1D_METAL_SOURCE, NS::UTF8StringEncoding), options, &error);
+    options->release();
+    if (nullptr == library)
+    {
+        std::string const message = error->localizedDescription()->utf8String();
+        pool->release();
+        throw std::runtime_error(Formatter() << "Euler1DMetal: cannot compile the kernels: " << message);
+    }
+    try
+    {
+        m_update_cfl = make_pipeline(device, library, "euler1d_update_cfl");
+        m_march_half_so0 = make_pipeline(device, library, "euler1d_march_half_so0");
+        m_march_half_so1_alpha1 = make_pipeline(device, library, "euler1d_march_half_so1_alpha1");
+        m_march_half_so1_alpha2 = make_pipeline(device, library, "euler1d_march_half_so1_alpha2");
+        m_treat_boundary = make_pipeline(device, library, "euler1d_treat_boundary");
+    }
+    catch (...)
+    {
+        library->release();
+        pool->release();
+        release();
+        throw;
+    }
+    library->release();
+    pool->release();
+
+    for (size_t iplane = 0; iplane < 2; ++iplane)
+    {
+        size_t const npoint = make_plane(ncoord, 1 == iplane, time_increment).npoint;
+        m_cfl_ngroup[iplane] = (npoint + THREADGROUP_SIZE - 1) / THREADGROUP_SIZE;
+        m_cfl_max[iplane] = device->newBuffer(std::max(m_cfl_ngroup[iplane], size_t(1)) * sizeof(float), MTL::ResourceStorageModeShared);
+    }
+}
+
+Euler1DMetal::~Euler1DMetal() { release(); }
+
+void Euler1DMetal::release()
+{
+    for (MTL::ComputePipelineState ** pipeline : {&m_update_cfl, &m_march_half_so0, &m_march_half_so1_alpha1, &m_march_half_so1_alpha2, &m_treat_boundary})
+    {
+        if (nullptr != *pipeline)
+        {
+            (*pipeline)->release();
+            *pipeline = nullptr;
+        }
+    }
+    for (MTL::Buffer *& buffer : m_cfl_max)
+    {
+        if (nullptr != buffer)
+        {
+            buffer->release();
+            buffer = nullptr;
+        }
+    }
+}
+
+void Euler1DMetal::restore(Checkpoint checkpoint)
+{
+    MemoryResourceScope const scope(m_resource);
+    m_core->restore(std::move(checkpoint));
+}
+
+template <typename F>
+void Euler1DMetal::run(size_t ncommand, F && encode)
+{
+    // Throw before encoding, e.g., when the arrays of the core were replaced
+    // by those not in the Metal buffers.
+    for (SimpleArray<float> const * arr : {&m_core->gamma(), &m_core->coord(), &m_core->cfl(), &m_core->so0(), &m_core->so1()})
+    {
+        m_resource->find(arr->data());
+    }
+    NS::AutoreleasePool * pool = NS::AutoreleasePool::alloc()->init();
+    MTL::CommandQueue * queue = MetalManager::instance().queue();
+    std::vector<MTL::CommandBuffer *> commands(ncommand);
+    for (size_t icommand = 0; icommand < ncommand; ++icommand)
+    {
+        commands[icommand] = queue->commandBuffer();
+        // The dispatches of a serial encoder see the writes of the previous
+        // ones.
+        MTL::ComputeCommandEncoder * encoder = commands[icommand]->computeCommandEncoder();
+        encode(encoder, icommand);
+        encoder->endEncoding();
+        commands[icommand]->commit();
+    }
+    // The command buffers of a queue run in order.
+    commands.back()->waitUntilCompleted();
+    bool const failed = std::any_of(
+        commands.begin(),
+        commands.end(),
+        [](MTL::CommandBuffer * command)
+        { return MTL::CommandBufferStatusError == command->status(); });
+    pool->release();
+    if (failed)
+    {
+        throw std::runtime_error("Euler1DMetal: the command buffer failed");
+    }
+}
+
+void Euler1DMetal::update_cfl(bool odd_plane)
+{
+    run(1,
+        [&](MTL::ComputeCommandEncoder * encoder, size_t)
+        { encode_update_cfl(encoder, odd_plane); });
+    // No step is marched, and only max_cfl() is taken.
+    m_core->add_steps(0, reduce_max_cfl(odd_plane ? 1 : 0, odd_plane ? 2 : 1));
+}
+
+void Euler1DMetal::march_half_so0(bool odd_plane)
+{
+    run(1,
+        [&](MTL::ComputeCommandEncoder * encoder, size_t)
+        { encode_march_half_so0(encoder, odd_plane); });
+}
+
+template <size_t ALPHA>
+void Euler1DMetal::march_half_so1_alpha(bool odd_plane)
+{
+    run(1,
+        [&](MTL::ComputeCommandEncoder * encoder, size_t)
+        { encode_march_half_so1(encoder, odd_plane, ALPHA); });
+}
+
+void Euler1DMetal::treat_boundary_so0()
+{
+    run(1,
+        [&](MTL::ComputeCommandEncoder * encoder, size_t)
+        { encode_treat_boundary(encoder, m_core->so0()); });
+}
+
+void Euler1DMetal::treat_boundary_so1()
+{
+    run(1,
+        [&](MTL::ComputeCommandEncoder * encoder, size_t)
+        { encode_treat_boundary(encoder, m_core->so1()); });
+}
+
+template <size_t ALPHA>
+void Euler1DMetal::march_alpha(size_t steps)
+{
+    if (0 == steps)
+    {
+        return;
+    }
+    if (m_core->target_cfl() > 0)
+    {
+        // The time increment of a step depends on the CFL numbers of the
+        // last one, which are reduced on the CPU.
+        for (size_t it = 0; it < steps; ++it)
+        {
+            if (m_core->max_cfl() > 0)
+            {
+                m_core->set_time_increment(m_core->time_increment() * m_core->target_cfl() / m_core->max_cfl());
+            }
+            run(1,
+                [&](MTL::ComputeCommandEncoder * encoder, size_t)
+                { encode_step(encoder, ALPHA); });
+            m_core->add_steps(1, reduce_max_cfl(0, 2));
+        }
+        return;
+    }
+    size_t const ncommand = (steps + STEPS_PER_COMMAND - 1) / STEPS_PER_COMMAND;
+    run(ncommand,
+        [&](MTL::ComputeCommandEncoder * encoder, size_t icommand)
+        {
+            size_t const nstep = std::min(STEPS_PER_COMMAND, steps - icommand * STEPS_PER_COMMAND);
+            for (size_t it = 0; it < nstep; ++it)
+            {
+                encode_step(encoder, ALPHA);
+            }
+        });
+    m_core->add_steps(steps, reduce_max_cfl(0, 2));
+}
+
+void Euler1DMetal::bind(MTL::ComputeCommandEncoder * encoder, SimpleArray<float> const & arr, size_t index) const
+{
+    std::pair<MTL::Buffer *, size_t> const found = m_resource->find(arr.data());
+    encoder->setBuffer(found.first, found.second, index);
+}
+
+void Euler1DMetal::encode_update_cfl(MTL::ComputeCommandEncoder * encoder, bool odd_plane)
+{
+    Euler1DPlane const plane = make_plane(m_core->ncoord(), odd_plane, m_core->time_increment());
+    encoder->setComputePipelineState(m_update_cfl);
+    bind(encoder, m_core->gamma(), 0);
+    bind(encoder, m_core->coord(), 1);
+    bind(encoder, m_core->so0(), 2);
+    bind(encoder, m_core->cfl(), 3);
+    encoder->setBuffer(m_cfl_max[odd_plane ? 1 : 0], 0, 4);
+    encoder->setBytes(&plane, sizeof(plane), 5);
+    dispatch(encoder, plane.npoint);
+}
+
+void Euler1DMetal::encode_march_half_so0(MTL::ComputeCommandEncoder * encoder, bool odd_plane)
+{
+    Euler1DPlane const plane = make_plane(m_core->ncoord(), odd_plane, m_core->time_increment());
+    encoder->setComputePipelineState(m_march_half_so0);
+    bind(encoder, m_core->gamma(), 0);
+    bind(encoder, m_core->coord(), 1);
+    bind(encoder, m_core->so0(), 2);
+    bind(encoder, m_core->so1(), 3);
+    encoder->setBytes(&plane, sizeof(plane), 4);
+    dispatch(encoder, plane.npoint);
+}
+
+void Euler1DMetal::encode_march_half_so1(MTL::ComputeCommandEncoder * encoder, bool odd_plane, size_t alpha)
+{
+    Euler1DPlane const plane = make_plane(m_core->ncoord(), odd_plane, m_core->time_increment());
+    encoder->setComputePipelineState(1 == alpha ? m_march_half_so1_alpha1 : m_march_half_so1_alpha2);
+    bind(encoder, m_core->gamma(), 0);
+    bind(encoder, m_core->coord(), 1);
+    bind(encoder, m_core->so0(), 2);
+    bind(encoder, m_core->so1(), 3);
+    encoder->setBytes(&plane, sizeof(plane), 4);
+    dispatch(encoder, plane.npoint);
+}
+
+void Euler1DMetal::encode_treat_boundary(MTL::ComputeCommandEncoder * encoder, SimpleArray<float> const & arr)
+{
+    auto const ncoord = static_cast<uint32_t>(m_core->ncoord());
+    encoder->setComputePipelineState(m_treat_boundary);
+    bind(encoder, arr, 0);
+    encoder->setBytes(&ncoord, sizeof(ncoord), 1);
+    encoder->dispatchThreadgroups(MTL::Size(1, 1, 1), MTL::Size(6, 1, 1));
+}
+
+void Euler1DMetal::encode_step(MTL::ComputeCommandEncoder * encoder, size_t alpha)
+{
+    // The same sequence as Euler1DCore::march_alpha().
+    encode_march_half_so0(encoder, /*odd_plane*/ false);
+    encode_update_cfl(encoder, /*odd_plane*/ false);
+    encode_march_half_so1(encoder, /*odd_plane*/ false, alpha);
+    encode_treat_boundary(encoder, m_core->so0());
+    encode_march_half_so0(encoder, /*odd_plane*/ true);
+    encode_update_cfl(encoder, /*odd_plane*/ true);
+    encode_march_half_so1(encoder, /*odd_plane*/ true, alpha);
+    encode_treat_boundary(encoder, m_core->so1());
+}
+
+float Euler1DMetal::reduce_max_cfl(size_t begin, size_t end) const
+{
+    float ret = 0;
+    for (size_t iplane = begin; iplane < end; ++iplane)
+    {
+        auto const * values = static_cast<float const *>(m_cfl_max[iplane]->contents());
+        for (size_t it = 0; it < m_cfl_ngroup[iplane]; ++it)
+        {
+            ret = std::max(ret, values[it]);
+        }
+    }
+    return ret;
+}
+
+template void Euler1DMetal::march_half_so1_alpha<1>(bool odd_plane);
+template void Euler1DMetal::march_half_so1_alpha<2>(bool odd_plane);
+template void Euler1DMetal::march_alpha<1>(size_t steps);
+template void Euler1DMetal::march_alpha<2>(size_t steps);
+
+} /* end namespace device */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,148 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/device/metal/MetalMemoryResource.hpp>
+#include <modmesh/onedim/Euler1DCore.hpp>
+
+#include <memory>
+
+// forward declaration.
+namespace MTL
+{
+class Buffer;
+class ComputeCommandEncoder;
+class ComputePipelineState;
+} /* end namespace MTL */
+
+namespace modmesh
+{
+
+namespace device
+{
+
+/**
+ * March an Euler1DCoreFp32 with Metal compute kernels.  The GPU does not
+ * calculate in double, so the core is in float32.  Its arrays are allocated
+ * from a MetalMemoryResource and shared by the CPU and the GPU without
+ * copying; the other member functions of the core, e.g., the quantities and
+ * the checkpoints, work on the same memory after a march returns.
+ *
+ * Each half-step sweep is a kernel with a thread per point, and the boundary
+ * treatment is a kernel of 6 threads.  march_alpha() encodes all the steps
+ * into one command buffer unless the core has target_cfl(), which needs
+ * max_cfl() on the CPU before each step.
+ */
+class Euler1DMetal
+    : public std::enable_shared_from_this<Euler1DMetal>
+{
+
+private:
+
+    struct ctor_passkey
+    {
+    };
+
+public:
+
+    using core_type = onedim::Euler1DCoreFp32;
+
+    template <class... Args>
+    static std::shared_ptr<Euler1DMetal> construct(Args &&... args)
+    {
+        return std::make_shared<Euler1DMetal>(std::forward<Args>(args)..., ctor_passkey());
+    }
+
+    /// Construct the core of ncoord points with the arrays in Metal buffers.
+    Euler1DMetal(size_t ncoord, float time_increment, ctor_passkey const &);
+
+    Euler1DMetal() = delete;
+    Euler1DMetal(Euler1DMetal const &) = delete;
+    Euler1DMetal(Euler1DMetal &&) = delete;
+    Euler1DMetal & operator=(Euler1DMetal const &) = delete;
+    Euler1DMetal & operator=(Euler1DMetal &&) = delete;
+    ~Euler1DMetal();
+
+    std::shared_ptr<core_type> const & core() const { return m_core; }
+    std::shared_ptr<MetalMemoryResource> const & resource() const { return m_resource; }
+
+    /// Restore the core with the arrays allocated in the Metal buffers.
+    void restore(Checkpoint checkpoint);
+
+    // The sweeps of Euler1DCore, each run as a command buffer and waited for.
+    void update_cfl(bool odd_plane);
+    void march_half_so0(bool odd_plane);
+    template <size_t ALPHA>
+    void march_half_so1_alpha(bool odd_plane);
+    void treat_boundary_so0();
+    void treat_boundary_so1();
+
+    /// March the steps as Euler1DCore::march_alpha() does, without tiling.
+    template <size_t ALPHA>
+    void march_alpha(size_t steps);
+
+private:
+
+    // Encode ncommand command buffers by encode(encoder, icommand), commit
+    // them, and wait for them to complete.
+    template <typename F>
+    void run(size_t ncommand, F && encode);
+    void release();
+
+    // Bind the array of the core to the buffer index of the kernel.
+    void bind(MTL::ComputeCommandEncoder * encoder, SimpleArray<float> const & arr, size_t index) const;
+
+    void encode_update_cfl(MTL::ComputeCommandEncoder * encoder, bool odd_plane);
+    void encode_march_half_so0(MTL::ComputeCommandEncoder * encoder, bool odd_plane);
+    void encode_march_half_so1(MTL::ComputeCommandEncoder * encoder, bool odd_plane, size_t alpha);
+    void encode_treat_boundary(MTL::ComputeCommandEncoder * encoder, SimpleArray<float> const & arr);
+    void encode_step(MTL::ComputeCommandEncoder * encoder, size_t alpha);
+    // The largest CFL number written by the last update_cfl kernels of the
+    // planes [begin, end), 0 for the even plane and 1 for the odd plane.
+    float reduce_max_cfl(size_t begin, size_t end) const;
+
+    std::shared_ptr<MetalMemoryResource> m_resource;
+    std::shared_ptr<core_type> m_core;
+    MTL::ComputePipelineState * m_update_cfl = nullptr;
+    MTL::ComputePipelineState * m_march_half_so0 = nullptr;
+    MTL::ComputePipelineState * m_march_half_so1_alpha1 = nullptr;
+    MTL::ComputePipelineState * m_march_half_so1_alpha2 = nullptr;
+    MTL::ComputePipelineState * m_treat_boundary = nullptr;
+    // The maximum of each threadgroup of update_cfl, for the even and the
+    // odd planes.
+    MTL::Buffer * m_cfl_max[2] = {nullptr, nullptr};
+    size_t m_cfl_ngroup[2] = {0, 0};
+
+}; /* end class Euler1DMetal */
+
+} /* end namespace device */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
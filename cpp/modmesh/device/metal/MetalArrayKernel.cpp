@@ -0,0 +1,524 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#include <Metal/Metal.hpp>
+#pragma GCC diagnostic pop
+
+#include <modmesh/device/metal/MetalArrayKernel.hpp>
+#include <modmesh/device/metal/metal.hpp>
+
+#include <algorithm>
+
+namespace modmesh
+{
+
+namespace device
+{
+
+namespace
+{
+
+// Compiled from the source at the first offloaded call, as the kernels of
+// Euler1DMetal.
+constexpr char const * ARRAY_METAL_SOURCE = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+kernel void array_fill(
+    device float * arr [[buffer(0)]],
+    constant float & value [[buffer(1)]],
+    constant uint & n [[buffer(2)]],
+    uint i [[thread_position_in_grid]])
+{
+    if (i < n)
+    {
+        arr[i] = value;
+    }
+}
+
+kernel void array_axpby(
+    device float const * x [[buffer(0)]],
+    device float * y [[buffer(1)]],
+    constant float2 & ab [[buffer(2)]],
+    constant uint & n [[buffer(3)]],
+    uint i [[thread_position_in_grid]])
+{
+    if (i < n)
+    {
+        y[i] = ab.x * x[i] + ab.y * y[i];
+    }
+}
+
+struct ReduceMin
+{
+    static float identity() { return INFINITY; }
+    static float apply(float a, float b) { return b < a ? b : a; }
+    static float simd(float v) { return simd_min(v); }
+};
+
+struct ReduceMax
+{
+    static float identity() { return -INFINITY; }
+    static float apply(float a, float b) { return b > a ? b : a; }
+    static float simd(float v) { return simd_max(v); }
+};
+
+struct ReduceSum
+{
+    static float identity() { return 0.0f; }
+    static float apply(float a, float b) { return a + b; }
+    static float simd(float v) { return simd_sum(v); }
+};
+
+// Each thread strides over the grid, and each threadgroup writes its result
+// to partial[igroup] to be reduced on the CPU.
+template <typename Op>
+void reduce(
+    device float const * arr,
+    device float * partial,
+    uint n,
+    uint i,
+    uint nthread,
+    uint igroup,
+    uint isimd,
+    uint ilane,
+    uint nsimd,
+    threadgroup float * simd_values)
+{
+    float value = Op::identity();
+    for (uint it = i; it < n; it += nthread)
+    {
+        value = Op::apply(value, arr[it]);
+    }
+    value = Op::simd(value);
+    if (0 == ilane)
+    {
+        simd_values[isimd] = value;
+    }
+    threadgroup_barrier(mem_flags::mem_threadgroup);
+    if (0 == isimd)
+    {
+        value = Op::simd(ilane < nsimd ? simd_values[ilane] : Op::identity());
+        if (0 == ilane)
+        {
+            partial[igroup] = value;
+        }
+    }
+}
+
+#define ARRAY_REDUCE_KERNEL(NAME, OP)                                      \
+    kernel void NAME(                                                      \
+        device float const * arr [[buffer(0)]],                           \
+        device float * partial [[buffer(1)]],                             \
+        constant uint & n [[buffer(2)]],                                  \
+        uint i [[thread_position_in_grid]],                               \
+        uint nthread [[threads_per_grid]],                                \
+        uint igroup [[threadgroup_position_in_grid]],                     \
+        uint isimd [[simdgroup_index_in_threadgroup]],                    \
+        uint ilane [[thread_index_in_simdgroup]],                         \
+        uint nsimd [[simdgroups_per_threadgroup]])                        \
+    {                                                                      \
+        threadgroup float simd_values[32];                                 \
+        reduce<OP>(arr, partial, n, i, nthread, igroup, isimd, ilane,      \
+                   nsimd, simd_values);                                    \
+    }
+
+ARRAY_REDUCE_KERNEL(array_min, ReduceMin)
+ARRAY_REDUCE_KERNEL(array_max, ReduceMax)
+ARRAY_REDUCE_KERNEL(array_sum, ReduceSum)
+)";
+
+// A multiple of the SIMD width, and not more than 32 SIMD groups for the
+// reductions.
+constexpr size_t THREADGROUP_SIZE = 256;
+
+// The threadgroups of a reduction, and the partial results reduced on the
+// CPU.
+constexpr size_t REDUCE_NGROUP_MAX = 1024;
+
+MTL::ComputePipelineState * make_pipeline(MTL::Device * device, MTL::Library * library, char const * name)
+{
+    MTL::Function * function = library->newFunction(NS::String::string(name, NS::UTF8StringEncoding));
+    if (nullptr == function)
+    {
+        throw std::runtime_error(Formatter() << "MetalArrayKernel: kernel " << name << " is not found");
+    }
+    NS::Error * error = nullptr;
+    MTL::ComputePipelineState * ret = device->newComputePipelineState(function, &error);
+    function->release();
+    if (nullptr == ret)
+    {
+        throw std::runtime_error(Formatter() << "MetalArrayKernel: cannot create the pipeline of " << name << ": "
+                                             << error->localizedDescription()->utf8String());
+    }
+    if (ret->maxTotalThreadsPerThreadgroup() < THREADGROUP_SIZE)
+    {
+        ret->release();
+        throw std::runtime_error(Formatter() << "MetalArrayKernel: kernel " << name << " cannot run "
+                                             << THREADGROUP_SIZE << " threads in a threadgroup");
+    }
+    return ret;
+}
+
+size_t group_count(size_t nthread) { return (nthread + THREADGROUP_SIZE - 1) / THREADGROUP_SIZE; }
+
+bool cpu_parallel(size_t nelem) { return ThreadPool::instance().use_parallel(nelem); }
+
+} /* end namespace */
+
+MetalArrayKernel & MetalArrayKernel::instance()
+{
+    static MetalArrayKernel o;
+    return o;
+}
+
+MetalArrayKernel::MetalArrayKernel() = default;
+
+MetalArrayKernel::~MetalArrayKernel()
+{
+    for (MTL::ComputePipelineState * pipeline : {m_fill, m_axpby, m_min, m_max, m_sum})
+    {
+        if (nullptr != pipeline)
+        {
+            pipeline->release();
+        }
+    }
+}
+
+std::pair<MTL::Buffer *, size_t> MetalArrayKernel::locate(SimpleArray<float> const & arr)
+{
+    if (!arr || 0 == arr.size())
+    {
+        return {nullptr, 0};
+    }
+    ConcreteBuffer const & buffer = arr.buffer();
+    if (!buffer.has_remover() || !detail::ConcreteBufferResourceRemover::is_same_type(buffer.get_remover()))
+    {
+        return {nullptr, 0};
+    }
+    auto const & remover = static_cast<detail::ConcreteBufferResourceRemover const &>(buffer.get_remover());
+    auto const * resource = dynamic_cast<MetalMemoryResource const *>(remover.resource.get());
+    if (nullptr == resource)
+    {
+        return {nullptr, 0};
+    }
+    return resource->find(arr.data());
+}
+
+template <typename T, typename... Arrays>
+void MetalArrayKernel::check_runnable(char const * name, SimpleArray<T> const & arr, Arrays const &... others)
+{
+    if constexpr (!std::is_same_v<T, float>)
+    {
+        throw std::invalid_argument(Formatter() << "MetalArrayKernel: " << name << " cannot offload the array of double to the GPU");
+    }
+    else if (!runnable(arr, others...))
+    {
+        throw std::invalid_argument(Formatter() << "MetalArrayKernel: " << name << " cannot offload the array not allocated from a MetalMemoryResource");
+    }
+}
+
+void MetalArrayKernel::build()
+{
+    std::lock_guard<std::mutex> const lock(m_build_mutex);
+    if (nullptr != m_sum)
+    {
+        return;
+    }
+    MTL::Device * device = MetalManager::instance().device();
+    if (nullptr == device)
+    {
+        throw std::runtime_error("MetalArrayKernel: no Metal device");
+    }
+    NS::AutoreleasePool * pool = NS::AutoreleasePool::alloc()->init();
+    MTL::CompileOptions * options = MTL::CompileOptions::alloc()->init();
+    options->setFastMathEnabled(false);
+    NS::Error * error = nullptr;
+    MTL::Library * library = device->newLibrary(NS::String::string(ARRAY_METAL_SOURCE, NS::UTF8StringEncoding), options, &error);
+    options->release();
+    if (nullptr == library)
+    {
+        std::string const message = error->localizedDescription()->utf8String();
+        pool->release();
+        throw std::runtime_error(Formatter() << "MetalArrayKernel: cannot compile the kernels: " << message);
+    }
+    std::pair<MTL::ComputePipelineState **, char const *> const pipelines[] = {
+        {&m_fill, "array_fill"},
+        {&m_axpby, "array_axpby"},
+        {&m_min, "array_min"},
+        {&m_max, "array_max"},
+        // Last, for m_sum to tell that all the pipelines are built.
+        {&m_sum, "array_sum"}};
+    try
+    {
+        for (auto const & [pipeline, name] : pipelines)
+        {
+            if (nullptr == *pipeline)
+            {
+                *pipeline = make_pipeline(device, library, name);
+            }
+        }
+    }
+    catch (...)
+    {
+        library->release();
+        pool->release();
+        throw;
+    }
+    library->release();
+    pool->release();
+}
+
+template <typename F>
+void MetalArrayKernel::run(F && encode)
+{
+    build();
+    NS::AutoreleasePool * pool = NS::AutoreleasePool::alloc()->init();
+    MTL::CommandBuffer * command = MetalManager::instance().queue()->commandBuffer();
+    MTL::ComputeCommandEncoder * encoder = command->computeCommandEncoder();
+    encode(encoder);
+    encoder->endEncoding();
+    command->commit();
+    command->waitUntilCompleted();
+    bool const failed = MTL::CommandBufferStatusError == command->status();
+    pool->release();
+    if (failed)
+    {
+        throw std::runtime_error("MetalArrayKernel: the command buffer failed");
+    }
+}
+
+void MetalArrayKernel::fill(SimpleArray<float> & arr, float value, bool offload)
+{
+    if (!offload)
+    {
+        arr.fill(value, cpu_parallel(arr.size()));
+        return;
+    }
+    check_runnable("fill", arr);
+    std::pair<MTL::Buffer *, size_t> const found = locate(arr);
+    auto const n = static_cast<uint32_t>(arr.size());
+    run(
+        [&](MTL::ComputeCommandEncoder * encoder)
+        {
+            encoder->setComputePipelineState(m_fill);
+            encoder->setBuffer(found.first, found.second, 0);
+            encoder->setBytes(&value, sizeof(value), 1);
+            encoder->setBytes(&n, sizeof(n), 2);
+            encoder->dispatchThreadgroups(MTL::Size(group_count(n), 1, 1), MTL::Size(THREADGROUP_SIZE, 1, 1));
+        });
+    arr.bump_epoch();
+}
+
+void MetalArrayKernel::fill(SimpleArray<double> & arr, double value, bool offload)
+{
+    if (offload)
+    {
+        check_runnable("fill", arr);
+    }
+    arr.fill(value, cpu_parallel(arr.size()));
+}
+
+void MetalArrayKernel::axpby(float a, SimpleArray<float> const & x, float b, SimpleArray<float> & y, bool offload)
+{
+    if (x.shape() != y.shape())
+    {
+        throw std::invalid_argument("MetalArrayKernel: axpby takes x and y of the same shape");
+    }
+    if (!offload)
+    {
+        float const * px = x.data();
+        float * py = y.data();
+        parallel_for_chunks(
+            y.size(),
+            cpu_parallel(y.size()),
+            [=](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    py[i] = a * px[i] + b * py[i];
+                }
+            });
+        y.bump_epoch();
+        return;
+    }
+    check_runnable("axpby", x, y);
+    std::pair<MTL::Buffer *, size_t> const fx = locate(x);
+    std::pair<MTL::Buffer *, size_t> const fy = locate(y);
+    float const ab[2] = {a, b};
+    auto const n = static_cast<uint32_t>(y.size());
+    run(
+        [&](MTL::ComputeCommandEncoder * encoder)
+        {
+            encoder->setComputePipelineState(m_axpby);
+            encoder->setBuffer(fx.first, fx.second, 0);
+            encoder->setBuffer(fy.first, fy.second, 1);
+            encoder->setBytes(ab, sizeof(ab), 2);
+            encoder->setBytes(&n, sizeof(n), 3);
+            encoder->dispatchThreadgroups(MTL::Size(group_count(n), 1, 1), MTL::Size(THREADGROUP_SIZE, 1, 1));
+        });
+    y.bump_epoch();
+}
+
+void MetalArrayKernel::axpby(double a, SimpleArray<double> const & x, double b, SimpleArray<double> & y, bool offload)
+{
+    if (x.shape() != y.shape())
+    {
+        throw std::invalid_argument("MetalArrayKernel: axpby takes x and y of the same shape");
+    }
+    if (offload)
+    {
+        check_runnable("axpby", x, y);
+    }
+    double const * px = x.data();
+    double * py = y.data();
+    parallel_for_chunks(
+        y.size(),
+        cpu_parallel(y.size()),
+        [=](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                py[i] = a * px[i] + b * py[i];
+            }
+        });
+    y.bump_epoch();
+}
+
+float MetalArrayKernel::reduce(SimpleArray<float> const & arr, float initial, ReduceOp op)
+{
+    std::pair<MTL::Buffer *, size_t> const found = locate(arr);
+    auto const n = static_cast<uint32_t>(arr.size());
+    size_t const ngroup = std::min(group_count(n), REDUCE_NGROUP_MAX);
+    MTL::Buffer * partial = MetalManager::instance().device()->newBuffer(ngroup * sizeof(float), MTL::ResourceStorageModeShared);
+    if (nullptr == partial)
+    {
+        throw std::bad_alloc();
+    }
+    try
+    {
+        run(
+            [&](MTL::ComputeCommandEncoder * encoder)
+            {
+                encoder->setComputePipelineState(ReduceOp::MIN == op ? m_min : (ReduceOp::MAX == op ? m_max : m_sum));
+                encoder->setBuffer(found.first, found.second, 0);
+                encoder->setBuffer(partial, 0, 1);
+                encoder->setBytes(&n, sizeof(n), 2);
+                encoder->dispatchThreadgroups(MTL::Size(ngroup, 1, 1), MTL::Size(THREADGROUP_SIZE, 1, 1));
+            });
+    }
+    catch (...)
+    {
+        partial->release();
+        throw;
+    }
+    auto const * values = static_cast<float const *>(partial->contents());
+    float ret = initial;
+    for (size_t it = 0; it < ngroup; ++it)
+    {
+        if (ReduceOp::MIN == op)
+        {
+            ret = values[it] < ret ? values[it] : ret;
+        }
+        else if (ReduceOp::MAX == op)
+        {
+            ret = values[it] > ret ? values[it] : ret;
+        }
+        else
+        {
+            ret += values[it];
+        }
+    }
+    partial->release();
+    return ret;
+}
+
+float MetalArrayKernel::min(SimpleArray<float> const & arr, float initial, bool offload)
+{
+    if (!offload)
+    {
+        return arr.min(initial, cpu_parallel(arr.size()));
+    }
+    check_runnable("min", arr);
+    return reduce(arr, initial, ReduceOp::MIN);
+}
+
+double MetalArrayKernel::min(SimpleArray<double> const & arr, double initial, bool offload)
+{
+    if (offload)
+    {
+        check_runnable("min", arr);
+    }
+    return arr.min(initial, cpu_parallel(arr.size()));
+}
+
+float MetalArrayKernel::max(SimpleArray<float> const & arr, float initial, bool offload)
+{
+    if (!offload)
+    {
+        return arr.max(initial, cpu_parallel(arr.size()));
+    }
+    check_runnable("max", arr);
+    return reduce(arr, initial, ReduceOp::MAX);
+}
+
+double MetalArrayKernel::max(SimpleArray<double> const & arr, double initial, bool offload)
+{
+    if (offload)
+    {
+        check_runnable("max", arr);
+    }
+    return arr.max(initial, cpu_parallel(arr.size()));
+}
+
+float MetalArrayKernel::sum(SimpleArray<float> const & arr, float initial, bool offload)
+{
+    if (!offload)
+    {
+        return arr.sum(initial, cpu_parallel(arr.size()));
+    }
+    check_runnable("sum", arr);
+    return reduce(arr, initial, ReduceOp::SUM);
+}
+
+double MetalArrayKernel::sum(SimpleArray<double> const & arr, double initial, bool offload)
+{
+    if (offload)
+    {
+        check_runnable("sum", arr);
+    }
+    return arr.sum(initial, cpu_parallel(arr.size()));
+}
+
+} /* end namespace device */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,153 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/device/metal/MetalMemoryResource.hpp>
+
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+// forward declaration.
+namespace MTL
+{
+class Buffer;
+class ComputeCommandEncoder;
+class ComputePipelineState;
+} /* end namespace MTL */
+
+namespace modmesh
+{
+
+namespace device
+{
+
+/**
+ * Element-wise operations and reductions of SimpleArray with Metal compute
+ * kernels.  The kernels take the arrays allocated from a MetalMemoryResource
+ * in place, and the results are seen by the CPU when a call returns.
+ *
+ * Each operation takes whether to offload it to the GPU; offloadable()
+ * tells the default: the array is in float32, in a Metal buffer, and has at
+ * least threshold() elements, below which a command buffer costs more than
+ * the CPU loop.  Otherwise the operation runs in the thread pool as
+ * SimpleArray does.  The GPU does not calculate in double, so the arrays of
+ * double always run on the CPU.  A reduction on the GPU sums in a different
+ * order from the CPU and the float results may differ in the last bits.
+ */
+class MetalArrayKernel
+{
+
+public:
+
+    static constexpr size_t DEFAULT_THRESHOLD = 1 << 18;
+
+    static MetalArrayKernel & instance();
+
+    MetalArrayKernel(MetalArrayKernel const &) = delete;
+    MetalArrayKernel(MetalArrayKernel &&) = delete;
+    MetalArrayKernel & operator=(MetalArrayKernel const &) = delete;
+    MetalArrayKernel & operator=(MetalArrayKernel &&) = delete;
+    ~MetalArrayKernel();
+
+    size_t threshold() const { return m_threshold.load(std::memory_order_relaxed); }
+    void set_threshold(size_t value) { m_threshold.store(value, std::memory_order_relaxed); }
+
+    /// Whether the operations on the arrays default to the GPU.
+    template <typename T, typename... Arrays>
+    bool offloadable(SimpleArray<T> const & arr, Arrays const &... others) const
+    {
+        return arr.size() >= threshold() && runnable(arr, others...);
+    }
+
+    /// Set all the elements, ghost included, to the value.
+    void fill(SimpleArray<float> & arr, float value, bool offload);
+    void fill(SimpleArray<double> & arr, double value, bool offload);
+
+    /// y = a * x + b * y for the elements of the same shape.
+    void axpby(float a, SimpleArray<float> const & x, float b, SimpleArray<float> & y, bool offload);
+    void axpby(double a, SimpleArray<double> const & x, double b, SimpleArray<double> & y, bool offload);
+
+    // The reductions of all the elements with the initial value, as SimpleArray::min(), max(), and sum().
+    float min(SimpleArray<float> const & arr, float initial, bool offload);
+    double min(SimpleArray<double> const & arr, double initial, bool offload);
+    float max(SimpleArray<float> const & arr, float initial, bool offload);
+    double max(SimpleArray<double> const & arr, double initial, bool offload);
+    float sum(SimpleArray<float> const & arr, float initial, bool offload);
+    double sum(SimpleArray<double> const & arr, double initial, bool offload);
+
+private:
+
+    enum class ReduceOp
+    {
+        MIN,
+        MAX,
+        SUM
+    }; /* end enum class ReduceOp */
+
+    MetalArrayKernel();
+
+    static bool runnable(SimpleArray<double> const &) { return false; }
+    template <typename... Arrays>
+    static bool runnable(SimpleArray<float> const & arr, Arrays const &... others)
+    {
+        // The kernels index in 32 bits.
+        return arr.size() <= std::numeric_limits<uint32_t>::max() && nullptr != locate(arr).first && runnable(others...);
+    }
+    static bool runnable() { return true; }
+
+    /// The Metal buffer and the offset of the array, or null when it is not allocated from a MetalMemoryResource.
+    static std::pair<MTL::Buffer *, size_t> locate(SimpleArray<float> const & arr);
+
+    /// Throw std::invalid_argument unless the arrays can be offloaded.
+    template <typename T, typename... Arrays>
+    static void check_runnable(char const * name, SimpleArray<T> const & arr, Arrays const &... others);
+
+    // Compile the kernels at the first offloaded call.
+    void build();
+    template <typename F>
+    void run(F && encode);
+    float reduce(SimpleArray<float> const & arr, float initial, ReduceOp op);
+
+    std::atomic<size_t> m_threshold{DEFAULT_THRESHOLD};
+    std::mutex m_build_mutex;
+    MTL::ComputePipelineState * m_fill = nullptr;
+    MTL::ComputePipelineState * m_axpby = nullptr;
+    MTL::ComputePipelineState * m_min = nullptr;
+    MTL::ComputePipelineState * m_max = nullptr;
+    MTL::ComputePipelineState * m_sum = nullptr;
+
+}; /* end class MetalArrayKernel */
+
+} /* end namespace device */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#include <Metal/Metal.hpp>
+#pragma GCC diagnostic pop
+
+#include <modmesh/device/metal/MetalMemoryResource.hpp>
+#include <modmesh/device/metal/metal.hpp>
+
+namespace modmesh
+{
+
+namespace device
+{
+
+std::pair<MTL::Buffer *, size_t> MetalMemoryResource::find(void const * p) const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    auto const * ptr = static_cast<int8_t const *>(p);
+    auto it = m_buffers.upper_bound(ptr);
+    if (it != m_buffers.begin())
+    {
+        --it;
+        size_t const offset = static_cast<size_t>(ptr - it->first);
+        if (offset < it->second->length())
+        {
+            return {it->second, offset};
+        }
+    }
+    throw std::invalid_argument("MetalMemoryResource: the address is not allocated from the resource");
+}
+
+int8_t * MetalMemoryResource::do_allocate(size_t nbytes, size_t alignment)
+{
+    MTL::Device * device = MetalManager::instance().device();
+    if (nullptr == device)
+    {
+        throw std::runtime_error("MetalMemoryResource: no Metal device");
+    }
+    MTL::Buffer * buffer = device->newBuffer(nbytes, MTL::ResourceStorageModeShared);
+    if (nullptr == buffer)
+    {
+        throw std::bad_alloc();
+    }
+    auto * ret = static_cast<int8_t *>(buffer->contents());
+    // The contents are page-aligned.
+    if (0 != alignment && 0 != reinterpret_cast<uintptr_t>(ret) % alignment)
+    {
+        buffer->release();
+        throw std::invalid_argument(Formatter() << "MetalMemoryResource: alignment " << alignment << " is not supported");
+    }
+    m_buffers.emplace(ret, buffer);
+    record_upstream_allocate(nbytes);
+    return ret;
+}
+
+void MetalMemoryResource::do_deallocate(int8_t * p, size_t nbytes, size_t)
+{
+    auto it = m_buffers.find(p);
+    it->second->release();
+    m_buffers.erase(it);
+    record_upstream_deallocate(nbytes);
+}
+
+} /* end namespace device */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
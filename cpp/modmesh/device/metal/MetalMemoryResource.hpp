@@ -0,0 +1,95 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/buffer/buffer.hpp>
+
+#include <map>
+#include <memory>
+#include <utility>
+
+// forward declaration.
+namespace MTL
+{
+class Buffer;
+} /* end namespace MTL */
+
+namespace modmesh
+{
+
+namespace device
+{
+
+/**
+ * Allocate each block as a Metal buffer in the shared storage mode.  The
+ * unified memory of Apple silicon is then read and written by both the CPU
+ * and the GPU in place, and the kernels take the arrays without copying.
+ * Make the resource current (MemoryResourceScope) while constructing the
+ * arrays to be used by the kernels.
+ */
+class MetalMemoryResource
+    : public MemoryResource
+{
+
+public:
+
+    static std::shared_ptr<MetalMemoryResource> construct() { return std::make_shared<MetalMemoryResource>(); }
+
+    MetalMemoryResource() = default;
+    MetalMemoryResource(MetalMemoryResource const &) = delete;
+    MetalMemoryResource(MetalMemoryResource &&) = delete;
+    MetalMemoryResource & operator=(MetalMemoryResource const &) = delete;
+    MetalMemoryResource & operator=(MetalMemoryResource &&) = delete;
+    ~MetalMemoryResource() override = default;
+
+    char const * name() const override { return "MetalMemoryResource"; }
+
+    /**
+     * The Metal buffer holding the address p and the offset of p in it.
+     * Throw std::invalid_argument if p is not allocated from the resource.
+     */
+    std::pair<MTL::Buffer *, size_t> find(void const * p) const;
+
+protected:
+
+    int8_t * do_allocate(size_t nbytes, size_t alignment) override;
+    void do_deallocate(int8_t * p, size_t nbytes, size_t alignment) override;
+
+private:
+
+    // Keyed by the start address, to find the block holding an address.
+    std::map<int8_t const *, MTL::Buffer *> m_buffers;
+
+}; /* end class MetalMemoryResource */
+
+} /* end namespace device */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,496 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#include <Metal/Metal.hpp>
+#pragma GCC diagnostic pop
+
+#include <modmesh/device/metal/StaticMeshMetal.hpp>
+#include <modmesh/device/metal/metal.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace modmesh
+{
+
+namespace device
+{
+
+namespace
+{
+
+// The kernels follow StaticMesh::calc_metric() without the in-center, with
+// the 2D vectors padded by a zero z component.  They are compiled from the
+// source at the first call, as the kernels of Euler1DMetal.
+constexpr char const * MESH_METAL_SOURCE = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+struct MeshMetricShape
+{
+    uint ndim;
+    uint nface;
+    uint ncell;
+    uint fcnds_width;
+    uint clnds_width;
+    uint clfcs_width;
+};
+
+float3 load(device float const * arr, uint ndim, int irow)
+{
+    device float const * row = arr + uint(irow) * ndim;
+    return float3(row[0], row[1], 3 == ndim ? row[2] : 0.0f);
+}
+
+void store(device float * arr, uint ndim, uint irow, float3 value)
+{
+    device float * row = arr + irow * ndim;
+    row[0] = value.x;
+    row[1] = value.y;
+    if (3 == ndim)
+    {
+        row[2] = value.z;
+    }
+}
+
+kernel void mesh_face_metric(
+    device float const * ndcrd [[buffer(0)]],
+    device int const * fcnds [[buffer(1)]],
+    device float * fccnd [[buffer(2)]],
+    device float * fcnml [[buffer(3)]],
+    device float * fcara [[buffer(4)]],
+    constant MeshMetricShape & shape [[buffer(5)]],
+    uint ifc [[thread_position_in_grid]])
+{
+    if (ifc >= shape.nface)
+    {
+        return;
+    }
+    uint const ndim = shape.ndim;
+    device int const * nds = fcnds + ifc * shape.fcnds_width;
+    if (2 == ndim)
+    {
+        // 2D faces are always lines.
+        float3 const p1 = load(ndcrd, ndim, nds[1]);
+        float3 const p2 = load(ndcrd, ndim, nds[2]);
+        store(fccnd, ndim, ifc, (p1 + p2) / 2.0f);
+        float3 const nml = float3(p2.y - p1.y, p1.x - p2.x, 0.0f);
+        float const ara = sqrt(nml.x * nml.x + nml.y * nml.y);
+        store(fcnml, ndim, ifc, nml / ara);
+        fcara[ifc] = ara;
+        return;
+    }
+    uint const nnd = uint(nds[0]);
+    // find averaged point.
+    float3 ctr = float3(0.0f);
+    for (uint inf = 1; inf <= nnd; ++inf)
+    {
+        ctr += load(ndcrd, ndim, nds[inf]);
+    }
+    ctr /= float(nnd);
+    // weight the centers of the triangles with the averaged point by area.
+    float3 crd = float3(0.0f);
+    float voc = 0.0f;
+    for (uint inf = 1; inf <= nnd; ++inf)
+    {
+        float3 const pu = load(ndcrd, ndim, nds[inf]);
+        float3 const pv = load(ndcrd, ndim, nds[nnd == inf ? 1 : inf + 1]);
+        float3 const dw = cross(pu - ctr, pv - ctr);
+        float const vob = sqrt(dw.x * dw.x + dw.y * dw.y + dw.z * dw.z);
+        crd += (ctr + pu + pv) / 3.0f * vob;
+        voc += vob;
+    }
+    crd /= voc;
+    store(fccnd, ndim, ifc, crd);
+    // sum the cross products of the radial vectors, starting from the last
+    // and the first.
+    float3 nml = float3(0.0f);
+    float3 rprev = load(ndcrd, ndim, nds[nnd]) - crd;
+    for (uint inf = 1; inf <= nnd; ++inf)
+    {
+        float3 const rcur = load(ndcrd, ndim, nds[inf]) - crd;
+        nml += cross(rprev, rcur);
+        rprev = rcur;
+    }
+    float const ara = sqrt(nml.x * nml.x + nml.y * nml.y + nml.z * nml.z);
+    store(fcnml, ndim, ifc, nml / ara);
+    fcara[ifc] = ara / 2.0f;
+}
+
+kernel void mesh_cell_metric(
+    device float const * ndcrd [[buffer(0)]],
+    device int const * clnds [[buffer(1)]],
+    device int const * clfcs [[buffer(2)]],
+    device float const * fccnd [[buffer(3)]],
+    device float const * fcnml [[buffer(4)]],
+    device float const * fcara [[buffer(5)]],
+    device float * clcnd [[buffer(6)]],
+    device float * clvol [[buffer(7)]],
+    device char * volsgn [[buffer(8)]],
+    constant MeshMetricShape & shape [[buffer(9)]],
+    uint icl [[thread_position_in_grid]])
+{
+    if (icl >= shape.ncell)
+    {
+        return;
+    }
+    uint const ndim = shape.ndim;
+    device int const * nds = clnds + icl * shape.clnds_width;
+    device int const * fcs = clfcs + icl * shape.clfcs_width;
+    // averaged point.
+    uint const nnd = uint(nds[0]);
+    float3 ctr = float3(0.0f);
+    for (uint inc = 1; inc <= nnd; ++inc)
+    {
+        ctr += load(ndcrd, ndim, nds[inc]);
+    }
+    ctr /= float(nnd);
+    // weight centroid.
+    uint const nfc = uint(fcs[0]);
+    float3 crd = float3(0.0f);
+    float voc = 0.0f;
+    for (uint ifl = 1; ifl <= nfc; ++ifl)
+    {
+        int const ifc = fcs[ifl];
+        float3 const fc = load(fccnd, ndim, ifc);
+        float3 const du = ctr - fc;
+        float const vob = abs(dot(du, load(fcnml, ndim, ifc))) * fcara[ifc];
+        voc += vob;
+        crd += (fc + du / float(ndim + 1)) * vob;
+    }
+    crd /= voc;
+    store(clcnd, ndim, icl, crd);
+    // volume and the signs of the volumes associated with the faces.
+    float vol = 0.0f;
+    device char * sgn = volsgn + icl * (shape.clfcs_width - 1);
+    for (uint ifl = 1; ifl <= nfc; ++ifl)
+    {
+        int const ifc = fcs[ifl];
+        float const fcvol = dot(load(fccnd, ndim, ifc) - crd, load(fcnml, ndim, ifc)) * fcara[ifc];
+        sgn[ifl - 1] = fcvol < 0.0f ? -1 : (fcvol > 0.0f ? 1 : 0);
+        vol += abs(fcvol);
+    }
+    clvol[icl] = vol / float(ndim);
+}
+)";
+
+constexpr size_t THREADGROUP_SIZE = 256;
+
+// MeshMetricShape of the kernel source.
+struct MeshMetricShape
+{
+    uint32_t ndim;
+    uint32_t nface;
+    uint32_t ncell;
+    uint32_t fcnds_width;
+    uint32_t clnds_width;
+    uint32_t clfcs_width;
+}; /* end struct MeshMetricShape */
+
+MTL::ComputePipelineState * make_pipeline(MTL::Device * device, MTL::Library * library, char const * name)
+{
+    MTL::Function * function = library->newFunction(NS::String::string(name, NS::UTF8StringEncoding));
+    if (nullptr == function)
+    {
+        throw std::runtime_error(Formatter() << "StaticMeshMetal: kernel " << name << " is not found");
+    }
+    NS::Error * error = nullptr;
+    MTL::ComputePipelineState * ret = device->newComputePipelineState(function, &error);
+    function->release();
+    if (nullptr == ret)
+    {
+        throw std::runtime_error(Formatter() << "StaticMeshMetal: cannot create the pipeline of " << name << ": "
+                                             << error->localizedDescription()->utf8String());
+    }
+    if (ret->maxTotalThreadsPerThreadgroup() < THREADGROUP_SIZE)
+    {
+        ret->release();
+        throw std::runtime_error(Formatter() << "StaticMeshMetal: kernel " << name << " cannot run "
+                                             << THREADGROUP_SIZE << " threads in a threadgroup");
+    }
+    return ret;
+}
+
+void dispatch(MTL::ComputeCommandEncoder * encoder, size_t nthread)
+{
+    size_t const ngroup = (nthread + THREADGROUP_SIZE - 1) / THREADGROUP_SIZE;
+    encoder->dispatchThreadgroups(MTL::Size(ngroup, 1, 1), MTL::Size(THREADGROUP_SIZE, 1, 1));
+}
+
+// The shared buffers of a call, released when it returns.
+class SharedBuffers
+{
+
+public:
+
+    explicit SharedBuffers(MTL::Device * device)
+        : m_device(device)
+    {
+    }
+
+    SharedBuffers(SharedBuffers const &) = delete;
+    SharedBuffers(SharedBuffers &&) = delete;
+    SharedBuffers & operator=(SharedBuffers const &) = delete;
+    SharedBuffers & operator=(SharedBuffers &&) = delete;
+
+    ~SharedBuffers()
+    {
+        for (MTL::Buffer * buffer : m_buffers)
+        {
+            buffer->release();
+        }
+    }
+
+    template <typename T>
+    MTL::Buffer * make(size_t nelem)
+    {
+        // Metal does not make an empty buffer.
+        MTL::Buffer * ret = m_device->newBuffer(std::max(nelem * sizeof(T), sizeof(T)), MTL::ResourceStorageModeShared);
+        if (nullptr == ret)
+        {
+            throw std::runtime_error(Formatter() << "StaticMeshMetal: cannot allocate a buffer of " << nelem * sizeof(T) << " bytes");
+        }
+        m_buffers.push_back(ret);
+        return ret;
+    }
+
+    /// Copy the body of the array into a new buffer, converting the values to T.
+    template <typename T, typename U>
+    MTL::Buffer * make(SimpleArray<U> const & arr, size_t nelem)
+    {
+        MTL::Buffer * ret = make<T>(nelem);
+        U const * src = arr.body();
+        T * dst = static_cast<T *>(ret->contents());
+        parallel_for_chunks(
+            nelem,
+            ThreadPool::instance().use_parallel(nelem),
+            [&](size_t begin, size_t end)
+            {
+                for (size_t it = begin; it < end; ++it)
+                {
+                    dst[it] = static_cast<T>(src[it]);
+                }
+            });
+        return ret;
+    }
+
+private:
+
+    MTL::Device * m_device;
+    std::vector<MTL::Buffer *> m_buffers;
+
+}; /* end class SharedBuffers */
+
+/// Copy the buffer back into the body of the array, converting the values to double.
+void copy_back(MTL::Buffer * buffer, SimpleArray<double> & arr, size_t nelem)
+{
+    auto const * src = static_cast<float const *>(buffer->contents());
+    double * dst = arr.body();
+    parallel_for_chunks(
+        nelem,
+        ThreadPool::instance().use_parallel(nelem),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t it = begin; it < end; ++it)
+            {
+                dst[it] = static_cast<double>(src[it]);
+            }
+        });
+}
+
+} /* end namespace */
+
+StaticMeshMetal & StaticMeshMetal::instance()
+{
+    static StaticMeshMetal o;
+    return o;
+}
+
+StaticMeshMetal::~StaticMeshMetal()
+{
+    for (MTL::ComputePipelineState * pipeline : {m_face_metric, m_cell_metric})
+    {
+        if (nullptr != pipeline)
+        {
+            pipeline->release();
+        }
+    }
+}
+
+void StaticMeshMetal::build()
+{
+    std::lock_guard<std::mutex> const lock(m_build_mutex);
+    if (nullptr != m_cell_metric)
+    {
+        return;
+    }
+    MTL::Device * device = MetalManager::instance().device();
+    if (nullptr == device)
+    {
+        throw std::runtime_error("StaticMeshMetal: no Metal device");
+    }
+    NS::AutoreleasePool * pool = NS::AutoreleasePool::alloc()->init();
+    MTL::CompileOptions * options = MTL::CompileOptions::alloc()->init();
+    options->setFastMathEnabled(false);
+    NS::Error * error = nullptr;
+    MTL::Library * library = device->newLibrary(NS::String::string(MESH_METAL_SOURCE, NS::UTF8StringEncoding), options, &error);
+    options->release();
+    if (nullptr == library)
+    {
+        std::string const message = error->localizedDescription()->utf8String();
+        pool->release();
+        throw std::runtime_error(Formatter() << "StaticMeshMetal: cannot compile the kernels: " << message);
+    }
+    try
+    {
+        if (nullptr == m_face_metric)
+        {
+            m_face_metric = make_pipeline(device, library, "mesh_face_metric");
+        }
+        // Last, for m_cell_metric to tell that all the pipelines are built.
+        m_cell_metric = make_pipeline(device, library, "mesh_cell_metric");
+    }
+    catch (...)
+    {
+        library->release();
+        pool->release();
+        throw;
+    }
+    library->release();
+    pool->release();
+}
+
+void StaticMeshMetal::calc_metric(StaticMesh & mesh)
+{
+    size_t const ndim = mesh.ndim();
+    size_t const nnode = mesh.nnode();
+    size_t const nface = mesh.nface();
+    size_t const ncell = mesh.ncell();
+    if (2 != ndim && 3 != ndim)
+    {
+        throw std::invalid_argument(Formatter() << "StaticMeshMetal: calc_metric takes a 2D or 3D mesh, not " << ndim << "D");
+    }
+    if (mesh.use_incenter())
+    {
+        throw std::invalid_argument("StaticMeshMetal: calc_metric does not support the in-center of simplices");
+    }
+    if (0 != ncell && 0 == nface)
+    {
+        throw std::runtime_error("StaticMeshMetal: calc_metric must be called after build_interior");
+    }
+    if (0 == ncell)
+    {
+        return;
+    }
+    MeshMetricShape shape{};
+    shape.ndim = static_cast<uint32_t>(ndim);
+    shape.nface = static_cast<uint32_t>(nface);
+    shape.ncell = static_cast<uint32_t>(ncell);
+    shape.fcnds_width = static_cast<uint32_t>(mesh.fcnds().shape(1));
+    shape.clnds_width = static_cast<uint32_t>(mesh.clnds().shape(1));
+    shape.clfcs_width = static_cast<uint32_t>(mesh.clfcs().shape(1));
+    // The kernels index in 32 bits.
+    for (size_t const nelem : {nnode * ndim, nface * shape.fcnds_width, ncell * shape.clnds_width, ncell * shape.clfcs_width})
+    {
+        if (nelem > std::numeric_limits<uint32_t>::max())
+        {
+            throw std::invalid_argument(Formatter() << "StaticMeshMetal: the mesh of " << nelem << " elements in an array is too large for the kernels");
+        }
+    }
+    build();
+
+    SharedBuffers buffers(MetalManager::instance().device());
+    MTL::Buffer * ndcrd = buffers.make<float>(mesh.ndcrd(), nnode * ndim);
+    MTL::Buffer * fcnds = buffers.make<int32_t>(mesh.fcnds(), nface * shape.fcnds_width);
+    MTL::Buffer * clnds = buffers.make<int32_t>(mesh.clnds(), ncell * shape.clnds_width);
+    MTL::Buffer * clfcs = buffers.make<int32_t>(mesh.clfcs(), ncell * shape.clfcs_width);
+    MTL::Buffer * fccnd = buffers.make<float>(nface * ndim);
+    MTL::Buffer * fcnml = buffers.make<float>(nface * ndim);
+    MTL::Buffer * fcara = buffers.make<float>(nface);
+    MTL::Buffer * clcnd = buffers.make<float>(ncell * ndim);
+    MTL::Buffer * clvol = buffers.make<float>(ncell);
+    MTL::Buffer * volsgn = buffers.make<int8_t>(ncell * StaticMesh::CLMFC);
+
+    NS::AutoreleasePool * pool = NS::AutoreleasePool::alloc()->init();
+    MTL::CommandBuffer * command = MetalManager::instance().queue()->commandBuffer();
+    // The dispatches of a serial encoder see the writes of the previous ones,
+    // so the cells take the face metric of the first dispatch.
+    MTL::ComputeCommandEncoder * encoder = command->computeCommandEncoder();
+    encoder->setComputePipelineState(m_face_metric);
+    encoder->setBuffer(ndcrd, 0, 0);
+    encoder->setBuffer(fcnds, 0, 1);
+    encoder->setBuffer(fccnd, 0, 2);
+    encoder->setBuffer(fcnml, 0, 3);
+    encoder->setBuffer(fcara, 0, 4);
+    encoder->setBytes(&shape, sizeof(shape), 5);
+    dispatch(encoder, nface);
+    encoder->setComputePipelineState(m_cell_metric);
+    encoder->setBuffer(ndcrd, 0, 0);
+    encoder->setBuffer(clnds, 0, 1);
+    encoder->setBuffer(clfcs, 0, 2);
+    encoder->setBuffer(fccnd, 0, 3);
+    encoder->setBuffer(fcnml, 0, 4);
+    encoder->setBuffer(fcara, 0, 5);
+    encoder->setBuffer(clcnd, 0, 6);
+    encoder->setBuffer(clvol, 0, 7);
+    encoder->setBuffer(volsgn, 0, 8);
+    encoder->setBytes(&shape, sizeof(shape), 9);
+    dispatch(encoder, ncell);
+    encoder->endEncoding();
+    command->commit();
+    command->waitUntilCompleted();
+    bool const failed = MTL::CommandBufferStatusError == command->status();
+    pool->release();
+    if (failed)
+    {
+        throw std::runtime_error("StaticMeshMetal: the command buffer failed");
+    }
+
+    copy_back(fccnd, mesh.fccnd(), nface * ndim);
+    copy_back(fcnml, mesh.fcnml(), nface * ndim);
+    copy_back(fcara, mesh.fcara(), nface);
+    copy_back(clcnd, mesh.clcnd(), ncell * ndim);
+    copy_back(clvol, mesh.clvol(), ncell);
+    auto const * sgn = static_cast<int8_t const *>(volsgn->contents());
+    mesh.orient_faces(std::vector<int8_t>(sgn, sgn + ncell * StaticMesh::CLMFC), nullptr, nullptr);
+    // The orientation may have flipped the nodes of the faces.
+    mesh.m_fcnds_csr.reset();
+    if (mesh.soa())
+    {
+        mesh.sync_soa();
+    }
+}
+
+} /* end namespace device */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,95 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMesh.hpp>
+
+#include <mutex>
+
+// forward declaration.
+namespace MTL
+{
+class ComputePipelineState;
+} /* end namespace MTL */
+
+namespace modmesh
+{
+
+namespace device
+{
+
+/**
+ * Calculate the metric of the body faces and cells of a StaticMesh with
+ * Metal compute kernels: fccnd, fcnml and fcara from ndcrd and fcnds by a
+ * thread per face, and then clcnd and clvol from clnds and clfcs by a thread
+ * per cell.  The faces are oriented on the CPU from the signs of the volumes
+ * the GPU computes, as StaticMesh::calc_metric() does.
+ *
+ * The GPU does not calculate in double, so the coordinates are copied into
+ * float32 buffers and the results back into the double arrays of the mesh.
+ * The results match the CPU within a relative error of about 1e-5, i.e., a
+ * few units in the last place of float32, with respect to the extent of the
+ * coordinates.  A face of which the volume with a cell is close to zero
+ * within the error may be oriented differently.  The in-center of simplices
+ * (StaticMesh::use_incenter()) is not supported.
+ */
+class StaticMeshMetal
+{
+
+public:
+
+    static StaticMeshMetal & instance();
+
+    StaticMeshMetal(StaticMeshMetal const &) = delete;
+    StaticMeshMetal(StaticMeshMetal &&) = delete;
+    StaticMeshMetal & operator=(StaticMeshMetal const &) = delete;
+    StaticMeshMetal & operator=(StaticMeshMetal &&) = delete;
+    ~StaticMeshMetal();
+
+    /// Recalculate the metric of the body of the 2D or 3D mesh after build_interior().
+    void calc_metric(StaticMesh & mesh);
+
+private:
+
+    StaticMeshMetal() = default;
+
+    // Compile the kernels at the first call.
+    void build();
+
+    std::mutex m_build_mutex;
+    MTL::ComputePipelineState * m_face_metric = nullptr;
+    MTL::ComputePipelineState * m_cell_metric = nullptr;
+
+}; /* end class StaticMeshMetal */
+
+} /* end namespace device */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -54,10 +54,23 @@ void MetalManager::startup()
     {
         m_device = MTL::CreateSystemDefaultDevice();
     }
+#ifdef MODMESH_METAL_KERNELS
+    if (nullptr != m_device && nullptr == m_queue)
+    {
+        m_queue = m_device->newCommandQueue();
+    }
+#endif // MODMESH_METAL_KERNELS
 }
 
 void MetalManager::shutdown()
 {
+#ifdef MODMESH_METAL_KERNELS
+    if (nullptr != m_queue)
+    {
+        m_queue->release();
+        m_queue = nullptr;
+    }
+#endif // MODMESH_METAL_KERNELS
     if (nullptr != m_device)
     {
         m_device->release();
@@ -32,6 +32,7 @@
 namespace MTL
 {
 class Device;
+class CommandQueue;
 } /* end namespace MTL */
 
 namespace modmesh
@@ -57,11 +58,17 @@ public:
     bool started() { return nullptr != m_device; }
     void shutdown();
 
+    /// The system default device, or null when Metal is not available.
+    MTL::Device * device() const { return m_device; }
+    /// The queue shared by the kernels of modmesh, or null when they are not built.
+    MTL::CommandQueue * queue() const { return m_queue; }
+
 private:
 
     MetalManager() { startup(); }
 
     MTL::Device * m_device = nullptr;
+    MTL::CommandQueue * m_queue = nullptr;
 
 }; /* end class MetalManager */
 
@@ -36,6 +36,10 @@
 #include <modmesh/toggle/toggle.hpp>
 #include <modmesh/buffer/buffer.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+
 namespace modmesh
 {
 
@@ -47,6 +51,164 @@ class StaticGridBase : public SpaceBase<ND, int32_t, double>
 {
 }; /* end class StaticGridBase */
 
+namespace detail
+{
+
+/**
+ * Locate the interval of each point in the ascending coordinates: i for
+ * coord[i] <= x < coord[i+1], the last interval being closed, or -1 for a
+ * point outside [coord[0], coord[ncoord-1]].  A uniform grid takes the
+ * quotient of the spacing.  Otherwise a branchless binary search runs over a
+ * batch of points in lockstep, as the number of its steps depends only on
+ * ncoord, to overlap the loads of the batch.
+ */
+inline SimpleArray<int32_t> locate_intervals(double const * coord, size_t ncoord, SimpleArray<double> const & points, char const * name)
+{
+    if (1 != points.ndim())
+    {
+        throw std::invalid_argument(Formatter() << name << ": points must be 1D");
+    }
+    size_t const npoint = points.shape(0);
+    SimpleArray<int32_t> ret(npoint);
+    if (ncoord < 2)
+    {
+        ret.fill(-1);
+        return ret;
+    }
+    double const xmin = coord[0];
+    double const xmax = coord[ncoord - 1];
+    size_t const nlast = ncoord - 2;
+
+    // The quotient may be off by one where the spacing is off by a fraction
+    // of it; the comparisons below correct that.
+    double const dx = (xmax - xmin) / static_cast<double>(ncoord - 1);
+    bool uniform = dx > 0.0;
+    for (size_t it = 1; uniform && it < ncoord; ++it)
+    {
+        uniform = std::abs(coord[it] - (xmin + dx * static_cast<double>(it))) <= 1.e-6 * dx;
+    }
+
+    parallel_for_chunks(
+        npoint,
+        ThreadPool::instance().use_parallel(npoint),
+        [&](size_t begin, size_t end)
+        {
+            if (uniform)
+            {
+                double const rdx = 1.0 / dx;
+                for (size_t ipt = begin; ipt < end; ++ipt)
+                {
+                    double const x = points(ipt);
+                    if (!(x >= xmin && x <= xmax))
+                    {
+                        ret(ipt) = -1;
+                        continue;
+                    }
+                    size_t it = std::min(static_cast<size_t>((x - xmin) * rdx), nlast);
+                    if (x < coord[it])
+                    {
+                        --it;
+                    }
+                    else if (it < nlast && x >= coord[it + 1])
+                    {
+                        ++it;
+                    }
+                    ret(ipt) = static_cast<int32_t>(it);
+                }
+                return;
+            }
+            constexpr size_t BATCH = 16;
+            std::array<double, BATCH> xs; // NOLINT(cppcoreguidelines-pro-type-member-init)
+            std::array<size_t, BATCH> bases; // NOLINT(cppcoreguidelines-pro-type-member-init)
+            for (size_t ipt = begin; ipt < end; ipt += BATCH)
+            {
+                size_t const nbatch = std::min(BATCH, end - ipt);
+                for (size_t ib = 0; ib < BATCH; ++ib)
+                {
+                    // The tail of the batch repeats the last point.
+                    xs[ib] = points(ipt + std::min(ib, nbatch - 1));
+                    bases[ib] = 0;
+                }
+                for (size_t len = nlast + 1; len > 1; len -= len / 2)
+                {
+                    size_t const half = len / 2;
+                    for (size_t ib = 0; ib < BATCH; ++ib)
+                    {
+                        bases[ib] += coord[bases[ib] + half] <= xs[ib] ? half : 0;
+                    }
+                }
+                for (size_t ib = 0; ib < nbatch; ++ib)
+                {
+                    bool const inside = xs[ib] >= xmin && xs[ib] <= xmax;
+                    ret(ipt + ib) = inside ? static_cast<int32_t>(bases[ib]) : -1;
+                }
+            }
+        });
+    return ret;
+}
+
+/**
+ * Fill ncoord points from xmin to xmax, each interval ratio times the one
+ * before it; a ratio of 1 spaces them evenly, as numpy.linspace() does.  A
+ * point is calculated from its index alone, so that the chunks do not depend
+ * on each other, and the end points are exact.
+ */
+template <typename T>
+void fill_graded_coord(T * coord, size_t ncoord, T xmin, T xmax, T ratio, bool parallel, char const * name)
+{
+    if (ncoord < 2)
+    {
+        throw std::invalid_argument(Formatter() << name << ": ncoord " << ncoord << " smaller than 2");
+    }
+    if (!(xmin < xmax))
+    {
+        throw std::invalid_argument(Formatter() << name << ": xmin " << xmin << " >= xmax " << xmax);
+    }
+    if (!(ratio > T(0)))
+    {
+        throw std::invalid_argument(Formatter() << name << ": ratio " << ratio << " not positive");
+    }
+    size_t const nlast = ncoord - 1;
+    if (T(1) == ratio)
+    {
+        T const step = (xmax - xmin) / static_cast<T>(nlast);
+        parallel_for_chunks(
+            ncoord,
+            parallel,
+            [&](size_t begin, size_t end)
+            {
+                for (size_t it = begin; it < end; ++it)
+                {
+                    coord[it] = static_cast<T>(it) * step + xmin;
+                }
+            });
+    }
+    else
+    {
+        // x_i = xmin + (xmax - xmin) * (ratio^i - 1) / (ratio^nlast - 1),
+        // with expm1() for the ratios close to 1.
+        T const lr = std::log(ratio);
+        T const scale = (xmax - xmin) / std::expm1(lr * static_cast<T>(nlast));
+        if (!std::isfinite(scale) || T(0) == scale)
+        {
+            throw std::invalid_argument(Formatter() << name << ": ratio " << ratio << " to the power " << nlast << " out of range");
+        }
+        parallel_for_chunks(
+            ncoord,
+            parallel,
+            [&](size_t begin, size_t end)
+            {
+                for (size_t it = begin; it < end; ++it)
+                {
+                    coord[it] = xmin + scale * std::expm1(lr * static_cast<T>(it));
+                }
+            });
+    }
+    coord[nlast] = xmax;
+}
+
+} /* end namespace detail */
+
 /**
  * 1D grid whose coordnate ascends with index.
  */
@@ -87,6 +249,19 @@ public:
     value_type const * data() const { return m_coord.data(); }
     value_type * data() { return m_coord.data(); }
 
+    /**
+     * Find the interval of each point.
+     *
+     * @param[in] points coordinates in [npoint].
+     * @return           i for coord[i] <= x < coord[i+1], the last interval
+     *                   being closed, or -1 outside the grid.
+     */
+    SimpleArray<int32_t> locate(SimpleArray<value_type> const & points) const
+    {
+        MODMESH_TIME("AscendantGrid1d::locate");
+        return detail::locate_intervals(m_coord.data(), m_coord.size(), points, "AscendantGrid1d");
+    }
+
 private:
 
     array_type m_coord;
@@ -167,6 +342,19 @@ public:
         std::fill(m_coord.begin(), m_coord.end(), val);
     }
 
+    /**
+     * Find the interval of each point.
+     *
+     * @param[in] points coordinates in [npoint].
+     * @return           i for coord[i] <= x < coord[i+1], the last interval
+     *                   being closed, or -1 outside the grid.
+     */
+    SimpleArray<int32_t> locate(SimpleArray<value_type> const & points) const
+    {
+        MODMESH_TIME("StaticGrid1d::locate");
+        return detail::locate_intervals(m_coord.data(), m_coord.size(), points, "StaticGrid1d");
+    }
+
 private:
 
     serial_type m_nx = 0;
@@ -174,12 +362,349 @@ private:
 
 }; /* end class StaticGrid1d */
 
-class StaticGrid2d : public StaticGridBase<2>
+/**
+ * Storage of the values of a multi-dimensional grid.  RowMajor varies x the
+ * fastest.  Blocked stores the grid in bricks of BLOCK_SIZE points on each
+ * side, row-major inside a brick and among the bricks, so that the
+ * neighbors of a stencil are mostly in the same brick and the cache lines
+ * loaded for a brick are all used.  The bricks on the upper sides are
+ * padded.
+ */
+enum class StaticGridLayout
+{
+    RowMajor,
+    Blocked
+};
+
+/**
+ * Base class template of the 2D and 3D grids.  It holds the coordinates
+ * along each axis and the values at the points.
+ */
+template <uint8_t ND>
+class StaticGridMd : public StaticGridBase<ND>
 {
+
+public:
+
+    using value_type = double;
+    using array_type = SimpleArray<value_type>;
+    using shape_type = std::array<size_t, ND>;
+    using Layout = StaticGridLayout;
+
+    /// The edge of the bricks.  An 8x8x8 brick of double is 4 KB.
+    static constexpr size_t BLOCK_SHIFT = 3;
+    static constexpr size_t BLOCK_SIZE = size_t(1) << BLOCK_SHIFT;
+    static constexpr size_t BLOCK_VOLUME = size_t(1) << (BLOCK_SHIFT * ND);
+
+    StaticGridMd() = default;
+
+    explicit StaticGridMd(shape_type const & shape, Layout layout = Layout::RowMajor)
+        : m_shape(shape)
+        , m_layout(layout)
+    {
+        size_t nvalue = 1;
+        for (size_t idim = 0; idim < ND; ++idim)
+        {
+            m_coord[idim] = array_type(shape[idim]);
+            m_nbrick[idim] = (shape[idim] + BLOCK_SIZE - 1) >> BLOCK_SHIFT;
+            nvalue *= Layout::Blocked == layout ? m_nbrick[idim] << BLOCK_SHIFT : shape[idim];
+        }
+        m_values = array_type(nvalue);
+    }
+
+    StaticGridMd(StaticGridMd const &) = default;
+    StaticGridMd(StaticGridMd &&) = default;
+    StaticGridMd & operator=(StaticGridMd const &) = default;
+    StaticGridMd & operator=(StaticGridMd &&) = default;
+    ~StaticGridMd() = default;
+
+    shape_type const & shape() const { return m_shape; }
+    size_t shape(size_t idim) const { return m_shape.at(idim); }
+    Layout layout() const { return m_layout; }
+
+    /// Number of the points, not counting the padding of the bricks.
+    size_t size() const
+    {
+        size_t ret = 1;
+        for (size_t const n : m_shape)
+        {
+            ret *= n;
+        }
+        return ret;
+    }
+
+    /// The coordinates of the points along the axis idim.
+    array_type const & coord(size_t idim) const { return m_coord.at(idim); }
+    array_type & coord(size_t idim) { return m_coord.at(idim); }
+
+    /// The values in the order of the layout.
+    array_type const & values() const { return m_values; }
+    array_type & values() { return m_values; }
+
+    /// The position of the point in values().
+    size_t offset(shape_type const & index) const
+    {
+        if (Layout::RowMajor == m_layout)
+        {
+            size_t ret = 0;
+            for (size_t idim = ND; idim-- > 0;)
+            {
+                ret = ret * m_shape[idim] + index[idim];
+            }
+            return ret;
+        }
+        size_t brick = 0;
+        size_t inner = 0;
+        for (size_t idim = ND; idim-- > 0;)
+        {
+            brick = brick * m_nbrick[idim] + (index[idim] >> BLOCK_SHIFT);
+            inner = (inner << BLOCK_SHIFT) + (index[idim] & (BLOCK_SIZE - 1));
+        }
+        return (brick << (BLOCK_SHIFT * ND)) + inner;
+    }
+
+    /**
+     * Number of the points contiguous in values() along x from the x index
+     * i: the rest of the row, or the rest of the row in the brick.
+     */
+    size_t contiguous(size_t i) const
+    {
+        size_t const rest = m_shape[0] - i;
+        return Layout::RowMajor == m_layout ? rest : std::min(rest, BLOCK_SIZE - (i & (BLOCK_SIZE - 1)));
+    }
+
+    /**
+     * Call func(index, count, data) for each segment of count points that
+     * are contiguous along x from the point index, in the order of the
+     * memory.  A segment is a row of the grid in RowMajor and a row of a
+     * brick in Blocked.
+     */
+    template <typename F>
+    void for_each_row(F && func) { walk_rows(m_values.data(), std::forward<F>(func)); }
+    template <typename F>
+    void for_each_row(F && func) const { walk_rows(m_values.data(), std::forward<F>(func)); }
+
+    void fill(value_type value)
+    {
+        MODMESH_TIME("StaticGridMd::fill");
+        std::fill(m_values.begin(), m_values.end(), value);
+    }
+
+    /// Copy the values of the other grid of the same shape in any layout.
+    void copy_values(StaticGridMd const & other);
+
+protected:
+
+    bool in_range(shape_type const & index) const
+    {
+        for (size_t idim = 0; idim < ND; ++idim)
+        {
+            if (index[idim] >= m_shape[idim])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void validate_index(shape_type const & index) const
+    {
+        if (!in_range(index))
+        {
+            Formatter msg;
+            msg << "StaticGrid" << size_t(ND) << "d: index (";
+            for (size_t idim = 0; idim < ND; ++idim)
+            {
+                msg << (0 == idim ? "" : ", ") << index[idim];
+            }
+            msg << ") is out of the shape (";
+            for (size_t idim = 0; idim < ND; ++idim)
+            {
+                msg << (0 == idim ? "" : ", ") << m_shape[idim];
+            }
+            msg << ")";
+            throw std::out_of_range(msg);
+        }
+    }
+
+private:
+
+    template <typename V, typename F>
+    void walk_rows(V * data, F && func) const;
+
+    shape_type m_shape{};
+    // Number of the bricks along each axis.
+    shape_type m_nbrick{};
+    Layout m_layout = Layout::RowMajor;
+    std::array<array_type, ND> m_coord;
+    array_type m_values;
+
+}; /* end class StaticGridMd */
+
+template <uint8_t ND>
+template <typename V, typename F>
+inline void StaticGridMd<ND>::walk_rows(V * data, F && func) const
+{
+    shape_type index{};
+    if (Layout::RowMajor == m_layout)
+    {
+        size_t const nrow = 0 == m_shape[0] ? 0 : size() / m_shape[0];
+        for (size_t irow = 0; irow < nrow; ++irow)
+        {
+            size_t rest = irow;
+            for (size_t idim = 1; idim < ND; ++idim)
+            {
+                index[idim] = rest % m_shape[idim];
+                rest /= m_shape[idim];
+            }
+            func(static_cast<shape_type const &>(index), m_shape[0], data + irow * m_shape[0]);
+        }
+        return;
+    }
+    size_t nbrick = 1;
+    for (size_t const n : m_nbrick)
+    {
+        nbrick *= n;
+    }
+    size_t constexpr nrow = BLOCK_VOLUME >> BLOCK_SHIFT;
+    for (size_t ibrick = 0; ibrick < nbrick; ++ibrick)
+    {
+        // The first point of the brick.
+        shape_type first{};
+        size_t rest = ibrick;
+        for (size_t idim = 0; idim < ND; ++idim)
+        {
+            first[idim] = (rest % m_nbrick[idim]) << BLOCK_SHIFT;
+            rest /= m_nbrick[idim];
+        }
+        size_t const count = std::min(BLOCK_SIZE, m_shape[0] - first[0]);
+        for (size_t irow = 0; irow < nrow; ++irow)
+        {
+            index[0] = first[0];
+            for (size_t idim = 1; idim < ND; ++idim)
+            {
+                index[idim] = first[idim] + ((irow >> (BLOCK_SHIFT * (idim - 1))) & (BLOCK_SIZE - 1));
+            }
+            // Skip the rows of the padding.
+            if (in_range(index))
+            {
+                func(static_cast<shape_type const &>(index), count, data + (ibrick << (BLOCK_SHIFT * ND)) + (irow << BLOCK_SHIFT));
+            }
+        }
+    }
+}
+
+template <uint8_t ND>
+inline void StaticGridMd<ND>::copy_values(StaticGridMd const & other)
+{
+    MODMESH_TIME("StaticGridMd::copy_values");
+    if (other.m_shape != m_shape)
+    {
+        throw std::invalid_argument("StaticGridMd::copy_values: the shapes differ");
+    }
+    // The x rows of the other grid are split at the bricks of this grid.
+    other.for_each_row(
+        [&](shape_type const & index, size_t count, value_type const * src)
+        {
+            shape_type at = index;
+            while (count > 0)
+            {
+                size_t const n = std::min(count, contiguous(at[0]));
+                std::copy_n(src, n, m_values.data() + offset(at));
+                src += n;
+                at[0] += n;
+                count -= n;
+            }
+        });
+}
+
+/**
+ * 2D grid.  The values are indexed by (i, j) for (x, y).
+ */
+class StaticGrid2d : public StaticGridMd<2>
+{
+
+public:
+
+    using base_type = StaticGridMd<2>;
+
+    StaticGrid2d() = default;
+
+    StaticGrid2d(size_t nx, size_t ny, Layout layout = Layout::RowMajor)
+        : base_type(shape_type{nx, ny}, layout)
+    {
+    }
+
+    StaticGrid2d(StaticGrid2d const &) = default;
+    StaticGrid2d(StaticGrid2d &&) = default;
+    StaticGrid2d & operator=(StaticGrid2d const &) = default;
+    StaticGrid2d & operator=(StaticGrid2d &&) = default;
+    ~StaticGrid2d() = default;
+
+    size_t nx() const { return shape()[0]; }
+    size_t ny() const { return shape()[1]; }
+
+    size_t offset(size_t i, size_t j) const { return base_type::offset(shape_type{i, j}); }
+    using base_type::offset;
+
+    value_type operator()(size_t i, size_t j) const noexcept { return values()[offset(i, j)]; }
+    value_type & operator()(size_t i, size_t j) noexcept { return values()[offset(i, j)]; }
+    value_type at(size_t i, size_t j) const
+    {
+        validate_index(shape_type{i, j});
+        return (*this)(i, j);
+    }
+    value_type & at(size_t i, size_t j)
+    {
+        validate_index(shape_type{i, j});
+        return (*this)(i, j);
+    }
+
 }; /* end class StaticGrid2d */
 
-class StaticGrid3d : public StaticGridBase<3>
+/**
+ * 3D grid.  The values are indexed by (i, j, k) for (x, y, z).
+ */
+class StaticGrid3d : public StaticGridMd<3>
 {
+
+public:
+
+    using base_type = StaticGridMd<3>;
+
+    StaticGrid3d() = default;
+
+    StaticGrid3d(size_t nx, size_t ny, size_t nz, Layout layout = Layout::RowMajor)
+        : base_type(shape_type{nx, ny, nz}, layout)
+    {
+    }
+
+    StaticGrid3d(StaticGrid3d const &) = default;
+    StaticGrid3d(StaticGrid3d &&) = default;
+    StaticGrid3d & operator=(StaticGrid3d const &) = default;
+    StaticGrid3d & operator=(StaticGrid3d &&) = default;
+    ~StaticGrid3d() = default;
+
+    size_t nx() const { return shape()[0]; }
+    size_t ny() const { return shape()[1]; }
+    size_t nz() const { return shape()[2]; }
+
+    size_t offset(size_t i, size_t j, size_t k) const { return base_type::offset(shape_type{i, j, k}); }
+    using base_type::offset;
+
+    value_type operator()(size_t i, size_t j, size_t k) const noexcept { return values()[offset(i, j, k)]; }
+    value_type & operator()(size_t i, size_t j, size_t k) noexcept { return values()[offset(i, j, k)]; }
+    value_type at(size_t i, size_t j, size_t k) const
+    {
+        validate_index(shape_type{i, j, k});
+        return (*this)(i, j, k);
+    }
+    value_type & at(size_t i, size_t j, size_t k)
+    {
+        validate_index(shape_type{i, j, k});
+        return (*this)(i, j, k);
+    }
+
 }; /* end class StaticGrid3d */
 
 } /* end namespace modmesh */
@@ -1,43 +1,222 @@
 #include <modmesh/inout/gmsh.hpp>
-#ifdef _WIN32
+#include <modmesh/toggle/profile.hpp>
+
 #include <algorithm>
-#endif // _WIN32
+#include <limits>
+#include <numeric>
 namespace modmesh
 {
 namespace inout
 {
-Gmsh::Gmsh(const std::string & data)
+
+namespace detail
+{
+
+/**
+ * Call func(ichunk, text) for the chunks of the lines in the text.  A chunk
+ * takes the lines starting in a range of ThreadPool::CHUNK_SIZE bytes, so
+ * that the chunks depend only on the text and not on the number of threads.
+ */
+template <typename F>
+void parallel_for_line_chunks(std::string_view text, F && func)
+{
+    auto line_begin = [&text](size_t pos)
+    {
+        if (0 == pos || pos >= text.size())
+        {
+            return std::min(pos, text.size());
+        }
+        size_t const eol = text.find('\n', pos - 1);
+        return (std::string_view::npos == eol) ? text.size() : eol + 1;
+    };
+    parallel_for_chunks(
+        text.size(),
+        ThreadPool::instance().use_parallel(text.size()),
+        [&](size_t begin, size_t end)
+        {
+            size_t const first = line_begin(begin);
+            size_t const last = line_begin(end);
+            func(begin / ThreadPool::CHUNK_SIZE, text.substr(first, last - first));
+        });
+}
+
+/**
+ * Elements parsed from a chunk of the $Elements section, or from an entity
+ * block of MSH 4.1.  elnds holds the vertices of all the elements in the
+ * modmesh order, and elnnd the number of vertices of each element.
+ */
+struct GmshElementChunk
+{
+
+    using int_type = int32_t;
+    using uint_type = uint32_t;
+
+    // Set the type of the elements to be appended.  Elements of the same type
+    // usually come together, so the definition is looked up only when the
+    // type changes.
+    void set_type(uint16_t tpn)
+    {
+        if (tpn == last_tpn)
+        {
+            return;
+        }
+        auto eldef = GmshElementDef::by_id(tpn);
+        if (0 == eldef.nnds())
+        {
+            throw std::invalid_argument(Formatter() << "Gmsh: unsupported element type " << tpn);
+        }
+        last_tpn = tpn;
+        ndim = eldef.ndim();
+        nnds = eldef.nnds();
+        mmtpn = eldef.mmtpn();
+        mmcl = eldef.mmcl();
+    }
+
+    // Append an element of the current type.  node(i) returns the row of the
+    // i-th node of the element in the gmsh order.  Only the leading vertices
+    // are kept and the high-order nodes are skipped.
+    template <typename N>
+    void append(int_type physical, int_type geometrical, N && node)
+    {
+        cltpn.push_back(mmtpn);
+        elgrp.push_back(static_cast<uint_type>(physical));
+        elgeo.push_back(static_cast<uint_type>(geometrical));
+        eldim.push_back(ndim);
+
+        size_t const base = elnds.size();
+        elnds.resize(base + mmcl.size(), 0);
+        elnnd.push_back(static_cast<uint_type>(mmcl.size()));
+        for (size_t i = 0; i < mmcl.size(); ++i)
+        {
+            elnds[base + mmcl[i]] = node(i);
+        }
+    }
+
+    // Parse the element lines of MSH 2.2.
+    template <typename I>
+    void parse(std::string_view text, I && node_index)
+    {
+        std::vector<size_t> nds;
+        GmshTextCursor lines(text);
+        while (!lines.eof())
+        {
+            std::string_view const line = lines.next_nonempty_line();
+            if (line.empty())
+            {
+                break;
+            }
+            GmshTextCursor fields(line);
+            size_t elid = 0;
+            uint16_t tpn = 0;
+            size_t ntag = 0;
+            if (!(fields.read(elid) && fields.read(tpn) && fields.read(ntag)))
+            {
+                throw std::invalid_argument(Formatter() << "Gmsh: invalid element \"" << line << "\" in $Elements");
+            }
+
+            // parse element type
+            set_type(tpn);
+
+            // parse element tag; the first is the physical entity and the
+            // second is the elementary geometrical entity
+            int_type tag[2] = {0, 0}; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+            for (size_t i = 0; i < ntag; ++i)
+            {
+                int_type value = 0;
+                if (!fields.read(value))
+                {
+                    throw std::invalid_argument(Formatter() << "Gmsh: invalid tag of element " << elid);
+                }
+                if (i < 2)
+                {
+                    tag[i] = value;
+                }
+            }
+
+            // parse node number list
+            nds.resize(nnds);
+            for (size_t i = 0; i < nnds; ++i)
+            {
+                if (!fields.read(nds[i]))
+                {
+                    throw std::invalid_argument(Formatter() << "Gmsh: invalid node list of element " << elid);
+                }
+            }
+            append(tag[0], tag[1], [&](size_t i)
+                   { return node_index(nds[i], elid); });
+        }
+    }
+
+    // Parse the binary elements of an entity block of MSH 4.1, each of which
+    // is the element tag followed by the node tags.
+    template <typename I>
+    void parse_binary(std::string_view bytes, size_t nelement, bool swap, int_type physical, int_type geometrical, I && node_index)
+    {
+        size_t const stride = (nnds + 1) * sizeof(uint64_t);
+        for (size_t it = 0; it < nelement; ++it)
+        {
+            char const * record = bytes.data() + it * stride;
+            size_t const elid = load_binary<uint64_t>(record, swap);
+            append(physical, geometrical, [&](size_t i)
+                   { return node_index(load_binary<uint64_t>(record + (i + 1) * sizeof(uint64_t), swap), elid); });
+        }
+    }
+
+    uint16_t last_tpn = 0;
+    uint8_t ndim = 0;
+    uint16_t nnds = 0;
+    uint8_t mmtpn = 0;
+    small_vector<uint8_t> mmcl;
+
+    std::vector<int_type> cltpn;
+    std::vector<uint_type> elgrp;
+    std::vector<uint_type> elgeo;
+    std::vector<uint_type> eldim;
+    std::vector<uint_type> elnnd;
+    std::vector<uint_type> elnds;
+
+}; /* end struct GmshElementChunk */
+
+} /* end namespace detail */
+
+Gmsh::Gmsh(std::string_view data)
+{
+    MeshCache & cache = MeshCache::instance();
+    if (cache.enabled())
+    {
+        m_cache_key = MeshCache::make_key(data, "Gmsh.to_block");
+        m_cached = cache.load(m_cache_key);
+        if (m_cached)
+        {
+            return;
+        }
+    }
+    parse(data);
+}
+
+void Gmsh::parse(std::string_view data)
 {
     bool meta_enter = false;
     bool node_enter = false;
     bool element_enter = false;
+    detail::GmshTextCursor cursor(data);
     // clang-format off
-    std::unordered_map<std::string, std::function<void()>> keyword_handler = {
-        {"$MeshFormat", [this, &meta_enter]() { load_meta(); meta_enter = true; }},
-        {"$Nodes", [this, &node_enter]() { load_nodes(); node_enter = true; }},
-        {"$Elements", [this, &element_enter]() { load_elements(); element_enter = true; }},
-        {"$PhysicalNames", [this]() { load_physical(); }}};
+    std::unordered_map<std::string_view, std::function<void()>> keyword_handler = {
+        {"$MeshFormat", [this, &cursor, &meta_enter]() { load_meta(cursor); meta_enter = true; }},
+        {"$Entities", [this, &cursor]() { load_entities(cursor); }},
+        {"$Nodes", [this, &cursor, &node_enter]() { is_v4() ? load_nodes_v4(cursor) : load_nodes(cursor); node_enter = true; }},
+        {"$Elements", [this, &cursor, &element_enter]() { is_v4() ? load_elements_v4(cursor) : load_elements(cursor); element_enter = true; }},
+        {"$PhysicalNames", [this, &cursor]() { load_physical(cursor); }}};
     // clang-format on
 
-    // String stream on windows need to remove \r for keyword comparison.
-    // DOS file newline character is CRLF, std::getline default using LF as delimeter
-    // therefore string seperated by std::getline will contain \r, it will cause
-    // keyword compare failed.
-    // TODO: Keyword comparison can use regular expression.
-#ifdef _WIN32
-    std::string data_copy = data;
-    data_copy.erase(std::remove(data_copy.begin(), data_copy.end(), '\r'), data_copy.end());
-    stream << data_copy;
-#else // _WIN32
-    stream << data;
-#endif // _WIN32
-
-    std::string line;
-    while (std::getline(stream, line))
+    // The cursor strips the CR of DOS (CRLF) line terminators, so that the
+    // keyword comparison works for files written on Windows.
+    while (!cursor.eof())
     {
+        std::string_view const line = cursor.next_line();
         // Using a finite state machine to check the input msh file format is valid or not.
         // $ is a keyword to trigger state transition.
-        if (line.find('$') != std::string::npos)
+        if (line.find('$') != std::string_view::npos)
         {
             auto it = keyword_handler.find(line);
             if (it != keyword_handler.end())
@@ -67,33 +246,631 @@ Gmsh::Gmsh(const std::string & data)
     }
 }
 
+std::shared_ptr<Gmsh> Gmsh::from_file(std::string const & path)
+{
+    std::shared_ptr<ConcreteBuffer> const buffer = map_buffer(path, MapMode::ReadOnly);
+    return std::make_shared<Gmsh>(std::string_view(reinterpret_cast<char const *>(buffer->data()), buffer->size()));
+}
+
+void Gmsh::load_meta(detail::GmshTextCursor & cursor)
+{
+    std::string_view line = cursor.next_nonempty_line();
+    detail::GmshTextCursor fields(line);
+    if (!(fields.read(msh_ver) && fields.read(msh_file_type) && fields.read(msh_data_size)))
+    {
+        throw std::invalid_argument(Formatter() << "Gmsh: invalid $MeshFormat line \"" << line << "\"");
+    }
+
+    // The parse supports ver 2.2 msh file and ver 4.1 in both ASCII and binary.
+    if (msh_ver != 2.2 && msh_ver != 4.1)
+    {
+        throw std::invalid_argument(Formatter() << "modmesh does not support msh file ver " << msh_ver << ".");
+    }
+    if (msh_file_type != 0 && !(msh_file_type == 1 && is_v4()))
+    {
+        throw std::invalid_argument(Formatter() << "modmesh does not support msh file type " << msh_file_type
+                                                << " of ver " << msh_ver << ".");
+    }
+    if (msh_file_type == 1)
+    {
+        if (msh_data_size != sizeof(uint64_t))
+        {
+            throw std::invalid_argument(Formatter() << "modmesh does not support binary msh file of data size " << msh_data_size << ".");
+        }
+        // The binary file writes an integer 1 to tell the byte order.
+        std::string_view one;
+        if (!cursor.take(sizeof(int32_t), one))
+        {
+            throw std::invalid_argument("Gmsh: truncated $MeshFormat");
+        }
+        bool const swap = 1 != detail::load_binary<int32_t>(one.data(), false);
+        if (swap && 1 != detail::load_binary<int32_t>(one.data(), true))
+        {
+            throw std::invalid_argument("Gmsh: invalid byte order mark in $MeshFormat");
+        }
+        cursor.set_binary(true, swap);
+    }
+
+    line = cursor.next_nonempty_line();
+    if (line == "$EndMeshFormat")
+    {
+        last_fmt_state = FormatState::META_END;
+    }
+}
+
+void Gmsh::load_physical(detail::GmshTextCursor & cursor)
+{
+    std::string_view line;
+    while (!cursor.eof())
+    {
+        line = cursor.next_line();
+        if (line.find('$') != std::string_view::npos)
+        {
+            break;
+        }
+    }
+
+    if (line == "$EndPhysicalNames")
+    {
+        last_fmt_state = FormatState::PYHSICAL_NAME_END;
+    }
+}
+
+void Gmsh::load_nodes(detail::GmshTextCursor & cursor)
+{
+    MODMESH_TIME("Gmsh::load_nodes");
+    size_t nnode = 0;
+    if (!cursor.read(nnode))
+    {
+        throw std::invalid_argument("Gmsh: invalid number of nodes in $Nodes");
+    }
+
+    m_nds.remake(small_vector<size_t>{nnode, 3}, 0);
+
+    // Each node is written to the row of its index, so that the chunks do
+    // not need to be merged.
+    std::string_view const section = cursor.take_section();
+    std::vector<size_t> counts(modmesh::detail::chunk_count(section.size()), 0);
+    detail::parallel_for_line_chunks(
+        section,
+        [this, nnode, &counts](size_t ichunk, std::string_view text)
+        {
+            detail::GmshTextCursor lines(text);
+            size_t count = 0;
+            while (!lines.eof())
+            {
+                std::string_view const line = lines.next_nonempty_line();
+                if (line.empty())
+                {
+                    break;
+                }
+                detail::GmshTextCursor fields(line);
+                size_t ind = 0;
+                real_type crd[3] = {0.0, 0.0, 0.0}; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+                if (!(fields.read(ind) && fields.read(crd[0]) && fields.read(crd[1]) && fields.read(crd[2])))
+                {
+                    throw std::invalid_argument(Formatter() << "Gmsh: invalid node \"" << line << "\" in $Nodes");
+                }
+                // gmsh node index is 1-based index
+                if (ind < 1 || ind > nnode)
+                {
+                    throw std::invalid_argument(Formatter() << "Gmsh: node index " << ind << " is not in [1, " << nnode << "]");
+                }
+                m_nds(ind - 1, 0) = crd[0];
+                m_nds(ind - 1, 1) = crd[1];
+                m_nds(ind - 1, 2) = crd[2];
+                ++count;
+            }
+            counts[ichunk] = count;
+        });
+    size_t const nread = std::accumulate(counts.begin(), counts.end(), size_t(0));
+    if (nread != nnode)
+    {
+        throw std::invalid_argument(Formatter() << "Gmsh: $Nodes declares " << nnode << " nodes but has " << nread);
+    }
+
+    if (cursor.next_nonempty_line() == "$EndNodes")
+    {
+        last_fmt_state = FormatState::NODE_END;
+    }
+}
+
+void Gmsh::load_elements(detail::GmshTextCursor & cursor)
+{
+    MODMESH_TIME("Gmsh::load_elements");
+    size_t nelement = 0;
+    if (!cursor.read(nelement))
+    {
+        throw std::invalid_argument("Gmsh: invalid number of elements in $Elements");
+    }
+
+    // The index of an element is its position in the section, which is not
+    // known before the preceding chunks are parsed.  Parse the chunks into
+    // their own buffers and merge them with the prefix sum of the counts.
+    std::string_view const section = cursor.take_section();
+    std::vector<detail::GmshElementChunk> chunks(modmesh::detail::chunk_count(section.size()));
+    detail::parallel_for_line_chunks(
+        section,
+        [this, &chunks](size_t ichunk, std::string_view text)
+        {
+            chunks[ichunk].parse(text, [this](size_t tag, size_t elid)
+                                 { return node_index(tag, elid); });
+        });
+    merge_elements(chunks, nelement);
+
+    if (cursor.next_nonempty_line() == "$EndElements")
+    {
+        last_fmt_state = FormatState::ELEMENT_END;
+    }
+}
+
+void Gmsh::load_entities(detail::GmshTextCursor & cursor)
+{
+    auto fail = []()
+    { throw std::invalid_argument("Gmsh: invalid $Entities"); };
+
+    uint64_t nentity[4] = {0, 0, 0, 0}; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    for (uint64_t & count : nentity)
+    {
+        if (!cursor.read(count))
+        {
+            fail();
+        }
+    }
+    for (size_t dim = 0; dim < 4; ++dim)
+    {
+        for (size_t it = 0; it < nentity[dim]; ++it)
+        {
+            int32_t tag = 0;
+            if (!cursor.read(tag))
+            {
+                fail();
+            }
+            // A point has its coordinate and the others have the bounding box.
+            real_type crd = 0.0;
+            for (size_t ic = 0; ic < (0 == dim ? 3 : 6); ++ic)
+            {
+                if (!cursor.read(crd))
+                {
+                    fail();
+                }
+            }
+            uint64_t nphysical = 0;
+            if (!cursor.read(nphysical))
+            {
+                fail();
+            }
+            for (size_t ip = 0; ip < nphysical; ++ip)
+            {
+                int32_t physical = 0;
+                if (!cursor.read(physical))
+                {
+                    fail();
+                }
+                if (0 == ip)
+                {
+                    m_entity_physical[dim][tag] = physical;
+                }
+            }
+            if (0 != dim)
+            {
+                uint64_t nbounding = 0;
+                if (!cursor.read(nbounding))
+                {
+                    fail();
+                }
+                for (size_t ib = 0; ib < nbounding; ++ib)
+                {
+                    int32_t bounding = 0;
+                    if (!cursor.read(bounding))
+                    {
+                        fail();
+                    }
+                }
+            }
+        }
+    }
+
+    if (cursor.next_nonempty_line() == "$EndEntities")
+    {
+        last_fmt_state = FormatState::ENTITY_END;
+    }
+}
+
+void Gmsh::load_nodes_v4(detail::GmshTextCursor & cursor)
+{
+    MODMESH_TIME("Gmsh::load_nodes_v4");
+    uint64_t nblock = 0;
+    uint64_t nnode = 0;
+    uint64_t mintag = 0;
+    uint64_t maxtag = 0;
+    if (!(cursor.read(nblock) && cursor.read(nnode) && cursor.read(mintag) && cursor.read(maxtag)))
+    {
+        throw std::invalid_argument("Gmsh: invalid header of $Nodes");
+    }
+    if (maxtag > std::numeric_limits<uint_type>::max() || nnode > maxtag)
+    {
+        throw std::invalid_argument(Formatter() << "Gmsh: $Nodes has " << nnode << " nodes of tags up to " << maxtag);
+    }
+
+    m_nds.remake(small_vector<size_t>{nnode, 3}, 0);
+    m_ndindex.assign(maxtag + 1, std::numeric_limits<uint_type>::max());
+
+    size_t inode = 0;
+    for (size_t ib = 0; ib < nblock; ++ib)
+    {
+        int32_t edim = 0;
+        int32_t etag = 0;
+        int32_t parametric = 0;
+        uint64_t nbnode = 0;
+        if (!(cursor.read(edim) && cursor.read(etag) && cursor.read(parametric) && cursor.read(nbnode)))
+        {
+            throw std::invalid_argument(Formatter() << "Gmsh: invalid header of node block " << ib);
+        }
+        if (nbnode > nnode - inode)
+        {
+            throw std::invalid_argument(Formatter() << "Gmsh: node block " << ib << " exceeds the " << nnode << " nodes");
+        }
+        // The parametric coordinates follow x, y, z when requested.
+        size_t const ncrd = 3 + (parametric ? static_cast<size_t>(edim) : 0);
+
+        auto set_tag = [this, inode](size_t k, uint64_t tag)
+        {
+            if (tag > m_ndindex.size() - 1 || 0 == tag || std::numeric_limits<uint_type>::max() != m_ndindex[tag])
+            {
+                throw std::invalid_argument(Formatter() << "Gmsh: node tag " << tag << " is invalid or duplicated");
+            }
+            m_ndindex[tag] = static_cast<uint_type>(inode + k);
+        };
+
+        if (cursor.binary())
+        {
+            // All the tags of the block come first and then the coordinates.
+            std::string_view tags;
+            std::string_view crds;
+            if (!(cursor.take(nbnode * sizeof(uint64_t), tags) && cursor.take(nbnode * ncrd * sizeof(double), crds)))
+            {
+                throw std::invalid_argument(Formatter() << "Gmsh: truncated node block " << ib);
+            }
+            for (size_t k = 0; k < nbnode; ++k)
+            {
+                set_tag(k, detail::load_binary<uint64_t>(tags.data() + k * sizeof(uint64_t), cursor.swap()));
+            }
+            real_type * nds = m_nds.data() + inode * 3;
+            if (3 == ncrd && !cursor.swap())
+            {
+                std::memcpy(nds, crds.data(), crds.size());
+            }
+            else
+            {
+                for (size_t k = 0; k < nbnode; ++k)
+                {
+                    for (size_t ic = 0; ic < 3; ++ic)
+                    {
+                        nds[k * 3 + ic] = detail::load_binary<double>(crds.data() + (k * ncrd + ic) * sizeof(double), cursor.swap());
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (size_t k = 0; k < nbnode; ++k)
+            {
+                uint64_t tag = 0;
+                if (!cursor.read(tag))
+                {
+                    throw std::invalid_argument(Formatter() << "Gmsh: invalid node tag in block " << ib);
+                }
+                set_tag(k, tag);
+            }
+            for (size_t k = 0; k < nbnode; ++k)
+            {
+                for (size_t ic = 0; ic < ncrd; ++ic)
+                {
+                    real_type crd = 0.0;
+                    if (!cursor.read(crd))
+                    {
+                        throw std::invalid_argument(Formatter() << "Gmsh: invalid node coordinate in block " << ib);
+                    }
+                    if (ic < 3)
+                    {
+                        m_nds(inode + k, ic) = crd;
+                    }
+                }
+            }
+        }
+        inode += nbnode;
+    }
+    if (inode != nnode)
+    {
+        throw std::invalid_argument(Formatter() << "Gmsh: $Nodes declares " << nnode << " nodes but has " << inode);
+    }
+
+    if (cursor.next_nonempty_line() == "$EndNodes")
+    {
+        last_fmt_state = FormatState::NODE_END;
+    }
+}
+
+void Gmsh::load_elements_v4(detail::GmshTextCursor & cursor)
+{
+    MODMESH_TIME("Gmsh::load_elements_v4");
+    uint64_t nblock = 0;
+    uint64_t nelement = 0;
+    uint64_t mintag = 0;
+    uint64_t maxtag = 0;
+    if (!(cursor.read(nblock) && cursor.read(nelement) && cursor.read(mintag) && cursor.read(maxtag)))
+    {
+        throw std::invalid_argument("Gmsh: invalid header of $Elements");
+    }
+
+    // Each entity block becomes a chunk.  The binary blocks are located first
+    // and then parsed in parallel.
+    struct BinaryBlock
+    {
+        std::string_view bytes;
+        size_t nelement;
+        int32_t physical;
+        int32_t geometrical;
+    };
+    std::vector<detail::GmshElementChunk> chunks(nblock);
+    std::vector<BinaryBlock> blocks;
+    size_t nbyte = 0;
+    auto index = [this](size_t tag, size_t elid)
+    { return node_index(tag, elid); };
+    for (size_t ib = 0; ib < nblock; ++ib)
+    {
+        int32_t edim = 0;
+        int32_t etag = 0;
+        int32_t tpn = 0;
+        uint64_t nbelement = 0;
+        if (!(cursor.read(edim) && cursor.read(etag) && cursor.read(tpn) && cursor.read(nbelement)))
+        {
+            throw std::invalid_argument(Formatter() << "Gmsh: invalid header of element block " << ib);
+        }
+        if (edim < 0 || edim > 3 || tpn < 0 || tpn > std::numeric_limits<uint16_t>::max())
+        {
+            throw std::invalid_argument(Formatter() << "Gmsh: element block " << ib << " has invalid dimension or type");
+        }
+        detail::GmshElementChunk & chunk = chunks[ib];
+        chunk.set_type(static_cast<uint16_t>(tpn));
+        auto const found = m_entity_physical[edim].find(etag);
+        int32_t const physical = (found == m_entity_physical[edim].end()) ? 0 : found->second;
+
+        if (cursor.binary())
+        {
+            std::string_view bytes;
+            if (!cursor.take(nbelement * (chunk.nnds + 1) * sizeof(uint64_t), bytes))
+            {
+                throw std::invalid_argument(Formatter() << "Gmsh: truncated element block " << ib);
+            }
+            blocks.push_back({bytes, nbelement, physical, etag});
+            nbyte += bytes.size();
+        }
+        else
+        {
+            std::vector<size_t> nds(chunk.nnds);
+            for (size_t it = 0; it < nbelement; ++it)
+            {
+                size_t elid = 0;
+                bool valid = cursor.read(elid);
+                for (size_t i = 0; valid && i < nds.size(); ++i)
+                {
+                    valid = cursor.read(nds[i]);
+                }
+                if (!valid)
+                {
+                    throw std::invalid_argument(Formatter() << "Gmsh: invalid element in block " << ib);
+                }
+                chunk.append(physical, etag, [&](size_t i)
+                             { return index(nds[i], elid); });
+            }
+        }
+    }
+
+    if (cursor.binary())
+    {
+        auto parse = [&](size_t ib)
+        {
+            BinaryBlock const & block = blocks[ib];
+            chunks[ib].parse_binary(block.bytes, block.nelement, cursor.swap(), block.physical, block.geometrical, index);
+        };
+        if (ThreadPool::instance().use_parallel(nbyte) && blocks.size() > 1)
+        {
+            ThreadPool::instance().run(blocks.size(), parse);
+        }
+        else
+        {
+            for (size_t ib = 0; ib < blocks.size(); ++ib)
+            {
+                parse(ib);
+            }
+        }
+    }
+    merge_elements(chunks, nelement);
+
+    if (cursor.next_nonempty_line() == "$EndElements")
+    {
+        last_fmt_state = FormatState::ELEMENT_END;
+    }
+}
+
+Gmsh::uint_type Gmsh::node_index(size_t tag, size_t elid) const
+{
+    if (m_ndindex.empty())
+    {
+        if (tag < 1 || tag > m_nds.shape(0))
+        {
+            throw std::invalid_argument(Formatter() << "Gmsh: element " << elid << " uses node " << tag
+                                                    << " not in [1, " << m_nds.shape(0) << "]");
+        }
+        return static_cast<uint_type>(tag - 1);
+    }
+    if (tag >= m_ndindex.size() || std::numeric_limits<uint_type>::max() == m_ndindex[tag])
+    {
+        throw std::invalid_argument(Formatter() << "Gmsh: element " << elid << " uses undefined node " << tag);
+    }
+    return m_ndindex[tag];
+}
+
+void Gmsh::merge_elements(std::vector<detail::GmshElementChunk> const & chunks, size_t nelement)
+{
+    // Prefix sums of the element and node counts locate each chunk in the
+    // flat arrays.
+    std::vector<size_t> offsets(chunks.size() + 1, 0);
+    std::vector<size_t> ndoffsets(chunks.size() + 1, 0);
+    for (size_t ichunk = 0; ichunk < chunks.size(); ++ichunk)
+    {
+        offsets[ichunk + 1] = offsets[ichunk] + chunks[ichunk].cltpn.size();
+        ndoffsets[ichunk + 1] = ndoffsets[ichunk] + chunks[ichunk].elnds.size();
+    }
+    if (offsets.back() != nelement)
+    {
+        throw std::invalid_argument(Formatter() << "Gmsh: $Elements declares " << nelement << " elements but has " << offsets.back());
+    }
+
+    m_cltpn.remake(small_vector<size_t>{nelement}, 0);
+    m_elgrp.remake(small_vector<size_t>{nelement}, 0);
+    m_elgeo.remake(small_vector<size_t>{nelement}, 0);
+    m_eldim.remake(small_vector<size_t>{nelement}, 0);
+    m_eloff.remake(small_vector<size_t>{nelement + 1}, 0);
+    m_elnds.remake(small_vector<size_t>{ndoffsets.back()}, 0);
+
+    auto merge = [&](size_t ichunk)
+    {
+        detail::GmshElementChunk const & chunk = chunks[ichunk];
+        size_t const offset = offsets[ichunk];
+        std::copy(chunk.cltpn.begin(), chunk.cltpn.end(), m_cltpn.begin() + offset);
+        std::copy(chunk.elgrp.begin(), chunk.elgrp.end(), m_elgrp.begin() + offset);
+        std::copy(chunk.elgeo.begin(), chunk.elgeo.end(), m_elgeo.begin() + offset);
+        std::copy(chunk.eldim.begin(), chunk.eldim.end(), m_eldim.begin() + offset);
+        std::copy(chunk.elnds.begin(), chunk.elnds.end(), m_elnds.begin() + ndoffsets[ichunk]);
+        auto eloff = static_cast<uint_type>(ndoffsets[ichunk]);
+        for (size_t it = 0; it < chunk.elnnd.size(); ++it)
+        {
+            m_eloff[offset + it] = eloff;
+            eloff += chunk.elnnd[it];
+        }
+    };
+    if (ThreadPool::instance().use_parallel(nelement) && chunks.size() > 1)
+    {
+        ThreadPool::instance().run(chunks.size(), merge);
+    }
+    else
+    {
+        for (size_t ichunk = 0; ichunk < chunks.size(); ++ichunk)
+        {
+            merge(ichunk);
+        }
+    }
+    m_eloff[nelement] = static_cast<uint_type>(ndoffsets.back());
+
+    // sorting used node and remove duplicate node id
+    std::vector<uint_type> usnds(m_elnds.begin(), m_elnds.end());
+    usnds.resize(parallel_sort_unique(usnds.data(), usnds.size(), ThreadPool::instance().use_parallel(usnds.size())));
+
+    // put used node id to m_ndmap, which is indexed by the node id
+    m_ndmap.remake(small_vector<size_t>{m_nds.shape(0)}, -1);
+    for (size_t i = 0; i < usnds.size(); ++i)
+    {
+        m_ndmap(usnds[i]) = i;
+    }
+}
+
 std::shared_ptr<StaticMesh> Gmsh::to_block()
 {
+    if (m_cached)
+    {
+        return m_cached;
+    }
     std::shared_ptr<StaticMesh> block = StaticMesh::construct(
         m_eldim.max(),
         static_cast<StaticMesh::uint_type>(m_nds.shape(0)),
         0,
-        static_cast<StaticMesh::uint_type>(m_elems.size()));
+        static_cast<StaticMesh::uint_type>(m_cltpn.size()));
+    build_interior(block);
+    if (!m_cache_key.empty())
+    {
+        MeshCache::instance().store(m_cache_key, *block);
+    }
+    return block;
+}
+
+std::shared_ptr<StaticMeshFp32> Gmsh::to_block_fp32()
+{
+    if (m_cached)
+    {
+        // Round the cached mesh instead of parsing the text again.
+        StaticMesh const & src = *m_cached;
+        std::shared_ptr<StaticMeshFp32> block = StaticMeshFp32::construct(
+            src.ndim(),
+            src.nnode(),
+            0,
+            src.ncell());
+        SimpleArray<float> ndcrd(src.ndcrd().shape());
+        for (size_t i = 0; i < ndcrd.size(); ++i)
+        {
+            ndcrd.data(i) = static_cast<float>(src.ndcrd().data(i));
+        }
+        block->ndcrd().swap(ndcrd);
+        std::copy_n(src.cltpn().begin(), src.ncell(), block->cltpn().begin());
+        std::copy_n(src.clnds().begin(), src.clnds().size(), block->clnds().begin());
+        block->build_interior(true);
+        block->build_boundary();
+        block->build_ghost();
+        return block;
+    }
+    std::shared_ptr<StaticMeshFp32> block = StaticMeshFp32::construct(
+        m_eldim.max(),
+        static_cast<StaticMeshFp32::uint_type>(m_nds.shape(0)),
+        0,
+        static_cast<StaticMeshFp32::uint_type>(m_cltpn.size()));
     build_interior(block);
     return block;
 }
 
-void Gmsh::build_interior(const std::shared_ptr<StaticMesh> & blk)
+template <typename T>
+void Gmsh::build_interior(const std::shared_ptr<BasicStaticMesh<T>> & blk)
 {
+    using mesh_int_type = typename BasicStaticMesh<T>::int_type;
+    size_t const ncell = m_cltpn.size();
     blk->cltpn().swap(m_cltpn);
-    blk->ndcrd().swap(m_nds);
-    for (size_t i = 0; i < m_elems.size(); ++i)
+    if constexpr (std::is_same_v<T, real_type>)
     {
-        blk->clnds()(i, 0) = m_elems[i][0];
-        for (size_t j = 1; j <= m_elems[i][0]; ++j)
+        blk->ndcrd().swap(m_nds);
+    }
+    else
+    {
+        SimpleArray<T> ndcrd(m_nds.shape());
+        for (size_t i = 0; i < m_nds.size(); ++i)
         {
-            blk->clnds()(i, j) = m_elems[i][j];
+            ndcrd.data(i) = static_cast<T>(m_nds.data(i));
         }
+        blk->ndcrd().swap(ndcrd);
+        m_nds = SimpleArray<real_type>();
     }
+    SimpleArray<mesh_int_type> & clnds = blk->clnds();
+    parallel_for_chunks(
+        ncell,
+        ThreadPool::instance().use_parallel(ncell),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                uint_type const first = m_eloff[i];
+                uint_type const nnd = m_eloff[i + 1] - first;
+                clnds(i, 0) = static_cast<mesh_int_type>(nnd);
+                std::copy_n(m_elnds.begin() + first, nnd, &clnds(i, 1));
+            }
+        });
     blk->build_interior(true);
     blk->build_boundary();
     blk->build_ghost();
 }
+
+template void Gmsh::build_interior<float>(const std::shared_ptr<StaticMeshFp32> & blk);
+template void Gmsh::build_interior<double>(const std::shared_ptr<StaticMesh> & blk);
+
 } /* end namespace inout */
 } /* end namespace modmesh */
 
@@ -1,6 +1,12 @@
 #pragma once
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
 #include <string>
-#include <sstream>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 #include <unordered_map>
 #include <functional>
@@ -8,6 +14,7 @@
 #include <modmesh/base.hpp>
 #include <modmesh/mesh/mesh.hpp>
 #include <modmesh/buffer/buffer.hpp>
+#include <modmesh/inout/mesh_cache.hpp>
 
 namespace modmesh
 {
@@ -45,204 +52,292 @@ private:
     small_vector<uint8_t> m_mmcl; /* modmesh cell order  */
 }; /* end struct GmshElementDef */
 
-class Gmsh
-    : public NumberBase<int32_t, double>
+namespace detail
 {
-    using number_base = NumberBase<int32_t, double>;
-    using int_type = typename number_base::int_type;
-    using uint_type = typename number_base::uint_type;
-    using real_type = typename number_base::real_type;
 
-public:
-    explicit Gmsh(const std::string & data);
+// Load a number stored in binary, which may be in the opposite byte order.
+template <typename T>
+T load_binary(char const * data, bool swap)
+{
+    T value;
+    if (swap)
+    {
+        std::array<char, sizeof(T)> bytes{};
+        std::reverse_copy(data, data + sizeof(T), bytes.begin());
+        std::memcpy(&value, bytes.data(), sizeof(T));
+    }
+    else
+    {
+        std::memcpy(&value, data, sizeof(T));
+    }
+    return value;
+}
 
-    ~Gmsh() = default;
+/**
+ * Forward-only cursor over the text of a msh file.  Lines and numbers are
+ * scanned in place with std::from_chars, so that neither the text nor the
+ * tokens in it are copied.  In the binary mode, numbers are loaded from
+ * their bytes instead.
+ */
+class GmshTextCursor
+{
 
-    Gmsh() = delete;
-    Gmsh(Gmsh const & other) = delete;
-    Gmsh(Gmsh && other) = delete;
-    Gmsh & operator=(Gmsh const & other) = delete;
-    Gmsh & operator=(Gmsh && other) = delete;
+public:
 
-    std::shared_ptr<StaticMesh> to_block(void);
+    explicit GmshTextCursor(std::string_view text)
+        : m_text(text)
+    {
+    }
 
-private:
-    enum class FormatState
+    bool eof() const { return m_pos >= m_text.size(); }
+    size_t pos() const { return m_pos; }
+
+    // Read the numbers in binary, swapping their bytes when swap is true.
+    // Lines are still text in the binary msh files.
+    void set_binary(bool binary, bool swap)
     {
-        BEGIN,
-        META_END,
-        PYHSICAL_NAME_END,
-        NODE_END,
-        ELEMENT_END
-    };
+        m_binary = binary;
+        m_swap = swap;
+    }
+    bool binary() const { return m_binary; }
+    bool swap() const { return m_swap; }
 
-    // Check the finite state machine state transition is valid or not to check msh file format is correct
-    bool is_valid_transition(const std::string s)
+    // Return the rest of the current line without the line terminator, which
+    // may be either LF or CRLF.
+    std::string_view next_line()
     {
-        if (last_fmt_state == FormatState::BEGIN)
+        size_t const begin = m_pos;
+        size_t end = m_text.find('\n', begin);
+        if (std::string_view::npos == end)
         {
-            return s == "$MeshFormat";
+            end = m_text.size();
+            m_pos = end;
         }
-        else if (last_fmt_state == FormatState::META_END || last_fmt_state == FormatState::PYHSICAL_NAME_END)
+        else
         {
-            return s == "$PhysicalNames" || s == "$Nodes";
+            m_pos = end + 1;
         }
-        else if (last_fmt_state == FormatState::NODE_END)
+        if (end > begin && '\r' == m_text[end - 1])
         {
-            return s == "$Elements";
+            --end;
         }
-
-        return false;
+        return m_text.substr(begin, end - begin);
     }
 
-    void load_meta(void)
+    // Return the next line having anything other than white spaces, or an
+    // empty string at the end of the text.
+    std::string_view next_nonempty_line()
     {
-        std::string line;
-
-        while (std::getline(stream, line) && line.find('$') == std::string::npos)
+        while (!eof())
         {
-            auto tokens = tokenize(line, ' ');
-            msh_ver = std::stod(tokens[0]);
-
-            // The parse only support ver 2.2 msh file.
-            if (msh_ver != 2.2)
+            std::string_view const line = next_line();
+            if (std::string_view::npos != line.find_first_not_of(" \t"))
             {
-                throw std::invalid_argument(Formatter() << "modmesh does not support msh file ver " << msh_ver << ".");
+                return line;
             }
-
-            msh_file_type = std::stoi(tokens[1]);
-            msh_data_size = std::stoi(tokens[2]);
         }
+        return {};
+    }
 
-        if (!line.compare("$EndMeshFormat"))
+    // Return the text from the cursor to the next keyword line, which starts
+    // with '$', and move the cursor to the keyword line.
+    std::string_view take_section()
+    {
+        size_t const begin = m_pos;
+        size_t end = begin;
+        if (end < m_text.size() && '$' != m_text[end])
         {
-            last_fmt_state = FormatState::META_END;
+            size_t const found = m_text.find("\n$", begin);
+            end = (std::string_view::npos == found) ? m_text.size() : found + 1;
         }
+        m_pos = end;
+        return m_text.substr(begin, end - begin);
     }
 
-    // TODO: PhysicalNames section parsing logic not complete yet, but without PhysicalNames section
-    //       modmesh mesh viewer still working, therefore we can finish this later.
-    void load_physical(void)
+    // Take the next nbyte bytes.  Return false if the text is shorter.
+    bool take(size_t nbyte, std::string_view & bytes)
     {
-        std::string line;
-
-        while (std::getline(stream, line) && line.find('$') == std::string::npos) {}
-
-        if (!line.compare("$EndPhysicalNames"))
+        if (nbyte > m_text.size() - m_pos)
         {
-            last_fmt_state = FormatState::PYHSICAL_NAME_END;
+            return false;
         }
+        bytes = m_text.substr(m_pos, nbyte);
+        m_pos += nbyte;
+        return true;
     }
 
-    void load_nodes(void)
+    // Parse the next number after white spaces, including line terminators.
+    // Only the white spaces are consumed if the number cannot be parsed.
+    template <typename T>
+    bool read(T & value)
     {
-        std::string line;
-        std::getline(stream, line);
-        auto nnode = std::stoul(line);
-
-        m_nds.remake(small_vector<size_t>{nnode, 3}, 0);
-
-        while (std::getline(stream, line) && line.find('$') == std::string::npos)
+        if (m_binary)
         {
-            auto tokens = tokenize(line, ' ');
-            // gmsh node index is 1-based index
-            m_nds(std::stoul(tokens[0]) - 1, 0) = std::stod(tokens[1]);
-            m_nds(std::stoul(tokens[0]) - 1, 1) = std::stod(tokens[2]);
-            m_nds(std::stoul(tokens[0]) - 1, 2) = std::stod(tokens[3]);
+            std::string_view bytes;
+            if (!take(sizeof(T), bytes))
+            {
+                return false;
+            }
+            value = load_binary<T>(bytes.data(), m_swap);
+            return true;
         }
-
-        if (!line.compare("$EndNodes"))
+        while (m_pos < m_text.size() && is_space(m_text[m_pos]))
+        {
+            ++m_pos;
+        }
+        char const * first = m_text.data() + m_pos;
+        char const * last = m_text.data() + m_text.size();
+        std::from_chars_result const result = parse(first, last, value);
+        if (std::errc() != result.ec)
         {
-            last_fmt_state = FormatState::NODE_END;
+            return false;
         }
+        m_pos += static_cast<size_t>(result.ptr - first);
+        return true;
     }
 
-    void load_elements(void)
-    {
-        std::string line;
-        std::getline(stream, line);
-        auto nelement = std::stoul(line);
-        std::vector<uint_type> usnds;
-
-        m_cltpn.remake(small_vector<size_t>{nelement}, 0);
-        m_elgrp.remake(small_vector<size_t>{nelement}, 0);
-        m_elgeo.remake(small_vector<size_t>{nelement}, 0);
-        m_eldim.remake(small_vector<size_t>{nelement}, 0);
+private:
 
-        uint_type idx = 0;
+    static bool is_space(char c)
+    {
+        return ' ' == c || '\t' == c || '\r' == c || '\n' == c;
+    }
 
-        while (std::getline(stream, line) && line.find('$') == std::string::npos && idx < nelement)
+    template <typename T>
+    static std::from_chars_result parse(char const * first, char const * last, T & value)
+    {
+        if constexpr (std::is_floating_point_v<T>)
         {
-            auto tokens = tokenize(line, ' ');
-
-            // parse element type
-            auto tpn = std::stoul(tokens[1]);
-            auto eldef = GmshElementDef::by_id(tpn);
-            // parse element tag
-            std::vector<uint_type> tag;
-            for (size_t i = 0; i < std::stoul(tokens[2]); ++i)
+#if defined(__cpp_lib_to_chars)
+            return std::from_chars(first, last, value);
+#else // __cpp_lib_to_chars
+            // Floating-point from_chars is not provided by every standard
+            // library.  Fall back to strtod over a null-terminated copy of the
+            // token.
+            std::array<char, 64> token{};
+            size_t ntoken = 0;
+            while (first + ntoken < last && ntoken < token.size() - 1 && !is_space(first[ntoken]))
             {
-                tag.push_back(std::stoul(tokens[3 + i]));
+                token[ntoken] = first[ntoken];
+                ++ntoken;
             }
-
-            // parse node number list
-            std::vector<uint_type> nds;
-            for (size_t i = 3 + std::stoul(tokens[2]); i < tokens.size(); ++i)
+            char * end = nullptr;
+            value = static_cast<T>(std::strtod(token.data(), &end));
+            if (end == token.data())
             {
-                nds.push_back(std::stoul(tokens[i]));
+                return {first, std::errc::invalid_argument};
             }
+            return {first + (end - token.data()), std::errc()};
+#endif // __cpp_lib_to_chars
+        }
+        else
+        {
+            return std::from_chars(first, last, value);
+        }
+    }
 
-            m_cltpn[idx] = eldef.mmtpn();
-            m_elgrp[idx] = tag[0];
-            m_elgeo[idx] = tag[1];
-            m_eldim[idx] = eldef.ndim();
+    std::string_view m_text;
+    size_t m_pos = 0;
+    bool m_binary = false;
+    bool m_swap = false;
 
-            small_vector<uint_type> nds_temp(nds.size() + 1, 0);
-            auto mmcl = eldef.mmcl();
+}; /* end class GmshTextCursor */
 
-            for (size_t i = 0; i < mmcl.size(); ++i)
-            {
-                nds_temp[mmcl[i] + 1] = nds[i] - 1;
-            }
-            usnds.insert(usnds.end(), nds_temp.begin() + 1, nds_temp.end());
-            nds_temp[0] = mmcl.size();
-            m_elems.insert(std::pair{idx, nds_temp});
-            idx++;
-        }
+struct GmshElementChunk;
 
-        if (!line.compare("$EndElements"))
-        {
-            last_fmt_state = FormatState::ELEMENT_END;
-        }
+} /* end namespace detail */
+
+class Gmsh
+    : public NumberBase<int32_t, double>
+{
+    using number_base = NumberBase<int32_t, double>;
+    using int_type = typename number_base::int_type;
+    using uint_type = typename number_base::uint_type;
+    using real_type = typename number_base::real_type;
 
-        // sorting used node and remove duplicate node id
-        std::sort(usnds.begin(), usnds.end());
-        auto remove = std::unique(usnds.begin(), usnds.end());
-        usnds.erase(remove, usnds.end());
+public:
+    // The text is only read during construction and does not need to live
+    // longer than the constructor.  When MeshCache is enabled and has the
+    // mesh built from the same text, the parsing is skipped and to_block()
+    // returns the cached mesh.
+    explicit Gmsh(std::string_view data);
 
-        // put used node id to m_ndmap
-        m_ndmap.remake(small_vector<size_t>{usnds.size()}, -1);
-        for (size_t i = 0; i < usnds.size(); ++i)
-        {
-            m_ndmap(usnds[i]) = i;
-        }
-    }
+    // Memory-map the file and parse it without reading it into a string.
+    static std::shared_ptr<Gmsh> from_file(std::string const & path);
+
+    ~Gmsh() = default;
+
+    Gmsh() = delete;
+    Gmsh(Gmsh const & other) = delete;
+    Gmsh(Gmsh && other) = delete;
+    Gmsh & operator=(Gmsh const & other) = delete;
+    Gmsh & operator=(Gmsh && other) = delete;
+
+    std::shared_ptr<StaticMesh> to_block(void);
+    // The coordinates are parsed in double and rounded once to float.  The
+    // single-precision mesh is not stored in MeshCache.
+    std::shared_ptr<StaticMeshFp32> to_block_fp32(void);
+
+private:
+    enum class FormatState
+    {
+        BEGIN,
+        META_END,
+        PYHSICAL_NAME_END,
+        ENTITY_END,
+        NODE_END,
+        ELEMENT_END
+    };
 
-    std::vector<std::string> tokenize(const std::string & str, const char delim)
+    // Check the finite state machine state transition is valid or not to check msh file format is correct
+    bool is_valid_transition(std::string_view s)
     {
-        std::vector<std::string> output;
-        std::stringstream ss(str);
-        std::string token;
-        while (std::getline(ss, token, delim))
+        if (last_fmt_state == FormatState::BEGIN)
+        {
+            return s == "$MeshFormat";
+        }
+        else if (last_fmt_state == FormatState::META_END || last_fmt_state == FormatState::PYHSICAL_NAME_END)
+        {
+            return s == "$PhysicalNames" || s == "$Nodes" || (s == "$Entities" && is_v4());
+        }
+        else if (last_fmt_state == FormatState::ENTITY_END)
+        {
+            return s == "$Nodes";
+        }
+        else if (last_fmt_state == FormatState::NODE_END)
         {
-            output.push_back(token);
+            return s == "$Elements";
         }
-        return output;
+
+        return false;
     }
 
-    void build_interior(const std::shared_ptr<StaticMesh> & blk);
+    void parse(std::string_view data);
+
+    void load_meta(detail::GmshTextCursor & cursor);
+    // TODO: PhysicalNames section parsing logic not complete yet, but without PhysicalNames section
+    //       modmesh mesh viewer still working, therefore we can finish this later.
+    void load_physical(detail::GmshTextCursor & cursor);
+    void load_nodes(detail::GmshTextCursor & cursor);
+    void load_elements(detail::GmshTextCursor & cursor);
+
+    // MSH 4.1 groups the nodes and elements in blocks of the geometrical
+    // entities, which have the physical tags.
+    bool is_v4() const { return msh_ver == 4.1; }
+    void load_entities(detail::GmshTextCursor & cursor);
+    void load_nodes_v4(detail::GmshTextCursor & cursor);
+    void load_elements_v4(detail::GmshTextCursor & cursor);
+
+    // Row of a node in m_nds.  The nodes of MSH 2.2 are in the rows of their
+    // 1-based tags.  Those of MSH 4.1 are in the order of appearance and
+    // mapped through m_ndindex.
+    uint_type node_index(size_t tag, size_t elid) const;
+
+    void merge_elements(std::vector<detail::GmshElementChunk> const & chunks, size_t nelement);
+
+    template <typename T>
+    void build_interior(const std::shared_ptr<BasicStaticMesh<T>> & blk);
 
-    std::stringstream stream;
     FormatState last_fmt_state = FormatState::BEGIN;
 
     real_type msh_ver = 0.0;
@@ -261,7 +356,18 @@ private:
     SimpleArray<uint_type> m_usnds;
     SimpleArray<uint_type> m_ndmap;
 
-    std::unordered_map<uint_type, small_vector<uint_type>> m_elems;
+    std::vector<uint_type> m_ndindex;
+    // The first physical tag of the geometrical entities of each dimension.
+    std::array<std::unordered_map<int_type, int_type>, 4> m_entity_physical;
+
+    // The vertices of element i are m_elnds[m_eloff[i]:m_eloff[i+1]] in the
+    // modmesh order.
+    SimpleArray<uint_type> m_eloff;
+    SimpleArray<uint_type> m_elnds;
+
+    // Key of the text in MeshCache, empty when the cache is disabled.
+    std::string m_cache_key;
+    std::shared_ptr<StaticMesh> m_cached;
 }; /* end class Gmsh */
 
 inline GmshElementDef GmshElementDef::by_id(uint16_t id)
@@ -1,4 +1,6 @@
 #pragma once
 #include <modmesh/inout/gmsh.hpp>
+#include <modmesh/inout/mesh_cache.hpp>
+#include <modmesh/inout/xdmf.hpp>
 
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
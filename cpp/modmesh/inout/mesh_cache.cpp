@@ -0,0 +1,297 @@
+#include <modmesh/inout/mesh_cache.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <vector>
+
+namespace modmesh
+{
+namespace inout
+{
+
+namespace detail
+{
+
+inline uint64_t rotl64(uint64_t value, int shift) { return (value << shift) | (value >> (64 - shift)); }
+
+inline uint64_t fmix64(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+struct Hash128
+{
+    uint64_t h1;
+    uint64_t h2;
+}; /* end struct Hash128 */
+
+// Two lanes of 64-bit multiply-rotate mixing over 8-byte words, as the body
+// of MurmurHash3.  Not cryptographic; 128 bits make an accidental collision
+// of mesh files negligible.
+Hash128 hash_serial(uint8_t const * data, size_t nbytes, uint64_t seed)
+{
+    constexpr uint64_t c1 = 0x87c37b91114253d5ULL;
+    constexpr uint64_t c2 = 0x4cf5ad432745937fULL;
+    uint64_t h1 = seed;
+    uint64_t h2 = seed ^ 0x9e3779b97f4a7c15ULL;
+    size_t const nblock = nbytes / 16;
+    for (size_t it = 0; it < nblock; ++it)
+    {
+        uint64_t k1 = 0;
+        uint64_t k2 = 0;
+        std::memcpy(&k1, data + it * 16, 8);
+        std::memcpy(&k2, data + it * 16 + 8, 8);
+        h1 ^= rotl64(k1 * c1, 31) * c2;
+        h1 = (rotl64(h1, 27) + h2) * 5 + 0x52dce729;
+        h2 ^= rotl64(k2 * c2, 33) * c1;
+        h2 = (rotl64(h2, 31) + h1) * 5 + 0x38495ab5;
+    }
+    uint8_t tail[16] = {}; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    std::memcpy(tail, data + nblock * 16, nbytes - nblock * 16);
+    uint64_t k1 = 0;
+    uint64_t k2 = 0;
+    std::memcpy(&k1, tail, 8);
+    std::memcpy(&k2, tail + 8, 8);
+    h1 ^= rotl64(k1 * c1, 31) * c2;
+    h2 ^= rotl64(k2 * c2, 33) * c1;
+    h1 ^= nbytes;
+    h2 ^= nbytes;
+    h1 += h2;
+    h2 += h1;
+    h1 = fmix64(h1);
+    h2 = fmix64(h2);
+    h1 += h2;
+    h2 += h1;
+    return Hash128{h1, h2};
+}
+
+/**
+ * Hash the chunks of the bytes in parallel, and then the sequence of the
+ * chunk hashes, so that the digest does not depend on the thread count.
+ */
+class ContentHasher
+{
+
+public:
+
+    static constexpr size_t CHUNK_SIZE = size_t(1) << 20;
+
+    void update(void const * data, size_t nbytes)
+    {
+        auto const * bytes = static_cast<uint8_t const *>(data);
+        size_t const nchunk = (nbytes + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        size_t const base = m_hashes.size();
+        m_hashes.resize(base + nchunk);
+        auto body = [&](size_t ichunk)
+        {
+            size_t const begin = ichunk * CHUNK_SIZE;
+            size_t const end = std::min(begin + CHUNK_SIZE, nbytes);
+            m_hashes[base + ichunk] = hash_serial(bytes + begin, end - begin, ichunk);
+        };
+        if (nchunk > 1 && ThreadPool::instance().use_parallel(nbytes))
+        {
+            ThreadPool::instance().run(nchunk, body);
+        }
+        else
+        {
+            for (size_t ichunk = 0; ichunk < nchunk; ++ichunk)
+            {
+                body(ichunk);
+            }
+        }
+        // Separate the inputs, so that moving bytes across them changes the digest.
+        m_hashes.push_back(Hash128{nbytes, ~uint64_t(nbytes)});
+    }
+
+    // Hash the body of the array, so that the ghost rows of a built mesh do
+    // not change the key.
+    template <typename T>
+    void update_body(SimpleArray<T> const & array)
+    {
+        uint64_t const ndim = array.ndim();
+        update(&ndim, sizeof(ndim));
+        for (size_t it = 0; it < array.ndim(); ++it)
+        {
+            uint64_t const extent = (0 == it) ? array.nbody() : array.shape(it);
+            update(&extent, sizeof(extent));
+        }
+        auto const body = array.body_range();
+        update(body.data(), body.size() * sizeof(T));
+    }
+
+    std::string hexdigest() const
+    {
+        Hash128 const hash = hash_serial(reinterpret_cast<uint8_t const *>(m_hashes.data()), m_hashes.size() * sizeof(Hash128), MeshCache::VERSION);
+        char buf[33]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+        std::snprintf(buf, sizeof(buf), "%016llx%016llx", static_cast<unsigned long long>(hash.h1), static_cast<unsigned long long>(hash.h2));
+        return std::string(buf);
+    }
+
+private:
+
+    std::vector<Hash128> m_hashes;
+
+}; /* end class ContentHasher */
+
+template <typename T>
+void copy_body(SimpleArray<T> const & src, SimpleArray<T> & dst)
+{
+    auto const body = src.body_range();
+    std::copy(body.begin(), body.end(), dst.body_range().begin());
+}
+
+} /* end namespace detail */
+
+MeshCache & MeshCache::instance()
+{
+    static MeshCache cache;
+    return cache;
+}
+
+MeshCache::MeshCache()
+{
+    char const * env = std::getenv("MODMESH_MESH_CACHE");
+    if (env != nullptr)
+    {
+        m_directory = env;
+    }
+}
+
+std::string MeshCache::directory() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_directory;
+}
+
+void MeshCache::set_directory(std::string directory)
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    m_directory = std::move(directory);
+}
+
+std::string MeshCache::make_key(std::string_view data, std::string_view options)
+{
+    detail::ContentHasher hasher;
+    hasher.update(options.data(), options.size());
+    hasher.update(data.data(), data.size());
+    return hasher.hexdigest();
+}
+
+std::string MeshCache::make_key(StaticMesh const & mesh, std::string_view options)
+{
+    detail::ContentHasher hasher;
+    hasher.update(options.data(), options.size());
+    hasher.update_body(mesh.ndcrd());
+    hasher.update_body(mesh.cltpn());
+    hasher.update_body(mesh.clgrp());
+    hasher.update_body(mesh.clnds());
+    return hasher.hexdigest();
+}
+
+std::string MeshCache::path_of(std::string const & key) const
+{
+    return (std::filesystem::path(directory()) / (key + ".mmesh")).string();
+}
+
+std::shared_ptr<StaticMesh> MeshCache::load(std::string const & key)
+{
+    std::string const path = path_of(key);
+    std::error_code ec;
+    if (enabled() && std::filesystem::is_regular_file(path, ec))
+    {
+        try
+        {
+            std::shared_ptr<StaticMesh> ret = StaticMesh::load_mmesh(path, /* mmap */ true);
+            m_nhit.fetch_add(1, std::memory_order_relaxed);
+            return ret;
+        }
+        catch (std::exception const &)
+        {
+            // A corrupt or stale entry is rebuilt.
+        }
+    }
+    m_nmiss.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+bool MeshCache::store(std::string const & key, StaticMesh const & mesh) const
+{
+    if (!enabled())
+    {
+        return false;
+    }
+    std::string const path = path_of(key);
+    // Every writer has its own temporary file; rename() replaces the entry
+    // atomically.
+    std::string const tmp_path = path + ".tmp" + std::to_string(std::random_device{}());
+    try
+    {
+        std::filesystem::create_directories(directory());
+        mesh.save_mmesh(tmp_path);
+        std::filesystem::rename(tmp_path, path);
+    }
+    catch (std::exception const &)
+    {
+        std::error_code ec;
+        std::filesystem::remove(tmp_path, ec);
+        return false;
+    }
+    return true;
+}
+
+std::shared_ptr<StaticMesh> MeshCache::get_or_build(std::string_view data, std::string_view options, std::function<std::shared_ptr<StaticMesh>()> const & build)
+{
+    if (!enabled())
+    {
+        return build();
+    }
+    std::string const key = make_key(data, options);
+    std::shared_ptr<StaticMesh> ret = load(key);
+    if (!ret)
+    {
+        ret = build();
+        store(key, *ret);
+    }
+    return ret;
+}
+
+std::shared_ptr<StaticMesh> MeshCache::build(StaticMesh const & mesh)
+{
+    std::string key;
+    if (enabled())
+    {
+        key = make_key(mesh, "StaticMesh.build");
+        std::shared_ptr<StaticMesh> ret = load(key);
+        if (ret)
+        {
+            return ret;
+        }
+    }
+    std::shared_ptr<StaticMesh> ret = StaticMesh::construct(mesh.ndim(), mesh.nnode(), 0, mesh.ncell());
+    detail::copy_body(mesh.ndcrd(), ret->ndcrd());
+    detail::copy_body(mesh.cltpn(), ret->cltpn());
+    detail::copy_body(mesh.clgrp(), ret->clgrp());
+    detail::copy_body(mesh.clnds(), ret->clnds());
+    ret->build_interior(true);
+    ret->build_boundary();
+    ret->build_ghost();
+    if (!key.empty())
+    {
+        store(key, *ret);
+    }
+    return ret;
+}
+
+} /* end namespace inout */
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
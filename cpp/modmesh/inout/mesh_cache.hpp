@@ -0,0 +1,88 @@
+#pragma once
+
+#include <modmesh/mesh/mesh.hpp>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace modmesh
+{
+namespace inout
+{
+
+/**
+ * Cache of fully built meshes in a directory shared by runs, keyed by a
+ * content hash of the input and the build options.  A mesh is stored in the
+ * native .mmesh format and a hit maps it copy-on-write instead of parsing
+ * and building again.
+ *
+ * The cache is disabled until a directory is set, either by
+ * set_directory() or by the MODMESH_MESH_CACHE environment variable.  An
+ * entry is written to a temporary file and renamed into place, so that
+ * concurrent jobs never see a partial entry.  An entry that fails to load
+ * is treated as a miss and replaced.
+ */
+class MeshCache
+{
+
+public:
+
+    /// Bump when the build of a cached mesh changes.
+    static constexpr uint32_t VERSION = 1;
+
+    static MeshCache & instance();
+
+    MeshCache(MeshCache const &) = delete;
+    MeshCache(MeshCache &&) = delete;
+    MeshCache & operator=(MeshCache const &) = delete;
+    MeshCache & operator=(MeshCache &&) = delete;
+    ~MeshCache() = default;
+
+    std::string directory() const;
+    /// An empty directory disables the cache.
+    void set_directory(std::string directory);
+    bool enabled() const { return !directory().empty(); }
+
+    /// Hex digest of the 128-bit hash of the data and the options.
+    static std::string make_key(std::string_view data, std::string_view options);
+    /// Key of the nodes and the cells in the body of a mesh; the ghost rows are ignored.
+    static std::string make_key(StaticMesh const & mesh, std::string_view options);
+
+    std::string path_of(std::string const & key) const;
+
+    /// Map the mesh of the key, or return nullptr on a miss.
+    std::shared_ptr<StaticMesh> load(std::string const & key);
+    /// Store the mesh.  Return false, without throwing, when it cannot be written.
+    bool store(std::string const & key, StaticMesh const & mesh) const;
+
+    /**
+     * Return the cached mesh of the data and the options, or call build and
+     * store its result.  build is called directly when the cache is disabled.
+     */
+    std::shared_ptr<StaticMesh> get_or_build(std::string_view data, std::string_view options, std::function<std::shared_ptr<StaticMesh>()> const & build);
+
+    /// Build the interior, the boundary and the ghost of a copy of the mesh, or map the cached result.
+    std::shared_ptr<StaticMesh> build(StaticMesh const & mesh);
+
+    size_t nhit() const { return m_nhit.load(std::memory_order_relaxed); }
+    size_t nmiss() const { return m_nmiss.load(std::memory_order_relaxed); }
+
+private:
+
+    MeshCache();
+
+    mutable std::mutex m_mutex;
+    std::string m_directory;
+    std::atomic<size_t> m_nhit{0};
+    std::atomic<size_t> m_nmiss{0};
+
+}; /* end class MeshCache */
+
+} /* end namespace inout */
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
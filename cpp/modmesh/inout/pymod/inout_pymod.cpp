@@ -20,6 +20,8 @@ void initialize_inout(pybind11::module & mod)
     auto initialize_impl = [](pybind11::module & mod)
     {
         wrap_Gmsh(mod);
+        wrap_MeshCache(mod);
+        wrap_XdmfWriter(mod);
     };
 
     OneTimeInitializer<inout_pymod_tag>::me()(mod, initialize_impl);
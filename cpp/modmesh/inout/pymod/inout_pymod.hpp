@@ -15,6 +15,8 @@ namespace python
 
 void initialize_inout(pybind11::module & mod);
 void wrap_Gmsh(pybind11::module & mod);
+void wrap_MeshCache(pybind11::module & mod);
+void wrap_XdmfWriter(pybind11::module & mod);
 
 } /* end namespace python */
 
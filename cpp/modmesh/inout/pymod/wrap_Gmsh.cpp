@@ -28,10 +28,27 @@ protected:
             .def(
                 py::init(
                     [](const py::bytes & data)
-                    { return std::make_shared<inout::Gmsh>(data); }),
+                    {
+                        // Parse the bytes in place without copying them into a string.
+                        char * buffer = nullptr;
+                        ssize_t length = 0;
+                        PyBytes_AsStringAndSize(data.ptr(), &buffer, &length);
+                        py::gil_scoped_release const release;
+                        return std::make_shared<inout::Gmsh>(std::string_view(buffer, static_cast<size_t>(length)));
+                    }),
                 py::arg("data"))
-            .def("to_block", &wrapped_type::to_block);
-        ;
+            .def_static(
+                "from_file",
+                [](std::string const & path)
+                {
+                    py::gil_scoped_release const release;
+                    return wrapped_type::from_file(path);
+                },
+                py::arg("path"))
+            .def("to_block", &wrapped_type::to_block)
+            .def("to_block_fp32", &wrapped_type::to_block_fp32)
+            //
+            ;
     }
 
 }; /* end class WrapGmsh */
@@ -0,0 +1,73 @@
+#include <modmesh/inout/pymod/inout_pymod.hpp>
+#include <modmesh/modmesh.hpp>
+
+namespace modmesh
+{
+
+namespace python
+{
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapMeshCache
+    : public WrapBase<WrapMeshCache, inout::MeshCache>
+{
+public:
+
+    using base_type = WrapBase<WrapMeshCache, inout::MeshCache>;
+    using wrapped_type = typename base_type::wrapped_type;
+
+    friend root_base_type;
+
+protected:
+
+    WrapMeshCache(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11; // NOLINT(misc-unused-alias-decls)
+
+        (*this)
+            .def_property_readonly_static(
+                "instance",
+                [](py::object const &) -> auto &
+                {
+                    return wrapped_type::instance();
+                })
+            .def_property("directory", &wrapped_type::directory, &wrapped_type::set_directory)
+            .def_property_readonly("enabled", &wrapped_type::enabled)
+            .def_property_readonly("nhit", &wrapped_type::nhit)
+            .def_property_readonly("nmiss", &wrapped_type::nmiss)
+            .def_static(
+                "make_key",
+                [](py::bytes const & data, std::string const & options)
+                {
+                    char * buffer = nullptr;
+                    ssize_t length = 0;
+                    PyBytes_AsStringAndSize(data.ptr(), &buffer, &length);
+                    return wrapped_type::make_key(std::string_view(buffer, static_cast<size_t>(length)), options);
+                },
+                py::arg("data"),
+                py::arg("options") = "")
+            .def("path_of", &wrapped_type::path_of, py::arg("key"))
+            .def(
+                "build",
+                [](wrapped_type & self, StaticMesh const & mesh)
+                {
+                    py::gil_scoped_release const release;
+                    return self.build(mesh);
+                },
+                py::arg("mesh"))
+            //
+            ;
+    }
+
+}; /* end class WrapMeshCache */
+
+void wrap_MeshCache(pybind11::module & mod)
+{
+    WrapMeshCache::commit(mod, "MeshCache", "Content-addressed cache of built meshes");
+}
+
+} /* end namespace python */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
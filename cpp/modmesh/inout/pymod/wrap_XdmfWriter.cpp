@@ -0,0 +1,79 @@
+#include <modmesh/inout/pymod/inout_pymod.hpp>
+#include <modmesh/modmesh.hpp>
+
+namespace modmesh
+{
+
+namespace python
+{
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapXdmfWriter
+    : public WrapBase<WrapXdmfWriter, inout::XdmfWriter, std::shared_ptr<inout::XdmfWriter>>
+{
+public:
+
+    using base_type = WrapBase<WrapXdmfWriter, inout::XdmfWriter, std::shared_ptr<inout::XdmfWriter>>;
+    using wrapped_type = typename base_type::wrapped_type;
+    using real_type = typename wrapped_type::real_type;
+
+    friend root_base_type;
+
+protected:
+
+    WrapXdmfWriter(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : WrapBase<WrapXdmfWriter, inout::XdmfWriter, std::shared_ptr<inout::XdmfWriter>>(mod, pyname, pydoc)
+    {
+        namespace py = pybind11; // NOLINT(misc-unused-alias-decls)
+
+        (*this)
+            .def(
+                py::init(
+                    [](std::string const & path, StaticMesh const & mesh, size_t max_pending)
+                    { return std::make_shared<wrapped_type>(path, mesh, max_pending); }),
+                py::arg("path"),
+                py::arg("mesh"),
+                py::arg("max_pending") = wrapped_type::DEFAULT_MAX_PENDING)
+            .def_property_readonly("path", &wrapped_type::path)
+            .def_property_readonly("heavy_path", &wrapped_type::heavy_path)
+            .def_property_readonly("max_pending", &wrapped_type::max_pending)
+            .def_property_readonly("nstep", &wrapped_type::nstep)
+            .def_property_readonly("is_closed", &wrapped_type::is_closed)
+            .def(
+                "write",
+                [](wrapped_type & self, real_type time, py::dict const & cell, py::dict const & node)
+                {
+                    // Snapshot the arrays while holding the GIL; the writer
+                    // thread owns the snapshots afterwards.
+                    std::vector<wrapped_type::Field> fields;
+                    for (auto const & [name, array] : cell)
+                    {
+                        fields.push_back({name.cast<std::string>(), array.cast<SimpleArray<real_type>>(), true});
+                    }
+                    for (auto const & [name, array] : node)
+                    {
+                        fields.push_back({name.cast<std::string>(), array.cast<SimpleArray<real_type>>(), false});
+                    }
+                    py::gil_scoped_release const release;
+                    self.write(time, std::move(fields));
+                },
+                py::arg("time"),
+                py::arg("cell") = py::dict(),
+                py::arg("node") = py::dict())
+            .def("flush", &wrapped_type::flush, py::call_guard<py::gil_scoped_release>())
+            .def("close", &wrapped_type::close, py::call_guard<py::gil_scoped_release>())
+            //
+            ;
+    }
+
+}; /* end class WrapXdmfWriter */
+
+void wrap_XdmfWriter(pybind11::module & mod)
+{
+    WrapXdmfWriter::commit(mod, "XdmfWriter", "Write a StaticMesh and its fields to XDMF in a background thread");
+}
+
+} /* end namespace python */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
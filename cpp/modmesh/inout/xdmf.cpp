@@ -0,0 +1,364 @@
+#include <modmesh/inout/xdmf.hpp>
+
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace modmesh
+{
+namespace inout
+{
+
+namespace detail
+{
+
+// XDMF cell type number of a modmesh cell type, of which the node order
+// is the same as XDMF (and VTK).
+int32_t xdmf_cell_type(int32_t tpn)
+{
+    switch (tpn)
+    {
+    case CellType::POINT: return 1; // Polyvertex
+    case CellType::LINE: return 2; // Polyline
+    case CellType::QUADRILATERAL: return 5;
+    case CellType::TRIANGLE: return 4;
+    case CellType::HEXAHEDRON: return 9;
+    case CellType::TETRAHEDRON: return 6;
+    case CellType::PRISM: return 8; // Wedge
+    case CellType::PYRAMID: return 7;
+    default: throw std::invalid_argument(Formatter() << "XdmfWriter: unsupported cell type " << tpn);
+    }
+}
+
+std::string xml_escape(std::string const & text)
+{
+    std::string ret;
+    ret.reserve(text.size());
+    for (char const c : text)
+    {
+        switch (c)
+        {
+        case '&': ret += "&amp;"; break;
+        case '<': ret += "&lt;"; break;
+        case '>': ret += "&gt;"; break;
+        case '"': ret += "&quot;"; break;
+        default: ret += c; break;
+        }
+    }
+    return ret;
+}
+
+std::string heavy_path_of(std::string const & path)
+{
+    for (char const * suffix : {".xmf", ".xdmf"})
+    {
+        size_t const nsuffix = std::strlen(suffix);
+        if (path.size() > nsuffix && 0 == path.compare(path.size() - nsuffix, nsuffix, suffix))
+        {
+            return path.substr(0, path.size() - nsuffix) + ".bin";
+        }
+    }
+    return path + ".bin";
+}
+
+// The heavy data are referred to relative to the directory of the .xmf file.
+std::string basename_of(std::string const & path)
+{
+    size_t const pos = path.find_last_of("/\\");
+    return std::string::npos == pos ? path : path.substr(pos + 1);
+}
+
+bool is_little_endian()
+{
+    uint16_t const one = 1;
+    uint8_t byte = 0;
+    std::memcpy(&byte, &one, 1);
+    return 1 == byte;
+}
+
+} /* end namespace detail */
+
+XdmfWriter::XdmfWriter(std::string const & path, StaticMesh const & mesh, size_t max_pending)
+    : m_path(path)
+    , m_heavy_path(detail::heavy_path_of(path))
+    , m_max_pending(std::max(max_pending, size_t(1)))
+    , m_ndim(mesh.ndim())
+    , m_nnode(mesh.nnode())
+    , m_ncell(mesh.ncell())
+{
+    if (m_ndim < 2 || m_ndim > 3)
+    {
+        throw std::invalid_argument(Formatter() << "XdmfWriter: mesh of dimension " << static_cast<int>(m_ndim) << " is not supported");
+    }
+
+    // Take the geometry and the mixed topology of the body now, so that the
+    // mesh may change afterwards.  A polyvertex or a polyline has the number
+    // of its nodes after the type.
+    std::vector<real_type> geometry(m_nnode * m_ndim);
+    for (size_t ind = 0; ind < m_nnode; ++ind)
+    {
+        for (size_t idm = 0; idm < m_ndim; ++idm)
+        {
+            geometry[ind * m_ndim + idm] = mesh.ndcrd(ind, idm);
+        }
+    }
+    std::vector<int32_t> topology;
+    topology.reserve(m_ncell * (StaticMesh::CLMND + 2));
+    for (size_t icl = 0; icl < m_ncell; ++icl)
+    {
+        int32_t const type = detail::xdmf_cell_type(mesh.cltpn(icl));
+        int_type const nnd = mesh.clnds(icl, 0);
+        topology.push_back(type);
+        if (type <= 2)
+        {
+            topology.push_back(nnd);
+        }
+        for (int_type it = 1; it <= nnd; ++it)
+        {
+            topology.push_back(mesh.clnds(icl, it));
+        }
+    }
+
+    m_heavy.open(m_heavy_path, std::ios::binary | std::ios::trunc);
+    if (!m_heavy)
+    {
+        throw std::runtime_error(Formatter() << "XdmfWriter: cannot open \"" << m_heavy_path << "\" for writing");
+    }
+
+    m_thread = std::thread([this]()
+                           { run(); });
+    enqueue(
+        [this, geometry = std::move(geometry), topology = std::move(topology)]()
+        {
+            m_topology_offset = append(topology.data(), topology.size() * sizeof(int32_t));
+            m_topology_size = topology.size();
+            m_geometry_offset = append(geometry.data(), geometry.size() * sizeof(real_type));
+            write_light();
+        });
+}
+
+XdmfWriter::~XdmfWriter()
+{
+    try
+    {
+        close();
+    }
+    catch (...) // NOLINT(bugprone-empty-catch)
+    {
+        // A destructor must not throw; the error was for flush() to report.
+    }
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+void XdmfWriter::write(real_type time, std::vector<Field> fields)
+{
+    if (m_closed)
+    {
+        throw std::runtime_error("XdmfWriter: write after close");
+    }
+    rethrow();
+    for (Field const & field : fields)
+    {
+        size_t const nrow = field.cell ? m_ncell : m_nnode;
+        if (field.name.empty())
+        {
+            throw std::invalid_argument("XdmfWriter: field name must not be empty");
+        }
+        if (field.array.ndim() < 1 || field.array.ndim() > 2 || field.array.nbody() != nrow)
+        {
+            throw std::invalid_argument(Formatter() << "XdmfWriter: field \"" << field.name << "\" must have "
+                                                    << nrow << " body rows of " << (field.cell ? "cells" : "nodes")
+                                                    << " in 1 or 2 dimensions");
+        }
+    }
+
+    ++m_nstep;
+    enqueue(
+        [this, time, fields = std::move(fields)]()
+        {
+            Step step{time, {}};
+            for (Field const & field : fields)
+            {
+                SimpleArray<real_type> const & array = field.array;
+                size_t const nrow = array.nbody();
+                size_t const ncol = array.ndim() > 1 ? array.shape(1) : 1;
+                auto const body = array.body_range();
+                size_t const offset = append(body.data(), body.size() * sizeof(real_type));
+                step.items.push_back({field.name, field.cell, nrow, ncol, offset});
+            }
+            m_steps.push_back(std::move(step));
+            write_light();
+        });
+}
+
+void XdmfWriter::flush()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this]()
+                    { return m_jobs.empty() && !m_busy; });
+    }
+    rethrow();
+}
+
+void XdmfWriter::close()
+{
+    if (m_closed)
+    {
+        return;
+    }
+    m_closed = true;
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+    m_heavy.close();
+    rethrow();
+}
+
+void XdmfWriter::enqueue(std::function<void()> job)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // Backpressure: wait for the thread when too many steps are pending.
+        m_done.wait(lock, [this]()
+                    { return m_jobs.size() < m_max_pending; });
+        m_jobs.push_back(std::move(job));
+    }
+    m_wake.notify_one();
+}
+
+void XdmfWriter::run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_wake.wait(lock, [this]()
+                    { return m_stop || !m_jobs.empty(); });
+        if (m_jobs.empty())
+        {
+            // Stop only after the queued jobs are done.
+            break;
+        }
+        std::function<void()> job = std::move(m_jobs.front());
+        m_jobs.pop_front();
+        m_busy = true;
+        lock.unlock();
+        m_done.notify_all();
+        // Skip the remaining jobs after an error, which leaves the files at
+        // the last complete step.  Only this thread sets the error.
+        std::exception_ptr error;
+        if (!m_error)
+        {
+            try
+            {
+                job();
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+        }
+        lock.lock();
+        if (error)
+        {
+            m_error = error;
+        }
+        m_busy = false;
+        m_done.notify_all();
+    }
+}
+
+void XdmfWriter::rethrow()
+{
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        error = m_error;
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+size_t XdmfWriter::append(void const * data, size_t nbytes)
+{
+    size_t const offset = m_heavy_size;
+    m_heavy.write(static_cast<char const *>(data), static_cast<std::streamsize>(nbytes));
+    m_heavy.flush();
+    if (!m_heavy)
+    {
+        throw std::runtime_error(Formatter() << "XdmfWriter: failed to write \"" << m_heavy_path << "\"");
+    }
+    m_heavy_size += nbytes;
+    return offset;
+}
+
+void XdmfWriter::write_light() const
+{
+    std::string const heavy = detail::xml_escape(detail::basename_of(m_heavy_path));
+    char const * endian = detail::is_little_endian() ? "Little" : "Big";
+    auto data_item = [&](std::ostream & os, char const * indent, std::string const & dims, char const * type, size_t precision, size_t offset)
+    {
+        os << indent << "<DataItem Dimensions=\"" << dims << "\" NumberType=\"" << type
+           << "\" Precision=\"" << precision << "\" Format=\"Binary\" Endian=\"" << endian
+           << "\" Seek=\"" << offset << "\">" << heavy << "</DataItem>\n";
+    };
+
+    std::ostringstream os;
+    os << std::setprecision(std::numeric_limits<real_type>::max_digits10);
+    os << "<?xml version=\"1.0\" ?>\n"
+       << "<Xdmf Version=\"3.0\">\n"
+       << "  <Domain>\n"
+       << "    <Grid Name=\"TimeSeries\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+    // A step without any field still shows the mesh.
+    std::vector<Step> const empty{Step{0.0, {}}};
+    std::vector<Step> const & steps = m_steps.empty() ? empty : m_steps;
+    for (size_t istep = 0; istep < steps.size(); ++istep)
+    {
+        Step const & step = steps[istep];
+        os << "      <Grid Name=\"step" << istep << "\" GridType=\"Uniform\">\n"
+           << "        <Time Value=\"" << step.time << "\" />\n"
+           << "        <Topology TopologyType=\"Mixed\" NumberOfElements=\"" << m_ncell << "\">\n";
+        data_item(os, "          ", std::to_string(m_topology_size), "Int", sizeof(int32_t), m_topology_offset);
+        os << "        </Topology>\n"
+           << "        <Geometry GeometryType=\"" << (3 == m_ndim ? "XYZ" : "XY") << "\">\n";
+        data_item(os, "          ", std::to_string(m_nnode) + " " + std::to_string(m_ndim), "Float", sizeof(real_type), m_geometry_offset);
+        os << "        </Geometry>\n";
+        for (Item const & item : step.items)
+        {
+            char const * type = 1 == item.ncol ? "Scalar" : (3 == item.ncol ? "Vector" : "Matrix");
+            std::string const dims = std::to_string(item.nrow) + (1 == item.ncol ? "" : " " + std::to_string(item.ncol));
+            os << "        <Attribute Name=\"" << detail::xml_escape(item.name) << "\" AttributeType=\"" << type
+               << "\" Center=\"" << (item.cell ? "Cell" : "Node") << "\">\n";
+            data_item(os, "          ", dims, "Float", sizeof(real_type), item.offset);
+            os << "        </Attribute>\n";
+        }
+        os << "      </Grid>\n";
+    }
+    os << "    </Grid>\n"
+       << "  </Domain>\n"
+       << "</Xdmf>\n";
+
+    std::ofstream light(m_path, std::ios::trunc);
+    light << os.str();
+    if (!light)
+    {
+        throw std::runtime_error(Formatter() << "XdmfWriter: failed to write \"" << m_path << "\"");
+    }
+}
+
+} /* end namespace inout */
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <modmesh/buffer/buffer.hpp>
+#include <modmesh/mesh/mesh.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace modmesh
+{
+namespace inout
+{
+
+/**
+ * Write the body of a StaticMesh and the time series of its fields in the
+ * XDMF format read by ParaView.  The light data go to the .xmf file at path,
+ * which is rewritten after every step so that it is always complete.  The
+ * heavy data are appended to a raw binary file next to it, with the same
+ * stem and the .bin suffix, and referred to by the offsets.
+ *
+ * The geometry and the topology are written once.  The fields of every step
+ * are written by a background thread, which owns the snapshots of the arrays
+ * passed to write().  A snapshot of an array allocated by a copy-on-write
+ * memory resource shares the pages until the solver modifies them, so that
+ * the output does not stall the time marching.  At most max_pending steps
+ * wait for the thread; write() blocks when there are more.
+ */
+class XdmfWriter
+{
+
+public:
+
+    using real_type = StaticMesh::real_type;
+    using int_type = StaticMesh::int_type;
+
+    static constexpr size_t DEFAULT_MAX_PENDING = 2;
+
+    /// A field of the body cells or the nodes, with one row per cell or node.
+    struct Field
+    {
+        std::string name;
+        SimpleArray<real_type> array;
+        bool cell = true;
+    }; /* end struct Field */
+
+    XdmfWriter(std::string const & path, StaticMesh const & mesh, size_t max_pending = DEFAULT_MAX_PENDING);
+
+    XdmfWriter() = delete;
+    XdmfWriter(XdmfWriter const &) = delete;
+    XdmfWriter(XdmfWriter &&) = delete;
+    XdmfWriter & operator=(XdmfWriter const &) = delete;
+    XdmfWriter & operator=(XdmfWriter &&) = delete;
+    // Wait for the pending steps without throwing their errors.
+    ~XdmfWriter();
+
+    std::string const & path() const { return m_path; }
+    std::string const & heavy_path() const { return m_heavy_path; }
+    size_t max_pending() const { return m_max_pending; }
+    /// Number of the steps passed to write().
+    size_t nstep() const { return m_nstep; }
+
+    /**
+     * Queue a step at the time with the fields.  The shape of each field is
+     * checked before queueing.  An error of the background thread from an
+     * earlier step is rethrown.
+     */
+    void write(real_type time, std::vector<Field> fields);
+
+    /// Wait for all the queued steps and rethrow the error of the thread.
+    void flush();
+
+    /// Flush and stop the thread.  Further write() is an error.
+    void close();
+
+    bool is_closed() const { return m_closed; }
+
+private:
+
+    struct Item
+    {
+        std::string name;
+        bool cell;
+        size_t nrow;
+        size_t ncol;
+        size_t offset;
+    }; /* end struct Item */
+
+    struct Step
+    {
+        real_type time;
+        std::vector<Item> items;
+    }; /* end struct Step */
+
+    void enqueue(std::function<void()> job);
+    void run();
+    void rethrow();
+
+    // Append the bytes to the heavy data file and return their offset.
+    size_t append(void const * data, size_t nbytes);
+    void write_light() const;
+
+    std::string m_path;
+    std::string m_heavy_path;
+    size_t m_max_pending;
+    size_t m_nstep = 0;
+    bool m_closed = false;
+
+    uint8_t m_ndim = 0;
+    size_t m_nnode = 0;
+    size_t m_ncell = 0;
+
+    // Owned by the thread once it starts.
+    std::ofstream m_heavy;
+    size_t m_heavy_size = 0;
+    size_t m_topology_offset = 0;
+    size_t m_topology_size = 0;
+    size_t m_geometry_offset = 0;
+    std::vector<Step> m_steps;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    std::deque<std::function<void()>> m_jobs;
+    bool m_busy = false;
+    bool m_stop = false;
+    std::exception_ptr m_error;
+    std::thread m_thread;
+
+}; /* end class XdmfWriter */
+
+} /* end namespace inout */
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,212 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMeshPartition.hpp>
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace modmesh
+{
+
+/**
+ * Exchange of the halo cell values of a per-cell SimpleArray between the
+ * ranks running the parts of a decomposed mesh, one part per rank of the
+ * communicator.  The send and receive buffers and the persistent MPI
+ * requests are set up once from the exchange lists of the part, so an
+ * exchange only packs, starts, waits and unpacks.
+ *
+ * To overlap computing with communication, call start(), update the
+ * interior_cells() that do not read the halo, call finish(), and then update
+ * the border_cells().
+ */
+template <typename T>
+class HaloExchange
+{
+
+public:
+
+    static constexpr int TAG = 4703;
+
+    /**
+     * @param[in] part  the part of this rank.
+     * @param[in] comm  communicator of which rank i runs part i.
+     * @param[in] width number of elements of T per cell.
+     */
+    HaloExchange(StaticMeshPart const & part, MPI_Comm comm, size_t width = 1)
+        : m_width(width)
+        , m_ncell(part.mesh->ncell())
+        , m_send_cells(part.send_cells.begin(), part.send_cells.end())
+        , m_recv_cells(part.recv_cells.begin(), part.recv_cells.end())
+        , m_send_buffer(m_send_cells.size() * width)
+        , m_recv_buffer(m_recv_cells.size() * width)
+    {
+        size_t const nneighbor = part.neighbor_parts.size();
+        m_requests.reserve(2 * nneighbor);
+        // The receives go first so that MPI_Startall can post them before
+        // the sends.
+        for (size_t it = 0; it < nneighbor; ++it)
+        {
+            size_t const begin = static_cast<size_t>(part.recv_offsets[it]) * width;
+            size_t const count = static_cast<size_t>(part.recv_offsets[it + 1]) * width - begin;
+            m_requests.emplace_back();
+            MPI_Recv_init(m_recv_buffer.data() + begin, static_cast<int>(count * sizeof(T)), MPI_BYTE, part.neighbor_parts[it], TAG, comm, &m_requests.back());
+        }
+        for (size_t it = 0; it < nneighbor; ++it)
+        {
+            size_t const begin = static_cast<size_t>(part.send_offsets[it]) * width;
+            size_t const count = static_cast<size_t>(part.send_offsets[it + 1]) * width - begin;
+            m_requests.emplace_back();
+            MPI_Send_init(m_send_buffer.data() + begin, static_cast<int>(count * sizeof(T)), MPI_BYTE, part.neighbor_parts[it], TAG, comm, &m_requests.back());
+        }
+
+        // Owned cells reading a halo cell across a face are on the border.
+        StaticMeshAdjacency const & cell_cells = part.mesh->cell_cells();
+        for (size_t icl = 0; icl < part.nowned_cell; ++icl)
+        {
+            bool border = false;
+            for (int32_t const jcl : cell_cells.row(icl))
+            {
+                border = border || static_cast<size_t>(jcl) >= part.nowned_cell;
+            }
+            (border ? m_border_cells : m_interior_cells).push_back(static_cast<int32_t>(icl));
+        }
+    }
+
+    HaloExchange() = delete;
+    HaloExchange(HaloExchange const &) = delete;
+    HaloExchange(HaloExchange &&) = delete;
+    HaloExchange & operator=(HaloExchange const &) = delete;
+    HaloExchange & operator=(HaloExchange &&) = delete;
+
+    ~HaloExchange()
+    {
+        if (m_started && !m_requests.empty())
+        {
+            MPI_Waitall(static_cast<int>(m_requests.size()), m_requests.data(), MPI_STATUSES_IGNORE);
+        }
+        for (MPI_Request & request : m_requests)
+        {
+            MPI_Request_free(&request);
+        }
+    }
+
+    size_t width() const { return m_width; }
+    /// Owned cells none of whose face neighbors is a halo cell.
+    std::vector<int32_t> const & interior_cells() const { return m_interior_cells; }
+    /// Owned cells having a halo cell as a face neighbor.
+    std::vector<int32_t> const & border_cells() const { return m_border_cells; }
+
+    /// Pack the owned values the neighbors need and start the transfers.
+    void start(SimpleArray<T> const & field)
+    {
+        validate(field);
+        if (m_started)
+        {
+            throw std::runtime_error("HaloExchange: start is called twice without finish");
+        }
+        // A part without neighbors has no requests to start.
+        size_t const nrecv = m_requests.size() / 2;
+        if (nrecv > 0)
+        {
+            MPI_Startall(static_cast<int>(nrecv), m_requests.data());
+        }
+        T const * src = field.body();
+        T * dst = m_send_buffer.data();
+        for (int32_t const icl : m_send_cells)
+        {
+            dst = std::copy_n(src + static_cast<size_t>(icl) * m_width, m_width, dst);
+        }
+        if (nrecv > 0)
+        {
+            MPI_Startall(static_cast<int>(m_requests.size() - nrecv), m_requests.data() + nrecv);
+        }
+        m_started = true;
+    }
+
+    /// Wait for the transfers and unpack the halo values.
+    void finish(SimpleArray<T> & field)
+    {
+        validate(field);
+        if (!m_started)
+        {
+            throw std::runtime_error("HaloExchange: finish is called without start");
+        }
+        if (!m_requests.empty())
+        {
+            MPI_Waitall(static_cast<int>(m_requests.size()), m_requests.data(), MPI_STATUSES_IGNORE);
+        }
+        m_started = false;
+        T const * src = m_recv_buffer.data();
+        T * dst = field.body();
+        for (int32_t const icl : m_recv_cells)
+        {
+            std::copy_n(src, m_width, dst + static_cast<size_t>(icl) * m_width);
+            src += m_width;
+        }
+    }
+
+    void exchange(SimpleArray<T> & field)
+    {
+        start(field);
+        finish(field);
+    }
+
+private:
+
+    void validate(SimpleArray<T> const & field) const
+    {
+        if (0 == field.ndim() || field.nbody() != m_ncell || field.size() - field.nghost() * field.stride(0) != m_ncell * m_width)
+        {
+            throw std::invalid_argument(
+                Formatter() << "HaloExchange: the field body must have " << m_ncell << " cells of "
+                            << m_width << " elements");
+        }
+    }
+
+    size_t m_width;
+    size_t m_ncell;
+    std::vector<int32_t> m_send_cells;
+    std::vector<int32_t> m_recv_cells;
+    std::vector<T> m_send_buffer;
+    std::vector<T> m_recv_buffer;
+    std::vector<MPI_Request> m_requests;
+    std::vector<int32_t> m_interior_cells;
+    std::vector<int32_t> m_border_cells;
+    bool m_started = false;
+
+}; /* end class HaloExchange */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,309 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMesh.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace modmesh
+{
+
+/**
+ * Sparse matrix in the compressed sparse row (CSR) format on SimpleArray.
+ * The columns of row i are indices[offsets[i]:offsets[i+1]] in ascending
+ * order, and their values are at the same positions of values.  The offsets
+ * and the indices are int32 like the connectivity of StaticMesh, so that
+ * SciPy takes the arrays without copying.
+ *
+ * The assembly is split into the symbolic and the numeric stages.  The
+ * pattern is built once, e.g., from the adjacency of a mesh, and is fixed
+ * afterward.  Each step clears the values with zero() and adds the entries
+ * into the pattern with add().
+ */
+template <typename T>
+class SparseMatrix
+{
+
+public:
+
+    using value_type = T;
+    using index_type = int32_t;
+
+    /// Take the pattern of ascending and unique columns in each row.  The values are zero.
+    SparseMatrix(size_t ncol, SimpleArray<index_type> offsets, SimpleArray<index_type> indices)
+        : m_ncol(ncol)
+        , m_offsets(std::move(offsets))
+        , m_indices(std::move(indices))
+    {
+        if (1 != m_offsets.ndim() || 0 == m_offsets.size() || 0 != m_offsets[0])
+        {
+            throw std::invalid_argument("SparseMatrix: offsets must be one-dimensional and start with 0");
+        }
+        if (1 != m_indices.ndim() || static_cast<size_t>(m_offsets[m_offsets.size() - 1]) != m_indices.size())
+        {
+            throw std::invalid_argument(Formatter() << "SparseMatrix: indices must be one-dimensional of the "
+                                                    << m_offsets[m_offsets.size() - 1] << " entries of offsets");
+        }
+        for (size_t irow = 0; irow < nrow(); ++irow)
+        {
+            if (m_offsets[irow + 1] < m_offsets[irow])
+            {
+                throw std::invalid_argument(Formatter() << "SparseMatrix: offsets decrease at row " << irow);
+            }
+            for (index_type it = m_offsets[irow]; it < m_offsets[irow + 1]; ++it)
+            {
+                index_type const icol = m_indices[static_cast<size_t>(it)];
+                if (icol < 0 || static_cast<size_t>(icol) >= m_ncol || (it > m_offsets[irow] && icol <= m_indices[static_cast<size_t>(it) - 1]))
+                {
+                    throw std::invalid_argument(Formatter() << "SparseMatrix: the columns of row " << irow
+                                                            << " are not ascending and unique in [0, " << m_ncol << ")");
+                }
+            }
+        }
+        m_values = SimpleArray<T>(small_vector<size_t>{m_indices.size()}, T(0));
+    }
+
+    /**
+     * The pattern of the rows of the adjacency with the columns in [0, ncol)
+     * and, when diagonal is true, the diagonal.  The columns are sorted and
+     * the duplicates are dropped.
+     */
+    static SparseMatrix from_adjacency(StaticMeshAdjacency const & adj, size_t ncol, bool diagonal)
+    {
+        size_t const nrow = adj.nrow();
+        auto collect = [&](size_t irow, std::vector<index_type> & cols)
+        {
+            cols.clear();
+            for (int32_t const icol : adj.row(irow))
+            {
+                if (icol >= 0 && static_cast<size_t>(icol) < ncol)
+                {
+                    cols.push_back(icol);
+                }
+            }
+            if (diagonal && irow < ncol)
+            {
+                cols.push_back(static_cast<index_type>(irow));
+            }
+            std::sort(cols.begin(), cols.end());
+            cols.erase(std::unique(cols.begin(), cols.end()), cols.end());
+        };
+
+        bool const parallel = ThreadPool::instance().use_parallel(nrow);
+        SimpleArray<index_type> offsets(nrow + 1);
+        offsets[0] = 0;
+        parallel_for_chunks(
+            nrow,
+            parallel,
+            [&](size_t begin, size_t end)
+            {
+                std::vector<index_type> cols;
+                for (size_t irow = begin; irow < end; ++irow)
+                {
+                    collect(irow, cols);
+                    offsets[irow + 1] = static_cast<index_type>(cols.size());
+                }
+            });
+        int64_t running = 0;
+        for (size_t irow = 1; irow <= nrow; ++irow)
+        {
+            running += offsets[irow];
+            if (running > std::numeric_limits<index_type>::max())
+            {
+                throw std::overflow_error(Formatter() << "SparseMatrix: more than " << std::numeric_limits<index_type>::max()
+                                                      << " entries");
+            }
+            offsets[irow] = static_cast<index_type>(running);
+        }
+        SimpleArray<index_type> indices(static_cast<size_t>(running));
+        parallel_for_chunks(
+            nrow,
+            parallel,
+            [&](size_t begin, size_t end)
+            {
+                std::vector<index_type> cols;
+                for (size_t irow = begin; irow < end; ++irow)
+                {
+                    collect(irow, cols);
+                    std::copy(cols.begin(), cols.end(), indices.data() + offsets[irow]);
+                }
+            });
+        return SparseMatrix(ncol, std::move(offsets), std::move(indices));
+    }
+
+    /// The operator on the body cells coupling each cell with those sharing a face.
+    template <typename M>
+    static SparseMatrix from_cell_cells(M const & mesh)
+    {
+        return from_adjacency(mesh.cell_cells(), mesh.ncell(), /* diagonal */ true);
+    }
+
+    /// The operator on the nodes coupling each node with those sharing an edge.
+    template <typename M>
+    static SparseMatrix from_node_nodes(M const & mesh)
+    {
+        size_t const nnode = mesh.nnode();
+        auto const & ednds = mesh.ednds();
+        StaticMeshAdjacency adj{SimpleArray<uint64_t>(small_vector<size_t>{nnode + 1}, 0), SimpleArray<int32_t>()};
+        for (size_t ied = 0; ied < mesh.nedge(); ++ied)
+        {
+            ++adj.offsets[static_cast<size_t>(ednds(ied, 0)) + 1];
+            ++adj.offsets[static_cast<size_t>(ednds(ied, 1)) + 1];
+        }
+        for (size_t ind = 0; ind < nnode; ++ind)
+        {
+            adj.offsets[ind + 1] += adj.offsets[ind];
+        }
+        adj.indices = SimpleArray<int32_t>(static_cast<size_t>(adj.offsets[nnode]));
+        std::vector<uint64_t> cursor(adj.offsets.begin(), adj.offsets.end() - 1);
+        for (size_t ied = 0; ied < mesh.nedge(); ++ied)
+        {
+            auto const nd0 = static_cast<size_t>(ednds(ied, 0));
+            auto const nd1 = static_cast<size_t>(ednds(ied, 1));
+            adj.indices[cursor[nd0]++] = static_cast<int32_t>(nd1);
+            adj.indices[cursor[nd1]++] = static_cast<int32_t>(nd0);
+        }
+        return from_adjacency(adj, nnode, /* diagonal */ true);
+    }
+
+    SparseMatrix() = delete;
+    SparseMatrix(SparseMatrix const &) = default;
+    SparseMatrix(SparseMatrix &&) = default;
+    SparseMatrix & operator=(SparseMatrix const &) = default;
+    SparseMatrix & operator=(SparseMatrix &&) = default;
+    ~SparseMatrix() = default;
+
+    size_t nrow() const { return m_offsets.size() - 1; }
+    size_t ncol() const { return m_ncol; }
+    size_t nnz() const { return m_indices.size(); }
+
+    SimpleArray<index_type> const & offsets() const { return m_offsets; }
+    SimpleArray<index_type> const & indices() const { return m_indices; }
+    SimpleArray<T> const & values() const { return m_values; }
+    SimpleArray<T> & values() { return m_values; }
+
+    /// Clear the values and keep the pattern for the next numeric assembly.
+    void zero() { m_values.fill(T(0)); }
+
+    /// Position of the entry (irow, icol) in values.  Throw std::out_of_range when it is not in the pattern.
+    size_t find(size_t irow, size_t icol) const
+    {
+        if (irow >= nrow() || icol >= m_ncol)
+        {
+            throw std::out_of_range(Formatter() << "SparseMatrix: (" << irow << ", " << icol << ") is out of the shape ("
+                                                << nrow() << ", " << m_ncol << ")");
+        }
+        index_type const * first = m_indices.data() + m_offsets[irow];
+        index_type const * last = m_indices.data() + m_offsets[irow + 1];
+        index_type const * it = std::lower_bound(first, last, static_cast<index_type>(icol));
+        if (it == last || *it != static_cast<index_type>(icol))
+        {
+            throw std::out_of_range(Formatter() << "SparseMatrix: (" << irow << ", " << icol << ") is not in the pattern");
+        }
+        return static_cast<size_t>(it - m_indices.data());
+    }
+
+    T const & operator()(size_t irow, size_t icol) const { return m_values[find(irow, icol)]; }
+    T & operator()(size_t irow, size_t icol) { return m_values[find(irow, icol)]; }
+
+    void add(size_t irow, size_t icol, T value) { m_values[find(irow, icol)] += value; }
+
+    /// Add the entries in the arrays of the same length; the duplicated entries are summed.
+    void add(SimpleArray<index_type> const & rows, SimpleArray<index_type> const & cols, SimpleArray<T> const & values)
+    {
+        if (rows.size() != cols.size() || rows.size() != values.size())
+        {
+            throw std::invalid_argument(Formatter() << "SparseMatrix: rows, cols, and values have different sizes "
+                                                    << rows.size() << ", " << cols.size() << ", and " << values.size());
+        }
+        for (size_t it = 0; it < rows.size(); ++it)
+        {
+            if (rows[it] < 0 || cols[it] < 0)
+            {
+                throw std::out_of_range(Formatter() << "SparseMatrix: (" << rows[it] << ", " << cols[it] << ") is negative");
+            }
+            add(static_cast<size_t>(rows[it]), static_cast<size_t>(cols[it]), values[it]);
+        }
+    }
+
+    /// y = A x over the body of x and y, in parallel by rows.
+    void multiply(SimpleArray<T> const & x, SimpleArray<T> & y) const
+    {
+        if (1 != x.ndim() || x.nbody() != m_ncol)
+        {
+            throw std::invalid_argument(Formatter() << "SparseMatrix: x must be one-dimensional of " << m_ncol << " body items");
+        }
+        if (1 != y.ndim() || y.nbody() != nrow())
+        {
+            throw std::invalid_argument(Formatter() << "SparseMatrix: y must be one-dimensional of " << nrow() << " body items");
+        }
+        index_type const * const offsets = m_offsets.data();
+        index_type const * const indices = m_indices.data();
+        T const * const values = m_values.data();
+        T const * const xbody = x.body();
+        T * const ybody = y.body();
+        parallel_for_chunks(
+            nrow(),
+            ThreadPool::instance().use_parallel(nnz()),
+            [&](size_t begin, size_t end)
+            {
+                for (size_t irow = begin; irow < end; ++irow)
+                {
+                    T sum = 0;
+                    for (index_type it = offsets[irow]; it < offsets[irow + 1]; ++it)
+                    {
+                        sum += values[it] * xbody[indices[it]];
+                    }
+                    ybody[irow] = sum;
+                }
+            });
+    }
+
+    SimpleArray<T> multiply(SimpleArray<T> const & x) const
+    {
+        SimpleArray<T> y(nrow());
+        multiply(x, y);
+        return y;
+    }
+
+private:
+
+    size_t m_ncol = 0;
+    SimpleArray<index_type> m_offsets;
+    SimpleArray<index_type> m_indices;
+    SimpleArray<T> m_values;
+
+}; /* end class SparseMatrix */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
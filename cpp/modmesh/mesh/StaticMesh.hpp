@@ -36,6 +36,7 @@
 #include <modmesh/toggle/toggle.hpp>
 #include <modmesh/buffer/buffer.hpp>
 
+#include <array>
 #include <cmath>
 #include <vector>
 #include <numeric>
@@ -43,6 +44,19 @@
 namespace modmesh
 {
 
+// forward declaration.
+namespace device
+{
+class StaticMeshMetal;
+} /* end namespace device */
+
+namespace detail
+{
+struct MmeshHeader;
+struct MmeshWriter;
+struct MmeshReader;
+} /* end namespace detail */
+
 /**
  * Cell type for unstructured mesh.
  */
@@ -197,31 +211,25 @@ public:
     }
 
     StaticMeshBC(StaticMeshBC const & other)
+        : m_facn(other.m_facn)
     {
-        if (this != &other)
-        {
-            m_facn = other.m_facn;
-        }
     }
 
-    StaticMeshBC(StaticMeshBC && other)
+    StaticMeshBC(StaticMeshBC && other) noexcept
+        : m_facn(std::move(other.m_facn))
     {
-        if (this != &other)
-        {
-            m_facn = std::move(other.m_facn);
-        }
     }
 
     StaticMeshBC & operator=(StaticMeshBC const & other)
     {
         if (this != &other)
         {
-            m_facn = other.m_facn;
+            m_facn = SimpleArray<int_type>(other.m_facn);
         }
         return *this;
     }
 
-    StaticMeshBC & operator=(StaticMeshBC && other)
+    StaticMeshBC & operator=(StaticMeshBC && other) noexcept
     {
         if (this != &other)
         {
@@ -239,10 +247,52 @@ public:
 
 }; /* end class StaticMeshBC */
 
-class StaticMesh
-    : public NumberBase<int32_t, double>
+/**
+ * Adjacency in the compressed sparse row (CSR) format.  The entities
+ * adjacent to row i are indices[offsets[i]:offsets[i+1]].
+ */
+struct StaticMeshAdjacency
+{
+    SimpleArray<uint64_t> offsets;
+    SimpleArray<int32_t> indices;
+
+    size_t nrow() const { return 0 == offsets.size() ? 0 : offsets.size() - 1; }
+    size_t count(size_t irow) const { return offsets[irow + 1] - offsets[irow]; }
+    SimpleArraySpan<int32_t const> row(size_t irow) const
+    {
+        return SimpleArraySpan<int32_t const>(indices.data() + offsets[irow], count(irow));
+    }
+
+    /**
+     * Materialize the padded layout of the connectivity arrays: column 0 is
+     * the count and the rest of the mcount columns are filled with -1.
+     */
+    SimpleArray<int32_t> to_padded(size_t mcount) const;
+}; /* end struct StaticMeshAdjacency */
+
+/**
+ * Permutations applied by StaticMesh::reorder().  Each array maps the new
+ * index to the old one, so that a field over the old ordering is carried to
+ * the new one by new_field[i] = old_field[perm[i]].
+ */
+struct StaticMeshPermutation
+{
+    SimpleArray<int32_t> node;
+    SimpleArray<int32_t> face;
+    SimpleArray<int32_t> cell;
+}; /* end struct StaticMeshPermutation */
+
+/**
+ * Unstructured mesh of the real type T for the coordinates and the metric.
+ * StaticMesh is in double precision, and StaticMeshFp32 halves the memory
+ * and the traffic of the geometry arrays for the meshes that do not need
+ * the precision, e.g., for visualization.  The connectivity is the same.
+ */
+template <typename T>
+class BasicStaticMesh
+    : public NumberBase<int32_t, T>
     , public StaticMeshConstant
-    , public std::enable_shared_from_this<StaticMesh>
+    , public std::enable_shared_from_this<BasicStaticMesh<T>>
 {
 
 private:
@@ -253,19 +303,19 @@ private:
 
 public:
 
-    using number_base = NumberBase<int32_t, double>;
+    using number_base = NumberBase<int32_t, T>;
     using int_type = typename number_base::int_type;
     using uint_type = typename number_base::uint_type;
     using real_type = typename number_base::real_type;
 
     template <typename... Args>
-    static std::shared_ptr<StaticMesh> construct(Args &&... args)
+    static std::shared_ptr<BasicStaticMesh> construct(Args &&... args)
     {
-        return std::make_shared<StaticMesh>(std::forward<Args>(args)..., ctor_passkey());
+        return std::make_shared<BasicStaticMesh>(std::forward<Args>(args)..., ctor_passkey());
     }
 
     /* NOLINTNEXTLINE(bugprone-easily-swappable-parameters) */
-    StaticMesh(uint8_t ndim, uint_type nnode, uint_type nface, uint_type ncell, ctor_passkey const &)
+    BasicStaticMesh(uint8_t ndim, uint_type nnode, uint_type nface, uint_type ncell, ctor_passkey const &)
         : m_ndim(ndim)
         , m_nnode(nnode)
         , m_nface(nface)
@@ -287,12 +337,12 @@ public:
         , m_bndfcs(std::vector<size_t>{0, StaticMeshBC::BFREL})
     {
     }
-    StaticMesh() = delete;
-    StaticMesh(StaticMesh const &) = delete;
-    StaticMesh(StaticMesh &&) = delete;
-    StaticMesh & operator=(StaticMesh const &) = delete;
-    StaticMesh & operator=(StaticMesh &&) = delete;
-    ~StaticMesh() = default;
+    BasicStaticMesh() = delete;
+    BasicStaticMesh(BasicStaticMesh const &) = delete;
+    BasicStaticMesh(BasicStaticMesh &&) = delete;
+    BasicStaticMesh & operator=(BasicStaticMesh const &) = delete;
+    BasicStaticMesh & operator=(BasicStaticMesh &&) = delete;
+    ~BasicStaticMesh() = default;
 
 public:
 
@@ -308,6 +358,10 @@ public:
 
     uint_type nedge() const { return static_cast<uint_type>(m_ednds.shape(0)); }
     size_t nbcs() const { return m_bcs.size(); }
+    std::vector<StaticMeshBC> const & bcs() const { return m_bcs; }
+    /// Append a boundary condition whose first facn column lists its faces;
+    /// build_boundary() fills the rest and collects the unlisted faces.
+    void add_bc(StaticMeshBC bc) { m_bcs.push_back(std::move(bc)); }
 
     /**
      * Get the "self" cell number of the input face by index.  A shorthand of
@@ -332,7 +386,8 @@ public:
 
     void build_interior(bool do_metric, bool do_edge = true)
     {
-        build_faces_from_cells();
+        // calc_metric() overwrites the face metric of 2D and 3D meshes.
+        build_faces_from_cells(/* zero_metric */ !(do_metric && (2 == m_ndim || 3 == m_ndim)));
         if (do_metric)
         {
             calc_metric();
@@ -341,14 +396,197 @@ public:
         {
             build_edge();
         }
+        if (m_soa)
+        {
+            sync_soa();
+        }
     }
 
     void build_edge();
 
+    /**
+     * Recalculate the metric of only the faces and cells having the nodes of
+     * which the coordinates changed, for moving or deforming meshes.  The
+     * cost scales with the number of the changed nodes.  The ghost entities
+     * are not updated.
+     *
+     * @param[in] changed_nodes indices of the body nodes moved since the
+     *                          metric was last calculated.
+     */
+    void update_metric(SimpleArray<int_type> const & changed_nodes);
+
+    /**
+     * Calculate the metric of the faces and cells built by build_interior(),
+     * or only of those in the sorted lists when given.  Every cell of a
+     * listed face must be listed too.  The faces may be reoriented.
+     */
+    void calc_metric(std::vector<int_type> const * faces = nullptr, std::vector<int_type> const * cells = nullptr);
+
+private:
+
+    void build_faces_from_cells(bool zero_metric);
+    void orient_faces(std::vector<int8_t> const & volsgn, std::vector<int_type> const * faces, std::vector<int_type> const * cells);
+
+    // Computes the metric on the GPU and orients the faces on the CPU.
+    friend class device::StaticMeshMetal;
+
+    // Adjacency and compact connectivity in CSR, built on the first access
+    // and cached until the interior, ghost or ordering is rebuilt.
+public:
+
+    /// Body cells having each body node.
+    StaticMeshAdjacency const & node_cells() const;
+    /// Body faces having each body node.
+    StaticMeshAdjacency const & node_faces() const;
+    /// Cells sharing a face with each body cell, in the order of clfcs.  Ghost
+    /// cells are included with their negative indices once the ghost is built.
+    StaticMeshAdjacency const & cell_cells() const;
+    /// Nodes of each body face in CSR, without the padding of fcnds.
+    StaticMeshAdjacency const & fcnds_csr() const;
+    /// Nodes of each body cell in CSR, without the padding of clnds.
+    StaticMeshAdjacency const & clnds_csr() const;
+    /// Faces of each body cell in CSR, without the padding of clfcs.
+    StaticMeshAdjacency const & clfcs_csr() const;
+    /**
+     * Body faces grouped by color: row i lists the faces of color i, and no
+     * two faces of a color share a cell in fccls (ghost cells included once
+     * the ghost is built).  A face loop scattering into its cells may run
+     * the faces of a color in parallel without atomics, one color after
+     * another.  The colors are balanced to similar sizes.
+     */
+    StaticMeshAdjacency const & face_colors() const;
+    /// Body cells grouped by color like face_colors(); no two cells of a
+    /// color share a face.
+    StaticMeshAdjacency const & cell_colors() const;
+    /// Drop the cached adjacency and CSR connectivity; call after modifying
+    /// the connectivity arrays directly.
+    void clear_adjacency() const
+    {
+        m_node_cells.reset();
+        m_node_faces.reset();
+        m_cell_cells.reset();
+        m_fcnds_csr.reset();
+        m_clnds_csr.reset();
+        m_clfcs_csr.reset();
+        m_face_colors.reset();
+        m_cell_colors.reset();
+    }
+
+    // Uniform refinement.
+public:
+
+    /**
+     * Split each cell into 2^ndim children of the same type by the midpoints
+     * of its edges, and also by the centers of its faces and its own center
+     * for quadrilaterals and hexahedra, and then rebuild the interior.  The
+     * faces listed by the boundary conditions are replaced by their children,
+     * and the boundary is rebuilt if it was.  The interior must be built, and
+     * the ghost must not be.  Only triangles and quadrilaterals in 2D and
+     * tetrahedra and hexahedra in 3D are supported.
+     *
+     * @param[in] levels number of times to split the cells.
+     */
+    void refine_uniform(size_t levels = 1);
+
+private:
+
+    void refine_uniform_once();
+
+    // Reordering for memory locality.
+public:
+
+    enum class ReorderMethod
+    {
+        ReverseCuthillMcKee,
+        Hilbert,
+        Morton,
+    }; /* end enum class ReorderMethod */
+
+    static ReorderMethod reorder_method_from_string(std::string const & value);
+    static char const * to_string(ReorderMethod method);
+
+    /**
+     * Renumber the cells by the method, and then the faces and nodes in the
+     * order the renumbered cells first reference them.  All connectivity,
+     * metric and boundary arrays are permuted consistently, and the edges are
+     * rebuilt if they were.  The interior must be built.  If the ghost is
+     * built, e.g., by Gmsh::to_block(), it is rebuilt over the renumbered
+     * interior, and the boundary faces keep their order.
+     *
+     * @param[in] method ordering of the cells.
+     * @return           permutations from the new indices to the old ones.
+     */
+    StaticMeshPermutation reorder(ReorderMethod method);
+
+    // Structure-of-arrays copies of the geometry arrays of [n, ndim], one
+    // contiguous array per component, for unit-stride loops.  The copies are
+    // refilled by build_interior, build_ghost and reorder while enabled.
+public:
+
+    bool soa() const { return m_soa; }
+    /// Enable or disable keeping the SoA copies; enabling fills them at once.
+    void set_soa(bool enable);
+    /// Refill the SoA copies; call after modifying ndcrd, fccnd, fcnml or clcnd directly.
+    void sync_soa();
+
+private:
+
+    /// Refill the SoA copies of only the listed nodes, faces and cells.
+    void sync_soa(std::vector<int_type> const & nodes, std::vector<int_type> const & faces, std::vector<int_type> const & cells);
+
+    SimpleArray<real_type> const & soa_component(std::array<SimpleArray<real_type>, 3> const & components, size_t idim, char const * name) const;
+
+    // Native binary format (.mmesh).
+public:
+
+    static constexpr uint32_t MMESH_VERSION = 1;
+
+    /**
+     * Write the arrays, the boundary conditions and the counts of the mesh in
+     * the versioned native binary format.  Every array starts at a 64-byte
+     * aligned offset, so that it can be mapped back as is.
+     *
+     * @param[in] path file to write.
+     */
+    void save_mmesh(std::string const & path) const;
+
+    /**
+     * Read a mesh written by save_mmesh(), in the state it was saved.  Nothing
+     * is parsed or rebuilt.
+     *
+     * @param[in] path file to read.
+     * @param[in] mmap map the arrays copy-on-write from the file instead of
+     *                 reading them into memory.
+     * @return         the mesh.
+     */
+    static std::shared_ptr<BasicStaticMesh> load_mmesh(std::string const & path, bool mmap = true);
+
+    /**
+     * Copy the mesh in the layout of save_mmesh() into a new POSIX shared
+     * memory segment, for the other processes on the host to attach by
+     * attach_shared().  The segment stays while the returned handle or a mesh
+     * attached to it is alive in any process.
+     *
+     * @param[in] name name of the segment, like "/modmesh_mesh".
+     * @return         the handle of the segment.
+     */
+    std::shared_ptr<SharedMemory> publish_shared(std::string const & name) const;
+
+    /**
+     * Attach to a mesh published by publish_shared() without copying.  The
+     * arrays are read-only views of the segment and hold it; the mesh must
+     * not be modified or rebuilt, while the adjacency and the SoA copies are
+     * built into private memory.
+     *
+     * @param[in] name name of the segment.
+     * @return         the mesh.
+     */
+    static std::shared_ptr<BasicStaticMesh> attach_shared(std::string const & name);
+
 private:
 
-    void build_faces_from_cells();
-    void calc_metric();
+    detail::MmeshHeader fill_mmesh(detail::MmeshWriter & writer) const;
+    static std::shared_ptr<BasicStaticMesh> read_mmesh(detail::MmeshReader & reader);
 
     // Helpers for boundary data (as well as ghost).
 public:
@@ -374,6 +612,17 @@ private:
     uint_type m_ngstcell = 0; ///< Number of ghost cells.
     // other block information.
     bool m_use_incenter = false; ///< While true, m_clcnd uses in-center for simplices.
+    bool m_soa = false; ///< While true, the SoA copies of the geometry arrays are kept.
+
+    // Cached adjacency.
+    mutable std::unique_ptr<StaticMeshAdjacency> m_node_cells;
+    mutable std::unique_ptr<StaticMeshAdjacency> m_node_faces;
+    mutable std::unique_ptr<StaticMeshAdjacency> m_cell_cells;
+    mutable std::unique_ptr<StaticMeshAdjacency> m_fcnds_csr;
+    mutable std::unique_ptr<StaticMeshAdjacency> m_clnds_csr;
+    mutable std::unique_ptr<StaticMeshAdjacency> m_clfcs_csr;
+    mutable std::unique_ptr<StaticMeshAdjacency> m_face_colors;
+    mutable std::unique_ptr<StaticMeshAdjacency> m_cell_colors;
 
 // Data arrays.
 #define MM_DECL_StaticMesh_ARRAY(TYPE, NAME)                            \
@@ -411,7 +660,31 @@ private:                                                                \
 
 #undef MM_DECL_StaticMesh_ARRAY
 
-}; /* end class StaticMesh */
+// SoA copies of the geometry arrays; the components beyond ndim are empty.
+#define MM_DECL_StaticMesh_SOA(NAME)                                                                \
+public:                                                                                             \
+    SimpleArray<real_type> const & NAME##_soa(size_t idim) const                                    \
+    {                                                                                               \
+        return soa_component(m_##NAME##_soa, idim, #NAME);                                          \
+    }                                                                                               \
+    SimpleArray<real_type> const & NAME##_x() const { return NAME##_soa(0); }                       \
+    SimpleArray<real_type> const & NAME##_y() const { return NAME##_soa(1); }                       \
+    SimpleArray<real_type> const & NAME##_z() const { return NAME##_soa(2); }                       \
+                                                                                                    \
+private:                                                                                            \
+    std::array<SimpleArray<real_type>, 3> m_##NAME##_soa
+
+    MM_DECL_StaticMesh_SOA(ndcrd);
+    MM_DECL_StaticMesh_SOA(fccnd);
+    MM_DECL_StaticMesh_SOA(fcnml);
+    MM_DECL_StaticMesh_SOA(clcnd);
+
+#undef MM_DECL_StaticMesh_SOA
+
+}; /* end class BasicStaticMesh */
+
+using StaticMesh = BasicStaticMesh<double>;
+using StaticMeshFp32 = BasicStaticMesh<float>;
 
 } /* end namespace modmesh */
 
@@ -0,0 +1,439 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMeshBVH.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+/**
+ * Numbers of the tree nodes over n and n + 1 cells.  A node over more than
+ * leaf cells puts the lower half of them to the left, so the count depends
+ * only on the number of cells, and the pair needs only the pair of n / 2.
+ */
+inline std::pair<size_t, size_t> bvh_node_count_pair(size_t n, size_t leaf)
+{
+    if (n + 1 <= leaf)
+    {
+        return {1, 1};
+    }
+    std::pair<size_t, size_t> const half = bvh_node_count_pair(n / 2, leaf);
+    if (0 == n % 2)
+    {
+        return {n <= leaf ? 1 : 1 + 2 * half.first, 1 + half.first + half.second};
+    }
+    return {n <= leaf ? 1 : 1 + half.first + half.second, 1 + 2 * half.second};
+}
+
+inline size_t bvh_node_count(size_t n, size_t leaf) { return bvh_node_count_pair(n, leaf).first; }
+
+struct BVHBuilder
+{
+
+    struct Task
+    {
+        size_t node;
+        size_t begin;
+        size_t end;
+    }; /* end struct Task */
+
+    /// Build the subtree at the node over cells[begin:end].  The subtrees at
+    /// the task depth are deferred to the list when it is given.
+    void build(size_t node, size_t begin, size_t end, size_t depth, std::vector<Task> * deferred)
+    {
+        if (nullptr != deferred && depth == task_depth)
+        {
+            deferred->push_back(Task{node, begin, end});
+            return;
+        }
+
+        // Box of the cells and extent of their box centers.
+        std::array<double, 3> center_lower{0.0, 0.0, 0.0};
+        std::array<double, 3> center_upper{0.0, 0.0, 0.0};
+        for (size_t idm = 0; idm < ndim; ++idm)
+        {
+            double lower = std::numeric_limits<double>::infinity();
+            double upper = -std::numeric_limits<double>::infinity();
+            center_lower[idm] = std::numeric_limits<double>::infinity();
+            center_upper[idm] = -std::numeric_limits<double>::infinity();
+            for (size_t it = begin; it < end; ++it)
+            {
+                size_t const icl = static_cast<size_t>(cells[it]);
+                lower = std::min(lower, cell_lower[icl * ndim + idm]);
+                upper = std::max(upper, cell_upper[icl * ndim + idm]);
+                double const center = cell_lower[icl * ndim + idm] + cell_upper[icl * ndim + idm];
+                center_lower[idm] = std::min(center_lower[idm], center);
+                center_upper[idm] = std::max(center_upper[idm], center);
+            }
+            node_lower[idm * nnode + node] = lower;
+            node_upper[idm * nnode + node] = upper;
+        }
+        size_t const ncell = end - begin;
+        first[node] = static_cast<uint32_t>(begin);
+        count[node] = static_cast<uint32_t>(ncell);
+        if (ncell <= leaf)
+        {
+            right[node] = -1;
+            return;
+        }
+
+        // Split at the median along the longest extent of the centers.
+        size_t axis = 0;
+        for (size_t idm = 1; idm < ndim; ++idm)
+        {
+            if (center_upper[idm] - center_lower[idm] > center_upper[axis] - center_lower[axis])
+            {
+                axis = idm;
+            }
+        }
+        size_t const mid = begin + ncell / 2;
+        std::nth_element(
+            cells + begin,
+            cells + mid,
+            cells + end,
+            [this, axis](int32_t lhs, int32_t rhs)
+            {
+                double const lc = cell_lower[lhs * ndim + axis] + cell_upper[lhs * ndim + axis];
+                double const rc = cell_lower[rhs * ndim + axis] + cell_upper[rhs * ndim + axis];
+                return lc != rc ? lc < rc : lhs < rhs;
+            });
+        size_t const left_node = node + 1;
+        size_t const right_node = left_node + bvh_node_count(ncell / 2, leaf);
+        right[node] = static_cast<int32_t>(right_node);
+        build(left_node, begin, mid, depth + 1, deferred);
+        build(right_node, mid, end, depth + 1, deferred);
+    }
+
+    size_t ndim = 0;
+    size_t leaf = 1;
+    size_t task_depth = 0;
+    size_t nnode = 0;
+    std::vector<double> cell_lower;
+    std::vector<double> cell_upper;
+    int32_t * cells = nullptr;
+    double * node_lower = nullptr;
+    double * node_upper = nullptr;
+    int32_t * right = nullptr;
+    uint32_t * first = nullptr;
+    uint32_t * count = nullptr;
+
+}; /* end struct BVHBuilder */
+
+} /* end namespace detail */
+
+StaticMeshBVH::StaticMeshBVH(std::shared_ptr<StaticMesh const> mesh, size_t leaf_size)
+    : m_mesh(std::move(mesh))
+    , m_leaf_size(leaf_size)
+{
+    if (!m_mesh)
+    {
+        throw std::invalid_argument("StaticMeshBVH: mesh must not be None");
+    }
+    if (2 != m_mesh->ndim() && 3 != m_mesh->ndim())
+    {
+        throw std::invalid_argument(Formatter() << "StaticMeshBVH: ndim must be 2 or 3 but is "
+                                                << static_cast<int>(m_mesh->ndim()));
+    }
+    if (0 == m_leaf_size)
+    {
+        throw std::invalid_argument("StaticMeshBVH: leaf_size must be positive");
+    }
+    if (0 != m_mesh->ncell() && 0 == m_mesh->nface())
+    {
+        throw std::runtime_error("StaticMeshBVH: the interior of the mesh must be built");
+    }
+
+    StaticMesh const & mh = *m_mesh;
+    size_t const ndim = mh.ndim();
+    size_t const ncell = mh.ncell();
+    bool const parallel = ThreadPool::instance().use_parallel(ncell);
+
+    detail::BVHBuilder builder;
+    builder.ndim = ndim;
+    builder.leaf = m_leaf_size;
+    builder.nnode = detail::bvh_node_count(ncell, m_leaf_size);
+
+    // Cell boxes from the nodes.
+    builder.cell_lower.resize(ncell * ndim);
+    builder.cell_upper.resize(ncell * ndim);
+    parallel_for_chunks(
+        ncell,
+        parallel,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t icl = begin; icl < end; ++icl)
+            {
+                for (size_t idm = 0; idm < ndim; ++idm)
+                {
+                    double lower = std::numeric_limits<double>::infinity();
+                    double upper = -std::numeric_limits<double>::infinity();
+                    for (int32_t inl = 1; inl <= mh.clnds(icl, 0); ++inl)
+                    {
+                        double const crd = mh.ndcrd(mh.clnds(icl, inl), idm);
+                        lower = std::min(lower, crd);
+                        upper = std::max(upper, crd);
+                    }
+                    builder.cell_lower[icl * ndim + idm] = lower;
+                    builder.cell_upper[icl * ndim + idm] = upper;
+                }
+            }
+        });
+
+    m_lower = SimpleArray<real_type>(small_vector<size_t>{ndim, builder.nnode}, SimpleArrayUninitialized{});
+    m_upper = SimpleArray<real_type>(small_vector<size_t>{ndim, builder.nnode}, SimpleArrayUninitialized{});
+    m_right.resize(builder.nnode);
+    m_first.resize(builder.nnode);
+    m_count.resize(builder.nnode);
+    m_cells.resize(ncell);
+    std::iota(m_cells.begin(), m_cells.end(), 0);
+    builder.cells = m_cells.data();
+    builder.node_lower = m_lower.data();
+    builder.node_upper = m_upper.data();
+    builder.right = m_right.data();
+    builder.first = m_first.data();
+    builder.count = m_count.data();
+
+    // Build the top of the tree serially, and the subtrees below it in
+    // parallel.  The subtrees write to disjoint nodes and cells.
+    if (parallel)
+    {
+        while ((size_t(1) << builder.task_depth) < 4 * ThreadPool::instance().nthread())
+        {
+            ++builder.task_depth;
+        }
+        std::vector<detail::BVHBuilder::Task> tasks;
+        builder.build(0, 0, ncell, 0, &tasks);
+        ThreadPool::instance().run(
+            tasks.size(),
+            [&builder, &tasks](size_t it)
+            {
+                builder.build(tasks[it].node, tasks[it].begin, tasks[it].end, builder.task_depth, nullptr);
+            });
+    }
+    else
+    {
+        builder.build(0, 0, ncell, 0, nullptr);
+    }
+}
+
+void StaticMeshBVH::validate_points(SimpleArray<real_type> const & points) const
+{
+    if (2 != points.ndim() || points.shape(1) != m_mesh->ndim())
+    {
+        throw std::invalid_argument(Formatter() << "StaticMeshBVH: points must be in the shape of (npoint, "
+                                                << static_cast<int>(m_mesh->ndim()) << ")");
+    }
+}
+
+/**
+ * The point is inside a convex cell when it is not in front of any face by
+ * more than a tolerance relative to the face size.
+ */
+bool StaticMeshBVH::contains(int32_t icl, real_type const * point) const
+{
+    StaticMesh const & mh = *m_mesh;
+    size_t const ndim = mh.ndim();
+    for (int32_t ifl = 1; ifl <= mh.clfcs(icl, 0); ++ifl)
+    {
+        int32_t const ifc = mh.clfcs(icl, ifl);
+        real_type dist = 0.0;
+        for (size_t idm = 0; idm < ndim; ++idm)
+        {
+            dist += (point[idm] - mh.fccnd(ifc, idm)) * mh.fcnml(ifc, idm);
+        }
+        if (mh.fccls(ifc, 0) != icl)
+        {
+            dist = -dist;
+        }
+        real_type const size = 3 == ndim ? std::sqrt(mh.fcara(ifc)) : mh.fcara(ifc);
+        if (dist > 1.e-10 * size)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+SimpleArray<int32_t> StaticMeshBVH::locate(SimpleArray<real_type> const & points) const
+{
+    validate_points(points);
+    size_t const npoint = points.shape(0);
+    size_t const ndim = m_mesh->ndim();
+    size_t const nnode = node_count();
+    SimpleArray<int32_t> ret(npoint);
+    parallel_for_chunks(
+        npoint,
+        ThreadPool::instance().use_parallel(npoint),
+        [&](size_t begin, size_t end)
+        {
+            // The depth of the tree is bounded by the bits of the cell count.
+            std::array<int32_t, 64> stack; // NOLINT(cppcoreguidelines-pro-type-member-init)
+            for (size_t ipt = begin; ipt < end; ++ipt)
+            {
+                std::array<real_type, 3> point{0.0, 0.0, 0.0};
+                for (size_t idm = 0; idm < ndim; ++idm)
+                {
+                    point[idm] = points(ipt, idm);
+                }
+                int32_t found = -1;
+                size_t top = 0;
+                stack[top++] = 0;
+                while (top > 0)
+                {
+                    size_t const node = static_cast<size_t>(stack[--top]);
+                    bool inside = true;
+                    for (size_t idm = 0; idm < ndim; ++idm)
+                    {
+                        inside = inside && point[idm] >= m_lower.data()[idm * nnode + node] && point[idm] <= m_upper.data()[idm * nnode + node];
+                    }
+                    if (!inside)
+                    {
+                        continue;
+                    }
+                    if (m_right[node] < 0)
+                    {
+                        for (uint32_t it = m_first[node]; it < m_first[node] + m_count[node]; ++it)
+                        {
+                            int32_t const icl = m_cells[it];
+                            if ((found < 0 || icl < found) && contains(icl, point.data()))
+                            {
+                                found = icl;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        stack[top++] = m_right[node];
+                        stack[top++] = static_cast<int32_t>(node + 1);
+                    }
+                }
+                ret(ipt) = found;
+            }
+        });
+    return ret;
+}
+
+StaticMeshAdjacency StaticMeshBVH::within(SimpleArray<real_type> const & points, real_type radius) const
+{
+    validate_points(points);
+    if (!(radius >= 0.0))
+    {
+        throw std::invalid_argument(Formatter() << "StaticMeshBVH: radius " << radius << " must not be negative");
+    }
+    StaticMesh const & mh = *m_mesh;
+    size_t const npoint = points.shape(0);
+    size_t const ndim = mh.ndim();
+    size_t const nnode = node_count();
+    real_type const radius2 = radius * radius;
+
+    std::vector<std::vector<int32_t>> found(npoint);
+    parallel_for_chunks(
+        npoint,
+        ThreadPool::instance().use_parallel(npoint),
+        [&](size_t begin, size_t end)
+        {
+            std::array<int32_t, 64> stack; // NOLINT(cppcoreguidelines-pro-type-member-init)
+            for (size_t ipt = begin; ipt < end; ++ipt)
+            {
+                std::array<real_type, 3> point{0.0, 0.0, 0.0};
+                for (size_t idm = 0; idm < ndim; ++idm)
+                {
+                    point[idm] = points(ipt, idm);
+                }
+                std::vector<int32_t> & cells = found[ipt];
+                size_t top = 0;
+                stack[top++] = 0;
+                while (top > 0)
+                {
+                    size_t const node = static_cast<size_t>(stack[--top]);
+                    // Squared distance from the point to the box.
+                    real_type dist2 = 0.0;
+                    for (size_t idm = 0; idm < ndim; ++idm)
+                    {
+                        real_type const below = m_lower.data()[idm * nnode + node] - point[idm];
+                        real_type const above = point[idm] - m_upper.data()[idm * nnode + node];
+                        real_type const gap = std::max({below, above, real_type(0)});
+                        dist2 += gap * gap;
+                    }
+                    if (!(dist2 <= radius2))
+                    {
+                        continue;
+                    }
+                    if (m_right[node] < 0)
+                    {
+                        for (uint32_t it = m_first[node]; it < m_first[node] + m_count[node]; ++it)
+                        {
+                            int32_t const icl = m_cells[it];
+                            real_type d2 = 0.0;
+                            for (size_t idm = 0; idm < ndim; ++idm)
+                            {
+                                real_type const delta = mh.clcnd(icl, idm) - point[idm];
+                                d2 += delta * delta;
+                            }
+                            if (d2 <= radius2)
+                            {
+                                cells.push_back(icl);
+                            }
+                        }
+                    }
+                    else
+                    {
+                        stack[top++] = m_right[node];
+                        stack[top++] = static_cast<int32_t>(node + 1);
+                    }
+                }
+                std::sort(cells.begin(), cells.end());
+            }
+        });
+
+    StaticMeshAdjacency ret;
+    ret.offsets = SimpleArray<uint64_t>(npoint + 1);
+    ret.offsets(0) = 0;
+    for (size_t ipt = 0; ipt < npoint; ++ipt)
+    {
+        ret.offsets(ipt + 1) = ret.offsets(ipt) + found[ipt].size();
+    }
+    ret.indices = SimpleArray<int32_t>(static_cast<size_t>(ret.offsets(npoint)));
+    for (size_t ipt = 0; ipt < npoint; ++ipt)
+    {
+        std::copy(found[ipt].begin(), found[ipt].end(), ret.indices.data() + ret.offsets(ipt));
+    }
+    return ret;
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,115 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMesh.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace modmesh
+{
+
+/**
+ * Bounding volume hierarchy of the cell bounding boxes of a 2D or 3D
+ * StaticMesh, for point location and range queries.  The tree is binary,
+ * split at the median cell along the longest extent of the box centers, and
+ * laid out in depth-first order with the node boxes in structure of arrays.
+ * The subtrees are built in parallel.
+ *
+ * The metric of the mesh must be built.  The hierarchy does not follow the
+ * later changes of the mesh and needs to be rebuilt after them.
+ */
+class StaticMeshBVH
+{
+
+public:
+
+    using real_type = StaticMesh::real_type;
+
+    static constexpr size_t DEFAULT_LEAF_SIZE = 8;
+
+    explicit StaticMeshBVH(std::shared_ptr<StaticMesh const> mesh, size_t leaf_size = DEFAULT_LEAF_SIZE);
+
+    StaticMeshBVH() = delete;
+    StaticMeshBVH(StaticMeshBVH const &) = delete;
+    StaticMeshBVH(StaticMeshBVH &&) = delete;
+    StaticMeshBVH & operator=(StaticMeshBVH const &) = delete;
+    StaticMeshBVH & operator=(StaticMeshBVH &&) = delete;
+    ~StaticMeshBVH() = default;
+
+    std::shared_ptr<StaticMesh const> const & mesh() const { return m_mesh; }
+    size_t leaf_size() const { return m_leaf_size; }
+    size_t node_count() const { return m_right.size(); }
+
+    /// Lower corners of the node boxes in [ndim, node_count].
+    SimpleArray<real_type> const & lower() const { return m_lower; }
+    /// Upper corners of the node boxes in [ndim, node_count].
+    SimpleArray<real_type> const & upper() const { return m_upper; }
+
+    /**
+     * Find a cell containing each point.  The cells are taken as convex, and
+     * a point on a shared face or node goes to the lowest cell index.
+     *
+     * @param[in] points coordinates in [npoint, ndim].
+     * @return           the cell of each point, or -1 outside the mesh.
+     */
+    SimpleArray<int32_t> locate(SimpleArray<real_type> const & points) const;
+
+    /**
+     * Find the cells of which the center is within the radius of each point.
+     *
+     * @param[in] points coordinates in [npoint, ndim].
+     * @param[in] radius distance from the points.
+     * @return           CSR of the sorted cells around each point.
+     */
+    StaticMeshAdjacency within(SimpleArray<real_type> const & points, real_type radius) const;
+
+private:
+
+    void validate_points(SimpleArray<real_type> const & points) const;
+    bool contains(int32_t icl, real_type const * point) const;
+
+    std::shared_ptr<StaticMesh const> m_mesh;
+    size_t m_leaf_size = DEFAULT_LEAF_SIZE;
+
+    // Tree nodes.  The left child of an internal node follows it, and leaves
+    // have the right child -1 and the cells m_cells[m_first:m_first+m_count].
+    SimpleArray<real_type> m_lower;
+    SimpleArray<real_type> m_upper;
+    std::vector<int32_t> m_right;
+    std::vector<uint32_t> m_first;
+    std::vector<uint32_t> m_count;
+    std::vector<int32_t> m_cells;
+
+}; /* end class StaticMeshBVH */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,204 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMesh.hpp>
+
+#include <array>
+
+namespace modmesh
+{
+
+/**
+ * How accumulate_face_flux() keeps the threads from writing the same cell.
+ *
+ *  1. COLOR: run the faces of each color of StaticMesh::face_colors() in
+ *     parallel, one color after another.  The flux of a face is calculated
+ *     once and added to both of its cells.
+ *  2. GATHER: run the body cells in parallel, and each cell sums the fluxes
+ *     of its own faces.  The flux of an interior face is calculated twice,
+ *     but there is no synchronization between the colors.
+ */
+enum class FaceLoopStrategy : uint8_t
+{
+    COLOR,
+    GATHER
+}; /* end enum class FaceLoopStrategy */
+
+/**
+ * Add the fluxes through the body faces to the residuals of the body cells:
+ * residual(icl, :) -= sum(flux * fcara) over the faces of the cell, with the
+ * normal pointing out of the cell.  Then du/dt = residual / clvol for the
+ * finite-volume scheme.  The residuals are not cleared in advance.
+ *
+ * u and residual are in the shape of (ngstcell + ncell, NVAR) with the ghost
+ * cells of build_ghost() in front, and the boundary condition is set in the
+ * ghost cells of u by the caller.  The ghost cells of residual are not
+ * written.
+ *
+ * The flux functor is compiled into the loop and provides
+ *
+ *     static constexpr size_t NVAR;
+ *     void operator()(T const * ul, T const * ur, T const * nml, T * flux) const;
+ *
+ * to calculate the NVAR fluxes per unit area along the unit normal nml,
+ * which points from the left cell fccls(ifc, 0) to the right cell
+ * fccls(ifc, 1).
+ */
+template <typename T, typename Flux>
+void accumulate_face_flux(
+    BasicStaticMesh<T> const & mesh,
+    Flux const & flux,
+    SimpleArray<T> const & u,
+    SimpleArray<T> & residual,
+    FaceLoopStrategy strategy = FaceLoopStrategy::COLOR)
+{
+    using int_type = typename BasicStaticMesh<T>::int_type;
+    constexpr size_t NVAR = Flux::NVAR;
+
+    size_t const ngstcell = mesh.ngstcell();
+    size_t const ncell = mesh.ncell();
+    if (mesh.nbound() > 0 && 0 == ngstcell)
+    {
+        throw std::runtime_error("accumulate_face_flux: build_ghost must be called first");
+    }
+    auto check = [&](SimpleArray<T> const & arr, char const * name)
+    {
+        if (2 != arr.ndim() || ngstcell + ncell != arr.shape(0) || NVAR != arr.shape(1) || ngstcell != arr.nghost())
+        {
+            throw std::invalid_argument(Formatter() << "accumulate_face_flux: " << name << " is not in the shape of ("
+                                                    << ngstcell << " + " << ncell << ", " << NVAR << ") with "
+                                                    << ngstcell << " ghost rows");
+        }
+    };
+    check(u, "u");
+    check(residual, "residual");
+
+    SimpleArray<int_type> const & fccls = mesh.fccls();
+    SimpleArray<T> const & fcnml = mesh.fcnml();
+    SimpleArray<T> const & fcara = mesh.fcara();
+
+    // The flux of the face out of the left cell, times the area.
+    auto face_flux = [&](int_type ifc, T * out)
+    {
+        flux(u.vptr(fccls(ifc, 0), 0), u.vptr(fccls(ifc, 1), 0), fcnml.vptr(ifc, 0), out);
+        T const area = fcara(ifc);
+        for (size_t iv = 0; iv < NVAR; ++iv)
+        {
+            out[iv] *= area;
+        }
+    };
+
+    if (FaceLoopStrategy::COLOR == strategy)
+    {
+        StaticMeshAdjacency const & colors = mesh.face_colors();
+        for (size_t icr = 0; icr < colors.nrow(); ++icr)
+        {
+            SimpleArraySpan<int32_t const> const faces = colors.row(icr);
+            parallel_for_chunks(
+                faces.size(),
+                ThreadPool::instance().use_parallel(faces.size()),
+                [&](size_t begin, size_t end)
+                {
+                    std::array<T, NVAR> out;
+                    for (size_t it = begin; it < end; ++it)
+                    {
+                        int_type const ifc = faces[it];
+                        face_flux(ifc, out.data());
+                        T * const rl = residual.vptr(fccls(ifc, 0), 0);
+                        for (size_t iv = 0; iv < NVAR; ++iv)
+                        {
+                            rl[iv] -= out[iv];
+                        }
+                        if (fccls(ifc, 1) >= 0)
+                        {
+                            T * const rr = residual.vptr(fccls(ifc, 1), 0);
+                            for (size_t iv = 0; iv < NVAR; ++iv)
+                            {
+                                rr[iv] += out[iv];
+                            }
+                        }
+                    }
+                });
+        }
+    }
+    else
+    {
+        SimpleArray<int_type> const & clfcs = mesh.clfcs();
+        parallel_for_chunks(
+            ncell,
+            ThreadPool::instance().use_parallel(ncell),
+            [&](size_t begin, size_t end)
+            {
+                std::array<T, NVAR> out;
+                for (size_t icl = begin; icl < end; ++icl)
+                {
+                    T * const rc = residual.vptr(icl, 0);
+                    for (int_type ifl = 1; ifl <= clfcs(icl, 0); ++ifl)
+                    {
+                        int_type const ifc = clfcs(icl, ifl);
+                        face_flux(ifc, out.data());
+                        T const sign = fccls(ifc, 0) == static_cast<int_type>(icl) ? T(-1) : T(1);
+                        for (size_t iv = 0; iv < NVAR; ++iv)
+                        {
+                            rc[iv] += sign * out[iv];
+                        }
+                    }
+                }
+            });
+    }
+}
+
+/**
+ * The first-order upwind flux of the linear advection du/dt + div(v u) = 0
+ * of a scalar at the constant velocity v.  It is the example flux functor
+ * of accumulate_face_flux().
+ */
+template <typename T>
+struct UpwindAdvectionFlux
+{
+    static constexpr size_t NVAR = 1;
+
+    std::array<T, 3> velocity{0, 0, 0};
+    uint8_t ndim = 3;
+
+    void operator()(T const * ul, T const * ur, T const * nml, T * flux) const
+    {
+        T vn = 0;
+        for (uint8_t idm = 0; idm < ndim; ++idm)
+        {
+            vn += velocity[idm] * nml[idm];
+        }
+        flux[0] = vn * (vn > 0 ? ul[0] : ur[0]);
+    }
+}; /* end struct UpwindAdvectionFlux */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMeshGenerator.hpp>
+
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+/// Number of the blocks (i + j) odd before block (i, j) in the rows of nx
+/// blocks.  These blocks are split in the mixed shapes.
+inline size_t count_odd_blocks(size_t nx, size_t i, size_t j)
+{
+    size_t const rows = ((j + 1) / 2) * (nx / 2) + (j / 2) * ((nx + 1) / 2);
+    return rows + (0 == (j & 1) ? i / 2 : (i + 1) / 2);
+}
+
+/// Writes the cells of the blocks of a StaticMeshGenerator.
+template <typename T>
+struct GeneratedCells
+{
+    using int_type = typename BasicStaticMesh<T>::int_type;
+
+    void set(size_t icl, uint8_t type, std::initializer_list<int_type> nodes)
+    {
+        mesh.cltpn(icl) = type;
+        mesh.clgrp(icl) = 0;
+        mesh.clnds(icl, 0) = static_cast<int_type>(nodes.size());
+        size_t inl = 1;
+        for (int_type const ind : nodes)
+        {
+            mesh.clnds(icl, inl++) = ind;
+        }
+    }
+
+    BasicStaticMesh<T> & mesh;
+}; /* end struct GeneratedCells */
+
+} /* end namespace detail */
+
+StaticMeshGenerator::Shape StaticMeshGenerator::shape_from_string(std::string const & value)
+{
+    // clang-format off
+    static std::array<Shape, 7> const shapes{
+        Shape::Triangle, Shape::Quadrilateral, Shape::Mixed2D,
+        Shape::Tetrahedron, Shape::Hexahedron, Shape::Prism, Shape::Mixed3D};
+    // clang-format on
+    for (Shape const shape : shapes)
+    {
+        if (value == to_string(shape))
+        {
+            return shape;
+        }
+    }
+    throw std::invalid_argument(Formatter() << "StaticMeshGenerator: unknown shape \"" << value
+                                            << "\"; use \"triangle\", \"quadrilateral\", \"mixed2d\", "
+                                            << "\"tetrahedron\", \"hexahedron\", \"prism\" or \"mixed3d\"");
+}
+
+char const * StaticMeshGenerator::to_string(Shape shape)
+{
+    switch (shape)
+    {
+    case Shape::Triangle: return "triangle"; break;
+    case Shape::Quadrilateral: return "quadrilateral"; break;
+    case Shape::Mixed2D: return "mixed2d"; break;
+    case Shape::Tetrahedron: return "tetrahedron"; break;
+    case Shape::Hexahedron: return "hexahedron"; break;
+    case Shape::Prism: return "prism"; break;
+    case Shape::Mixed3D: return "mixed3d"; break;
+    default: return ""; break;
+    }
+}
+
+uint8_t StaticMeshGenerator::ndim_of(Shape shape)
+{
+    return (Shape::Triangle == shape || Shape::Quadrilateral == shape || Shape::Mixed2D == shape) ? 2 : 3;
+}
+
+StaticMeshGenerator::StaticMeshGenerator(Shape shape, std::vector<size_t> const & resolution)
+    : m_shape(shape)
+    , m_resolution(resolution)
+    , m_lower(ndim_of(shape), 0)
+    , m_upper(ndim_of(shape), 1)
+    , m_grading(ndim_of(shape), 1)
+{
+    if (m_resolution.size() != ndim())
+    {
+        throw std::invalid_argument(Formatter() << "StaticMeshGenerator: " << to_string(m_shape) << " takes "
+                                                << int(ndim()) << " resolutions but got " << m_resolution.size());
+    }
+    for (size_t const n : m_resolution)
+    {
+        if (0 == n)
+        {
+            throw std::invalid_argument("StaticMeshGenerator: resolution must be positive");
+        }
+    }
+    size_t const nmax = static_cast<size_t>(std::numeric_limits<int_type>::max());
+    double const nblock = static_cast<double>(m_resolution[0]) * static_cast<double>(m_resolution[1]) * (3 == ndim() ? static_cast<double>(m_resolution[2]) : 1.0);
+    // Count the blocks in floating point first so that the counts of the
+    // nodes and the cells do not overflow.
+    if (nblock > static_cast<double>(nmax) || nnode() > nmax || ncell() > nmax)
+    {
+        throw std::invalid_argument(Formatter() << "StaticMeshGenerator: " << nnode() << " nodes and " << ncell()
+                                                << " cells exceed the limit " << nmax);
+    }
+}
+
+void StaticMeshGenerator::check_axis(size_t axis) const
+{
+    if (axis >= ndim())
+    {
+        throw std::out_of_range(Formatter() << "StaticMeshGenerator: axis " << axis << " is out of the "
+                                            << int(ndim()) << " axes");
+    }
+}
+
+StaticMeshGenerator & StaticMeshGenerator::set_box(std::vector<real_type> const & lower, std::vector<real_type> const & upper)
+{
+    if (lower.size() != ndim() || upper.size() != ndim())
+    {
+        throw std::invalid_argument(Formatter() << "StaticMeshGenerator: the box takes " << int(ndim())
+                                                << " coordinates but got " << lower.size() << " and " << upper.size());
+    }
+    for (size_t idm = 0; idm < ndim(); ++idm)
+    {
+        if (!(lower[idm] < upper[idm]))
+        {
+            throw std::invalid_argument(Formatter() << "StaticMeshGenerator: lower " << lower[idm]
+                                                    << " is not less than upper " << upper[idm] << " along axis " << idm);
+        }
+    }
+    m_lower = lower;
+    m_upper = upper;
+    return *this;
+}
+
+StaticMeshGenerator & StaticMeshGenerator::set_grading(size_t axis, real_type ratio)
+{
+    check_axis(axis);
+    if (!(ratio > 0) || !std::isfinite(ratio))
+    {
+        throw std::invalid_argument(Formatter() << "StaticMeshGenerator: grading ratio " << ratio << " is not positive");
+    }
+    m_grading[axis] = ratio;
+    return *this;
+}
+
+std::vector<StaticMeshGenerator::real_type> StaticMeshGenerator::coordinates(size_t axis) const
+{
+    check_axis(axis);
+    size_t const n = m_resolution[axis];
+    real_type const lower = m_lower[axis];
+    real_type const length = m_upper[axis] - lower;
+    // The intervals grow by q = ratio^(1/(n-1)), and node i is at
+    // (q^i - 1) / (q^n - 1) of the length.
+    real_type const q = n > 1 ? std::pow(m_grading[axis], 1.0 / static_cast<real_type>(n - 1)) : 1.0;
+    bool const uniform = std::abs(q - 1.0) < 1.e-12;
+    real_type const denominator = uniform ? static_cast<real_type>(n) : std::pow(q, static_cast<real_type>(n)) - 1.0;
+    std::vector<real_type> ret(n + 1);
+    for (size_t i = 0; i < n; ++i)
+    {
+        real_type const numerator = uniform ? static_cast<real_type>(i) : std::pow(q, static_cast<real_type>(i)) - 1.0;
+        ret[i] = lower + length * numerator / denominator;
+    }
+    ret[n] = m_upper[axis];
+    return ret;
+}
+
+size_t StaticMeshGenerator::nnode() const
+{
+    size_t ret = 1;
+    for (size_t const n : m_resolution)
+    {
+        ret *= n + 1;
+    }
+    return ret;
+}
+
+size_t StaticMeshGenerator::ncell() const
+{
+    size_t const nx = m_resolution[0];
+    size_t const ny = m_resolution[1];
+    size_t const nz = 3 == ndim() ? m_resolution[2] : 1;
+    size_t const nblock = nx * ny * nz;
+    switch (m_shape)
+    {
+    case Shape::Triangle: return nblock * 2; break;
+    case Shape::Tetrahedron: return nblock * 6; break;
+    case Shape::Prism: return nblock * 2; break;
+    case Shape::Mixed2D:
+    case Shape::Mixed3D: return nblock + nz * detail::count_odd_blocks(nx, 0, ny); break;
+    default: return nblock; break;
+    }
+}
+
+template <typename T>
+std::shared_ptr<BasicStaticMesh<T>> StaticMeshGenerator::generate() const
+{
+    using mesh_int_type = typename BasicStaticMesh<T>::int_type;
+    using mesh_uint_type = typename BasicStaticMesh<T>::uint_type;
+
+    uint8_t const nd = ndim();
+    size_t const nx = m_resolution[0];
+    size_t const ny = m_resolution[1];
+    size_t const nz = 3 == nd ? m_resolution[2] : 1;
+    size_t const nnx = nx + 1;
+    size_t const nny = ny + 1;
+    size_t const nnode_all = nnode();
+    size_t const ncell_all = ncell();
+
+    std::shared_ptr<BasicStaticMesh<T>> mesh = BasicStaticMesh<T>::construct(
+        nd,
+        static_cast<mesh_uint_type>(nnode_all),
+        /* nface */ 0,
+        static_cast<mesh_uint_type>(ncell_all));
+    BasicStaticMesh<T> & mh = *mesh;
+
+    std::array<std::vector<real_type>, 3> crds;
+    for (size_t idm = 0; idm < nd; ++idm)
+    {
+        crds[idm] = coordinates(idm);
+    }
+    parallel_for_chunks(
+        nnode_all,
+        ThreadPool::instance().use_parallel(nnode_all),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t ind = begin; ind < end; ++ind)
+            {
+                mh.ndcrd(ind, 0) = static_cast<T>(crds[0][ind % nnx]);
+                mh.ndcrd(ind, 1) = static_cast<T>(crds[1][(ind / nnx) % nny]);
+                if (3 == nd)
+                {
+                    mh.ndcrd(ind, 2) = static_cast<T>(crds[2][ind / (nnx * nny)]);
+                }
+            }
+        });
+
+    // The 6 tetrahedra of a block go from corner 0 to corner 6 through a
+    // corner and an edge; the odd permutations swap the middle nodes to keep
+    // the orientation.
+    // clang-format off
+    static constexpr std::array<std::array<size_t, 4>, 6> kuhn{{
+        {0, 1, 2, 6}, {0, 5, 1, 6}, {0, 4, 5, 6}, {0, 7, 4, 6}, {0, 3, 7, 6}, {0, 2, 3, 6}}};
+    // clang-format on
+    auto node = [nnx, nny](size_t i, size_t j, size_t k)
+    { return static_cast<mesh_int_type>((k * nny + j) * nnx + i); };
+    size_t const nodd = detail::count_odd_blocks(nx, 0, ny);
+    size_t const nblock = nx * ny * nz;
+    Shape const shape = m_shape;
+    detail::GeneratedCells<T> cells{mh};
+    parallel_for_chunks(
+        nblock,
+        ThreadPool::instance().use_parallel(ncell_all),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t ibk = begin; ibk < end; ++ibk)
+            {
+                size_t const i = ibk % nx;
+                size_t const j = (ibk / nx) % ny;
+                size_t const k = ibk / (nx * ny);
+                // clang-format off
+                std::array<mesh_int_type, 8> const v{
+                    node(i, j, k), node(i + 1, j, k), node(i + 1, j + 1, k), node(i, j + 1, k),
+                    node(i, j, k + 1), node(i + 1, j, k + 1), node(i + 1, j + 1, k + 1), node(i, j + 1, k + 1)};
+                // clang-format on
+                bool const odd = 0 != ((i + j) & 1);
+                switch (shape)
+                {
+                case Shape::Triangle:
+                    cells.set(ibk * 2, CellType::TRIANGLE, {v[0], v[1], v[3]});
+                    cells.set(ibk * 2 + 1, CellType::TRIANGLE, {v[1], v[2], v[3]});
+                    break;
+                case Shape::Quadrilateral:
+                    cells.set(ibk, CellType::QUADRILATERAL, {v[0], v[1], v[2], v[3]});
+                    break;
+                case Shape::Mixed2D:
+                {
+                    size_t const icl = ibk + detail::count_odd_blocks(nx, i, j);
+                    if (odd)
+                    {
+                        cells.set(icl, CellType::TRIANGLE, {v[0], v[1], v[3]});
+                        cells.set(icl + 1, CellType::TRIANGLE, {v[1], v[2], v[3]});
+                    }
+                    else
+                    {
+                        cells.set(icl, CellType::QUADRILATERAL, {v[0], v[1], v[2], v[3]});
+                    }
+                    break;
+                }
+                case Shape::Tetrahedron:
+                    for (size_t it = 0; it < kuhn.size(); ++it)
+                    {
+                        std::array<size_t, 4> const & tet = kuhn[it];
+                        cells.set(ibk * 6 + it, CellType::TETRAHEDRON, {v[tet[0]], v[tet[1]], v[tet[2]], v[tet[3]]});
+                    }
+                    break;
+                case Shape::Hexahedron:
+                    cells.set(ibk, CellType::HEXAHEDRON, {v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7]});
+                    break;
+                case Shape::Prism:
+                    cells.set(ibk * 2, CellType::PRISM, {v[0], v[1], v[3], v[4], v[5], v[7]});
+                    cells.set(ibk * 2 + 1, CellType::PRISM, {v[1], v[2], v[3], v[5], v[6], v[7]});
+                    break;
+                case Shape::Mixed3D:
+                {
+                    size_t const icl = ibk + k * nodd + detail::count_odd_blocks(nx, i, j);
+                    if (odd)
+                    {
+                        cells.set(icl, CellType::PRISM, {v[0], v[1], v[3], v[4], v[5], v[7]});
+                        cells.set(icl + 1, CellType::PRISM, {v[1], v[2], v[3], v[5], v[6], v[7]});
+                    }
+                    else
+                    {
+                        cells.set(icl, CellType::HEXAHEDRON, {v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7]});
+                    }
+                    break;
+                }
+                default:
+                    break;
+                }
+            }
+        });
+    return mesh;
+}
+
+template std::shared_ptr<BasicStaticMesh<float>> StaticMeshGenerator::generate<float>() const;
+template std::shared_ptr<BasicStaticMesh<double>> StaticMeshGenerator::generate<double>() const;
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
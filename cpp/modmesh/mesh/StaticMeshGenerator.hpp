@@ -0,0 +1,135 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMesh.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace modmesh
+{
+
+/**
+ * Generator of the meshes of an axis-aligned box of structured blocks, for
+ * test and benchmark meshes of up to 10^8 cells without a mesh file.  Each
+ * block is split into the cells of the shape:
+ *
+ *  1. triangle: 2 triangles over the diagonal from node (0, 0) to (1, 1).
+ *  2. quadrilateral: 1 quadrilateral.
+ *  3. mixed2d: quadrilaterals and triangle pairs in a checkerboard.
+ *  4. tetrahedron: 6 tetrahedra around the diagonal from node (0, 0, 0) to
+ *     (1, 1, 1), which is conforming between the blocks.
+ *  5. hexahedron: 1 hexahedron.
+ *  6. prism: 2 prisms over the triangles of the bottom face.
+ *  7. mixed3d: hexahedra and prism pairs in a checkerboard of the columns
+ *     along z, so that the triangles of the prisms only face each other.
+ *
+ * The nodes are spaced uniformly by default, or geometrically along an axis
+ * of which the grading ratio, the last interval over the first, is not 1.
+ * The nodes are numbered with x running the fastest, and the cells by the
+ * blocks in the same order.  generate() fills ndcrd, cltpn, clgrp and clnds
+ * in parallel and leaves build_interior(), build_boundary() and
+ * build_ghost() to the caller.
+ */
+class StaticMeshGenerator
+{
+
+public:
+
+    using int_type = StaticMesh::int_type;
+    using uint_type = StaticMesh::uint_type;
+    using real_type = StaticMesh::real_type;
+
+    enum class Shape
+    {
+        Triangle,
+        Quadrilateral,
+        Mixed2D,
+        Tetrahedron,
+        Hexahedron,
+        Prism,
+        Mixed3D,
+    }; /* end enum class Shape */
+
+    static Shape shape_from_string(std::string const & value);
+    static char const * to_string(Shape shape);
+    static uint8_t ndim_of(Shape shape);
+
+    /**
+     * @param[in] shape      cells of the blocks.
+     * @param[in] resolution number of the blocks along each of the 2 or 3
+     *                       axes of the shape.
+     */
+    StaticMeshGenerator(Shape shape, std::vector<size_t> const & resolution);
+
+    StaticMeshGenerator() = delete;
+    StaticMeshGenerator(StaticMeshGenerator const &) = default;
+    StaticMeshGenerator(StaticMeshGenerator &&) = default;
+    StaticMeshGenerator & operator=(StaticMeshGenerator const &) = default;
+    StaticMeshGenerator & operator=(StaticMeshGenerator &&) = default;
+    ~StaticMeshGenerator() = default;
+
+    Shape shape() const { return m_shape; }
+    uint8_t ndim() const { return ndim_of(m_shape); }
+    std::vector<size_t> const & resolution() const { return m_resolution; }
+    std::vector<real_type> const & lower() const { return m_lower; }
+    std::vector<real_type> const & upper() const { return m_upper; }
+    std::vector<real_type> const & grading() const { return m_grading; }
+
+    /// Set the corners of the box, the unit square or cube by default.
+    StaticMeshGenerator & set_box(std::vector<real_type> const & lower, std::vector<real_type> const & upper);
+    /// Set the ratio of the last interval over the first along the axis.
+    StaticMeshGenerator & set_grading(size_t axis, real_type ratio);
+
+    /// Node coordinates along the axis.
+    std::vector<real_type> coordinates(size_t axis) const;
+
+    size_t nnode() const;
+    size_t ncell() const;
+
+    template <typename T = real_type>
+    std::shared_ptr<BasicStaticMesh<T>> generate() const;
+
+private:
+
+    void check_axis(size_t axis) const;
+
+    Shape m_shape;
+    std::vector<size_t> m_resolution;
+    std::vector<real_type> m_lower;
+    std::vector<real_type> m_upper;
+    std::vector<real_type> m_grading;
+
+}; /* end class StaticMeshGenerator */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
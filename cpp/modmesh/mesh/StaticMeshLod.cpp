@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMeshLod.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+/// Pack an undirected pair of indices with the lower one in the high bits.
+inline uint64_t lod_pack_pair(StaticMesh::int_type a, StaticMesh::int_type b)
+{
+    auto const lo = static_cast<uint32_t>(std::min(a, b));
+    auto const hi = static_cast<uint32_t>(std::max(a, b));
+    return (static_cast<uint64_t>(lo) << 32) | hi;
+}
+
+inline void lod_unique(std::vector<uint64_t> & pairs)
+{
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+}
+
+inline SimpleArray<StaticMesh::int_type> lod_unpack_pairs(std::vector<uint64_t> const & pairs)
+{
+    SimpleArray<StaticMesh::int_type> ret(small_vector<size_t>{pairs.size(), 2});
+    for (size_t it = 0; it < pairs.size(); ++it)
+    {
+        ret(it, 0) = static_cast<StaticMesh::int_type>(pairs[it] >> 32);
+        ret(it, 1) = static_cast<StaticMesh::int_type>(pairs[it] & 0xffffffff);
+    }
+    return ret;
+}
+
+} /* end namespace detail */
+
+StaticMeshLod::StaticMeshLod(std::shared_ptr<StaticMesh const> mesh, size_t depth)
+    : m_mesh(std::move(mesh))
+    , m_depth(depth)
+{
+    if (!m_mesh)
+    {
+        throw std::invalid_argument("StaticMeshLod: mesh must not be None");
+    }
+    if (2 != m_mesh->ndim() && 3 != m_mesh->ndim())
+    {
+        throw std::invalid_argument(Formatter() << "StaticMeshLod: ndim must be 2 or 3 but is "
+                                                << static_cast<int>(m_mesh->ndim()));
+    }
+    if (0 == m_depth || m_depth > MAX_DEPTH)
+    {
+        throw std::invalid_argument(Formatter() << "StaticMeshLod: depth " << m_depth << " must be in [1, " << MAX_DEPTH << "]");
+    }
+    if (0 != m_mesh->ncell() && 0 == m_mesh->nface())
+    {
+        throw std::runtime_error("StaticMeshLod: the interior of the mesh must be built");
+    }
+    build_boundary();
+    build_levels();
+}
+
+void StaticMeshLod::build_boundary()
+{
+    StaticMesh const & mh = *m_mesh;
+    auto const & fcnds = mh.fcnds();
+
+    // The related cell of a boundary face is negative, before or after the
+    // ghost is built.
+    std::vector<uint64_t> pairs;
+    for (size_t ifc = 0; ifc < mh.nface(); ++ifc)
+    {
+        if (mh.fcjcl(static_cast<int_type>(ifc)) >= 0)
+        {
+            continue;
+        }
+        int_type const fcnnd = fcnds(ifc, 0);
+        if (2 == mh.ndim())
+        {
+            pairs.push_back(detail::lod_pack_pair(fcnds(ifc, 1), fcnds(ifc, 2)));
+            continue;
+        }
+        for (int_type inf = 1; inf <= fcnnd; ++inf)
+        {
+            pairs.push_back(detail::lod_pack_pair(fcnds(ifc, inf), fcnds(ifc, fcnnd == inf ? 1 : inf + 1)));
+        }
+    }
+    detail::lod_unique(pairs);
+
+    std::vector<int_type> nodes;
+    nodes.reserve(pairs.size() * 2);
+    for (uint64_t const pair : pairs)
+    {
+        nodes.push_back(static_cast<int_type>(pair >> 32));
+        nodes.push_back(static_cast<int_type>(pair & 0xffffffff));
+    }
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+
+    m_boundary_nodes = SimpleArray<int_type>(nodes.size());
+    std::copy(nodes.begin(), nodes.end(), m_boundary_nodes.begin());
+    m_boundary_edges = SimpleArray<int_type>(small_vector<size_t>{pairs.size(), 2});
+    auto const compact = [&nodes](uint64_t value)
+    {
+        auto const node = static_cast<int_type>(value);
+        return static_cast<int_type>(std::lower_bound(nodes.begin(), nodes.end(), node) - nodes.begin());
+    };
+    for (size_t it = 0; it < pairs.size(); ++it)
+    {
+        m_boundary_edges(it, 0) = compact(pairs[it] >> 32);
+        m_boundary_edges(it, 1) = compact(pairs[it] & 0xffffffff);
+    }
+}
+
+void StaticMeshLod::build_levels()
+{
+    StaticMesh const & mh = *m_mesh;
+    size_t const ndim = mh.ndim();
+    size_t const nnode = mh.nnode();
+    auto const & ndcrd = mh.ndcrd();
+
+    m_lower = SimpleArray<real_type>(small_vector<size_t>{ndim}, 0);
+    m_upper = SimpleArray<real_type>(small_vector<size_t>{ndim}, 0);
+    for (size_t idm = 0; idm < ndim; ++idm)
+    {
+        if (0 == nnode)
+        {
+            continue;
+        }
+        real_type lower = std::numeric_limits<real_type>::infinity();
+        real_type upper = -std::numeric_limits<real_type>::infinity();
+        for (size_t ind = 0; ind < nnode; ++ind)
+        {
+            lower = std::min(lower, ndcrd(ind, idm));
+            upper = std::max(upper, ndcrd(ind, idm));
+        }
+        m_lower(idm) = lower;
+        m_upper(idm) = upper;
+    }
+    real_type extent = 0;
+    for (size_t idm = 0; idm < ndim; ++idm)
+    {
+        extent = std::max(extent, m_upper(idm) - m_lower(idm));
+    }
+    uint32_t const ncell = uint32_t(1) << m_depth;
+    real_type const cell_size = extent > 0 ? extent / static_cast<real_type>(ncell) : 1;
+
+    // The items of a level are the clusters of the previous one, and the
+    // nodes for level 0.  Each has its cell, the sum of the coordinates of
+    // its nodes and their count.
+    std::vector<std::array<uint32_t, 3>> cells(nnode, std::array<uint32_t, 3>{0, 0, 0});
+    std::vector<std::array<real_type, 3>> sums(nnode, std::array<real_type, 3>{0, 0, 0});
+    std::vector<size_t> counts(nnode, 1);
+    parallel_for_chunks(
+        nnode,
+        ThreadPool::instance().use_parallel(nnode),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t ind = begin; ind < end; ++ind)
+            {
+                for (size_t idm = 0; idm < ndim; ++idm)
+                {
+                    real_type const pos = (ndcrd(ind, idm) - m_lower(idm)) / cell_size;
+                    cells[ind][idm] = std::min(static_cast<uint32_t>(pos), ncell - 1);
+                    sums[ind][idm] = ndcrd(ind, idm);
+                }
+            }
+        });
+    std::vector<uint64_t> edges(mh.nedge());
+    {
+        auto const & ednds = mh.ednds();
+        for (size_t ied = 0; ied < edges.size(); ++ied)
+        {
+            edges[ied] = detail::lod_pack_pair(ednds(ied, 0), ednds(ied, 1));
+        }
+    }
+
+    m_levels.resize(m_depth);
+    std::vector<std::pair<uint64_t, uint32_t>> keys;
+    std::vector<int_type> cluster_of;
+    for (size_t ilv = 0; ilv < m_depth; ++ilv)
+    {
+        size_t const nitem = cells.size();
+        if (0 != ilv)
+        {
+            for (std::array<uint32_t, 3> & cell : cells)
+            {
+                cell[0] >>= 1;
+                cell[1] >>= 1;
+                cell[2] >>= 1;
+            }
+        }
+
+        // Group the items of the same cell into a cluster.
+        keys.resize(nitem);
+        for (size_t it = 0; it < nitem; ++it)
+        {
+            std::array<uint32_t, 3> const & cell = cells[it];
+            uint64_t const key = (static_cast<uint64_t>(cell[0]) << (2 * MAX_DEPTH)) | (static_cast<uint64_t>(cell[1]) << MAX_DEPTH) | cell[2];
+            keys[it] = {key, static_cast<uint32_t>(it)};
+        }
+        std::sort(keys.begin(), keys.end());
+        cluster_of.resize(nitem);
+        std::vector<std::array<uint32_t, 3>> next_cells;
+        std::vector<std::array<real_type, 3>> next_sums;
+        std::vector<size_t> next_counts;
+        for (size_t it = 0; it < nitem; ++it)
+        {
+            uint32_t const item = keys[it].second;
+            if (0 == it || keys[it].first != keys[it - 1].first)
+            {
+                next_cells.push_back(cells[item]);
+                next_sums.push_back(std::array<real_type, 3>{0, 0, 0});
+                next_counts.push_back(0);
+            }
+            cluster_of[item] = static_cast<int_type>(next_cells.size() - 1);
+            for (size_t idm = 0; idm < 3; ++idm)
+            {
+                next_sums.back()[idm] += sums[item][idm];
+            }
+            next_counts.back() += counts[item];
+        }
+
+        // Edges between different clusters.
+        size_t nkept = 0;
+        for (uint64_t const pair : edges)
+        {
+            int_type const c0 = cluster_of[pair >> 32];
+            int_type const c1 = cluster_of[pair & 0xffffffff];
+            if (c0 != c1)
+            {
+                edges[nkept++] = detail::lod_pack_pair(c0, c1);
+            }
+        }
+        edges.resize(nkept);
+        detail::lod_unique(edges);
+
+        Level & level = m_levels[ilv];
+        level.cell_size = cell_size * static_cast<real_type>(uint64_t(1) << ilv);
+        level.nodes = SimpleArray<real_type>(small_vector<size_t>{next_cells.size(), ndim});
+        for (size_t icl = 0; icl < next_cells.size(); ++icl)
+        {
+            for (size_t idm = 0; idm < ndim; ++idm)
+            {
+                level.nodes(icl, idm) = next_sums[icl][idm] / static_cast<real_type>(next_counts[icl]);
+            }
+        }
+        level.edges = detail::lod_unpack_pairs(edges);
+
+        cells.swap(next_cells);
+        sums.swap(next_sums);
+        counts.swap(next_counts);
+    }
+}
+
+StaticMeshLod::Level const & StaticMeshLod::level_at(size_t level) const
+{
+    if (level >= m_levels.size())
+    {
+        throw std::out_of_range(Formatter() << "StaticMeshLod: level " << level << " is out of range of nlevel " << m_levels.size());
+    }
+    return m_levels[level];
+}
+
+StaticMeshLod::real_type StaticMeshLod::cell_size(size_t level) const { return level_at(level).cell_size; }
+
+SimpleArray<StaticMeshLod::real_type> const & StaticMeshLod::level_nodes(size_t level) const { return level_at(level).nodes; }
+
+SimpleArray<StaticMeshLod::int_type> const & StaticMeshLod::level_edges(size_t level) const { return level_at(level).edges; }
+
+int StaticMeshLod::select_level(real_type distance, real_type angle) const
+{
+    real_type const limit = distance * angle;
+    int ret = -1;
+    for (size_t ilv = 0; ilv < m_levels.size() && m_levels[ilv].cell_size <= limit; ++ilv)
+    {
+        ret = static_cast<int>(ilv);
+    }
+    return ret;
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
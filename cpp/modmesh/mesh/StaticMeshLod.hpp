@@ -0,0 +1,131 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMesh.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace modmesh
+{
+
+/**
+ * Reduced line sets of a 2D or 3D StaticMesh for drawing it at a level of
+ * detail:
+ *
+ *  1. boundary: the edges of the boundary faces in 3D, or the boundary
+ *     faces themselves in 2D, over the compact list of their nodes.
+ *  2. clustered levels: the nodes are clustered in the cubic cells of an
+ *     octree (a quadtree in 2D) over the bounding box of the body nodes.
+ *     Level 0 has 2^depth cells along the longest extent, and each next
+ *     level merges 2^ndim cells into one.  A cluster sits at the mean of its
+ *     nodes, and an edge of ednds whose nodes fall in different clusters
+ *     becomes one edge between the clusters.
+ *
+ * The reduction does not follow the later changes of the mesh.
+ */
+class StaticMeshLod
+{
+
+public:
+
+    using int_type = StaticMesh::int_type;
+    using real_type = StaticMesh::real_type;
+
+    static constexpr size_t DEFAULT_DEPTH = 8;
+    static constexpr size_t MAX_DEPTH = 21;
+
+    explicit StaticMeshLod(std::shared_ptr<StaticMesh const> mesh, size_t depth = DEFAULT_DEPTH);
+
+    StaticMeshLod() = delete;
+    StaticMeshLod(StaticMeshLod const &) = delete;
+    StaticMeshLod(StaticMeshLod &&) = delete;
+    StaticMeshLod & operator=(StaticMeshLod const &) = delete;
+    StaticMeshLod & operator=(StaticMeshLod &&) = delete;
+    ~StaticMeshLod() = default;
+
+    std::shared_ptr<StaticMesh const> const & mesh() const { return m_mesh; }
+    size_t depth() const { return m_depth; }
+
+    /// Lower corner of the bounding box of the body nodes in [ndim].
+    SimpleArray<real_type> const & lower() const { return m_lower; }
+    /// Upper corner of the bounding box of the body nodes in [ndim].
+    SimpleArray<real_type> const & upper() const { return m_upper; }
+
+    /// Mesh nodes on the boundary, ascending.
+    SimpleArray<int_type> const & boundary_nodes() const { return m_boundary_nodes; }
+    /// Boundary edges in [nedge, 2], indexing boundary_nodes.
+    SimpleArray<int_type> const & boundary_edges() const { return m_boundary_edges; }
+
+    /// Number of the clustered levels, from the finest to the coarsest.
+    size_t nlevel() const { return m_levels.size(); }
+    /// Edge length of the cubic cells of the level.
+    real_type cell_size(size_t level) const;
+    /// Cluster coordinates of the level in [ncluster, ndim].
+    SimpleArray<real_type> const & level_nodes(size_t level) const;
+    /// Cluster edges of the level in [nedge, 2].
+    SimpleArray<int_type> const & level_edges(size_t level) const;
+
+    /**
+     * Choose the coarsest level of which the cells subtend no more than
+     * angle at distance.
+     *
+     * @return the level, or -1 when even the cells of level 0 are too large
+     *         and the full mesh should be drawn.
+     */
+    int select_level(real_type distance, real_type angle) const;
+
+private:
+
+    struct Level
+    {
+        real_type cell_size = 0;
+        SimpleArray<real_type> nodes;
+        SimpleArray<int_type> edges;
+    }; /* end struct Level */
+
+    void build_boundary();
+    void build_levels();
+
+    Level const & level_at(size_t level) const;
+
+    std::shared_ptr<StaticMesh const> m_mesh;
+    size_t m_depth = DEFAULT_DEPTH;
+    SimpleArray<real_type> m_lower;
+    SimpleArray<real_type> m_upper;
+    SimpleArray<int_type> m_boundary_nodes;
+    SimpleArray<int_type> m_boundary_edges;
+    std::vector<Level> m_levels;
+
+}; /* end class StaticMeshLod */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
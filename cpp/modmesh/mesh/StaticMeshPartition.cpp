@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMeshPartition.hpp>
+
+#include <limits>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+/// Averaged node coordinates of each cell, which do not need the metric.
+inline std::vector<double> cell_centers(StaticMesh const & mesh)
+{
+    size_t const ndim = mesh.ndim();
+    std::vector<double> ret(static_cast<size_t>(mesh.ncell()) * ndim, 0.0);
+    parallel_for_chunks(
+        mesh.ncell(),
+        ThreadPool::instance().use_parallel(mesh.ncell()),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t icl = begin; icl < end; ++icl)
+            {
+                int32_t const nnd = mesh.clnds(icl, 0);
+                for (int32_t inl = 1; inl <= nnd; ++inl)
+                {
+                    for (size_t idm = 0; idm < ndim; ++idm)
+                    {
+                        ret[icl * ndim + idm] += mesh.ndcrd(mesh.clnds(icl, inl), idm);
+                    }
+                }
+                for (size_t idm = 0; idm < ndim; ++idm)
+                {
+                    ret[icl * ndim + idm] /= nnd > 0 ? nnd : 1;
+                }
+            }
+        });
+    return ret;
+}
+
+/// Assign the parts [part0, part0+npart) to the cells by recursive bisection.
+inline void bisect(std::vector<double> const & center, size_t ndim, int32_t * cells, size_t ncell, int32_t part0, size_t npart, int32_t * cell_part)
+{
+    if (npart <= 1 || ncell <= 1)
+    {
+        for (size_t it = 0; it < ncell; ++it)
+        {
+            cell_part[cells[it]] = part0;
+        }
+        return;
+    }
+
+    // Split along the longest extent.
+    size_t axis = 0;
+    double longest = -1.0;
+    for (size_t idm = 0; idm < ndim; ++idm)
+    {
+        double lower = center[static_cast<size_t>(cells[0]) * ndim + idm];
+        double upper = lower;
+        for (size_t it = 1; it < ncell; ++it)
+        {
+            double const value = center[static_cast<size_t>(cells[it]) * ndim + idm];
+            lower = std::min(lower, value);
+            upper = std::max(upper, value);
+        }
+        if (upper - lower > longest)
+        {
+            longest = upper - lower;
+            axis = idm;
+        }
+    }
+
+    // The index breaks ties so that the split is deterministic.
+    size_t const nleft = npart / 2;
+    size_t const nmid = ncell * nleft / npart;
+    std::nth_element(
+        cells,
+        cells + nmid,
+        cells + ncell,
+        [&center, ndim, axis](int32_t lhs, int32_t rhs)
+        {
+            double const lv = center[static_cast<size_t>(lhs) * ndim + axis];
+            double const rv = center[static_cast<size_t>(rhs) * ndim + axis];
+            return lv != rv ? lv < rv : lhs < rhs;
+        });
+    bisect(center, ndim, cells, nmid, part0, nleft, cell_part);
+    bisect(center, ndim, cells + nmid, ncell - nmid, part0 + static_cast<int32_t>(nleft), npart - nleft, cell_part);
+}
+
+/// Index of value in the sorted range, which must contain it.
+inline int32_t sorted_index(std::vector<int32_t> const & sorted, size_t begin, size_t end, int32_t value)
+{
+    auto const it = std::lower_bound(sorted.begin() + static_cast<ssize_t>(begin), sorted.begin() + static_cast<ssize_t>(end), value);
+    return static_cast<int32_t>(it - sorted.begin());
+}
+
+template <typename T>
+SimpleArray<T> to_simple_array(std::vector<T> const & values)
+{
+    SimpleArray<T> ret(values.size());
+    std::copy(values.begin(), values.end(), ret.begin());
+    return ret;
+}
+
+/// Global face having the same nodes as the local face.  The unused slots
+/// are padded with the largest value and the whole arrays are sorted, since
+/// sorting a partial range of nnd trips -Warray-bounds of GCC 12 at -O2.
+inline int32_t find_global_face(StaticMesh const & mesh, std::array<int32_t, StaticMesh::FCMND> nodes, int32_t nnd)
+{
+    std::fill(nodes.begin() + nnd, nodes.end(), std::numeric_limits<int32_t>::max());
+    std::sort(nodes.begin(), nodes.end());
+    for (int32_t const ifc : mesh.node_faces().row(static_cast<size_t>(nodes[0])))
+    {
+        if (mesh.fcnds(ifc, 0) != nnd)
+        {
+            continue;
+        }
+        std::array<int32_t, StaticMesh::FCMND> other; // NOLINT(cppcoreguidelines-pro-type-member-init)
+        std::copy_n(mesh.fcnds().vptr(ifc, 1), nnd, other.begin());
+        std::fill(other.begin() + nnd, other.end(), std::numeric_limits<int32_t>::max());
+        std::sort(other.begin(), other.end());
+        if (nodes == other)
+        {
+            return ifc;
+        }
+    }
+    return -1;
+}
+
+/// Select the cells of a part and build its local mesh.
+/* NOLINTNEXTLINE(readability-function-cognitive-complexity) */
+inline void build_part(StaticMesh const & mesh, int32_t const * cell_part, std::vector<int32_t> owned, size_t nlayer, StaticMeshPart & part)
+{
+    int32_t const ipart = owned.empty() ? -1 : cell_part[owned[0]];
+    StaticMeshAdjacency const & cell_cells = mesh.cell_cells();
+
+    // Collect the halo layer by layer.  Each layer is sorted by the global
+    // index.
+    std::vector<int32_t> cells(owned);
+    std::vector<int32_t> halo;
+    size_t front_begin = 0;
+    for (size_t ilayer = 0; ilayer < nlayer; ++ilayer)
+    {
+        size_t const front_end = cells.size();
+        std::vector<int32_t> layer;
+        for (size_t it = front_begin; it < front_end; ++it)
+        {
+            for (int32_t const jcl : cell_cells.row(static_cast<size_t>(cells[it])))
+            {
+                if (jcl >= 0 && cell_part[jcl] != ipart && !std::binary_search(halo.begin(), halo.end(), jcl))
+                {
+                    layer.push_back(jcl);
+                }
+            }
+        }
+        std::sort(layer.begin(), layer.end());
+        layer.erase(std::unique(layer.begin(), layer.end()), layer.end());
+        if (layer.empty())
+        {
+            break;
+        }
+        cells.insert(cells.end(), layer.begin(), layer.end());
+        std::vector<int32_t> merged;
+        merged.reserve(halo.size() + layer.size());
+        std::merge(halo.begin(), halo.end(), layer.begin(), layer.end(), std::back_inserter(merged));
+        halo.swap(merged);
+        front_begin = front_end;
+    }
+
+    // Nodes in ascending global index.
+    std::vector<int32_t> nodes;
+    for (int32_t const icl : cells)
+    {
+        nodes.insert(nodes.end(), mesh.clnds().vptr(icl, 1), mesh.clnds().vptr(icl, 1) + mesh.clnds(icl, 0));
+    }
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+
+    size_t const ndim = mesh.ndim();
+    std::shared_ptr<StaticMesh> local = StaticMesh::construct(
+        mesh.ndim(),
+        static_cast<StaticMesh::uint_type>(nodes.size()),
+        /* nface */ 0,
+        static_cast<StaticMesh::uint_type>(cells.size()));
+    for (size_t ind = 0; ind < nodes.size(); ++ind)
+    {
+        for (size_t idm = 0; idm < ndim; ++idm)
+        {
+            local->ndcrd(ind, idm) = mesh.ndcrd(nodes[ind], idm);
+        }
+    }
+    for (size_t icl = 0; icl < cells.size(); ++icl)
+    {
+        int32_t const gcl = cells[icl];
+        local->cltpn(icl) = mesh.cltpn(gcl);
+        local->clgrp(icl) = mesh.clgrp(gcl);
+        int32_t const nnd = mesh.clnds(gcl, 0);
+        local->clnds(icl, 0) = nnd;
+        for (int32_t inl = 1; inl <= nnd; ++inl)
+        {
+            local->clnds(icl, inl) = sorted_index(nodes, 0, nodes.size(), mesh.clnds(gcl, inl));
+        }
+    }
+    local->build_interior(/* do_metric */ true, /* do_edge */ 0 != mesh.nedge());
+    local->build_boundary();
+
+    std::vector<int32_t> faces(local->nface());
+    for (size_t ifc = 0; ifc < faces.size(); ++ifc)
+    {
+        int32_t const nnd = local->fcnds(ifc, 0);
+        std::array<int32_t, StaticMesh::FCMND> fcnds{};
+        for (int32_t inf = 0; inf < nnd; ++inf)
+        {
+            fcnds[static_cast<size_t>(inf)] = nodes[static_cast<size_t>(local->fcnds(ifc, inf + 1))];
+        }
+        faces[ifc] = find_global_face(mesh, fcnds, nnd);
+    }
+
+    std::vector<int32_t> halo_owner(cells.size() - owned.size());
+    for (size_t it = 0; it < halo_owner.size(); ++it)
+    {
+        halo_owner[it] = cell_part[cells[owned.size() + it]];
+    }
+
+    part.mesh = std::move(local);
+    part.nowned_cell = owned.size();
+    part.node_global = to_simple_array(nodes);
+    part.face_global = to_simple_array(faces);
+    part.cell_global = to_simple_array(cells);
+    part.halo_owner = to_simple_array(halo_owner);
+}
+
+} /* end namespace detail */
+
+SimpleArray<int32_t> partition_cells_rcb(StaticMesh const & mesh, size_t npart)
+{
+    if (0 == npart)
+    {
+        throw std::invalid_argument("partition_cells_rcb: npart must be positive");
+    }
+    std::vector<double> const center = detail::cell_centers(mesh);
+    std::vector<int32_t> cells(mesh.ncell());
+    std::iota(cells.begin(), cells.end(), 0);
+    SimpleArray<int32_t> ret(cells.size());
+    detail::bisect(center, mesh.ndim(), cells.data(), cells.size(), 0, npart, ret.data());
+    return ret;
+}
+
+/* NOLINTNEXTLINE(readability-function-cognitive-complexity) */
+std::vector<StaticMeshPart> decompose_mesh(StaticMesh const & mesh, SimpleArray<int32_t> const & cell_part, size_t npart, size_t nlayer)
+{
+    if (cell_part.size() != mesh.ncell())
+    {
+        throw std::invalid_argument(
+            Formatter() << "decompose_mesh: cell_part size " << cell_part.size()
+                        << " differs from ncell " << mesh.ncell());
+    }
+    if (0 != mesh.ncell() && 0 == mesh.nface())
+    {
+        throw std::runtime_error("decompose_mesh: the interior of the mesh must be built");
+    }
+
+    // The owned cells of each part in ascending global index.
+    std::vector<std::vector<int32_t>> owned(npart);
+    for (size_t icl = 0; icl < cell_part.size(); ++icl)
+    {
+        int32_t const ipart = cell_part[icl];
+        if (ipart < 0 || static_cast<size_t>(ipart) >= npart)
+        {
+            throw std::out_of_range(
+                Formatter() << "decompose_mesh: part " << ipart << " of cell " << icl
+                            << " is not in [0, " << npart << ")");
+        }
+        owned[static_cast<size_t>(ipart)].push_back(static_cast<int32_t>(icl));
+    }
+
+    // The caches are filled before the parts read them concurrently.
+    mesh.cell_cells();
+    mesh.node_faces();
+    std::vector<StaticMeshPart> parts(npart);
+    ThreadPool::instance().run(
+        npart,
+        [&](size_t ipart)
+        { detail::build_part(mesh, cell_part.data(), owned[ipart], nlayer, parts[ipart]); });
+
+    // Pair the halo of each part with the owned cells of its neighbors.
+    // recvs[i][j] lists the halo cells of part i owned by part j, and
+    // sends[j][i] the same cells as they are owned by part j.
+    std::vector<std::vector<std::vector<int32_t>>> recvs(npart, std::vector<std::vector<int32_t>>(npart));
+    std::vector<std::vector<std::vector<int32_t>>> sends(npart, std::vector<std::vector<int32_t>>(npart));
+    for (size_t ipart = 0; ipart < npart; ++ipart)
+    {
+        StaticMeshPart const & part = parts[ipart];
+        for (size_t it = 0; it < part.halo_owner.size(); ++it)
+        {
+            auto const owner = static_cast<size_t>(part.halo_owner[it]);
+            int32_t const gcl = part.cell_global[part.nowned_cell + it];
+            recvs[ipart][owner].push_back(static_cast<int32_t>(part.nowned_cell + it));
+            sends[owner][ipart].push_back(detail::sorted_index(owned[owner], 0, owned[owner].size(), gcl));
+        }
+    }
+    for (size_t ipart = 0; ipart < npart; ++ipart)
+    {
+        std::vector<int32_t> neighbors;
+        std::vector<uint64_t> send_offsets{0};
+        std::vector<int32_t> send_cells;
+        std::vector<uint64_t> recv_offsets{0};
+        std::vector<int32_t> recv_cells;
+        for (size_t jpart = 0; jpart < npart; ++jpart)
+        {
+            std::vector<int32_t> const & send = sends[ipart][jpart];
+            std::vector<int32_t> const & recv = recvs[ipart][jpart];
+            if (send.empty() && recv.empty())
+            {
+                continue;
+            }
+            neighbors.push_back(static_cast<int32_t>(jpart));
+            send_cells.insert(send_cells.end(), send.begin(), send.end());
+            send_offsets.push_back(send_cells.size());
+            recv_cells.insert(recv_cells.end(), recv.begin(), recv.end());
+            recv_offsets.push_back(recv_cells.size());
+        }
+        StaticMeshPart & part = parts[ipart];
+        part.neighbor_parts = detail::to_simple_array(neighbors);
+        part.send_offsets = detail::to_simple_array(send_offsets);
+        part.send_cells = detail::to_simple_array(send_cells);
+        part.recv_offsets = detail::to_simple_array(recv_offsets);
+        part.recv_cells = detail::to_simple_array(recv_cells);
+    }
+    return parts;
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
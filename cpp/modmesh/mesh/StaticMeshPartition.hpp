@@ -0,0 +1,95 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMesh.hpp>
+
+#include <vector>
+
+namespace modmesh
+{
+
+/**
+ * A part of a decomposed StaticMesh.  The local mesh is standalone: its
+ * cells [0, nowned_cell) are owned by the part and the rest are the halo
+ * layers copied from the neighboring parts.  The global maps take a local
+ * index to the index in the decomposed mesh.
+ *
+ * The exchange lists are CSR over neighbor_parts.  The halo cells
+ * recv_cells[recv_offsets[i]:recv_offsets[i+1]] are owned by
+ * neighbor_parts[i], and the owned cells
+ * send_cells[send_offsets[i]:send_offsets[i+1]] are the halo of
+ * neighbor_parts[i], listed in the order of its recv_cells for this part.
+ */
+struct StaticMeshPart
+{
+    std::shared_ptr<StaticMesh> mesh;
+    size_t nowned_cell = 0;
+
+    SimpleArray<int32_t> node_global;
+    SimpleArray<int32_t> face_global;
+    SimpleArray<int32_t> cell_global;
+    /// Owning part of each halo cell.
+    SimpleArray<int32_t> halo_owner;
+
+    SimpleArray<int32_t> neighbor_parts;
+    SimpleArray<uint64_t> send_offsets;
+    SimpleArray<int32_t> send_cells;
+    SimpleArray<uint64_t> recv_offsets;
+    SimpleArray<int32_t> recv_cells;
+}; /* end struct StaticMeshPart */
+
+/**
+ * Partition the cells by recursive coordinate bisection of the cell centers.
+ * Each bisection splits along the longest extent in proportion to the number
+ * of parts on either side, so the part sizes differ by at most one cell.
+ *
+ * @param[in] mesh  mesh to partition.
+ * @param[in] npart number of parts.
+ * @return          part of each cell.
+ */
+SimpleArray<int32_t> partition_cells_rcb(StaticMesh const & mesh, size_t npart);
+
+/**
+ * Split the mesh into standalone parts with halo layers.  The interior of the
+ * mesh must be built.  The local meshes are built in parallel, with the
+ * interior (and the edges if the mesh has them) and the boundary built.  The
+ * local boundary includes the outer faces of the halo.
+ *
+ * @param[in] mesh      mesh to decompose.
+ * @param[in] cell_part part of each cell, in [0, npart).
+ * @param[in] npart     number of parts.
+ * @param[in] nlayer    number of halo layers across faces.
+ * @return              the parts.
+ */
+std::vector<StaticMeshPart> decompose_mesh(StaticMesh const & mesh, SimpleArray<int32_t> const & cell_part, size_t npart, size_t nlayer = 1);
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMeshQuality.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+/// Corners of a cell type with the ndim neighbors along its edges, ordered
+/// so that the determinant of the edge vectors is positive for a valid cell.
+struct QualityCorners
+{
+    size_t ncorner = 0;
+    std::array<std::array<uint8_t, 4>, 8> corners{};
+}; /* end struct QualityCorners */
+
+// clang-format off
+inline QualityCorners const & quality_corners(uint8_t type)
+{
+    static QualityCorners const none{};
+    static QualityCorners const triangle{3, {{{0, 1, 2}, {1, 2, 0}, {2, 0, 1}}}};
+    static QualityCorners const quadrilateral{4, {{{0, 1, 3}, {1, 2, 0}, {2, 3, 1}, {3, 0, 2}}}};
+    static QualityCorners const tetrahedron{4, {{{0, 1, 2, 3}, {1, 2, 0, 3}, {2, 0, 1, 3}, {3, 0, 2, 1}}}};
+    static QualityCorners const hexahedron{8, {{
+        {0, 1, 3, 4}, {1, 2, 0, 5}, {2, 3, 1, 6}, {3, 0, 2, 7},
+        {4, 7, 5, 0}, {5, 4, 6, 1}, {6, 5, 7, 2}, {7, 6, 4, 3}}}};
+    static QualityCorners const prism{6, {{
+        {0, 1, 2, 3}, {1, 2, 0, 4}, {2, 0, 1, 5},
+        {3, 5, 4, 0}, {4, 3, 5, 1}, {5, 4, 3, 2}}}};
+    static QualityCorners const pyramid{4, {{{0, 1, 3, 4}, {1, 2, 0, 4}, {2, 3, 1, 4}, {3, 0, 2, 4}}}};
+    switch (type)
+    {
+    case CellType::TRIANGLE: return triangle;
+    case CellType::QUADRILATERAL: return quadrilateral;
+    case CellType::TETRAHEDRON: return tetrahedron;
+    case CellType::HEXAHEDRON: return hexahedron;
+    case CellType::PRISM: return prism;
+    case CellType::PYRAMID: return pyramid;
+    default: return none;
+    }
+}
+// clang-format on
+
+} /* end namespace detail */
+
+StaticMeshQuality::StaticMeshQuality(std::shared_ptr<StaticMesh const> mesh)
+    : m_mesh(std::move(mesh))
+{
+    if (!m_mesh)
+    {
+        throw std::invalid_argument("StaticMeshQuality: mesh must not be None");
+    }
+    if (2 != m_mesh->ndim() && 3 != m_mesh->ndim())
+    {
+        throw std::invalid_argument(Formatter() << "StaticMeshQuality: ndim must be 2 or 3 but is "
+                                                << static_cast<int>(m_mesh->ndim()));
+    }
+    if (0 != m_mesh->ncell() && 0 == m_mesh->nface())
+    {
+        throw std::runtime_error("StaticMeshQuality: the interior of the mesh must be built");
+    }
+
+    StaticMesh const & mh = *m_mesh;
+    size_t const ndim = mh.ndim();
+    size_t const ncell = mh.ncell();
+    real_type const nan = std::numeric_limits<real_type>::quiet_NaN();
+    m_aspect_ratio = SimpleArray<real_type>(small_vector<size_t>{ncell}, nan);
+    m_skewness = SimpleArray<real_type>(small_vector<size_t>{ncell}, nan);
+    m_min_dihedral = SimpleArray<real_type>(small_vector<size_t>{ncell}, nan);
+    m_scaled_jacobian = SimpleArray<real_type>(small_vector<size_t>{ncell}, nan);
+
+    auto const & ndcrd = mh.ndcrd();
+    auto const & clnds = mh.clnds();
+    auto const & clfcs = mh.clfcs();
+    auto const & fcnds = mh.fcnds();
+    auto const & fccls = mh.fccls();
+    auto const & fccnd = mh.fccnd();
+    auto const & fcnml = mh.fcnml();
+    auto const & clcnd = mh.clcnd();
+
+    parallel_for_chunks(
+        ncell,
+        ThreadPool::instance().use_parallel(ncell),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t icl = begin; icl < end; ++icl)
+            {
+                auto const icli = static_cast<StaticMesh::int_type>(icl);
+                detail::QualityCorners const & qc = detail::quality_corners(static_cast<uint8_t>(mh.cltpn(icl)));
+
+                // Edge lengths and scaled Jacobian at the corners.
+                real_type lmin = std::numeric_limits<real_type>::infinity();
+                real_type lmax = 0;
+                real_type jmin = std::numeric_limits<real_type>::infinity();
+                for (size_t icn = 0; icn < qc.ncorner; ++icn)
+                {
+                    std::array<uint8_t, 4> const & corner = qc.corners[icn];
+                    real_type const * const origin = ndcrd.vptr(clnds(icl, corner[0] + 1), 0);
+                    std::array<std::array<real_type, 3>, 3> vec{};
+                    real_type lprod = 1;
+                    for (size_t ivc = 0; ivc < ndim; ++ivc)
+                    {
+                        real_type const * const tip = ndcrd.vptr(clnds(icl, corner[ivc + 1] + 1), 0);
+                        real_type len2 = 0;
+                        for (size_t idm = 0; idm < ndim; ++idm)
+                        {
+                            vec[ivc][idm] = tip[idm] - origin[idm];
+                            len2 += vec[ivc][idm] * vec[ivc][idm];
+                        }
+                        real_type const len = std::sqrt(len2);
+                        lmin = std::min(lmin, len);
+                        lmax = std::max(lmax, len);
+                        lprod *= len;
+                    }
+                    real_type const det = 2 == ndim
+                                              ? vec[0][0] * vec[1][1] - vec[0][1] * vec[1][0]
+                                              : vec[0][0] * (vec[1][1] * vec[2][2] - vec[1][2] * vec[2][1]) -
+                                                    vec[0][1] * (vec[1][0] * vec[2][2] - vec[1][2] * vec[2][0]) +
+                                                    vec[0][2] * (vec[1][0] * vec[2][1] - vec[1][1] * vec[2][0]);
+                    jmin = std::min(jmin, lprod > 0 ? det / lprod : real_type(0));
+                }
+                if (qc.ncorner > 0)
+                {
+                    m_aspect_ratio(icl) = lmin > 0 ? lmax / lmin : std::numeric_limits<real_type>::infinity();
+                    m_scaled_jacobian(icl) = jmin;
+                }
+
+                // Skewness and dihedral angles from the face metric.  The
+                // normals are flipped to point out of the cell.
+                size_t const nfc = clfcs(icl, 0);
+                std::array<std::array<real_type, 3>, StaticMesh::CLMFC> normals{};
+                real_type skew = 0;
+                for (size_t ifl = 0; ifl < nfc; ++ifl)
+                {
+                    StaticMesh::int_type const ifc = clfcs(icl, ifl + 1);
+                    real_type const sgn = fccls(ifc, 0) == icli ? 1 : -1;
+                    real_type dot = 0;
+                    real_type len2 = 0;
+                    for (size_t idm = 0; idm < ndim; ++idm)
+                    {
+                        normals[ifl][idm] = sgn * fcnml(ifc, idm);
+                        real_type const dst = fccnd(ifc, idm) - clcnd(icl, idm);
+                        dot += dst * normals[ifl][idm];
+                        len2 += dst * dst;
+                    }
+                    skew = std::max(skew, len2 > 0 ? 1 - std::abs(dot) / std::sqrt(len2) : real_type(1));
+                }
+                m_skewness(icl) = skew;
+                real_type angle = std::numeric_limits<real_type>::infinity();
+                for (size_t ifl = 0; ifl < nfc; ++ifl)
+                {
+                    StaticMesh::int_type const ifc = clfcs(icl, ifl + 1);
+                    for (size_t jfl = ifl + 1; jfl < nfc; ++jfl)
+                    {
+                        StaticMesh::int_type const jfc = clfcs(icl, jfl + 1);
+                        // Adjacent faces share a node in 2D and an edge in 3D.
+                        size_t nshared = 0;
+                        for (StaticMesh::int_type inf = 1; inf <= fcnds(ifc, 0); ++inf)
+                        {
+                            for (StaticMesh::int_type jnf = 1; jnf <= fcnds(jfc, 0); ++jnf)
+                            {
+                                nshared += fcnds(ifc, inf) == fcnds(jfc, jnf) ? 1 : 0;
+                            }
+                        }
+                        if (nshared + 1 < ndim)
+                        {
+                            continue;
+                        }
+                        real_type dot = 0;
+                        for (size_t idm = 0; idm < ndim; ++idm)
+                        {
+                            dot += normals[ifl][idm] * normals[jfl][idm];
+                        }
+                        angle = std::min(angle, M_PI - std::acos(std::clamp(dot, real_type(-1), real_type(1))));
+                    }
+                }
+                if (nfc > 1)
+                {
+                    m_min_dihedral(icl) = angle;
+                }
+            }
+        });
+}
+
+size_t StaticMeshQuality::ninverted() const
+{
+    size_t count = 0;
+    for (size_t icl = 0; icl < m_scaled_jacobian.size(); ++icl)
+    {
+        count += m_scaled_jacobian(icl) <= 0 ? 1 : 0;
+    }
+    return count;
+}
+
+SimpleArray<uint64_t> StaticMeshQuality::histogram(SimpleArray<real_type> const & values, size_t nbin, real_type lower, real_type upper)
+{
+    if (0 == nbin)
+    {
+        throw std::invalid_argument("StaticMeshQuality: nbin must be positive");
+    }
+    if (!(upper > lower))
+    {
+        throw std::invalid_argument(Formatter() << "StaticMeshQuality: upper " << upper << " must be greater than lower " << lower);
+    }
+    SimpleArray<uint64_t> ret(small_vector<size_t>{nbin}, 0);
+    real_type const scale = static_cast<real_type>(nbin) / (upper - lower);
+    for (size_t it = 0; it < values.size(); ++it)
+    {
+        real_type const value = values.data()[it];
+        if (std::isnan(value))
+        {
+            continue;
+        }
+        real_type const pos = std::floor((value - lower) * scale);
+        size_t const ibin = pos < 0 ? 0 : std::min(nbin - 1, static_cast<size_t>(std::min(pos, static_cast<real_type>(nbin))));
+        ++ret(ibin);
+    }
+    return ret;
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
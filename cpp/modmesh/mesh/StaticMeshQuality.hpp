@@ -0,0 +1,100 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMesh.hpp>
+
+#include <memory>
+
+namespace modmesh
+{
+
+/**
+ * Quality measures of the body cells of a 2D or 3D StaticMesh, for spotting
+ * degenerate cells before a run.  The measures are computed in a parallel
+ * pass over the cells from the node coordinates and the face and cell metric
+ * of calc_metric:
+ *
+ *  1. aspect ratio: the longest over the shortest edge of the cell.
+ *  2. skewness: the largest 1 - |cos| over the faces of the angle between
+ *     the face normal and the vector from the cell center to the face
+ *     center, 0 for a cell centered on its faces.
+ *  3. minimum dihedral angle in radians between the adjacent faces, which is
+ *     the smallest corner angle in 2D.
+ *  4. scaled Jacobian: the smallest determinant of the edges at a corner
+ *     over the product of their lengths, which is not positive for an
+ *     inverted or collapsed cell.  The apex of a pyramid is skipped.
+ *
+ * The measures do not follow the later changes of the mesh.
+ */
+class StaticMeshQuality
+{
+
+public:
+
+    using real_type = StaticMesh::real_type;
+
+    explicit StaticMeshQuality(std::shared_ptr<StaticMesh const> mesh);
+
+    StaticMeshQuality() = delete;
+    StaticMeshQuality(StaticMeshQuality const &) = delete;
+    StaticMeshQuality(StaticMeshQuality &&) = delete;
+    StaticMeshQuality & operator=(StaticMeshQuality const &) = delete;
+    StaticMeshQuality & operator=(StaticMeshQuality &&) = delete;
+    ~StaticMeshQuality() = default;
+
+    std::shared_ptr<StaticMesh const> const & mesh() const { return m_mesh; }
+
+    SimpleArray<real_type> const & aspect_ratio() const { return m_aspect_ratio; }
+    SimpleArray<real_type> const & skewness() const { return m_skewness; }
+    SimpleArray<real_type> const & min_dihedral() const { return m_min_dihedral; }
+    SimpleArray<real_type> const & scaled_jacobian() const { return m_scaled_jacobian; }
+
+    /// Number of the cells of which the scaled Jacobian is not positive.
+    size_t ninverted() const;
+
+    /**
+     * Count the values in nbin equal bins over [lower, upper].  The values
+     * out of the range go to the first or the last bin, and NaN is skipped.
+     */
+    static SimpleArray<uint64_t> histogram(SimpleArray<real_type> const & values, size_t nbin, real_type lower, real_type upper);
+
+private:
+
+    std::shared_ptr<StaticMesh const> m_mesh;
+    SimpleArray<real_type> m_aspect_ratio;
+    SimpleArray<real_type> m_skewness;
+    SimpleArray<real_type> m_min_dihedral;
+    SimpleArray<real_type> m_scaled_jacobian;
+
+}; /* end class StaticMeshQuality */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
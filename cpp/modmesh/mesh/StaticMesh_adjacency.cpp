@@ -0,0 +1,455 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMesh.hpp>
+
+#include <atomic>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+/**
+ * Transpose the lists in the rows of a connectivity array, of which column 0
+ * is the count, into the CSR of the rows having each entity.  Negative
+ * (ghost) entities are skipped.  The counting and the filling run in
+ * parallel with atomic cursors, and each output row is sorted so the result
+ * does not depend on the thread count.
+ */
+inline StaticMeshAdjacency transpose_lists(SimpleArray<int32_t> const & lists, size_t nrow, size_t nentity)
+{
+    bool const parallel = ThreadPool::instance().use_parallel(nrow);
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    std::unique_ptr<std::atomic<uint64_t>[]> cursor(new std::atomic<uint64_t>[nentity + 1]);
+    for (size_t it = 0; it <= nentity; ++it)
+    {
+        cursor[it].store(0, std::memory_order_relaxed);
+    }
+
+    // Count the rows of each entity.
+    parallel_for_chunks(
+        nrow,
+        parallel,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t irow = begin; irow < end; ++irow)
+            {
+                int32_t const * list = lists.vptr(irow, 0);
+                for (int32_t it = 1; it <= list[0]; ++it)
+                {
+                    if (list[it] >= 0)
+                    {
+                        cursor[static_cast<size_t>(list[it]) + 1].fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+        });
+
+    // Prefix sum into the offsets.
+    StaticMeshAdjacency ret{SimpleArray<uint64_t>(nentity + 1), SimpleArray<int32_t>()};
+    uint64_t running = 0;
+    for (size_t it = 0; it <= nentity; ++it)
+    {
+        running += cursor[it].load(std::memory_order_relaxed);
+        ret.offsets[it] = running;
+        cursor[it].store(running, std::memory_order_relaxed);
+    }
+    ret.indices = SimpleArray<int32_t>(static_cast<size_t>(running));
+
+    // Fill and sort each row.
+    int32_t * const indices = ret.indices.data();
+    parallel_for_chunks(
+        nrow,
+        parallel,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t irow = begin; irow < end; ++irow)
+            {
+                int32_t const * list = lists.vptr(irow, 0);
+                for (int32_t it = 1; it <= list[0]; ++it)
+                {
+                    if (list[it] >= 0)
+                    {
+                        uint64_t const pos = cursor[static_cast<size_t>(list[it])].fetch_add(1, std::memory_order_relaxed);
+                        indices[pos] = static_cast<int32_t>(irow);
+                    }
+                }
+            }
+        });
+    uint64_t const * const offsets = ret.offsets.data();
+    parallel_for_chunks(
+        nentity,
+        ThreadPool::instance().use_parallel(nentity),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t it = begin; it < end; ++it)
+            {
+                std::sort(indices + offsets[it], indices + offsets[it + 1]);
+            }
+        });
+    return ret;
+}
+
+/**
+ * Drop the padding of the lists in the rows of a connectivity array.  The
+ * counts are summed serially and the rows are copied in parallel.
+ */
+inline StaticMeshAdjacency compact_lists(SimpleArray<int32_t> const & lists, size_t nrow)
+{
+    StaticMeshAdjacency ret{SimpleArray<uint64_t>(nrow + 1), SimpleArray<int32_t>()};
+    uint64_t * const offsets = ret.offsets.data();
+    offsets[0] = 0;
+    for (size_t irow = 0; irow < nrow; ++irow)
+    {
+        offsets[irow + 1] = offsets[irow] + static_cast<uint64_t>(std::max(lists(irow, 0), 0));
+    }
+    ret.indices = SimpleArray<int32_t>(static_cast<size_t>(offsets[nrow]));
+    int32_t * const indices = ret.indices.data();
+    parallel_for_chunks(
+        nrow,
+        ThreadPool::instance().use_parallel(nrow),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t irow = begin; irow < end; ++irow)
+            {
+                int32_t const * list = lists.vptr(irow, 1);
+                std::copy(list, list + (offsets[irow + 1] - offsets[irow]), indices + offsets[irow]);
+            }
+        });
+    return ret;
+}
+
+/**
+ * Color the items of a conflict graph and group them by color.  conflicts(i)
+ * returns the mask of the colors taken by the items conflicting with item
+ * i, and take(i, c) and drop(i, c) mark and unmark item i having color c.
+ *
+ * The first pass is the greedy coloring in order.  The second pass moves
+ * each item to the least used color it may take, so that the colors are of
+ * similar sizes while their number does not grow.  The passes are serial
+ * and the result does not depend on the thread count.
+ */
+template <typename Conflicts, typename Take, typename Drop>
+StaticMeshAdjacency color_items(size_t nitem, Conflicts && conflicts, Take && take, Drop && drop)
+{
+    constexpr size_t MAX_COLOR = 64;
+    SimpleArray<uint8_t> colors(nitem);
+    size_t ncolor = 0;
+    for (size_t it = 0; it < nitem; ++it)
+    {
+        uint64_t const taken = conflicts(it);
+        if (~taken == 0)
+        {
+            throw std::runtime_error(Formatter() << "StaticMesh: item " << it << " conflicts with more than "
+                                                 << MAX_COLOR - 1 << " colors");
+        }
+        uint8_t color = 0;
+        while (taken & (uint64_t(1) << color))
+        {
+            ++color;
+        }
+        colors[it] = color;
+        take(it, color);
+        ncolor = std::max(ncolor, size_t(color) + 1);
+    }
+
+    std::vector<size_t> sizes(ncolor, 0);
+    for (size_t it = 0; it < nitem; ++it)
+    {
+        ++sizes[colors[it]];
+    }
+    for (size_t it = 0; it < nitem; ++it)
+    {
+        uint8_t color = colors[it];
+        drop(it, color);
+        --sizes[color];
+        uint64_t const taken = conflicts(it);
+        for (uint8_t ic = 0; ic < ncolor; ++ic)
+        {
+            if (!(taken & (uint64_t(1) << ic)) && sizes[ic] < sizes[color])
+            {
+                color = ic;
+            }
+        }
+        colors[it] = color;
+        take(it, color);
+        ++sizes[color];
+    }
+
+    StaticMeshAdjacency ret{SimpleArray<uint64_t>(ncolor + 1), SimpleArray<int32_t>(nitem)};
+    ret.offsets[0] = 0;
+    for (size_t ic = 0; ic < ncolor; ++ic)
+    {
+        ret.offsets[ic + 1] = ret.offsets[ic] + sizes[ic];
+    }
+    std::vector<uint64_t> cursor(ret.offsets.begin(), ret.offsets.end() - 1);
+    for (size_t it = 0; it < nitem; ++it)
+    {
+        ret.indices[cursor[colors[it]]++] = static_cast<int32_t>(it);
+    }
+    return ret;
+}
+
+} /* end namespace detail */
+
+SimpleArray<int32_t> StaticMeshAdjacency::to_padded(size_t mcount) const
+{
+    size_t const nrow = this->nrow();
+    SimpleArray<int32_t> ret(small_vector<size_t>{nrow, mcount + 1}, -1);
+    for (size_t irow = 0; irow < nrow; ++irow)
+    {
+        size_t const nitem = count(irow);
+        if (nitem > mcount)
+        {
+            throw std::invalid_argument(Formatter() << "StaticMeshAdjacency: row " << irow << " has " << nitem
+                                                    << " items more than " << mcount);
+        }
+        ret(irow, 0) = static_cast<int32_t>(nitem);
+        std::copy_n(indices.data() + offsets[irow], nitem, ret.vptr(irow, 1));
+    }
+    return ret;
+}
+
+template <typename T>
+StaticMeshAdjacency const & BasicStaticMesh<T>::fcnds_csr() const
+{
+    if (!m_fcnds_csr)
+    {
+        m_fcnds_csr = std::make_unique<StaticMeshAdjacency>(detail::compact_lists(m_fcnds, m_nface));
+    }
+    return *m_fcnds_csr;
+}
+
+template <typename T>
+StaticMeshAdjacency const & BasicStaticMesh<T>::clnds_csr() const
+{
+    if (!m_clnds_csr)
+    {
+        m_clnds_csr = std::make_unique<StaticMeshAdjacency>(detail::compact_lists(m_clnds, m_ncell));
+    }
+    return *m_clnds_csr;
+}
+
+template <typename T>
+StaticMeshAdjacency const & BasicStaticMesh<T>::clfcs_csr() const
+{
+    if (!m_clfcs_csr)
+    {
+        m_clfcs_csr = std::make_unique<StaticMeshAdjacency>(detail::compact_lists(m_clfcs, m_ncell));
+    }
+    return *m_clfcs_csr;
+}
+
+template <typename T>
+StaticMeshAdjacency const & BasicStaticMesh<T>::node_cells() const
+{
+    if (!m_node_cells)
+    {
+        m_node_cells = std::make_unique<StaticMeshAdjacency>(detail::transpose_lists(m_clnds, m_ncell, m_nnode));
+    }
+    return *m_node_cells;
+}
+
+template <typename T>
+StaticMeshAdjacency const & BasicStaticMesh<T>::node_faces() const
+{
+    if (!m_node_faces)
+    {
+        m_node_faces = std::make_unique<StaticMeshAdjacency>(detail::transpose_lists(m_fcnds, m_nface, m_nnode));
+    }
+    return *m_node_faces;
+}
+
+template <typename T>
+StaticMeshAdjacency const & BasicStaticMesh<T>::cell_cells() const
+{
+    if (m_cell_cells)
+    {
+        return *m_cell_cells;
+    }
+
+    // A negative related cell is a ghost cell once the ghost is built, and no
+    // cell before that.
+    auto const ngstcell = static_cast<int_type>(m_ngstcell);
+    auto neighbor = [this, ngstcell](int_type icl, int_type ifc)
+    {
+        int_type const jcl = m_fccls(ifc, 0) == icl ? m_fccls(ifc, 1) : m_fccls(ifc, 0);
+        return jcl != icl && jcl >= -ngstcell && jcl < static_cast<int_type>(m_ncell) ? jcl : std::numeric_limits<int_type>::min();
+    };
+    bool const parallel = ThreadPool::instance().use_parallel(m_ncell);
+
+    StaticMeshAdjacency ret{SimpleArray<uint64_t>(static_cast<size_t>(m_ncell) + 1), SimpleArray<int32_t>()};
+    uint64_t * const offsets = ret.offsets.data();
+    offsets[0] = 0;
+    parallel_for_chunks(
+        m_ncell,
+        parallel,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t icl = begin; icl < end; ++icl)
+            {
+                uint64_t count = 0;
+                for (int_type ifl = 1; ifl <= m_clfcs(icl, 0); ++ifl)
+                {
+                    count += neighbor(static_cast<int_type>(icl), m_clfcs(icl, ifl)) != std::numeric_limits<int_type>::min() ? 1 : 0;
+                }
+                offsets[icl + 1] = count;
+            }
+        });
+    std::partial_sum(offsets, offsets + m_ncell + 1, offsets);
+    ret.indices = SimpleArray<int32_t>(static_cast<size_t>(offsets[m_ncell]));
+    int32_t * const indices = ret.indices.data();
+    parallel_for_chunks(
+        m_ncell,
+        parallel,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t icl = begin; icl < end; ++icl)
+            {
+                uint64_t pos = offsets[icl];
+                for (int_type ifl = 1; ifl <= m_clfcs(icl, 0); ++ifl)
+                {
+                    int_type const jcl = neighbor(static_cast<int_type>(icl), m_clfcs(icl, ifl));
+                    if (jcl != std::numeric_limits<int_type>::min())
+                    {
+                        indices[pos++] = jcl;
+                    }
+                }
+            }
+        });
+
+    m_cell_cells = std::make_unique<StaticMeshAdjacency>(std::move(ret));
+    return *m_cell_cells;
+}
+
+template <typename T>
+StaticMeshAdjacency const & BasicStaticMesh<T>::face_colors() const
+{
+    if (m_face_colors)
+    {
+        return *m_face_colors;
+    }
+
+    // The colors taken by the faces of each cell, ghost cells first.  A cell
+    // has at most one face of a color, so a face drops its color by clearing
+    // the bits.
+    size_t const ngstcell = m_ngstcell;
+    std::vector<uint64_t> masks(ngstcell + m_ncell, 0);
+    auto slot = [this, ngstcell](size_t ifc, size_t side)
+    {
+        int_type const icl = m_fccls(ifc, side);
+        bool const valid = icl >= -static_cast<int_type>(ngstcell) && icl < static_cast<int_type>(m_ncell);
+        return valid ? static_cast<size_t>(static_cast<int64_t>(icl) + static_cast<int64_t>(ngstcell)) : SIZE_MAX;
+    };
+    auto conflicts = [&](size_t ifc)
+    {
+        uint64_t taken = 0;
+        for (size_t side = 0; side < 2; ++side)
+        {
+            size_t const is = slot(ifc, side);
+            taken |= SIZE_MAX == is ? 0 : masks[is];
+        }
+        return taken;
+    };
+    auto update = [&](size_t ifc, uint8_t color, bool set)
+    {
+        for (size_t side = 0; side < 2; ++side)
+        {
+            size_t const is = slot(ifc, side);
+            if (SIZE_MAX != is)
+            {
+                masks[is] = set ? masks[is] | (uint64_t(1) << color) : masks[is] & ~(uint64_t(1) << color);
+            }
+        }
+    };
+    m_face_colors = std::make_unique<StaticMeshAdjacency>(detail::color_items(
+        m_nface,
+        conflicts,
+        [&](size_t ifc, uint8_t color)
+        { update(ifc, color, true); },
+        [&](size_t ifc, uint8_t color)
+        { update(ifc, color, false); }));
+    return *m_face_colors;
+}
+
+template <typename T>
+StaticMeshAdjacency const & BasicStaticMesh<T>::cell_colors() const
+{
+    if (m_cell_colors)
+    {
+        return *m_cell_colors;
+    }
+
+    StaticMeshAdjacency const & adj = cell_cells();
+    // The color of each cell, or NONE before it is colored.
+    constexpr uint8_t NONE = UINT8_MAX;
+    std::vector<uint8_t> colors(m_ncell, NONE);
+    auto conflicts = [&](size_t icl)
+    {
+        uint64_t taken = 0;
+        for (int32_t const jcl : adj.row(icl))
+        {
+            if (jcl >= 0 && NONE != colors[static_cast<size_t>(jcl)])
+            {
+                taken |= uint64_t(1) << colors[static_cast<size_t>(jcl)];
+            }
+        }
+        return taken;
+    };
+    m_cell_colors = std::make_unique<StaticMeshAdjacency>(detail::color_items(
+        m_ncell,
+        conflicts,
+        [&](size_t icl, uint8_t color)
+        { colors[icl] = color; },
+        [&](size_t icl, uint8_t)
+        { colors[icl] = NONE; }));
+    return *m_cell_colors;
+}
+
+template StaticMeshAdjacency const & BasicStaticMesh<float>::fcnds_csr() const;
+template StaticMeshAdjacency const & BasicStaticMesh<float>::clnds_csr() const;
+template StaticMeshAdjacency const & BasicStaticMesh<float>::clfcs_csr() const;
+template StaticMeshAdjacency const & BasicStaticMesh<float>::node_cells() const;
+template StaticMeshAdjacency const & BasicStaticMesh<float>::node_faces() const;
+template StaticMeshAdjacency const & BasicStaticMesh<float>::cell_cells() const;
+template StaticMeshAdjacency const & BasicStaticMesh<float>::face_colors() const;
+template StaticMeshAdjacency const & BasicStaticMesh<float>::cell_colors() const;
+template StaticMeshAdjacency const & BasicStaticMesh<double>::fcnds_csr() const;
+template StaticMeshAdjacency const & BasicStaticMesh<double>::clnds_csr() const;
+template StaticMeshAdjacency const & BasicStaticMesh<double>::clfcs_csr() const;
+template StaticMeshAdjacency const & BasicStaticMesh<double>::node_cells() const;
+template StaticMeshAdjacency const & BasicStaticMesh<double>::node_faces() const;
+template StaticMeshAdjacency const & BasicStaticMesh<double>::cell_cells() const;
+template StaticMeshAdjacency const & BasicStaticMesh<double>::face_colors() const;
+template StaticMeshAdjacency const & BasicStaticMesh<double>::cell_colors() const;
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -31,6 +31,64 @@
 namespace modmesh
 {
 
+namespace detail
+{
+
+/// Call body(ighost) for each of the ghost indices -1, -2, ..., -nghost, in parallel when there are enough of them.
+template <typename I, typename F>
+void parallel_for_ghosts(size_t nghost, F && body)
+{
+    parallel_for_chunks(
+        nghost,
+        ThreadPool::instance().use_parallel(nghost),
+        [&body](size_t begin, size_t end)
+        {
+            for (size_t it = begin; it < end; ++it)
+            {
+                body(-static_cast<I>(it) - 1);
+            }
+        });
+}
+
+/**
+ * Set the ghost part of the newly allocated array to the initial value and
+ * copy the body from the old array, both in parallel chunks.  The rows of
+ * the old array may be wider than the new ones, e.g., ndcrd of 3 columns from
+ * Gmsh for a 2D mesh, so the body is copied row by row at the source stride
+ * and the columns not in the old array take the initial value.
+ */
+template <typename T>
+void fill_ghost_and_copy_body(SimpleArray<T> const & src, SimpleArray<T> & dst, T initial)
+{
+    SimpleArraySpan<T> const ghost = dst.ghost_range();
+    parallel_for_chunks(
+        ghost.size(),
+        ThreadPool::instance().use_parallel(ghost.size()),
+        [&](size_t begin, size_t end)
+        { std::fill(ghost.begin() + begin, ghost.begin() + end, initial); });
+    SimpleArraySpan<T> const body = dst.body_range();
+    T const * const srcbody = src.body();
+    size_t const dcol = dst.ndim() > 1 ? dst.shape(1) : 1;
+    size_t const scol = src.ndim() > 1 ? src.shape(1) : 1;
+    size_t const sstride = src.ndim() > 1 ? src.stride(0) : 1;
+    size_t const ncol = std::min(scol, dcol);
+    size_t const nrow = body.size() / dcol;
+    parallel_for_chunks(
+        nrow,
+        ThreadPool::instance().use_parallel(body.size()),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t it = begin; it < end; ++it)
+            {
+                T * const row = body.begin() + it * dcol;
+                std::copy_n(srcbody + it * sstride, ncol, row);
+                std::fill(row + ncol, row + dcol, initial);
+            }
+        });
+}
+
+} /* end namespace detail */
+
 /**
  * Calculate all metric information, including:
  *
@@ -41,62 +99,74 @@ namespace modmesh
  *
  * And fcnds could be reordered.
  */
+template <typename T>
 /* NOLINTNEXTLINE(readability-function-cognitive-complexity) */
-void StaticMesh::build_boundary()
+void BasicStaticMesh<T>::build_boundary()
 {
     assert(0 == m_nbound); // nothing should touch m_nbound beforehand.
-    for (size_t it = 0; it < fccls().shape(0); ++it)
-    {
-        if (fccls()(it, 1) < 0)
-        {
-            m_nbound += 1;
-        }
-    }
-    SimpleArray<int_type>(std::vector<size_t>{m_nbound, StaticMeshBC::BFREL}, -1).swap(m_bndfcs);
 
-    std::vector<int_type> allfacn(m_nbound);
-    size_t ait = 0;
+    // Map each boundary face to its slot in allfacn, so that the faces listed
+    // in the boundary conditions are matched in constant time.
+    std::vector<int_type> allfacn;
+    std::vector<int_type> fcslot(nface(), -1);
     for (size_t ifc = 0; ifc < nface(); ++ifc)
     {
         if (fcjcl(static_cast<int_type>(ifc)) < 0)
         {
-            assert(ait < allfacn.size());
-            allfacn[ait] = static_cast<int_type>(ifc);
-            ++ait;
+            fcslot[ifc] = static_cast<int_type>(allfacn.size());
+            allfacn.push_back(static_cast<int_type>(ifc));
         }
     }
+    m_nbound = static_cast<uint_type>(allfacn.size());
+    SimpleArray<int_type>(std::vector<size_t>{m_nbound, StaticMeshBC::BFREL}, -1).swap(m_bndfcs);
 
-    std::vector<bool> specified(m_nbound, false);
+    std::vector<char> specified(m_nbound, 0);
     size_t ibfc = 0;
-    ssize_t nleft = m_nbound;
+    size_t nleft = m_nbound;
     for (size_t ibnd = 0; ibnd < m_bcs.size(); ++ibnd)
     {
         StaticMeshBC & bnd = m_bcs[ibnd];
         auto & bfacn = bnd.facn();
-        for (size_t bfit = 0; bfit < bfacn.nbody(); ++bfit)
+        size_t const nbfc = bfacn.nbody();
+        if (ibfc + nbfc > m_nbound)
+        {
+            throw std::invalid_argument(Formatter() << "StaticMesh: boundary conditions list more than the "
+                                                    << m_nbound << " boundary faces");
+        }
+        for (size_t bfit = 0; bfit < nbfc; ++bfit)
         {
-            /**
-             * First column is the face index in block.  The second column is the face
-             * index in bndfcs.  The third column is the face index of the related
-             * block (if exists).
-             */
-            m_bndfcs(ibfc, 0) = bfacn(bfit, 0);
-            m_bndfcs(ibfc, 1) = static_cast<int_type>(ibnd);
-            bfacn(bfit, 1) = static_cast<int_type>(ibfc);
-            auto found = std::find(allfacn.begin(), allfacn.end(), bfacn(bfit, 0));
-            if (allfacn.end() != found)
+            int_type const ifc = bfacn(bfit, 0);
+            int_type const sit = (ifc >= 0 && static_cast<size_t>(ifc) < fcslot.size()) ? fcslot[ifc] : -1;
+            if (sit >= 0 && !specified[sit])
             {
-                specified.at(found - allfacn.begin()) = true;
+                specified[sit] = 1;
                 --nleft;
             }
-            ++ibfc;
         }
+        /**
+         * First column is the face index in block.  The second column is the face
+         * index in bndfcs.  The third column is the face index of the related
+         * block (if exists).
+         */
+        size_t const ibfc0 = ibfc;
+        parallel_for_chunks(
+            nbfc,
+            ThreadPool::instance().use_parallel(nbfc),
+            [&](size_t begin, size_t end)
+            {
+                for (size_t bfit = begin; bfit < end; ++bfit)
+                {
+                    m_bndfcs(ibfc0 + bfit, 0) = bfacn(bfit, 0);
+                    m_bndfcs(ibfc0 + bfit, 1) = static_cast<int_type>(ibnd);
+                    bfacn(bfit, 1) = static_cast<int_type>(ibfc0 + bfit);
+                }
+            });
+        ibfc += nbfc;
     }
-    assert(nleft >= 0);
 
     if (nleft != 0)
     {
-        StaticMeshBC bnd(static_cast<size_t>(nleft));
+        StaticMeshBC bnd(nleft);
         auto & bfacn = bnd.facn();
         size_t bfit = 0;
         size_t const ibnd = m_bcs.size();
@@ -118,39 +188,33 @@ void StaticMesh::build_boundary()
     assert(ibfc == m_nbound);
 }
 
+template <typename T>
 /* NOLINTNEXTLINE(readability-function-cognitive-complexity) */
-void StaticMesh::build_ghost()
+void BasicStaticMesh<T>::build_ghost()
 {
+    clear_adjacency();
 
     auto count_ghost_tuple = count_ghost();
     m_ngstnode = static_cast<uint_type>(std::get<0>(count_ghost_tuple));
     m_ngstface = static_cast<uint_type>(std::get<1>(count_ghost_tuple));
     m_ngstcell = static_cast<uint_type>(std::get<2>(count_ghost_tuple));
 
-#define MM_DECL_GHOST_SWAP1(N, T, D1, I)                                  \
-    {                                                                     \
-        SimpleArray<T> arr(std::vector<size_t>{m_ngst##D1 + m_n##D1}, I); \
-        arr.set_nghost(m_ngst##D1);                                       \
-        for (int_type it = 0; it < static_cast<int_type>(m_n##D1); ++it)  \
-        {                                                                 \
-            arr(it) = m_##N(it);                                          \
-        }                                                                 \
-        arr.swap(m_##N);                                                  \
+    // The body is copied over and only the ghost part takes the initial
+    // value, so the new arrays are written once.
+#define MM_DECL_GHOST_SWAP1(N, T, D1, I)                                                            \
+    {                                                                                               \
+        SimpleArray<T> arr(small_vector<size_t>{m_ngst##D1 + m_n##D1}, SimpleArrayUninitialized{}); \
+        arr.set_nghost(m_ngst##D1);                                                                 \
+        detail::fill_ghost_and_copy_body(m_##N, arr, static_cast<T>(I));                            \
+        arr.swap(m_##N);                                                                            \
     }
 
-#define MM_DECL_GHOST_SWAP2(N, T, D1, D2, I)                                  \
-    {                                                                         \
-        SimpleArray<T> arr(std::vector<size_t>{m_ngst##D1 + m_n##D1, D2}, I); \
-        arr.set_nghost(m_ngst##D1);                                           \
-        for (int_type it = 0; it < static_cast<int_type>(m_n##D1); ++it)      \
-        {                                                                     \
-            for (int_type jt = 0; jt < static_cast<int_type>(D2); ++jt)       \
-            {                                                                 \
-                arr(it, jt) = m_##N(it, jt);                                  \
-            }                                                                 \
-            arr(it) = m_##N(it);                                              \
-        }                                                                     \
-        arr.swap(m_##N);                                                      \
+#define MM_DECL_GHOST_SWAP2(N, T, D1, D2, I)                                                            \
+    {                                                                                                   \
+        SimpleArray<T> arr(small_vector<size_t>{m_ngst##D1 + m_n##D1, D2}, SimpleArrayUninitialized{}); \
+        arr.set_nghost(m_ngst##D1);                                                                     \
+        detail::fill_ghost_and_copy_body(m_##N, arr, static_cast<T>(I));                                \
+        arr.swap(m_##N);                                                                                \
     }
 
     // geometry arrays.
@@ -174,6 +238,10 @@ void StaticMesh::build_ghost()
 #undef MM_DECL_GHOST_SWAP2
 
     fill_ghost();
+    if (m_soa)
+    {
+        sync_soa();
+    }
 }
 
 /**
@@ -182,7 +250,8 @@ void StaticMesh::build_ghost()
  * @return std::tuple<size_t, size_t, size_t>
  *  ngstnode, ngstface, ngstcell
  */
-std::tuple<size_t, size_t, size_t> StaticMesh::count_ghost() const
+template <typename T>
+std::tuple<size_t, size_t, size_t> BasicStaticMesh<T>::count_ghost() const
 {
     size_t ngstface = 0;
     size_t ngstnode = 0;
@@ -213,347 +282,395 @@ std::tuple<size_t, size_t, size_t> StaticMesh::count_ghost() const
  * indices for ghost information should be carefully treated.  All the
  * ghost indices are negative in shared arrays.
  */
+template <typename T>
 /* NOLINTNEXTLINE(readability-function-cognitive-complexity) */
-inline void StaticMesh::fill_ghost()
+inline void BasicStaticMesh<T>::fill_ghost()
 {
-    std::vector<int_type> gstndmap(nnode(), nnode());
+    size_t const ngcl = ngstcell();
+    auto is_face_node = [this](int_type ifc, int_type ind)
+    {
+        for (size_t inf = 1; inf <= static_cast<size_t>(m_fcnds(ifc, 0)); ++inf)
+        {
+            if (ind == m_fcnds(ifc, inf))
+            {
+                return true;
+            }
+        }
+        return false;
+    };
 
-    // create ghost entities and buil connectivities and by the way mirror node
-    // coordinate.
-    int_type ignd = -1;
-    int_type igfc = -1;
-    for (int_type igcl = -1; igcl >= -static_cast<int_type>(ngstcell()); --igcl)
+    // Number the ghost nodes and faces of each ghost cell by the prefix sums
+    // of their counts, so that the ghost cells can be filled independently.
+    std::vector<int_type> gndoffset(ngcl + 1, 0);
+    std::vector<int_type> gfcoffset(ngcl + 1, 0);
+    for (size_t it = 0; it < ngcl; ++it)
     {
-        int_type const ibfc = m_bndfcs(-igcl - 1, 0);
+        int_type const ibfc = m_bndfcs(it, 0);
         int_type const icl = m_fccls(ibfc, 0);
-        // copy cell type and group.
-        m_cltpn(igcl) = m_cltpn(icl);
-        m_clgrp(igcl) = m_clgrp(icl);
-        // process node list in ghost cell.
-        for (size_t inl = 0; inl <= CLMND; ++inl) // copy nodes from current in-cell.
+        int_type ngnd = 0;
+        for (size_t inl = 1; inl <= static_cast<size_t>(m_clnds(icl, 0)); ++inl)
         {
-            m_clnds(igcl, inl) = m_clnds(icl, inl);
+            ngnd += is_face_node(ibfc, m_clnds(icl, inl)) ? 0 : 1;
         }
-        for (size_t inl = 1; inl <= static_cast<size_t>(m_clnds(icl, 0)); ++inl)
+        int_type ngfc = 0;
+        for (size_t ifl = 1; ifl <= static_cast<size_t>(m_clfcs(icl, 0)); ++ifl)
         {
-            int_type const ind = m_clnds(icl, inl);
-            // try to find the node in the boundary face.
-            bool mk_found = false;
-            for (size_t inf = 1; inf <= static_cast<size_t>(m_fcnds(ibfc, 0)); ++inf)
+            ngfc += (m_clfcs(icl, ifl) == ibfc) ? 0 : 1;
+        }
+        gndoffset[it + 1] = gndoffset[it] + ngnd;
+        gfcoffset[it + 1] = gfcoffset[it] + ngfc;
+    }
+    assert(static_cast<uint_type>(gndoffset[ngcl]) == ngstnode());
+    assert(static_cast<uint_type>(gfcoffset[ngcl]) == ngstface());
+
+    // create ghost entities and buil connectivities and by the way mirror node
+    // coordinate.
+    detail::parallel_for_ghosts<int_type>(
+        ngcl,
+        [&](int_type igcl)
+        {
+            int_type const ibfc = m_bndfcs(-igcl - 1, 0);
+            int_type const icl = m_fccls(ibfc, 0);
+            int_type ignd = -gndoffset[-igcl - 1] - 1;
+            int_type igfc = -gfcoffset[-igcl - 1] - 1;
+            // copy cell type and group.
+            m_cltpn(igcl) = m_cltpn(icl);
+            m_clgrp(igcl) = m_clgrp(icl);
+            // process node list in ghost cell.
+            for (size_t inl = 0; inl <= CLMND; ++inl) // copy nodes from current in-cell.
             {
-                if (ind == m_fcnds(ibfc, inf))
-                {
-                    mk_found = true;
-                    break;
-                }
+                m_clnds(igcl, inl) = m_clnds(icl, inl);
             }
-            // if not found, it should be a ghost node.
-            if (!mk_found)
+            size_t const nnd = static_cast<size_t>(m_clnds(icl, 0));
+            for (size_t inl = 1; inl <= nnd; ++inl)
             {
-                gstndmap[ind] = ignd; // record map for face processing.
-                m_clnds(igcl, inl) = ignd; // save to clnds.
-                // mirror coordinate of ghost cell.
-                // NOTE: fcnml always points outward.
-                real_type dist = 0.0;
-                for (size_t idm = 0; idm < m_ndim; ++idm)
-                {
-                    dist += (m_fccnd(ibfc, idm) - m_ndcrd(ind, idm)) * m_fcnml(ibfc, idm);
-                }
-                for (size_t idm = 0; idm < m_ndim; ++idm)
+                int_type const ind = m_clnds(icl, inl);
+                // if not found in the boundary face, it should be a ghost node.
+                if (!is_face_node(ibfc, ind))
                 {
-                    m_ndcrd(ignd, idm) = m_ndcrd(ind, idm) + 2 * dist * m_fcnml(ibfc, idm);
+                    m_clnds(igcl, inl) = ignd; // save to clnds.
+                    // mirror coordinate of ghost cell.
+                    // NOTE: fcnml always points outward.
+                    real_type dist = 0.0;
+                    for (size_t idm = 0; idm < m_ndim; ++idm)
+                    {
+                        dist += (m_fccnd(ibfc, idm) - m_ndcrd(ind, idm)) * m_fcnml(ibfc, idm);
+                    }
+                    for (size_t idm = 0; idm < m_ndim; ++idm)
+                    {
+                        m_ndcrd(ignd, idm) = m_ndcrd(ind, idm) + 2 * dist * m_fcnml(ibfc, idm);
+                    }
+                    // decrement ghost node counter.
+                    ignd -= 1;
                 }
-                // decrement ghost node counter.
-                ignd -= 1;
             }
-        }
-        // set the relating cell as ghost cell.
-        m_fccls(ibfc, 1) = igcl;
-        // process face list in ghost cell.
-        for (size_t ifl = 0; ifl <= CLMFC; ++ifl)
-        {
-            m_clfcs(igcl, ifl) = m_clfcs(icl, ifl); // copy in-face to ghost.
-        }
-        for (size_t ifl = 1; ifl <= static_cast<size_t>(m_clfcs(icl, 0)); ++ifl)
-        {
-            int_type const ifc = m_clfcs(icl, ifl); // the face to be processed.
-            if (ifc == ibfc)
-            {
-                continue;
-            } // if boundary face then skip.
-            m_fctpn(igfc) = m_fctpn(ifc); // copy face type.
-            m_fccls(igfc, 0) = igcl; // save to ghost fccls.
-            m_clfcs(igcl, ifl) = igfc; // save to ghost clfcs.
-            // face-to-node connectivity.
-            for (size_t inf = 0; inf <= FCMND; ++inf)
+            // set the relating cell as ghost cell.
+            m_fccls(ibfc, 1) = igcl;
+            // process face list in ghost cell.
+            for (size_t ifl = 0; ifl <= CLMFC; ++ifl)
             {
-                m_fcnds(igfc, inf) = m_fcnds(ifc, inf);
+                m_clfcs(igcl, ifl) = m_clfcs(icl, ifl); // copy in-face to ghost.
             }
-            for (size_t inf = 1; inf <= static_cast<size_t>(m_fcnds(igfc, 0)); ++inf)
+            for (size_t ifl = 1; ifl <= static_cast<size_t>(m_clfcs(icl, 0)); ++ifl)
             {
-                int_type const ind = m_fcnds(igfc, inf);
-                if (gstndmap[ind] != static_cast<int_type>(nnode()))
+                int_type const ifc = m_clfcs(icl, ifl); // the face to be processed.
+                if (ifc == ibfc)
                 {
-                    m_fcnds(igfc, inf) = gstndmap[ind]; // save gstnode to fcnds.
+                    continue;
+                } // if boundary face then skip.
+                m_fctpn(igfc) = m_fctpn(ifc); // copy face type.
+                m_fccls(igfc, 0) = igcl; // save to ghost fccls.
+                m_clfcs(igcl, ifl) = igfc; // save to ghost clfcs.
+                // face-to-node connectivity.
+                for (size_t inf = 0; inf <= FCMND; ++inf)
+                {
+                    m_fcnds(igfc, inf) = m_fcnds(ifc, inf);
+                }
+                // replace the mirrored nodes with the ghost nodes.
+                for (size_t inf = 1; inf <= static_cast<size_t>(m_fcnds(igfc, 0)); ++inf)
+                {
+                    for (size_t inl = 1; inl <= nnd; ++inl)
+                    {
+                        if (m_fcnds(ifc, inf) == m_clnds(icl, inl) && m_clnds(igcl, inl) < 0)
+                        {
+                            m_fcnds(igfc, inf) = m_clnds(igcl, inl); // save gstnode to fcnds.
+                            break;
+                        }
+                    }
                 }
+                // decrement ghost face counter.
+                igfc -= 1;
             }
-            // decrement ghost face counter.
-            igfc -= 1;
-        }
-        // erase node map record.
-        for (size_t inl = 1; inl <= static_cast<size_t>(m_clnds(icl, 0)); ++inl)
-        {
-            gstndmap[m_clnds(icl, inl)] = nnode();
-        }
-    }
+        });
 
     // compute ghost face centroids.
     if (m_ndim == 2)
     {
         // 2D faces must be edge.
-        for (int_type ifc = -1; ifc >= -static_cast<int_type>(ngstface()); --ifc)
-        {
-            // point 1.
-            int_type ind = m_fcnds(ifc, 1);
-            m_fccnd(ifc, 0) = m_ndcrd(ind, 0);
-            m_fccnd(ifc, 1) = m_ndcrd(ind, 1);
-            // point 2.
-            ind = m_fcnds(ifc, 2);
-            m_fccnd(ifc, 0) += m_ndcrd(ind, 0);
-            m_fccnd(ifc, 1) += m_ndcrd(ind, 1);
-            // average.
-            m_fccnd(ifc, 0) /= 2;
-            m_fccnd(ifc, 1) /= 2;
-        }
+        detail::parallel_for_ghosts<int_type>(
+            ngstface(),
+            [&](int_type ifc)
+            {
+                // point 1.
+                int_type ind = m_fcnds(ifc, 1);
+                m_fccnd(ifc, 0) = m_ndcrd(ind, 0);
+                m_fccnd(ifc, 1) = m_ndcrd(ind, 1);
+                // point 2.
+                ind = m_fcnds(ifc, 2);
+                m_fccnd(ifc, 0) += m_ndcrd(ind, 0);
+                m_fccnd(ifc, 1) += m_ndcrd(ind, 1);
+                // average.
+                m_fccnd(ifc, 0) /= 2;
+                m_fccnd(ifc, 1) /= 2;
+            });
     }
     else if (m_ndim == 3)
     {
-        std::array<std::array<real_type, 3>, FCMND + 2> cfd; // NOLINT(cppcoreguidelines-pro-type-member-init)
-        for (int_type ifc = -1; ifc >= -static_cast<int_type>(ngstface()); --ifc)
-        {
-            // find averaged point.
-            cfd[0][0] = cfd[0][1] = cfd[0][2] = 0.0;
-            size_t const nnd = m_fcnds(ifc, 0);
-            for (size_t inf = 1; inf <= nnd; ++inf)
-            {
-                int_type const ind = m_fcnds(ifc, inf);
-                cfd[inf][0] = m_ndcrd(ind, 0);
-                cfd[0][0] += m_ndcrd(ind, 0);
-                cfd[inf][1] = m_ndcrd(ind, 1);
-                cfd[0][1] += m_ndcrd(ind, 1);
-                cfd[inf][2] = m_ndcrd(ind, 2);
-                cfd[0][2] += m_ndcrd(ind, 2);
-            }
-            cfd[nnd + 1][0] = cfd[1][0];
-            cfd[nnd + 1][1] = cfd[1][1];
-            cfd[nnd + 1][2] = cfd[1][2];
-            cfd[0][0] /= nnd;
-            cfd[0][1] /= nnd;
-            cfd[0][2] /= nnd;
-            // calculate area.
-            m_fccnd(ifc, 0) = m_fccnd(ifc, 1) = m_fccnd(ifc, 2) = 0.0;
-            real_type voc = 0.0;
-            for (size_t inf = 1; inf <= nnd; ++inf)
+        detail::parallel_for_ghosts<int_type>(
+            ngstface(),
+            [&](int_type ifc)
             {
-                std::array<real_type, 3> crd; // NOLINT(cppcoreguidelines-pro-type-member-init)
-                crd[0] = (cfd[0][0] + cfd[inf][0] + cfd[inf + 1][0]) / 3;
-                crd[1] = (cfd[0][1] + cfd[inf][1] + cfd[inf + 1][1]) / 3;
-                crd[2] = (cfd[0][2] + cfd[inf][2] + cfd[inf + 1][2]) / 3;
-                real_type const du0 = cfd[inf][0] - cfd[0][0];
-                real_type const du1 = cfd[inf][1] - cfd[0][1];
-                real_type const du2 = cfd[inf][2] - cfd[0][2];
-                real_type const dv0 = cfd[inf + 1][0] - cfd[0][0];
-                real_type const dv1 = cfd[inf + 1][1] - cfd[0][1];
-                real_type const dv2 = cfd[inf + 1][2] - cfd[0][2];
-                real_type const dw0 = du1 * dv2 - du2 * dv1;
-                real_type const dw1 = du2 * dv0 - du0 * dv2;
-                real_type const dw2 = du0 * dv1 - du1 * dv0;
-                real_type const vob = std::sqrt(dw0 * dw0 + dw1 * dw1 + dw2 * dw2);
-                m_fccnd(ifc, 0) += crd[0] * vob;
-                m_fccnd(ifc, 1) += crd[1] * vob;
-                m_fccnd(ifc, 2) += crd[2] * vob;
-                voc += vob;
-            }
-            m_fccnd(ifc, 0) /= voc;
-            m_fccnd(ifc, 1) /= voc;
-            m_fccnd(ifc, 2) /= voc;
-        }
+                std::array<std::array<real_type, 3>, FCMND + 2> cfd; // NOLINT(cppcoreguidelines-pro-type-member-init)
+                // find averaged point.
+                cfd[0][0] = cfd[0][1] = cfd[0][2] = 0.0;
+                size_t const nnd = m_fcnds(ifc, 0);
+                for (size_t inf = 1; inf <= nnd; ++inf)
+                {
+                    int_type const ind = m_fcnds(ifc, inf);
+                    cfd[inf][0] = m_ndcrd(ind, 0);
+                    cfd[0][0] += m_ndcrd(ind, 0);
+                    cfd[inf][1] = m_ndcrd(ind, 1);
+                    cfd[0][1] += m_ndcrd(ind, 1);
+                    cfd[inf][2] = m_ndcrd(ind, 2);
+                    cfd[0][2] += m_ndcrd(ind, 2);
+                }
+                cfd[nnd + 1][0] = cfd[1][0];
+                cfd[nnd + 1][1] = cfd[1][1];
+                cfd[nnd + 1][2] = cfd[1][2];
+                cfd[0][0] /= nnd;
+                cfd[0][1] /= nnd;
+                cfd[0][2] /= nnd;
+                // calculate area.
+                m_fccnd(ifc, 0) = m_fccnd(ifc, 1) = m_fccnd(ifc, 2) = 0.0;
+                real_type voc = 0.0;
+                for (size_t inf = 1; inf <= nnd; ++inf)
+                {
+                    std::array<real_type, 3> crd; // NOLINT(cppcoreguidelines-pro-type-member-init)
+                    crd[0] = (cfd[0][0] + cfd[inf][0] + cfd[inf + 1][0]) / 3;
+                    crd[1] = (cfd[0][1] + cfd[inf][1] + cfd[inf + 1][1]) / 3;
+                    crd[2] = (cfd[0][2] + cfd[inf][2] + cfd[inf + 1][2]) / 3;
+                    real_type const du0 = cfd[inf][0] - cfd[0][0];
+                    real_type const du1 = cfd[inf][1] - cfd[0][1];
+                    real_type const du2 = cfd[inf][2] - cfd[0][2];
+                    real_type const dv0 = cfd[inf + 1][0] - cfd[0][0];
+                    real_type const dv1 = cfd[inf + 1][1] - cfd[0][1];
+                    real_type const dv2 = cfd[inf + 1][2] - cfd[0][2];
+                    real_type const dw0 = du1 * dv2 - du2 * dv1;
+                    real_type const dw1 = du2 * dv0 - du0 * dv2;
+                    real_type const dw2 = du0 * dv1 - du1 * dv0;
+                    real_type const vob = std::sqrt(dw0 * dw0 + dw1 * dw1 + dw2 * dw2);
+                    m_fccnd(ifc, 0) += crd[0] * vob;
+                    m_fccnd(ifc, 1) += crd[1] * vob;
+                    m_fccnd(ifc, 2) += crd[2] * vob;
+                    voc += vob;
+                }
+                m_fccnd(ifc, 0) /= voc;
+                m_fccnd(ifc, 1) /= voc;
+                m_fccnd(ifc, 2) /= voc;
+            });
     }
 
     // compute ghost face normal vector and area.
     if (m_ndim == 2)
     {
-        for (int_type ifc = -1; ifc >= -static_cast<int_type>(ngstface()); --ifc)
-        {
-            // 2D faces are always lines.
-            int_type const ind = m_fcnds(ifc, 1);
-            int_type const jnd = m_fcnds(ifc, 2);
-            // face normal.
-            m_fcnml(ifc, 0) = m_ndcrd(jnd, 1) - m_ndcrd(ind, 1);
-            m_fcnml(ifc, 1) = m_ndcrd(ind, 0) - m_ndcrd(jnd, 0);
-            // face ara.
-            m_fcara(ifc) = std::sqrt(m_fcnml(ifc, 0) * m_fcnml(ifc, 0) + m_fcnml(ifc, 1) * m_fcnml(ifc, 1));
-            // normalize face normal.
-            m_fcnml(ifc, 0) /= m_fcara(ifc);
-            m_fcnml(ifc, 1) /= m_fcara(ifc);
-        }
+        detail::parallel_for_ghosts<int_type>(
+            ngstface(),
+            [&](int_type ifc)
+            {
+                // 2D faces are always lines.
+                int_type const ind = m_fcnds(ifc, 1);
+                int_type const jnd = m_fcnds(ifc, 2);
+                // face normal.
+                m_fcnml(ifc, 0) = m_ndcrd(jnd, 1) - m_ndcrd(ind, 1);
+                m_fcnml(ifc, 1) = m_ndcrd(ind, 0) - m_ndcrd(jnd, 0);
+                // face ara.
+                m_fcara(ifc) = std::sqrt(m_fcnml(ifc, 0) * m_fcnml(ifc, 0) + m_fcnml(ifc, 1) * m_fcnml(ifc, 1));
+                // normalize face normal.
+                m_fcnml(ifc, 0) /= m_fcara(ifc);
+                m_fcnml(ifc, 1) /= m_fcara(ifc);
+            });
     }
     else if (m_ndim == 3)
     {
-        std::array<std::array<real_type, 3>, FCMND> radvec; // NOLINT(cppcoreguidelines-pro-type-member-init)
-        for (int_type ifc = -1; ifc >= -static_cast<int_type>(ngstface()); --ifc)
-        {
-            // compute radial vector.
-            size_t const nnd = m_fcnds(ifc);
-            for (size_t inf = 0; inf < nnd; ++inf)
-            {
-                int_type const ind = m_fcnds(ifc, inf + 1);
-                radvec[inf][0] = m_ndcrd(ind, 0) - m_fccnd(ifc, 0);
-                radvec[inf][1] = m_ndcrd(ind, 1) - m_fccnd(ifc, 1);
-                radvec[inf][2] = m_ndcrd(ind, 2) - m_fccnd(ifc, 2);
-            }
-            // compute cross product.
-            m_fcnml(ifc, 0) = radvec[nnd - 1][1] * radvec[0][2] - radvec[nnd - 1][2] * radvec[0][1];
-            m_fcnml(ifc, 1) = radvec[nnd - 1][2] * radvec[0][0] - radvec[nnd - 1][0] * radvec[0][2];
-            m_fcnml(ifc, 2) = radvec[nnd - 1][0] * radvec[0][1] - radvec[nnd - 1][1] * radvec[0][0];
-            for (size_t ind = 1; ind < nnd; ++ind)
+        detail::parallel_for_ghosts<int_type>(
+            ngstface(),
+            [&](int_type ifc)
             {
-                m_fcnml(ifc, 0) += radvec[ind - 1][1] * radvec[ind][2] - radvec[ind - 1][2] * radvec[ind][1];
-                m_fcnml(ifc, 1) += radvec[ind - 1][2] * radvec[ind][0] - radvec[ind - 1][0] * radvec[ind][2];
-                m_fcnml(ifc, 2) += radvec[ind - 1][0] * radvec[ind][1] - radvec[ind - 1][1] * radvec[ind][0];
-            }
-            // compute face area.
-            m_fcara(ifc, 0) = std::sqrt(
-                m_fcnml(ifc, 0) * m_fcnml(ifc, 0) + m_fcnml(ifc, 1) * m_fcnml(ifc, 1) + m_fcnml(ifc, 2) * m_fcnml(ifc, 2));
-            // normalize normal vector.
-            m_fcnml(ifc, 0) /= m_fcnml(ifc);
-            m_fcnml(ifc, 1) /= m_fcnml(ifc);
-            m_fcnml(ifc, 2) /= m_fcnml(ifc);
-            // get real face area.
-            m_fcnml(ifc) /= 2.0;
-        }
+                std::array<std::array<real_type, 3>, FCMND> radvec; // NOLINT(cppcoreguidelines-pro-type-member-init)
+                // compute radial vector.
+                size_t const nnd = m_fcnds(ifc);
+                for (size_t inf = 0; inf < nnd; ++inf)
+                {
+                    int_type const ind = m_fcnds(ifc, inf + 1);
+                    radvec[inf][0] = m_ndcrd(ind, 0) - m_fccnd(ifc, 0);
+                    radvec[inf][1] = m_ndcrd(ind, 1) - m_fccnd(ifc, 1);
+                    radvec[inf][2] = m_ndcrd(ind, 2) - m_fccnd(ifc, 2);
+                }
+                // compute cross product.
+                m_fcnml(ifc, 0) = radvec[nnd - 1][1] * radvec[0][2] - radvec[nnd - 1][2] * radvec[0][1];
+                m_fcnml(ifc, 1) = radvec[nnd - 1][2] * radvec[0][0] - radvec[nnd - 1][0] * radvec[0][2];
+                m_fcnml(ifc, 2) = radvec[nnd - 1][0] * radvec[0][1] - radvec[nnd - 1][1] * radvec[0][0];
+                for (size_t ind = 1; ind < nnd; ++ind)
+                {
+                    m_fcnml(ifc, 0) += radvec[ind - 1][1] * radvec[ind][2] - radvec[ind - 1][2] * radvec[ind][1];
+                    m_fcnml(ifc, 1) += radvec[ind - 1][2] * radvec[ind][0] - radvec[ind - 1][0] * radvec[ind][2];
+                    m_fcnml(ifc, 2) += radvec[ind - 1][0] * radvec[ind][1] - radvec[ind - 1][1] * radvec[ind][0];
+                }
+                // compute face area.
+                m_fcara(ifc, 0) = std::sqrt(
+                    m_fcnml(ifc, 0) * m_fcnml(ifc, 0) + m_fcnml(ifc, 1) * m_fcnml(ifc, 1) + m_fcnml(ifc, 2) * m_fcnml(ifc, 2));
+                // normalize normal vector.
+                m_fcnml(ifc, 0) /= m_fcara(ifc);
+                m_fcnml(ifc, 1) /= m_fcara(ifc);
+                m_fcnml(ifc, 2) /= m_fcara(ifc);
+                // get real face area.
+                m_fcara(ifc) /= 2;
+            });
     }
 
     // compute cell centroids.
     if (m_ndim == 2)
     {
-        for (int_type icl = -1; icl >= -static_cast<int_type>(ngstcell()); --icl)
-        {
-            // averaged point.
-            std::array<real_type, 2> crd{0.0, 0.0};
-            crd[0] = crd[1] = 0.0;
-            size_t const nnd = m_clnds(icl, 0);
-            for (size_t inl = 1; inl <= nnd; ++inl)
+        detail::parallel_for_ghosts<int_type>(
+            ngcl,
+            [&](int_type icl)
             {
-                int_type const ind = m_clnds(icl, inl);
-                crd[0] += m_ndcrd(ind, 0);
-                crd[1] += m_ndcrd(ind, 1);
-            }
-            crd[0] /= nnd;
-            crd[1] /= nnd;
-            // weight centroid.
-            m_clcnd(icl, 0) = m_clcnd(icl, 1) = 0.0;
-            real_type voc = 0.0;
-            size_t const nfc = m_clfcs(icl, 0);
-            for (size_t ifl = 1; ifl <= nfc; ++ifl)
-            {
-                int_type const ifc = m_clfcs(icl, ifl);
-                real_type const du0 = crd[0] - m_fccnd(ifc, 0);
-                real_type const du1 = crd[1] - m_fccnd(ifc, 1);
-                real_type const vob = std::abs(du0 * m_fcnml(ifc, 0) + du1 * m_fcnml(ifc, 1)) * m_fcara(ifc);
-                voc += vob;
-                real_type const dv0 = m_fccnd(ifc, 0) + du0 / 3;
-                real_type const dv1 = m_fccnd(ifc, 1) + du1 / 3;
-                m_clcnd(icl, 0) += dv0 * vob;
-                m_clcnd(icl, 1) += dv1 * vob;
-            }
-            m_clcnd(icl, 0) /= voc;
-            m_clcnd(icl, 1) /= voc;
-        }
+                // averaged point.
+                std::array<real_type, 2> crd{0.0, 0.0};
+                crd[0] = crd[1] = 0.0;
+                size_t const nnd = m_clnds(icl, 0);
+                for (size_t inl = 1; inl <= nnd; ++inl)
+                {
+                    int_type const ind = m_clnds(icl, inl);
+                    crd[0] += m_ndcrd(ind, 0);
+                    crd[1] += m_ndcrd(ind, 1);
+                }
+                crd[0] /= nnd;
+                crd[1] /= nnd;
+                // weight centroid.
+                m_clcnd(icl, 0) = m_clcnd(icl, 1) = 0.0;
+                real_type voc = 0.0;
+                size_t const nfc = m_clfcs(icl, 0);
+                for (size_t ifl = 1; ifl <= nfc; ++ifl)
+                {
+                    int_type const ifc = m_clfcs(icl, ifl);
+                    real_type const du0 = crd[0] - m_fccnd(ifc, 0);
+                    real_type const du1 = crd[1] - m_fccnd(ifc, 1);
+                    real_type const vob = std::abs(du0 * m_fcnml(ifc, 0) + du1 * m_fcnml(ifc, 1)) * m_fcara(ifc);
+                    voc += vob;
+                    real_type const dv0 = m_fccnd(ifc, 0) + du0 / 3;
+                    real_type const dv1 = m_fccnd(ifc, 1) + du1 / 3;
+                    m_clcnd(icl, 0) += dv0 * vob;
+                    m_clcnd(icl, 1) += dv1 * vob;
+                }
+                m_clcnd(icl, 0) /= voc;
+                m_clcnd(icl, 1) /= voc;
+            });
     }
     else if (m_ndim == 3)
     {
-        for (int_type icl = -1; icl >= -static_cast<int_type>(ngstcell()); --icl)
-        {
-            // averaged point.
-            std::array<real_type, 3> crd{0.0, 0.0, 0.0};
-            size_t const nnd = m_clnds(icl, 0);
-            for (size_t inl = 1; inl <= nnd; ++inl)
-            {
-                int_type const ind = m_clnds(icl, inl);
-                crd[0] += m_ndcrd(ind, 0);
-                crd[1] += m_ndcrd(ind, 1);
-                crd[2] += m_ndcrd(ind, 2);
-            }
-            crd[0] /= nnd;
-            crd[1] /= nnd;
-            crd[2] /= nnd;
-            // weight centroid.
-            m_clcnd(icl, 0) = m_clcnd(icl, 1) = m_clcnd(icl, 2) = 0.0;
-            real_type voc = 0.0;
-            size_t const nfc = m_clfcs(icl, 0);
-            for (size_t ifl = 1; ifl <= nfc; ++ifl)
+        detail::parallel_for_ghosts<int_type>(
+            ngcl,
+            [&](int_type icl)
             {
-                int_type const ifc = m_clfcs(icl, ifl);
-                real_type const du0 = crd[0] - m_fccnd(ifc, 0);
-                real_type const du1 = crd[1] - m_fccnd(ifc, 1);
-                real_type const du2 = crd[2] - m_fccnd(ifc, 2);
-                // clang-format off
-                real_type const vob = std::fabs
-                (
-                    (du0*m_fcnml(ifc, 0) + du1*m_fcnml(ifc, 1) + du2*m_fcnml(ifc, 2))
-                  * m_fcara(ifc)
-                );
-                // clang-format on
-                voc += vob;
-                real_type const dv0 = m_fccnd(ifc, 0) + du0 / 4;
-                real_type const dv1 = m_fccnd(ifc, 1) + du1 / 4;
-                real_type const dv2 = m_fccnd(ifc, 2) + du2 / 4;
-                m_clcnd(icl, 0) += dv0 * vob;
-                m_clcnd(icl, 1) += dv1 * vob;
-                m_clcnd(icl, 2) += dv2 * vob;
-            }
-            m_clcnd(icl, 0) /= voc;
-            m_clcnd(icl, 1) /= voc;
-            m_clcnd(icl, 2) /= voc;
-        }
+                // averaged point.
+                std::array<real_type, 3> crd{0.0, 0.0, 0.0};
+                size_t const nnd = m_clnds(icl, 0);
+                for (size_t inl = 1; inl <= nnd; ++inl)
+                {
+                    int_type const ind = m_clnds(icl, inl);
+                    crd[0] += m_ndcrd(ind, 0);
+                    crd[1] += m_ndcrd(ind, 1);
+                    crd[2] += m_ndcrd(ind, 2);
+                }
+                crd[0] /= nnd;
+                crd[1] /= nnd;
+                crd[2] /= nnd;
+                // weight centroid.
+                m_clcnd(icl, 0) = m_clcnd(icl, 1) = m_clcnd(icl, 2) = 0.0;
+                real_type voc = 0.0;
+                size_t const nfc = m_clfcs(icl, 0);
+                for (size_t ifl = 1; ifl <= nfc; ++ifl)
+                {
+                    int_type const ifc = m_clfcs(icl, ifl);
+                    real_type const du0 = crd[0] - m_fccnd(ifc, 0);
+                    real_type const du1 = crd[1] - m_fccnd(ifc, 1);
+                    real_type const du2 = crd[2] - m_fccnd(ifc, 2);
+                    // clang-format off
+                    real_type const vob = std::fabs
+                    (
+                        (du0*m_fcnml(ifc, 0) + du1*m_fcnml(ifc, 1) + du2*m_fcnml(ifc, 2))
+                      * m_fcara(ifc)
+                    );
+                    // clang-format on
+                    voc += vob;
+                    real_type const dv0 = m_fccnd(ifc, 0) + du0 / 4;
+                    real_type const dv1 = m_fccnd(ifc, 1) + du1 / 4;
+                    real_type const dv2 = m_fccnd(ifc, 2) + du2 / 4;
+                    m_clcnd(icl, 0) += dv0 * vob;
+                    m_clcnd(icl, 1) += dv1 * vob;
+                    m_clcnd(icl, 2) += dv2 * vob;
+                }
+                m_clcnd(icl, 0) /= voc;
+                m_clcnd(icl, 1) /= voc;
+                m_clcnd(icl, 2) /= voc;
+            });
     }
 
     // compute volume for each ghost cell.
-    for (int_type icl = -1; icl >= -static_cast<int_type>(ngstcell()); --icl)
-    {
-        m_clvol(icl) = 0.0;
-        for (size_t it = 1; it <= static_cast<size_t>(m_clfcs(icl, 0)); ++it)
+    detail::parallel_for_ghosts<int_type>(
+        ngcl,
+        [&](int_type icl)
         {
-            int_type const ifc = m_clfcs(icl, it);
-            // calculate volume associated with each face.
-            real_type vol = 0.0;
-            for (size_t idm = 0; idm < m_ndim; ++idm)
-            {
-                vol += (m_fccnd(ifc, idm) - m_clcnd(icl, idm)) * m_fcnml(ifc, idm);
-            }
-            vol *= m_fcara(ifc);
-            // check if need to reorder node definition and connecting cell
-            // list for the face.
-            if (vol < 0.0)
+            m_clvol(icl) = 0.0;
+            for (size_t it = 1; it <= static_cast<size_t>(m_clfcs(icl, 0)); ++it)
             {
-                if (m_fccls(ifc, 0) == icl)
+                int_type const ifc = m_clfcs(icl, it);
+                // calculate volume associated with each face.
+                real_type vol = 0.0;
+                for (size_t idm = 0; idm < m_ndim; ++idm)
                 {
-                    for (size_t idm = 0; idm < m_ndim; ++idm)
+                    vol += (m_fccnd(ifc, idm) - m_clcnd(icl, idm)) * m_fcnml(ifc, idm);
+                }
+                vol *= m_fcara(ifc);
+                // check if need to reorder node definition and connecting cell
+                // list for the face.
+                if (vol < 0.0)
+                {
+                    if (m_fccls(ifc, 0) == icl)
                     {
-                        m_fcnml(ifc, idm) = -m_fcnml(ifc, idm);
+                        for (size_t idm = 0; idm < m_ndim; ++idm)
+                        {
+                            m_fcnml(ifc, idm) = -m_fcnml(ifc, idm);
+                        }
                     }
+                    vol = -vol;
                 }
-                vol = -vol;
+                // accumulate the volume for the cell.
+                m_clvol(icl) += vol;
             }
-            // accumulate the volume for the cell.
-            m_clvol(icl) += vol;
-        }
-        // calculate the real volume.
-        m_clvol(icl) /= m_ndim;
-    }
+            // calculate the real volume.
+            m_clvol(icl) /= m_ndim;
+        });
 }
 
+template void BasicStaticMesh<float>::build_boundary();
+template void BasicStaticMesh<float>::build_ghost();
+template std::tuple<size_t, size_t, size_t> BasicStaticMesh<float>::count_ghost() const;
+template void BasicStaticMesh<double>::build_boundary();
+template void BasicStaticMesh<double>::build_ghost();
+template std::tuple<size_t, size_t, size_t> BasicStaticMesh<double>::count_ghost() const;
+
 } /* end namespace modmesh */
 
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
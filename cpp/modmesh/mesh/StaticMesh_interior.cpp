@@ -28,7 +28,7 @@
 
 #include <modmesh/mesh/StaticMesh.hpp>
 
-#include <set>
+#include <algorithm>
 
 namespace modmesh
 {
@@ -408,95 +408,81 @@ struct FaceBuilder
         }
     }
 
-    SimpleArray<int_type> make_ndfcs()
+    /**
+     * Map each face to the first face of the same type and node set.  Each
+     * face gets a canonical key of its sorted nodes, the node count and the
+     * type.  The faces are counting-sorted by their lowest node, and the
+     * small bucket of faces sharing it is sorted by the key, so duplicates
+     * are adjacent and the buckets are processed in parallel.  Faces without
+     * nodes are never duplicates.
+     */
+    void make_dedupmap()
     {
-        // first pass: get the maximum number of faces.
-        std::vector<size_t> ndnfc(nnode, 0);
-        for (size_t ifc = 0; ifc < mface; ++ifc)
-        {
-            int_type const fcnnd = fcnds(ifc, 0);
-            for (int_type const * p = fcnds.vptr(ifc, 1); p != fcnds.vptr(ifc, fcnnd + 1); ++p)
-            {
-                ndnfc[*p] += 1;
-            }
-        }
+        using key_type = std::array<int_type, FCMND + 2>;
+        bool const parallel = ThreadPool::instance().use_parallel(mface);
 
-        // second pass: scan again to build hash table.
-        size_t const ndmfc = *std::max_element(ndnfc.begin(), ndnfc.end());
-        SimpleArray<int_type> ndfcs(small_vector<size_t>{nnode, static_cast<size_t>(ndmfc) + 1});
-        for (size_t ind = 0; ind < nnode; ++ind)
-        {
-            ndfcs(ind, 0) = 0;
-            for (size_t it = 1; it <= ndmfc; ++it)
+        std::vector<key_type> keys(mface);
+        parallel_for_chunks(
+            mface,
+            parallel,
+            [&](size_t begin, size_t end)
             {
-                ndfcs(ind, it) = -1;
-            }
-        }
-        for (size_t ifc = 0; ifc < mface; ++ifc)
+                for (size_t ifc = begin ; ifc < end ; ++ifc)
+                {
+                    key_type & key = keys[ifc];
+                    key.fill(-1);
+                    int_type const nnd = fcnds(ifc, 0);
+                    std::copy(fcnds.vptr(ifc, 1), fcnds.vptr(ifc, nnd + 1), key.begin());
+                    std::sort(key.begin(), key.begin() + nnd);
+                    key[FCMND] = nnd;
+                    key[FCMND + 1] = fctpn(ifc);
+                }
+            });
+
+        // Counting sort of the faces by the lowest node.
+        std::vector<size_t> bucket(nnode + 1, 0);
+        for (size_t ifc = 0 ; ifc < mface ; ++ifc)
         {
-            int_type const fcnnd = fcnds(ifc, 0);
-            for (int_type const * p = fcnds.vptr(ifc, 1); p != fcnds.vptr(ifc, fcnnd + 1); ++p)
+            if (keys[ifc][FCMND] > 0)
             {
-                ndfcs(*p, 0) += 1;
-                ndfcs(*p, ndfcs(*p, 0)) = static_cast<int_type>(ifc);
+                ++bucket[keys[ifc][0] + 1];
             }
         }
-
-        return ndfcs;
-    }
-
-    /**
-     * @brief Build the (hash) table to know what faces connect to each node.
-     */
-    void make_dedupmap()
-    {
-        auto const & ndfcs = make_ndfcs();
-
-        auto check_match = [this](int_type const ifc, int_type const jfc)
+        std::partial_sum(bucket.begin(), bucket.end(), bucket.begin());
+        std::vector<uint_type> sorted(bucket[nnode]);
         {
-            int_type cond = 0;
-            // scan all nodes in ifc and jfc to see if all the same.
-            for (int_type jnf = 1; jnf <= fcnds(jfc, 0); ++jnf)
+            std::vector<size_t> cursor(bucket.begin(), bucket.end() - 1);
+            for (size_t ifc = 0 ; ifc < mface ; ++ifc)
             {
-                // clang-format off
-                auto result = std::find
-                (
-                    fcnds.vptr(ifc, 1)
-                  , fcnds.vptr(ifc, fcnds(ifc, 0)+1)
-                  , fcnds(jfc, jnf)
-                );
-                // clang-format off
-                if (result != fcnds.vptr(ifc, fcnds(ifc, 0)+1))
+                if (keys[ifc][FCMND] > 0)
                 {
-                    ++cond;
+                    sorted[cursor[keys[ifc][0]]++] = static_cast<uint_type>(ifc);
                 }
             }
-            return cond;
-        };
+        }
 
-        // scan for duplicated faces and build duplication map.
+        // Map the duplicates to the first face of each run of equal keys.
         std::iota(dedupmap.begin(), dedupmap.end(), 0);
-        for (size_t ifc = 0 ; ifc < mface ; ++ifc)
-        {
-            if (dedupmap[ifc] == ifc)
+        parallel_for_chunks(
+            nnode,
+            parallel,
+            [&](size_t begin, size_t end)
             {
-                int_type const ind = fcnds(ifc, 1); // take only the FIRST node of a face.
-                for (int_type it = 1 ; it <= ndfcs(ind, 0) ; ++it)
+                for (size_t ind = begin ; ind < end ; ++ind)
                 {
-                    size_t const jfc = ndfcs(ind, it);
-                    // test for duplication.
-                    if
-                    (
-                        (jfc != ifc)
-                     && (fctpn(jfc) == fctpn(ifc))
-                     && (check_match(static_cast<int_type>(ifc), static_cast<int_type>(jfc)) == fcnds(static_cast<int_type>(jfc), 0))
-                    )
+                    auto const first = sorted.begin() + static_cast<std::ptrdiff_t>(bucket[ind]);
+                    auto const last = sorted.begin() + static_cast<std::ptrdiff_t>(bucket[ind + 1]);
+                    std::sort(first, last, [&keys](uint_type lhs, uint_type rhs)
+                              { return keys[lhs] != keys[rhs] ? keys[lhs] < keys[rhs] : lhs < rhs; });
+                    for (auto it = first ; it != last ; ++it)
                     {
-                        dedupmap[jfc] = static_cast<uint_type>(ifc);  // record duplication.
+                        if (it != first && keys[*it] == keys[*(it - 1)])
+                        {
+                            dedupmap[*it] = dedupmap[*(it - 1)];
+                        }
                     }
                 }
-            }
-        }
+            });
     }
 
     void remap_face()
@@ -569,10 +555,13 @@ struct FaceBuilder
 
 /**
  * Extract interier faces from node list of cells.  Subroutine is designed to
- * handle all types of cells.
+ * handle all types of cells.  The face metric arrays are zeroed only when
+ * zero_metric is true.
  */
-void StaticMesh::build_faces_from_cells()
+template <typename T>
+void BasicStaticMesh<T>::build_faces_from_cells(bool zero_metric)
 {
+    clear_adjacency();
     detail::FaceBuilder<number_base> fb(m_nnode, m_cltpn, m_clnds);
     m_nface = static_cast<uint_type>(fb.nface);
 
@@ -580,55 +569,138 @@ void StaticMesh::build_faces_from_cells()
     fb.rebuild_fctpn(m_fctpn);
     fb.rebuild_fcnds(m_fcnds);
     fb.rebuild_fccls(m_fccls);
-    m_fccnd.remake(small_vector<size_t>{nface(), m_ndim}, 0);
-    m_fcnml.remake(small_vector<size_t>{nface(), m_ndim}, 0);
-    m_fcara.remake(small_vector<size_t>{nface()}, 0);
+    // Skip zeroing the metric arrays when calc_metric() overwrites them.
+    m_fccnd.remake(small_vector<size_t>{nface(), m_ndim}, SimpleArrayUninitialized{});
+    m_fcnml.remake(small_vector<size_t>{nface(), m_ndim}, SimpleArrayUninitialized{});
+    m_fcara.remake(small_vector<size_t>{nface()}, SimpleArrayUninitialized{});
+    if (zero_metric)
+    {
+        m_fccnd.fill(0);
+        m_fcnml.fill(0);
+        m_fcara.fill(0);
+    }
     std::copy(fb.clfcs.vptr(0, 0), fb.clfcs.vptr(m_ncell, 0), m_clfcs.vptr(0, 0));
 }
 
-void StaticMesh::build_edge()
+/**
+ * Extract the unique edges of the faces.  The face-edges are counting-sorted
+ * by their lower node, so duplicates of an edge land in the same small bucket
+ * of face-edges sharing that node.  The first occurrence of each edge is
+ * kept, so the edges come out in the order they are first met in fcnds.
+ */
+template <typename T>
+/* NOLINTNEXTLINE(readability-function-cognitive-complexity) */
+void BasicStaticMesh<T>::build_edge()
 {
-    using etype = std::pair<int32_t, int32_t>;
-    std::set<etype> known_edges;
-    std::vector<etype> edges;
+    auto const fcnds = m_fcnds.template fixed_view<2>();
+    size_t const nface = this->nface();
 
-    size_t nedge_max = 0;
-    for (uint32_t ifc = 0; ifc < nface(); ++ifc)
+    // Offset of the first face-edge of each face.
+    std::vector<size_t> offsets(nface + 1);
+    offsets[0] = 0;
+    for (size_t ifc = 0; ifc < nface; ++ifc)
     {
-        nedge_max += fcnds(ifc, 0);
+        offsets[ifc + 1] = offsets[ifc] + static_cast<size_t>(fcnds(ifc, 0));
     }
-    edges.reserve(nedge_max);
-    // Can we optimize the memory allocation for the known_edges (std::set) too?
+    size_t const nfcedge = offsets[nface];
+    bool const parallel = ThreadPool::instance().use_parallel(nfcedge);
 
-    for (uint32_t ifc = 0; ifc < nface(); ++ifc)
-    {
-        for (int32_t inf = 1; inf <= fcnds(ifc, 0); ++inf)
+    // Node pairs of the face-edges, with the lower index first.
+    std::vector<int_type> lower(nfcedge);
+    std::vector<int_type> higher(nfcedge);
+    parallel_for_chunks(
+        nface,
+        parallel,
+        [&](size_t begin, size_t end)
         {
-            // Determine the edge of this node index.
-            unsigned int const idx1 = (fcnds(ifc, 0) == inf) ? 1 : inf+1;
-            int32_t nd0 = fcnds(ifc, inf);
-            int32_t nd1 = fcnds(ifc, idx1);
-            if (nd0 > nd1) // Lower node index goes first.
-            {
-                std::swap(nd0, nd1);
-            }
-            // Add the edge to the container array.
-            etype const edge(nd0, nd1);
-            if (0 == known_edges.count(edge))
+            for (size_t ifc = begin; ifc < end; ++ifc)
             {
-                edges.push_back(edge);
-                known_edges.insert(edge);
+                int_type const fcnnd = fcnds(ifc, 0);
+                size_t const base = offsets[ifc] - 1;
+                for (int_type inf = 1; inf <= fcnnd; ++inf)
+                {
+                    int_type const nd0 = fcnds(ifc, inf);
+                    int_type const nd1 = fcnds(ifc, fcnnd == inf ? 1 : inf + 1);
+                    lower[base + inf] = std::min(nd0, nd1);
+                    higher[base + inf] = std::max(nd0, nd1);
+                }
             }
+        });
+
+    // Counting sort of the face-edge positions by the lower node.  The
+    // positions stay ascending in each bucket.
+    int_type const ndmin = nfcedge ? *std::min_element(lower.begin(), lower.end()) : 0;
+    int_type const ndmax = nfcedge ? *std::max_element(lower.begin(), lower.end()) : -1;
+    size_t const nbucket = static_cast<size_t>(ndmax - ndmin + 1);
+    std::vector<size_t> bucket_offsets(nbucket + 1, 0);
+    for (size_t it = 0; it < nfcedge; ++it)
+    {
+        ++bucket_offsets[static_cast<size_t>(lower[it] - ndmin) + 1];
+    }
+    std::partial_sum(bucket_offsets.begin(), bucket_offsets.end(), bucket_offsets.begin());
+    std::vector<size_t> positions(nfcedge);
+    {
+        std::vector<size_t> cursor(bucket_offsets.begin(), bucket_offsets.end() - 1);
+        for (size_t it = 0; it < nfcedge; ++it)
+        {
+            positions[cursor[static_cast<size_t>(lower[it] - ndmin)]++] = it;
         }
     }
 
+    // Mark the first occurrence of each edge.
+    std::vector<uint8_t> first(nfcedge, 0);
+    parallel_for_chunks(
+        nbucket,
+        parallel,
+        [&](size_t begin, size_t end)
+        {
+            std::vector<std::pair<int_type, size_t>> wide;
+            for (size_t ibk = begin; ibk < end; ++ibk)
+            {
+                size_t const * const bkbeg = positions.data() + bucket_offsets[ibk];
+                size_t const * const bkend = positions.data() + bucket_offsets[ibk + 1];
+                // Node degrees are small in practice; scan the earlier entries.
+                if (bkend - bkbeg <= 32)
+                {
+                    for (size_t const * it = bkbeg; it != bkend; ++it)
+                    {
+                        size_t const * jt = bkbeg;
+                        while (jt != it && higher[*jt] != higher[*it])
+                        {
+                            ++jt;
+                        }
+                        first[*it] = jt == it;
+                    }
+                }
+                // Sort the buckets of high-degree nodes to stay away from quadratic time.
+                else
+                {
+                    wide.clear();
+                    for (size_t const * it = bkbeg; it != bkend; ++it)
+                    {
+                        wide.emplace_back(higher[*it], *it);
+                    }
+                    std::sort(wide.begin(), wide.end());
+                    for (size_t it = 0; it < wide.size(); ++it)
+                    {
+                        first[wide[it].second] = 0 == it || wide[it].first != wide[it - 1].first;
+                    }
+                }
+            }
+        });
+    size_t const nedge = static_cast<size_t>(std::count(first.begin(), first.end(), uint8_t(1)));
+
     // Build the edge node array and populate.
-    m_ednds.remake(small_vector<size_t>{edges.size(), 2}, 0);
-    for (size_t ied = 0; ied < edges.size(); ++ied)
+    m_ednds.remake(small_vector<size_t>{nedge, 2}, 0);
+    int_type * ednds = m_ednds.body();
+    for (size_t it = 0; it < nfcedge; ++it)
     {
-        etype const edge = edges[ied];
-        m_ednds(ied, 0) = edge.first;
-        m_ednds(ied, 1) = edge.second;
+        if (first[it])
+        {
+            ednds[0] = lower[it];
+            ednds[1] = higher[it];
+            ednds += 2;
+        }
     }
 }
 
@@ -640,356 +712,564 @@ void StaticMesh::build_edge()
  *  3. center of cells.
  *  4. volume of cells.
  *
- * And fcnds could be reordered.
+ * And fcnds could be reordered.  The metric is calculated for all the faces
+ * and cells, or only for those in the sorted lists when given.
  */
+template <typename T>
 /* NOLINTNEXTLINE(readability-function-cognitive-complexity) */
-void StaticMesh::calc_metric()
+void BasicStaticMesh<T>::calc_metric(std::vector<int_type> const * faces, std::vector<int_type> const * cells)
 {
+    // Fixed-rank views unroll the index arithmetic in the loops below.
+    auto const ndcrd = m_ndcrd.template fixed_view<2>();
+    auto const fccnd = m_fccnd.template fixed_view<2>();
+    auto const fcnml = m_fcnml.template fixed_view<2>();
+    auto const fcara = m_fcara.template fixed_view<1>();
+    auto const fcnds = m_fcnds.template fixed_view<2>();
+    auto const fccls = m_fccls.template fixed_view<2>();
+    auto const clnds = m_clnds.template fixed_view<2>();
+    auto const clfcs = m_clfcs.template fixed_view<2>();
+    auto const cltpn = m_cltpn.template fixed_view<1>();
+    auto const clcnd = m_clcnd.template fixed_view<2>();
+    auto const clvol = m_clvol.template fixed_view<1>();
+
+    // The passes run over all the faces and cells, or over the sorted lists
+    // of them when given.
+    size_t const nface_todo = nullptr == faces ? nface() : faces->size();
+    size_t const ncell_todo = nullptr == cells ? ncell() : cells->size();
+    auto face_at = [faces](size_t it)
+    { return nullptr == faces ? it : static_cast<size_t>((*faces)[it]); };
+    auto cell_at = [cells](size_t it)
+    { return nullptr == cells ? it : static_cast<size_t>((*cells)[it]); };
+
+    // Each pass writes only to its own face or cell, so the chunks are
+    // independent and the results do not depend on the thread count.
+    bool const parallel_faces = ThreadPool::instance().use_parallel(nface_todo);
+    bool const parallel_cells = ThreadPool::instance().use_parallel(ncell_todo);
+
     // compute face centroids.
     if (m_ndim == 2)
     {
         // 2D faces must be edge.
-        for (size_t ifc = 0 ; ifc < m_nface ; ++ifc)
-        {
-            // point 1.
+        parallel_for_chunks(
+            nface_todo,
+            parallel_faces,
+            [&](size_t begin, size_t end)
             {
-                int_type const ind = m_fcnds(ifc, 1);
-                m_fccnd(ifc, 0) = m_ndcrd(ind, 0);
-                m_fccnd(ifc, 1) = m_ndcrd(ind, 1);
-            }
-            // point 2.
-            {
-                int_type const ind = m_fcnds(ifc, 2);
-                m_fccnd(ifc, 0) += m_ndcrd(ind, 0);
-                m_fccnd(ifc, 1) += m_ndcrd(ind, 1);
-            }
-            // average.
-            m_fccnd(ifc, 0) /= 2;
-            m_fccnd(ifc, 1) /= 2;
-        }
+                for (size_t jfc = begin ; jfc < end ; ++jfc)
+                {
+                    size_t const ifc = face_at(jfc);
+                    // point 1.
+                    {
+                        int_type const ind = fcnds(ifc, 1);
+                        fccnd(ifc, 0) = ndcrd(ind, 0);
+                        fccnd(ifc, 1) = ndcrd(ind, 1);
+                    }
+                    // point 2.
+                    {
+                        int_type const ind = fcnds(ifc, 2);
+                        fccnd(ifc, 0) += ndcrd(ind, 0);
+                        fccnd(ifc, 1) += ndcrd(ind, 1);
+                    }
+                    // average.
+                    fccnd(ifc, 0) /= 2;
+                    fccnd(ifc, 1) /= 2;
+                }
+            });
     }
     else if (m_ndim == 3)
     {
-        for (size_t ifc = 0 ; ifc < nface() ; ++ifc)
-        {
-            std::array<real_type, 3> crd; // NOLINT(cppcoreguidelines-pro-type-member-init)
-            std::array<std::array<real_type, 3>, FCMND+2> cfd; // NOLINT(cppcoreguidelines-pro-type-member-init)
-            // find averaged point.
-            cfd[0][0] = cfd[0][1] = cfd[0][2] = 0.0;
-            size_t const nnd = m_fcnds(ifc, 0);
-            for (size_t inf = 1 ; inf <= nnd ; ++inf)
+        parallel_for_chunks(
+            nface_todo,
+            parallel_faces,
+            [&](size_t begin, size_t end)
             {
-                int_type const ind = m_fcnds(ifc, inf);
-                cfd[inf][0]  = m_ndcrd(ind, 0);
-                cfd[0  ][0] += m_ndcrd(ind, 0);
-                cfd[inf][1]  = m_ndcrd(ind, 1);
-                cfd[0  ][1] += m_ndcrd(ind, 1);
-                cfd[inf][2]  = m_ndcrd(ind, 2);
-                cfd[0  ][2] += m_ndcrd(ind, 2);
-            }
-            cfd[nnd+1][0] = cfd[1][0];
-            cfd[nnd+1][1] = cfd[1][1];
-            cfd[nnd+1][2] = cfd[1][2];
-            cfd[0][0] /= nnd;
-            cfd[0][1] /= nnd;
-            cfd[0][2] /= nnd;
-            // calculate area.
-            real_type voc = 0.0;
-            m_fccnd(ifc, 0) = m_fccnd(ifc, 1) = m_fccnd(ifc, 2) = 0.0;
-            for (size_t inf = 1 ; inf <= nnd ; ++inf)
-            {
-                crd[0] = (cfd[0][0] + cfd[inf][0] + cfd[inf+1][0])/3;
-                crd[1] = (cfd[0][1] + cfd[inf][1] + cfd[inf+1][1])/3;
-                crd[2] = (cfd[0][2] + cfd[inf][2] + cfd[inf+1][2])/3;
-                real_type const du0 = cfd[inf][0] - cfd[0][0];
-                real_type const du1 = cfd[inf][1] - cfd[0][1];
-                real_type const du2 = cfd[inf][2] - cfd[0][2];
-                real_type const dv0 = cfd[inf+1][0] - cfd[0][0];
-                real_type const dv1 = cfd[inf+1][1] - cfd[0][1];
-                real_type const dv2 = cfd[inf+1][2] - cfd[0][2];
-                real_type const dw0 = du1*dv2 - du2*dv1;
-                real_type const dw1 = du2*dv0 - du0*dv2;
-                real_type const dw2 = du0*dv1 - du1*dv0;
-                real_type const vob = std::sqrt(dw0*dw0 + dw1*dw1 + dw2*dw2);
-                m_fccnd(ifc, 0) += crd[0] * vob;
-                m_fccnd(ifc, 1) += crd[1] * vob;
-                m_fccnd(ifc, 2) += crd[2] * vob;
-                voc += vob;
-            }
-            m_fccnd(ifc, 0) /= voc;
-            m_fccnd(ifc, 1) /= voc;
-            m_fccnd(ifc, 2) /= voc;
-        }
+                for (size_t jfc = begin ; jfc < end ; ++jfc)
+                {
+                    size_t const ifc = face_at(jfc);
+                    std::array<real_type, 3> crd; // NOLINT(cppcoreguidelines-pro-type-member-init)
+                    std::array<std::array<real_type, 3>, FCMND+2> cfd; // NOLINT(cppcoreguidelines-pro-type-member-init)
+                    // find averaged point.
+                    cfd[0][0] = cfd[0][1] = cfd[0][2] = 0.0;
+                    size_t const nnd = fcnds(ifc, 0);
+                    for (size_t inf = 1 ; inf <= nnd ; ++inf)
+                    {
+                        int_type const ind = fcnds(ifc, inf);
+                        cfd[inf][0]  = ndcrd(ind, 0);
+                        cfd[0  ][0] += ndcrd(ind, 0);
+                        cfd[inf][1]  = ndcrd(ind, 1);
+                        cfd[0  ][1] += ndcrd(ind, 1);
+                        cfd[inf][2]  = ndcrd(ind, 2);
+                        cfd[0  ][2] += ndcrd(ind, 2);
+                    }
+                    cfd[nnd+1][0] = cfd[1][0];
+                    cfd[nnd+1][1] = cfd[1][1];
+                    cfd[nnd+1][2] = cfd[1][2];
+                    cfd[0][0] /= nnd;
+                    cfd[0][1] /= nnd;
+                    cfd[0][2] /= nnd;
+                    // calculate area.
+                    real_type voc = 0.0;
+                    fccnd(ifc, 0) = fccnd(ifc, 1) = fccnd(ifc, 2) = 0.0;
+                    for (size_t inf = 1 ; inf <= nnd ; ++inf)
+                    {
+                        crd[0] = (cfd[0][0] + cfd[inf][0] + cfd[inf+1][0])/3;
+                        crd[1] = (cfd[0][1] + cfd[inf][1] + cfd[inf+1][1])/3;
+                        crd[2] = (cfd[0][2] + cfd[inf][2] + cfd[inf+1][2])/3;
+                        real_type const du0 = cfd[inf][0] - cfd[0][0];
+                        real_type const du1 = cfd[inf][1] - cfd[0][1];
+                        real_type const du2 = cfd[inf][2] - cfd[0][2];
+                        real_type const dv0 = cfd[inf+1][0] - cfd[0][0];
+                        real_type const dv1 = cfd[inf+1][1] - cfd[0][1];
+                        real_type const dv2 = cfd[inf+1][2] - cfd[0][2];
+                        real_type const dw0 = du1*dv2 - du2*dv1;
+                        real_type const dw1 = du2*dv0 - du0*dv2;
+                        real_type const dw2 = du0*dv1 - du1*dv0;
+                        real_type const vob = std::sqrt(dw0*dw0 + dw1*dw1 + dw2*dw2);
+                        fccnd(ifc, 0) += crd[0] * vob;
+                        fccnd(ifc, 1) += crd[1] * vob;
+                        fccnd(ifc, 2) += crd[2] * vob;
+                        voc += vob;
+                    }
+                    fccnd(ifc, 0) /= voc;
+                    fccnd(ifc, 1) /= voc;
+                    fccnd(ifc, 2) /= voc;
+                }
+            });
     }
 
     // compute face normal vector and area.
     if (m_ndim == 2)
     {
-        for (size_t ifc = 0 ; ifc < nface() ; ++ifc)
-        {
-            // 2D faces are always lines.
-            int_type const ind1 = m_fcnds(ifc, 1);
-            int_type const ind2 = m_fcnds(ifc, 2);
-            // face normal.
-            m_fcnml(ifc, 0) = m_ndcrd(ind2, 1) - m_ndcrd(ind1, 1);
-            m_fcnml(ifc, 1) = m_ndcrd(ind1, 0) - m_ndcrd(ind2, 0);
-            // face ara.
-            m_fcara(ifc) = std::sqrt(m_fcnml(ifc, 0)*m_fcnml(ifc, 0) + m_fcnml(ifc, 1)*m_fcnml(ifc, 1));
-            // normalize face normal.
-            m_fcnml(ifc, 0) /= m_fcara(ifc);
-            m_fcnml(ifc, 1) /= m_fcara(ifc);
-        }
+        parallel_for_chunks(
+            nface_todo,
+            parallel_faces,
+            [&](size_t begin, size_t end)
+            {
+                for (size_t jfc = begin ; jfc < end ; ++jfc)
+                {
+                    size_t const ifc = face_at(jfc);
+                    // 2D faces are always lines.
+                    int_type const ind1 = fcnds(ifc, 1);
+                    int_type const ind2 = fcnds(ifc, 2);
+                    // face normal.
+                    fcnml(ifc, 0) = ndcrd(ind2, 1) - ndcrd(ind1, 1);
+                    fcnml(ifc, 1) = ndcrd(ind1, 0) - ndcrd(ind2, 0);
+                    // face ara.
+                    fcara(ifc) = std::sqrt(fcnml(ifc, 0)*fcnml(ifc, 0) + fcnml(ifc, 1)*fcnml(ifc, 1));
+                    // normalize face normal.
+                    fcnml(ifc, 0) /= fcara(ifc);
+                    fcnml(ifc, 1) /= fcara(ifc);
+                }
+            });
     }
     else if (m_ndim == 3)
     {
-        for (size_t ifc = 0 ; ifc < nface() ; ++ifc)
-        {
-            // compute radial vector.
-            std::array<std::array<real_type, 3>, FCMND> radvec; // NOLINT(cppcoreguidelines-pro-type-member-init)
-            size_t const nnd = m_fcnds(ifc, 0);
-            for (size_t inf = 0 ; inf < nnd ; ++inf)
-            {
-                int_type const ind = m_fcnds(ifc, inf+1);
-                radvec[inf][0] = m_ndcrd(ind, 0) - m_fccnd(ifc, 0);
-                radvec[inf][1] = m_ndcrd(ind, 1) - m_fccnd(ifc, 1);
-                radvec[inf][2] = m_ndcrd(ind, 2) - m_fccnd(ifc, 2);
-            }
-            // compute cross product.
-            m_fcnml(ifc, 0) = radvec[nnd-1][1]*radvec[0][2]
-                            - radvec[nnd-1][2]*radvec[0][1];
-            m_fcnml(ifc, 1) = radvec[nnd-1][2]*radvec[0][0]
-                            - radvec[nnd-1][0]*radvec[0][2];
-            m_fcnml(ifc, 2) = radvec[nnd-1][0]*radvec[0][1]
-                            - radvec[nnd-1][1]*radvec[0][0];
-            for (size_t ind = 1 ; ind < nnd ; ++ind)
+        parallel_for_chunks(
+            nface_todo,
+            parallel_faces,
+            [&](size_t begin, size_t end)
             {
-                m_fcnml(ifc, 0) += radvec[ind-1][1]*radvec[ind][2]
-                                 - radvec[ind-1][2]*radvec[ind][1];
-                m_fcnml(ifc, 1) += radvec[ind-1][2]*radvec[ind][0]
-                                 - radvec[ind-1][0]*radvec[ind][2];
-                m_fcnml(ifc, 2) += radvec[ind-1][0]*radvec[ind][1]
-                                 - radvec[ind-1][1]*radvec[ind][0];
-            }
-            // compute face area.
-            m_fcara(ifc) = std::sqrt
-            (
-                m_fcnml(ifc, 0)*m_fcnml(ifc, 0)
-              + m_fcnml(ifc, 1)*m_fcnml(ifc, 1)
-              + m_fcnml(ifc, 2)*m_fcnml(ifc, 2)
-            );
-            // normalize normal vector.
-            m_fcnml(ifc, 0) /= m_fcara(ifc);
-            m_fcnml(ifc, 1) /= m_fcara(ifc);
-            m_fcnml(ifc, 2) /= m_fcara(ifc);
-            // get real face area.
-            m_fcara(ifc) /= 2.0;
-        }
+                for (size_t jfc = begin ; jfc < end ; ++jfc)
+                {
+                    size_t const ifc = face_at(jfc);
+                    // compute radial vector.
+                    std::array<std::array<real_type, 3>, FCMND> radvec; // NOLINT(cppcoreguidelines-pro-type-member-init)
+                    size_t const nnd = fcnds(ifc, 0);
+                    for (size_t inf = 0 ; inf < nnd ; ++inf)
+                    {
+                        int_type const ind = fcnds(ifc, inf+1);
+                        radvec[inf][0] = ndcrd(ind, 0) - fccnd(ifc, 0);
+                        radvec[inf][1] = ndcrd(ind, 1) - fccnd(ifc, 1);
+                        radvec[inf][2] = ndcrd(ind, 2) - fccnd(ifc, 2);
+                    }
+                    // compute cross product.
+                    fcnml(ifc, 0) = radvec[nnd-1][1]*radvec[0][2]
+                                    - radvec[nnd-1][2]*radvec[0][1];
+                    fcnml(ifc, 1) = radvec[nnd-1][2]*radvec[0][0]
+                                    - radvec[nnd-1][0]*radvec[0][2];
+                    fcnml(ifc, 2) = radvec[nnd-1][0]*radvec[0][1]
+                                    - radvec[nnd-1][1]*radvec[0][0];
+                    for (size_t ind = 1 ; ind < nnd ; ++ind)
+                    {
+                        fcnml(ifc, 0) += radvec[ind-1][1]*radvec[ind][2]
+                                         - radvec[ind-1][2]*radvec[ind][1];
+                        fcnml(ifc, 1) += radvec[ind-1][2]*radvec[ind][0]
+                                         - radvec[ind-1][0]*radvec[ind][2];
+                        fcnml(ifc, 2) += radvec[ind-1][0]*radvec[ind][1]
+                                         - radvec[ind-1][1]*radvec[ind][0];
+                    }
+                    // compute face area.
+                    fcara(ifc) = std::sqrt
+                    (
+                        fcnml(ifc, 0)*fcnml(ifc, 0)
+                      + fcnml(ifc, 1)*fcnml(ifc, 1)
+                      + fcnml(ifc, 2)*fcnml(ifc, 2)
+                    );
+                    // normalize normal vector.
+                    fcnml(ifc, 0) /= fcara(ifc);
+                    fcnml(ifc, 1) /= fcara(ifc);
+                    fcnml(ifc, 2) /= fcara(ifc);
+                    // get real face area.
+                    fcara(ifc) /= 2;
+                }
+            });
     }
 
     // compute cell centers.
     if (m_ndim == 2)
     {
-        for (size_t icl = 0 ; icl < ncell() ; ++icl)
-        {
-            if ((use_incenter()) && (CellType::TRIANGLE == m_cltpn(icl)))
+        parallel_for_chunks(
+            ncell_todo,
+            parallel_cells,
+            [&](size_t begin, size_t end)
             {
-                real_type voc = 0.0;
-                {
-                    int_type const ind = m_clnds(icl, 1);
-                    real_type const vob = m_fcara(m_clfcs(icl, 2));
-                    voc += vob;
-                    m_clcnd(icl, 0) = vob*m_ndcrd(ind, 0);
-                    m_clcnd(icl, 1) = vob*m_ndcrd(ind, 1);
-                }
-                {
-                    int_type const ind = m_clnds(icl, 2);
-                    real_type const vob = m_fcara(m_clfcs(icl, 3));
-                    voc += vob;
-                    m_clcnd(icl, 0) += vob*m_ndcrd(ind, 0);
-                    m_clcnd(icl, 1) += vob*m_ndcrd(ind, 1);
-                }
+                for (size_t jcl = begin ; jcl < end ; ++jcl)
                 {
-                    int_type const ind = m_clnds(icl, 3);
-                    real_type const vob = m_fcara(m_clfcs(icl, 1));
-                    voc += vob;
-                    m_clcnd(icl, 0) += vob*m_ndcrd(ind, 0);
-                    m_clcnd(icl, 1) += vob*m_ndcrd(ind, 1);
-                }
-                m_clcnd(icl, 0) /= voc;
-                m_clcnd(icl, 1) /= voc;
-            }
-            else // centroids.
-            {
-                // averaged point.
-                std::array<real_type, 2> crd; // NOLINT(cppcoreguidelines-pro-type-member-init)
-                crd[0] = crd[1] = 0.0;
-                size_t const nnd = m_clnds(icl, 0);
-                for (size_t inc = 1 ; inc <= nnd ; ++inc)
-                {
-                    int_type const ind = m_clnds(icl, inc);
-                    crd[0] += m_ndcrd(ind, 0);
-                    crd[1] += m_ndcrd(ind, 1);
-                }
-                crd[0] /= nnd;
-                crd[1] /= nnd;
-                // weight centroid.
-                real_type voc = 0.0;
-                m_clcnd(icl, 0) = m_clcnd(icl, 1) = 0.0;
-                size_t const nfc = m_clfcs(icl, 0);
-                for (size_t ifl = 1 ; ifl <= nfc ; ++ifl)
-                {
-                    int_type const ifc = m_clfcs(icl, ifl);
-                    real_type const du0 = crd[0] - m_fccnd(ifc, 0);
-                    real_type const du1 = crd[1] - m_fccnd(ifc, 1);
-                    real_type const vob = fabs(du0*m_fcnml(ifc, 0) + du1*m_fcnml(ifc, 1)) * m_fcara(ifc);
-                    voc += vob;
-                    real_type const dv0 = m_fccnd(ifc, 0) + du0/3;
-                    real_type const dv1 = m_fccnd(ifc, 1) + du1/3;
-                    m_clcnd(icl, 0) += dv0 * vob;
-                    m_clcnd(icl, 1) += dv1 * vob;
+                    size_t const icl = cell_at(jcl);
+                    if ((use_incenter()) && (CellType::TRIANGLE == cltpn(icl)))
+                    {
+                        real_type voc = 0.0;
+                        {
+                            int_type const ind = clnds(icl, 1);
+                            real_type const vob = fcara(clfcs(icl, 2));
+                            voc += vob;
+                            clcnd(icl, 0) = vob*ndcrd(ind, 0);
+                            clcnd(icl, 1) = vob*ndcrd(ind, 1);
+                        }
+                        {
+                            int_type const ind = clnds(icl, 2);
+                            real_type const vob = fcara(clfcs(icl, 3));
+                            voc += vob;
+                            clcnd(icl, 0) += vob*ndcrd(ind, 0);
+                            clcnd(icl, 1) += vob*ndcrd(ind, 1);
+                        }
+                        {
+                            int_type const ind = clnds(icl, 3);
+                            real_type const vob = fcara(clfcs(icl, 1));
+                            voc += vob;
+                            clcnd(icl, 0) += vob*ndcrd(ind, 0);
+                            clcnd(icl, 1) += vob*ndcrd(ind, 1);
+                        }
+                        clcnd(icl, 0) /= voc;
+                        clcnd(icl, 1) /= voc;
+                    }
+                    else // centroids.
+                    {
+                        // averaged point.
+                        std::array<real_type, 2> crd; // NOLINT(cppcoreguidelines-pro-type-member-init)
+                        crd[0] = crd[1] = 0.0;
+                        size_t const nnd = clnds(icl, 0);
+                        for (size_t inc = 1 ; inc <= nnd ; ++inc)
+                        {
+                            int_type const ind = clnds(icl, inc);
+                            crd[0] += ndcrd(ind, 0);
+                            crd[1] += ndcrd(ind, 1);
+                        }
+                        crd[0] /= nnd;
+                        crd[1] /= nnd;
+                        // weight centroid.
+                        real_type voc = 0.0;
+                        clcnd(icl, 0) = clcnd(icl, 1) = 0.0;
+                        size_t const nfc = clfcs(icl, 0);
+                        for (size_t ifl = 1 ; ifl <= nfc ; ++ifl)
+                        {
+                            int_type const ifc = clfcs(icl, ifl);
+                            real_type const du0 = crd[0] - fccnd(ifc, 0);
+                            real_type const du1 = crd[1] - fccnd(ifc, 1);
+                            real_type const vob = std::abs(du0*fcnml(ifc, 0) + du1*fcnml(ifc, 1)) * fcara(ifc);
+                            voc += vob;
+                            real_type const dv0 = fccnd(ifc, 0) + du0/3;
+                            real_type const dv1 = fccnd(ifc, 1) + du1/3;
+                            clcnd(icl, 0) += dv0 * vob;
+                            clcnd(icl, 1) += dv1 * vob;
+                        }
+                        clcnd(icl, 0) /= voc;
+                        clcnd(icl, 1) /= voc;
+                    }
                 }
-                m_clcnd(icl, 0) /= voc;
-                m_clcnd(icl, 1) /= voc;
-            }
-        }
+            });
     }
     else if (m_ndim == 3)
     {
-        for (size_t icl = 0 ; icl < ncell() ; ++icl)
-        {
-            if ((use_incenter()) && (CellType::TETRAHEDRON == m_cltpn(icl)))
+        parallel_for_chunks(
+            ncell_todo,
+            parallel_cells,
+            [&](size_t begin, size_t end)
             {
-                real_type voc = 0.0;
-                {
-                    int_type const ind = m_clnds(icl, 1);
-                    real_type const vob = m_fcara(m_clfcs(icl, 4));
-                    voc += vob;
-                    m_clcnd(icl, 0) = vob*m_ndcrd(ind, 0);
-                    m_clcnd(icl, 1) = vob*m_ndcrd(ind, 1);
-                    m_clcnd(icl, 2) = vob*m_ndcrd(ind, 2);
-                }
-                {
-                    int_type const ind = m_clnds(icl, 2);
-                    real_type const vob = m_fcara(m_clfcs(icl, 3));
-                    voc += vob;
-                    m_clcnd(icl, 0) = vob*m_ndcrd(ind, 0);
-                    m_clcnd(icl, 1) = vob*m_ndcrd(ind, 1);
-                    m_clcnd(icl, 2) = vob*m_ndcrd(ind, 2);
-                }
-                {
-                    int_type const ind = m_clnds(icl, 3);
-                    real_type const vob = m_fcara(m_clfcs(icl, 2));
-                    voc += vob;
-                    m_clcnd(icl, 0) = vob*m_ndcrd(ind, 0);
-                    m_clcnd(icl, 1) = vob*m_ndcrd(ind, 1);
-                    m_clcnd(icl, 2) = vob*m_ndcrd(ind, 2);
-                }
+                for (size_t jcl = begin ; jcl < end ; ++jcl)
                 {
-                    int_type const ind = m_clnds(icl, 4);
-                    real_type const vob = m_fcara(m_clfcs(icl, 1));
-                    voc += vob;
-                    m_clcnd(icl, 0) = vob*m_ndcrd(ind, 0);
-                    m_clcnd(icl, 1) = vob*m_ndcrd(ind, 1);
-                    m_clcnd(icl, 2) = vob*m_ndcrd(ind, 2);
+                    size_t const icl = cell_at(jcl);
+                    if ((use_incenter()) && (CellType::TETRAHEDRON == cltpn(icl)))
+                    {
+                        real_type voc = 0.0;
+                        {
+                            int_type const ind = clnds(icl, 1);
+                            real_type const vob = fcara(clfcs(icl, 4));
+                            voc += vob;
+                            clcnd(icl, 0) = vob*ndcrd(ind, 0);
+                            clcnd(icl, 1) = vob*ndcrd(ind, 1);
+                            clcnd(icl, 2) = vob*ndcrd(ind, 2);
+                        }
+                        {
+                            int_type const ind = clnds(icl, 2);
+                            real_type const vob = fcara(clfcs(icl, 3));
+                            voc += vob;
+                            clcnd(icl, 0) = vob*ndcrd(ind, 0);
+                            clcnd(icl, 1) = vob*ndcrd(ind, 1);
+                            clcnd(icl, 2) = vob*ndcrd(ind, 2);
+                        }
+                        {
+                            int_type const ind = clnds(icl, 3);
+                            real_type const vob = fcara(clfcs(icl, 2));
+                            voc += vob;
+                            clcnd(icl, 0) = vob*ndcrd(ind, 0);
+                            clcnd(icl, 1) = vob*ndcrd(ind, 1);
+                            clcnd(icl, 2) = vob*ndcrd(ind, 2);
+                        }
+                        {
+                            int_type const ind = clnds(icl, 4);
+                            real_type const vob = fcara(clfcs(icl, 1));
+                            voc += vob;
+                            clcnd(icl, 0) = vob*ndcrd(ind, 0);
+                            clcnd(icl, 1) = vob*ndcrd(ind, 1);
+                            clcnd(icl, 2) = vob*ndcrd(ind, 2);
+                        }
+                        clcnd(icl, 0) /= voc;
+                        clcnd(icl, 1) /= voc;
+                        clcnd(icl, 2) /= voc;
+                    }
+                    else // centroids.
+                    {
+                        // averaged point.
+                        std::array<real_type, 3> crd; // NOLINT(cppcoreguidelines-pro-type-member-init)
+                        crd[0] = crd[1] = crd[2] = 0.0;
+                        size_t const nnd = clnds(icl, 0);
+                        for (size_t inc = 1 ; inc <= nnd ; ++inc)
+                        {
+                            int_type const ind = clnds(icl, inc);
+                            crd[0] += ndcrd(ind, 0);
+                            crd[1] += ndcrd(ind, 1);
+                            crd[2] += ndcrd(ind, 2);
+                        }
+                        crd[0] /= nnd;
+                        crd[1] /= nnd;
+                        crd[2] /= nnd;
+                        // weight centroid.
+                        real_type voc = 0.0;
+                        clcnd(icl, 0) = clcnd(icl, 1) = clcnd(icl, 2) = 0.0;
+                        size_t const nfc = clfcs(icl, 0);
+                        for (size_t ifl = 1 ; ifl <= nfc ; ++ifl)
+                        {
+                            int_type const ifc = clfcs(icl, ifl);
+                            real_type const du0 = crd[0] - fccnd(ifc, 0);
+                            real_type const du1 = crd[1] - fccnd(ifc, 1);
+                            real_type const du2 = crd[2] - fccnd(ifc, 2);
+                            real_type const vob = std::abs(du0*fcnml(ifc, 0) + du1*fcnml(ifc, 1) + du2*fcnml(ifc, 2)) * fcara(ifc);
+                            voc += vob;
+                            real_type const dv0 = fccnd(ifc, 0) + du0/4;
+                            real_type const dv1 = fccnd(ifc, 1) + du1/4;
+                            real_type const dv2 = fccnd(ifc, 2) + du2/4;
+                            clcnd(icl, 0) += dv0 * vob;
+                            clcnd(icl, 1) += dv1 * vob;
+                            clcnd(icl, 2) += dv2 * vob;
+                        }
+                        clcnd(icl, 0) /= voc;
+                        clcnd(icl, 1) /= voc;
+                        clcnd(icl, 2) /= voc;
+                    }
                 }
-                m_clcnd(icl, 0) /= voc;
-                m_clcnd(icl, 1) /= voc;
-                m_clcnd(icl, 2) /= voc;
-            }
-            else // centroids.
+            });
+    }
+
+    // compute volume for each cell.  Flipping a face negates every term of
+    // its volume exactly, so the magnitude does not depend on the flips and
+    // the cells are processed in parallel.  The sign is kept to replay the
+    // serial orientation decisions per face.
+    //
+    // Sign of the volume associated with each face of each cell, computed
+    // with the face orientation before the pass: -1, 0 or 1.
+    std::vector<int8_t> volsgn(ncell_todo * CLMFC, 0);
+    parallel_for_chunks(
+        ncell_todo,
+        parallel_cells,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t jcl = begin ; jcl < end ; ++jcl)
             {
-                // averaged point.
-                std::array<real_type, 3> crd; // NOLINT(cppcoreguidelines-pro-type-member-init)
-                crd[0] = crd[1] = crd[2] = 0.0;
-                size_t const nnd = m_clnds(icl, 0);
-                for (size_t inc = 1 ; inc <= nnd ; ++inc)
+                size_t const icl = cell_at(jcl);
+                clvol(icl) = 0.0;
+                size_t const nfc = clfcs(icl, 0);
+                for (size_t it = 1 ; it <= nfc ; ++it)
                 {
-                    int_type const ind = m_clnds(icl, inc);
-                    crd[0] += m_ndcrd(ind, 0);
-                    crd[1] += m_ndcrd(ind, 1);
-                    crd[2] += m_ndcrd(ind, 2);
-                }
-                crd[0] /= nnd;
-                crd[1] /= nnd;
-                crd[2] /= nnd;
-                // weight centroid.
-                real_type voc = 0.0;
-                m_clcnd(icl, 0) = m_clcnd(icl, 1) = m_clcnd(icl, 2) = 0.0;
-                size_t const nfc = m_clfcs(icl, 0);
-                for (size_t ifl = 1 ; ifl <= nfc ; ++ifl)
-                {
-                    int_type const ifc = m_clfcs(icl, ifl);
-                    real_type const du0 = crd[0] - m_fccnd(ifc, 0);
-                    real_type const du1 = crd[1] - m_fccnd(ifc, 1);
-                    real_type const du2 = crd[2] - m_fccnd(ifc, 2);
-                    real_type const vob = fabs(du0*m_fcnml(ifc, 0) + du1*m_fcnml(ifc, 1) + du2*m_fcnml(ifc, 2)) * m_fcara(ifc);
-                    voc += vob;
-                    real_type const dv0 = m_fccnd(ifc, 0) + du0/4;
-                    real_type const dv1 = m_fccnd(ifc, 1) + du1/4;
-                    real_type const dv2 = m_fccnd(ifc, 2) + du2/4;
-                    m_clcnd(icl, 0) += dv0 * vob;
-                    m_clcnd(icl, 1) += dv1 * vob;
-                    m_clcnd(icl, 2) += dv2 * vob;
+                    int_type const ifc = clfcs(icl, it);
+                    // calculate volume associated with each face.
+                    real_type vol = 0.0;
+                    for (size_t idm = 0 ; idm < m_ndim ; ++idm)
+                    {
+                        vol += (fccnd(ifc, idm) - clcnd(icl, idm)) * fcnml(ifc, idm);
+                    }
+                    vol *= fcara(ifc);
+                    volsgn[jcl * CLMFC + it - 1] = vol < 0.0 ? -1 : (vol > 0.0 ? 1 : 0);
+                    // accumulate the volume for the cell.
+                    clvol(icl) += vol < 0.0 ? -vol : vol;
                 }
-                m_clcnd(icl, 0) /= voc;
-                m_clcnd(icl, 1) /= voc;
-                m_clcnd(icl, 2) /= voc;
+                // calculate the real volume.
+                clvol(icl) /= m_ndim;
             }
-        }
-    }
+        });
+
+    orient_faces(volsgn, faces, cells);
+}
+
+/**
+ * Reverse the nodes and the normal of the faces that point into their
+ * "self" cells, replaying the serial orientation decisions from the signs of
+ * the volumes per cell face that calc_metric() computed.
+ */
+template <typename T>
+void BasicStaticMesh<T>::orient_faces(std::vector<int8_t> const & volsgn, std::vector<int_type> const * faces, std::vector<int_type> const * cells)
+{
+    auto const fcnds = m_fcnds.template fixed_view<2>();
+    auto const fcnml = m_fcnml.template fixed_view<2>();
+    auto const fccls = m_fccls.template fixed_view<2>();
+    auto const clfcs = m_clfcs.template fixed_view<2>();
 
-    // compute volume for each cell.
-    auto reorder_face = [this](int_type ifc)
+    size_t const nface_todo = nullptr == faces ? nface() : faces->size();
+    auto face_at = [faces](size_t it)
+    { return nullptr == faces ? it : static_cast<size_t>((*faces)[it]); };
+    bool const parallel_faces = ThreadPool::instance().use_parallel(nface_todo);
+
+    // Position of a cell in the (sorted) cell list.
+    auto cell_position = [cells](int_type icl)
+    {
+        return nullptr == cells
+                   ? static_cast<size_t>(icl)
+                   : static_cast<size_t>(std::lower_bound(cells->begin(), cells->end(), icl) - cells->begin());
+    };
+
+    // check if need to reorder node definition and connecting cell list for
+    // the face.  The cells sharing a face visit it in ascending order, each
+    // seeing the flips made by the earlier ones.
+    auto reorder_face = [this, &fcnds, &fcnml](int_type ifc)
     {
-        size_t const nnd = m_fcnds(ifc, 0);
+        size_t const nnd = fcnds(ifc, 0);
         std::array<int_type, FCMND> ndstf; // NOLINT(cppcoreguidelines-pro-type-member-init)
         for (size_t jt = 0 ; jt < nnd ; ++jt)
         {
-            ndstf[jt] = m_fcnds(ifc, nnd-jt);
+            ndstf[jt] = fcnds(ifc, nnd-jt);
         }
         for (size_t jt = 0 ; jt < nnd ; ++jt)
         {
-            m_fcnds(ifc, jt+1) = ndstf[jt];
+            fcnds(ifc, jt+1) = ndstf[jt];
         }
         for (size_t idm = 0 ; idm < m_ndim ; ++idm)
         {
-            m_fcnml(ifc, idm) = -m_fcnml(ifc, idm);
+            fcnml(ifc, idm) = -fcnml(ifc, idm);
         }
     };
-    for (size_t icl = 0 ; icl < ncell() ; ++icl)
-    {
-        m_clvol(icl) = 0.0;
-        size_t const nfc = m_clfcs(icl, 0);
-        for (size_t it = 1 ; it <= nfc ; ++it)
+    parallel_for_chunks(
+        nface_todo,
+        parallel_faces,
+        [&](size_t begin, size_t end)
         {
-            int_type const ifc = m_clfcs(icl, it);
-            // calculate volume associated with each face.
-            real_type vol = 0.0;
-            for (size_t idm = 0 ; idm < m_ndim ; ++idm)
+            for (size_t jfc = begin ; jfc < end ; ++jfc)
             {
-                vol += (m_fccnd(ifc, idm) - m_clcnd(icl, idm)) * m_fcnml(ifc, idm);
-            }
-            vol *= m_fcara(ifc);
-            // check if need to reorder node definition and connecting cell
-            // list for the face.
-            size_t const this_fcl = m_fccls(ifc, 0);
-            if (vol < 0.0)
-            {
-                if (this_fcl == icl) { reorder_face(ifc); }
-                vol = -vol;
-            }
-            else
-            {
-                if (this_fcl != icl) { reorder_face(ifc); }
+                size_t const ifc = face_at(jfc);
+                size_t const this_fcl = fccls(ifc, 0);
+                std::array<int_type, 2> icls{fccls(ifc, 0), fccls(ifc, 1)};
+                if (icls[1] < icls[0]) { std::swap(icls[0], icls[1]); }
+                bool flipped = false;
+                for (size_t ic = 0 ; ic < icls.size() ; ++ic)
+                {
+                    int_type const icl = icls[ic];
+                    if (icl < 0 || static_cast<size_t>(icl) >= ncell() || (ic > 0 && icl == icls[0]))
+                    {
+                        continue;
+                    }
+                    size_t const nfc = clfcs(icl, 0);
+                    for (size_t it = 1 ; it <= nfc ; ++it)
+                    {
+                        if (static_cast<size_t>(clfcs(icl, it)) != ifc)
+                        {
+                            continue;
+                        }
+                        int8_t const sgn = volsgn[cell_position(icl) * CLMFC + it - 1];
+                        bool const negative = flipped ? sgn > 0 : sgn < 0;
+                        if (negative == (this_fcl == static_cast<size_t>(icl)))
+                        {
+                            flipped = !flipped;
+                        }
+                    }
+                }
+                if (flipped) { reorder_face(static_cast<int_type>(ifc)); }
             }
-            // accumulate the volume for the cell.
-            m_clvol(icl) += vol;
+        });
+}
+
+/**
+ * Only the faces and cells having a changed node depend on its coordinates,
+ * and every cell of such a face has the node too, so the orientation pass of
+ * calc_metric sees all the cells it needs.
+ */
+template <typename T>
+void BasicStaticMesh<T>::update_metric(SimpleArray<int_type> const & changed_nodes)
+{
+    if (0 != m_ncell && 0 == m_nface)
+    {
+        throw std::runtime_error("StaticMesh: update_metric must be called after build_interior");
+    }
+    StaticMeshAdjacency const & nd_faces = node_faces();
+    StaticMeshAdjacency const & nd_cells = node_cells();
+
+    std::vector<int_type> nodes;
+    std::vector<int_type> faces;
+    std::vector<int_type> cells;
+    nodes.reserve(changed_nodes.size());
+    for (int_type const ind : changed_nodes)
+    {
+        if (ind < 0 || static_cast<size_t>(ind) >= nnode())
+        {
+            throw std::out_of_range(Formatter() << "StaticMesh: changed node " << ind
+                                                << " is out of range [0, " << nnode() << ")");
         }
-        // calculate the real volume.
-        m_clvol(icl) /= m_ndim;
+        nodes.push_back(ind);
+        SimpleArraySpan<int32_t const> const fcs = nd_faces.row(ind);
+        faces.insert(faces.end(), fcs.begin(), fcs.end());
+        SimpleArraySpan<int32_t const> const cls = nd_cells.row(ind);
+        cells.insert(cells.end(), cls.begin(), cls.end());
+    }
+    auto sort_unique = [](std::vector<int_type> & values)
+    {
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+    };
+    sort_unique(nodes);
+    sort_unique(faces);
+    sort_unique(cells);
+
+    if (2 == m_ndim || 3 == m_ndim)
+    {
+        calc_metric(&faces, &cells);
+        // The orientation pass may have flipped the nodes of the faces.
+        m_fcnds_csr.reset();
+    }
+    if (m_soa)
+    {
+        sync_soa(nodes, faces, cells);
     }
 }
 
+template void BasicStaticMesh<float>::build_faces_from_cells(bool zero_metric);
+template void BasicStaticMesh<float>::build_edge();
+template void BasicStaticMesh<float>::calc_metric(std::vector<int32_t> const * faces, std::vector<int32_t> const * cells);
+template void BasicStaticMesh<float>::orient_faces(std::vector<int8_t> const & volsgn, std::vector<int32_t> const * faces, std::vector<int32_t> const * cells);
+template void BasicStaticMesh<float>::update_metric(SimpleArray<int32_t> const & changed_nodes);
+template void BasicStaticMesh<double>::build_faces_from_cells(bool zero_metric);
+template void BasicStaticMesh<double>::build_edge();
+template void BasicStaticMesh<double>::calc_metric(std::vector<int32_t> const * faces, std::vector<int32_t> const * cells);
+template void BasicStaticMesh<double>::orient_faces(std::vector<int8_t> const & volsgn, std::vector<int32_t> const * faces, std::vector<int32_t> const * cells);
+template void BasicStaticMesh<double>::update_metric(SimpleArray<int32_t> const & changed_nodes);
+
 } /* end namespace modmesh */
 
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMesh.hpp>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+/**
+ * Fill the components of an [n, ndim] array into contiguous 1D arrays having
+ * the same ghost count.
+ */
+template <typename T>
+void transpose_components(SimpleArray<T> const & aos, size_t ndim, std::array<SimpleArray<T>, 3> & components)
+{
+    size_t const nrow = 0 == aos.size() ? 0 : aos.shape(0);
+    for (size_t idim = 0; idim < components.size(); ++idim)
+    {
+        if (idim < ndim)
+        {
+            components[idim] = SimpleArray<T>(small_vector<size_t>{nrow}, SimpleArrayUninitialized{});
+            components[idim].set_nghost(aos.nghost());
+        }
+        else
+        {
+            components[idim] = SimpleArray<T>(small_vector<size_t>{0});
+        }
+    }
+    if (0 == nrow)
+    {
+        return;
+    }
+    std::array<T *, 3> dst{nullptr, nullptr, nullptr};
+    for (size_t idim = 0; idim < ndim; ++idim)
+    {
+        dst[idim] = components[idim].data();
+    }
+    deinterleave(aos.data(), nrow, ndim, dst.data(), ThreadPool::instance().use_parallel(nrow * ndim));
+}
+
+template <typename T>
+void update_components(SimpleArray<T> const & aos, size_t ndim, std::vector<int32_t> const & rows, std::array<SimpleArray<T>, 3> & components)
+{
+    for (size_t idim = 0; idim < ndim; ++idim)
+    {
+        SimpleArray<T> & component = components[idim];
+        for (int32_t const irow : rows)
+        {
+            component(irow) = aos(irow, idim);
+        }
+    }
+}
+
+} /* end namespace detail */
+
+template <typename T>
+void BasicStaticMesh<T>::set_soa(bool enable)
+{
+    m_soa = enable;
+    if (m_soa)
+    {
+        sync_soa();
+    }
+    else
+    {
+        for (auto * components : {&m_ndcrd_soa, &m_fccnd_soa, &m_fcnml_soa, &m_clcnd_soa})
+        {
+            for (SimpleArray<real_type> & component : *components)
+            {
+                component = SimpleArray<real_type>(small_vector<size_t>{0});
+            }
+        }
+    }
+}
+
+template <typename T>
+void BasicStaticMesh<T>::sync_soa()
+{
+    if (!m_soa)
+    {
+        throw std::runtime_error("StaticMesh: the SoA layout is not enabled");
+    }
+    detail::transpose_components(m_ndcrd, m_ndim, m_ndcrd_soa);
+    detail::transpose_components(m_fccnd, m_ndim, m_fccnd_soa);
+    detail::transpose_components(m_fcnml, m_ndim, m_fcnml_soa);
+    detail::transpose_components(m_clcnd, m_ndim, m_clcnd_soa);
+}
+
+template <typename T>
+void BasicStaticMesh<T>::sync_soa(std::vector<int_type> const & nodes, std::vector<int_type> const & faces, std::vector<int_type> const & cells)
+{
+    detail::update_components(m_ndcrd, m_ndim, nodes, m_ndcrd_soa);
+    detail::update_components(m_fccnd, m_ndim, faces, m_fccnd_soa);
+    detail::update_components(m_fcnml, m_ndim, faces, m_fcnml_soa);
+    detail::update_components(m_clcnd, m_ndim, cells, m_clcnd_soa);
+}
+
+template <typename T>
+SimpleArray<typename BasicStaticMesh<T>::real_type> const & BasicStaticMesh<T>::soa_component(std::array<SimpleArray<real_type>, 3> const & components, size_t idim, char const * name) const
+{
+    if (!m_soa)
+    {
+        throw std::runtime_error(Formatter() << "StaticMesh: " << name << " SoA is not enabled");
+    }
+    if (idim >= m_ndim)
+    {
+        throw std::out_of_range(Formatter() << "StaticMesh: " << name << " has no component " << idim
+                                            << " for ndim " << static_cast<int>(m_ndim));
+    }
+    return components[idim];
+}
+
+template void BasicStaticMesh<float>::set_soa(bool enable);
+template void BasicStaticMesh<float>::sync_soa();
+template void BasicStaticMesh<float>::sync_soa(std::vector<int32_t> const & nodes, std::vector<int32_t> const & faces, std::vector<int32_t> const & cells);
+template SimpleArray<float> const & BasicStaticMesh<float>::soa_component(std::array<SimpleArray<float>, 3> const & components, size_t idim, char const * name) const;
+template void BasicStaticMesh<double>::set_soa(bool enable);
+template void BasicStaticMesh<double>::sync_soa();
+template void BasicStaticMesh<double>::sync_soa(std::vector<int32_t> const & nodes, std::vector<int32_t> const & faces, std::vector<int32_t> const & cells);
+template SimpleArray<double> const & BasicStaticMesh<double>::soa_component(std::array<SimpleArray<double>, 3> const & components, size_t idim, char const * name) const;
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,441 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMesh.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+/**
+ * Layout of a .mmesh file:
+ *
+ * 1. MmeshHeader.
+ * 2. MmeshArrayEntry of each array, narray of them, with the arrays of the
+ *    mesh in a fixed order followed by the facn of each boundary condition.
+ * 3. The data of each array, starting at a multiple of MMESH_ALIGNMENT.
+ *
+ * All the numbers are stored in the byte order of the writer, which is
+ * recorded by byte_order.  A mesh published to shared memory takes the same
+ * layout at the start of the segment.
+ */
+struct MmeshHeader
+{
+    char magic[8]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    uint32_t version;
+    uint32_t byte_order;
+    uint8_t ndim;
+    uint8_t use_incenter;
+    uint8_t int_size;
+    uint8_t real_size;
+    uint32_t nnode;
+    uint32_t nface;
+    uint32_t ncell;
+    uint32_t nbound;
+    uint32_t ngstnode;
+    uint32_t ngstface;
+    uint32_t ngstcell;
+    uint32_t narray;
+    uint32_t nbc;
+}; /* end struct MmeshHeader */
+
+struct MmeshArrayEntry
+{
+    char name[16]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    uint32_t itemsize;
+    uint32_t ndim;
+    uint64_t nghost;
+    uint64_t shape[4]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    uint64_t offset;
+    uint64_t nbytes;
+}; /* end struct MmeshArrayEntry */
+
+static_assert(56 == sizeof(MmeshHeader), "MmeshHeader must not be padded");
+static_assert(80 == sizeof(MmeshArrayEntry), "MmeshArrayEntry must not be padded");
+
+constexpr char MMESH_MAGIC[8] = {'M', 'M', 'E', 'S', 'H', '\0', '\0', '\0'}; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+constexpr uint32_t MMESH_BYTE_ORDER = 0x01020304;
+constexpr uint64_t MMESH_ALIGNMENT = 64;
+
+inline uint64_t mmesh_align(uint64_t offset)
+{
+    return (offset + MMESH_ALIGNMENT - 1) / MMESH_ALIGNMENT * MMESH_ALIGNMENT;
+}
+
+struct MmeshWriter
+{
+
+    template <typename T>
+    void add(char const * name, SimpleArray<T> const & arr)
+    {
+        if (arr.ndim() > 4)
+        {
+            throw std::runtime_error(Formatter() << "StaticMesh: cannot save " << arr.ndim() << "-dimensional array " << name);
+        }
+        MmeshArrayEntry entry{};
+        std::strncpy(entry.name, name, sizeof(entry.name) - 1);
+        entry.itemsize = sizeof(T);
+        entry.ndim = static_cast<uint32_t>(arr.ndim());
+        entry.nghost = arr.nghost();
+        for (size_t it = 0; it < arr.ndim(); ++it)
+        {
+            entry.shape[it] = arr.shape(it);
+        }
+        entry.nbytes = arr.size() * sizeof(T);
+        entries.push_back(entry);
+        data.push_back(reinterpret_cast<char const *>(arr.data()));
+    }
+
+    /// Place the arrays and return the total size.
+    uint64_t layout(MmeshHeader & header)
+    {
+        header.narray = static_cast<uint32_t>(entries.size());
+        uint64_t offset = mmesh_align(sizeof(MmeshHeader) + entries.size() * sizeof(MmeshArrayEntry));
+        for (MmeshArrayEntry & entry : entries)
+        {
+            entry.offset = offset;
+            offset = mmesh_align(offset + entry.nbytes);
+        }
+        return offset;
+    }
+
+    /// Copy the layout into the zero-filled memory of layout() bytes.
+    void copy_to(int8_t * dst, MmeshHeader header)
+    {
+        layout(header);
+        std::memcpy(dst, &header, sizeof(header));
+        std::memcpy(dst + sizeof(header), entries.data(), entries.size() * sizeof(MmeshArrayEntry));
+        for (size_t it = 0; it < entries.size(); ++it)
+        {
+            if (0 != entries[it].nbytes)
+            {
+                std::memcpy(dst + entries[it].offset, data[it], entries[it].nbytes);
+            }
+        }
+    }
+
+    void write(std::string const & path, MmeshHeader header)
+    {
+        layout(header);
+
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        if (!stream)
+        {
+            throw std::runtime_error(Formatter() << "StaticMesh: cannot open \"" << path << "\" for writing");
+        }
+        stream.write(reinterpret_cast<char const *>(&header), sizeof(header));
+        stream.write(reinterpret_cast<char const *>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(MmeshArrayEntry)));
+        std::array<char, MMESH_ALIGNMENT> const padding{};
+        uint64_t position = sizeof(MmeshHeader) + entries.size() * sizeof(MmeshArrayEntry);
+        for (size_t it = 0; it < entries.size(); ++it)
+        {
+            stream.write(padding.data(), static_cast<std::streamsize>(entries[it].offset - position));
+            stream.write(data[it], static_cast<std::streamsize>(entries[it].nbytes));
+            position = entries[it].offset + entries[it].nbytes;
+        }
+        stream.write(padding.data(), static_cast<std::streamsize>(mmesh_align(position) - position));
+        if (!stream)
+        {
+            throw std::runtime_error(Formatter() << "StaticMesh: failed to write \"" << path << "\"");
+        }
+    }
+
+    std::vector<MmeshArrayEntry> entries;
+    std::vector<char const *> data;
+
+}; /* end struct MmeshWriter */
+
+struct MmeshReader
+{
+
+    static constexpr size_t ANY_ROWS = std::numeric_limits<size_t>::max();
+
+    MmeshReader(std::string const & path_in, bool mmap_in, size_t real_size)
+        : path(path_in)
+        , mmap(mmap_in)
+        , stream(path, std::ios::binary)
+    {
+        if (!stream)
+        {
+            throw std::runtime_error(Formatter() << "StaticMesh: cannot open \"" << path << "\" for reading");
+        }
+        stream.read(reinterpret_cast<char *>(&header), sizeof(header));
+        check_header(bool(stream), real_size);
+        entries.resize(header.narray);
+        stream.read(reinterpret_cast<char *>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(MmeshArrayEntry)));
+        if (!stream)
+        {
+            throw std::runtime_error(Formatter() << "StaticMesh: \"" << path << "\" is truncated");
+        }
+    }
+
+    /// Read the layout at the start of the segment, whose arrays are used in place.
+    MmeshReader(std::shared_ptr<SharedMemory> shared_in, size_t real_size)
+        : path(shared_in->name())
+        , mmap(false)
+        , shared(std::move(shared_in))
+    {
+        size_t const nbytes = shared->nbytes();
+        if (nbytes >= sizeof(header))
+        {
+            std::memcpy(&header, shared->data(), sizeof(header));
+        }
+        check_header(nbytes >= sizeof(header), real_size);
+        if (sizeof(header) + uint64_t(header.narray) * sizeof(MmeshArrayEntry) > nbytes)
+        {
+            throw std::runtime_error(Formatter() << "StaticMesh: \"" << path << "\" is truncated");
+        }
+        entries.resize(header.narray);
+        std::memcpy(entries.data(), shared->data() + sizeof(header), entries.size() * sizeof(MmeshArrayEntry));
+    }
+
+    void check_header(bool complete, size_t real_size) const
+    {
+        if (!complete || 0 != std::memcmp(header.magic, MMESH_MAGIC, sizeof(MMESH_MAGIC)))
+        {
+            throw std::runtime_error(Formatter() << "StaticMesh: \"" << path << "\" is not a mmesh file");
+        }
+        if (StaticMesh::MMESH_VERSION != header.version)
+        {
+            throw std::runtime_error(Formatter() << "StaticMesh: \"" << path << "\" has mmesh version "
+                                                 << header.version << " but " << StaticMesh::MMESH_VERSION << " is supported");
+        }
+        if (MMESH_BYTE_ORDER != header.byte_order || sizeof(int32_t) != header.int_size)
+        {
+            throw std::runtime_error(Formatter() << "StaticMesh: \"" << path << "\" was written by a platform of different byte order or number sizes");
+        }
+        if (real_size != header.real_size)
+        {
+            throw std::runtime_error(Formatter() << "StaticMesh: \"" << path << "\" has real numbers of " << uint32_t(header.real_size)
+                                                 << " bytes but " << real_size << " are expected");
+        }
+    }
+
+    template <typename T>
+    SimpleArray<T> next(char const * name, size_t nrow)
+    {
+        if (icursor >= entries.size())
+        {
+            throw std::runtime_error(Formatter() << "StaticMesh: \"" << path << "\" misses array " << name);
+        }
+        MmeshArrayEntry const & entry = entries[icursor++];
+        if (0 != std::strncmp(entry.name, name, sizeof(entry.name)) || sizeof(T) != entry.itemsize || 0 == entry.ndim || entry.ndim > 4)
+        {
+            throw std::runtime_error(Formatter() << "StaticMesh: \"" << path << "\" has a bad entry for array " << name);
+        }
+        small_vector<size_t> shape(entry.ndim);
+        size_t nelem = 1;
+        for (size_t it = 0; it < entry.ndim; ++it)
+        {
+            shape[it] = entry.shape[it];
+            nelem *= shape[it];
+        }
+        if ((ANY_ROWS != nrow && shape[0] != nrow) || entry.nghost > shape[0] || nelem * sizeof(T) != entry.nbytes)
+        {
+            throw std::runtime_error(Formatter() << "StaticMesh: \"" << path << "\" has array " << name
+                                                 << " of " << shape[0] << " rows inconsistent with the mesh");
+        }
+
+        SimpleArray<T> ret;
+        if (0 == entry.nbytes)
+        {
+            ret = SimpleArray<T>(shape);
+        }
+        else if (shared)
+        {
+            if (entry.offset > shared->nbytes() || entry.nbytes > shared->nbytes() - entry.offset)
+            {
+                throw std::runtime_error(Formatter() << "StaticMesh: \"" << path << "\" is truncated in array " << name);
+            }
+            ret = SimpleArray<T>(shape, shared->buffer(entry.offset, entry.nbytes));
+        }
+        else if (mmap)
+        {
+            ret = SimpleArray<T>(shape, map_buffer(path, MapMode::CopyOnWrite, entry.offset, entry.nbytes));
+        }
+        else
+        {
+            ret = SimpleArray<T>(shape, SimpleArrayUninitialized{});
+            stream.seekg(static_cast<std::streamoff>(entry.offset));
+            stream.read(reinterpret_cast<char *>(ret.data()), static_cast<std::streamsize>(entry.nbytes));
+            if (!stream)
+            {
+                throw std::runtime_error(Formatter() << "StaticMesh: \"" << path << "\" is truncated in array " << name);
+            }
+        }
+        ret.set_nghost(entry.nghost);
+        return ret;
+    }
+
+    std::string path;
+    bool mmap;
+    std::ifstream stream;
+    std::shared_ptr<SharedMemory> shared;
+    MmeshHeader header{};
+    std::vector<MmeshArrayEntry> entries;
+    size_t icursor = 0;
+
+}; /* end struct MmeshReader */
+
+} /* end namespace detail */
+
+// The arrays in the order of the file, with the entity of their rows.
+#define MM_DECL_MMESH_ARRAYS(X) \
+    X(real_type, ndcrd, node)   \
+    X(real_type, fccnd, face)   \
+    X(real_type, fcnml, face)   \
+    X(real_type, fcara, face)   \
+    X(real_type, clcnd, cell)   \
+    X(real_type, clvol, cell)   \
+    X(int_type, fctpn, face)    \
+    X(int_type, cltpn, cell)    \
+    X(int_type, clgrp, cell)    \
+    X(int_type, fcnds, face)    \
+    X(int_type, fccls, face)    \
+    X(int_type, clnds, cell)    \
+    X(int_type, clfcs, cell)    \
+    X(int_type, ednds, any)     \
+    X(int_type, bndfcs, bound)
+
+template <typename T>
+void BasicStaticMesh<T>::save_mmesh(std::string const & path) const
+{
+    detail::MmeshWriter writer;
+    writer.write(path, fill_mmesh(writer));
+}
+
+template <typename T>
+std::shared_ptr<SharedMemory> BasicStaticMesh<T>::publish_shared(std::string const & name) const
+{
+    detail::MmeshWriter writer;
+    detail::MmeshHeader header = fill_mmesh(writer);
+    std::shared_ptr<SharedMemory> shared = SharedMemory::create(name, writer.layout(header));
+    writer.copy_to(shared->data(), header);
+    shared->publish();
+    return shared;
+}
+
+template <typename T>
+detail::MmeshHeader BasicStaticMesh<T>::fill_mmesh(detail::MmeshWriter & writer) const
+{
+    detail::MmeshHeader header{};
+    std::memcpy(header.magic, detail::MMESH_MAGIC, sizeof(header.magic));
+    header.version = MMESH_VERSION;
+    header.byte_order = detail::MMESH_BYTE_ORDER;
+    header.ndim = m_ndim;
+    header.use_incenter = m_use_incenter ? 1 : 0;
+    header.int_size = sizeof(int_type);
+    header.real_size = sizeof(real_type);
+    header.nnode = m_nnode;
+    header.nface = m_nface;
+    header.ncell = m_ncell;
+    header.nbound = m_nbound;
+    header.ngstnode = m_ngstnode;
+    header.ngstface = m_ngstface;
+    header.ngstcell = m_ngstcell;
+    header.nbc = static_cast<uint32_t>(m_bcs.size());
+
+#define MM_DECL_MMESH_WRITE(TYPE, NAME, ROW) writer.add(#NAME, m_##NAME);
+    MM_DECL_MMESH_ARRAYS(MM_DECL_MMESH_WRITE)
+#undef MM_DECL_MMESH_WRITE
+    for (StaticMeshBC const & bc : m_bcs)
+    {
+        writer.add("bcfacn", bc.facn());
+    }
+    return header;
+}
+
+template <typename T>
+std::shared_ptr<BasicStaticMesh<T>> BasicStaticMesh<T>::load_mmesh(std::string const & path, bool mmap)
+{
+    detail::MmeshReader reader(path, mmap, sizeof(real_type));
+    return read_mmesh(reader);
+}
+
+template <typename T>
+std::shared_ptr<BasicStaticMesh<T>> BasicStaticMesh<T>::attach_shared(std::string const & name)
+{
+    detail::MmeshReader reader(SharedMemory::attach(name), sizeof(real_type));
+    return read_mmesh(reader);
+}
+
+template <typename T>
+std::shared_ptr<BasicStaticMesh<T>> BasicStaticMesh<T>::read_mmesh(detail::MmeshReader & reader)
+{
+    detail::MmeshHeader const & header = reader.header;
+
+    // Construct without the arrays, which are then swapped in.
+    std::shared_ptr<BasicStaticMesh> mesh = construct(header.ndim, 0, 0, 0);
+    BasicStaticMesh & mh = *mesh;
+    mh.m_use_incenter = 0 != header.use_incenter;
+    mh.m_nnode = header.nnode;
+    mh.m_nface = header.nface;
+    mh.m_ncell = header.ncell;
+    mh.m_nbound = header.nbound;
+    mh.m_ngstnode = header.ngstnode;
+    mh.m_ngstface = header.ngstface;
+    mh.m_ngstcell = header.ngstcell;
+
+    size_t const nrow_node = mh.m_nnode + mh.m_ngstnode;
+    size_t const nrow_face = mh.m_nface + mh.m_ngstface;
+    size_t const nrow_cell = mh.m_ncell + mh.m_ngstcell;
+    size_t const nrow_bound = mh.m_nbound;
+    size_t const nrow_any = detail::MmeshReader::ANY_ROWS;
+#define MM_DECL_MMESH_READ(TYPE, NAME, ROW) mh.m_##NAME = reader.next<TYPE>(#NAME, nrow_##ROW);
+    MM_DECL_MMESH_ARRAYS(MM_DECL_MMESH_READ)
+#undef MM_DECL_MMESH_READ
+
+    mh.m_bcs.reserve(header.nbc);
+    for (uint32_t ibc = 0; ibc < header.nbc; ++ibc)
+    {
+        mh.m_bcs.emplace_back();
+        mh.m_bcs.back().facn() = reader.next<int_type>("bcfacn", nrow_any);
+    }
+    return mesh;
+}
+
+#undef MM_DECL_MMESH_ARRAYS
+
+template void BasicStaticMesh<float>::save_mmesh(std::string const & path) const;
+template std::shared_ptr<BasicStaticMesh<float>> BasicStaticMesh<float>::load_mmesh(std::string const & path, bool mmap);
+template std::shared_ptr<SharedMemory> BasicStaticMesh<float>::publish_shared(std::string const & name) const;
+template std::shared_ptr<BasicStaticMesh<float>> BasicStaticMesh<float>::attach_shared(std::string const & name);
+template void BasicStaticMesh<double>::save_mmesh(std::string const & path) const;
+template std::shared_ptr<BasicStaticMesh<double>> BasicStaticMesh<double>::load_mmesh(std::string const & path, bool mmap);
+template std::shared_ptr<SharedMemory> BasicStaticMesh<double>::publish_shared(std::string const & name) const;
+template std::shared_ptr<BasicStaticMesh<double>> BasicStaticMesh<double>::attach_shared(std::string const & name);
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
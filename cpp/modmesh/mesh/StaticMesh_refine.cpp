@@ -0,0 +1,496 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMesh.hpp>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+/**
+ * Look up the edge of a node pair through the edges grouped by their lower
+ * node.
+ */
+class EdgeLookup
+{
+
+public:
+
+    using int_type = StaticMesh::int_type;
+
+    EdgeLookup(SimpleArray<int_type> const & ednds, size_t nnode)
+        : m_offsets(nnode + 1, 0)
+        , m_uppers(ednds.shape(0))
+        , m_edges(ednds.shape(0))
+    {
+        size_t const nedge = ednds.shape(0);
+        for (size_t ied = 0; ied < nedge; ++ied)
+        {
+            ++m_offsets[std::min(ednds(ied, 0), ednds(ied, 1)) + 1];
+        }
+        std::partial_sum(m_offsets.begin(), m_offsets.end(), m_offsets.begin());
+        std::vector<size_t> cursor(m_offsets.begin(), m_offsets.end() - 1);
+        for (size_t ied = 0; ied < nedge; ++ied)
+        {
+            int_type const lower = std::min(ednds(ied, 0), ednds(ied, 1));
+            size_t const pos = cursor[lower]++;
+            m_uppers[pos] = std::max(ednds(ied, 0), ednds(ied, 1));
+            m_edges[pos] = static_cast<int_type>(ied);
+        }
+    }
+
+    int_type operator()(int_type nd0, int_type nd1) const
+    {
+        int_type const lower = std::min(nd0, nd1);
+        int_type const upper = std::max(nd0, nd1);
+        for (size_t pos = m_offsets[lower]; pos < m_offsets[lower + 1]; ++pos)
+        {
+            if (m_uppers[pos] == upper)
+            {
+                return m_edges[pos];
+            }
+        }
+        throw std::runtime_error(Formatter() << "StaticMesh: no edge between nodes " << nd0 << " and " << nd1);
+    }
+
+private:
+
+    std::vector<size_t> m_offsets;
+    std::vector<int_type> m_uppers;
+    std::vector<int_type> m_edges;
+
+}; /* end class EdgeLookup */
+
+/// Node list of a face with the count in front, in the layout of a fcnds row.
+using RefineFace = std::array<StaticMesh::int_type, StaticMesh::FCMND + 1>;
+
+/**
+ * Node of the refined tensor-product cell or face at a point of the 3^ndim
+ * lattice spanned by its corners.  Each lattice coordinate is 0 or 2 at a
+ * corner and 1 in between, so the number of odd coordinates tells a corner
+ * (0), an edge midpoint (1), a face center (2 in 3D) or the cell center.
+ * The corner of a lattice point is numbered counter-clockwise in the first
+ * two coordinates, followed by the third coordinate.
+ */
+template <typename Corner, typename Middle>
+StaticMesh::int_type lattice_node(std::array<int, 3> const & pnt, size_t ndim, Corner && corner, Middle && middle)
+{
+    // The corners of the entity at the lattice point.
+    std::array<StaticMesh::int_type, 8> nodes{};
+    size_t nnode = 0;
+    size_t const ncorner = size_t(1) << ndim;
+    for (size_t icn = 0; icn < ncorner; ++icn)
+    {
+        std::array<int, 3> const crd{
+            (1 == icn % 4 || 2 == icn % 4) ? 2 : 0,
+            (2 == icn % 4 || 3 == icn % 4) ? 2 : 0,
+            3 == ndim && icn >= 4 ? 2 : 0};
+        bool match = true;
+        for (size_t idm = 0; idm < ndim; ++idm)
+        {
+            match = match && (1 == pnt[idm] || crd[idm] == pnt[idm]);
+        }
+        if (match)
+        {
+            nodes[nnode++] = corner(icn);
+        }
+    }
+    return 1 == nnode ? nodes[0] : middle(nodes.data(), nnode);
+}
+
+/**
+ * Node lists of the 2^ndim children of a tensor-product entity, in the
+ * corner order of the parent.
+ */
+template <typename Node>
+void lattice_children(size_t ndim, Node && node, std::array<std::array<StaticMesh::int_type, 8>, 8> & children)
+{
+    size_t const nchild = size_t(1) << ndim;
+    for (size_t ich = 0; ich < nchild; ++ich)
+    {
+        std::array<int, 3> const base{
+            (1 == ich % 4 || 2 == ich % 4) ? 1 : 0,
+            (2 == ich % 4 || 3 == ich % 4) ? 1 : 0,
+            3 == ndim && ich >= 4 ? 1 : 0};
+        for (size_t icn = 0; icn < nchild; ++icn)
+        {
+            std::array<int, 3> const pnt{
+                base[0] + ((1 == icn % 4 || 2 == icn % 4) ? 1 : 0),
+                base[1] + ((2 == icn % 4 || 3 == icn % 4) ? 1 : 0),
+                base[2] + (3 == ndim && icn >= 4 ? 1 : 0)};
+            children[ich][icn] = node(pnt);
+        }
+    }
+}
+
+/// Children of a simplex by the corner and edge-midpoint indices; -(1+e) denotes the midpoint of the e-th local edge.
+// clang-format off
+constexpr std::array<std::array<int, 3>, 4> REFINE_TRIANGLE{{
+    {0, -1, -3}, {-1, 1, -2}, {-3, -2, 2}, {-1, -2, -3}}};
+constexpr std::array<std::array<int, 2>, 3> TRIANGLE_EDGES{{{0, 1}, {1, 2}, {2, 0}}};
+constexpr std::array<std::array<int, 4>, 8> REFINE_TETRAHEDRON{{
+    {0, -1, -2, -3}, {-1, 1, -4, -5}, {-2, -4, 2, -6}, {-3, -5, -6, 3},
+    {-1, -2, -3, -5}, {-1, -4, -2, -5}, {-2, -3, -5, -6}, {-2, -5, -4, -6}}};
+constexpr std::array<std::array<int, 2>, 6> TETRAHEDRON_EDGES{{{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}}};
+// clang-format on
+
+} /* end namespace detail */
+
+template <typename T>
+void BasicStaticMesh<T>::refine_uniform(size_t levels)
+{
+    if (0 != m_ngstnode || 0 != m_ngstface || 0 != m_ngstcell)
+    {
+        throw std::runtime_error("StaticMesh: refine_uniform must be called before build_ghost");
+    }
+    if (0 != m_ncell && 0 == m_nface)
+    {
+        throw std::runtime_error("StaticMesh: refine_uniform must be called after build_interior");
+    }
+    for (size_t icl = 0; icl < m_ncell; ++icl)
+    {
+        int_type const tpn = m_cltpn(icl);
+        bool const supported = (2 == m_ndim && (CellType::TRIANGLE == tpn || CellType::QUADRILATERAL == tpn)) ||
+                               (3 == m_ndim && (CellType::TETRAHEDRON == tpn || CellType::HEXAHEDRON == tpn));
+        if (!supported)
+        {
+            throw std::invalid_argument(Formatter() << "StaticMesh: refine_uniform does not support cell type "
+                                                    << tpn << " of cell " << icl << " in " << int(m_ndim) << "D");
+        }
+    }
+    for (size_t ilv = 0; ilv < levels; ++ilv)
+    {
+        refine_uniform_once();
+    }
+}
+
+template <typename T>
+/* NOLINTNEXTLINE(readability-function-cognitive-complexity) */
+void BasicStaticMesh<T>::refine_uniform_once()
+{
+    if (0 == nedge() && 0 != m_nface)
+    {
+        build_edge();
+    }
+    size_t const nnode = m_nnode;
+    size_t const nedge = this->nedge();
+    size_t const nface = m_nface;
+    size_t const ncell = m_ncell;
+    size_t const nchild = size_t(1) << m_ndim;
+    detail::EdgeLookup const edge_of(m_ednds, nnode);
+
+    // Number the new nodes: the old nodes, the edge midpoints, the centers of
+    // the quadrilateral faces in 3D, and the centers of the quadrilaterals
+    // and hexahedra.
+    std::vector<int_type> fcmid(nface, -1);
+    std::vector<int_type> clmid(ncell, -1);
+    size_t nnode_new = nnode + nedge;
+    if (3 == m_ndim)
+    {
+        for (size_t ifc = 0; ifc < nface; ++ifc)
+        {
+            if (4 == m_fcnds(ifc, 0))
+            {
+                fcmid[ifc] = static_cast<int_type>(nnode_new++);
+            }
+        }
+    }
+    for (size_t icl = 0; icl < ncell; ++icl)
+    {
+        if (CellType::QUADRILATERAL == m_cltpn(icl) || CellType::HEXAHEDRON == m_cltpn(icl))
+        {
+            clmid[icl] = static_cast<int_type>(nnode_new++);
+        }
+    }
+
+    // Coordinates of the new nodes.
+    SimpleArray<real_type> ndcrd(small_vector<size_t>{nnode_new, m_ndim}, SimpleArrayUninitialized{});
+    std::copy_n(m_ndcrd.body(), nnode * m_ndim, ndcrd.body());
+    auto average = [this, &ndcrd](size_t ind, int_type const * nodes, size_t nnd)
+    {
+        for (size_t idm = 0; idm < m_ndim; ++idm)
+        {
+            real_type crd = 0;
+            for (size_t it = 0; it < nnd; ++it)
+            {
+                crd += m_ndcrd(nodes[it], idm);
+            }
+            ndcrd(ind, idm) = crd / static_cast<real_type>(nnd);
+        }
+    };
+    parallel_for_chunks(
+        nedge,
+        ThreadPool::instance().use_parallel(nedge),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t ied = begin; ied < end; ++ied)
+            {
+                average(nnode + ied, m_ednds.vptr(ied, 0), 2);
+            }
+        });
+    parallel_for_chunks(
+        nface,
+        ThreadPool::instance().use_parallel(nface),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t ifc = begin; ifc < end; ++ifc)
+            {
+                if (fcmid[ifc] >= 0)
+                {
+                    average(fcmid[ifc], m_fcnds.vptr(ifc, 1), m_fcnds(ifc, 0));
+                }
+            }
+        });
+    parallel_for_chunks(
+        ncell,
+        ThreadPool::instance().use_parallel(ncell),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t icl = begin; icl < end; ++icl)
+            {
+                if (clmid[icl] >= 0)
+                {
+                    average(clmid[icl], m_clnds.vptr(icl, 1), m_clnds(icl, 0));
+                }
+            }
+        });
+
+    // Split the cells.  The children of a cell are contiguous and keep its
+    // type and group.
+    SimpleArray<int_type> cltpn(small_vector<size_t>{ncell * nchild});
+    SimpleArray<int_type> clgrp(small_vector<size_t>{ncell * nchild});
+    SimpleArray<int_type> clnds(small_vector<size_t>{ncell * nchild, CLMND + 1}, -1);
+    parallel_for_chunks(
+        ncell,
+        ThreadPool::instance().use_parallel(ncell),
+        [&](size_t begin, size_t end)
+        {
+            std::array<std::array<int_type, 8>, 8> children{};
+            for (size_t icl = begin; icl < end; ++icl)
+            {
+                int_type const tpn = m_cltpn(icl);
+                int_type const * const corners = m_clnds.vptr(icl, 1);
+                size_t nchnd = 0;
+                auto simplex_children = [&](auto const & table, auto const & edges)
+                {
+                    nchnd = table[0].size();
+                    for (size_t ich = 0; ich < table.size(); ++ich)
+                    {
+                        for (size_t icn = 0; icn < nchnd; ++icn)
+                        {
+                            int const loc = table[ich][icn];
+                            children[ich][icn] = loc >= 0
+                                                     ? corners[loc]
+                                                     : static_cast<int_type>(nnode) + edge_of(corners[edges[-loc - 1][0]], corners[edges[-loc - 1][1]]);
+                        }
+                    }
+                };
+                if (CellType::TRIANGLE == tpn)
+                {
+                    simplex_children(detail::REFINE_TRIANGLE, detail::TRIANGLE_EDGES);
+                }
+                else if (CellType::TETRAHEDRON == tpn)
+                {
+                    simplex_children(detail::REFINE_TETRAHEDRON, detail::TETRAHEDRON_EDGES);
+                }
+                else
+                {
+                    nchnd = nchild;
+                    auto middle = [&](int_type const * nodes, size_t nnd) -> int_type
+                    {
+                        if (2 == nnd)
+                        {
+                            return static_cast<int_type>(nnode) + edge_of(nodes[0], nodes[1]);
+                        }
+                        if (nnd == nchild)
+                        {
+                            return clmid[icl];
+                        }
+                        // A quadrilateral face of the hexahedron.
+                        for (int_type ifl = 1; ifl <= m_clfcs(icl, 0); ++ifl)
+                        {
+                            int_type const ifc = m_clfcs(icl, ifl);
+                            int_type const * const fcnds = m_fcnds.vptr(ifc, 1);
+                            if (4 == m_fcnds(ifc, 0) &&
+                                std::all_of(nodes, nodes + nnd, [fcnds](int_type ind)
+                                            { return std::find(fcnds, fcnds + 4, ind) != fcnds + 4; }))
+                            {
+                                return fcmid[ifc];
+                            }
+                        }
+                        throw std::runtime_error(Formatter() << "StaticMesh: cell " << icl << " has no face of its corners");
+                    };
+                    detail::lattice_children(
+                        m_ndim,
+                        [&](std::array<int, 3> const & pnt)
+                        {
+                            return detail::lattice_node(
+                                pnt,
+                                m_ndim,
+                                [corners](size_t icn)
+                                { return corners[icn]; },
+                                middle);
+                        },
+                        children);
+                }
+                for (size_t ich = 0; ich < nchild; ++ich)
+                {
+                    size_t const jcl = icl * nchild + ich;
+                    cltpn(jcl) = tpn;
+                    clgrp(jcl) = m_clgrp(icl);
+                    clnds(jcl, 0) = static_cast<int_type>(nchnd);
+                    std::copy_n(children[ich].data(), nchnd, clnds.vptr(jcl, 1));
+                }
+            }
+        });
+
+    // Children of the faces listed by the boundary conditions, as node lists
+    // to be matched against the rebuilt faces.
+    auto face_children = [&](int_type ifc, std::vector<detail::RefineFace> & out)
+    {
+        int_type const * const nodes = m_fcnds.vptr(ifc, 1);
+        int_type const nfcnd = m_fcnds(ifc, 0);
+        auto mid = [&](int_type nd0, int_type nd1)
+        { return static_cast<int_type>(nnode) + edge_of(nd0, nd1); };
+        if (2 == nfcnd)
+        {
+            int_type const md = mid(nodes[0], nodes[1]);
+            out.push_back({2, nodes[0], md, -1, -1});
+            out.push_back({2, md, nodes[1], -1, -1});
+        }
+        else if (3 == nfcnd)
+        {
+            for (auto const & child : detail::REFINE_TRIANGLE)
+            {
+                detail::RefineFace face{3, -1, -1, -1, -1};
+                for (size_t it = 0; it < 3; ++it)
+                {
+                    int const loc = child[it];
+                    if (loc >= 0)
+                    {
+                        face[it + 1] = nodes[loc];
+                    }
+                    else
+                    {
+                        auto const & edge = detail::TRIANGLE_EDGES[-loc - 1];
+                        face[it + 1] = mid(nodes[edge[0]], nodes[edge[1]]);
+                    }
+                }
+                out.push_back(face);
+            }
+        }
+        else
+        {
+            std::array<std::array<int_type, 8>, 8> children{};
+            detail::lattice_children(
+                2,
+                [&](std::array<int, 3> const & pnt)
+                {
+                    return detail::lattice_node(
+                        pnt,
+                        2,
+                        [nodes](size_t icn)
+                        { return nodes[icn]; },
+                        [&](int_type const * mnodes, size_t nnd)
+                        { return 2 == nnd ? mid(mnodes[0], mnodes[1]) : fcmid[ifc]; });
+                },
+                children);
+            for (size_t ich = 0; ich < 4; ++ich)
+            {
+                out.push_back({4, children[ich][0], children[ich][1], children[ich][2], children[ich][3]});
+            }
+        }
+    };
+    std::vector<std::vector<detail::RefineFace>> bcfaces(m_bcs.size());
+    for (size_t ibc = 0; ibc < m_bcs.size(); ++ibc)
+    {
+        SimpleArray<int_type> const & facn = m_bcs[ibc].facn();
+        for (size_t bfit = 0; bfit < facn.nbody(); ++bfit)
+        {
+            face_children(facn(bfit, 0), bcfaces[ibc]);
+        }
+    }
+
+    // Replace the cells and rebuild the interior.
+    bool const had_boundary = 0 != m_nbound;
+    m_nnode = static_cast<uint_type>(nnode_new);
+    m_ncell = static_cast<uint_type>(ncell * nchild);
+    m_ndcrd = std::move(ndcrd);
+    m_cltpn = std::move(cltpn);
+    m_clgrp = std::move(clgrp);
+    m_clnds = std::move(clnds);
+    m_clfcs.remake(small_vector<size_t>{m_ncell, CLMFC + 1}, -1);
+    m_clcnd.remake(small_vector<size_t>{m_ncell, m_ndim}, 0);
+    m_clvol.remake(small_vector<size_t>{m_ncell}, 0);
+    m_ednds.remake(small_vector<size_t>{0, 2});
+    m_nbound = 0;
+    m_bndfcs.remake(small_vector<size_t>{0, StaticMeshBC::BFREL});
+    build_interior(/* do_metric */ true, /* do_edge */ true);
+
+    // Map the boundary conditions to the child faces.
+    StaticMeshAdjacency const & nfcs = node_faces();
+    auto find_face = [&](detail::RefineFace const & face)
+    {
+        for (int32_t const ifc : nfcs.row(face[1]))
+        {
+            int_type const * const fcnds = m_fcnds.vptr(ifc, 1);
+            if (m_fcnds(ifc, 0) == face[0] &&
+                std::all_of(face.data() + 1, face.data() + 1 + face[0], [&](int_type ind)
+                            { return std::find(fcnds, fcnds + face[0], ind) != fcnds + face[0]; }))
+            {
+                return static_cast<int_type>(ifc);
+            }
+        }
+        throw std::runtime_error("StaticMesh: refine_uniform lost a boundary face");
+    };
+    for (size_t ibc = 0; ibc < m_bcs.size(); ++ibc)
+    {
+        std::vector<detail::RefineFace> const & faces = bcfaces[ibc];
+        SimpleArray<int_type> facn(small_vector<size_t>{faces.size(), StaticMeshBC::BFREL}, -1);
+        for (size_t bfit = 0; bfit < faces.size(); ++bfit)
+        {
+            facn(bfit, 0) = find_face(faces[bfit]);
+        }
+        m_bcs[ibc].facn() = std::move(facn);
+    }
+    if (had_boundary)
+    {
+        build_boundary();
+    }
+}
+
+template void BasicStaticMesh<float>::refine_uniform(size_t levels);
+template void BasicStaticMesh<float>::refine_uniform_once();
+template void BasicStaticMesh<double>::refine_uniform(size_t levels);
+template void BasicStaticMesh<double>::refine_uniform_once();
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,441 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/StaticMesh.hpp>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+/**
+ * Convert the coordinates of a point on a 2^nbit grid in place to the
+ * transposed Hilbert index (J. Skilling, "Programming the Hilbert curve",
+ * AIP Conf. Proc. 707, 2004).
+ */
+inline void hilbert_axes_to_transpose(std::array<uint32_t, 3> & x, size_t nbit, size_t ndim)
+{
+    uint32_t const m = uint32_t(1) << (nbit - 1);
+    // Inverse undo.
+    for (uint32_t q = m; q > 1; q >>= 1)
+    {
+        uint32_t const p = q - 1;
+        for (size_t it = 0; it < ndim; ++it)
+        {
+            if (x[it] & q)
+            {
+                x[0] ^= p;
+            }
+            else
+            {
+                uint32_t const t = (x[0] ^ x[it]) & p;
+                x[0] ^= t;
+                x[it] ^= t;
+            }
+        }
+    }
+    // Gray encode.
+    for (size_t it = 1; it < ndim; ++it)
+    {
+        x[it] ^= x[it - 1];
+    }
+    uint32_t t = 0;
+    for (uint32_t q = m; q > 1; q >>= 1)
+    {
+        if (x[ndim - 1] & q)
+        {
+            t ^= q - 1;
+        }
+    }
+    for (size_t it = 0; it < ndim; ++it)
+    {
+        x[it] ^= t;
+    }
+}
+
+/// Interleave the bits of the coordinates from the most significant one.
+inline uint64_t interleave_bits(std::array<uint32_t, 3> const & x, size_t nbit, size_t ndim)
+{
+    uint64_t key = 0;
+    for (size_t ibit = nbit; ibit-- > 0;)
+    {
+        for (size_t it = 0; it < ndim; ++it)
+        {
+            key = (key << 1) | ((x[it] >> ibit) & 1);
+        }
+    }
+    return key;
+}
+
+/// Keep the body of the array and drop its ghost rows.
+template <typename T>
+void drop_ghost(SimpleArray<T> & arr)
+{
+    if (0 == arr.nghost())
+    {
+        return;
+    }
+    small_vector<size_t> shape = arr.shape();
+    shape[0] = arr.nbody();
+    SimpleArray<T> ret(shape, SimpleArrayUninitialized{});
+    std::copy_n(arr.body(), ret.size(), ret.data());
+    arr.swap(ret);
+}
+
+/// Permute the rows of the array by perm, which maps the new row to the old one.
+template <typename T>
+void permute_rows(SimpleArray<T> & arr, std::vector<int32_t> const & perm)
+{
+    size_t const width = arr.stride(0);
+    SimpleArray<T> ret(arr.shape(), SimpleArrayUninitialized{});
+    T const * src = arr.body();
+    T * dst = ret.body();
+    for (size_t it = 0; it < perm.size(); ++it)
+    {
+        std::copy_n(src + static_cast<size_t>(perm[it]) * width, width, dst + it * width);
+    }
+    arr.swap(ret);
+}
+
+/**
+ * Renumber the non-negative entries of the columns [begin, end) of each row
+ * by the inverse permutation, which maps the old index to the new one.
+ */
+inline void renumber_columns(SimpleArray<int32_t> & arr, size_t begin, size_t end, std::vector<int32_t> const & inverse)
+{
+    if (0 == arr.size())
+    {
+        return;
+    }
+    for (SimpleArraySpan<int32_t> row : arr.body_rows())
+    {
+        for (size_t it = begin; it < end; ++it)
+        {
+            if (row[it] >= 0)
+            {
+                row[it] = inverse[static_cast<size_t>(row[it])];
+            }
+        }
+    }
+}
+
+/// Renumber the node or face list of each row, of which column 0 is the count.
+inline void renumber_lists(SimpleArray<int32_t> & arr, std::vector<int32_t> const & inverse)
+{
+    for (SimpleArraySpan<int32_t> row : arr.body_rows())
+    {
+        for (int32_t it = 1; it <= row[0]; ++it)
+        {
+            row[static_cast<size_t>(it)] = inverse[static_cast<size_t>(row[static_cast<size_t>(it)])];
+        }
+    }
+}
+
+inline std::vector<int32_t> invert_permutation(std::vector<int32_t> const & perm)
+{
+    std::vector<int32_t> ret(perm.size());
+    for (size_t it = 0; it < perm.size(); ++it)
+    {
+        ret[static_cast<size_t>(perm[it])] = static_cast<int32_t>(it);
+    }
+    return ret;
+}
+
+/**
+ * Order the entities in the order the rows of lists first reference them,
+ * and append the unreferenced ones in their original order.
+ */
+inline std::vector<int32_t> order_by_first_reference(SimpleArray<int32_t> const & lists, std::vector<int32_t> const & rows, size_t count)
+{
+    std::vector<int32_t> ret;
+    ret.reserve(count);
+    std::vector<bool> seen(count, false);
+    for (int32_t const irow : rows)
+    {
+        int32_t const * list = lists.vptr(irow, 0);
+        for (int32_t it = 1; it <= list[0]; ++it)
+        {
+            auto const ient = static_cast<size_t>(list[it]);
+            if (!seen[ient])
+            {
+                seen[ient] = true;
+                ret.push_back(static_cast<int32_t>(ient));
+            }
+        }
+    }
+    for (size_t ient = 0; ient < count; ++ient)
+    {
+        if (!seen[ient])
+        {
+            ret.push_back(static_cast<int32_t>(ient));
+        }
+    }
+    return ret;
+}
+
+} /* end namespace detail */
+
+template <typename T>
+typename BasicStaticMesh<T>::ReorderMethod BasicStaticMesh<T>::reorder_method_from_string(std::string const & value)
+{
+    if ("rcm" == value)
+    {
+        return ReorderMethod::ReverseCuthillMcKee;
+    }
+    if ("hilbert" == value)
+    {
+        return ReorderMethod::Hilbert;
+    }
+    if ("morton" == value)
+    {
+        return ReorderMethod::Morton;
+    }
+    throw std::invalid_argument(Formatter() << "StaticMesh: unknown reorder method \"" << value
+                                            << "\"; use \"rcm\", \"hilbert\" or \"morton\"");
+}
+
+template <typename T>
+char const * BasicStaticMesh<T>::to_string(ReorderMethod method)
+{
+    switch (method)
+    {
+    case ReorderMethod::ReverseCuthillMcKee: return "rcm"; break;
+    case ReorderMethod::Hilbert: return "hilbert"; break;
+    case ReorderMethod::Morton: return "morton"; break;
+    default: return "unknown"; break;
+    }
+}
+
+template <typename T>
+/* NOLINTNEXTLINE(readability-function-cognitive-complexity) */
+StaticMeshPermutation BasicStaticMesh<T>::reorder(ReorderMethod method)
+{
+    if (0 != m_ncell && 0 == m_nface)
+    {
+        throw std::runtime_error("StaticMesh: reorder must be called after build_interior");
+    }
+    clear_adjacency();
+
+    // The ghost entities are numbered by the boundary faces, so the ghost
+    // layer is dropped here and rebuilt over the renumbered interior.  The
+    // boundary faces keep their (negative) ghost cells in fccls until then.
+    bool const had_ghost = 0 != m_ngstnode || 0 != m_ngstface || 0 != m_ngstcell;
+    if (had_ghost)
+    {
+        detail::drop_ghost(m_ndcrd);
+        detail::drop_ghost(m_fccnd);
+        detail::drop_ghost(m_fcnml);
+        detail::drop_ghost(m_fcara);
+        detail::drop_ghost(m_clcnd);
+        detail::drop_ghost(m_clvol);
+        detail::drop_ghost(m_fctpn);
+        detail::drop_ghost(m_cltpn);
+        detail::drop_ghost(m_clgrp);
+        detail::drop_ghost(m_fcnds);
+        detail::drop_ghost(m_fccls);
+        detail::drop_ghost(m_clnds);
+        detail::drop_ghost(m_clfcs);
+        m_ngstnode = 0;
+        m_ngstface = 0;
+        m_ngstcell = 0;
+    }
+
+    // Order the cells.
+    std::vector<int_type> clperm;
+    clperm.reserve(m_ncell);
+    if (ReorderMethod::ReverseCuthillMcKee == method)
+    {
+        // Neighbors through the interior faces.
+        auto neighbor = [this](int_type icl, int_type ifc)
+        {
+            int_type const jcl = m_fccls(ifc, 0) == icl ? m_fccls(ifc, 1) : m_fccls(ifc, 0);
+            return jcl >= 0 && jcl < static_cast<int_type>(m_ncell) && jcl != icl ? jcl : int_type(-1);
+        };
+        std::vector<int_type> degree(m_ncell, 0);
+        for (size_t icl = 0; icl < m_ncell; ++icl)
+        {
+            for (int_type ifl = 1; ifl <= m_clfcs(icl, 0); ++ifl)
+            {
+                degree[icl] += neighbor(static_cast<int_type>(icl), m_clfcs(icl, ifl)) >= 0 ? 1 : 0;
+            }
+        }
+        // Start each connected component from a cell of the lowest degree,
+        // and visit the neighbors in ascending degree.  Ties break by index,
+        // so the ordering is deterministic.
+        std::vector<int_type> seeds(m_ncell);
+        std::iota(seeds.begin(), seeds.end(), 0);
+        std::stable_sort(seeds.begin(), seeds.end(), [&degree](int_type lhs, int_type rhs)
+                         { return degree[lhs] < degree[rhs]; });
+        std::vector<bool> visited(m_ncell, false);
+        std::vector<int_type> neighbors;
+        for (int_type const seed : seeds)
+        {
+            if (visited[seed])
+            {
+                continue;
+            }
+            visited[seed] = true;
+            size_t head = clperm.size();
+            clperm.push_back(seed);
+            while (head < clperm.size())
+            {
+                int_type const icl = clperm[head++];
+                neighbors.clear();
+                for (int_type ifl = 1; ifl <= m_clfcs(icl, 0); ++ifl)
+                {
+                    int_type const jcl = neighbor(icl, m_clfcs(icl, ifl));
+                    if (jcl >= 0 && !visited[jcl])
+                    {
+                        visited[jcl] = true;
+                        neighbors.push_back(jcl);
+                    }
+                }
+                std::stable_sort(neighbors.begin(), neighbors.end(), [&degree](int_type lhs, int_type rhs)
+                                 { return degree[lhs] != degree[rhs] ? degree[lhs] < degree[rhs] : lhs < rhs; });
+                clperm.insert(clperm.end(), neighbors.begin(), neighbors.end());
+            }
+        }
+        std::reverse(clperm.begin(), clperm.end());
+    }
+    else
+    {
+        // Quantize the averaged node coordinates of the cells onto a grid
+        // fine enough for the 64-bit curve index.
+        size_t const ndim = std::min<size_t>(m_ndim, 3);
+        size_t const nbit = 0 == ndim ? 1 : std::min<size_t>(32, 64 / ndim);
+        std::vector<real_type> crd(m_ncell * ndim, 0.0);
+        std::array<real_type, 3> lower{0.0, 0.0, 0.0};
+        std::array<real_type, 3> upper{0.0, 0.0, 0.0};
+        for (size_t icl = 0; icl < m_ncell; ++icl)
+        {
+            int_type const nnd = m_clnds(icl, 0);
+            for (size_t idm = 0; idm < ndim; ++idm)
+            {
+                real_type value = 0.0;
+                for (int_type inl = 1; inl <= nnd; ++inl)
+                {
+                    value += m_ndcrd(m_clnds(icl, inl), idm);
+                }
+                value /= nnd > 0 ? nnd : 1;
+                crd[icl * ndim + idm] = value;
+                lower[idm] = 0 == icl ? value : std::min(lower[idm], value);
+                upper[idm] = 0 == icl ? value : std::max(upper[idm], value);
+            }
+        }
+        real_type const ngrid = static_cast<real_type>((uint64_t(1) << nbit) - 1);
+        std::vector<uint64_t> keys(m_ncell);
+        for (size_t icl = 0; icl < m_ncell; ++icl)
+        {
+            std::array<uint32_t, 3> x{0, 0, 0};
+            for (size_t idm = 0; idm < ndim; ++idm)
+            {
+                real_type const extent = upper[idm] - lower[idm];
+                if (extent > 0.0)
+                {
+                    x[idm] = static_cast<uint32_t>((crd[icl * ndim + idm] - lower[idm]) / extent * ngrid);
+                }
+            }
+            if (ReorderMethod::Hilbert == method && ndim > 1)
+            {
+                detail::hilbert_axes_to_transpose(x, nbit, ndim);
+            }
+            keys[icl] = detail::interleave_bits(x, nbit, ndim);
+        }
+        // The stable sort keeps cells of the same key in their original order.
+        clperm.resize(m_ncell);
+        parallel_argsort(keys.data(), keys.size(), clperm.data(), ThreadPool::instance().use_parallel(keys.size()));
+    }
+
+    // Order the faces and nodes as the renumbered cells first reference them.
+    std::vector<int_type> const fcperm = detail::order_by_first_reference(m_clfcs, clperm, m_nface);
+    std::vector<int_type> const ndperm = detail::order_by_first_reference(m_clnds, clperm, m_nnode);
+    std::vector<int_type> const clinv = detail::invert_permutation(clperm);
+    std::vector<int_type> const fcinv = detail::invert_permutation(fcperm);
+    std::vector<int_type> const ndinv = detail::invert_permutation(ndperm);
+
+    // Node arrays.
+    detail::permute_rows(m_ndcrd, ndperm);
+    // Face arrays.
+    detail::permute_rows(m_fccnd, fcperm);
+    detail::permute_rows(m_fcnml, fcperm);
+    detail::permute_rows(m_fcara, fcperm);
+    detail::permute_rows(m_fctpn, fcperm);
+    detail::permute_rows(m_fcnds, fcperm);
+    detail::renumber_lists(m_fcnds, ndinv);
+    detail::permute_rows(m_fccls, fcperm);
+    detail::renumber_columns(m_fccls, 0, 2, clinv);
+    // Cell arrays.
+    detail::permute_rows(m_clcnd, clperm);
+    detail::permute_rows(m_clvol, clperm);
+    detail::permute_rows(m_cltpn, clperm);
+    detail::permute_rows(m_clgrp, clperm);
+    detail::permute_rows(m_clnds, clperm);
+    detail::renumber_lists(m_clnds, ndinv);
+    detail::permute_rows(m_clfcs, clperm);
+    detail::renumber_lists(m_clfcs, fcinv);
+    // Boundary arrays keep their order and refer to the renumbered faces.
+    detail::renumber_columns(m_bndfcs, 0, 1, fcinv);
+    for (StaticMeshBC & bc : m_bcs)
+    {
+        detail::renumber_columns(bc.facn(), 0, 1, fcinv);
+    }
+    // Edges follow the new face order.
+    if (0 != m_ednds.shape(0))
+    {
+        build_edge();
+    }
+    if (had_ghost)
+    {
+        // build_ghost() also refills the SoA copies.
+        build_ghost();
+    }
+    else if (m_soa)
+    {
+        sync_soa();
+    }
+
+    auto to_array = [](std::vector<int_type> const & perm)
+    {
+        SimpleArray<int32_t> ret(perm.size());
+        std::copy(perm.begin(), perm.end(), ret.begin());
+        return ret;
+    };
+    return StaticMeshPermutation{to_array(ndperm), to_array(fcperm), to_array(clperm)};
+}
+
+template BasicStaticMesh<float>::ReorderMethod BasicStaticMesh<float>::reorder_method_from_string(std::string const & value);
+template char const * BasicStaticMesh<float>::to_string(ReorderMethod method);
+template StaticMeshPermutation BasicStaticMesh<float>::reorder(ReorderMethod method);
+template BasicStaticMesh<double>::ReorderMethod BasicStaticMesh<double>::reorder_method_from_string(std::string const & value);
+template char const * BasicStaticMesh<double>::to_string(ReorderMethod method);
+template StaticMeshPermutation BasicStaticMesh<double>::reorder(ReorderMethod method);
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
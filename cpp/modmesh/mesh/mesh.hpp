@@ -33,5 +33,15 @@
  */
 
 #include <modmesh/mesh/StaticMesh.hpp>
+#include <modmesh/mesh/StaticMeshBVH.hpp>
+#include <modmesh/mesh/StaticMeshFaceLoop.hpp>
+#include <modmesh/mesh/StaticMeshGenerator.hpp>
+#include <modmesh/mesh/StaticMeshLod.hpp>
+#include <modmesh/mesh/StaticMeshPartition.hpp>
+#include <modmesh/mesh/StaticMeshQuality.hpp>
+#include <modmesh/mesh/SparseMatrix.hpp>
+#ifdef MODMESH_MPI
+#include <modmesh/mesh/HaloExchange.hpp>
+#endif // MODMESH_MPI
 
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
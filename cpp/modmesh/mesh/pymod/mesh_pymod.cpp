@@ -49,6 +49,9 @@ void initialize_mesh(pybind11::module & mod)
     {
         wrap_StaticGrid(mod);
         wrap_StaticMesh(mod);
+        wrap_StaticMeshPartition(mod);
+        wrap_StaticMeshMetal(mod);
+        wrap_SparseMatrix(mod);
     };
 
     OneTimeInitializer<mesh_pymod_tag>::me()(mod, initialize_impl);
@@ -43,6 +43,9 @@ namespace python
 void initialize_mesh(pybind11::module & mod);
 void wrap_StaticGrid(pybind11::module & mod);
 void wrap_StaticMesh(pybind11::module & mod);
+void wrap_StaticMeshPartition(pybind11::module & mod);
+void wrap_StaticMeshMetal(pybind11::module & mod);
+void wrap_SparseMatrix(pybind11::module & mod);
 
 } /* end namespace python */
 
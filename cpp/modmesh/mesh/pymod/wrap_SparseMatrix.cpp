@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/pymod/mesh_pymod.hpp> // Must be the first include.
+
+namespace modmesh
+{
+
+namespace python
+{
+
+template <typename T>
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapSparseMatrix
+    : public WrapBase<WrapSparseMatrix<T>, SparseMatrix<T>>
+{
+
+public:
+
+    using base_type = WrapBase<WrapSparseMatrix<T>, SparseMatrix<T>>;
+    using wrapped_type = typename base_type::wrapped_type;
+    using index_type = typename wrapped_type::index_type;
+
+    friend base_type;
+
+protected:
+
+    WrapSparseMatrix(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(
+                py::init(
+                    [](size_t ncol, SimpleArray<index_type> const & offsets, SimpleArray<index_type> const & indices)
+                    { return std::make_unique<wrapped_type>(ncol, offsets, indices); }),
+                py::arg("ncol"),
+                py::arg("offsets"),
+                py::arg("indices"))
+            .def_static(
+                "from_cell_cells",
+                [](BasicStaticMesh<T> const & mesh)
+                {
+                    py::gil_scoped_release const release;
+                    return wrapped_type::from_cell_cells(mesh);
+                },
+                py::arg("mesh"))
+            .def_static(
+                "from_node_nodes",
+                [](BasicStaticMesh<T> const & mesh)
+                {
+                    py::gil_scoped_release const release;
+                    return wrapped_type::from_node_nodes(mesh);
+                },
+                py::arg("mesh"))
+            .def_property_readonly("nrow", &wrapped_type::nrow)
+            .def_property_readonly("ncol", &wrapped_type::ncol)
+            .def_property_readonly("nnz", &wrapped_type::nnz)
+            .def_property_readonly(
+                "offsets",
+                [](wrapped_type const & self) -> decltype(auto)
+                { return self.offsets(); },
+                py::return_value_policy::reference_internal)
+            .def_property_readonly(
+                "indices",
+                [](wrapped_type const & self) -> decltype(auto)
+                { return self.indices(); },
+                py::return_value_policy::reference_internal)
+            .def_property_readonly(
+                "values",
+                [](wrapped_type & self) -> SimpleArray<T> &
+                { return self.values(); },
+                py::return_value_policy::reference_internal)
+            .def("zero", &wrapped_type::zero)
+            .def("find", &wrapped_type::find, py::arg("row"), py::arg("col"))
+            .def(
+                "add",
+                py::overload_cast<size_t, size_t, T>(&wrapped_type::add),
+                py::arg("row"),
+                py::arg("col"),
+                py::arg("value"))
+            .def(
+                "add",
+                py::overload_cast<SimpleArray<index_type> const &, SimpleArray<index_type> const &, SimpleArray<T> const &>(&wrapped_type::add),
+                py::arg("rows"),
+                py::arg("cols"),
+                py::arg("values"))
+            .def(
+                "multiply",
+                [](wrapped_type const & self, SimpleArray<T> const & x)
+                {
+                    py::gil_scoped_release const release;
+                    return self.multiply(x);
+                },
+                py::arg("x"))
+            .def(
+                "multiply",
+                [](wrapped_type const & self, SimpleArray<T> const & x, SimpleArray<T> & y)
+                {
+                    py::gil_scoped_release const release;
+                    self.multiply(x, y);
+                },
+                py::arg("x"),
+                py::arg("y"))
+            .def(
+                "to_scipy",
+                [](wrapped_type & self)
+                {
+                    // The arrays are shared with the matrix of SciPy, which keeps their buffers alive.  The
+                    // pattern is not to be changed through SciPy.
+                    auto & indices = const_cast<SimpleArray<index_type> &>(self.indices()); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                    auto & offsets = const_cast<SimpleArray<index_type> &>(self.offsets()); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                    py::module_ const sparse = py::module_::import("scipy.sparse");
+                    return sparse.attr("csr_matrix")(
+                        py::make_tuple(to_ndarray(self.values()), to_ndarray(indices), to_ndarray(offsets)),
+                        py::arg("shape") = py::make_tuple(self.nrow(), self.ncol()),
+                        py::arg("copy") = false);
+                })
+            //
+            ;
+    }
+
+}; /* end class WrapSparseMatrix */
+
+void wrap_SparseMatrix(pybind11::module & mod)
+{
+    WrapSparseMatrix<double>::commit(mod, "SparseMatrixFloat64", "CSR sparse matrix of float64");
+    WrapSparseMatrix<float>::commit(mod, "SparseMatrixFloat32", "CSR sparse matrix of float32");
+}
+
+} /* end namespace python */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -116,37 +116,186 @@ WrapStaticGrid1d::WrapStaticGrid1d(pybind11::module & mod, char const * pyname,
             [](wrapped_type & self) -> decltype(auto)
             { return self.coord(); })
         .def_timed("fill", &wrapped_type::fill, py::arg("value"))
+        .def_timed(
+            "locate",
+            [](wrapped_type const & self, SimpleArray<real_type> const & points)
+            {
+                py::gil_scoped_release const release;
+                return self.locate(points);
+            },
+            py::arg("points"))
         //
         ;
 }
 
-// clang-format off
-#define MM_DECL_StaticGridMD(NDIM) \
-class \
-MODMESH_PYTHON_WRAPPER_VISIBILITY \
-WrapStaticGrid ## NDIM ## d \
-  : public WrapStaticGridBase< WrapStaticGrid ## NDIM ## d, StaticGrid ## NDIM ## d > \
-{ \
-\
-public: \
-\
-      friend root_base_type; \
-\
-    using base_type = WrapStaticGridBase< WrapStaticGrid ## NDIM ## d, StaticGrid ## NDIM ## d >; \
-\
-protected: \
-\
-    explicit WrapStaticGrid ## NDIM ## d(pybind11::module & mod, char const * pyname, char const * pydoc) \
-      : base_type(mod, pyname, pydoc) \
-    {} \
-\
+template <typename Wrapper, typename GT>
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapStaticGridMd
+    : public WrapStaticGridBase<Wrapper, GT>
+{
+
+public:
+
+    using base_type = WrapStaticGridBase<Wrapper, GT>;
+    using wrapped_type = typename base_type::wrapped_type;
+    using value_type = typename wrapped_type::value_type;
+
+    friend typename base_type::root_base_type;
+
+protected:
+
+    WrapStaticGridMd(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11; // NOLINT(misc-unused-alias-decls)
+
+        (*this)
+            .def(
+                "__len__",
+                [](wrapped_type const & self)
+                { return self.size(); })
+            .def_property_readonly(
+                "shape",
+                [](wrapped_type const & self)
+                { return self.shape(); })
+            .def_property_readonly(
+                "blocked",
+                [](wrapped_type const & self)
+                { return StaticGridLayout::Blocked == self.layout(); })
+            .expose_SimpleArray(
+                "x",
+                [](wrapped_type & self) -> decltype(auto)
+                { return self.coord(0); })
+            .expose_SimpleArray(
+                "y",
+                [](wrapped_type & self) -> decltype(auto)
+                { return self.coord(1); })
+            .expose_SimpleArray(
+                "values",
+                [](wrapped_type & self) -> decltype(auto)
+                { return self.values(); })
+            .def_timed("fill", &wrapped_type::fill, py::arg("value"))
+            .def_timed(
+                "copy_values",
+                [](wrapped_type & self, wrapped_type const & other)
+                { self.copy_values(other); },
+                py::arg("other"))
+            //
+            ;
+    }
+
+    static StaticGridLayout to_layout(bool blocked)
+    {
+        return blocked ? StaticGridLayout::Blocked : StaticGridLayout::RowMajor;
+    }
+
+}; /* end class WrapStaticGridMd */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapStaticGrid2d
+    : public WrapStaticGridMd<WrapStaticGrid2d, StaticGrid2d>
+{
+
+public:
+
+    friend root_base_type;
+
+    using base_type = WrapStaticGridMd<WrapStaticGrid2d, StaticGrid2d>;
+
+protected:
+
+    WrapStaticGrid2d(pybind11::module & mod, char const * pyname, char const * pydoc);
+
+}; /* end class WrapStaticGrid2d */
+
+WrapStaticGrid2d::WrapStaticGrid2d(pybind11::module & mod, char const * pyname, char const * pydoc)
+    : base_type(mod, pyname, pydoc)
+{
+    namespace py = pybind11;
+
+    (*this)
+        .def_timed(
+            py::init(
+                [](size_t nx, size_t ny, bool blocked)
+                { return std::make_unique<StaticGrid2d>(nx, ny, to_layout(blocked)); }),
+            py::arg("nx"),
+            py::arg("ny"),
+            py::arg("blocked") = false)
+        .def(
+            "__getitem__",
+            [](wrapped_type const & self, std::tuple<size_t, size_t> const & it)
+            { return self.at(std::get<0>(it), std::get<1>(it)); })
+        .def(
+            "__setitem__",
+            [](wrapped_type & self, std::tuple<size_t, size_t> const & it, value_type val)
+            { self.at(std::get<0>(it), std::get<1>(it)) = val; })
+        .def_property_readonly(
+            "nx",
+            [](wrapped_type const & self)
+            { return self.nx(); })
+        .def_property_readonly(
+            "ny",
+            [](wrapped_type const & self)
+            { return self.ny(); })
+        //
+        ;
 }
-// clang-format on
 
-MM_DECL_StaticGridMD(2);
-MM_DECL_StaticGridMD(3);
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapStaticGrid3d
+    : public WrapStaticGridMd<WrapStaticGrid3d, StaticGrid3d>
+{
+
+public:
+
+    friend root_base_type;
+
+    using base_type = WrapStaticGridMd<WrapStaticGrid3d, StaticGrid3d>;
+
+protected:
+
+    WrapStaticGrid3d(pybind11::module & mod, char const * pyname, char const * pydoc);
+
+}; /* end class WrapStaticGrid3d */
+
+WrapStaticGrid3d::WrapStaticGrid3d(pybind11::module & mod, char const * pyname, char const * pydoc)
+    : base_type(mod, pyname, pydoc)
+{
+    namespace py = pybind11;
 
-#undef MM_DECL_StaticGridMD
+    (*this)
+        .def_timed(
+            py::init(
+                [](size_t nx, size_t ny, size_t nz, bool blocked)
+                { return std::make_unique<StaticGrid3d>(nx, ny, nz, to_layout(blocked)); }),
+            py::arg("nx"),
+            py::arg("ny"),
+            py::arg("nz"),
+            py::arg("blocked") = false)
+        .def(
+            "__getitem__",
+            [](wrapped_type const & self, std::tuple<size_t, size_t, size_t> const & it)
+            { return self.at(std::get<0>(it), std::get<1>(it), std::get<2>(it)); })
+        .def(
+            "__setitem__",
+            [](wrapped_type & self, std::tuple<size_t, size_t, size_t> const & it, value_type val)
+            { self.at(std::get<0>(it), std::get<1>(it), std::get<2>(it)) = val; })
+        .def_property_readonly(
+            "nx",
+            [](wrapped_type const & self)
+            { return self.nx(); })
+        .def_property_readonly(
+            "ny",
+            [](wrapped_type const & self)
+            { return self.ny(); })
+        .def_property_readonly(
+            "nz",
+            [](wrapped_type const & self)
+            { return self.nz(); })
+        .expose_SimpleArray(
+            "z",
+            [](wrapped_type & self) -> decltype(auto)
+            { return self.coord(2); })
+        //
+        ;
+}
 
 void wrap_StaticGrid(pybind11::module & mod)
 {
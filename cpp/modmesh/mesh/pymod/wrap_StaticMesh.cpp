@@ -35,16 +35,17 @@ namespace modmesh
 namespace python
 {
 
+template <typename T>
 class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapStaticMesh
-    : public WrapBase<WrapStaticMesh, StaticMesh, std::shared_ptr<StaticMesh>>
+    : public WrapBase<WrapStaticMesh<T>, BasicStaticMesh<T>, std::shared_ptr<BasicStaticMesh<T>>>
 {
 
 public:
 
-    using base_type = WrapBase<WrapStaticMesh, StaticMesh, std::shared_ptr<StaticMesh>>;
+    using base_type = WrapBase<WrapStaticMesh<T>, BasicStaticMesh<T>, std::shared_ptr<BasicStaticMesh<T>>>;
     using wrapped_type = typename base_type::wrapped_type;
 
-    friend root_base_type;
+    friend base_type;
 
 protected:
 
@@ -52,7 +53,8 @@ protected:
 
 }; /* end class WrapStaticMesh */
 
-WrapStaticMesh::WrapStaticMesh(pybind11::module & mod, char const * pyname, char const * pydoc)
+template <typename T>
+WrapStaticMesh<T>::WrapStaticMesh(pybind11::module & mod, char const * pyname, char const * pydoc)
     : base_type(mod, pyname, pydoc)
 {
     namespace py = pybind11;
@@ -99,10 +101,74 @@ WrapStaticMesh::WrapStaticMesh(pybind11::module & mod, char const * pyname, char
         .def_property_readonly("nbcs", &wrapped_type::nbcs);
 
     (*this)
-        .def_timed("build_interior", &wrapped_type::build_interior, py::arg("_do_metric") = true, py::arg("_build_edge") = true)
-        .def_timed("build_boundary", &wrapped_type::build_boundary)
-        .def_timed("build_ghost", &wrapped_type::build_ghost)
-        .def_timed("build_edge", &wrapped_type::build_edge);
+        .def_timed("build_interior", &wrapped_type::build_interior, py::arg("_do_metric") = true, py::arg("_build_edge") = true, py::call_guard<py::gil_scoped_release>())
+        .def_timed("build_boundary", &wrapped_type::build_boundary, py::call_guard<py::gil_scoped_release>())
+        .def_timed("build_ghost", &wrapped_type::build_ghost, py::call_guard<py::gil_scoped_release>())
+        .def_timed("build_edge", &wrapped_type::build_edge, py::call_guard<py::gil_scoped_release>())
+        .def_timed("update_metric", &wrapped_type::update_metric, py::arg("changed_nodes"), py::call_guard<py::gil_scoped_release>())
+        .def_timed("refine_uniform", &wrapped_type::refine_uniform, py::arg("levels") = 1, py::call_guard<py::gil_scoped_release>())
+        .def_timed(
+            "reorder",
+            [](wrapped_type & self, std::string const & method)
+            {
+                auto const reorder_method = wrapped_type::reorder_method_from_string(method);
+                StaticMeshPermutation perm;
+                {
+                    py::gil_scoped_release const release;
+                    perm = self.reorder(reorder_method);
+                }
+                py::dict ret;
+                ret["node"] = std::move(perm.node);
+                ret["face"] = std::move(perm.face);
+                ret["cell"] = std::move(perm.cell);
+                return ret;
+            },
+            py::arg("method") = "rcm")
+        .def_timed("save_mmesh", &wrapped_type::save_mmesh, py::arg("path"), py::call_guard<py::gil_scoped_release>())
+        .def_static(
+            "load_mmesh",
+            [](std::string const & path, bool mmap)
+            {
+                py::gil_scoped_release const release;
+                return wrapped_type::load_mmesh(path, mmap);
+            },
+            py::arg("path"),
+            py::arg("mmap") = true)
+        .def_timed("publish_shared", &wrapped_type::publish_shared, py::arg("name"), py::call_guard<py::gil_scoped_release>())
+        .def_static(
+            "attach_shared",
+            [](std::string const & name)
+            {
+                py::gil_scoped_release const release;
+                return wrapped_type::attach_shared(name);
+            },
+            py::arg("name"));
+
+    // The adjacency is returned as a tuple of copies of the offsets and indices.
+#define MM_DECL_ADJACENCY(NAME)                                                                           \
+    .def(                                                                                                 \
+        #NAME,                                                                                            \
+        [](wrapped_type const & self)                                                                     \
+        {                                                                                                 \
+            StaticMeshAdjacency const & adj = self.NAME();                                                \
+            return py::make_tuple(SimpleArray<uint64_t>(adj.offsets), SimpleArray<int32_t>(adj.indices)); \
+        })
+
+    // clang-format off
+        (*this)
+            MM_DECL_ADJACENCY(node_cells)
+            MM_DECL_ADJACENCY(node_faces)
+            MM_DECL_ADJACENCY(cell_cells)
+            MM_DECL_ADJACENCY(fcnds_csr)
+            MM_DECL_ADJACENCY(clnds_csr)
+            MM_DECL_ADJACENCY(clfcs_csr)
+            MM_DECL_ADJACENCY(face_colors)
+            MM_DECL_ADJACENCY(cell_colors)
+            .def("clear_adjacency", &wrapped_type::clear_adjacency)
+        ;
+    // clang-format on
+
+#undef MM_DECL_ADJACENCY
 
 #define MM_DECL_ARRAY(NAME) \
     .expose_SimpleArray(#NAME, [](wrapped_type & self) -> decltype(auto) { return self.NAME(); })
@@ -129,6 +195,32 @@ WrapStaticMesh::WrapStaticMesh(pybind11::module & mod, char const * pyname, char
 
 #undef MM_DECL_ARRAY
 
+    // The SoA copies are read-only; modify the AoS arrays and call sync_soa.
+    (*this)
+        .def_property("soa", &wrapped_type::soa, &wrapped_type::set_soa)
+        .def_timed("sync_soa", &wrapped_type::sync_soa, py::call_guard<py::gil_scoped_release>());
+
+#define MM_DECL_SOA(NAME, SUFFIX)                                   \
+    .def_property_readonly(                                         \
+        #NAME "_" #SUFFIX,                                          \
+        [](wrapped_type const & self) -> decltype(auto)             \
+        { return self.NAME##_##SUFFIX(); },                         \
+        py::return_value_policy::reference_internal)
+
+#define MM_DECL_SOA3(NAME) MM_DECL_SOA(NAME, x) MM_DECL_SOA(NAME, y) MM_DECL_SOA(NAME, z)
+
+    // clang-format off
+        (*this)
+            MM_DECL_SOA3(ndcrd)
+            MM_DECL_SOA3(fccnd)
+            MM_DECL_SOA3(fcnml)
+            MM_DECL_SOA3(clcnd)
+        ;
+    // clang-format on
+
+#undef MM_DECL_SOA3
+#undef MM_DECL_SOA
+
     this->cls().attr("NONCELLTYPE") = uint8_t(CellType::NONCELLTYPE);
     this->cls().attr("POINT") = uint8_t(CellType::POINT);
     this->cls().attr("LINE") = uint8_t(CellType::LINE);
@@ -140,9 +232,262 @@ WrapStaticMesh::WrapStaticMesh(pybind11::module & mod, char const * pyname, char
     this->cls().attr("PYRAMID") = uint8_t(CellType::PYRAMID);
 }
 
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapStaticMeshBVH
+    : public WrapBase<WrapStaticMeshBVH, StaticMeshBVH, std::shared_ptr<StaticMeshBVH>>
+{
+
+    friend root_base_type;
+
+    WrapStaticMeshBVH(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        using real_type = typename wrapped_type::real_type;
+
+        (*this)
+            .def_timed(
+                py::init(
+                    [](std::shared_ptr<StaticMesh> const & mesh, size_t leaf_size)
+                    {
+                        py::gil_scoped_release const release;
+                        return std::make_shared<wrapped_type>(mesh, leaf_size);
+                    }),
+                py::arg("mesh"),
+                py::arg("leaf_size") = wrapped_type::DEFAULT_LEAF_SIZE)
+            .def_property_readonly(
+                "mesh",
+                [](wrapped_type const & self)
+                { return std::const_pointer_cast<StaticMesh>(self.mesh()); })
+            .def_property_readonly("leaf_size", &wrapped_type::leaf_size)
+            .def_property_readonly("node_count", &wrapped_type::node_count)
+            .def_timed(
+                "locate",
+                [](wrapped_type const & self, SimpleArray<real_type> const & points)
+                {
+                    py::gil_scoped_release const release;
+                    return self.locate(points);
+                },
+                py::arg("points"))
+            .def_timed(
+                "within",
+                [](wrapped_type const & self, SimpleArray<real_type> const & points, real_type radius)
+                {
+                    StaticMeshAdjacency adj;
+                    {
+                        py::gil_scoped_release const release;
+                        adj = self.within(points, radius);
+                    }
+                    return py::make_tuple(std::move(adj.offsets), std::move(adj.indices));
+                },
+                py::arg("points"),
+                py::arg("radius"))
+            //
+            ;
+    }
+
+}; /* end class WrapStaticMeshBVH */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapStaticMeshLod
+    : public WrapBase<WrapStaticMeshLod, StaticMeshLod, std::shared_ptr<StaticMeshLod>>
+{
+
+    friend root_base_type;
+
+    WrapStaticMeshLod(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        using real_type = typename wrapped_type::real_type;
+
+        (*this)
+            .def_timed(
+                py::init(
+                    [](std::shared_ptr<StaticMesh> const & mesh, size_t depth)
+                    {
+                        py::gil_scoped_release const release;
+                        return std::make_shared<wrapped_type>(mesh, depth);
+                    }),
+                py::arg("mesh"),
+                py::arg("depth") = wrapped_type::DEFAULT_DEPTH)
+            .def_property_readonly(
+                "mesh",
+                [](wrapped_type const & self)
+                { return std::const_pointer_cast<StaticMesh>(self.mesh()); })
+            .def_property_readonly("depth", &wrapped_type::depth)
+            .def_property_readonly("lower", &wrapped_type::lower, py::return_value_policy::reference_internal)
+            .def_property_readonly("upper", &wrapped_type::upper, py::return_value_policy::reference_internal)
+            .def_property_readonly("boundary_nodes", &wrapped_type::boundary_nodes, py::return_value_policy::reference_internal)
+            .def_property_readonly("boundary_edges", &wrapped_type::boundary_edges, py::return_value_policy::reference_internal)
+            .def_property_readonly("nlevel", &wrapped_type::nlevel)
+            .def("cell_size", &wrapped_type::cell_size, py::arg("level"))
+            .def("level_nodes", &wrapped_type::level_nodes, py::arg("level"), py::return_value_policy::reference_internal)
+            .def("level_edges", &wrapped_type::level_edges, py::arg("level"), py::return_value_policy::reference_internal)
+            .def(
+                "select_level",
+                [](wrapped_type const & self, real_type distance, real_type angle)
+                { return self.select_level(distance, angle); },
+                py::arg("distance"),
+                py::arg("angle"))
+            //
+            ;
+    }
+
+}; /* end class WrapStaticMeshLod */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapStaticMeshQuality
+    : public WrapBase<WrapStaticMeshQuality, StaticMeshQuality, std::shared_ptr<StaticMeshQuality>>
+{
+
+    friend root_base_type;
+
+    WrapStaticMeshQuality(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        using real_type = typename wrapped_type::real_type;
+
+        (*this)
+            .def_timed(
+                py::init(
+                    [](std::shared_ptr<StaticMesh> const & mesh)
+                    {
+                        py::gil_scoped_release const release;
+                        return std::make_shared<wrapped_type>(mesh);
+                    }),
+                py::arg("mesh"))
+            .def_property_readonly(
+                "mesh",
+                [](wrapped_type const & self)
+                { return std::const_pointer_cast<StaticMesh>(self.mesh()); })
+            .def_property_readonly("aspect_ratio", &wrapped_type::aspect_ratio, py::return_value_policy::reference_internal)
+            .def_property_readonly("skewness", &wrapped_type::skewness, py::return_value_policy::reference_internal)
+            .def_property_readonly("min_dihedral", &wrapped_type::min_dihedral, py::return_value_policy::reference_internal)
+            .def_property_readonly("scaled_jacobian", &wrapped_type::scaled_jacobian, py::return_value_policy::reference_internal)
+            .def_property_readonly("ninverted", &wrapped_type::ninverted)
+            .def_static(
+                "histogram",
+                [](SimpleArray<real_type> const & values, size_t nbin, real_type lower, real_type upper)
+                { return wrapped_type::histogram(values, nbin, lower, upper); },
+                py::arg("values"),
+                py::arg("nbin"),
+                py::arg("lower"),
+                py::arg("upper"))
+            //
+            ;
+    }
+
+}; /* end class WrapStaticMeshQuality */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapStaticMeshGenerator
+    : public WrapBase<WrapStaticMeshGenerator, StaticMeshGenerator, std::shared_ptr<StaticMeshGenerator>>
+{
+
+    friend root_base_type;
+
+    WrapStaticMeshGenerator(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(
+                py::init(
+                    [](std::string const & shape, std::vector<size_t> const & resolution)
+                    { return std::make_shared<wrapped_type>(wrapped_type::shape_from_string(shape), resolution); }),
+                py::arg("shape"),
+                py::arg("resolution"))
+            .def_property_readonly(
+                "shape",
+                [](wrapped_type const & self)
+                { return wrapped_type::to_string(self.shape()); })
+            .def_property_readonly("ndim", &wrapped_type::ndim)
+            .def_property_readonly("resolution", &wrapped_type::resolution)
+            .def_property_readonly("lower", &wrapped_type::lower)
+            .def_property_readonly("upper", &wrapped_type::upper)
+            .def_property_readonly("grading", &wrapped_type::grading)
+            .def_property_readonly("nnode", &wrapped_type::nnode)
+            .def_property_readonly("ncell", &wrapped_type::ncell)
+            .def("set_box", &wrapped_type::set_box, py::arg("lower"), py::arg("upper"), py::return_value_policy::reference_internal)
+            .def("set_grading", &wrapped_type::set_grading, py::arg("axis"), py::arg("ratio"), py::return_value_policy::reference_internal)
+            .def("coordinates", &wrapped_type::coordinates, py::arg("axis"))
+            .def_timed(
+                "generate",
+                [](wrapped_type const & self)
+                {
+                    py::gil_scoped_release const release;
+                    return self.generate<double>();
+                })
+            .def_timed(
+                "generate_fp32",
+                [](wrapped_type const & self)
+                {
+                    py::gil_scoped_release const release;
+                    return self.generate<float>();
+                })
+            //
+            ;
+    }
+
+}; /* end class WrapStaticMeshGenerator */
+
+namespace detail
+{
+
+template <typename T>
+void def_accumulate_upwind_advection(pybind11::module & mod)
+{
+    namespace py = pybind11;
+
+    mod.def(
+        "accumulate_upwind_advection",
+        [](BasicStaticMesh<T> const & mesh, SimpleArray<T> const & u, SimpleArray<T> & residual, std::vector<T> const & velocity, std::string const & strategy)
+        {
+            if (velocity.size() != mesh.ndim())
+            {
+                throw std::invalid_argument(Formatter() << "accumulate_upwind_advection: velocity has " << velocity.size()
+                                                        << " components but the mesh is " << int(mesh.ndim()) << "D");
+            }
+            FaceLoopStrategy loop_strategy;
+            if ("color" == strategy)
+            {
+                loop_strategy = FaceLoopStrategy::COLOR;
+            }
+            else if ("gather" == strategy)
+            {
+                loop_strategy = FaceLoopStrategy::GATHER;
+            }
+            else
+            {
+                throw std::invalid_argument(Formatter() << "accumulate_upwind_advection: unknown strategy \"" << strategy << "\"");
+            }
+            UpwindAdvectionFlux<T> flux;
+            flux.ndim = mesh.ndim();
+            std::copy(velocity.begin(), velocity.end(), flux.velocity.begin());
+            py::gil_scoped_release const release;
+            accumulate_face_flux(mesh, flux, u, residual, loop_strategy);
+        },
+        py::arg("mesh"),
+        py::arg("u"),
+        py::arg("residual"),
+        py::arg("velocity"),
+        py::arg("strategy") = "color");
+}
+
+} /* end namespace detail */
+
 void wrap_StaticMesh(pybind11::module & mod)
 {
-    WrapStaticMesh::commit(mod, "StaticMesh", "StaticMesh");
+    WrapStaticMesh<double>::commit(mod, "StaticMesh", "StaticMesh");
+    WrapStaticMesh<float>::commit(mod, "StaticMeshFp32", "Single-precision StaticMesh");
+    WrapStaticMeshBVH::commit(mod, "StaticMeshBVH", "StaticMeshBVH");
+    WrapStaticMeshLod::commit(mod, "StaticMeshLod", "StaticMeshLod");
+    WrapStaticMeshQuality::commit(mod, "StaticMeshQuality", "StaticMeshQuality");
+    WrapStaticMeshGenerator::commit(mod, "StaticMeshGenerator", "StaticMeshGenerator");
+    detail::def_accumulate_upwind_advection<double>(mod);
+    detail::def_accumulate_upwind_advection<float>(mod);
 }
 
 } /* end namespace python */
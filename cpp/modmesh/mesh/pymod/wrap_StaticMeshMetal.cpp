@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/pymod/mesh_pymod.hpp> // Must be the first include.
+
+#ifdef MODMESH_METAL_KERNELS
+#include <modmesh/device/metal/StaticMeshMetal.hpp>
+#endif // MODMESH_METAL_KERNELS
+
+namespace modmesh
+{
+
+namespace python
+{
+
+#ifdef MODMESH_METAL_KERNELS
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapStaticMeshMetal
+    : public WrapBase<WrapStaticMeshMetal, device::StaticMeshMetal>
+{
+
+    friend root_base_type;
+
+    WrapStaticMeshMetal(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            // clang-format off
+            .def_property_readonly_static("me", [](py::object const &) -> wrapped_type & { return wrapped_type::instance(); })
+            // clang-format on
+            .def(
+                "calc_metric",
+                [](wrapped_type & self, StaticMesh & mesh)
+                {
+                    py::gil_scoped_release const release;
+                    self.calc_metric(mesh);
+                },
+                py::arg("mesh"))
+            //
+            ;
+    }
+
+}; /* end class WrapStaticMeshMetal */
+#endif // MODMESH_METAL_KERNELS
+
+void wrap_StaticMeshMetal(pybind11::module & mod)
+{
+#ifdef MODMESH_METAL_KERNELS
+    WrapStaticMeshMetal::commit(mod, "StaticMeshMetal", "Calculate the metric of StaticMesh with Metal");
+#else // MODMESH_METAL_KERNELS
+    static_cast<void>(mod);
+#endif // MODMESH_METAL_KERNELS
+}
+
+} /* end namespace python */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/mesh/pymod/mesh_pymod.hpp> // Must be the first include.
+
+namespace modmesh
+{
+
+namespace python
+{
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapStaticMeshPart
+    : public WrapBase<WrapStaticMeshPart, StaticMeshPart>
+{
+
+    friend root_base_type;
+
+    WrapStaticMeshPart(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def_readonly("mesh", &wrapped_type::mesh)
+            .def_readonly("nowned_cell", &wrapped_type::nowned_cell)
+            .def_readonly("node_global", &wrapped_type::node_global)
+            .def_readonly("face_global", &wrapped_type::face_global)
+            .def_readonly("cell_global", &wrapped_type::cell_global)
+            .def_readonly("halo_owner", &wrapped_type::halo_owner)
+            .def_readonly("neighbor_parts", &wrapped_type::neighbor_parts)
+            .def_readonly("send_offsets", &wrapped_type::send_offsets)
+            .def_readonly("send_cells", &wrapped_type::send_cells)
+            .def_readonly("recv_offsets", &wrapped_type::recv_offsets)
+            .def_readonly("recv_cells", &wrapped_type::recv_cells)
+            //
+            ;
+
+        mod.def(
+            "partition_cells_rcb",
+            [](std::shared_ptr<StaticMesh> const & mesh, size_t npart)
+            { return partition_cells_rcb(*mesh, npart); },
+            py::arg("mesh"),
+            py::arg("npart"));
+        mod.def(
+            "decompose_mesh",
+            [](std::shared_ptr<StaticMesh> const & mesh, SimpleArray<int32_t> const & cell_part, size_t npart, size_t nlayer)
+            {
+                py::gil_scoped_release const release;
+                return decompose_mesh(*mesh, cell_part, npart, nlayer);
+            },
+            py::arg("mesh"),
+            py::arg("cell_part"),
+            py::arg("npart"),
+            py::arg("nlayer") = 1);
+    }
+
+}; /* end class WrapStaticMeshPart */
+
+void wrap_StaticMeshPartition(pybind11::module & mod)
+{
+    WrapStaticMeshPart::commit(mod, "StaticMeshPart", "StaticMeshPart");
+}
+
+} /* end namespace python */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
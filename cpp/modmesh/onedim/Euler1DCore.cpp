@@ -28,6 +28,7 @@
 
 #include <modmesh/onedim/Euler1DCore.hpp>
 #include <modmesh/toggle/profile.hpp>
+#include <algorithm>
 #include <cmath>
 
 namespace modmesh
@@ -36,30 +37,237 @@ namespace modmesh
 namespace onedim
 {
 
-std::ostream & operator<<(std::ostream & os, const Euler1DCore & sol)
+namespace
 {
-    os << "Euler1DCore(ncoord=" << sol.ncoord() << ", time_increment=" << sol.time_increment() << ")";
+
+// The loop of Euler1DCore::derive_up_range() over the gathered SEs, taking
+// the arrays as restrict arguments for the compiler to vectorize it.
+template <typename T>
+void derive_up(
+    size_t nse,
+    T hdt,
+    T const * MODMESH_RESTRICT gamma,
+    T const * MODMESH_RESTRICT dxctr,
+    T const * MODMESH_RESTRICT u0,
+    T const * MODMESH_RESTRICT u1,
+    T const * MODMESH_RESTRICT u2,
+    T const * MODMESH_RESTRICT ux0,
+    T const * MODMESH_RESTRICT ux1,
+    T const * MODMESH_RESTRICT ux2,
+    T * MODMESH_RESTRICT up0,
+    T * MODMESH_RESTRICT up1,
+    T * MODMESH_RESTRICT up2)
+{
+    constexpr T tiny = BasicEuler1DKernel<T>::tiny;
+    for (size_t j = 0; j < nse; ++j)
+    {
+        // The same operations as Euler1DKernel::derive() for up.  The first
+        // row of the jacobian is (0, 1, 0), and f and ft are not needed.
+        T const ga = gamma[j];
+        T const v0 = u0[j];
+        T const v1 = u1[j];
+        T const v2 = u2[j];
+        T const vx0 = ux0[j];
+        T const vx1 = ux1[j];
+        T const vx2 = ux2[j];
+
+        T const jac10 = (ga - T(3.0)) / T(2.0) * v1 * v1 / (v0 * v0 + tiny);
+        T const jac11 = -(ga - T(3.0)) * v1 / (v0 + tiny);
+        T const jac12 = ga - T(1.0);
+        T const jac20 = (ga - T(1.0)) * v1 * v1 * v1 / (v0 * v0 * v0 + tiny) - ga * v1 * v2 / (v0 * v0 + tiny);
+        T const jac21 = ga * v2 / (v0 + tiny) - T(3.0) / T(2.0) * (ga - T(1.0)) * v1 * v1 / (v0 * v0 + tiny);
+        T const jac22 = ga * v1 / (v0 + tiny);
+
+        T const ut0 = -vx1;
+        T const ut1 = -jac10 * vx0 - jac11 * vx1 - jac12 * vx2;
+        T const ut2 = -jac20 * vx0 - jac21 * vx1 - jac22 * vx2;
+
+        up0[j] = v0 + dxctr[j] * vx0 + hdt * ut0;
+        up1[j] = v1 + dxctr[j] * vx1 + hdt * ut1;
+        up2[j] = v2 + dxctr[j] * vx2 + hdt * ut2;
+    }
+}
+
+// Checkpoint keeps the arrays in double.  Those of the other types are
+// converted.
+SimpleArray<double> const & checkpoint_array(SimpleArray<double> const & arr) { return arr; }
+
+SimpleArray<double> checkpoint_array(SimpleArray<float> const & arr)
+{
+    SimpleArray<double> ret(arr.shape());
+    std::copy_n(arr.data(), arr.size(), ret.data());
+    return ret;
+}
+
+void restore_array(SimpleArray<double> & dst, SimpleArray<double> & src) { dst = std::move(src); }
+
+void restore_array(SimpleArray<float> & dst, SimpleArray<double> const & src)
+{
+    dst = SimpleArray<float>(src.shape());
+    for (size_t it = 0; it < src.size(); ++it)
+    {
+        dst.data()[it] = static_cast<float>(src.data()[it]);
+    }
+}
+
+} /* end namespace */
+
+template <typename T>
+std::ostream & operator<<(std::ostream & os, const BasicEuler1DCore<T> & sol)
+{
+    os << BasicEuler1DCore<T>::NAME << "(ncoord=" << sol.ncoord() << ", time_increment=" << sol.time_increment() << ")";
     return os;
 }
 
-void Euler1DCore::initialize_data(size_t ncoord)
+template <typename T>
+void BasicEuler1DCore<T>::initialize_data(size_t ncoord)
 {
     MODMESH_TIME("Euler1DCore::initialize_data");
     if (0 == ncoord % 2)
     {
         throw std::invalid_argument("ncoord cannot be even");
     }
-    m_coord = SimpleArray<double>(/*length*/ ncoord);
-    m_cfl = SimpleArray<double>(/*length*/ ncoord);
-    m_so0 = SimpleArray<double>(/*shape*/ small_vector<size_t>{ncoord, NVAR});
-    m_so1 = SimpleArray<double>(/*shape*/ small_vector<size_t>{ncoord, NVAR});
-    m_gamma = SimpleArray<double>(/*shape*/ small_vector<size_t>{ncoord}, /*value*/ 1.4);
+    m_coord = SimpleArray<T>(/*length*/ ncoord);
+    m_cfl = SimpleArray<T>(/*length*/ ncoord);
+    m_so0 = SimpleArray<T>(/*shape*/ small_vector<size_t>{ncoord, NVAR});
+    m_so1 = SimpleArray<T>(/*shape*/ small_vector<size_t>{ncoord, NVAR});
+    m_gamma = SimpleArray<T>(/*shape*/ small_vector<size_t>{ncoord}, /*value*/ T(1.4));
+}
+
+template <typename T>
+void BasicEuler1DCore<T>::set_coord(T xmin, T xmax, T ratio)
+{
+    MODMESH_TIME("Euler1DCore::set_coord");
+    modmesh::detail::fill_graded_coord(m_coord.data(), ncoord(), xmin, xmax, ratio, m_parallel && ThreadPool::instance().use_parallel(ncoord()), "Euler1DCore::set_coord()");
+    m_coord.bump_epoch();
+}
+
+template <typename T>
+void BasicEuler1DCore<T>::set_primitive(SimpleArray<T> const & density, SimpleArray<T> const & velocity, SimpleArray<T> const & pressure)
+{
+    MODMESH_TIME("Euler1DCore::set_primitive");
+    size_t const ncrd = ncoord();
+    for (SimpleArray<T> const * arr : {&density, &velocity, &pressure})
+    {
+        if (arr->size() != ncrd)
+        {
+            throw std::out_of_range(Formatter() << "Euler1DCore::set_primitive(): array size " << arr->size() << " != ncoord " << ncrd);
+        }
+    }
+    T const * const rho = density.data();
+    T const * const v = velocity.data();
+    T const * const p = pressure.data();
+    for_each_point_chunk(
+        [&](size_t begin, size_t end)
+        {
+            for (size_t it = begin; it < end; ++it)
+            {
+                set_point_primitive(it, rho[it], v[it], p[it]);
+            }
+        });
+    bump_epoch();
+}
+
+template <typename T>
+void BasicEuler1DCore<T>::set_piecewise_primitive(
+    SimpleArray<T> const & boundaries,
+    SimpleArray<T> const & density,
+    SimpleArray<T> const & velocity,
+    SimpleArray<T> const & pressure)
+{
+    MODMESH_TIME("Euler1DCore::set_piecewise_primitive");
+    size_t const nbound = boundaries.size();
+    T const * const bound = boundaries.data();
+    for (size_t it = 1; it < nbound; ++it)
+    {
+        if (!(bound[it - 1] < bound[it]))
+        {
+            throw std::invalid_argument(Formatter() << "Euler1DCore::set_piecewise_primitive(): boundaries[" << it - 1 << "]=" << bound[it - 1] << " >= boundaries[" << it << "]=" << bound[it]);
+        }
+    }
+    for (SimpleArray<T> const * arr : {&density, &velocity, &pressure})
+    {
+        if (arr->size() != nbound + 1)
+        {
+            throw std::out_of_range(Formatter() << "Euler1DCore::set_piecewise_primitive(): array size " << arr->size() << " != " << nbound + 1 << " zones");
+        }
+    }
+    T const * const rho = density.data();
+    T const * const v = velocity.data();
+    T const * const p = pressure.data();
+    for_each_point_chunk(
+        [&](size_t begin, size_t end)
+        {
+            for (size_t it = begin; it < end; ++it)
+            {
+                // The number of the boundaries not right of the point.
+                auto const izone = static_cast<size_t>(std::upper_bound(bound, bound + nbound, m_coord(it)) - bound);
+                set_point_primitive(it, rho[izone], v[izone], p[izone]);
+            }
+        });
+    bump_epoch();
+}
+
+template <typename T>
+Checkpoint BasicEuler1DCore<T>::checkpoint() const
+{
+    MODMESH_TIME("Euler1DCore::checkpoint");
+    Checkpoint ret(CHECKPOINT_KIND);
+    ret.add_scalar("time_increment", m_time_increment);
+    ret.add_scalar("nstep", static_cast<double>(m_nstep));
+    ret.add_scalar("time", m_time);
+    ret.add_array("coord", checkpoint_array(m_coord));
+    ret.add_array("cfl", checkpoint_array(m_cfl));
+    ret.add_array("so0", checkpoint_array(m_so0));
+    ret.add_array("so1", checkpoint_array(m_so1));
+    ret.add_array("gamma", checkpoint_array(m_gamma));
+    return ret;
+}
+
+template <typename T>
+void BasicEuler1DCore<T>::restore(Checkpoint checkpoint)
+{
+    MODMESH_TIME("Euler1DCore::restore");
+    checkpoint.check_kind(CHECKPOINT_KIND);
+    size_t const ncoord = checkpoint.array("coord").size();
+    // Check all the arrays before taking any of them.
+    auto check = [&](char const * name, size_t ncol)
+    {
+        SimpleArray<double> const & arr = checkpoint.array(name);
+        bool const good = 1 == ncol ? 1 == arr.ndim() : (2 == arr.ndim() && arr.shape(1) == ncol);
+        if (!good || arr.shape(0) != ncoord)
+        {
+            throw std::runtime_error(Formatter() << "Euler1DCore: checkpoint array " << name << " does not match coord of " << ncoord);
+        }
+    };
+    check("cfl", 1);
+    check("so0", NVAR);
+    check("so1", NVAR);
+    check("gamma", 1);
+    m_time_increment = checkpoint.scalar("time_increment");
+    m_nstep = static_cast<size_t>(checkpoint.scalar("nstep"));
+    m_time = checkpoint.scalar("time");
+    restore_array(m_coord, checkpoint.array("coord"));
+    restore_array(m_cfl, checkpoint.array("cfl"));
+    restore_array(m_so0, checkpoint.array("so0"));
+    restore_array(m_so1, checkpoint.array("so1"));
+    restore_array(m_gamma, checkpoint.array("gamma"));
 }
 
-SimpleArray<double> Euler1DCore::density() const
+template <typename T>
+std::shared_ptr<BasicEuler1DCore<T>> BasicEuler1DCore<T>::restart(Checkpoint checkpoint)
+{
+    checkpoint.check_kind(CHECKPOINT_KIND);
+    std::shared_ptr<BasicEuler1DCore<T>> ret = construct(checkpoint.array("coord").size(), checkpoint.scalar("time_increment"));
+    ret->restore(std::move(checkpoint));
+    return ret;
+}
+
+template <typename T>
+SimpleArray<T> BasicEuler1DCore<T>::density() const
 {
     MODMESH_TIME("Euler1DCore::density");
-    SimpleArray<double> ret(ncoord());
+    SimpleArray<T> ret(ncoord());
     for (size_t it = 0; it < ncoord(); ++it)
     {
         ret(it) = density(it);
@@ -67,10 +275,11 @@ SimpleArray<double> Euler1DCore::density() const
     return ret;
 }
 
-SimpleArray<double> Euler1DCore::velocity() const
+template <typename T>
+SimpleArray<T> BasicEuler1DCore<T>::velocity() const
 {
     MODMESH_TIME("Euler1DCore::velocity");
-    SimpleArray<double> ret(ncoord());
+    SimpleArray<T> ret(ncoord());
     for (size_t it = 0; it < ncoord(); ++it)
     {
         ret(it) = velocity(it);
@@ -78,10 +287,11 @@ SimpleArray<double> Euler1DCore::velocity() const
     return ret;
 }
 
-SimpleArray<double> Euler1DCore::pressure() const
+template <typename T>
+SimpleArray<T> BasicEuler1DCore<T>::pressure() const
 {
     MODMESH_TIME("Euler1DCore::pressure");
-    SimpleArray<double> ret(ncoord());
+    SimpleArray<T> ret(ncoord());
     for (size_t it = 0; it < ncoord(); ++it)
     {
         ret(it) = pressure(it);
@@ -89,43 +299,82 @@ SimpleArray<double> Euler1DCore::pressure() const
     return ret;
 }
 
-void Euler1DCore::update_cfl(bool odd_plane)
+template <typename T>
+void BasicEuler1DCore<T>::update_cfl(bool odd_plane)
 {
     MODMESH_TIME("Euler1DCore::update_cfl");
     const int_type start = BOUND_COUNT - (odd_plane ? 1 : 0);
     const auto stop = static_cast<int_type>(ncoord() - BOUND_COUNT - (odd_plane ? 0 : 1));
-    const double hdt = m_time_increment / 2;
+    // Each chunk keeps its maximum, to be reduced after the sweep.
+    std::vector<T> chunk_max(modmesh::detail::chunk_count(start < stop ? static_cast<size_t>(stop - start + 1) / 2 : 0), 0);
+    for_each_chunk(
+        start,
+        stop,
+        [&](int_type begin, int_type end)
+        {
+            size_t const ichunk = static_cast<size_t>(begin - start) / 2 / ThreadPool::CHUNK_SIZE;
+            chunk_max[ichunk] = update_cfl_range(begin, end);
+        });
+    m_max_cfl = 0;
+    for (T const value : chunk_max)
+    {
+        m_max_cfl = std::max(m_max_cfl, value);
+    }
+}
+
+template <typename T>
+T BasicEuler1DCore<T>::update_cfl_range(int_type start, int_type stop)
+{
+    const T hdt = m_time_increment / 2;
+    T ret = 0;
     for (int_type it = start; it < stop; it += 2)
     {
-        const double ga = m_gamma(it);
+        const T ga = m_gamma(it);
         // TODO: I didn't verify the formula.
         // wave speed.
-        double wspd = m_so0(it, 1);
+        T wspd = m_so0(it, 1);
         wspd *= wspd;
-        const double ke = wspd / (2.0 * m_so0(it, 0));
-        double pr = (ga - 1.0) * (m_so0(it, 2) - ke);
-        pr = (pr + std::abs(pr)) / 2.0;
+        const T ke = wspd / (T(2.0) * m_so0(it, 0));
+        T pr = (ga - T(1.0)) * (m_so0(it, 2) - ke);
+        pr = (pr + std::abs(pr)) / T(2.0);
         wspd = std::sqrt(ga * pr / m_so0(it, 0)) + std::sqrt(wspd) / m_so0(it, 0);
         // CFL.
-        const double dxpos = m_coord(it + 1) - m_coord(it);
-        const double dxneg = m_coord(it) - m_coord(it - 1);
-        const double cfl = hdt * wspd / (dxpos < dxneg ? dxpos : dxneg);
+        const T dxpos = m_coord(it + 1) - m_coord(it);
+        const T dxneg = m_coord(it) - m_coord(it - 1);
+        const T cfl = hdt * wspd / (dxpos < dxneg ? dxpos : dxneg);
         // Set back.
         m_cfl(it) = cfl;
+        ret = std::max(ret, cfl);
     }
+    return ret;
 }
 
-void Euler1DCore::march_half_so0(bool odd_plane)
+template <typename T>
+void BasicEuler1DCore<T>::march_half_so0(bool odd_plane)
 {
     MODMESH_TIME("Euler1DCore::march_half_so0");
     const int_type start = BOUND_COUNT - (odd_plane ? 1 : 0);
     const auto stop = static_cast<int_type>(ncoord() - BOUND_COUNT - (odd_plane ? 0 : 1));
+    for_each_chunk(
+        start,
+        stop,
+        [&](int_type begin, int_type end)
+        { march_half_so0_range(begin, end); });
+}
+
+template <typename T>
+void BasicEuler1DCore<T>::march_half_so0_range(int_type start, int_type stop)
+{
+    if (start >= stop)
+    {
+        return;
+    }
     // Kernal at xneg solution element.
-    Euler1DKernel kernxn{};
+    BasicEuler1DKernel<T> kernxn{};
     kernxn
         .set_time_increment(m_time_increment);
     // Kernal at xpos solution element.
-    Euler1DKernel kernxp{};
+    BasicEuler1DKernel<T> kernxp{};
     kernxp
         .set_time_increment(m_time_increment)
         // Populate using the solution element.
@@ -139,60 +388,78 @@ void Euler1DCore::march_half_so0(bool odd_plane)
             .set_value(ic + 2, m_gamma, m_coord, m_so0, m_so1)
             .derive();
         // Calculate flux through the lower left and lower right of conservation element.
-        const std::array<double, 3> flux_ll = kernxn.calc_flux_ll();
-        const std::array<double, 3> flux_lr = kernxp.calc_flux_lr();
+        const std::array<T, 3> flux_ll = kernxn.calc_flux_ll();
+        const std::array<T, 3> flux_lr = kernxp.calc_flux_lr();
         // Calculate the variables using flux conservation.
-        double const xneg = m_coord(ic);
-        double const xpos = m_coord(ic + 2);
-        double const dx = xpos - xneg;
+        T const xneg = m_coord(ic);
+        T const xpos = m_coord(ic + 2);
+        T const dx = xpos - xneg;
         m_so0(ic + 1, 0) = (flux_ll[0] + flux_lr[0]) / dx;
         m_so0(ic + 1, 1) = (flux_ll[1] + flux_lr[1]) / dx;
         m_so0(ic + 1, 2) = (flux_ll[2] + flux_lr[2]) / dx;
     }
 }
 
-void Euler1DCore::treat_boundary_so0()
+template <typename T>
+void BasicEuler1DCore<T>::derive_up_range(int_type start, size_t nse, T * up0, T * up1, T * up2) const
 {
-    // Set outside value from inside value.
-    {
-        // Left boundary.
-        size_t const ic = 0;
-        m_so0(ic, 0) = m_so0(ic + 2, 0);
-        m_so0(ic, 1) = m_so0(ic + 2, 1);
-        m_so0(ic, 2) = m_so0(ic + 2, 2);
-    }
+    alignas(64) T gamma[SO1_CHUNK + 1];
+    alignas(64) T dxctr[SO1_CHUNK + 1];
+    alignas(64) T u[NVAR][SO1_CHUNK + 1];
+    alignas(64) T ux[NVAR][SO1_CHUNK + 1];
+    for (size_t j = 0; j < nse; ++j)
     {
-        // Right boundary.
-        size_t const ic = ncoord() - 1;
-        m_so0(ic, 0) = m_so0(ic - 2, 0);
-        m_so0(ic, 1) = m_so0(ic - 2, 1);
-        m_so0(ic, 2) = m_so0(ic - 2, 2);
+        size_t const it = start + 2 * j;
+        gamma[j] = m_gamma(it);
+        dxctr[j] = m_coord(it) - (m_coord(it + 1) + m_coord(it - 1)) * T(0.5);
+        for (size_t iv = 0; iv < NVAR; ++iv)
+        {
+            u[iv][j] = m_so0(it, iv);
+            ux[iv][j] = m_so1(it, iv);
+        }
     }
+    derive_up(nse, m_time_increment / T(2.0), gamma, dxctr, u[0], u[1], u[2], ux[0], ux[1], ux[2], up0, up1, up2);
 }
 
-void Euler1DCore::treat_boundary_so1()
+template <typename T>
+void BasicEuler1DCore<T>::treat_boundary_so0()
 {
     // Set outside value from inside value.
-    {
-        // Left boundary.
-        size_t const ic = 0;
-        m_so1(ic, 0) = m_so1(ic + 2, 0);
-        m_so1(ic, 1) = m_so1(ic + 2, 1);
-        m_so1(ic, 2) = m_so1(ic + 2, 2);
-    }
-    {
-        // Right boundary.
-        size_t const ic = ncoord() - 1;
-        m_so1(ic, 0) = m_so1(ic - 2, 0);
-        m_so1(ic, 1) = m_so1(ic - 2, 1);
-        m_so1(ic, 2) = m_so1(ic - 2, 2);
-    }
+    treat_boundary_left(m_so0);
+    treat_boundary_right(m_so0);
+}
+
+template <typename T>
+void BasicEuler1DCore<T>::treat_boundary_so1()
+{
+    // Set outside value from inside value.
+    treat_boundary_left(m_so1);
+    treat_boundary_right(m_so1);
+}
+
+template <typename T>
+void BasicEuler1DCore<T>::treat_boundary_left(SimpleArray<T> & arr)
+{
+    size_t const ic = 0;
+    arr(ic, 0) = arr(ic + 2, 0);
+    arr(ic, 1) = arr(ic + 2, 1);
+    arr(ic, 2) = arr(ic + 2, 2);
 }
 
-SimpleArray<double> Euler1DCore::temperature() const
+template <typename T>
+void BasicEuler1DCore<T>::treat_boundary_right(SimpleArray<T> & arr)
+{
+    size_t const ic = ncoord() - 1;
+    arr(ic, 0) = arr(ic - 2, 0);
+    arr(ic, 1) = arr(ic - 2, 1);
+    arr(ic, 2) = arr(ic - 2, 2);
+}
+
+template <typename T>
+SimpleArray<T> BasicEuler1DCore<T>::temperature() const
 {
     MODMESH_TIME("Euler1DCore::temperature");
-    SimpleArray<double> ret(ncoord());
+    SimpleArray<T> ret(ncoord());
     for (size_t it = 0; it < ncoord(); ++it)
     {
         ret(it) = temperature(it);
@@ -200,10 +467,11 @@ SimpleArray<double> Euler1DCore::temperature() const
     return ret;
 }
 
-SimpleArray<double> Euler1DCore::internal_energy() const
+template <typename T>
+SimpleArray<T> BasicEuler1DCore<T>::internal_energy() const
 {
     MODMESH_TIME("Euler1DCore::internal_energy");
-    SimpleArray<double> ret(ncoord());
+    SimpleArray<T> ret(ncoord());
     for (size_t it = 0; it < ncoord(); ++it)
     {
         ret(it) = internal_energy(it);
@@ -211,10 +479,11 @@ SimpleArray<double> Euler1DCore::internal_energy() const
     return ret;
 }
 
-SimpleArray<double> Euler1DCore::entropy() const
+template <typename T>
+SimpleArray<T> BasicEuler1DCore<T>::entropy() const
 {
     MODMESH_TIME("Euler1DCore::entropy");
-    SimpleArray<double> ret(ncoord());
+    SimpleArray<T> ret(ncoord());
     for (size_t it = 0; it < ncoord(); ++it)
     {
         ret(it) = entropy(it);
@@ -222,5 +491,81 @@ SimpleArray<double> Euler1DCore::entropy() const
     return ret;
 }
 
+template <typename T>
+void BasicEuler1DCore<T>::fill_quantities(
+    SimpleArray<T> * density,
+    SimpleArray<T> * velocity,
+    SimpleArray<T> * pressure,
+    SimpleArray<T> * temperature,
+    SimpleArray<T> * internal_energy,
+    SimpleArray<T> * entropy) const
+{
+    MODMESH_TIME("Euler1DCore::fill_quantities");
+    size_t const ncrd = ncoord();
+    // The null arrays are left null.
+    auto const data = [ncrd](SimpleArray<T> * arr, char const * name) -> T *
+    {
+        if (nullptr == arr)
+        {
+            return nullptr;
+        }
+        if (arr->size() != ncrd)
+        {
+            throw std::out_of_range(Formatter() << "Euler1DCore::fill_quantities(): " << name << " size " << arr->size() << " != ncoord " << ncrd);
+        }
+        return arr->data();
+    };
+    T * const rho_out = data(density, "density");
+    T * const v_out = data(velocity, "velocity");
+    T * const p_out = data(pressure, "pressure");
+    T * const t_out = data(temperature, "temperature");
+    T * const ie_out = data(internal_energy, "internal_energy");
+    T * const s_out = data(entropy, "entropy");
+    for (size_t it = 0; it < ncrd; ++it)
+    {
+        // The same operations as the single quantities.
+        T const ga = m_gamma(it);
+        T const rho = m_so0(it, 0);
+        T const rhov = m_so0(it, 1);
+        T const rhoe = m_so0(it, 2);
+        T const rhov2 = pow<2>(rhov);
+        T const rho2 = pow<2>(rho);
+        T const e = rhoe / rho;
+        if (rho_out)
+        {
+            rho_out[it] = rho;
+        }
+        if (v_out)
+        {
+            v_out[it] = rhov / (rho + TINY);
+        }
+        if (p_out || s_out)
+        {
+            T const pr = (rhoe - rhov2 / (T(2.0) * rho + TINY)) * (ga - T(1.0));
+            if (p_out)
+            {
+                p_out[it] = pr;
+            }
+            if (s_out)
+            {
+                s_out[it] = pr / std::pow(rho, ga);
+            }
+        }
+        if (t_out)
+        {
+            t_out[it] = (ga - T(1.0)) / R * (e - T(0.5) * rhov2 / rho2);
+        }
+        if (ie_out)
+        {
+            ie_out[it] = e - T(0.5) * (rhov2 / rho2);
+        }
+    }
+}
+
+template class BasicEuler1DCore<float>;
+template class BasicEuler1DCore<double>;
+template std::ostream & operator<<(std::ostream & os, const BasicEuler1DCore<float> & sol);
+template std::ostream & operator<<(std::ostream & os, const BasicEuler1DCore<double> & sol);
+
 } /* end namespace onedim */
 } /* end namespace modmesh */
@@ -32,6 +32,7 @@
 #include <modmesh/base.hpp>
 #include <modmesh/math.hpp>
 #include <modmesh/buffer/buffer.hpp>
+#include <modmesh/grid.hpp>
 #include <modmesh/toggle/profile.hpp>
 #include <memory>
 
@@ -41,16 +42,28 @@ namespace modmesh
 namespace onedim
 {
 
-class Euler1DCore
-    : public std::enable_shared_from_this<Euler1DCore>
+/// Added to the divisors against zero, and not flushed to zero in T.
+template <typename T>
+inline constexpr T euler1d_tiny = std::is_same_v<T, float> ? static_cast<T>(1.e-30) : static_cast<T>(1.e-100);
+
+/**
+ * Solve the one-dimensional Euler equations in the value type T.  Euler1DCore
+ * is in double precision, and Euler1DCoreFp32 trades precision for twice the
+ * SIMD width and half the memory traffic.
+ */
+template <typename T>
+class BasicEuler1DCore
+    : public std::enable_shared_from_this<BasicEuler1DCore<T>>
 {
 
 public:
 
+    using value_type = T;
+
     constexpr static size_t BOUND_COUNT = 2;
     static constexpr uint8_t NVAR = 3;
-    static constexpr double TINY = 1.e-100;
-    static constexpr double R = 8.31446261815324;
+    static constexpr T TINY = euler1d_tiny<T>;
+    static constexpr T R = static_cast<T>(8.31446261815324);
 
 private:
 
@@ -60,66 +73,114 @@ private:
 
 public:
 
-    std::shared_ptr<Euler1DCore> clone()
+    std::shared_ptr<BasicEuler1DCore> clone()
     {
-        auto ret = std::make_shared<Euler1DCore>(*this);
+        auto ret = std::make_shared<BasicEuler1DCore>(*this);
         return ret;
     }
 
     template <class... Args>
-    static std::shared_ptr<Euler1DCore> construct(Args &&... args)
+    static std::shared_ptr<BasicEuler1DCore> construct(Args &&... args)
     {
-        return std::make_shared<Euler1DCore>(std::forward<Args>(args)..., ctor_passkey());
+        return std::make_shared<BasicEuler1DCore>(std::forward<Args>(args)..., ctor_passkey());
     }
 
     // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
-    Euler1DCore(size_t ncoord, double time_increment, ctor_passkey const &)
+    BasicEuler1DCore(size_t ncoord, T time_increment, ctor_passkey const &)
         : m_time_increment(time_increment)
     {
         initialize_data(ncoord);
     }
 
-    explicit Euler1DCore(ctor_passkey const &);
+    explicit BasicEuler1DCore(ctor_passkey const &);
 
-    Euler1DCore() = delete;
-    Euler1DCore(Euler1DCore const &) = default;
-    Euler1DCore(Euler1DCore &&) = default;
-    Euler1DCore & operator=(Euler1DCore const &) = default;
-    Euler1DCore & operator=(Euler1DCore &&) = default;
-    ~Euler1DCore() = default;
+    BasicEuler1DCore() = delete;
+    BasicEuler1DCore(BasicEuler1DCore const &) = default;
+    BasicEuler1DCore(BasicEuler1DCore &&) = default;
+    BasicEuler1DCore & operator=(BasicEuler1DCore const &) = default;
+    BasicEuler1DCore & operator=(BasicEuler1DCore &&) = default;
+    ~BasicEuler1DCore() = default;
 
     void initialize_data(size_t ncoord);
 
-    double time_increment() const { return m_time_increment; }
+    T time_increment() const { return m_time_increment; }
+    void set_time_increment(T value) { m_time_increment = value; }
+    /// Number of the steps marched by march_alpha().
+    size_t nstep() const { return m_nstep; }
+    /// Time marched by march_alpha(), the sum of the time increments.
+    T time() const { return m_time; }
 
     size_t ncoord() const { return m_coord.size(); }
-    SimpleArray<double> const & coord() const { return m_coord; }
-    SimpleArray<double> & coord() { return m_coord; }
-
-    SimpleArray<double> const & cfl() const { return m_cfl; }
-    SimpleArray<double> & cfl() { return m_cfl; }
-
-    SimpleArray<double> const & so0() const { return m_so0; }
-    SimpleArray<double> & so0() { return m_so0; }
-
-    SimpleArray<double> const & so1() const { return m_so1; }
-    SimpleArray<double> & so1() { return m_so1; }
-
-    SimpleArray<double> const & gamma() const { return m_gamma; }
-    SimpleArray<double> & gamma() { return m_gamma; }
-
-    double density(size_t it) const { return m_so0(it, 0); }
-    SimpleArray<double> density() const;
-    double velocity(size_t it) const { return m_so0(it, 1) / (m_so0(it, 0) + TINY); }
-    SimpleArray<double> velocity() const;
-    double pressure(size_t it) const;
-    SimpleArray<double> pressure() const;
-    double temperature(size_t it) const;
-    SimpleArray<double> temperature() const;
-    double internal_energy(size_t it) const;
-    SimpleArray<double> internal_energy() const;
-    double entropy(size_t it) const { return pressure(it) / std::pow(density(it), m_gamma(it)); }
-    SimpleArray<double> entropy() const;
+    SimpleArray<T> const & coord() const { return m_coord; }
+    SimpleArray<T> & coord() { return m_coord; }
+
+    SimpleArray<T> const & cfl() const { return m_cfl; }
+    SimpleArray<T> & cfl() { return m_cfl; }
+
+    SimpleArray<T> const & so0() const { return m_so0; }
+    SimpleArray<T> & so0() { return m_so0; }
+
+    SimpleArray<T> const & so1() const { return m_so1; }
+    SimpleArray<T> & so1() { return m_so1; }
+
+    SimpleArray<T> const & gamma() const { return m_gamma; }
+    SimpleArray<T> & gamma() { return m_gamma; }
+
+    /**
+     * Fill coord() from xmin to xmax, each interval ratio times the one
+     * before it.  The default ratio of 1 spaces the points evenly, the same
+     * as numpy.linspace().
+     */
+    void set_coord(T xmin, T xmax, T ratio = T(1));
+    /**
+     * Set so0() of every point from the density, the velocity, and the
+     * pressure of the size ncoord(), with gamma(), and zero so1() and cfl().
+     */
+    void set_primitive(SimpleArray<T> const & density, SimpleArray<T> const & velocity, SimpleArray<T> const & pressure);
+    /**
+     * Set the state as above from func(x) returning the density, the
+     * velocity, and the pressure at the coordinate x in a std::array.  func
+     * is called concurrently in the parallel mode.
+     */
+    template <typename F>
+    void set_primitive(F && func);
+    /**
+     * Set a piecewise-constant state as set_primitive().  Zone i is left of
+     * boundaries[i] and right of the boundary before it, so that there is
+     * one more zone than the ascending boundaries, and the density, the
+     * velocity, and the pressure are given for each zone.
+     */
+    void set_piecewise_primitive(
+        SimpleArray<T> const & boundaries,
+        SimpleArray<T> const & density,
+        SimpleArray<T> const & velocity,
+        SimpleArray<T> const & pressure);
+
+    T density(size_t it) const { return m_so0(it, 0); }
+    SimpleArray<T> density() const;
+    T velocity(size_t it) const { return m_so0(it, 1) / (m_so0(it, 0) + TINY); }
+    SimpleArray<T> velocity() const;
+    T pressure(size_t it) const;
+    SimpleArray<T> pressure() const;
+    T temperature(size_t it) const;
+    SimpleArray<T> temperature() const;
+    T internal_energy(size_t it) const;
+    SimpleArray<T> internal_energy() const;
+    T entropy(size_t it) const { return pressure(it) / std::pow(density(it), m_gamma(it)); }
+    SimpleArray<T> entropy() const;
+    /**
+     * Calculate the quantities above in one pass over so0, into the given
+     * arrays of the size ncoord(), without allocation.  A null array is not
+     * calculated.  The terms shared by the quantities are calculated once
+     * for each point, and the values are the same as the single ones.
+     */
+    void fill_quantities(
+        SimpleArray<T> * density,
+        SimpleArray<T> * velocity,
+        SimpleArray<T> * pressure,
+        SimpleArray<T> * temperature,
+        SimpleArray<T> * internal_energy,
+        SimpleArray<T> * entropy) const;
 
     void update_cfl(bool odd_plane);
     void march_half_so0(bool odd_plane);
@@ -128,6 +189,54 @@ public:
     void treat_boundary_so0();
     void treat_boundary_so1();
 
+    /**
+     * Whether the sweeps of a half step, and the tiles of the time skewing,
+     * are split over ThreadPool, when the grid is not smaller than its
+     * threshold.  The chunks depend only on the grid, and each point is
+     * written by one sweep, so the result does not depend on the threads.
+     */
+    bool parallel() const { return m_parallel; }
+    void set_parallel(bool value) { m_parallel = value; }
+
+    /**
+     * Number of the steps march_alpha() takes on a tile of the grid while it
+     * stays in cache, before moving to the next tile (time skewing).  Zero or
+     * one sweeps the whole grid for every half step.  The tiles are
+     * block_width() points wide, widened when needed for the depth of the
+     * dependency.  The result is identical.
+     */
+    size_t block_steps() const { return m_block_steps; }
+    void set_block_steps(size_t value) { m_block_steps = value; }
+    size_t block_width() const { return m_block_width; }
+    void set_block_width(size_t value) { m_block_width = value; }
+
+    /**
+     * The largest CFL number of the last update_cfl(), or of the last step
+     * marched by march_alpha() (the last block of steps with block_steps()).
+     * It is reduced in the loop that calculates the CFL numbers.
+     */
+    T max_cfl() const { return m_max_cfl; }
+    /**
+     * When positive, march_alpha() scales time_increment() before each step
+     * by the ratio of the target to max_cfl(), so that the step is the
+     * largest one the target allows.  Zero keeps the time increment.
+     */
+    T target_cfl() const { return m_target_cfl; }
+    void set_target_cfl(T value) { m_target_cfl = value; }
+
+    /**
+     * Count the steps marched outside march_alpha(), e.g., on a GPU: advance
+     * nstep() and time() by the steps of time_increment(), and take the
+     * max_cfl() of the last one.  The solution arrays are marked modified.
+     */
+    void add_steps(size_t steps, T max_cfl)
+    {
+        m_time += m_time_increment * static_cast<T>(steps);
+        m_nstep += steps;
+        m_max_cfl = max_cfl;
+        bump_epoch();
+    }
+
     void setup_march() { update_cfl(false); }
     template <size_t ALPHA>
     void march_half1_alpha();
@@ -135,64 +244,201 @@ public:
     void march_half2_alpha();
     template <size_t ALPHA>
     void march_alpha(size_t steps);
+    /**
+     * March the steps like march_alpha(), and call hook() after each step
+     * that makes nstep() a multiple of every.  The steps between the calls
+     * are marched in one march_alpha().  Zero every never calls hook().
+     */
+    template <size_t ALPHA, typename F>
+    void run_alpha(size_t steps, size_t every, F && hook);
+    /**
+     * March the steps like run_alpha(), and copy time() and so0() of each
+     * sample into the next rows of time_history (nsample) and so0_history
+     * (nsample, ncoord, NVAR).  Returns the number of samples copied.
+     */
+    template <size_t ALPHA>
+    size_t record_alpha(size_t steps, size_t every, SimpleArray<T> & time_history, SimpleArray<T> & so0_history);
+    /**
+     * March the steps like run_alpha(), and publish so0() and time() of each
+     * sample to the snapshot, for a reader on another thread.  Returns the
+     * number of samples published.
+     */
+    template <size_t ALPHA>
+    size_t stream_alpha(size_t steps, size_t every, SimpleArraySnapshot<T> & snapshot);
+    /**
+     * March the steps like run_alpha(), and evaluate the monitor on so0()
+     * at time() of each sample.  Returns the number of samples evaluated.
+     */
+    template <size_t ALPHA>
+    size_t monitor_alpha(size_t steps, size_t every, SimpleArrayMonitor<T> & monitor);
 
-private:
+    /// The name of the Python class, and the kind of the checkpoints.
+    static constexpr char const * NAME = std::is_same_v<T, float> ? "Euler1DCoreFp32" : "Euler1DCore";
+    static constexpr char const * CHECKPOINT_KIND = NAME;
 
-    real_type m_time_increment = 0;
-    SimpleArray<double> m_coord;
-    SimpleArray<double> m_cfl;
-    SimpleArray<double> m_so0;
-    SimpleArray<double> m_so1;
-    SimpleArray<double> m_gamma;
-}; /* end class Euler1DCore */
+    /// Snapshot the state arrays and the step counters.
+    Checkpoint checkpoint() const;
+    /**
+     * Take the state of the checkpoint.  The arrays are moved out of the
+     * checkpoint, so that those mapped from a file are not copied.
+     */
+    void restore(Checkpoint checkpoint);
+    static std::shared_ptr<BasicEuler1DCore> restart(Checkpoint checkpoint);
 
-std::ostream & operator<<(std::ostream & os, const Euler1DCore & sol);
+private:
 
-inline double Euler1DCore::pressure(size_t it) const
+    // Call func(begin, end) for the chunks of the points [start, stop) of a
+    // plane, on ThreadPool in the parallel mode.
+    template <typename F>
+    void for_each_chunk(int_type start, int_type stop, F && func);
+    // Call func(itile) for itile in [0, ntile), on ThreadPool in the parallel
+    // mode.
+    template <typename F>
+    void for_each_tile(size_t ntile, F && func);
+
+    // The sweeps over the points [start, stop) of a plane, by the stride 2.
+    // update_cfl_range() returns the largest CFL number.
+    T update_cfl_range(int_type start, int_type stop);
+    void march_half_so0_range(int_type start, int_type stop);
+    template <size_t ALPHA>
+    void march_half_so1_alpha_range(int_type start, int_type stop);
+    // The number of CEs march_half_so1_alpha_range() calculates at once.
+    static constexpr size_t SO1_CHUNK = 128;
+    // Derive the variables at the CE centers of the nse (up to SO1_CHUNK + 1)
+    // SEs from start by the stride 2, as Euler1DKernel::derive() does.
+    void derive_up_range(int_type start, size_t nse, T * up0, T * up1, T * up2) const;
+    // The gradients of the nce CEs of a chunk of march_half_so1_alpha_range().
+    template <size_t ALPHA>
+    static void march_so1_chunk(
+        size_t nce,
+        T const * MODMESH_RESTRICT dxn,
+        T const * MODMESH_RESTRICT dxp,
+        T const * MODMESH_RESTRICT up0,
+        T const * MODMESH_RESTRICT up1,
+        T const * MODMESH_RESTRICT up2,
+        T const * MODMESH_RESTRICT utp0,
+        T const * MODMESH_RESTRICT utp1,
+        T const * MODMESH_RESTRICT utp2,
+        T * MODMESH_RESTRICT ux0,
+        T * MODMESH_RESTRICT ux1,
+        T * MODMESH_RESTRICT ux2);
+    void treat_boundary_left(SimpleArray<T> & arr);
+    void treat_boundary_right(SimpleArray<T> & arr);
+
+    // Advance the points in [xbegin, xend) by a half step, without the
+    // boundary treatment.  Returns the largest CFL number updated.
+    template <size_t ALPHA>
+    T march_half_alpha_range(size_t xbegin, size_t xend, bool odd_plane);
+    // March a step over the whole grid.
+    template <size_t ALPHA>
+    void march_step_alpha();
+    // March the steps tile by tile.
+    template <size_t ALPHA>
+    void march_block_alpha(size_t steps);
+    // Scale the time increment for target_cfl().
+    void adapt_time_increment();
+    // Set so0() of a point from the primitive variables, and zero so1() and
+    // cfl().
+    void set_point_primitive(size_t it, T density, T velocity, T pressure)
+    {
+        // The same operations as Euler1DSolver.calc_u2().
+        T const ie = T(1.0) / (m_gamma(it) - T(1.0)) * pressure / density;
+        T const ke = velocity * velocity / T(2.0);
+        m_so0(it, 0) = density;
+        m_so0(it, 1) = density * velocity;
+        m_so0(it, 2) = density * (ie + ke);
+        for (size_t iv = 0; iv < NVAR; ++iv)
+        {
+            m_so1(it, iv) = T(0.0);
+        }
+        m_cfl(it) = T(0.0);
+    }
+    // Call func(begin, end) on the chunks of the points, on ThreadPool in
+    // the parallel mode.
+    template <typename F>
+    void for_each_point_chunk(F && func) const
+    {
+        bool const parallel = m_parallel && ThreadPool::instance().use_parallel(ncoord());
+        parallel_for_chunks(ncoord(), parallel, std::forward<F>(func));
+    }
+    // Mark the solution arrays modified after a march.
+    void bump_epoch()
+    {
+        m_cfl.bump_epoch();
+        m_so0.bump_epoch();
+        m_so1.bump_epoch();
+    }
+
+    T m_time_increment = 0;
+    size_t m_nstep = 0;
+    T m_time = 0;
+    T m_max_cfl = 0;
+    T m_target_cfl = 0;
+    size_t m_block_steps = 0;
+    size_t m_block_width = 1 << 12;
+    bool m_parallel = true;
+    SimpleArray<T> m_coord;
+    SimpleArray<T> m_cfl;
+    SimpleArray<T> m_so0;
+    SimpleArray<T> m_so1;
+    SimpleArray<T> m_gamma;
+}; /* end class BasicEuler1DCore */
+
+template <typename T>
+std::ostream & operator<<(std::ostream & os, const BasicEuler1DCore<T> & sol);
+
+using Euler1DCore = BasicEuler1DCore<double>;
+using Euler1DCoreFp32 = BasicEuler1DCore<float>;
+
+template <typename T>
+inline T BasicEuler1DCore<T>::pressure(size_t it) const
 {
-    double ret = m_so0(it, 1);
+    T ret = m_so0(it, 1);
     ret *= ret;
-    ret /= 2.0 * m_so0(it, 0) + TINY;
+    ret /= T(2.0) * m_so0(it, 0) + TINY;
     ret = m_so0(it, 2) - ret;
-    ret *= m_gamma(it) - 1.0;
+    ret *= m_gamma(it) - T(1.0);
     return ret;
 }
 
-inline double Euler1DCore::temperature(size_t it) const
+template <typename T>
+inline T BasicEuler1DCore<T>::temperature(size_t it) const
 {
-    double ret = (m_gamma(it) - 1.0) / R;
-    ret *= m_so0(it, 2) / m_so0(it, 0) - 0.5 * pow<2>(m_so0(it, 1)) / pow<2>(m_so0(it, 0));
+    T ret = (m_gamma(it) - T(1.0)) / R;
+    ret *= m_so0(it, 2) / m_so0(it, 0) - T(0.5) * pow<2>(m_so0(it, 1)) / pow<2>(m_so0(it, 0));
     return ret;
 }
 
-inline double Euler1DCore::internal_energy(size_t it) const
+template <typename T>
+inline T BasicEuler1DCore<T>::internal_energy(size_t it) const
 {
-    double ret = m_so0(it, 2) / m_so0(it, 0);
-    ret -= 0.5 * (pow<2>(m_so0(it, 1)) / pow<2>(m_so0(it, 0)));
+    T ret = m_so0(it, 2) / m_so0(it, 0);
+    ret -= T(0.5) * (pow<2>(m_so0(it, 1)) / pow<2>(m_so0(it, 0)));
     return ret;
 }
 
-struct Euler1DKernel
+template <typename T>
+struct BasicEuler1DKernel
 {
-    static constexpr double tiny = 1.e-100;
+    static constexpr T tiny = euler1d_tiny<T>;
 
-    Euler1DKernel() = default;
+    BasicEuler1DKernel() = default;
 
-    Euler1DKernel & set_time_increment(double time_increment)
+    BasicEuler1DKernel & set_time_increment(T time_increment)
     {
-        hdt = time_increment / 2.0;
-        qdt = hdt / 2.0;
+        hdt = time_increment / T(2.0);
+        qdt = hdt / T(2.0);
         return *this;
     }
 
     // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
-    Euler1DKernel & set_value(size_t ic, SimpleArray<double> const & gamma, SimpleArray<double> const & coord, SimpleArray<double> const & so0, SimpleArray<double> const & so1)
+    BasicEuler1DKernel & set_value(size_t ic, SimpleArray<T> const & gamma, SimpleArray<T> const & coord, SimpleArray<T> const & so0, SimpleArray<T> const & so1)
     {
         ga = gamma(ic);
         x = coord(ic);
         xneg = coord(ic - 1);
         xpos = coord(ic + 1);
-        xctr = (xpos + xneg) * 0.5;
+        xctr = (xpos + xneg) * T(0.5);
         u[0] = so0(ic, 0);
         u[1] = so0(ic, 1);
         u[2] = so0(ic, 2);
@@ -202,24 +448,24 @@ struct Euler1DKernel
         return *this;
     }
 
-    Euler1DKernel & derive()
+    BasicEuler1DKernel & derive()
     {
         MODMESH_TIME("Euler1DKernel::derive");
 
         // TODO: reduce numerical calculation.
-        jac[0][0] = 0.0;
-        jac[0][1] = 1.0;
-        jac[0][2] = 0.0;
-        jac[1][0] = (ga - 3.0) / 2.0 * u[1] * u[1] / (u[0] * u[0] + tiny);
-        jac[1][1] = -(ga - 3.0) * u[1] / (u[0] + tiny);
-        jac[1][2] = ga - 1.0;
-        jac[2][0] = (ga - 1.0) * u[1] * u[1] * u[1] / (u[0] * u[0] * u[0] + tiny) - ga * u[1] * u[2] / (u[0] * u[0] + tiny);
-        jac[2][1] = ga * u[2] / (u[0] + tiny) - 3.0 / 2.0 * (ga - 1.0) * u[1] * u[1] / (u[0] * u[0] + tiny);
+        jac[0][0] = T(0.0);
+        jac[0][1] = T(1.0);
+        jac[0][2] = T(0.0);
+        jac[1][0] = (ga - T(3.0)) / T(2.0) * u[1] * u[1] / (u[0] * u[0] + tiny);
+        jac[1][1] = -(ga - T(3.0)) * u[1] / (u[0] + tiny);
+        jac[1][2] = ga - T(1.0);
+        jac[2][0] = (ga - T(1.0)) * u[1] * u[1] * u[1] / (u[0] * u[0] * u[0] + tiny) - ga * u[1] * u[2] / (u[0] * u[0] + tiny);
+        jac[2][1] = ga * u[2] / (u[0] + tiny) - T(3.0) / T(2.0) * (ga - T(1.0)) * u[1] * u[1] / (u[0] * u[0] + tiny);
         jac[2][2] = ga * u[1] / (u[0] + tiny);
 
         f[0] = u[1];
-        f[1] = (ga - 1.0) * u[2] + (3.0 - ga) / 2.0 * u[1] * u[1] / (u[0] + tiny);
-        f[2] = ga * u[1] * u[2] / (u[0] + tiny) - (ga - 1.0) / 2.0 * u[1] * u[1] * u[1] / (u[0] * u[0] + tiny);
+        f[1] = (ga - T(1.0)) * u[2] + (T(3.0) - ga) / T(2.0) * u[1] * u[1] / (u[0] + tiny);
+        f[2] = ga * u[1] * u[2] / (u[0] + tiny) - (ga - T(1.0)) / T(2.0) * u[1] * u[1] * u[1] / (u[0] * u[0] + tiny);
 
         // Also ut = -fx
         ut[0] = -jac[0][0] * ux[0] - jac[0][1] * ux[1] - jac[0][2] * ux[2];
@@ -238,92 +484,195 @@ struct Euler1DKernel
         return *this;
     }
 
-    std::array<double, 3> calc_flux_ll()
+    std::array<T, 3> calc_flux_ll()
     {
-        const double deltax = xpos - x;
-        const double dxmid = 0.5 * (x + xpos) - xctr;
-        const double dxctr = x - xctr;
-        double const r0 = deltax * (u[0] + dxmid * ux[0]) + hdt * (f[0] - (dxctr * ut[0]) + (qdt * ft[0]));
-        double const r1 = deltax * (u[1] + dxmid * ux[1]) + hdt * (f[1] - (dxctr * ut[1]) + (qdt * ft[1]));
-        double const r2 = deltax * (u[2] + dxmid * ux[2]) + hdt * (f[2] - (dxctr * ut[2]) + (qdt * ft[2]));
-        return std::array<double, 3>{r0, r1, r2};
+        const T deltax = xpos - x;
+        const T dxmid = T(0.5) * (x + xpos) - xctr;
+        const T dxctr = x - xctr;
+        T const r0 = deltax * (u[0] + dxmid * ux[0]) + hdt * (f[0] - (dxctr * ut[0]) + (qdt * ft[0]));
+        T const r1 = deltax * (u[1] + dxmid * ux[1]) + hdt * (f[1] - (dxctr * ut[1]) + (qdt * ft[1]));
+        T const r2 = deltax * (u[2] + dxmid * ux[2]) + hdt * (f[2] - (dxctr * ut[2]) + (qdt * ft[2]));
+        return std::array<T, 3>{r0, r1, r2};
     }
 
-    std::array<double, 3> calc_flux_lr()
+    std::array<T, 3> calc_flux_lr()
     {
-        const double deltax = x - xneg;
-        const double dxmid = 0.5 * (x + xneg) - xctr;
-        const double dxctr = x - xctr;
-        double const r0 = deltax * (u[0] + dxmid * ux[0]) - hdt * (f[0] - (dxctr * ut[0]) + (qdt * ft[0]));
-        double const r1 = deltax * (u[1] + dxmid * ux[1]) - hdt * (f[1] - (dxctr * ut[1]) + (qdt * ft[1]));
-        double const r2 = deltax * (u[2] + dxmid * ux[2]) - hdt * (f[2] - (dxctr * ut[2]) + (qdt * ft[2]));
-        return std::array<double, 3>{r0, r1, r2};
+        const T deltax = x - xneg;
+        const T dxmid = T(0.5) * (x + xneg) - xctr;
+        const T dxctr = x - xctr;
+        T const r0 = deltax * (u[0] + dxmid * ux[0]) - hdt * (f[0] - (dxctr * ut[0]) + (qdt * ft[0]));
+        T const r1 = deltax * (u[1] + dxmid * ux[1]) - hdt * (f[1] - (dxctr * ut[1]) + (qdt * ft[1]));
+        T const r2 = deltax * (u[2] + dxmid * ux[2]) - hdt * (f[2] - (dxctr * ut[2]) + (qdt * ft[2]));
+        return std::array<T, 3>{r0, r1, r2};
     }
 
-    double ga; //< Heat capacity ratio.
-    double qdt; //< Quarter of time increment.
-    double hdt; //< Half of time increment.
-    double x; //< Grid point.
-    double xctr; //< Solution point.
-    double xneg; //< Left point of the solution element.
-    double xpos; //< Right point of the solution element.
-    std::array<double, 3> u; // Variable.
-    std::array<double, 3> ux; // First-order derivative of u with respect to space.
-    std::array<std::array<double, 3>, 3> jac; //< Jacobian.
-    std::array<double, 3> f; //< Function.
-    std::array<double, 3> ut; //< First-order derivative of u with respect to time.
-    std::array<double, 3> ft; //< First-order derivative of f with respect to time.
-    std::array<double, 3> up; //< Derived variable.
-}; /* end struct Euler1DKernel */
+    T ga; //< Heat capacity ratio.
+    T qdt; //< Quarter of time increment.
+    T hdt; //< Half of time increment.
+    T x; //< Grid point.
+    T xctr; //< Solution point.
+    T xneg; //< Left point of the solution element.
+    T xpos; //< Right point of the solution element.
+    std::array<T, 3> u; // Variable.
+    std::array<T, 3> ux; // First-order derivative of u with respect to space.
+    std::array<std::array<T, 3>, 3> jac; //< Jacobian.
+    std::array<T, 3> f; //< Function.
+    std::array<T, 3> ut; //< First-order derivative of u with respect to time.
+    std::array<T, 3> ft; //< First-order derivative of f with respect to time.
+    std::array<T, 3> up; //< Derived variable.
+}; /* end struct BasicEuler1DKernel */
+
+using Euler1DKernel = BasicEuler1DKernel<double>;
+
+template <typename T>
+template <typename F>
+inline void BasicEuler1DCore<T>::set_primitive(F && func)
+{
+    MODMESH_TIME("Euler1DCore::set_primitive");
+    for_each_point_chunk(
+        [&](size_t begin, size_t end)
+        {
+            for (size_t it = begin; it < end; ++it)
+            {
+                std::array<T, NVAR> const prim = func(m_coord(it));
+                set_point_primitive(it, prim[0], prim[1], prim[2]);
+            }
+        });
+    bump_epoch();
+}
+
+template <typename T>
+template <typename F>
+inline void BasicEuler1DCore<T>::for_each_chunk(int_type start, int_type stop, F && func)
+{
+    size_t const npoint = start < stop ? static_cast<size_t>(stop - start + 1) / 2 : 0;
+    bool const parallel = m_parallel && ThreadPool::instance().use_parallel(npoint);
+    parallel_for_chunks(
+        npoint,
+        parallel,
+        [&](size_t begin, size_t end)
+        { func(start + 2 * static_cast<int_type>(begin), std::min(stop, start + 2 * static_cast<int_type>(end))); });
+}
 
+template <typename T>
+template <typename F>
+inline void BasicEuler1DCore<T>::for_each_tile(size_t ntile, F && func)
+{
+    if (m_parallel && ThreadPool::instance().use_parallel(ncoord()))
+    {
+        ThreadPool::instance().run(ntile, func);
+    }
+    else
+    {
+        for (size_t itile = 0; itile < ntile; ++itile)
+        {
+            func(itile);
+        }
+    }
+}
+
+template <typename T>
 template <size_t ALPHA>
-inline void Euler1DCore::march_half_so1_alpha(bool odd_plane)
+inline void BasicEuler1DCore<T>::march_half_so1_alpha(bool odd_plane)
 {
     MODMESH_TIME("Euler1DKernel::march_half_so1_alpha");
 
     const int_type start = BOUND_COUNT - (odd_plane ? 1 : 0);
     const int_type stop = static_cast<int_type>(ncoord() - BOUND_COUNT - (odd_plane ? 0 : 1));
-    // Kernal at xneg solution element.
-    Euler1DKernel kernxn{};
-    kernxn
-        .set_time_increment(m_time_increment);
-    // Kernal at xpos solution element.
-    Euler1DKernel kernxp{};
-    kernxp
-        .set_time_increment(m_time_increment)
-        // Populate using the solution element.
-        .set_value(start, m_gamma, m_coord, m_so0, m_so1)
-        .derive();
-    for (int_type ic = start; ic < stop; ic += 2)
+    for_each_chunk(
+        start,
+        stop,
+        [&](int_type begin, int_type end)
+        { march_half_so1_alpha_range<ALPHA>(begin, end); });
+}
+
+template <typename T>
+template <size_t ALPHA>
+inline void BasicEuler1DCore<T>::march_half_so1_alpha_range(int_type start, int_type stop)
+{
+    // The CEs are marched in chunks.  The strided points of a chunk are
+    // gathered into the aligned SoA temporaries, so that the calculation
+    // loops over contiguous arrays and is vectorized.
+    alignas(64) T up[NVAR][SO1_CHUNK + 1];
+    alignas(64) T utp[NVAR][SO1_CHUNK];
+    alignas(64) T ux[NVAR][SO1_CHUNK];
+    alignas(64) T dxn[SO1_CHUNK];
+    alignas(64) T dxp[SO1_CHUNK];
+    for (int_type ic = start; ic < stop; ic += 2 * static_cast<int_type>(SO1_CHUNK))
     {
-        // Update kernels (avoid duplicate expensiave calculation).
-        kernxn = kernxp;
-        kernxp
-            .set_value(ic + 2, m_gamma, m_coord, m_so0, m_so1)
-            .derive();
-        // Calculate the gradient.
-        for (size_t iv = 0; iv < 3; ++iv)
+        size_t const nce = std::min(SO1_CHUNK, static_cast<size_t>(stop - ic + 1) / 2);
+        // The SEs on both sides of the CEs.
+        derive_up_range(ic, nce + 1, up[0], up[1], up[2]);
+        for (size_t j = 0; j < nce; ++j)
         {
-            const double utp = m_so0(ic + 1, iv);
-            const double duxn = (utp - kernxn.up[iv]) / (kernxn.xpos - kernxn.x);
-            const double duxp = (kernxp.up[iv] - utp) / (kernxp.x - kernxp.xneg);
-            const double fan = pow<ALPHA>(std::abs(duxn));
-            const double fap = pow<ALPHA>(std::abs(duxp));
-            m_so1(ic + 1, iv) = (fap * duxn + fan * duxp) / (fap + fan + Euler1DKernel::tiny);
+            size_t const it = ic + 2 * j + 1;
+            dxn[j] = m_coord(it) - m_coord(it - 1);
+            dxp[j] = m_coord(it + 1) - m_coord(it);
+            utp[0][j] = m_so0(it, 0);
+            utp[1][j] = m_so0(it, 1);
+            utp[2][j] = m_so0(it, 2);
         }
+        march_so1_chunk<ALPHA>(nce, dxn, dxp, up[0], up[1], up[2], utp[0], utp[1], utp[2], ux[0], ux[1], ux[2]);
+        for (size_t j = 0; j < nce; ++j)
+        {
+            size_t const it = ic + 2 * j + 1;
+            m_so1(it, 0) = ux[0][j];
+            m_so1(it, 1) = ux[1][j];
+            m_so1(it, 2) = ux[2][j];
+        }
+    }
+}
+
+template <typename T>
+template <size_t ALPHA>
+inline void BasicEuler1DCore<T>::march_so1_chunk(
+    size_t nce,
+    T const * MODMESH_RESTRICT dxn,
+    T const * MODMESH_RESTRICT dxp,
+    T const * MODMESH_RESTRICT up0,
+    T const * MODMESH_RESTRICT up1,
+    T const * MODMESH_RESTRICT up2,
+    T const * MODMESH_RESTRICT utp0,
+    T const * MODMESH_RESTRICT utp1,
+    T const * MODMESH_RESTRICT utp2,
+    T * MODMESH_RESTRICT ux0,
+    T * MODMESH_RESTRICT ux1,
+    T * MODMESH_RESTRICT ux2)
+{
+    // The CE j is between the SEs j and j + 1 of up.
+    constexpr T tiny = BasicEuler1DKernel<T>::tiny;
+    for (size_t j = 0; j < nce; ++j)
+    {
+        T const duxn0 = (utp0[j] - up0[j]) / dxn[j];
+        T const duxp0 = (up0[j + 1] - utp0[j]) / dxp[j];
+        T const duxn1 = (utp1[j] - up1[j]) / dxn[j];
+        T const duxp1 = (up1[j + 1] - utp1[j]) / dxp[j];
+        T const duxn2 = (utp2[j] - up2[j]) / dxn[j];
+        T const duxp2 = (up2[j + 1] - utp2[j]) / dxp[j];
+        T const fan0 = pow<ALPHA>(std::abs(duxn0));
+        T const fap0 = pow<ALPHA>(std::abs(duxp0));
+        T const fan1 = pow<ALPHA>(std::abs(duxn1));
+        T const fap1 = pow<ALPHA>(std::abs(duxp1));
+        T const fan2 = pow<ALPHA>(std::abs(duxn2));
+        T const fap2 = pow<ALPHA>(std::abs(duxp2));
+        ux0[j] = (fap0 * duxn0 + fan0 * duxp0) / (fap0 + fan0 + tiny);
+        ux1[j] = (fap1 * duxn1 + fan1 * duxp1) / (fap1 + fan1 + tiny);
+        ux2[j] = (fap2 * duxn2 + fan2 * duxp2) / (fap2 + fan2 + tiny);
     }
 }
 
+template <typename T>
 template <size_t ALPHA>
-inline void Euler1DCore::march_half1_alpha()
+inline void BasicEuler1DCore<T>::march_half1_alpha()
 {
     march_half_so0(/*odd_plane*/ false);
     update_cfl(/*odd_plane*/ false);
     march_half_so1_alpha<ALPHA>(false);
 }
 
+template <typename T>
 template <size_t ALPHA>
-inline void Euler1DCore::march_half2_alpha()
+inline void BasicEuler1DCore<T>::march_half2_alpha()
 {
     // In the second half step, no treating boundary conditions.
     march_half_so0(/*odd_plane*/ true);
@@ -331,16 +680,226 @@ inline void Euler1DCore::march_half2_alpha()
     march_half_so1_alpha<ALPHA>(true);
 }
 
+template <typename T>
+template <size_t ALPHA>
+inline void BasicEuler1DCore<T>::march_alpha(size_t steps)
+{
+    if (m_block_steps > 1)
+    {
+        for (size_t it = 0; it < steps; it += m_block_steps)
+        {
+            march_block_alpha<ALPHA>(std::min(m_block_steps, steps - it));
+        }
+    }
+    else
+    {
+        for (size_t it = 0; it < steps; ++it)
+        {
+            march_step_alpha<ALPHA>();
+        }
+    }
+    bump_epoch();
+}
+
+template <typename T>
+template <size_t ALPHA, typename F>
+inline void BasicEuler1DCore<T>::run_alpha(size_t steps, size_t every, F && hook)
+{
+    if (0 == every)
+    {
+        march_alpha<ALPHA>(steps);
+        return;
+    }
+    while (steps > 0)
+    {
+        size_t const nmarch = std::min(steps, every - m_nstep % every);
+        march_alpha<ALPHA>(nmarch);
+        steps -= nmarch;
+        if (0 == m_nstep % every)
+        {
+            hook();
+        }
+    }
+}
+
+template <typename T>
+template <size_t ALPHA>
+inline size_t BasicEuler1DCore<T>::record_alpha(size_t steps, size_t every, SimpleArray<T> & time_history, SimpleArray<T> & so0_history)
+{
+    size_t const nsample = 0 == every ? 0 : (m_nstep + steps) / every - m_nstep / every;
+    size_t const ssize = m_so0.size();
+    if (time_history.size() < nsample)
+    {
+        throw std::out_of_range(Formatter() << "Euler1DCore::record_alpha(): time_history size " << time_history.size() << " < nsample " << nsample);
+    }
+    if (so0_history.ndim() < 1 || so0_history.shape(0) < nsample || so0_history.size() != so0_history.shape(0) * ssize)
+    {
+        throw std::out_of_range(Formatter() << "Euler1DCore::record_alpha(): so0_history size " << so0_history.size() << " does not hold " << nsample << " samples of size " << ssize);
+    }
+    size_t isample = 0;
+    run_alpha<ALPHA>(
+        steps,
+        every,
+        [&]()
+        {
+            time_history(isample) = m_time;
+            std::copy_n(m_so0.data(), ssize, so0_history.data() + isample * ssize);
+            ++isample;
+        });
+    return isample;
+}
+
+template <typename T>
+template <size_t ALPHA>
+inline size_t BasicEuler1DCore<T>::stream_alpha(size_t steps, size_t every, SimpleArraySnapshot<T> & snapshot)
+{
+    size_t nsample = 0;
+    run_alpha<ALPHA>(
+        steps,
+        every,
+        [&]()
+        {
+            snapshot.publish(m_so0, static_cast<double>(m_time));
+            ++nsample;
+        });
+    return nsample;
+}
+
+template <typename T>
 template <size_t ALPHA>
-inline void Euler1DCore::march_alpha(size_t steps)
+inline size_t BasicEuler1DCore<T>::monitor_alpha(size_t steps, size_t every, SimpleArrayMonitor<T> & monitor)
 {
-    for (size_t it = 0; it < steps; ++it)
+    size_t nsample = 0;
+    run_alpha<ALPHA>(
+        steps,
+        every,
+        [&]()
+        {
+            monitor.evaluate(m_so0, static_cast<double>(m_time));
+            ++nsample;
+        });
+    return nsample;
+}
+
+template <typename T>
+template <size_t ALPHA>
+inline void BasicEuler1DCore<T>::march_step_alpha()
+{
+    adapt_time_increment();
+    march_half1_alpha<ALPHA>();
+    T const max_cfl = m_max_cfl;
+    treat_boundary_so0();
+    march_half2_alpha<ALPHA>();
+    treat_boundary_so1();
+    m_max_cfl = std::max(max_cfl, m_max_cfl);
+    m_time += m_time_increment;
+    ++m_nstep;
+}
+
+template <typename T>
+inline void BasicEuler1DCore<T>::adapt_time_increment()
+{
+    if (m_target_cfl > 0 && m_max_cfl > 0)
+    {
+        m_time_increment *= m_target_cfl / m_max_cfl;
+    }
+}
+
+template <typename T>
+template <size_t ALPHA>
+inline T BasicEuler1DCore<T>::march_half_alpha_range(size_t xbegin, size_t xend, bool odd_plane)
+{
+    const int_type start = BOUND_COUNT - (odd_plane ? 1 : 0);
+    const int_type stop = static_cast<int_type>(ncoord() - BOUND_COUNT - (odd_plane ? 0 : 1));
+    // The first point of the plane at or after the index.
+    auto const first = [start](int_type index)
+    { return index <= start ? start : index + (index - start) % 2; };
+    // The sweeps write the point next to ic, and update_cfl() the point at ic.
+    int_type const cbegin = first(static_cast<int_type>(xbegin) - 1);
+    int_type const cend = std::min(static_cast<int_type>(xend) - 1, stop);
+    int_type const sbegin = first(static_cast<int_type>(xbegin));
+    int_type const send = std::min(static_cast<int_type>(xend), stop);
+    march_half_so0_range(cbegin, cend);
+    T const ret = update_cfl_range(sbegin, send);
+    march_half_so1_alpha_range<ALPHA>(cbegin, cend);
+    return ret;
+}
+
+/*
+ * Time skewing as SolverBase::march_block_alpha() does.  A point marched h
+ * half steps ahead depends on the points within h, so each tile first marches
+ * a trapezoid that loses a point on each inner side every half step, and the
+ * triangles left between the tiles are filled after.  The boundaries are not
+ * periodic and are treated in the tiles at the two ends.
+ */
+template <typename T>
+template <size_t ALPHA>
+inline void BasicEuler1DCore<T>::march_block_alpha(size_t steps)
+{
+    size_t const nhalf = steps * 2;
+    size_t const ntile = ncoord() / std::max(m_block_width, 2 * nhalf + 4);
+    if (0 == ntile)
+    {
+        for (size_t it = 0; it < steps; ++it)
+        {
+            march_step_alpha<ALPHA>();
+        }
+        return;
+    }
+    auto const edge = [&](size_t itile)
+    { return ncoord() * itile / ntile; };
+    // The time increment is the same for all the steps of the block.
+    adapt_time_increment();
+    // Each tile keeps its maximum, to be reduced after the sweeps.
+    std::vector<T> tile_max(ntile, 0);
+
+    // The trapezoids of the tiles are independent.
+    for_each_tile(
+        ntile,
+        [&](size_t itile)
+        {
+            bool const left = 0 == itile;
+            bool const right = ntile - 1 == itile;
+            size_t const lo = edge(itile);
+            size_t const hi = edge(itile + 1);
+            for (size_t ih = 0; ih < nhalf; ++ih)
+            {
+                T const value = march_half_alpha_range<ALPHA>(left ? lo : lo + ih, right ? hi : hi - ih, /* odd_plane */ ih % 2 != 0);
+                tile_max[itile] = std::max(tile_max[itile], value);
+                // march_alpha() treats so0 after the first half step and so1
+                // after the second.
+                SimpleArray<T> & arr = ih % 2 == 0 ? m_so0 : m_so1;
+                if (left)
+                {
+                    treat_boundary_left(arr);
+                }
+                if (right)
+                {
+                    treat_boundary_right(arr);
+                }
+            }
+        });
+
+    // So are the triangles between them.
+    for_each_tile(
+        ntile - 1,
+        [&](size_t itri)
+        {
+            size_t const mid = edge(itri + 1);
+            for (size_t ih = 0; ih < nhalf; ++ih)
+            {
+                T const value = march_half_alpha_range<ALPHA>(mid - ih, mid + ih, /* odd_plane */ ih % 2 != 0);
+                tile_max[itri] = std::max(tile_max[itri], value);
+            }
+        });
+
+    m_max_cfl = 0;
+    for (T const value : tile_max)
     {
-        march_half1_alpha<ALPHA>();
-        treat_boundary_so0();
-        march_half2_alpha<ALPHA>();
-        treat_boundary_so1();
+        m_max_cfl = std::max(m_max_cfl, value);
     }
+    m_time += m_time_increment * static_cast<T>(steps);
+    m_nstep += steps;
 }
 
 } /* end namespace onedim */
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2022, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/onedim/Euler1DEnsemble.hpp>
+#include <modmesh/toggle/profile.hpp>
+
+namespace modmesh
+{
+
+namespace onedim
+{
+
+Euler1DEnsemble::Euler1DEnsemble(size_t ncoord, size_t ninstance, ctor_passkey const &)
+{
+    if (0 == ncoord % 2)
+    {
+        throw std::invalid_argument("ncoord cannot be even");
+    }
+    m_coord = SimpleArray<double>(/*shape*/ small_vector<size_t>{ncoord}, /*value*/ 0.0);
+    m_time_increment = SimpleArray<double>(/*shape*/ small_vector<size_t>{ninstance}, /*value*/ 0.0);
+    m_gamma = SimpleArray<double>(/*shape*/ small_vector<size_t>{ncoord, ninstance}, /*value*/ 1.4);
+    m_cfl = SimpleArray<double>(/*shape*/ small_vector<size_t>{ncoord, ninstance}, /*value*/ 0.0);
+    small_vector<size_t> const shape{ncoord, NVAR, ninstance};
+    m_so0 = SimpleArray<double>(shape, /*value*/ 0.0);
+    m_so1 = SimpleArray<double>(shape, /*value*/ 0.0);
+    m_flux_ll = SimpleArray<double>(shape);
+    m_flux_lr = SimpleArray<double>(shape);
+    m_up = SimpleArray<double>(shape);
+}
+
+std::shared_ptr<Euler1DCore> Euler1DEnsemble::instance(size_t iinst) const
+{
+    if (iinst >= ninstance())
+    {
+        throw std::out_of_range(Formatter() << "Euler1DEnsemble: instance " << iinst << " >= " << ninstance());
+    }
+    std::shared_ptr<Euler1DCore> ret = Euler1DCore::construct(ncoord(), m_time_increment(iinst));
+    for (size_t it = 0; it < ncoord(); ++it)
+    {
+        ret->coord()(it) = m_coord(it);
+        ret->gamma()(it) = m_gamma(it, iinst);
+        ret->cfl()(it) = m_cfl(it, iinst);
+        for (size_t iv = 0; iv < NVAR; ++iv)
+        {
+            ret->so0()(it, iv) = m_so0(it, iv, iinst);
+            ret->so1()(it, iv) = m_so1(it, iv, iinst);
+        }
+    }
+    return ret;
+}
+
+void Euler1DEnsemble::set_instance(size_t iinst, Euler1DCore const & core)
+{
+    if (iinst >= ninstance())
+    {
+        throw std::out_of_range(Formatter() << "Euler1DEnsemble: instance " << iinst << " >= " << ninstance());
+    }
+    if (core.ncoord() != ncoord())
+    {
+        throw std::invalid_argument(Formatter() << "Euler1DEnsemble: ncoord " << core.ncoord() << " of the core does not match " << ncoord());
+    }
+    m_time_increment(iinst) = core.time_increment();
+    for (size_t it = 0; it < ncoord(); ++it)
+    {
+        m_gamma(it, iinst) = core.gamma()(it);
+        m_cfl(it, iinst) = core.cfl()(it);
+        for (size_t iv = 0; iv < NVAR; ++iv)
+        {
+            m_so0(it, iv, iinst) = core.so0()(it, iv);
+            m_so1(it, iv, iinst) = core.so1()(it, iv);
+        }
+    }
+}
+
+void Euler1DEnsemble::setup_march()
+{
+    MODMESH_TIME("Euler1DEnsemble::setup_march");
+    update_cfl(/*odd_plane*/ false, 0, ninstance());
+}
+
+void Euler1DEnsemble::update_cfl(bool odd_plane, size_t begin, size_t end)
+{
+    size_t const start = BOUND_COUNT - (odd_plane ? 1 : 0);
+    size_t const stop = ncoord() - BOUND_COUNT - (odd_plane ? 0 : 1);
+    size_t const ninst = ninstance();
+    double const * MODMESH_RESTRICT dt = m_time_increment.data();
+    for (size_t it = start; it < stop; it += 2)
+    {
+        double const dxpos = m_coord(it + 1) - m_coord(it);
+        double const dxneg = m_coord(it) - m_coord(it - 1);
+        double const dxmin = dxpos < dxneg ? dxpos : dxneg;
+        double const * MODMESH_RESTRICT gamma = m_gamma.data() + it * ninst;
+        double const * MODMESH_RESTRICT u0 = m_so0.data() + it * NVAR * ninst;
+        double const * MODMESH_RESTRICT u1 = u0 + ninst;
+        double const * MODMESH_RESTRICT u2 = u1 + ninst;
+        double * MODMESH_RESTRICT cfl = m_cfl.data() + it * ninst;
+        for (size_t k = begin; k < end; ++k)
+        {
+            // The same as Euler1DCore::update_cfl().
+            double const ga = gamma[k];
+            double wspd = u1[k];
+            wspd *= wspd;
+            const double ke = wspd / (2.0 * u0[k]);
+            double pr = (ga - 1.0) * (u2[k] - ke);
+            pr = (pr + std::abs(pr)) / 2.0;
+            wspd = std::sqrt(ga * pr / u0[k]) + std::sqrt(wspd) / u0[k];
+            cfl[k] = (dt[k] / 2) * wspd / dxmin;
+        }
+    }
+}
+
+void Euler1DEnsemble::treat_boundary(SimpleArray<double> & arr, size_t begin, size_t end)
+{
+    size_t const last = ncoord() - 1;
+    for (size_t iv = 0; iv < NVAR; ++iv)
+    {
+        for (size_t k = begin; k < end; ++k)
+        {
+            arr(0, iv, k) = arr(2, iv, k);
+            arr(last, iv, k) = arr(last - 2, iv, k);
+        }
+    }
+}
+
+namespace
+{
+
+// The loop body of Euler1DEnsemble::derive(), taking the arrays as restrict
+// arguments for the compiler to vectorize it.
+void derive_instances(
+    size_t begin,
+    size_t end,
+    double dxctr,
+    double deltax_ll,
+    double dxmid_ll,
+    double deltax_lr,
+    double dxmid_lr,
+    double const * MODMESH_RESTRICT dt,
+    double const * MODMESH_RESTRICT gamma,
+    double const * MODMESH_RESTRICT u0,
+    double const * MODMESH_RESTRICT u1,
+    double const * MODMESH_RESTRICT u2,
+    double const * MODMESH_RESTRICT ux0,
+    double const * MODMESH_RESTRICT ux1,
+    double const * MODMESH_RESTRICT ux2,
+    double * MODMESH_RESTRICT ll0,
+    double * MODMESH_RESTRICT ll1,
+    double * MODMESH_RESTRICT ll2,
+    double * MODMESH_RESTRICT lr0,
+    double * MODMESH_RESTRICT lr1,
+    double * MODMESH_RESTRICT lr2,
+    double * MODMESH_RESTRICT up0,
+    double * MODMESH_RESTRICT up1,
+    double * MODMESH_RESTRICT up2)
+{
+    constexpr double tiny = Euler1DKernel::tiny;
+    for (size_t k = begin; k < end; ++k)
+    {
+        // The same operations as Euler1DKernel::derive(), calc_flux_ll() and
+        // calc_flux_lr(), for the same result.
+        double const ga = gamma[k];
+        double const hdt = dt[k] / 2.0;
+        double const qdt = hdt / 2.0;
+        double const v0 = u0[k];
+        double const v1 = u1[k];
+        double const v2 = u2[k];
+        double const vx0 = ux0[k];
+        double const vx1 = ux1[k];
+        double const vx2 = ux2[k];
+
+        double const j00 = 0.0;
+        double const j01 = 1.0;
+        double const j02 = 0.0;
+        double const j10 = (ga - 3.0) / 2.0 * v1 * v1 / (v0 * v0 + tiny);
+        double const j11 = -(ga - 3.0) * v1 / (v0 + tiny);
+        double const j12 = ga - 1.0;
+        double const j20 = (ga - 1.0) * v1 * v1 * v1 / (v0 * v0 * v0 + tiny) - ga * v1 * v2 / (v0 * v0 + tiny);
+        double const j21 = ga * v2 / (v0 + tiny) - 3.0 / 2.0 * (ga - 1.0) * v1 * v1 / (v0 * v0 + tiny);
+        double const j22 = ga * v1 / (v0 + tiny);
+
+        double const f0 = v1;
+        double const f1 = (ga - 1.0) * v2 + (3.0 - ga) / 2.0 * v1 * v1 / (v0 + tiny);
+        double const f2 = ga * v1 * v2 / (v0 + tiny) - (ga - 1.0) / 2.0 * v1 * v1 * v1 / (v0 * v0 + tiny);
+
+        double const ut0 = -j00 * vx0 - j01 * vx1 - j02 * vx2;
+        double const ut1 = -j10 * vx0 - j11 * vx1 - j12 * vx2;
+        double const ut2 = -j20 * vx0 - j21 * vx1 - j22 * vx2;
+
+        double const ft0 = j00 * ut0 + j01 * ut1 + j02 * ut2;
+        double const ft1 = j10 * ut0 + j11 * ut1 + j12 * ut2;
+        double const ft2 = j20 * ut0 + j21 * ut1 + j22 * ut2;
+
+        double const tflux0 = hdt * (f0 - (dxctr * ut0) + (qdt * ft0));
+        double const tflux1 = hdt * (f1 - (dxctr * ut1) + (qdt * ft1));
+        double const tflux2 = hdt * (f2 - (dxctr * ut2) + (qdt * ft2));
+        ll0[k] = deltax_ll * (v0 + dxmid_ll * vx0) + tflux0;
+        ll1[k] = deltax_ll * (v1 + dxmid_ll * vx1) + tflux1;
+        ll2[k] = deltax_ll * (v2 + dxmid_ll * vx2) + tflux2;
+        lr0[k] = deltax_lr * (v0 + dxmid_lr * vx0) - tflux0;
+        lr1[k] = deltax_lr * (v1 + dxmid_lr * vx1) - tflux1;
+        lr2[k] = deltax_lr * (v2 + dxmid_lr * vx2) - tflux2;
+        up0[k] = v0 + dxctr * vx0 /* displacement in x */ + hdt * ut0 /* displacement in t */;
+        up1[k] = v1 + dxctr * vx1 /* displacement in x */ + hdt * ut1 /* displacement in t */;
+        up2[k] = v2 + dxctr * vx2 /* displacement in x */ + hdt * ut2 /* displacement in t */;
+    }
+}
+
+} /* end namespace */
+
+void Euler1DEnsemble::derive(size_t ic, size_t begin, size_t end)
+{
+    size_t const ninst = ninstance();
+    size_t const offset = ic * NVAR * ninst;
+    double const x = m_coord(ic);
+    double const xneg = m_coord(ic - 1);
+    double const xpos = m_coord(ic + 1);
+    double const xctr = (xpos + xneg) * 0.5;
+    double const * u = m_so0.data() + offset;
+    double const * ux = m_so1.data() + offset;
+    double * ll = m_flux_ll.data() + offset;
+    double * lr = m_flux_lr.data() + offset;
+    double * up = m_up.data() + offset;
+    derive_instances(
+        begin,
+        end,
+        /* dxctr */ x - xctr,
+        /* deltax_ll */ xpos - x,
+        /* dxmid_ll */ 0.5 * (x + xpos) - xctr,
+        /* deltax_lr */ x - xneg,
+        /* dxmid_lr */ 0.5 * (x + xneg) - xctr,
+        m_time_increment.data(),
+        m_gamma.data() + ic * ninst,
+        u,
+        u + ninst,
+        u + 2 * ninst,
+        ux,
+        ux + ninst,
+        ux + 2 * ninst,
+        ll,
+        ll + ninst,
+        ll + 2 * ninst,
+        lr,
+        lr + ninst,
+        lr + 2 * ninst,
+        up,
+        up + ninst,
+        up + 2 * ninst);
+}
+
+} /* end namespace onedim */
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,232 @@
+#pragma once
+
+/*
+ * Copyright (c) 2022, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/onedim/Euler1DCore.hpp>
+
+namespace modmesh
+{
+
+namespace onedim
+{
+
+/**
+ * Many instances of Euler1DCore on the same grid, marched together.  The
+ * instance is the innermost dimension of the arrays, so that the loops over
+ * the instances are vectorized, and the instances are split over ThreadPool.
+ * Each instance has its own time increment, heat capacity ratio and
+ * solution, and gives the same result as an Euler1DCore.
+ */
+class Euler1DEnsemble
+    : public std::enable_shared_from_this<Euler1DEnsemble>
+{
+
+public:
+
+    static constexpr size_t BOUND_COUNT = Euler1DCore::BOUND_COUNT;
+    static constexpr uint8_t NVAR = Euler1DCore::NVAR;
+
+private:
+
+    struct ctor_passkey
+    {
+    };
+
+public:
+
+    template <class... Args>
+    static std::shared_ptr<Euler1DEnsemble> construct(Args &&... args)
+    {
+        return std::make_shared<Euler1DEnsemble>(std::forward<Args>(args)..., ctor_passkey());
+    }
+
+    Euler1DEnsemble(size_t ncoord, size_t ninstance, ctor_passkey const &);
+
+    Euler1DEnsemble() = delete;
+    Euler1DEnsemble(Euler1DEnsemble const &) = default;
+    Euler1DEnsemble(Euler1DEnsemble &&) = default;
+    Euler1DEnsemble & operator=(Euler1DEnsemble const &) = default;
+    Euler1DEnsemble & operator=(Euler1DEnsemble &&) = default;
+    ~Euler1DEnsemble() = default;
+
+    size_t ncoord() const { return m_coord.size(); }
+    size_t ninstance() const { return m_time_increment.size(); }
+    /// Number of the steps marched by march_alpha().
+    size_t nstep() const { return m_nstep; }
+
+    /// The coordinates shared by all the instances, in the shape (ncoord).
+    SimpleArray<double> const & coord() const { return m_coord; }
+    SimpleArray<double> & coord() { return m_coord; }
+
+    /// In the shape (ninstance).
+    SimpleArray<double> const & time_increment() const { return m_time_increment; }
+    SimpleArray<double> & time_increment() { return m_time_increment; }
+
+    /// In the shape (ncoord, ninstance).
+    SimpleArray<double> const & gamma() const { return m_gamma; }
+    SimpleArray<double> & gamma() { return m_gamma; }
+
+    /// In the shape (ncoord, ninstance).
+    SimpleArray<double> const & cfl() const { return m_cfl; }
+    SimpleArray<double> & cfl() { return m_cfl; }
+
+    /// In the shape (ncoord, NVAR, ninstance).
+    SimpleArray<double> const & so0() const { return m_so0; }
+    SimpleArray<double> & so0() { return m_so0; }
+
+    /// In the shape (ncoord, NVAR, ninstance).
+    SimpleArray<double> const & so1() const { return m_so1; }
+    SimpleArray<double> & so1() { return m_so1; }
+
+    /// Whether march_alpha() splits the instances over ThreadPool.
+    bool parallel() const { return m_parallel; }
+    void set_parallel(bool value) { m_parallel = value; }
+
+    /// Copy an instance out as an Euler1DCore (the step counter excluded).
+    std::shared_ptr<Euler1DCore> instance(size_t iinst) const;
+    /// Copy the state of an Euler1DCore into an instance.  The coordinates
+    /// are shared and not copied.
+    void set_instance(size_t iinst, Euler1DCore const & core);
+
+    void setup_march();
+    template <size_t ALPHA>
+    void march_alpha(size_t steps);
+
+private:
+
+    // The steps of Euler1DCore::march_alpha() for the instances [begin, end).
+    void update_cfl(bool odd_plane, size_t begin, size_t end);
+    template <size_t ALPHA>
+    void march_half_alpha(bool odd_plane, size_t begin, size_t end);
+    void treat_boundary(SimpleArray<double> & arr, size_t begin, size_t end);
+    // The fluxes and the derived variables of the SE at ic.
+    void derive(size_t ic, size_t begin, size_t end);
+
+    size_t m_nstep = 0;
+    bool m_parallel = true;
+    SimpleArray<double> m_coord;
+    SimpleArray<double> m_time_increment;
+    SimpleArray<double> m_gamma;
+    SimpleArray<double> m_cfl;
+    SimpleArray<double> m_so0;
+    SimpleArray<double> m_so1;
+    // Per SE, in the shape of so0: the fluxes through its left and right
+    // sides, and the variables at the CE center.
+    SimpleArray<double> m_flux_ll;
+    SimpleArray<double> m_flux_lr;
+    SimpleArray<double> m_up;
+}; /* end class Euler1DEnsemble */
+
+template <size_t ALPHA>
+inline void Euler1DEnsemble::march_half_alpha(bool odd_plane, size_t begin, size_t end)
+{
+    size_t const start = BOUND_COUNT - (odd_plane ? 1 : 0);
+    size_t const stop = ncoord() - BOUND_COUNT - (odd_plane ? 0 : 1);
+    if (start >= stop)
+    {
+        return;
+    }
+    // Each SE is shared by the two CEs next to it.
+    for (size_t ic = start; ic < stop + 2; ic += 2)
+    {
+        derive(ic, begin, end);
+    }
+
+    size_t const ninst = ninstance();
+    double const * MODMESH_RESTRICT coord = m_coord.data();
+    double const * MODMESH_RESTRICT flux_ll = m_flux_ll.data();
+    double const * MODMESH_RESTRICT flux_lr = m_flux_lr.data();
+    double const * MODMESH_RESTRICT up = m_up.data();
+    double * MODMESH_RESTRICT so0 = m_so0.data();
+    double * MODMESH_RESTRICT so1 = m_so1.data();
+    for (size_t ic = start; ic < stop; ic += 2)
+    {
+        double const dx = coord[ic + 2] - coord[ic];
+        double const dxn = coord[ic + 1] - coord[ic];
+        double const dxp = coord[ic + 2] - coord[ic + 1];
+        for (size_t iv = 0; iv < NVAR; ++iv)
+        {
+            size_t const in = (ic * NVAR + iv) * ninst;
+            size_t const it = ((ic + 1) * NVAR + iv) * ninst;
+            size_t const ip = ((ic + 2) * NVAR + iv) * ninst;
+            for (size_t k = begin; k < end; ++k)
+            {
+                double const utp = (flux_ll[in + k] + flux_lr[ip + k]) / dx;
+                double const duxn = (utp - up[in + k]) / dxn;
+                double const duxp = (up[ip + k] - utp) / dxp;
+                double const fan = pow<ALPHA>(std::abs(duxn));
+                double const fap = pow<ALPHA>(std::abs(duxp));
+                so0[it + k] = utp;
+                so1[it + k] = (fap * duxn + fan * duxp) / (fap + fan + Euler1DKernel::tiny);
+            }
+        }
+    }
+    update_cfl(odd_plane, begin, end);
+}
+
+template <size_t ALPHA>
+inline void Euler1DEnsemble::march_alpha(size_t steps)
+{
+    size_t const ninst = ninstance();
+    ThreadPool & pool = ThreadPool::instance();
+    bool const parallel = m_parallel && pool.use_parallel(ncoord() * ninst * steps);
+    // Blocks of a multiple of 8 instances, so that the vectors do not cross
+    // the blocks.
+    size_t const nblock = parallel ? std::min(pool.nthread(), (ninst + 7) / 8) : 1;
+    auto const edge = [&](size_t iblock)
+    { return iblock == nblock ? ninst : std::min(ninst, (ninst * iblock / nblock + 7) / 8 * 8); };
+    // The instances are independent, and each block marches all the steps
+    // without waiting for the others.
+    auto const body = [&](size_t iblock)
+    {
+        size_t const begin = edge(iblock);
+        size_t const end = edge(iblock + 1);
+        for (size_t it = 0; it < steps; ++it)
+        {
+            march_half_alpha<ALPHA>(/*odd_plane*/ false, begin, end);
+            treat_boundary(m_so0, begin, end);
+            march_half_alpha<ALPHA>(/*odd_plane*/ true, begin, end);
+            treat_boundary(m_so1, begin, end);
+        }
+    };
+    if (nblock > 1)
+    {
+        pool.run(nblock, body);
+    }
+    else
+    {
+        body(0);
+    }
+    m_nstep += steps;
+}
+
+} /* end namespace onedim */
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
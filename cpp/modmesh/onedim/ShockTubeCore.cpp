@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <modmesh/onedim/ShockTubeCore.hpp>
+#include <modmesh/toggle/profile.hpp>
+
+#include <cmath>
+
+namespace modmesh
+{
+
+namespace onedim
+{
+
+ShockTubeCore::ShockTubeCore(double gamma, double pressure1, double density1, double pressure5, double density5, ctor_passkey const &)
+    : m_gamma(gamma)
+{
+    if (!(gamma > 1.0))
+    {
+        throw std::invalid_argument(Formatter() << "ShockTubeCore: gamma " << gamma << " must be greater than 1");
+    }
+    if (!(pressure1 > 0.0 && density1 > 0.0 && pressure5 > 0.0 && density5 > 0.0))
+    {
+        throw std::invalid_argument("ShockTubeCore: pressure and density must be positive");
+    }
+
+    Zone const zone1 = make_zone(density1, 0.0, pressure1);
+    Zone const zone5 = make_zone(density5, 0.0, pressure5);
+
+    // Zone 4 is behind the normal shock.
+    double const p45 = calc_pressure45(gamma, pressure1, density1, pressure5, density5);
+    double const gpn1 = (gamma + 1) / (gamma - 1);
+    double const rho45 = (1 + gpn1 * p45) / (gpn1 + p45);
+    double const velocity4 = zone5.speedofsound / gamma * (p45 - 1) * std::sqrt(2 * gamma / (gamma + 1) / (p45 + (gamma - 1) / (gamma + 1)));
+    Zone const zone4 = make_zone(rho45 * density5, velocity4, p45 * pressure5);
+    m_pressure45 = p45;
+    m_velocity_shock = zone5.speedofsound * std::sqrt((gamma + 1) / (2 * gamma) * (p45 - 1) + 1);
+
+    // Zone 3 has the velocity and pressure of zone 4, and the density at the
+    // tail of the expansion wave.
+    double const ratio = 1 - (gamma - 1) / 2 * (velocity4 / zone1.speedofsound);
+    Zone const zone3 = make_zone(density1 * std::pow(ratio, 2 / (gamma - 1)), velocity4, zone4.pressure);
+
+    m_zones = {zone1, zone3, zone4, zone5};
+}
+
+double ShockTubeCore::calc_pressure45(
+    double gamma,
+    double pressure1,
+    double density1,
+    double pressure5,
+    double density5,
+    double tolerance,
+    size_t maxiter)
+{
+    double const p15 = pressure1 / pressure5;
+    // The ratio of the speeds of sound a5/a1.
+    double const a51 = std::sqrt(pressure5 / density5) / std::sqrt(pressure1 / density1);
+    auto const residue_of = [&](double p45)
+    {
+        double const v = p45 - 1;
+        double const nume = (gamma - 1) * a51 * v;
+        double const deno = std::sqrt(2 * gamma * (2 * gamma + (gamma + 1) * v));
+        return p15 - p45 * std::pow(1 - nume / deno, -2 * gamma / (gamma - 1));
+    };
+
+    double p45prev = p15;
+    double residue_prev = residue_of(p45prev);
+    double p45 = p45prev / 2;
+    double residue = residue_of(p45);
+    double slope = (residue - residue_prev) / (p45 - p45prev);
+    for (size_t count = maxiter; std::abs(residue) > tolerance && count > 0; --count)
+    {
+        p45prev = p45;
+        p45 -= residue / slope;
+        residue_prev = residue;
+        residue = residue_of(p45);
+        slope = (residue - residue_prev) / (p45 - p45prev);
+    }
+    return p45;
+}
+
+ShockTubeCore::Zone const & ShockTubeCore::zone(size_t index) const
+{
+    switch (index)
+    {
+    case 1: return m_zones[0];
+    case 3: return m_zones[1];
+    case 4: return m_zones[2];
+    case 5: return m_zones[3];
+    default: throw std::out_of_range(Formatter() << "ShockTubeCore: zone " << index << " is not 1, 3, 4, or 5");
+    }
+}
+
+std::array<double, 4> ShockTubeCore::locations(double t) const
+{
+    Zone const & zone1 = m_zones[0];
+    Zone const & zone3 = m_zones[1];
+    return {
+        // The head of the expansion wave moves at the speed of sound in zone 1.
+        -zone1.speedofsound * t,
+        // The tail of the expansion wave.
+        (zone3.velocity - zone3.speedofsound) * t,
+        // The contact surface moves at v3 = v4.
+        zone3.velocity * t,
+        m_velocity_shock * t};
+}
+
+void ShockTubeCore::build_field(
+    double t,
+    SimpleArray<double> const & coord,
+    SimpleArray<double> * density,
+    SimpleArray<double> * velocity,
+    SimpleArray<double> * pressure,
+    SimpleArray<double> * temperature,
+    SimpleArray<double> * internal_energy,
+    SimpleArray<double> * entropy) const
+{
+    MODMESH_TIME("ShockTubeCore::build_field");
+    if (t < 0.0)
+    {
+        throw std::invalid_argument(Formatter() << "ShockTubeCore::build_field(): negative time " << t);
+    }
+    size_t const npoint = coord.size();
+    // The null arrays are left null.
+    auto const data = [npoint](SimpleArray<double> * arr, char const * name) -> double *
+    {
+        if (nullptr == arr)
+        {
+            return nullptr;
+        }
+        if (arr->size() != npoint)
+        {
+            throw std::out_of_range(Formatter() << "ShockTubeCore::build_field(): " << name << " size " << arr->size() << " != coord size " << npoint);
+        }
+        return arr->data();
+    };
+    double * const rho_out = data(density, "density");
+    double * const v_out = data(velocity, "velocity");
+    double * const p_out = data(pressure, "pressure");
+    double * const t_out = data(temperature, "temperature");
+    double * const ie_out = data(internal_energy, "internal_energy");
+    double * const s_out = data(entropy, "entropy");
+
+    std::array<double, 4> const loc = locations(t);
+    double const ga = m_gamma;
+    Zone const & zone1 = m_zones[0];
+    double const * const crd = coord.data();
+    parallel_for_chunks(
+        npoint,
+        m_parallel && ThreadPool::instance().use_parallel(npoint),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t it = begin; it < end; ++it)
+            {
+                double const x = crd[it];
+                Zone zone;
+                if (x >= loc[0] && x < loc[1])
+                {
+                    // The expansion wave.  It is empty at t = 0.
+                    double const v2 = 2 / (ga + 1) * (zone1.speedofsound + x / t);
+                    double const ratio = 1 - (ga - 1) / 2 * (v2 / zone1.speedofsound);
+                    zone.velocity = v2;
+                    zone.pressure = zone1.pressure * std::pow(ratio, 2 * ga / (ga - 1));
+                    zone.density = zone1.density * std::pow(ratio, 2 / (ga - 1));
+                    zone.temperature = zone1.temperature * (ratio * ratio);
+                    zone.internal_energy = zone.pressure / (zone.density * (ga - 1));
+                    zone.entropy = zone.pressure / std::pow(zone.density, ga);
+                }
+                else
+                {
+                    zone = m_zones[(x < loc[0]) ? 0 : (x < loc[2]) ? 1 : (x < loc[3]) ? 2 : 3];
+                }
+                if (rho_out)
+                {
+                    rho_out[it] = zone.density;
+                }
+                if (v_out)
+                {
+                    v_out[it] = zone.velocity;
+                }
+                if (p_out)
+                {
+                    p_out[it] = zone.pressure;
+                }
+                if (t_out)
+                {
+                    t_out[it] = zone.temperature;
+                }
+                if (ie_out)
+                {
+                    ie_out[it] = zone.internal_energy;
+                }
+                if (s_out)
+                {
+                    s_out[it] = zone.entropy;
+                }
+            }
+        });
+    for (SimpleArray<double> * arr : {density, velocity, pressure, temperature, internal_energy, entropy})
+    {
+        if (arr)
+        {
+            arr->bump_epoch();
+        }
+    }
+}
+
+ShockTubeCore::Zone ShockTubeCore::make_zone(double density, double velocity, double pressure) const
+{
+    Zone ret;
+    ret.density = density;
+    ret.velocity = velocity;
+    ret.pressure = pressure;
+    ret.temperature = pressure / (density * R);
+    ret.internal_energy = pressure / (density * (m_gamma - 1));
+    ret.entropy = pressure / std::pow(density, m_gamma);
+    ret.speedofsound = std::sqrt(m_gamma * pressure / density);
+    return ret;
+}
+
+} /* end namespace onedim */
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
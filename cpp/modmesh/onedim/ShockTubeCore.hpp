@@ -0,0 +1,152 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/base.hpp>
+#include <modmesh/buffer/buffer.hpp>
+
+#include <array>
+#include <memory>
+
+namespace modmesh
+{
+
+namespace onedim
+{
+
+/**
+ * Exact solution of the shock tube: the Riemann problem of a perfect gas at
+ * rest on both sides of a diaphragm at x = 0.  Zone 1 is on the left and
+ * zone 5 on the right; the expansion wave is zone 2, and zones 3 and 4 are
+ * separated by the contact surface.  See Modern Compressible Flow: With
+ * Historical Perspective, 3/e, 2003, by J D Anderson.
+ */
+class ShockTubeCore
+    : public std::enable_shared_from_this<ShockTubeCore>
+{
+
+public:
+
+    static constexpr double R = 8.31446261815324;
+
+    /// The constant state of a zone.
+    struct Zone
+    {
+        double density = 0.0;
+        double velocity = 0.0;
+        double pressure = 0.0;
+        double temperature = 0.0;
+        double internal_energy = 0.0;
+        double entropy = 0.0;
+        double speedofsound = 0.0;
+    }; /* end struct Zone */
+
+private:
+
+    struct ctor_passkey
+    {
+    };
+
+public:
+
+    template <class... Args>
+    static std::shared_ptr<ShockTubeCore> construct(Args &&... args)
+    {
+        return std::make_shared<ShockTubeCore>(std::forward<Args>(args)..., ctor_passkey());
+    }
+
+    ShockTubeCore(double gamma, double pressure1, double density1, double pressure5, double density5, ctor_passkey const &);
+
+    ShockTubeCore() = delete;
+    ShockTubeCore(ShockTubeCore const &) = default;
+    ShockTubeCore(ShockTubeCore &&) = default;
+    ShockTubeCore & operator=(ShockTubeCore const &) = default;
+    ShockTubeCore & operator=(ShockTubeCore &&) = default;
+    ~ShockTubeCore() = default;
+
+    /**
+     * Solve the shock strength p4/p5 by the secant method.
+     *
+     * @param[in] tolerance convergence tolerance of the residue.
+     * @param[in] maxiter   maximum number of the iterations.
+     */
+    static double calc_pressure45(
+        double gamma,
+        double pressure1,
+        double density1,
+        double pressure5,
+        double density5,
+        double tolerance = 1.e-10,
+        size_t maxiter = 50);
+
+    double gamma() const { return m_gamma; }
+    /// The shock strength p4/p5.
+    double pressure45() const { return m_pressure45; }
+    double velocity_shock() const { return m_velocity_shock; }
+    /// The state of the constant zone 1, 3, 4, or 5.
+    Zone const & zone(size_t index) const;
+
+    /// The boundaries of the zones 1|2, 2|3, 3|4 and 4|5 at time t.
+    std::array<double, 4> locations(double t) const;
+
+    /**
+     * Fill the solution at time t on the coordinates.  A null array is not
+     * calculated.  The points are calculated in one pass over the chunks of
+     * ThreadPool, without sorting them into the zones.
+     */
+    void build_field(
+        double t,
+        SimpleArray<double> const & coord,
+        SimpleArray<double> * density,
+        SimpleArray<double> * velocity,
+        SimpleArray<double> * pressure,
+        SimpleArray<double> * temperature,
+        SimpleArray<double> * internal_energy,
+        SimpleArray<double> * entropy) const;
+
+    /// Whether build_field() splits the points over ThreadPool.
+    bool parallel() const { return m_parallel; }
+    void set_parallel(bool value) { m_parallel = value; }
+
+private:
+
+    Zone make_zone(double density, double velocity, double pressure) const;
+
+    bool m_parallel = true;
+    double m_gamma;
+    double m_pressure45 = 0.0;
+    double m_velocity_shock = 0.0;
+    // Zones 1, 3, 4, and 5; zone 2 is not constant.
+    std::array<Zone, 4> m_zones;
+}; /* end class ShockTubeCore */
+
+} /* end namespace onedim */
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
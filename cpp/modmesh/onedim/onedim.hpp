@@ -10,5 +10,7 @@
  */
 
 #include <modmesh/onedim/Euler1DCore.hpp>
+#include <modmesh/onedim/Euler1DEnsemble.hpp>
+#include <modmesh/onedim/ShockTubeCore.hpp>
 
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -29,6 +29,12 @@
 #include <modmesh/python/common.hpp> // Must be the first include.
 
 #include <modmesh/onedim/onedim.hpp>
+#ifdef MODMESH_METAL_KERNELS
+#include <modmesh/device/metal/Euler1DMetal.hpp>
+#endif // MODMESH_METAL_KERNELS
+
+#include <algorithm>
+#include <optional>
 
 namespace modmesh
 {
@@ -38,13 +44,14 @@ namespace python
 
 using namespace modmesh::onedim; // NOLINT(google-build-using-namespace)
 
+template <typename T>
 class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapEuler1DCore
-    : public WrapBase<WrapEuler1DCore, Euler1DCore, std::shared_ptr<Euler1DCore>>
+    : public WrapBase<WrapEuler1DCore<T>, BasicEuler1DCore<T>, std::shared_ptr<BasicEuler1DCore<T>>>
 {
 
 public:
 
-    using base_type = WrapBase<WrapEuler1DCore, Euler1DCore, std::shared_ptr<Euler1DCore>>;
+    using base_type = WrapBase<WrapEuler1DCore<T>, BasicEuler1DCore<T>, std::shared_ptr<BasicEuler1DCore<T>>>;
     using wrapper_type = typename base_type::wrapper_type;
     using wrapped_type = typename base_type::wrapped_type;
 
@@ -61,7 +68,7 @@ protected:
         (*this)
             .def(
                 py::init(
-                    [](size_t ncoord, double time_increment)
+                    [](size_t ncoord, T time_increment)
                     {
                         return wrapped_type::construct(ncoord, time_increment);
                     }),
@@ -73,8 +80,32 @@ protected:
                 "nvar",
                 [](py::handle const &)
                 { return size_t(wrapped_type::NVAR); })
-            .def_property_readonly("time_increment", &wrapped_type::time_increment)
-            .def_property_readonly("ncoord", &wrapped_type::ncoord);
+            .def_property("time_increment", &wrapped_type::time_increment, &wrapped_type::set_time_increment)
+            .def_property_readonly("ncoord", &wrapped_type::ncoord)
+            .def_property_readonly("nstep", &wrapped_type::nstep)
+            .def_property_readonly("time", &wrapped_type::time)
+            .def_property_readonly("max_cfl", &wrapped_type::max_cfl)
+            .def_property("target_cfl", &wrapped_type::target_cfl, &wrapped_type::set_target_cfl)
+            .def_property("block_steps", &wrapped_type::block_steps, &wrapped_type::set_block_steps)
+            .def_property("block_width", &wrapped_type::block_width, &wrapped_type::set_block_width)
+            .def_property("parallel", &wrapped_type::parallel, &wrapped_type::set_parallel);
+
+        (*this)
+            .def_timed("checkpoint", &wrapped_type::checkpoint)
+            .def(
+                "restore",
+                [](wrapped_type & self, Checkpoint const & checkpoint)
+                { self.restore(checkpoint); },
+                py::arg("checkpoint"))
+            .def_static(
+                "restart",
+                [](std::string const & path, bool mmap)
+                {
+                    py::gil_scoped_release const release;
+                    return wrapped_type::restart(Checkpoint::load(path, mmap));
+                },
+                py::arg("path"),
+                py::arg("mmap") = true);
 
         (*this)
             .def_property_readonly(
@@ -100,7 +131,44 @@ protected:
             .def_property_readonly(
                 "entropy",
                 [](wrapped_type & self)
-                { return to_ndarray(self.entropy()); });
+                { return to_ndarray(self.entropy()); })
+            .def_timed(
+                "fill_quantities",
+                [](wrapped_type & self, py::object const & density, py::object const & velocity, py::object const & pressure, py::object const & temperature, py::object const & internal_energy, py::object const & entropy)
+                {
+                    // None skips the quantity.  The others are written in
+                    // place, so they must be of the value type and not
+                    // converted.
+                    auto const make = [](py::object const & obj, char const * name)
+                    {
+                        std::optional<SimpleArray<T>> ret;
+                        if (!obj.is_none())
+                        {
+                            if (!py::isinstance<py::array_t<T>>(obj))
+                            {
+                                throw py::type_error(Formatter() << name << " must be a " << (std::is_same_v<T, float> ? "float32" : "float64") << " array");
+                            }
+                            auto arr = obj.cast<py::array_t<T>>();
+                            ret = makeWritableSimpleArray(arr, name);
+                        }
+                        return ret;
+                    };
+                    auto rho = make(density, "density");
+                    auto v = make(velocity, "velocity");
+                    auto p = make(pressure, "pressure");
+                    auto t = make(temperature, "temperature");
+                    auto ie = make(internal_energy, "internal_energy");
+                    auto ent = make(entropy, "entropy");
+                    auto const ptr = [](std::optional<SimpleArray<T>> & arr)
+                    { return arr ? &*arr : nullptr; };
+                    self.fill_quantities(ptr(rho), ptr(v), ptr(p), ptr(t), ptr(ie), ptr(ent));
+                },
+                py::arg("density") = py::none(),
+                py::arg("velocity") = py::none(),
+                py::arg("pressure") = py::none(),
+                py::arg("temperature") = py::none(),
+                py::arg("internal_energy") = py::none(),
+                py::arg("entropy") = py::none());
 
         (*this)
             .def_property_readonly(
@@ -126,16 +194,65 @@ protected:
                 [](wrapped_type & self)
                 { return to_ndarray(self.so1()); });
 
+        using input_type = py::array_t<T, py::array::c_style | py::array::forcecast>;
+        // The input arrays are only read, but SimpleArray views the
+        // writeable ones.
+        auto const make_input = [](input_type arr)
+        {
+            if (!arr.writeable())
+            {
+                arr = input_type(arr.attr("copy")());
+            }
+            return makeSimpleArray(arr);
+        };
+
         (*this)
-            .def_timed("update_cfl", &wrapped_type::update_cfl, py::arg("odd_plane"))
-            .def_timed("march_half_so0", &wrapped_type::march_half_so0, py::arg("odd_plane"))
-            .def_timed("treat_boundary_so0", &wrapped_type::treat_boundary_so0)
-            .def_timed("treat_boundary_so1", &wrapped_type::treat_boundary_so1)
-            .def_timed("setup_march", &wrapped_type::setup_march);
+            .def_timed(
+                "set_coord",
+                &wrapped_type::set_coord,
+                py::arg("xmin"),
+                py::arg("xmax"),
+                py::arg("ratio") = T(1),
+                py::call_guard<py::gil_scoped_release>())
+            .def_timed(
+                "set_primitive",
+                [make_input](wrapped_type & self, input_type const & density, input_type const & velocity, input_type const & pressure)
+                {
+                    SimpleArray<T> const rho = make_input(density);
+                    SimpleArray<T> const v = make_input(velocity);
+                    SimpleArray<T> const p = make_input(pressure);
+                    py::gil_scoped_release const release;
+                    self.set_primitive(rho, v, p);
+                },
+                py::arg("density"),
+                py::arg("velocity"),
+                py::arg("pressure"))
+            .def_timed(
+                "set_piecewise_primitive",
+                [make_input](wrapped_type & self, input_type const & boundaries, input_type const & density, input_type const & velocity, input_type const & pressure)
+                {
+                    SimpleArray<T> const bound = make_input(boundaries);
+                    SimpleArray<T> const rho = make_input(density);
+                    SimpleArray<T> const v = make_input(velocity);
+                    SimpleArray<T> const p = make_input(pressure);
+                    py::gil_scoped_release const release;
+                    self.set_piecewise_primitive(bound, rho, v, p);
+                },
+                py::arg("boundaries"),
+                py::arg("density"),
+                py::arg("velocity"),
+                py::arg("pressure"));
+
+        (*this)
+            .def_timed("update_cfl", &wrapped_type::update_cfl, py::arg("odd_plane"), py::call_guard<py::gil_scoped_release>())
+            .def_timed("march_half_so0", &wrapped_type::march_half_so0, py::arg("odd_plane"), py::call_guard<py::gil_scoped_release>())
+            .def_timed("treat_boundary_so0", &wrapped_type::treat_boundary_so0, py::call_guard<py::gil_scoped_release>())
+            .def_timed("treat_boundary_so1", &wrapped_type::treat_boundary_so1, py::call_guard<py::gil_scoped_release>())
+            .def_timed("setup_march", &wrapped_type::setup_march, py::call_guard<py::gil_scoped_release>());
 
         (*this)
-            .def_group_so1<1>()
-            .def_group_so1<2>();
+            .template def_group_so1<1>()
+            .template def_group_so1<2>();
     }
 
     template <size_t ALPHA>
@@ -151,37 +268,374 @@ protected:
                 {
                     return self.template march_half_so1_alpha<ALPHA>(odd_plane);
                 },
-                py::arg("odd_plane"))
+                py::arg("odd_plane"),
+                py::call_guard<py::gil_scoped_release>())
             .def_timed(
                 (Formatter() << "march_half1_alpha" << ALPHA).str().c_str(),
                 [](wrapped_type & self)
                 {
                     self.template march_half1_alpha<ALPHA>();
-                })
+                },
+                py::call_guard<py::gil_scoped_release>())
             .def_timed(
                 (Formatter() << "march_half2_alpha" << ALPHA).str().c_str(),
                 [](wrapped_type & self)
                 {
                     self.template march_half2_alpha<ALPHA>();
-                })
+                },
+                py::call_guard<py::gil_scoped_release>())
             .def_timed(
                 (Formatter() << "march_alpha" << ALPHA).str().c_str(),
                 [](wrapped_type & self, size_t steps)
                 {
                     self.template march_alpha<ALPHA>(steps);
                 },
-                py::arg("steps"));
+                py::arg("steps"),
+                py::call_guard<py::gil_scoped_release>())
+            .def_timed(
+                (Formatter() << "run_alpha" << ALPHA).str().c_str(),
+                [](wrapped_type & self, size_t steps, size_t every, py::function const & hook)
+                {
+                    py::gil_scoped_release const release;
+                    self.template run_alpha<ALPHA>(
+                        steps,
+                        every,
+                        [&]()
+                        {
+                            py::gil_scoped_acquire const acquire;
+                            hook();
+                        });
+                },
+                py::arg("steps"),
+                py::arg("every"),
+                py::arg("hook"))
+            .def_timed(
+                (Formatter() << "record_alpha" << ALPHA).str().c_str(),
+                [](wrapped_type & self, size_t steps, size_t every, py::array_t<T> & time_history, py::array_t<T> & so0_history)
+                {
+                    auto thist = makeWritableSimpleArray(time_history, "time_history");
+                    auto shist = makeWritableSimpleArray(so0_history, "so0_history");
+                    py::gil_scoped_release const release;
+                    return self.template record_alpha<ALPHA>(steps, every, thist, shist);
+                },
+                py::arg("steps"),
+                py::arg("every"),
+                py::arg("time_history").noconvert(),
+                py::arg("so0_history").noconvert())
+            .def_timed(
+                (Formatter() << "stream_alpha" << ALPHA).str().c_str(),
+                [](wrapped_type & self, size_t steps, size_t every, SimpleArraySnapshot<T> & snapshot)
+                {
+                    py::gil_scoped_release const release;
+                    return self.template stream_alpha<ALPHA>(steps, every, snapshot);
+                },
+                py::arg("steps"),
+                py::arg("every"),
+                py::arg("snapshot"))
+            .def_timed(
+                (Formatter() << "monitor_alpha" << ALPHA).str().c_str(),
+                [](wrapped_type & self, size_t steps, size_t every, SimpleArrayMonitor<T> & monitor)
+                {
+                    py::gil_scoped_release const release;
+                    return self.template monitor_alpha<ALPHA>(steps, every, monitor);
+                },
+                py::arg("steps"),
+                py::arg("every"),
+                py::arg("monitor"));
 
         return *this;
     }
 
 }; /* end class WrapEuler1DCore */
 
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapEuler1DEnsemble
+    : public WrapBase<WrapEuler1DEnsemble, Euler1DEnsemble, std::shared_ptr<Euler1DEnsemble>>
+{
+
+public:
+
+    using base_type = WrapBase<WrapEuler1DEnsemble, Euler1DEnsemble, std::shared_ptr<Euler1DEnsemble>>;
+    using wrapper_type = typename base_type::wrapper_type;
+    using wrapped_type = typename base_type::wrapped_type;
+
+    friend base_type;
+
+protected:
+
+    WrapEuler1DEnsemble(pybind11::module & mod, const char * pyname, const char * clsdoc)
+        : base_type(mod, pyname, clsdoc)
+    {
+
+        namespace py = pybind11;
+
+        (*this)
+            .def(
+                py::init(
+                    [](size_t ncoord, size_t ninstance)
+                    {
+                        return wrapped_type::construct(ncoord, ninstance);
+                    }),
+                py::arg("ncoord"),
+                py::arg("ninstance"))
+            .def_property_readonly_static(
+                "nvar",
+                [](py::handle const &)
+                { return size_t(wrapped_type::NVAR); })
+            .def_property_readonly("ncoord", &wrapped_type::ncoord)
+            .def_property_readonly("ninstance", &wrapped_type::ninstance)
+            .def_property_readonly("nstep", &wrapped_type::nstep)
+            .def_property("parallel", &wrapped_type::parallel, &wrapped_type::set_parallel);
+
+        (*this)
+            .def_property_readonly(
+                "coord",
+                [](wrapped_type & self)
+                { return to_ndarray(self.coord()); })
+            .def_property_readonly(
+                "time_increment",
+                [](wrapped_type & self)
+                { return to_ndarray(self.time_increment()); })
+            .def_property_readonly(
+                "gamma",
+                [](wrapped_type & self)
+                { return to_ndarray(self.gamma()); })
+            .def_property_readonly(
+                "cfl",
+                [](wrapped_type & self)
+                { return to_ndarray(self.cfl()); })
+            .def_property_readonly(
+                "so0",
+                [](wrapped_type & self)
+                { return to_ndarray(self.so0()); })
+            .def_property_readonly(
+                "so1",
+                [](wrapped_type & self)
+                { return to_ndarray(self.so1()); });
+
+        (*this)
+            .def_timed("instance", &wrapped_type::instance, py::arg("iinst"))
+            .def_timed("set_instance", &wrapped_type::set_instance, py::arg("iinst"), py::arg("core"))
+            .def_timed("setup_march", &wrapped_type::setup_march, py::call_guard<py::gil_scoped_release>())
+            .def_timed(
+                "march_alpha1",
+                [](wrapped_type & self, size_t steps)
+                {
+                    py::gil_scoped_release const release;
+                    self.march_alpha<1>(steps);
+                },
+                py::arg("steps"))
+            .def_timed(
+                "march_alpha2",
+                [](wrapped_type & self, size_t steps)
+                {
+                    py::gil_scoped_release const release;
+                    self.march_alpha<2>(steps);
+                },
+                py::arg("steps"));
+    }
+
+}; /* end class WrapEuler1DEnsemble */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapShockTubeCore
+    : public WrapBase<WrapShockTubeCore, ShockTubeCore, std::shared_ptr<ShockTubeCore>>
+{
+
+public:
+
+    using base_type = WrapBase<WrapShockTubeCore, ShockTubeCore, std::shared_ptr<ShockTubeCore>>;
+    using wrapper_type = typename base_type::wrapper_type;
+    using wrapped_type = typename base_type::wrapped_type;
+
+    friend base_type;
+
+protected:
+
+    WrapShockTubeCore(pybind11::module & mod, const char * pyname, const char * clsdoc)
+        : base_type(mod, pyname, clsdoc)
+    {
+
+        namespace py = pybind11;
+
+        (*this)
+            .def(
+                py::init(
+                    [](double gamma, double pressure1, double density1, double pressure5, double density5)
+                    {
+                        return wrapped_type::construct(gamma, pressure1, density1, pressure5, density5);
+                    }),
+                py::arg("gamma"),
+                py::arg("pressure1"),
+                py::arg("density1"),
+                py::arg("pressure5"),
+                py::arg("density5"))
+            .def_static(
+                "calc_pressure45",
+                &wrapped_type::calc_pressure45,
+                py::arg("gamma"),
+                py::arg("pressure1"),
+                py::arg("density1"),
+                py::arg("pressure5"),
+                py::arg("density5"),
+                py::arg("tolerance") = 1.e-10,
+                py::arg("maxiter") = 50)
+            .def_property_readonly_static(
+                "R",
+                [](py::handle const &)
+                { return wrapped_type::R; })
+            .def_property_readonly("gamma", &wrapped_type::gamma)
+            .def_property_readonly("pressure45", &wrapped_type::pressure45)
+            .def_property_readonly("velocity_shock", &wrapped_type::velocity_shock)
+            .def_property("parallel", &wrapped_type::parallel, &wrapped_type::set_parallel)
+            .def(
+                "zone",
+                [](wrapped_type const & self, size_t index)
+                {
+                    ShockTubeCore::Zone const & zone = self.zone(index);
+                    py::dict ret;
+                    ret["density"] = zone.density;
+                    ret["velocity"] = zone.velocity;
+                    ret["pressure"] = zone.pressure;
+                    ret["temperature"] = zone.temperature;
+                    ret["internal_energy"] = zone.internal_energy;
+                    ret["entropy"] = zone.entropy;
+                    ret["speedofsound"] = zone.speedofsound;
+                    return ret;
+                },
+                py::arg("index"))
+            .def(
+                "locations",
+                [](wrapped_type const & self, double t)
+                {
+                    std::array<double, 4> const loc = self.locations(t);
+                    SimpleArray<double> ret(loc.size());
+                    std::copy(loc.begin(), loc.end(), ret.begin());
+                    return to_ndarray(ret);
+                },
+                py::arg("t"))
+            .def_timed(
+                "build_field",
+                [](wrapped_type const & self, double t, py::array_t<double, py::array::c_style | py::array::forcecast> coord, py::object const & density, py::object const & velocity, py::object const & pressure, py::object const & temperature, py::object const & internal_energy, py::object const & entropy)
+                {
+                    // The same as Euler1DCore.fill_quantities(): None skips
+                    // the quantity, and the others are written in place.
+                    auto const make = [](py::object const & obj, char const * name)
+                    {
+                        std::optional<SimpleArray<double>> ret;
+                        if (!obj.is_none())
+                        {
+                            if (!py::isinstance<py::array_t<double>>(obj))
+                            {
+                                throw py::type_error(Formatter() << name << " must be a float64 array");
+                            }
+                            auto arr = obj.cast<py::array_t<double>>();
+                            ret = makeWritableSimpleArray(arr, name);
+                        }
+                        return ret;
+                    };
+                    if (!coord.writeable())
+                    {
+                        coord = py::array_t<double, py::array::c_style | py::array::forcecast>(coord.attr("copy")());
+                    }
+                    SimpleArray<double> const crd = makeSimpleArray(coord);
+                    auto rho = make(density, "density");
+                    auto v = make(velocity, "velocity");
+                    auto p = make(pressure, "pressure");
+                    auto tmp = make(temperature, "temperature");
+                    auto ie = make(internal_energy, "internal_energy");
+                    auto ent = make(entropy, "entropy");
+                    auto const ptr = [](std::optional<SimpleArray<double>> & arr)
+                    { return arr ? &*arr : nullptr; };
+                    py::gil_scoped_release const release;
+                    self.build_field(t, crd, ptr(rho), ptr(v), ptr(p), ptr(tmp), ptr(ie), ptr(ent));
+                },
+                py::arg("t"),
+                py::arg("coord"),
+                py::arg("density") = py::none(),
+                py::arg("velocity") = py::none(),
+                py::arg("pressure") = py::none(),
+                py::arg("temperature") = py::none(),
+                py::arg("internal_energy") = py::none(),
+                py::arg("entropy") = py::none());
+    }
+
+}; /* end class WrapShockTubeCore */
+
+#ifdef MODMESH_METAL_KERNELS
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapEuler1DMetal
+    : public WrapBase<WrapEuler1DMetal, device::Euler1DMetal, std::shared_ptr<device::Euler1DMetal>>
+{
+
+public:
+
+    using base_type = WrapBase<WrapEuler1DMetal, device::Euler1DMetal, std::shared_ptr<device::Euler1DMetal>>;
+    using wrapper_type = typename base_type::wrapper_type;
+    using wrapped_type = typename base_type::wrapped_type;
+
+    friend base_type;
+
+protected:
+
+    WrapEuler1DMetal(pybind11::module & mod, const char * pyname, const char * clsdoc)
+        : base_type(mod, pyname, clsdoc)
+    {
+
+        namespace py = pybind11;
+
+        (*this)
+            .def(
+                py::init(
+                    [](size_t ncoord, float time_increment)
+                    {
+                        return wrapped_type::construct(ncoord, time_increment);
+                    }),
+                py::arg("ncoord"),
+                py::arg("time_increment"))
+            .def_property_readonly("core", &wrapped_type::core)
+            .def(
+                "restore",
+                [](wrapped_type & self, Checkpoint const & checkpoint)
+                { self.restore(checkpoint); },
+                py::arg("checkpoint"));
+
+        (*this)
+            .def_timed("update_cfl", &wrapped_type::update_cfl, py::arg("odd_plane"))
+            .def_timed("march_half_so0", &wrapped_type::march_half_so0, py::arg("odd_plane"))
+            .def_timed("march_half_so1_alpha1", &wrapped_type::march_half_so1_alpha<1>, py::arg("odd_plane"))
+            .def_timed("march_half_so1_alpha2", &wrapped_type::march_half_so1_alpha<2>, py::arg("odd_plane"))
+            .def_timed("treat_boundary_so0", &wrapped_type::treat_boundary_so0)
+            .def_timed("treat_boundary_so1", &wrapped_type::treat_boundary_so1)
+            .def_timed(
+                "march_alpha1",
+                [](wrapped_type & self, size_t steps)
+                {
+                    py::gil_scoped_release const release;
+                    self.march_alpha<1>(steps);
+                },
+                py::arg("steps"))
+            .def_timed(
+                "march_alpha2",
+                [](wrapped_type & self, size_t steps)
+                {
+                    py::gil_scoped_release const release;
+                    self.march_alpha<2>(steps);
+                },
+                py::arg("steps"));
+    }
+
+}; /* end class WrapEuler1DMetal */
+#endif // MODMESH_METAL_KERNELS
+
 void wrap_onedim(pybind11::module & mod)
 {
     mod.doc() = "One-dimensional space-time CESE method code";
 
-    WrapEuler1DCore::commit(mod, "Euler1DCore", "Solve the Euler equation");
+    WrapEuler1DCore<double>::commit(mod, "Euler1DCore", "Solve the Euler equation");
+    WrapEuler1DCore<float>::commit(mod, "Euler1DCoreFp32", "Solve the Euler equation in single precision");
+    WrapEuler1DEnsemble::commit(mod, "Euler1DEnsemble", "March many instances of Euler1DCore together");
+    WrapShockTubeCore::commit(mod, "ShockTubeCore", "Exact solution of the shock tube");
+#ifdef MODMESH_METAL_KERNELS
+    WrapEuler1DMetal::commit(mod, "Euler1DMetal", "March Euler1DCoreFp32 with Metal");
+#endif // MODMESH_METAL_KERNELS
 }
 
 } /* end namespace python */
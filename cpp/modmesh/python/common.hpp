@@ -34,6 +34,9 @@
 #include <pybind11/embed.h>
 
 #include <atomic>
+#include <chrono>
+#include <exception>
+#include <vector>
 
 #include <modmesh/toggle/toggle.hpp>
 
@@ -107,6 +110,195 @@ struct mmtag
 {
 };
 
+namespace detail
+{
+
+/**
+ * The split of the calls through the bindings tagged by mmtag.  A call is
+ * stamped when
+ *
+ *   1. the dispatcher picks the overload (before converting the arguments),
+ *   2. the arguments are converted (the precall hook),
+ *   3. the wrapped C++ body begins and ends (the call guard mmbody), and
+ *   4. the result is cast to Python (the postcall hook).
+ *
+ * The whole call is added to the time of the TimedEntry, and the time out of
+ * the body, i.e., the argument conversion, the call guards such as the GIL
+ * release, and the result casting, is added to its overhead.
+ */
+class BindingTimer
+{
+
+public:
+
+    using clock_type = std::chrono::steady_clock;
+
+    struct Frame
+    {
+        void const * record = nullptr;
+        TimedEntry * entry = nullptr;
+        clock_type::time_point dispatch;
+        clock_type::time_point precall;
+        clock_type::time_point body_begin;
+        clock_type::time_point body_end;
+        int uncaught = 0;
+        bool in_body = false;
+        bool body_done = false;
+        bool counting = false;
+        HardwareCounterValues counters;
+    };
+
+    static void dispatch(void const * record)
+    {
+        Dispatch & d = last_dispatch();
+        d.record = record;
+        d.time = clock_type::now();
+    }
+
+    static void precall(void const * record, TimedEntry & entry)
+    {
+        Frame & f = frames().emplace_back();
+        f.record = record;
+        f.entry = &entry;
+        f.counting = HardwareCounter::me().enabled();
+        if (f.counting)
+        {
+            f.counters = HardwareCounter::read();
+        }
+        f.precall = clock_type::now();
+        // The dispatch is missing before the first call installs the stamping.
+        Dispatch & d = last_dispatch();
+        f.dispatch = d.record == record ? d.time : f.precall;
+        d.record = nullptr;
+    }
+
+    static void postcall(void const * record)
+    {
+        clock_type::time_point const now = clock_type::now();
+        std::vector<Frame> & fs = frames();
+        // Drop the frames left by the calls that threw after the precall.
+        auto it = fs.end();
+        while (it != fs.begin())
+        {
+            --it;
+            if (it->record == record)
+            {
+                break;
+            }
+        }
+        if (it == fs.end() || it->record != record)
+        {
+            return;
+        }
+        Frame const & f = *it;
+        double const total = seconds(now - f.dispatch);
+        double const body = f.body_done ? seconds(f.body_end - f.body_begin) : 0.0;
+        f.entry->add_time(total).add_overhead(total - body);
+        if (f.counting)
+        {
+            f.entry->add_counters(HardwareCounter::read() - f.counters);
+        }
+        fs.erase(it, fs.end());
+    }
+
+    static void begin_body()
+    {
+        std::vector<Frame> & fs = frames();
+        if (!fs.empty() && !fs.back().in_body && !fs.back().body_done)
+        {
+            Frame & f = fs.back();
+            f.in_body = true;
+            f.uncaught = std::uncaught_exceptions();
+            f.body_begin = clock_type::now();
+        }
+    }
+
+    static void end_body()
+    {
+        clock_type::time_point const now = clock_type::now();
+        std::vector<Frame> & fs = frames();
+        if (!fs.empty() && fs.back().in_body)
+        {
+            Frame & f = fs.back();
+            if (std::uncaught_exceptions() > f.uncaught)
+            {
+                // The body throws and the postcall will not be called.
+                fs.pop_back();
+                return;
+            }
+            f.in_body = false;
+            f.body_done = true;
+            f.body_end = now;
+        }
+    }
+
+private:
+
+    struct Dispatch
+    {
+        void const * record = nullptr;
+        clock_type::time_point time;
+    };
+
+    static double seconds(clock_type::duration d) { return std::chrono::duration<double>(d).count(); }
+
+    static std::vector<Frame> & frames()
+    {
+        thread_local std::vector<Frame> fs;
+        return fs;
+    }
+
+    static Dispatch & last_dispatch()
+    {
+        thread_local Dispatch d;
+        return d;
+    }
+
+}; /* end class BindingTimer */
+
+/// The call guard bracketing the wrapped C++ body of a timed binding.
+struct mmbody
+{
+    mmbody() { BindingTimer::begin_body(); }
+    ~mmbody() { BindingTimer::end_body(); }
+    mmbody(mmbody const &) = delete;
+    mmbody(mmbody &&) = delete;
+    mmbody & operator=(mmbody const &) = delete;
+    mmbody & operator=(mmbody &&) = delete;
+};
+
+/// Append mmbody to a call guard given to a timed binding, innermost.
+template <typename T>
+struct with_mmbody
+{
+    using type = T;
+};
+
+template <typename... Guards>
+struct with_mmbody<pybind11::call_guard<Guards...>>
+{
+    using type = pybind11::call_guard<Guards..., mmbody>;
+};
+
+template <typename T>
+decltype(auto) timed_extra(T && extra)
+{
+    using type = std::decay_t<T>;
+    if constexpr (pybind11::detail::is_call_guard<type>::value)
+    {
+        return typename with_mmbody<type>::type{};
+    }
+    else
+    {
+        return std::forward<T>(extra);
+    }
+}
+
+template <typename... Args>
+inline constexpr bool has_call_guard = (pybind11::detail::is_call_guard<std::decay_t<Args>>::value || ...);
+
+} /* end namespace detail */
+
 } /* end namespace python */
 } /* end namespace modmesh */
 
@@ -124,7 +316,27 @@ struct process_attribute<modmesh::python::mmtag>
     {
         if (modmesh::python::WrapperProfilerStatus::me().enabled())
         {
-            modmesh::TimeRegistry::me().entry(get_name(call)).start();
+            handle_type & h = handle_of(call);
+            if (nullptr == h.impl)
+            {
+                // Interpose the dispatch of the overload to stamp the time
+                // before the argument conversion.  The record is owned by
+                // the module and is not otherwise modified after definition.
+                h.impl = call.func.impl;
+                const_cast<function_record &>(call.func).impl = &timed_impl;
+            }
+            modmesh::python::detail::BindingTimer::precall(&call.func, *h.entry);
+        }
+        modmesh::TraceRecorder & recorder = modmesh::TraceRecorder::me();
+        if (recorder.enabled())
+        {
+            handle_type & h = handle_of(call);
+            if (nullptr == h.trace_name)
+            {
+                h.trace_name = recorder.intern(get_name(call));
+            }
+            recorder.begin(h.trace_name);
+            traced_depth()++;
         }
     }
 
@@ -132,12 +344,55 @@ struct process_attribute<modmesh::python::mmtag>
     {
         if (modmesh::python::WrapperProfilerStatus::me().enabled())
         {
-            modmesh::TimeRegistry::me().entry(get_name(call)).stop();
+            modmesh::python::detail::BindingTimer::postcall(&call.func);
+        }
+        // Pair with the beginning even if the recorder is disabled in between.
+        if (traced_depth() > 0)
+        {
+            modmesh::TraceRecorder::me().end();
+            traced_depth()--;
         }
     }
 
 private:
 
+    struct handle_type
+    {
+        modmesh::TimedEntry * entry = nullptr;
+        char const * trace_name = nullptr;
+        handle (*impl)(function_call &) = nullptr; ///< the interposed dispatch
+    };
+
+    static handle timed_impl(function_call & call)
+    {
+        if (modmesh::python::WrapperProfilerStatus::me().enabled())
+        {
+            modmesh::python::detail::BindingTimer::dispatch(&call.func);
+        }
+        return handle_of(call).impl(call);
+    }
+
+    /// The registered entry of the function, looked up by its record instead of its name.
+    static handle_type & handle_of(function_call const & call)
+    {
+        // The records live as long as the module, and the GIL guards the map.
+        static std::unordered_map<function_record const *, handle_type> handles;
+        auto it = handles.find(&call.func);
+        if (it == handles.end())
+        {
+            handle_type h;
+            h.entry = &modmesh::TimeRegistry::me().entry(get_name(call));
+            it = handles.emplace(&call.func, h).first;
+        }
+        return it->second;
+    }
+
+    static size_t & traced_depth()
+    {
+        thread_local size_t depth = 0;
+        return depth;
+    }
+
     static std::string get_name(function_call const & call)
     {
         function_record const & r = call.func;
@@ -154,6 +409,20 @@ namespace modmesh
 namespace python
 {
 
+/**
+ * Share the buffer of a writeable, C-contiguous ndarray, for C++ to fill it
+ * in place.  makeSimpleArray() does not check the strides.
+ */
+template <typename T>
+static SimpleArray<T> makeWritableSimpleArray(pybind11::array_t<T> & ndarr, char const * name)
+{
+    if (!(ndarr.flags() & pybind11::array::c_style) || !ndarr.writeable())
+    {
+        throw std::invalid_argument(Formatter() << name << " must be a writeable and C-contiguous array");
+    }
+    return makeSimpleArray(ndarr);
+}
+
 #if defined(_MSC_VER)
 #pragma warning(push)
 #pragma warning(disable : 4251) // needs to have dll-interface to be used by clients of class
@@ -178,6 +447,19 @@ ConcreteBufferNdarrayRemover : ConcreteBuffer::remover_type
     {
     }
 
+    ConcreteBufferNdarrayRemover(ConcreteBufferNdarrayRemover const &) = delete;
+    ConcreteBufferNdarrayRemover(ConcreteBufferNdarrayRemover &&) = delete;
+    ConcreteBufferNdarrayRemover & operator=(ConcreteBufferNdarrayRemover const &) = delete;
+    ConcreteBufferNdarrayRemover & operator=(ConcreteBufferNdarrayRemover &&) = delete;
+
+    ~ConcreteBufferNdarrayRemover() override
+    {
+        // The last owner of the buffer may drop it in a call releasing the
+        // GIL or in a worker thread, but the ndarray is released with it.
+        pybind11::gil_scoped_acquire const gil;
+        ndarray.release().dec_ref();
+    }
+
     // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays,readability-non-const-parameter)
     void operator()(int8_t *) const override {}
 
@@ -196,13 +478,18 @@ std::enable_if_t<is_simple_array_v<S>, pybind11::array> to_ndarray(S && sarr)
     std::vector<size_t> const shape(sarr.shape().begin(), sarr.shape().end());
     std::vector<size_t> stride(sarr.stride().begin(), sarr.stride().end());
     for (size_t & v : stride) { v *= sarr.itemsize(); }
-    return py::array(
+    py::array ret(
         py::detail::npy_format_descriptor<T>::dtype(), // Numpy dtype
         shape, // Buffer dimensions
         stride, // Strides (in bytes) for each index
         sarr.data(), // Pointer to buffer
         py::cast(sarr.buffer().shared_from_this()) // Create the Python object owning the buffer
     );
+    if (sarr.buffer().is_readonly())
+    {
+        ret.attr("flags").attr("writeable") = false;
+    }
+    return ret;
 }
 
 template <typename T>
@@ -292,7 +579,17 @@ public:
     template <class... Args> /* NOLINTNEXTLINE(bugprone-macro-parentheses) */ \
     wrapper_type & METHOD##_timed(Args &&... args)                            \
     {                                                                         \
-        m_cls.METHOD(std::forward<Args>(args)..., mmtag());                   \
+        if constexpr (detail::has_call_guard<Args...>)                        \
+        {                                                                     \
+            m_cls.METHOD(detail::timed_extra(std::forward<Args>(args))...,    \
+                         mmtag());                                            \
+        }                                                                     \
+        else                                                                  \
+        {                                                                     \
+            m_cls.METHOD(std::forward<Args>(args)...,                         \
+                         mmtag(),                                             \
+                         pybind11::call_guard<detail::mmbody>());             \
+        }                                                                     \
         return *static_cast<wrapper_type *>(this);                            \
     }
 
@@ -42,17 +42,65 @@ namespace modmesh
 namespace python
 {
 
-void initialize(pybind11::module_ mod)
+namespace
+{
+
+/// Register the subsystems populating the top-level module.  Repeating is a no-op.
+void initialize_subsystems(pybind11::module_ & mod)
 {
-    initialize_toggle(mod);
-    initialize_buffer(mod);
     initialize_universe(mod);
     initialize_mesh(mod);
     initialize_inout(mod);
-    pybind11::module_ spacetime_mod = mod.def_submodule("spacetime", "spacetime");
-    initialize_spacetime(spacetime_mod);
-    pybind11::module_ onedim_mod = mod.def_submodule("onedim", "onedim");
-    initialize_onedim(onedim_mod);
+}
+
+/**
+ * Resolve a name missing from the module (PEP 562) by registering the
+ * subsystems on first access, so that importing the module registers only
+ * toggle and buffer.  The submodules depend on the top-level subsystems.
+ */
+pybind11::object lazy_getattr(pybind11::module_ & mod, std::string const & name)
+{
+    namespace py = pybind11;
+
+    // Do not register anything for the probes of the dunder attributes.
+    if (name.size() > 1 && name[0] == '_' && name[1] == '_')
+    {
+        throw py::attribute_error(Formatter() << "module '_modmesh' has no attribute '" << name << "'");
+    }
+
+    initialize_subsystems(mod);
+    if ("spacetime" == name)
+    {
+        py::module_ spacetime_mod = mod.def_submodule("spacetime", "spacetime");
+        initialize_spacetime(spacetime_mod);
+    }
+    else if ("onedim" == name)
+    {
+        py::module_ onedim_mod = mod.def_submodule("onedim", "onedim");
+        initialize_onedim(onedim_mod);
+    }
+#ifdef QT_CORE_LIB
+    else if ("view" == name)
+    {
+        py::module_ view_mod = mod.def_submodule("view", "view");
+        initialize_view(view_mod);
+    }
+#endif // QT_CORE_LIB
+
+    py::dict const dict = mod.attr("__dict__");
+    if (dict.contains(name))
+    {
+        return dict[name.c_str()];
+    }
+    throw py::attribute_error(Formatter() << "module '_modmesh' has no attribute '" << name << "'");
+}
+
+} /* end namespace */
+
+void initialize(pybind11::module_ mod)
+{
+    initialize_toggle(mod);
+    initialize_buffer(mod);
 
     pybind11::module_ testhelper_mod = mod.def_submodule("testhelper", "testhelper");
 #ifdef USE_PYTEST_HELPER_BINDING
@@ -64,11 +112,21 @@ void initialize(pybind11::module_ mod)
 
 #ifdef QT_CORE_LIB
     mod.attr("HAS_VIEW") = true;
-    pybind11::module_ view_mod = mod.def_submodule("view", "view");
-    initialize_view(view_mod);
 #else // QT_CORE_LIB
     mod.attr("HAS_VIEW") = false;
 #endif // QT_CORE_LIB
+
+    // universe, mesh, inout, spacetime, onedim, and view are registered on
+    // first access.  The function looks the module up by name, since holding
+    // the module in the module dict would make a reference cycle.
+    std::string const modname = pybind11::cast<std::string>(mod.attr("__name__"));
+    mod.attr("__getattr__") = pybind11::cpp_function(
+        [modname](std::string const & name)
+        {
+            auto self = pybind11::reinterpret_borrow<pybind11::module_>(pybind11::module_::import("sys").attr("modules")[modname.c_str()]);
+            return lazy_getattr(self, name);
+        },
+        pybind11::arg("name"));
 }
 
 int program_entrance(int argc, char ** argv)
@@ -11,7 +11,13 @@ namespace modmesh
 namespace spacetime
 {
 
-Grid::Grid(real_type xmin, real_type xmax, size_t ncelm, ctor_passkey const &)
+Grid::Grid(real_type xmin, real_type xmax, size_t ncelm, ctor_passkey const & pk)
+    : Grid(xmin, xmax, ncelm, /* ratio */ 1.0, pk)
+{
+}
+
+// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+Grid::Grid(real_type xmin, real_type xmax, size_t ncelm, real_type ratio, ctor_passkey const &)
     : m_xmin(xmin)
     , m_xmax(xmax)
     , m_ncelm(ncelm)
@@ -29,14 +35,8 @@ Grid::Grid(real_type xmin, real_type xmax, size_t ncelm, ctor_passkey const &)
                                     << ", ncelm=" << ncelm << ") invalid arguments: xmin >= xmax");
     }
     // Fill the array for CCE boundary.
-    const real_type xspace = (xmax - xmin) / ncelm;
     array_type xloc(std::vector<size_t>{ncelm + 1});
-    xloc[0] = xmin;
-    for (size_t it = 1; it < ncelm; ++it)
-    {
-        xloc[it] = xloc[it - 1] + xspace;
-    }
-    xloc[ncelm] = xmax;
+    modmesh::detail::fill_graded_coord(xloc.data(), xloc.size(), xmin, xmax, ratio, ThreadPool::instance().use_parallel(xloc.size()), "Grid::Grid()");
     // Initialize.
     init_from_array(xloc);
 }
@@ -49,33 +49,54 @@ void Grid::init_from_array(array_type const & xloc)
                                     << "Grid::init_from_array(xloc) invalid arguments: "
                                     << "xloc.size()=" << xloc.size() << " smaller than 2");
     }
-    for (size_t it = 0; it < xloc.size() - 1; ++it)
-    {
-        if (xloc[it] >= xloc[it + 1])
+    const size_t ncelm = xloc.size() - 1;
+    const bool parallel = ThreadPool::instance().use_parallel(ncelm);
+    // The first pair out of order, found chunk by chunk.
+    const size_t bad = modmesh::parallel_reduce_chunks(
+        ncelm,
+        parallel,
+        ncelm,
+        [&](size_t begin, size_t end)
         {
-            throw std::invalid_argument(modmesh::Formatter()
-                                        << "Grid::init_from_array(xloc) invalid arguments: "
-                                        << "xloc[" << it << "]=" << xloc[it]
-                                        << " >= xloc[" << it + 1 << "]=" << xloc[it + 1]);
-        }
+            for (size_t it = begin; it < end; ++it)
+            {
+                if (xloc[it] >= xloc[it + 1])
+                {
+                    return it;
+                }
+            }
+            return ncelm;
+        },
+        [](size_t lhs, size_t rhs)
+        { return std::min(lhs, rhs); });
+    if (bad < ncelm)
+    {
+        throw std::invalid_argument(modmesh::Formatter()
+                                    << "Grid::init_from_array(xloc) invalid arguments: "
+                                    << "xloc[" << bad << "]=" << xloc[bad]
+                                    << " >= xloc[" << bad + 1 << "]=" << xloc[bad + 1]);
     }
-    m_ncelm = xloc.size() - 1;
+    m_ncelm = ncelm;
     m_xmin = xloc[0];
     m_xmax = xloc[m_ncelm];
     // Mark the boundary of conservation celms.
     const size_t nx = m_ncelm * 2 + (1 + BOUND_COUNT * 2);
     m_agrid = modmesh::AscendantGrid1d(nx);
-    // Fill x-coordinates at CE boundary.
-    for (size_t it = 0; it < xloc.size(); ++it)
-    {
-        m_agrid[it * 2 + BOUND_COUNT] = xloc[it];
-    }
-    // Fill x-coordinates at CE center.
-    for (size_t it = 0; it < m_ncelm; ++it)
-    {
-        const size_t ref = it * 2 + BOUND_COUNT + 1;
-        m_agrid[ref] = (m_agrid[ref - 1] + m_agrid[ref + 1]) / 2;
-    }
+    // Fill x-coordinates at CE boundary and center.
+    real_type const * const src = xloc.data();
+    real_type * const dst = m_agrid.data() + BOUND_COUNT;
+    modmesh::parallel_for_chunks(
+        m_ncelm,
+        parallel,
+        [&](size_t begin, size_t end)
+        {
+            for (size_t it = begin; it < end; ++it)
+            {
+                dst[it * 2] = src[it];
+                dst[it * 2 + 1] = (src[it] + src[it + 1]) / 2;
+            }
+        });
+    dst[m_ncelm * 2] = src[m_ncelm];
     // Fill the front and back value.
     for (size_t it = 1; it <= BOUND_COUNT; ++it)
     {
@@ -93,10 +114,12 @@ void Grid::init_from_array(array_type const & xloc)
 }
 
 // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
-Field::Field(std::shared_ptr<Grid> const & grid, Field::value_type time_increment, size_t nvar)
+Field::Field(std::shared_ptr<Grid> const & grid, Field::value_type time_increment, size_t nvar, Layout layout)
     : m_grid(grid)
-    , m_so0(array_type(std::vector<size_t>{grid->xsize(), nvar}))
-    , m_so1(array_type(std::vector<size_t>{grid->xsize(), nvar}))
+    , m_layout(layout)
+    , m_xaxis(Layout::AoS == layout ? 0 : 1)
+    , m_so0(array_type(Layout::AoS == layout ? std::vector<size_t>{grid->xsize(), nvar} : std::vector<size_t>{nvar, grid->xsize()}))
+    , m_so1(array_type(Layout::AoS == layout ? std::vector<size_t>{grid->xsize(), nvar} : std::vector<size_t>{nvar, grid->xsize()}))
     , m_cfl(array_type(std::vector<size_t>{grid->xsize()}))
 {
     set_time_increment(time_increment);
@@ -135,6 +158,84 @@ void Selm::move_at(int_type offset)
     move(offset);
 }
 
+namespace detail
+{
+
+SimpleArray<uint8_t> grade_time_levels(SimpleArray<uint8_t> const & levels)
+{
+    size_t const ncelm = levels.size();
+    std::vector<uint8_t> lv(levels.data(), levels.data() + ncelm);
+    uint8_t const top = lv.empty() ? 0 : *std::max_element(lv.begin(), lv.end());
+    if (top > TIME_LEVEL_MAX)
+    {
+        throw std::invalid_argument(modmesh::Formatter()
+                                    << "grade_time_levels(): level " << static_cast<int>(top)
+                                    << " > " << TIME_LEVEL_MAX);
+    }
+
+    // Raising a gap may need more grading, and grading may narrow a gap.
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        // From the finest level down, so that a raised CE grades its own
+        // neighbors in turn.
+        for (size_t level = top; level > 1; --level)
+        {
+            for (size_t ic = 0; ic < ncelm; ++ic)
+            {
+                if (lv[ic] != level)
+                {
+                    continue;
+                }
+                size_t const lo = ic < TIME_LEVEL_GRADE ? 0 : ic - TIME_LEVEL_GRADE;
+                size_t const hi = std::min(ncelm, ic + TIME_LEVEL_GRADE + 1);
+                for (size_t jc = lo; jc < hi; ++jc)
+                {
+                    if (static_cast<size_t>(lv[jc]) + 1 < level)
+                    {
+                        lv[jc] = static_cast<uint8_t>(level - 1);
+                        changed = true;
+                    }
+                }
+            }
+        }
+        for (size_t level = 1; level <= top; ++level)
+        {
+            size_t last = ncelm; // One past the end of the last run of the level.
+            for (size_t ic = 0; ic < ncelm; ++ic)
+            {
+                if (lv[ic] < level)
+                {
+                    continue;
+                }
+                if (last < ic && ic - last < TIME_LEVEL_GAP)
+                {
+                    std::fill(lv.begin() + static_cast<ssize_t>(last), lv.begin() + static_cast<ssize_t>(ic), static_cast<uint8_t>(level));
+                    changed = true;
+                }
+                last = ic + 1;
+            }
+        }
+    }
+
+    for (size_t ic = 0; ic < ncelm; ++ic)
+    {
+        if (lv[ic] > 0 && (ic < TIME_LEVEL_MARGIN || ic + TIME_LEVEL_MARGIN >= ncelm))
+        {
+            throw std::invalid_argument(modmesh::Formatter()
+                                        << "grade_time_levels(): CE " << ic << " of level " << static_cast<int>(lv[ic])
+                                        << " is within " << TIME_LEVEL_MARGIN << " CEs of an end of the grid"
+                                        << " (levels are graded by " << TIME_LEVEL_GRADE << " CEs)");
+        }
+    }
+    SimpleArray<uint8_t> ret(ncelm);
+    std::copy(lv.begin(), lv.end(), ret.data());
+    return ret;
+}
+
+} /* end namespace detail */
+
 } /* end namespace spacetime */
 
 } /* end namespace modmesh */
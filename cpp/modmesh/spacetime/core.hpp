@@ -5,9 +5,11 @@
  * BSD 3-Clause License, see COPYING
  */
 
+#include <array>
 #include <memory>
 #include <vector>
 #include <functional>
+#include <type_traits>
 
 #include <modmesh/modmesh.hpp>
 
@@ -126,6 +128,12 @@ public:
 
     Grid(real_type xmin, real_type xmax, size_t ncelm, ctor_passkey const &);
 
+    /**
+     * The CE boundaries from xmin to xmax, each CE ratio times as wide as
+     * the one on its left.
+     */
+    Grid(real_type xmin, real_type xmax, size_t ncelm, real_type ratio, ctor_passkey const &);
+
     // NOLINTNEXTLINE(hicpp-member-init,cppcoreguidelines-pro-type-member-init)
     Grid(array_type const & xloc, ctor_passkey const &) { init_from_array(xloc); }
 
@@ -284,7 +292,19 @@ public:
     using value_type = Grid::value_type;
     using array_type = Grid::array_type;
 
-    Field(std::shared_ptr<Grid> const & grid, value_type time_increment, size_t nvar);
+    /**
+     * Storage of the variables of so0 and so1.  AoS interleaves the variables
+     * of a point in an array of shape (xsize, nvar).  SoA keeps each variable
+     * contiguous in an array of shape (nvar, xsize), for the loops vectorized
+     * over the points.  so0(it, iv) and so1(it, iv) hide the difference.
+     */
+    enum class Layout
+    {
+        AoS,
+        SoA
+    };
+
+    Field(std::shared_ptr<Grid> const & grid, value_type time_increment, size_t nvar, Layout layout = Layout::AoS);
 
     Field() = delete;
     Field(Field const &) = default;
@@ -313,6 +333,9 @@ public:
     Grid const & grid() const { return *m_grid; }
     Grid & grid() { return *m_grid; }
 
+    Layout layout() const { return m_layout; }
+
+    // The whole arrays are in the shape of the layout.
     array_type const & so0() const { return m_so0; }
     array_type & so0() { return m_so0; }
     array_type const & so1() const { return m_so1; }
@@ -320,14 +343,22 @@ public:
     array_type const & cfl() const { return m_cfl; }
     array_type & cfl() { return m_cfl; }
 
-    value_type const & so0(size_t it, size_t iv) const { return m_so0(it, iv); }
-    value_type & so0(size_t it, size_t iv) { return m_so0(it, iv); }
-    value_type const & so1(size_t it, size_t iv) const { return m_so1(it, iv); }
-    value_type & so1(size_t it, size_t iv) { return m_so1(it, iv); }
+    /// Mark so0, so1, and cfl modified, after a sweep writes through the elements.
+    void bump_epoch()
+    {
+        m_so0.bump_epoch();
+        m_so1.bump_epoch();
+        m_cfl.bump_epoch();
+    }
+
+    value_type const & so0(size_t it, size_t iv) const { return m_so0.data()[offset(it, iv)]; }
+    value_type & so0(size_t it, size_t iv) { return m_so0.data()[offset(it, iv)]; }
+    value_type const & so1(size_t it, size_t iv) const { return m_so1.data()[offset(it, iv)]; }
+    value_type & so1(size_t it, size_t iv) { return m_so1.data()[offset(it, iv)]; }
     value_type const & cfl(size_t it) const { return m_cfl(it); }
     value_type & cfl(size_t it) { return m_cfl(it); }
 
-    size_t nvar() const { return m_so0.shape()[1]; }
+    size_t nvar() const { return m_so0.shape(1 - m_xaxis); }
 
     void set_time_increment(value_type time_increment);
 
@@ -359,8 +390,16 @@ public:
 
 private:
 
+    // The axis of the points is 0 in AoS and 1 in SoA.
+    size_t offset(size_t it, size_t iv) const
+    {
+        return it * m_so0.stride(m_xaxis) + iv * m_so0.stride(1 - m_xaxis);
+    }
+
     std::shared_ptr<Grid> m_grid;
 
+    Layout m_layout = Layout::AoS;
+    size_t m_xaxis = 0;
     array_type m_so0;
     array_type m_so1;
     array_type m_cfl;
@@ -670,6 +709,66 @@ inline typename Celm::value_type Celm::calc_so1_alpha(size_t iv) const
 
 class Selm;
 
+/**
+ * Whether the flux functions of the solution element type are bound at
+ * compile time.  A derived SE declares xn(), xp(), tn(), tp(), so0p() and
+ * update_cfl() (see SPACETIME_DERIVED_SELM_BODY_DEFAULT), which hide those
+ * of Selm and are inlined into the march loops.  Selm itself calls through
+ * the std::function in Kernel, so that the prototypes may be written in
+ * Python.
+ */
+namespace detail
+{
+
+template <typename SE, typename = void>
+struct has_flux_type : std::false_type
+{
+};
+
+template <typename SE>
+struct has_flux_type<SE, std::void_t<typename SE::flux_type>> : std::true_type
+{
+};
+
+/// The finest time level of the multi-rate march.
+constexpr size_t TIME_LEVEL_MAX = 8;
+/// Number of the CEs at each end of the grid that must stay at level 0.
+constexpr size_t TIME_LEVEL_MARGIN = 3;
+/// A CE within this many CEs of a CE of level l is raised to at least l - 1.
+constexpr size_t TIME_LEVEL_GRADE = 2;
+/// A gap narrower than this many CEs between two runs of a level is filled.
+constexpr size_t TIME_LEVEL_GAP = 4;
+
+/**
+ * Return the time levels of the CEs graded for SolverBase::set_time_levels().
+ * The levels are only raised.  Throws std::invalid_argument for a level
+ * beyond TIME_LEVEL_MAX or a CE of positive level within TIME_LEVEL_MARGIN
+ * of an end.
+ */
+SimpleArray<uint8_t> grade_time_levels(SimpleArray<uint8_t> const & levels);
+
+} /* end namespace detail */
+
+template <typename SE>
+struct SelmTraits
+{
+    using value_type = Grid::value_type;
+    using calc_type1 = value_type (Selm::*)(size_t) const;
+    using calc_type2 = void (Selm::*)();
+
+    static constexpr bool static_kernel =
+        !std::is_same_v<decltype(&SE::xn), calc_type1> &&
+        !std::is_same_v<decltype(&SE::xp), calc_type1> &&
+        !std::is_same_v<decltype(&SE::tn), calc_type1> &&
+        !std::is_same_v<decltype(&SE::tp), calc_type1> &&
+        !std::is_same_v<decltype(&SE::so0p), calc_type1> &&
+        !std::is_same_v<decltype(&SE::update_cfl), calc_type2>;
+
+    // SE::flux_type provides the formulas of the SE methods as static
+    // functions of the coordinates and the solution, for the array-form march.
+    static constexpr bool batch_kernel = detail::has_flux_type<SE>::value;
+}; /* end struct SelmTraits */
+
 /**
  * Algorithmic definition for solution.  It holds the type information for the
  * CE and SE.
@@ -686,6 +785,14 @@ public:
     using celm_type = CE;
     using selm_type = SE;
 
+    /// Whether the march calls the inlined fluxes of SE instead of Kernel.
+    static constexpr bool static_kernel = SelmTraits<SE>::static_kernel;
+    // A derived SE that misses some of the flux functions would silently
+    // fall back to the zero fluxes of the default Kernel.
+    static_assert(static_kernel || std::is_same_v<SE, Selm>, "SE must define all of the flux functions");
+    /// Whether the array-form march is available.
+    static constexpr bool batch_kernel = SelmTraits<SE>::batch_kernel;
+
 protected:
 
     class ctor_passkey
@@ -770,6 +877,10 @@ public:
     void set_time_increment(value_type time_increment) { m_field.set_time_increment(time_increment); }
 
     real_type time_increment() const { return m_field.time_increment(); }
+    /// Number of the steps marched by march_alpha().
+    size_t nstep() const { return m_nstep; }
+    /// Time marched by march_alpha(), the sum of the time increments.
+    real_type time() const { return m_time; }
     real_type dt() const { return m_field.dt(); }
     real_type hdt() const { return m_field.hdt(); }
     real_type qdt() const { return m_field.qdt(); }
@@ -798,6 +909,75 @@ public:
     void treat_boundary_so0();
     void treat_boundary_so1();
 
+    /**
+     * Whether the sweeps of a half step are split over ThreadPool, when the
+     * grid is not smaller than its threshold.  Each CE only writes its own
+     * selm_tp(), so the result does not depend on the threads.  Only the
+     * solvers with static_kernel go parallel, because Kernel may call into
+     * Python.
+     */
+    bool parallel() const { return m_parallel; }
+    void set_parallel(bool value) { m_parallel = value; }
+
+    /**
+     * Whether the sweeps compute a contiguous run of elements directly from
+     * the Field arrays, instead of walking CE and SE objects one by one, so
+     * that the compiler vectorizes the loops.  Both forms evaluate the same
+     * SE::flux_type and give identical results, unless the compiler contracts
+     * the operations into FMA differently (e.g., -march=native).  Only for the
+     * solvers with batch_kernel and a single variable.
+     */
+    bool batched() const { return m_batched; }
+    void set_batched(bool value);
+
+    /**
+     * Number of the steps march_alpha() takes on a tile of the grid while it
+     * stays in cache, before moving to the next tile (time skewing).  Zero or
+     * one sweeps the whole grid for every half step.  The tiles are
+     * block_width() points of xindex wide, widened when needed for the depth
+     * of the dependency.  The order of the calculation changes but not the
+     * calculation, and the result is identical.
+     */
+    size_t block_steps() const { return m_block_steps; }
+    void set_block_steps(size_t value) { m_block_steps = value; }
+    size_t block_width() const { return m_block_width; }
+    void set_block_width(size_t value) { m_block_width = value; }
+
+    /**
+     * The largest CFL number of the last update_cfl(), or of the last step
+     * marched by march_alpha() (the last block of steps with block_steps()).
+     * It is reduced in the sweeps that calculate the CFL numbers.
+     */
+    real_type max_cfl() const { return m_max_cfl; }
+    /**
+     * When positive, march_alpha() scales time_increment() before each step
+     * by the ratio of the target to max_cfl(), so that the step is the
+     * largest one the target allows.  The CFL number is proportional to the
+     * time increment.  Zero keeps the time increment.
+     */
+    real_type target_cfl() const { return m_target_cfl; }
+    void set_target_cfl(real_type value) { m_target_cfl = value; }
+
+    /**
+     * The time levels of the CEs for the multi-rate march.  Each step of
+     * march_alpha() marches the points of level l by 2^l sub-steps of dt() /
+     * 2^l, so that a region of fine CEs does not hold the whole grid to its
+     * small time increment.  The levels are in step again at the end of the
+     * step.  Where a level meets a coarser one, the fluxes the coarse side
+     * took across the interface are corrected to the sum of the fine
+     * sub-steps, so that the march stays conservative.
+     *
+     * The levels are graded when set (see detail::grade_time_levels()), and
+     * the CEs next to the two ends stay at level 0 for the periodic boundary
+     * treatment.  An empty array or all zeros returns to the uniform march.
+     * block_steps() does not apply to the multi-rate march.  The levels are
+     * dropped by restore().
+     */
+    SimpleArray<uint8_t> const & time_levels() const { return m_time_levels; }
+    void set_time_levels(SimpleArray<uint8_t> const & levels);
+    /// Number of the CEs updated by march_alpha(), two for a CE in a step.
+    size_t nupdate() const { return m_nupdate; }
+
     void setup_march() { update_cfl(false); }
     template <size_t ALPHA>
     void march_half1_alpha();
@@ -805,13 +985,259 @@ public:
     void march_half2_alpha();
     template <size_t ALPHA>
     void march_alpha(size_t steps);
+    /**
+     * March the steps like march_alpha(), and call hook() after each step
+     * that makes nstep() a multiple of every.  The steps between the calls
+     * are marched in one march_alpha().  Zero every never calls hook().
+     */
+    template <size_t ALPHA, typename F>
+    void run_alpha(size_t steps, size_t every, F && hook);
+    /**
+     * March the steps like run_alpha(), and copy time() and so0() of each
+     * sample into the next rows of time_history (nsample) and so0_history
+     * (nsample followed by the shape of so0()).  Returns the number of
+     * samples copied.
+     */
+    template <size_t ALPHA>
+    size_t record_alpha(size_t steps, size_t every, array_type & time_history, array_type & so0_history);
+    /**
+     * March the steps like run_alpha(), and evaluate the monitor on so0() at
+     * time() of each sample.  Returns the number of samples evaluated.
+     */
+    template <size_t ALPHA>
+    size_t monitor_alpha(size_t steps, size_t every, SimpleArrayMonitor<value_type> & monitor);
+
+    /// Snapshot the grid, the state arrays and the step counters.
+    Checkpoint checkpoint() const;
+    /**
+     * Take the grid and the state of the checkpoint.  The arrays are moved
+     * out of the checkpoint, so that those mapped from a file are not copied.
+     * The time levels are dropped with the old grid.
+     */
+    void restore(Checkpoint checkpoint);
 
 private:
 
+    // Call func(begin, end) for the chunks of [start, stop), on ThreadPool in
+    // the parallel mode.  Returns after all the calls, as the barrier of a
+    // sweep.
+    template <typename F>
+    void for_each_chunk(int_type start, int_type stop, F && func);
+    // Call func(itile) for itile in [0, ntile), on ThreadPool in the parallel
+    // mode.
+    template <typename F>
+    void for_each_tile(size_t ntile, F && func);
+
+    // The sweeps over the CEs or SEs [begin, end), in the array form when
+    // batched.
+    void march_half_so0_range(int_type begin, int_type end, bool odd_plane);
+    // Returns the largest CFL number of the SEs.
+    value_type update_cfl_range(int_type begin, int_type end, bool odd_plane);
+    template <size_t ALPHA>
+    void march_half_so1_alpha_range(int_type begin, int_type end, bool odd_plane);
+
+    // The CEs (selm = false) or SEs (selm = true) of the plane that are at
+    // xindex in [xbegin, xend).
+    std::pair<int_type, int_type> range_of(size_t xbegin, size_t xend, bool odd_plane, bool selm) const;
+
+    // Advance the points of xindex in [xbegin, xend) by the half step of the
+    // CEs on the plane, without the boundary treatment.  Returns the largest
+    // CFL number updated.
+    template <size_t ALPHA>
+    value_type march_half_alpha_range(size_t xbegin, size_t xend, bool odd_plane);
+    // March a step over the whole grid.
+    template <size_t ALPHA>
+    void march_step_alpha();
+    // March the steps tile by tile.
+    template <size_t ALPHA>
+    void march_block_alpha(size_t steps);
+    // Scale the time increment for target_cfl().
+    void adapt_time_increment();
+    // Update the CFL numbers of the SEs [start, stop) chunk by chunk.
+    // Returns the largest.
+    value_type update_cfl_chunks(int_type start, int_type stop, bool odd_plane);
+
+    /*
+     * The points of a time level or finer in the multi-rate march.  A run
+     * also keeps what the coarser level (coarse) and the run itself (fine)
+     * transfer from left to right across its two ends (0 for begin and 1 for
+     * end) in a step of the coarser level.
+     */
+    struct TimeLevelRun
+    {
+        size_t begin = 0;
+        size_t end = 0;
+        std::array<value_type, 2> coarse = {0, 0};
+        std::array<value_type, 2> fine = {0, 0};
+    };
+
+    // What an SE transfers across the interface at xindex edge (the first
+    // point of a run or one past the last) in the half step of the CEs on
+    // the plane.
+    value_type transfer_across(size_t edge, bool odd_plane, size_t coarse_level, bool left_end);
+    // Advance the points of the xindex ranges by the half step of the CEs on
+    // the plane, with the periodic boundary treatment at the two ends of the
+    // grid when boundary is true.  Returns the largest CFL number updated.
+    template <size_t ALPHA>
+    value_type march_half_ranges_alpha(std::vector<std::pair<size_t, size_t>> const & xranges, bool odd_plane, bool boundary);
+    // Copy the points around the ends of the runs of the level finer than
+    // the given one into the slot, or back from it.  Restoring owned_only
+    // leaves the points of the finer levels.
+    void save_level_zones(size_t level, size_t slot);
+    void restore_level_zones(size_t level, size_t slot, bool owned_only);
+    // March the isub-th step of the level in a step of the coarser level,
+    // and the steps of the finer levels in it.  Returns the largest CFL
+    // number updated.
+    template <size_t ALPHA>
+    value_type march_level_alpha(size_t level, size_t isub, real_type base_dt);
+    // March a step of the multi-rate march.
+    template <size_t ALPHA>
+    void march_multirate_step_alpha();
+
+    // The array forms of the sweeps over the CEs or SEs [begin, end).
+    void march_half_so0_batch(int_type begin, int_type end, bool odd_plane);
+    value_type update_cfl_batch(int_type begin, int_type end, bool odd_plane);
+    template <size_t ALPHA>
+    void march_half_so1_alpha_batch(int_type begin, int_type end, bool odd_plane);
+
     Field m_field;
+    size_t m_nstep = 0;
+    real_type m_time = 0;
+    real_type m_max_cfl = 0;
+    real_type m_target_cfl = 0;
+    bool m_parallel = true;
+    bool m_batched = false;
+    size_t m_block_steps = 0;
+    size_t m_block_width = 1 << 12;
+    size_t m_nupdate = 0;
+    // The time levels of the CEs and of the points of xindex, the runs of
+    // each level, and the two slots of the saved points of each level.
+    SimpleArray<uint8_t> m_time_levels;
+    std::vector<uint8_t> m_xlevels;
+    std::vector<std::vector<TimeLevelRun>> m_level_runs;
+    std::vector<std::array<std::vector<value_type>, 2>> m_level_saves;
 
 }; /* end class SolverBase */
 
+template <typename ST, typename CE, typename SE>
+template <typename F>
+inline void SolverBase<ST, CE, SE>::for_each_chunk(int_type start, int_type stop, F && func)
+{
+    size_t const nelm = static_cast<size_t>(stop - start);
+    bool const parallel = static_kernel && m_parallel && ThreadPool::instance().use_parallel(nelm);
+    parallel_for_chunks(
+        nelm,
+        parallel,
+        [&](size_t begin, size_t end)
+        { func(start + static_cast<int_type>(begin), start + static_cast<int_type>(end)); });
+}
+
+template <typename ST, typename CE, typename SE>
+template <typename F>
+inline void SolverBase<ST, CE, SE>::for_each_tile(size_t ntile, F && func)
+{
+    if (static_kernel && m_parallel && ThreadPool::instance().use_parallel(grid().xsize()))
+    {
+        ThreadPool::instance().run(ntile, func);
+    }
+    else
+    {
+        for (size_t itile = 0; itile < ntile; ++itile)
+        {
+            func(itile);
+        }
+    }
+}
+
+template <typename ST, typename CE, typename SE>
+inline void SolverBase<ST, CE, SE>::set_batched(bool value)
+{
+    if (value && !(batch_kernel && 1 == nvar()))
+    {
+        throw std::invalid_argument(Formatter() << "SolverBase: " << ST::CHECKPOINT_KIND
+                                                << " does not support the array-form march");
+    }
+    m_batched = value;
+}
+
+/*
+ * In the array forms, the CE of xindex c has the SEs of xindex c-1 and c+1 on
+ * its plane, and its selm_tp() is the SE of xindex c on the other plane.  An
+ * SE of xindex s spans the coordinates x[s-1], x[s] and x[s+1].  A sweep
+ * writes only the indices of one parity and reads the other, so the loops
+ * carry no dependency.
+ */
+
+template <typename ST, typename CE, typename SE>
+inline void SolverBase<ST, CE, SE>::march_half_so0_batch(int_type begin, int_type end, bool odd_plane)
+{
+    using flux = typename SE::flux_type;
+    value_type const * MODMESH_RESTRICT x = grid().xcoord().data();
+    value_type * u = &m_field.so0(0, 0);
+    value_type const * MODMESH_RESTRICT ux = &m_field.so1(0, 0);
+    value_type const hdt = m_field.hdt();
+    value_type const qdt = m_field.qdt();
+    size_t const cbegin = grid().xindex_celm(begin, odd_plane);
+    size_t const cend = grid().xindex_celm(end, odd_plane);
+    for (size_t c = cbegin; c < cend; c += 2)
+    {
+        size_t const m = c - 1;
+        size_t const p = c + 1;
+        value_type const flux_ll = flux::xp(x[m - 1], x[m], x[m + 1], u[m], ux[m]) +
+                                   flux::tp(x[m - 1], x[m], x[m + 1], u[m], ux[m], hdt, qdt);
+        value_type const flux_ur = flux::xn(x[p - 1], x[p], x[p + 1], u[p], ux[p]) -
+                                   flux::tp(x[p - 1], x[p], x[p + 1], u[p], ux[p], hdt, qdt);
+        u[c] = (flux_ll + flux_ur) / (x[c + 1] - x[c - 1]);
+    }
+}
+
+template <typename ST, typename CE, typename SE>
+inline typename SolverBase<ST, CE, SE>::value_type
+SolverBase<ST, CE, SE>::update_cfl_batch(int_type begin, int_type end, bool odd_plane)
+{
+    using flux = typename SE::flux_type;
+    value_type const * MODMESH_RESTRICT x = grid().xcoord().data();
+    value_type const * MODMESH_RESTRICT u = &m_field.so0(0, 0);
+    value_type * MODMESH_RESTRICT cfl = &m_field.cfl(0);
+    value_type const hdt = m_field.hdt();
+    size_t const sbegin = grid().xindex_selm(begin, odd_plane);
+    size_t const send = grid().xindex_selm(end, odd_plane);
+    value_type ret = 0;
+    for (size_t s = sbegin; s < send; s += 2)
+    {
+        value_type const value = flux::cfl(x[s - 1], x[s], x[s + 1], u[s], hdt);
+        cfl[s] = value;
+        ret = value > ret ? value : ret;
+    }
+    return ret;
+}
+
+template <typename ST, typename CE, typename SE>
+template <size_t ALPHA>
+inline void SolverBase<ST, CE, SE>::march_half_so1_alpha_batch(int_type begin, int_type end, bool odd_plane)
+{
+    using flux = typename SE::flux_type;
+    value_type const * MODMESH_RESTRICT x = grid().xcoord().data();
+    value_type const * MODMESH_RESTRICT u = &m_field.so0(0, 0);
+    value_type * MODMESH_RESTRICT ux = &m_field.so1(0, 0);
+    value_type const hdt = m_field.hdt();
+    constexpr value_type tiny = std::numeric_limits<value_type>::min();
+    size_t const cbegin = grid().xindex_celm(begin, odd_plane);
+    size_t const cend = grid().xindex_celm(end, odd_plane);
+    for (size_t c = cbegin; c < cend; c += 2)
+    {
+        size_t const m = c - 1;
+        size_t const p = c + 1;
+        value_type const upn = flux::so0p(x[m - 1], x[m], x[m + 1], u[m], ux[m], hdt);
+        value_type const upp = flux::so0p(x[p - 1], x[p], x[p + 1], u[p], ux[p], hdt);
+        value_type const duxn = (u[c] - upn) / (x[c] - x[m]);
+        value_type const duxp = (upp - u[c]) / (x[p] - x[c]);
+        value_type const fan = pow<ALPHA>(std::fabs(duxn));
+        value_type const fap = pow<ALPHA>(std::fabs(duxp));
+        ux[c] = (fap * duxn + fan * duxp) / (fap + fan + tiny);
+    }
+}
+
 template <typename ST, typename CE, typename SE>
 inline typename SolverBase<ST, CE, SE>::array_type
 SolverBase<ST, CE, SE>::x(bool odd_plane) const
@@ -892,6 +1318,7 @@ SolverBase<ST, CE, SE>::set_so0(size_t iv, typename SolverBase<ST, CE, SE>::arra
         throw std::out_of_range(Formatter() << "set_so0(): arr size " << arr.size() << " != nselm " << nselm);
     }
     for (uint_type it = 0; it < nselm; ++it) { selm(it, odd_plane).so0(iv) = arr[it]; }
+    m_field.so0().bump_epoch();
 }
 
 template <typename ST, typename CE, typename SE>
@@ -912,6 +1339,7 @@ SolverBase<ST, CE, SE>::set_so1(size_t iv, typename SolverBase<ST, CE, SE>::arra
         throw std::out_of_range("set_so1(): input wrong size");
     }
     for (uint_type it = 0; it < nselm; ++it) { selm(it, odd_plane).so1(iv) = arr[it]; }
+    m_field.so1().bump_epoch();
 }
 
 template <typename ST, typename CE, typename SE>
@@ -938,14 +1366,77 @@ SolverBase<ST, CE, SE>::set_cfl(typename SolverBase<ST, CE, SE>::array_type cons
         throw std::out_of_range("set_so1(): input wrong size");
     }
     for (uint_type it = 0; it < nselm; ++it) { selm(it, odd_plane).cfl() = arr[it]; }
+    m_field.cfl().bump_epoch();
 }
 
 template <typename ST, typename CE, typename SE>
 inline void SolverBase<ST, CE, SE>::march_half_so0(bool odd_plane)
 {
-    const int_type start = odd_plane ? -1 : 0;
-    const int_type stop = static_cast<int_type>(grid().ncelm());
-    for (int_type ic = start; ic < stop; ++ic)
+    for_each_chunk(
+        odd_plane ? -1 : 0,
+        static_cast<int_type>(grid().ncelm()),
+        [&](int_type begin, int_type end)
+        { march_half_so0_range(begin, end, odd_plane); });
+    m_field.so0().bump_epoch();
+}
+
+template <typename ST, typename CE, typename SE>
+inline void SolverBase<ST, CE, SE>::update_cfl(bool odd_plane)
+{
+    m_max_cfl = update_cfl_chunks(odd_plane ? -1 : 0, static_cast<int_type>(grid().nselm()), odd_plane);
+    m_field.cfl().bump_epoch();
+}
+
+template <typename ST, typename CE, typename SE>
+inline typename SolverBase<ST, CE, SE>::value_type
+SolverBase<ST, CE, SE>::update_cfl_chunks(int_type start, int_type stop, bool odd_plane)
+{
+    if (stop <= start)
+    {
+        return 0;
+    }
+    // Each chunk keeps its maximum, to be reduced after the sweep.
+    std::vector<value_type> chunk_max(modmesh::detail::chunk_count(static_cast<size_t>(stop - start)), 0);
+    for_each_chunk(
+        start,
+        stop,
+        [&](int_type begin, int_type end)
+        {
+            size_t const ichunk = static_cast<size_t>(begin - start) / ThreadPool::CHUNK_SIZE;
+            chunk_max[ichunk] = update_cfl_range(begin, end, odd_plane);
+        });
+    value_type ret = 0;
+    for (value_type const value : chunk_max)
+    {
+        ret = std::max(ret, value);
+    }
+    return ret;
+}
+
+template <typename ST, typename CE, typename SE>
+template <size_t ALPHA>
+inline void SolverBase<ST, CE, SE>::march_half_so1_alpha(bool odd_plane)
+{
+    for_each_chunk(
+        odd_plane ? -1 : 0,
+        static_cast<int_type>(grid().ncelm()),
+        [&](int_type begin, int_type end)
+        { march_half_so1_alpha_range<ALPHA>(begin, end, odd_plane); });
+    m_field.so1().bump_epoch();
+}
+
+template <typename ST, typename CE, typename SE>
+inline void SolverBase<ST, CE, SE>::march_half_so0_range(int_type begin, int_type end, bool odd_plane)
+{
+    if constexpr (batch_kernel)
+    {
+        if (m_batched)
+        {
+            march_half_so0_batch(begin, end, odd_plane);
+            return;
+        }
+    }
+    for (int_type ic = begin; ic < end; ++ic)
     {
         auto ce = celm(ic, odd_plane);
         ce.selm_tp().so0(0) = ce.calc_so0(0);
@@ -953,23 +1444,39 @@ inline void SolverBase<ST, CE, SE>::march_half_so0(bool odd_plane)
 }
 
 template <typename ST, typename CE, typename SE>
-inline void SolverBase<ST, CE, SE>::update_cfl(bool odd_plane)
+inline typename SolverBase<ST, CE, SE>::value_type
+SolverBase<ST, CE, SE>::update_cfl_range(int_type begin, int_type end, bool odd_plane)
 {
-    const int_type start = odd_plane ? -1 : 0;
-    const int_type stop = static_cast<int_type>(grid().nselm());
-    for (int_type ic = start; ic < stop; ++ic)
+    if constexpr (batch_kernel)
+    {
+        if (m_batched)
+        {
+            return update_cfl_batch(begin, end, odd_plane);
+        }
+    }
+    value_type ret = 0;
+    for (int_type is = begin; is < end; ++is)
     {
-        selm(ic, odd_plane).update_cfl();
+        auto se = selm(is, odd_plane);
+        se.update_cfl();
+        ret = std::max(ret, se.cfl());
     }
+    return ret;
 }
 
 template <typename ST, typename CE, typename SE>
 template <size_t ALPHA>
-inline void SolverBase<ST, CE, SE>::march_half_so1_alpha(bool odd_plane)
+inline void SolverBase<ST, CE, SE>::march_half_so1_alpha_range(int_type begin, int_type end, bool odd_plane)
 {
-    const int_type start = odd_plane ? -1 : 0;
-    const int_type stop = static_cast<int_type>(grid().ncelm());
-    for (int_type ic = start; ic < stop; ++ic)
+    if constexpr (batch_kernel)
+    {
+        if (m_batched)
+        {
+            march_half_so1_alpha_batch<ALPHA>(begin, end, odd_plane);
+            return;
+        }
+    }
+    for (int_type ic = begin; ic < end; ++ic)
     {
         auto ce = celm(ic, odd_plane);
         ce.selm_tp().so1(0) = ce.template calc_so1_alpha<ALPHA>(0);
@@ -986,6 +1493,7 @@ inline void SolverBase<ST, CE, SE>::treat_boundary_so0()
 
     selm_left_out.so0(0) = selm_right_in.so0(0);
     selm_right_out.so0(0) = selm_left_in.so0(0);
+    m_field.so0().bump_epoch();
 }
 
 template <typename ST, typename CE, typename SE>
@@ -998,6 +1506,7 @@ inline void SolverBase<ST, CE, SE>::treat_boundary_so1()
 
     selm_left_out.so1(0) = selm_right_in.so1(0);
     selm_right_out.so1(0) = selm_left_in.so1(0);
+    m_field.so1().bump_epoch();
 }
 
 template <typename ST, typename CE, typename SE>
@@ -1025,11 +1534,587 @@ template <typename ST, typename CE, typename SE>
 template <size_t ALPHA>
 inline void SolverBase<ST, CE, SE>::march_alpha(size_t steps)
 {
-    for (size_t it = 0; it < steps; ++it)
+    if (!m_level_runs.empty())
     {
-        march_half1_alpha<ALPHA>();
-        march_half2_alpha<ALPHA>();
+        for (size_t it = 0; it < steps; ++it)
+        {
+            march_multirate_step_alpha<ALPHA>();
+        }
+    }
+    else if (m_block_steps > 1)
+    {
+        for (size_t it = 0; it < steps; it += m_block_steps)
+        {
+            march_block_alpha<ALPHA>(std::min(m_block_steps, steps - it));
+        }
+    }
+    else
+    {
+        for (size_t it = 0; it < steps; ++it)
+        {
+            march_step_alpha<ALPHA>();
+        }
     }
+    // The block and multi-rate marches write the elements directly.
+    m_field.bump_epoch();
+}
+
+template <typename ST, typename CE, typename SE>
+template <size_t ALPHA, typename F>
+inline void SolverBase<ST, CE, SE>::run_alpha(size_t steps, size_t every, F && hook)
+{
+    if (0 == every)
+    {
+        march_alpha<ALPHA>(steps);
+        return;
+    }
+    while (steps > 0)
+    {
+        size_t const nmarch = std::min(steps, every - m_nstep % every);
+        march_alpha<ALPHA>(nmarch);
+        steps -= nmarch;
+        if (0 == m_nstep % every)
+        {
+            hook();
+        }
+    }
+}
+
+template <typename ST, typename CE, typename SE>
+template <size_t ALPHA>
+inline size_t SolverBase<ST, CE, SE>::record_alpha(size_t steps, size_t every, array_type & time_history, array_type & so0_history)
+{
+    size_t const nsample = 0 == every ? 0 : (m_nstep + steps) / every - m_nstep / every;
+    array_type const & so0 = m_field.so0();
+    size_t const ssize = so0.size();
+    if (time_history.size() < nsample)
+    {
+        throw std::out_of_range(Formatter() << "record_alpha(): time_history size " << time_history.size() << " < nsample " << nsample);
+    }
+    if (so0_history.ndim() < 1 || so0_history.shape(0) < nsample || so0_history.size() != so0_history.shape(0) * ssize)
+    {
+        throw std::out_of_range(Formatter() << "record_alpha(): so0_history size " << so0_history.size() << " does not hold " << nsample << " samples of size " << ssize);
+    }
+    size_t isample = 0;
+    run_alpha<ALPHA>(
+        steps,
+        every,
+        [&]()
+        {
+            time_history(isample) = m_time;
+            std::copy_n(so0.data(), ssize, so0_history.data() + isample * ssize);
+            ++isample;
+        });
+    return isample;
+}
+
+template <typename ST, typename CE, typename SE>
+template <size_t ALPHA>
+inline size_t SolverBase<ST, CE, SE>::monitor_alpha(size_t steps, size_t every, SimpleArrayMonitor<value_type> & monitor)
+{
+    array_type const & so0 = m_field.so0();
+    size_t nsample = 0;
+    run_alpha<ALPHA>(
+        steps,
+        every,
+        [&]()
+        {
+            monitor.evaluate(so0, static_cast<double>(m_time));
+            ++nsample;
+        });
+    return nsample;
+}
+
+template <typename ST, typename CE, typename SE>
+template <size_t ALPHA>
+inline void SolverBase<ST, CE, SE>::march_step_alpha()
+{
+    adapt_time_increment();
+    march_half1_alpha<ALPHA>();
+    real_type const max_cfl = m_max_cfl;
+    march_half2_alpha<ALPHA>();
+    m_max_cfl = std::max(max_cfl, m_max_cfl);
+    m_time += dt();
+    ++m_nstep;
+    m_nupdate += grid().ncelm() * 2 + 1;
+}
+
+template <typename ST, typename CE, typename SE>
+inline void SolverBase<ST, CE, SE>::adapt_time_increment()
+{
+    if (m_target_cfl > 0 && m_max_cfl > 0)
+    {
+        set_time_increment(dt() * m_target_cfl / m_max_cfl);
+    }
+}
+
+template <typename ST, typename CE, typename SE>
+inline std::pair<int_type, int_type>
+SolverBase<ST, CE, SE>::range_of(size_t xbegin, size_t xend, bool odd_plane, bool selm) const
+{
+    int_type const start = odd_plane ? -1 : 0;
+    int_type const stop = static_cast<int_type>(selm ? grid().nselm() : grid().ncelm());
+    int_type const x0 = static_cast<int_type>(selm ? grid().xindex_selm(0, odd_plane) : grid().xindex_celm(0, odd_plane));
+    // The first element at or after the xindex; the division truncates
+    // toward zero.
+    auto const first = [x0](size_t xindex)
+    {
+        int_type const dx = static_cast<int_type>(xindex) - x0;
+        return dx > 0 ? (dx + 1) / 2 : dx / 2;
+    };
+    int_type const begin = std::max(first(xbegin), start);
+    int_type const end = std::min(first(xend), stop);
+    return {begin, std::max(begin, end)};
+}
+
+template <typename ST, typename CE, typename SE>
+template <size_t ALPHA>
+inline typename SolverBase<ST, CE, SE>::value_type
+SolverBase<ST, CE, SE>::march_half_alpha_range(size_t xbegin, size_t xend, bool odd_plane)
+{
+    // A CE writes its selm_tp() at the same xindex on the other plane.
+    auto const [cbegin, cend] = range_of(xbegin, xend, odd_plane, /* selm */ false);
+    auto const [sbegin, send] = range_of(xbegin, xend, !odd_plane, /* selm */ true);
+    march_half_so0_range(cbegin, cend, odd_plane);
+    value_type const ret = update_cfl_range(sbegin, send, !odd_plane);
+    march_half_so1_alpha_range<ALPHA>(cbegin, cend, odd_plane);
+    return ret;
+}
+
+/*
+ * A half step writes a point from the points next to it, so a point marched h
+ * half steps ahead depends on the points within h.  The grid is cut into
+ * tiles.  Each tile first marches a trapezoid, losing a point on each side
+ * every half step, all in cache and independent of the other tiles.  The
+ * triangles left between the tiles are then filled, also independently.  The
+ * triangle across the two ends of the grid takes the periodic boundary
+ * treatment with it.  A half step only writes the points of one parity and
+ * reads the other, so the values a triangle reads are not yet overwritten.
+ */
+template <typename ST, typename CE, typename SE>
+template <size_t ALPHA>
+inline void SolverBase<ST, CE, SE>::march_block_alpha(size_t steps)
+{
+    size_t const nhalf = steps * 2;
+    size_t const xbegin = Grid::BOUND_COUNT;
+    size_t const xend = grid().xsize() - Grid::BOUND_COUNT;
+    size_t const ntile = (xend - xbegin) / std::max(m_block_width, 2 * nhalf + 4);
+    if (0 == ntile)
+    {
+        for (size_t it = 0; it < steps; ++it)
+        {
+            march_step_alpha<ALPHA>();
+        }
+        return;
+    }
+    auto const edge = [&](size_t itile)
+    { return xbegin + (xend - xbegin) * itile / ntile; };
+    // The time increment is the same for all the steps of the block.
+    adapt_time_increment();
+    std::vector<value_type> tile_max(ntile, 0);
+
+    for_each_tile(
+        ntile,
+        [&](size_t itile)
+        {
+            size_t const lo = edge(itile);
+            size_t const hi = edge(itile + 1);
+            for (size_t ih = 0; ih < nhalf; ++ih)
+            {
+                value_type const value = march_half_alpha_range<ALPHA>(lo + ih, hi - ih, /* odd_plane */ ih % 2 != 0);
+                tile_max[itile] = std::max(tile_max[itile], value);
+            }
+        });
+
+    for_each_tile(
+        ntile,
+        [&](size_t itile)
+        {
+            if (itile != 0)
+            {
+                size_t const mid = edge(itile);
+                for (size_t ih = 0; ih < nhalf; ++ih)
+                {
+                    value_type const value = march_half_alpha_range<ALPHA>(mid - ih, mid + ih, /* odd_plane */ ih % 2 != 0);
+                    tile_max[itile] = std::max(tile_max[itile], value);
+                }
+                return;
+            }
+            // The steps of march_half1_alpha() and march_half2_alpha() on the
+            // two ends, including the ghost SEs outside the interval.
+            for (size_t ih = 0; ih < nhalf; ++ih)
+            {
+                bool const odd_plane = ih % 2 != 0;
+                auto const [clbegin, clend] = range_of(xbegin, xbegin + ih, odd_plane, /* selm */ false);
+                auto const [crbegin, crend] = range_of(xend - ih, xend, odd_plane, /* selm */ false);
+                auto const [slbegin, slend] = range_of(xbegin - 1, xbegin + ih, !odd_plane, /* selm */ true);
+                auto const [srbegin, srend] = range_of(xend - ih, xend + 1, !odd_plane, /* selm */ true);
+                march_half_so0_range(clbegin, clend, odd_plane);
+                march_half_so0_range(crbegin, crend, odd_plane);
+                if (!odd_plane)
+                {
+                    treat_boundary_so0();
+                }
+                value_type const lmax = update_cfl_range(slbegin, slend, !odd_plane);
+                value_type const rmax = update_cfl_range(srbegin, srend, !odd_plane);
+                tile_max[itile] = std::max({tile_max[itile], lmax, rmax});
+                march_half_so1_alpha_range<ALPHA>(clbegin, clend, odd_plane);
+                march_half_so1_alpha_range<ALPHA>(crbegin, crend, odd_plane);
+                if (!odd_plane)
+                {
+                    treat_boundary_so1();
+                }
+            }
+        });
+
+    m_max_cfl = 0;
+    for (value_type const value : tile_max)
+    {
+        m_max_cfl = std::max(m_max_cfl, value);
+    }
+    m_time += dt() * static_cast<real_type>(steps);
+    m_nstep += steps;
+    m_nupdate += (grid().ncelm() * 2 + 1) * steps;
+}
+
+template <typename ST, typename CE, typename SE>
+inline void SolverBase<ST, CE, SE>::set_time_levels(SimpleArray<uint8_t> const & levels)
+{
+    size_t const ncelm = grid().ncelm();
+    if (0 != levels.size() && ncelm != levels.size())
+    {
+        throw std::out_of_range(Formatter() << "set_time_levels(): levels size " << levels.size() << " != ncelm " << ncelm);
+    }
+    SimpleArray<uint8_t> graded = detail::grade_time_levels(levels);
+    m_time_levels = SimpleArray<uint8_t>();
+    m_xlevels.clear();
+    m_level_runs.clear();
+    m_level_saves.clear();
+    uint8_t top = 0;
+    for (size_t ic = 0; ic < graded.size(); ++ic)
+    {
+        top = std::max(top, graded[ic]);
+    }
+    if (0 == top)
+    {
+        return;
+    }
+
+    // A point at the center of a CE takes the level of the CE, and a point
+    // between two CEs the finer of the two.
+    m_xlevels.assign(grid().xsize(), 0);
+    for (size_t ic = 0; ic < ncelm; ++ic)
+    {
+        size_t const xc = grid().xindex_celm(static_cast<int_type>(ic), /* odd_plane */ false);
+        uint8_t const level = graded[ic];
+        m_xlevels[xc] = level;
+        m_xlevels[xc - 1] = std::max(m_xlevels[xc - 1], level);
+        m_xlevels[xc + 1] = std::max(m_xlevels[xc + 1], level);
+    }
+    size_t const xbegin = Grid::BOUND_COUNT;
+    size_t const xend = grid().xsize() - Grid::BOUND_COUNT;
+    m_level_runs.resize(static_cast<size_t>(top) + 1);
+    m_level_runs[0].push_back(TimeLevelRun{xbegin, xend});
+    for (size_t level = 1; level <= top; ++level)
+    {
+        for (size_t ix = xbegin; ix < xend;)
+        {
+            if (m_xlevels[ix] < level)
+            {
+                ++ix;
+                continue;
+            }
+            size_t const begin = ix;
+            while (ix < xend && m_xlevels[ix] >= level)
+            {
+                ++ix;
+            }
+            m_level_runs[level].push_back(TimeLevelRun{begin, ix});
+        }
+    }
+    m_level_saves.resize(top);
+    m_time_levels = std::move(graded);
+}
+
+template <typename ST, typename CE, typename SE>
+inline typename SolverBase<ST, CE, SE>::value_type
+SolverBase<ST, CE, SE>::transfer_across(size_t edge, bool odd_plane, size_t coarse_level, bool left_end)
+{
+    /*
+     * A CE writes its top from the fluxes of its two SEs, so that the sum of
+     * the tops of a region is the sum of the SEs of the region on the plane
+     * plus the fluxes through the SE at each end.  The SE between the last
+     * top of one side and the first top of the other belongs to one of the
+     * sides, and the transfer is the flux that the left side loses with it.
+     */
+    size_t const parity = odd_plane ? 1 : 0;
+    size_t const xj = edge % 2 == parity ? edge : edge - 1;
+    bool const coarse_owned = m_xlevels[xj] <= coarse_level;
+    bool const left_owned = left_end ? coarse_owned : !coarse_owned;
+    SE const se = m_field.selm<SE>(static_cast<int_type>(xj / 2) - 1, xj % 2 != 0);
+    return left_owned ? se.xp(0) + se.tp(0) : se.tp(0) - se.xn(0);
+}
+
+template <typename ST, typename CE, typename SE>
+template <size_t ALPHA>
+inline typename SolverBase<ST, CE, SE>::value_type
+SolverBase<ST, CE, SE>::march_half_ranges_alpha(std::vector<std::pair<size_t, size_t>> const & xranges, bool odd_plane, bool boundary)
+{
+    size_t const xbegin = Grid::BOUND_COUNT;
+    size_t const xend = grid().xsize() - Grid::BOUND_COUNT;
+    for (auto const & [lo, hi] : xranges)
+    {
+        auto const [cbegin, cend] = range_of(lo, hi, odd_plane, /* selm */ false);
+        for_each_chunk(
+            cbegin,
+            cend,
+            [&](int_type begin, int_type end)
+            { march_half_so0_range(begin, end, odd_plane); });
+        m_nupdate += static_cast<size_t>(cend - cbegin);
+    }
+    if (boundary && !odd_plane)
+    {
+        treat_boundary_so0();
+    }
+    value_type ret = 0;
+    for (auto const & [lo, hi] : xranges)
+    {
+        // The ghost SEs outside the two ends take the CFL numbers too.
+        size_t const slo = boundary && lo == xbegin ? xbegin - 1 : lo;
+        size_t const shi = boundary && hi == xend ? xend + 1 : hi;
+        auto const [sbegin, send] = range_of(slo, shi, !odd_plane, /* selm */ true);
+        ret = std::max(ret, update_cfl_chunks(sbegin, send, !odd_plane));
+    }
+    for (auto const & [lo, hi] : xranges)
+    {
+        auto const [cbegin, cend] = range_of(lo, hi, odd_plane, /* selm */ false);
+        for_each_chunk(
+            cbegin,
+            cend,
+            [&](int_type begin, int_type end)
+            { march_half_so1_alpha_range<ALPHA>(begin, end, odd_plane); });
+    }
+    if (boundary && !odd_plane)
+    {
+        treat_boundary_so1();
+    }
+    return ret;
+}
+
+/*
+ * A finer level reads the coarser points up to 4 away from its run in its
+ * first half step, and the coarser level writes the finer points up to 1 into
+ * the run.  The points within 4 of the ends of the runs are saved before the
+ * coarser level marches (slot 0), and after (slot 1).
+ */
+template <typename ST, typename CE, typename SE>
+inline void SolverBase<ST, CE, SE>::save_level_zones(size_t level, size_t slot)
+{
+    constexpr size_t reach = 4;
+    std::vector<value_type> & saved = m_level_saves[level][slot];
+    saved.clear();
+    for (TimeLevelRun const & run : m_level_runs[level + 1])
+    {
+        for (size_t const edge : {run.begin, run.end})
+        {
+            for (size_t ix = edge - reach; ix < edge + reach; ++ix)
+            {
+                saved.push_back(m_field.so0(ix, 0));
+                saved.push_back(m_field.so1(ix, 0));
+                saved.push_back(m_field.cfl(ix));
+            }
+        }
+    }
+}
+
+template <typename ST, typename CE, typename SE>
+inline void SolverBase<ST, CE, SE>::restore_level_zones(size_t level, size_t slot, bool owned_only)
+{
+    constexpr size_t reach = 4;
+    std::vector<value_type> const & saved = m_level_saves[level][slot];
+    size_t it = 0;
+    for (TimeLevelRun const & run : m_level_runs[level + 1])
+    {
+        for (size_t const edge : {run.begin, run.end})
+        {
+            for (size_t ix = edge - reach; ix < edge + reach; ++ix, it += 3)
+            {
+                if (owned_only && m_xlevels[ix] > level)
+                {
+                    continue;
+                }
+                m_field.so0(ix, 0) = saved[it];
+                m_field.so1(ix, 0) = saved[it + 1];
+                m_field.cfl(ix) = saved[it + 2];
+            }
+        }
+    }
+}
+
+/*
+ * A step of a level marches its own points, with the points of the finer
+ * levels next to them, and the coarser points in the cone that the rest of
+ * the step of the coarser level depends on.  The finer levels then march
+ * two steps from the points saved before, and the coarse points around them
+ * are put back.  The transfers recorded at the ends of the finer runs
+ * correct the coarse points next to the interfaces (refluxing).
+ */
+template <typename ST, typename CE, typename SE>
+template <size_t ALPHA>
+inline typename SolverBase<ST, CE, SE>::value_type
+SolverBase<ST, CE, SE>::march_level_alpha(size_t level, size_t isub, real_type base_dt)
+{
+    std::vector<TimeLevelRun> & runs = m_level_runs[level];
+    std::vector<TimeLevelRun> * finer = level + 1 < m_level_runs.size() ? &m_level_runs[level + 1] : nullptr;
+    if (finer)
+    {
+        save_level_zones(level, 0);
+        for (TimeLevelRun & run : *finer)
+        {
+            run.coarse = {0, 0};
+            run.fine = {0, 0};
+        }
+    }
+    m_field.set_time_increment(base_dt / static_cast<real_type>(size_t(1) << level));
+
+    value_type ret = 0;
+    std::vector<std::pair<size_t, size_t>> xranges;
+    for (size_t ih = 0; ih < 2; ++ih)
+    {
+        bool const odd_plane = ih != 0;
+        // Into the finer runs, the first half step writes the points the
+        // second reads.  Into the coarser points, the cone shrinks by one
+        // point every half step to the end of the coarser step.
+        size_t const inner = 1 - ih;
+        size_t const outer = 0 == level ? 0 : 3 - 2 * isub - ih;
+        xranges.clear();
+        size_t ifiner = 0;
+        for (TimeLevelRun const & run : runs)
+        {
+            size_t lo = run.begin - outer;
+            for (; finer && ifiner < finer->size() && (*finer)[ifiner].end <= run.end; ++ifiner)
+            {
+                TimeLevelRun const & sub = (*finer)[ifiner];
+                xranges.emplace_back(lo, sub.begin + inner);
+                lo = sub.end - inner;
+            }
+            xranges.emplace_back(lo, run.end + outer);
+        }
+        // The SEs at the interfaces are on the plane that the half step
+        // reads and does not write.
+        if (finer)
+        {
+            for (TimeLevelRun & sub : *finer)
+            {
+                sub.coarse[0] += transfer_across(sub.begin, odd_plane, level, /* left_end */ true);
+                sub.coarse[1] += transfer_across(sub.end, odd_plane, level, /* left_end */ false);
+            }
+        }
+        if (level > 0)
+        {
+            for (TimeLevelRun & run : runs)
+            {
+                run.fine[0] += transfer_across(run.begin, odd_plane, level - 1, /* left_end */ true);
+                run.fine[1] += transfer_across(run.end, odd_plane, level - 1, /* left_end */ false);
+            }
+        }
+        ret = std::max(ret, march_half_ranges_alpha<ALPHA>(xranges, odd_plane, /* boundary */ 0 == level));
+    }
+
+    if (finer)
+    {
+        save_level_zones(level, 1);
+        restore_level_zones(level, 0, /* owned_only */ false);
+        ret = std::max(ret, march_level_alpha<ALPHA>(level + 1, 0, base_dt));
+        ret = std::max(ret, march_level_alpha<ALPHA>(level + 1, 1, base_dt));
+        m_field.set_time_increment(base_dt / static_cast<real_type>(size_t(1) << level));
+        restore_level_zones(level, 1, /* owned_only */ true);
+        // The coarse points next to the interfaces on the plane of the end
+        // of the step.  The coarse side is on the left of begin and on the
+        // right of end.
+        real_type const * x = grid().xcoord().data();
+        for (TimeLevelRun const & sub : *finer)
+        {
+            size_t const xl = (sub.begin - 1) & ~size_t(1);
+            size_t const xr = (sub.end + 1) & ~size_t(1);
+            m_field.so0(xl, 0) -= (sub.fine[0] - sub.coarse[0]) / (x[xl + 1] - x[xl - 1]);
+            m_field.so0(xr, 0) += (sub.fine[1] - sub.coarse[1]) / (x[xr + 1] - x[xr - 1]);
+        }
+    }
+    return ret;
+}
+
+template <typename ST, typename CE, typename SE>
+template <size_t ALPHA>
+inline void SolverBase<ST, CE, SE>::march_multirate_step_alpha()
+{
+    if (m_xlevels.size() != grid().xsize())
+    {
+        throw std::runtime_error(Formatter() << "SolverBase: time levels of " << m_xlevels.size()
+                                             << " points do not match the grid of " << grid().xsize());
+    }
+    adapt_time_increment();
+    real_type const base_dt = dt();
+    m_max_cfl = march_level_alpha<ALPHA>(0, 0, base_dt);
+    m_field.set_time_increment(base_dt);
+    m_time += base_dt;
+    ++m_nstep;
+}
+
+template <typename ST, typename CE, typename SE>
+inline Checkpoint SolverBase<ST, CE, SE>::checkpoint() const
+{
+    Checkpoint ret(ST::CHECKPOINT_KIND);
+    ret.add_scalar("time_increment", time_increment());
+    ret.add_scalar("nstep", static_cast<real_type>(m_nstep));
+    ret.add_scalar("time", m_time);
+    ret.add_array("xcoord", grid().xcoord());
+    ret.add_array("so0", so0());
+    ret.add_array("so1", so1());
+    ret.add_array("cfl", cfl());
+    return ret;
+}
+
+template <typename ST, typename CE, typename SE>
+inline void SolverBase<ST, CE, SE>::restore(Checkpoint checkpoint)
+{
+    checkpoint.check_kind(ST::CHECKPOINT_KIND);
+    array_type & xcoord = checkpoint.array("xcoord");
+    // The coordinates of the CE boundaries rebuild the grid, which then takes
+    // all the saved coordinates.
+    if (xcoord.size() < 1 + Grid::BOUND_COUNT * 2 || 0 == xcoord.size() % 2)
+    {
+        throw std::runtime_error(Formatter() << "SolverBase: checkpoint has bad xcoord of " << xcoord.size() << " points");
+    }
+    size_t const nxloc = (xcoord.size() - Grid::BOUND_COUNT * 2 + 1) / 2;
+    array_type xloc(std::vector<size_t>{nxloc});
+    for (size_t it = 0; it < nxloc; ++it)
+    {
+        xloc[it] = xcoord[it * 2 + Grid::BOUND_COUNT];
+    }
+    std::shared_ptr<Grid> grid = Grid::construct(xloc);
+    auto check = [&](char const * name, bool with_nvar)
+    {
+        array_type const & arr = checkpoint.array(name);
+        bool const good = with_nvar ? (2 == arr.ndim() && arr.shape(1) == nvar()) : 1 == arr.ndim();
+        if (!good || arr.shape(0) != xcoord.size())
+        {
+            throw std::runtime_error(Formatter() << "SolverBase: checkpoint array " << name << " does not match the grid and nvar");
+        }
+    };
+    check("so0", true);
+    check("so1", true);
+    check("cfl", false);
+
+    grid->xcoord() = std::move(xcoord);
+    m_field.set_grid(grid);
+    m_field.set_time_increment(checkpoint.scalar("time_increment"));
+    m_field.so0() = std::move(checkpoint.array("so0"));
+    m_field.so1() = std::move(checkpoint.array("so1"));
+    m_field.cfl() = std::move(checkpoint.array("cfl"));
+    m_nstep = static_cast<size_t>(checkpoint.scalar("nstep"));
+    m_time = checkpoint.scalar("time");
+    set_time_levels(SimpleArray<uint8_t>());
 }
 
 class Solver
@@ -1041,6 +2126,8 @@ public:
     using base_type = SolverBase<Solver, Celm, Selm>;
     using base_type::base_type;
 
+    static constexpr char const * CHECKPOINT_KIND = "Solver";
+
     static std::shared_ptr<Solver>
     construct(std::shared_ptr<Grid> const & grid, value_type time_increment, size_t nvar)
     {
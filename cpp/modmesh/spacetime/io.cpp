@@ -91,6 +91,12 @@ std::ostream & operator<<(std::ostream & os, const BadEuler1DSolver & sol)
     return os;
 }
 
+std::ostream & operator<<(std::ostream & os, const Euler1DSolver & sol)
+{
+    os << "Euler1DSolver(grid=" << sol.field().grid() << ", gamma=" << sol.gamma() << ")";
+    return os;
+}
+
 } /* end namespace spacetime */
 
 } /* end namespace modmesh */
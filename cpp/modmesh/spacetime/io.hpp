@@ -11,6 +11,7 @@
 #include <modmesh/spacetime/kernel/linear_scalar.hpp>
 #include <modmesh/spacetime/kernel/inviscid_burgers.hpp>
 #include <modmesh/spacetime/kernel/BadEuler1DSolver.hpp>
+#include <modmesh/spacetime/kernel/Euler1DSolver.hpp>
 
 namespace modmesh
 {
@@ -30,6 +31,7 @@ std::ostream & operator<<(std::ostream & os, const LinearScalarSolver & sol);
 std::ostream & operator<<(std::ostream & os, const LinearScalarCelm & elm);
 std::ostream & operator<<(std::ostream & os, const LinearScalarSelm & elm);
 std::ostream & operator<<(std::ostream & os, const BadEuler1DSolver & sol);
+std::ostream & operator<<(std::ostream & os, const Euler1DSolver & sol);
 
 } /* end namespace spacetime */
 
@@ -77,6 +77,12 @@ public:
     {
     }
 
+    BadEuler1DSolver(
+        std::shared_ptr<Grid> const & grid, double time_increment, Field::Layout layout, ctor_passkey const &)
+        : m_field(grid, time_increment, NVAR, layout)
+    {
+    }
+
     explicit BadEuler1DSolver(ctor_passkey const &);
 
     BadEuler1DSolver() = delete;
@@ -297,6 +303,7 @@ inline void BadEuler1DSolver::march_alpha(size_t steps)
         march_half1_alpha<ALPHA>();
         march_half2_alpha<ALPHA>();
     }
+    m_field.bump_epoch();
 }
 
 } /* end namespace spacetime */
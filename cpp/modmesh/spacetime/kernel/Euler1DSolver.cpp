@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2022, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/spacetime/kernel/Euler1DSolver.hpp>
+#include <cmath>
+
+namespace modmesh
+{
+namespace spacetime
+{
+
+namespace
+{
+
+// The formulas of Euler1DKernel::derive(), calc_flux_ll() and calc_flux_lr()
+// for n SEs, every other point from x.  The variables are xs apart for the
+// points and vs apart for the variables.  Taking the arrays as restrict
+// arguments lets the compiler vectorize the loop.
+void derive_selms(
+    size_t n,
+    double gamma,
+    double hdt,
+    double qdt,
+    double const * MODMESH_RESTRICT x,
+    size_t xs,
+    size_t vs,
+    double const * MODMESH_RESTRICT so0,
+    double const * MODMESH_RESTRICT so1,
+    double * MODMESH_RESTRICT ll0,
+    double * MODMESH_RESTRICT ll1,
+    double * MODMESH_RESTRICT ll2,
+    double * MODMESH_RESTRICT lr0,
+    double * MODMESH_RESTRICT lr1,
+    double * MODMESH_RESTRICT lr2,
+    double * MODMESH_RESTRICT up0,
+    double * MODMESH_RESTRICT up1,
+    double * MODMESH_RESTRICT up2)
+{
+    constexpr double tiny = Euler1DSolver::tiny;
+    double const ga = gamma;
+    for (size_t it = 0; it < n; ++it)
+    {
+        double const xx = x[2 * it];
+        double const xneg = x[2 * it - 1];
+        double const xpos = x[2 * it + 1];
+        double const xctr = (xneg + xpos) / 2;
+        size_t const iu = 2 * it * xs;
+        double const u0 = so0[iu];
+        double const u1 = so0[iu + vs];
+        double const u2 = so0[iu + 2 * vs];
+        double const ux0 = so1[iu];
+        double const ux1 = so1[iu + vs];
+        double const ux2 = so1[iu + 2 * vs];
+
+        double const j00 = 0.0;
+        double const j01 = 1.0;
+        double const j02 = 0.0;
+        double const j10 = (ga - 3.0) / 2.0 * u1 * u1 / (u0 * u0 + tiny);
+        double const j11 = -(ga - 3.0) * u1 / (u0 + tiny);
+        double const j12 = ga - 1.0;
+        double const j20 = (ga - 1.0) * u1 * u1 * u1 / (u0 * u0 * u0 + tiny) - ga * u1 * u2 / (u0 * u0 + tiny);
+        double const j21 = ga * u2 / (u0 + tiny) - 3.0 / 2.0 * (ga - 1.0) * u1 * u1 / (u0 * u0 + tiny);
+        double const j22 = ga * u1 / (u0 + tiny);
+
+        double const f0 = u1;
+        double const f1 = (ga - 1.0) * u2 + (3.0 - ga) / 2.0 * u1 * u1 / (u0 + tiny);
+        double const f2 = ga * u1 * u2 / (u0 + tiny) - (ga - 1.0) / 2.0 * u1 * u1 * u1 / (u0 * u0 + tiny);
+
+        // Also ut = -fx
+        double const ut0 = -j00 * ux0 - j01 * ux1 - j02 * ux2;
+        double const ut1 = -j10 * ux0 - j11 * ux1 - j12 * ux2;
+        double const ut2 = -j20 * ux0 - j21 * ux1 - j22 * ux2;
+
+        double const ft0 = j00 * ut0 + j01 * ut1 + j02 * ut2;
+        double const ft1 = j10 * ut0 + j11 * ut1 + j12 * ut2;
+        double const ft2 = j20 * ut0 + j21 * ut1 + j22 * ut2;
+
+        double const dxctr = xx - xctr;
+        double const tflux0 = hdt * (f0 - (dxctr * ut0) + (qdt * ft0));
+        double const tflux1 = hdt * (f1 - (dxctr * ut1) + (qdt * ft1));
+        double const tflux2 = hdt * (f2 - (dxctr * ut2) + (qdt * ft2));
+
+        double const deltax_ll = xpos - xx;
+        double const dxmid_ll = 0.5 * (xx + xpos) - xctr;
+        ll0[it] = deltax_ll * (u0 + dxmid_ll * ux0) + tflux0;
+        ll1[it] = deltax_ll * (u1 + dxmid_ll * ux1) + tflux1;
+        ll2[it] = deltax_ll * (u2 + dxmid_ll * ux2) + tflux2;
+        double const deltax_lr = xx - xneg;
+        double const dxmid_lr = 0.5 * (xx + xneg) - xctr;
+        lr0[it] = deltax_lr * (u0 + dxmid_lr * ux0) - tflux0;
+        lr1[it] = deltax_lr * (u1 + dxmid_lr * ux1) - tflux1;
+        lr2[it] = deltax_lr * (u2 + dxmid_lr * ux2) - tflux2;
+
+        up0[it] = u0 + dxctr * ux0 /* displacement in x */ + hdt * ut0 /* displacement in t */;
+        up1[it] = u1 + dxctr * ux1 /* displacement in x */ + hdt * ut1 /* displacement in t */;
+        up2[it] = u2 + dxctr * ux2 /* displacement in x */ + hdt * ut2 /* displacement in t */;
+    }
+}
+
+} /* end namespace */
+
+Euler1DSolver::Euler1DSolver(
+    std::shared_ptr<Grid> const & grid, double time_increment, Field::Layout layout, ctor_passkey const &)
+    : m_field(grid, time_increment, NVAR, layout)
+    , m_derived(small_vector<size_t>{NDERIVED, grid->nselm() + 1})
+{
+}
+
+size_t Euler1DSolver::xstride() const
+{
+    return Field::Layout::SoA == m_field.layout() ? m_field.so0().stride(1) : m_field.so0().stride(0);
+}
+
+size_t Euler1DSolver::vstride() const
+{
+    return Field::Layout::SoA == m_field.layout() ? m_field.so0().stride(0) : m_field.so0().stride(1);
+}
+
+void Euler1DSolver::derive(bool odd_plane)
+{
+    int_type const start = odd_plane ? -1 : 0;
+    size_t const nse = grid().ncelm() + 1 - start;
+    size_t const x0 = grid().xindex_selm(start, odd_plane);
+    size_t const xs = xstride();
+    auto row = [this](size_t irow)
+    { return m_derived.data() + irow * m_derived.shape(1); };
+    derive_selms(
+        nse,
+        m_gamma,
+        m_field.hdt(),
+        m_field.qdt(),
+        grid().xcoord().data() + x0,
+        xs,
+        vstride(),
+        m_field.so0().data() + x0 * xs,
+        m_field.so1().data() + x0 * xs,
+        row(FLUX_LL),
+        row(FLUX_LL + 1),
+        row(FLUX_LL + 2),
+        row(FLUX_LR),
+        row(FLUX_LR + 1),
+        row(FLUX_LR + 2),
+        row(UP),
+        row(UP + 1),
+        row(UP + 2));
+}
+
+void Euler1DSolver::update_cfl(bool odd_plane)
+{
+    int_type const start = odd_plane ? -1 : 0;
+    size_t const nse = grid().nselm() - start;
+    size_t const x0 = grid().xindex_selm(start, odd_plane);
+    size_t const xs = xstride();
+    size_t const vs = vstride();
+    double const ga = m_gamma;
+    double const ga1 = ga - 1.0;
+    double const hdt = m_field.hdt();
+    double const * MODMESH_RESTRICT x = grid().xcoord().data() + x0;
+    double const * MODMESH_RESTRICT u = m_field.so0().data() + x0 * xs;
+    double * MODMESH_RESTRICT cfl = m_field.cfl().data() + x0;
+    for (size_t it = 0; it < nse; ++it)
+    {
+        // The same formula as BadEuler1DSolver::update_cfl().
+        size_t const iu = 2 * it * xs;
+        double wspd = u[iu + vs] * u[iu + vs];
+        double const ke = wspd / (2.0 * u[iu]);
+        double pr = ga1 * (u[iu + 2 * vs] - ke);
+        pr = (pr + std::abs(pr)) / 2.0;
+        wspd = std::sqrt(ga * pr / u[iu]) + std::sqrt(wspd) / u[iu];
+        double const dxpos = x[2 * it + 1] - x[2 * it];
+        double const dxneg = x[2 * it] - x[2 * it - 1];
+        cfl[2 * it] = hdt * wspd / (dxpos < dxneg ? dxpos : dxneg);
+    }
+}
+
+void Euler1DSolver::march_half_so0(bool odd_plane)
+{
+    derive(odd_plane);
+    march_half_derived<0>(odd_plane, /* so0 */ true, /* so1 */ false);
+}
+
+void Euler1DSolver::treat_boundary_so0()
+{
+    selm_type const selm_left_in = selm(0, true);
+    selm_type selm_left_out = selm(-1, true);
+    selm_type const selm_right_in = selm(static_cast<int_type>(grid().ncelm()) - 1, true);
+    selm_type selm_right_out = selm(static_cast<int_type>(grid().ncelm()), true);
+
+    // Periodic boundary condition treatment.
+    for (size_t iv = 0; iv < NVAR; ++iv)
+    {
+        selm_left_out.so0(iv) = selm_right_in.so0(iv);
+        selm_right_out.so0(iv) = selm_left_in.so0(iv);
+    }
+}
+
+void Euler1DSolver::treat_boundary_so1()
+{
+    selm_type const selm_left_in = selm(0, true);
+    selm_type selm_left_out = selm(-1, true);
+    selm_type const selm_right_in = selm(static_cast<int_type>(grid().ncelm()) - 1, true);
+    selm_type selm_right_out = selm(static_cast<int_type>(grid().ncelm()), true);
+
+    // Periodic boundary condition treatment.
+    for (size_t iv = 0; iv < NVAR; ++iv)
+    {
+        selm_left_out.so1(iv) = selm_right_in.so1(iv);
+        selm_right_out.so1(iv) = selm_left_in.so1(iv);
+    }
+}
+
+} /* end namespace spacetime */
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,250 @@
+#pragma once
+
+/*
+ * Copyright (c) 2022, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/spacetime/core.hpp>
+
+namespace modmesh
+{
+namespace spacetime
+{
+
+/**
+ * The Euler equations on the same Field and in the same interface as
+ * BadEuler1DSolver, with the loops written for speed.  Each half step derives
+ * the fluxes and the variables at the CE centers once per SE of the plane
+ * (the Jacobian is consumed there), and both so0 and so1 of the next plane
+ * are updated from the cached values in one sweep.  The sweeps run over
+ * contiguous arrays so that the compiler vectorizes them across the
+ * elements.
+ *
+ * The new SE of the CE ic is selm(ic + odd_plane, !odd_plane), as
+ * Celm::selm_tp().
+ */
+class Euler1DSolver
+    : public std::enable_shared_from_this<Euler1DSolver>
+{
+
+public:
+
+    static constexpr uint8_t NVAR = 3;
+    static constexpr double tiny = 1.e-100;
+
+    using celm_type = Celm;
+    using selm_type = Selm;
+
+private:
+
+    struct ctor_passkey
+    {
+    };
+
+public:
+
+    std::shared_ptr<Euler1DSolver> clone(bool grid = false)
+    {
+        auto ret = std::make_shared<Euler1DSolver>(*this);
+        if (grid)
+        {
+            std::shared_ptr<Grid> const new_grid = m_field.clone_grid();
+            ret->m_field.set_grid(new_grid);
+        }
+        return ret;
+    }
+
+    template <class... Args>
+    static std::shared_ptr<Euler1DSolver> construct(Args &&... args)
+    {
+        return std::make_shared<Euler1DSolver>(std::forward<Args>(args)..., ctor_passkey());
+    }
+
+    Euler1DSolver(
+        std::shared_ptr<Grid> const & grid, double time_increment, ctor_passkey const &)
+        : Euler1DSolver(grid, time_increment, Field::Layout::AoS, ctor_passkey())
+    {
+    }
+
+    Euler1DSolver(
+        std::shared_ptr<Grid> const & grid, double time_increment, Field::Layout layout, ctor_passkey const &);
+
+    Euler1DSolver() = delete;
+    Euler1DSolver(Euler1DSolver const &) = default;
+    Euler1DSolver(Euler1DSolver &&) = default;
+    Euler1DSolver & operator=(Euler1DSolver const &) = default;
+    Euler1DSolver & operator=(Euler1DSolver &&) = default;
+    ~Euler1DSolver() = default;
+
+    Field const & field() const { return m_field; }
+    Field & field() { return m_field; }
+
+    size_t nvar() const { return m_field.nvar(); }
+
+    Grid const & grid() const { return m_field.grid(); }
+    Grid & grid() { return m_field.grid(); }
+
+    /// Heat capacity ratio, 1.4 (air) by default.
+    double gamma() const { return m_gamma; }
+    void set_gamma(double value) { m_gamma = value; }
+
+    // NOLINTNEXTLINE(readability-const-return-type,cppcoreguidelines-pro-type-const-cast)
+    Celm const celm(int_type ielm, bool odd_plane) const { return {const_cast<Field *>(&m_field), ielm, odd_plane}; }
+    Celm celm(int_type ielm, bool odd_plane) { return {&m_field, ielm, odd_plane}; }
+    // NOLINTNEXTLINE(readability-const-return-type,cppcoreguidelines-pro-type-const-cast)
+    Selm const selm(int_type ielm, bool odd_plane) const { return {const_cast<Field *>(&m_field), ielm, odd_plane}; }
+    Selm selm(int_type ielm, bool odd_plane) { return {&m_field, ielm, odd_plane}; }
+
+    void update_cfl(bool odd_plane);
+    void march_half_so0(bool odd_plane);
+    template <size_t ALPHA>
+    void march_half_so1_alpha(bool odd_plane);
+    void treat_boundary_so0();
+    void treat_boundary_so1();
+
+    void setup_march() { update_cfl(false); }
+    template <size_t ALPHA>
+    void march_half1_alpha();
+    template <size_t ALPHA>
+    void march_half2_alpha();
+    template <size_t ALPHA>
+    void march_alpha(size_t steps);
+
+private:
+
+    // The rows of m_derived.
+    enum Derived : size_t
+    {
+        FLUX_LL = 0, //< Flux through the lower left of the CE on the right.
+        FLUX_LR = NVAR, //< Flux through the lower right of the CE on the left.
+        UP = 2 * NVAR, //< Variables at the CE center.
+        NDERIVED = 3 * NVAR
+    };
+
+    // Fill m_derived for the SEs of the CEs on the plane.
+    void derive(bool odd_plane);
+    // Update so0 and/or so1 of the next plane from m_derived.
+    template <size_t ALPHA>
+    void march_half_derived(bool odd_plane, bool so0, bool so1);
+
+    // Strides of so0 and so1 of Field for the point and the variable.
+    size_t xstride() const;
+    size_t vstride() const;
+
+    Field m_field;
+    double m_gamma = 1.4;
+    // In the shape (NDERIVED, nselm + 1), for the SEs of a plane.
+    SimpleArray<double> m_derived;
+
+}; /* end class Euler1DSolver */
+
+template <size_t ALPHA>
+inline void Euler1DSolver::march_half_derived(bool odd_plane, bool so0, bool so1)
+{
+    int_type const start = odd_plane ? -1 : 0;
+    auto const stop = static_cast<int_type>(grid().ncelm());
+    auto const nce = static_cast<size_t>(stop - start);
+    size_t const ncol = m_derived.shape(1);
+    size_t const xs = xstride();
+    size_t const vs = vstride();
+    // The new SE of the first CE is at the same xindex as the CE.
+    size_t const xt = grid().xindex_celm(start, odd_plane);
+    double const * MODMESH_RESTRICT xc = grid().xcoord().data() + xt;
+    double const * MODMESH_RESTRICT der = m_derived.data();
+    double * MODMESH_RESTRICT so0p = m_field.so0().data() + xt * xs;
+    double * MODMESH_RESTRICT so1p = m_field.so1().data() + xt * xs;
+    for (size_t iv = 0; iv < NVAR; ++iv)
+    {
+        double const * MODMESH_RESTRICT ll = der + (FLUX_LL + iv) * ncol;
+        double const * MODMESH_RESTRICT lr = der + (FLUX_LR + iv) * ncol;
+        double const * MODMESH_RESTRICT up = der + (UP + iv) * ncol;
+        double * MODMESH_RESTRICT u = so0p + iv * vs;
+        double * MODMESH_RESTRICT ux = so1p + iv * vs;
+        if (so0)
+        {
+            for (size_t ic = 0; ic < nce; ++ic)
+            {
+                double const dx = xc[2 * ic + 1] - xc[2 * ic - 1];
+                u[2 * ic * xs] = (ll[ic] + lr[ic + 1]) / dx;
+            }
+        }
+        if (so1)
+        {
+            for (size_t ic = 0; ic < nce; ++ic)
+            {
+                double const utp = u[2 * ic * xs];
+                double const duxn = (utp - up[ic]) / (xc[2 * ic] - xc[2 * ic - 1]);
+                double const duxp = (up[ic + 1] - utp) / (xc[2 * ic + 1] - xc[2 * ic]);
+                double const fan = pow<ALPHA>(std::abs(duxn));
+                double const fap = pow<ALPHA>(std::abs(duxp));
+                ux[2 * ic * xs] = (fap * duxn + fan * duxp) / (fap + fan + tiny);
+            }
+        }
+    }
+}
+
+template <size_t ALPHA>
+inline void Euler1DSolver::march_half_so1_alpha(bool odd_plane)
+{
+    derive(odd_plane);
+    march_half_derived<ALPHA>(odd_plane, /* so0 */ false, /* so1 */ true);
+}
+
+template <size_t ALPHA>
+inline void Euler1DSolver::march_half1_alpha()
+{
+    derive(false);
+    march_half_derived<ALPHA>(false, /* so0 */ true, /* so1 */ true);
+    treat_boundary_so0();
+    treat_boundary_so1();
+    update_cfl(true);
+}
+
+template <size_t ALPHA>
+inline void Euler1DSolver::march_half2_alpha()
+{
+    // In the second half step, no treating boundary conditions.
+    derive(true);
+    march_half_derived<ALPHA>(true, /* so0 */ true, /* so1 */ true);
+    update_cfl(false);
+}
+
+template <size_t ALPHA>
+inline void Euler1DSolver::march_alpha(size_t steps)
+{
+    for (size_t it = 0; it < steps; ++it)
+    {
+        march_half1_alpha<ALPHA>();
+        march_half2_alpha<ALPHA>();
+    }
+    m_field.bump_epoch();
+}
+
+} /* end namespace spacetime */
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -17,6 +17,65 @@ namespace modmesh
 namespace spacetime
 {
 
+/**
+ * Point-wise formulas of the inviscid Burgers equation on a solution element
+ * of the coordinates (xneg, x, xpos), with the solution u and its gradient
+ * ux.  InviscidBurgersSelm and the array-form march of SolverBase share them.
+ */
+struct InviscidBurgersFlux
+{
+    using value_type = Grid::value_type;
+
+    static value_type xctr(value_type xneg, value_type xpos) { return (xneg + xpos) / 2; }
+
+    static value_type xn(value_type xneg, value_type x, value_type xpos, value_type u, value_type ux)
+    {
+        const value_type displacement = 0.5 * (x + xneg) - xctr(xneg, xpos);
+        return (x - xneg) * (u + displacement * ux);
+    }
+
+    static value_type xp(value_type xneg, value_type x, value_type xpos, value_type u, value_type ux)
+    {
+        const value_type displacement = 0.5 * (x + xpos) - xctr(xneg, xpos);
+        return (xpos - x) * (u + displacement * ux);
+    }
+
+    static value_type tn(value_type xneg, value_type x, value_type xpos, value_type u, value_type ux, value_type hdt, value_type qdt)
+    {
+        const value_type displacement = x - xctr(xneg, xpos);
+        const value_type u_2 = u * u;
+        value_type ret = 0.5 * u_2; /* f(u) */
+        ret += displacement * u * ux; /* displacement in x */
+        ret += qdt * u_2 * ux; /* displacement in t */
+        return hdt * ret;
+    }
+
+    static value_type tp(value_type xneg, value_type x, value_type xpos, value_type u, value_type ux, value_type hdt, value_type qdt)
+    {
+        const value_type displacement = x - xctr(xneg, xpos);
+        const value_type u_2 = u * u;
+        value_type ret = 0.5 * u_2; /* f(u) */
+        ret += displacement * u * ux; /* displacement in x */
+        ret -= qdt * u_2 * ux; /* displacement in t */
+        return hdt * ret;
+    }
+
+    static value_type so0p(value_type xneg, value_type x, value_type xpos, value_type u, value_type ux, value_type hdt)
+    {
+        value_type ret = u;
+        ret += (x - xctr(xneg, xpos)) * ux; /* displacement in x */
+        ret -= hdt * ux; /* displacement in t */
+        return ret;
+    }
+
+    static value_type cfl(value_type xneg, value_type x, value_type xpos, value_type u, value_type hdt)
+    {
+        const value_type hdx = std::min(x - xneg, xpos - x);
+        return std::fabs(u) * hdt / hdx;
+    }
+
+}; /* end struct InviscidBurgersFlux */
+
 /**
  * Flux calculator for the solution element for the inviscid Burgers equation.
  */
@@ -24,6 +83,7 @@ class InviscidBurgersSelm
     : public Selm
 {
     SPACETIME_DERIVED_SELM_BODY_DEFAULT
+    using flux_type = InviscidBurgersFlux;
 }; /* end class FelmBase */
 
 using InviscidBurgersCelm = CelmBase<InviscidBurgersSelm>;
@@ -37,6 +97,8 @@ public:
     using base_type = SolverBase<InviscidBurgersSolver, InviscidBurgersCelm, InviscidBurgersSelm>;
     using base_type::base_type;
 
+    static constexpr char const * CHECKPOINT_KIND = "InviscidBurgersSolver";
+
     static std::shared_ptr<InviscidBurgersSolver>
     construct(std::shared_ptr<Grid> const & grid, value_type time_increment)
     {
@@ -50,8 +112,7 @@ public:
  */
 inline InviscidBurgersSelm::value_type InviscidBurgersSelm::xn(size_t iv) const
 {
-    const value_type displacement = 0.5 * (x() + xneg()) - xctr();
-    return dxneg() * (so0(iv) + displacement * so1(iv));
+    return flux_type::xn(xneg(), x(), xpos(), so0(iv), so1(iv));
 }
 
 /**
@@ -59,8 +120,7 @@ inline InviscidBurgersSelm::value_type InviscidBurgersSelm::xn(size_t iv) const
  */
 inline InviscidBurgersSelm::value_type InviscidBurgersSelm::xp(size_t iv) const
 {
-    const value_type displacement = 0.5 * (x() + xpos()) - xctr();
-    return dxpos() * (so0(iv) + displacement * so1(iv));
+    return flux_type::xp(xneg(), x(), xpos(), so0(iv), so1(iv));
 }
 
 /**
@@ -68,13 +128,7 @@ inline InviscidBurgersSelm::value_type InviscidBurgersSelm::xp(size_t iv) const
  */
 inline InviscidBurgersSelm::value_type InviscidBurgersSelm::tn(size_t iv) const
 {
-    const value_type displacement = x() - xctr();
-    const value_type u = so0(iv);
-    const value_type u_2 = u * u;
-    value_type ret = 0.5 * u_2; /* f(u) */
-    ret += displacement * u * so1(iv); /* displacement in x */
-    ret += qdt() * u_2 * so1(iv); /* displacement in t */
-    return hdt() * ret;
+    return flux_type::tn(xneg(), x(), xpos(), so0(iv), so1(iv), hdt(), qdt());
 }
 
 /**
@@ -82,13 +136,7 @@ inline InviscidBurgersSelm::value_type InviscidBurgersSelm::tn(size_t iv) const
  */
 inline InviscidBurgersSelm::value_type InviscidBurgersSelm::tp(size_t iv) const
 {
-    const value_type displacement = x() - xctr();
-    const value_type u = so0(iv);
-    const value_type u_2 = u * u;
-    value_type ret = 0.5 * u_2; /* f(u) */
-    ret += displacement * u * so1(iv); /* displacement in x */
-    ret -= qdt() * u_2 * so1(iv); /* displacement in t */
-    return hdt() * ret;
+    return flux_type::tp(xneg(), x(), xpos(), so0(iv), so1(iv), hdt(), qdt());
 }
 
 /**
@@ -96,16 +144,12 @@ inline InviscidBurgersSelm::value_type InviscidBurgersSelm::tp(size_t iv) const
  */
 inline InviscidBurgersSelm::value_type InviscidBurgersSelm::so0p(size_t iv) const
 {
-    value_type ret = so0(iv);
-    ret += (x() - xctr()) * so1(iv); /* displacement in x */
-    ret -= hdt() * so1(iv); /* displacement in t */
-    return ret;
+    return flux_type::so0p(xneg(), x(), xpos(), so0(iv), so1(iv), hdt());
 }
 
 inline void InviscidBurgersSelm::update_cfl()
 {
-    const value_type hdx = std::min(dxneg(), dxpos());
-    this->cfl() = std::fabs(so0(0)) * field().hdt() / hdx;
+    this->cfl() = flux_type::cfl(xneg(), x(), xpos(), so0(0), field().hdt());
 }
 
 } /* end namespace spacetime */
@@ -17,10 +17,68 @@ namespace modmesh
 namespace spacetime
 {
 
+/**
+ * Point-wise formulas of the linear scalar equation on a solution element of
+ * the coordinates (xneg, x, xpos), with the solution u and its gradient ux.
+ * LinearScalarSelm and the array-form march of SolverBase share them.
+ */
+struct LinearScalarFlux
+{
+    using value_type = Grid::value_type;
+
+    static value_type xctr(value_type xneg, value_type xpos) { return (xneg + xpos) / 2; }
+
+    static value_type xn(value_type xneg, value_type x, value_type xpos, value_type u, value_type ux)
+    {
+        const value_type displacement = 0.5 * (x + xneg) - xctr(xneg, xpos);
+        return (x - xneg) * (u + displacement * ux);
+    }
+
+    static value_type xp(value_type xneg, value_type x, value_type xpos, value_type u, value_type ux)
+    {
+        const value_type displacement = 0.5 * (x + xpos) - xctr(xneg, xpos);
+        return (xpos - x) * (u + displacement * ux);
+    }
+
+    static value_type tn(value_type xneg, value_type x, value_type xpos, value_type u, value_type ux, value_type hdt, value_type qdt)
+    {
+        const value_type displacement = x - xctr(xneg, xpos);
+        value_type ret = u; /* f(u) */
+        ret += displacement * ux; /* displacement in x; f_u == 1 */
+        ret += qdt * ux; /* displacement in t */
+        return hdt * ret;
+    }
+
+    static value_type tp(value_type xneg, value_type x, value_type xpos, value_type u, value_type ux, value_type hdt, value_type qdt)
+    {
+        const value_type displacement = x - xctr(xneg, xpos);
+        value_type ret = u; /* f(u) */
+        ret += displacement * ux; /* displacement in x; f_u == 1 */
+        ret -= qdt * ux; /* displacement in t */
+        return hdt * ret;
+    }
+
+    static value_type so0p(value_type xneg, value_type x, value_type xpos, value_type u, value_type ux, value_type hdt)
+    {
+        value_type ret = u;
+        ret += (x - xctr(xneg, xpos)) * ux; /* displacement in x */
+        ret -= hdt * ux; /* displacement in t */
+        return ret;
+    }
+
+    static value_type cfl(value_type xneg, value_type x, value_type xpos, value_type /* u */, value_type hdt)
+    {
+        const value_type hdx = std::min(x - xneg, xpos - x);
+        return hdt / hdx;
+    }
+
+}; /* end struct LinearScalarFlux */
+
 class LinearScalarSelm
     : public Selm
 {
     SPACETIME_DERIVED_SELM_BODY_DEFAULT
+    using flux_type = LinearScalarFlux;
 }; /* end class LinearScalarSelm */
 
 using LinearScalarCelm = CelmBase<LinearScalarSelm>;
@@ -34,6 +92,8 @@ public:
     using base_type = SolverBase<LinearScalarSolver, LinearScalarCelm, LinearScalarSelm>;
     using base_type::base_type;
 
+    static constexpr char const * CHECKPOINT_KIND = "LinearScalarSolver";
+
     static std::shared_ptr<LinearScalarSolver>
     construct(std::shared_ptr<Grid> const & grid, value_type time_increment)
     {
@@ -44,46 +104,32 @@ public:
 
 inline LinearScalarSelm::value_type LinearScalarSelm::xn(size_t iv) const
 {
-    const value_type displacement = 0.5 * (x() + xneg()) - xctr();
-    return dxneg() * (so0(iv) + displacement * so1(iv));
+    return flux_type::xn(xneg(), x(), xpos(), so0(iv), so1(iv));
 }
 
 inline LinearScalarSelm::value_type LinearScalarSelm::xp(size_t iv) const
 {
-    const value_type displacement = 0.5 * (x() + xpos()) - xctr();
-    return dxpos() * (so0(iv) + displacement * so1(iv));
+    return flux_type::xp(xneg(), x(), xpos(), so0(iv), so1(iv));
 }
 
 inline LinearScalarSelm::value_type LinearScalarSelm::tn(size_t iv) const
 {
-    const value_type displacement = x() - xctr();
-    value_type ret = so0(iv); /* f(u) */
-    ret += displacement * so1(iv); /* displacement in x; f_u == 1 */
-    ret += qdt() * so1(iv); /* displacement in t */
-    return hdt() * ret;
+    return flux_type::tn(xneg(), x(), xpos(), so0(iv), so1(iv), hdt(), qdt());
 }
 
 inline LinearScalarSelm::value_type LinearScalarSelm::tp(size_t iv) const
 {
-    const value_type displacement = x() - xctr();
-    value_type ret = so0(iv); /* f(u) */
-    ret += displacement * so1(iv); /* displacement in x; f_u == 1 */
-    ret -= qdt() * so1(iv); /* displacement in t */
-    return hdt() * ret;
+    return flux_type::tp(xneg(), x(), xpos(), so0(iv), so1(iv), hdt(), qdt());
 }
 
 inline LinearScalarSelm::value_type LinearScalarSelm::so0p(size_t iv) const
 {
-    value_type ret = so0(iv);
-    ret += (x() - xctr()) * so1(iv); /* displacement in x */
-    ret -= hdt() * so1(iv); /* displacement in t */
-    return ret;
+    return flux_type::so0p(xneg(), x(), xpos(), so0(iv), so1(iv), hdt());
 }
 
 inline void LinearScalarSelm::update_cfl()
 {
-    const value_type hdx = std::min(dxneg(), dxpos());
-    this->cfl() = field().hdt() / hdx;
+    this->cfl() = flux_type::cfl(xneg(), x(), xpos(), so0(0), field().hdt());
 }
 
 } /* end namespace spacetime */
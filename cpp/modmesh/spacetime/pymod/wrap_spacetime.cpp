@@ -53,13 +53,14 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapGrid
         (*this)
             .def(
                 py::init(
-                    [](real_type xmin, real_type xmax, size_t nelm)
+                    [](real_type xmin, real_type xmax, size_t nelm, real_type ratio)
                     {
-                        return Grid::construct(xmin, xmax, nelm);
+                        return Grid::construct(xmin, xmax, nelm, ratio);
                     }),
                 py::arg("xmin"),
                 py::arg("xmax"),
-                py::arg("nelm"))
+                py::arg("nelm"),
+                py::arg("ratio") = 1.0)
             .def(
                 py::init(
                     [](py::array_t<wrapped_type::value_type> & xloc)
@@ -132,6 +133,10 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapField
                 [](wrapped_type & self)
                 { return self.grid().shared_from_this(); })
             .def_property_readonly("nvar", &wrapped_type::nvar)
+            .def_property_readonly(
+                "soa",
+                [](wrapped_type const & self)
+                { return Field::Layout::SoA == self.layout(); })
             .def_property("time_increment", &wrapped_type::time_increment, &wrapped_type::set_time_increment)
             .def_property_readonly("dt", &wrapped_type::dt)
             .def_property_readonly("hdt", &wrapped_type::hdt)
@@ -320,13 +325,15 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapLinearScalarSelm
 
 }; /* end class WrapLinearScalarSelm */
 
-class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapBadEuler1DSolver
-    : public WrapBase<WrapBadEuler1DSolver, BadEuler1DSolver, std::shared_ptr<BadEuler1DSolver>>
+/// The wrapper of BadEuler1DSolver and Euler1DSolver, which share the interface.
+template <typename ST>
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapEuler1DSolverBase
+    : public WrapBase<WrapEuler1DSolverBase<ST>, ST, std::shared_ptr<ST>>
 {
 
 public:
 
-    using base_type = WrapBase<WrapBadEuler1DSolver, BadEuler1DSolver, std::shared_ptr<BadEuler1DSolver>>;
+    using base_type = WrapBase<WrapEuler1DSolverBase<ST>, ST, std::shared_ptr<ST>>;
     using wrapper_type = typename base_type::wrapper_type;
     using wrapped_type = typename base_type::wrapped_type;
 
@@ -334,7 +341,7 @@ public:
 
 protected:
 
-    WrapBadEuler1DSolver(pybind11::module & mod, const char * pyname, const char * clsdoc)
+    WrapEuler1DSolverBase(pybind11::module & mod, const char * pyname, const char * clsdoc)
         : base_type(mod, pyname, clsdoc)
     {
 
@@ -343,12 +350,13 @@ protected:
         (*this)
             .def(
                 py::init(
-                    [](std::shared_ptr<Grid> const & grid, double time_increment)
+                    [](std::shared_ptr<Grid> const & grid, double time_increment, bool soa)
                     {
-                        return wrapped_type::construct(grid, time_increment);
+                        return wrapped_type::construct(grid, time_increment, soa ? Field::Layout::SoA : Field::Layout::AoS);
                     }),
                 py::arg("grid"),
-                py::arg("time_increment"))
+                py::arg("time_increment"),
+                py::arg("soa") = false)
             .def("__str__", &detail::to_str<wrapped_type>)
             .def_timed("clone", &wrapped_type::clone, py::arg("grid") = false)
             .def_property_readonly(
@@ -360,6 +368,12 @@ protected:
                 [](wrapped_type & self) -> auto &
                 { return self.field(); });
 
+        if constexpr (std::is_same_v<ST, Euler1DSolver>)
+        {
+            (*this)
+                .def_property("gamma", &wrapped_type::gamma, &wrapped_type::set_gamma);
+        }
+
         (*this)
             .def_group_array_getter()
             .def_group_array_setter()
@@ -539,16 +553,16 @@ protected:
         namespace py = pybind11;
 
         (*this)
-            .def_timed("update_cfl", &wrapped_type::update_cfl, py::arg("odd_plane"))
-            .def_timed("march_half_so0", &wrapped_type::march_half_so0, py::arg("odd_plane"))
-            .def_timed("treat_boundary_so0", &wrapped_type::treat_boundary_so0)
-            .def_timed("treat_boundary_so1", &wrapped_type::treat_boundary_so1)
-            .def_timed("setup_march", &wrapped_type::setup_march);
+            .def_timed("update_cfl", &wrapped_type::update_cfl, py::arg("odd_plane"), py::call_guard<py::gil_scoped_release>())
+            .def_timed("march_half_so0", &wrapped_type::march_half_so0, py::arg("odd_plane"), py::call_guard<py::gil_scoped_release>())
+            .def_timed("treat_boundary_so0", &wrapped_type::treat_boundary_so0, py::call_guard<py::gil_scoped_release>())
+            .def_timed("treat_boundary_so1", &wrapped_type::treat_boundary_so1, py::call_guard<py::gil_scoped_release>())
+            .def_timed("setup_march", &wrapped_type::setup_march, py::call_guard<py::gil_scoped_release>());
 
         (*this)
-            .def_group_so1<0>()
-            .def_group_so1<1>()
-            .def_group_so1<2>();
+            .template def_group_so1<0>()
+            .template def_group_so1<1>()
+            .template def_group_so1<2>();
 
         return *this;
     }
@@ -566,31 +580,35 @@ protected:
                 {
                     return self.template march_half_so1_alpha<ALPHA>(odd_plane);
                 },
-                py::arg("odd_plane"))
+                py::arg("odd_plane"),
+                py::call_guard<py::gil_scoped_release>())
             .def_timed(
                 (Formatter() << "march_half1_alpha" << ALPHA).str().c_str(),
                 [](wrapped_type & self)
                 {
                     self.template march_half1_alpha<ALPHA>();
-                })
+                },
+                py::call_guard<py::gil_scoped_release>())
             .def_timed(
                 (Formatter() << "march_half2_alpha" << ALPHA).str().c_str(),
                 [](wrapped_type & self)
                 {
                     self.template march_half2_alpha<ALPHA>();
-                })
+                },
+                py::call_guard<py::gil_scoped_release>())
             .def_timed(
                 (Formatter() << "march_alpha" << ALPHA).str().c_str(),
                 [](wrapped_type & self, size_t steps)
                 {
                     self.template march_alpha<ALPHA>(steps);
                 },
-                py::arg("steps"));
+                py::arg("steps"),
+                py::call_guard<py::gil_scoped_release>());
 
         return *this;
     }
 
-}; /* end class WrapBadEuler1DSolver */
+}; /* end class WrapEuler1DSolverBase */
 
 template <typename WST, typename WCET, typename WSET>
 void add_solver(pybind11::module & mod, const std::string & name, const std::string & desc)
@@ -623,7 +641,8 @@ void wrap_spacetime(pybind11::module & mod)
         WrapInviscidBurgersCelm,
         WrapInviscidBurgersSelm>(mod, "InviscidBurgers", "the inviscid Burgers equation");
 
-    WrapBadEuler1DSolver::commit(mod, "BadEuler1DSolver", "Solve the Euler equation (a bad one)");
+    WrapEuler1DSolverBase<BadEuler1DSolver>::commit(mod, "BadEuler1DSolver", "Solve the Euler equation (a bad one)");
+    WrapEuler1DSolverBase<Euler1DSolver>::commit(mod, "Euler1DSolver", "Solve the Euler equation");
 }
 
 } /* end namespace python */
@@ -41,6 +41,7 @@
 
 #include <functional>
 #include <list>
+#include <optional>
 #include <sstream>
 
 namespace modmesh
@@ -327,7 +328,9 @@ protected:
             .def("__str__", &detail::to_str<wrapped_type>)
             .def("clone", &wrapped_type::clone, py::arg("grid") = false)
             .def_property_readonly("grid", [](wrapped_type & self)
-                                   { return self.grid().shared_from_this(); });
+                                   { return self.grid().shared_from_this(); })
+            .def_property_readonly_static("static_kernel", [](py::object const &)
+                                          { return wrapped_type::static_kernel; });
 
         (*this)
             .def("x", &wrapped_type::x, py::arg("odd_plane") = false)
@@ -349,6 +352,25 @@ protected:
             .def_property_readonly("dt", &wrapped_type::dt)
             .def_property_readonly("hdt", &wrapped_type::hdt)
             .def_property_readonly("qdt", &wrapped_type::qdt)
+            .def_property_readonly("nstep", &wrapped_type::nstep)
+            .def_property_readonly("time", &wrapped_type::time)
+            .def_property_readonly("max_cfl", &wrapped_type::max_cfl)
+            .def_property("target_cfl", &wrapped_type::target_cfl, &wrapped_type::set_target_cfl)
+            .def("checkpoint", &wrapped_type::checkpoint)
+            .def(
+                "restore",
+                [](wrapped_type & self, Checkpoint const & checkpoint)
+                { self.restore(checkpoint); },
+                py::arg("checkpoint"))
+            .def(
+                "restore",
+                [](wrapped_type & self, std::string const & path, bool mmap)
+                {
+                    py::gil_scoped_release const release;
+                    self.restore(Checkpoint::load(path, mmap));
+                },
+                py::arg("path"),
+                py::arg("mmap") = true)
             .def("celm", static_cast<celm_getter>(&wrapped_type::celm_at), py::arg("ielm"), py::arg("odd_plane") = false)
             .def("selm", static_cast<selm_getter>(&wrapped_type::selm_at), py::arg("ielm"), py::arg("odd_plane") = false)
             .def(
@@ -418,7 +440,18 @@ protected:
             .def("march_half_so0", &wrapped_type::march_half_so0, py::arg("odd_plane"))
             .def("treat_boundary_so0", &wrapped_type::treat_boundary_so0)
             .def("treat_boundary_so1", &wrapped_type::treat_boundary_so1)
-            .def("setup_march", &wrapped_type::setup_march);
+            .def("setup_march", &wrapped_type::setup_march)
+            .def_property("parallel", &wrapped_type::parallel, &wrapped_type::set_parallel)
+            .def_property("batched", &wrapped_type::batched, &wrapped_type::set_batched)
+            .def_property("block_steps", &wrapped_type::block_steps, &wrapped_type::set_block_steps)
+            .def_property("block_width", &wrapped_type::block_width, &wrapped_type::set_block_width)
+            .def_property(
+                "time_levels",
+                [](wrapped_type const & self)
+                { return self.time_levels(); },
+                [](wrapped_type & self, py::array_t<uint8_t> & arr)
+                { self.set_time_levels(makeSimpleArray(arr)); })
+            .def_property_readonly("nupdate", &wrapped_type::nupdate);
 
 // clang-format off
 #define DECL_ST_WRAP_MARCH_ALPHA(ALPHA) \
@@ -444,6 +477,46 @@ protected:
         "march_alpha"#ALPHA \
       , [](wrapped_type & self, size_t steps) { self.template march_alpha<ALPHA>(steps); } \
       , py::arg("steps") \
+    ) \
+    .def \
+    ( \
+        "run_alpha"#ALPHA \
+      , [](wrapped_type & self, size_t steps, size_t every, py::function const & hook) \
+        { \
+            /* A Python kernel needs the GIL to march. */ \
+            std::optional<py::gil_scoped_release> release; \
+            if (wrapped_type::static_kernel) { release.emplace(); } \
+            self.template run_alpha<ALPHA>(steps, every, [&]() \
+            { \
+                py::gil_scoped_acquire const acquire; \
+                hook(); \
+            }); \
+        } \
+      , py::arg("steps"), py::arg("every"), py::arg("hook") \
+    ) \
+    .def \
+    ( \
+        "record_alpha"#ALPHA \
+      , [](wrapped_type & self, size_t steps, size_t every, py::array_t<typename wrapped_type::value_type> & time_history, py::array_t<typename wrapped_type::value_type> & so0_history) \
+        { \
+            auto thist = makeWritableSimpleArray(time_history, "time_history"); \
+            auto shist = makeWritableSimpleArray(so0_history, "so0_history"); \
+            std::optional<py::gil_scoped_release> release; \
+            if (wrapped_type::static_kernel) { release.emplace(); } \
+            return self.template record_alpha<ALPHA>(steps, every, thist, shist); \
+        } \
+      , py::arg("steps"), py::arg("every"), py::arg("time_history").noconvert(), py::arg("so0_history").noconvert() \
+    ) \
+    .def \
+    ( \
+        "monitor_alpha"#ALPHA \
+      , [](wrapped_type & self, size_t steps, size_t every, SimpleArrayMonitor<typename wrapped_type::value_type> & monitor) \
+        { \
+            std::optional<py::gil_scoped_release> release; \
+            if (wrapped_type::static_kernel) { release.emplace(); } \
+            return self.template monitor_alpha<ALPHA>(steps, every, monitor); \
+        } \
+      , py::arg("steps"), py::arg("every"), py::arg("monitor") \
     )
 
         (*this)
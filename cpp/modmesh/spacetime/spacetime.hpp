@@ -14,5 +14,6 @@
 #include <modmesh/spacetime/kernel/linear_scalar.hpp>
 #include <modmesh/spacetime/kernel/inviscid_burgers.hpp>
 #include <modmesh/spacetime/kernel/BadEuler1DSolver.hpp>
+#include <modmesh/spacetime/kernel/Euler1DSolver.hpp>
 
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
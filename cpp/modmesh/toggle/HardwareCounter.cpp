@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/toggle/HardwareCounter.hpp>
+
+#include <stdexcept>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+#if defined(__linux__)
+
+/**
+ * The counters of a thread, opened as a group led by the cycles, so that a
+ * read() returns all of them at once.
+ */
+class HardwareCounterGroup
+{
+
+public:
+
+    static constexpr size_t NCOUNTER = 4;
+
+    /// The group of the calling thread.
+    static HardwareCounterGroup & me()
+    {
+        thread_local HardwareCounterGroup group;
+        return group;
+    }
+
+    HardwareCounterGroup(HardwareCounterGroup const &) = delete;
+    HardwareCounterGroup(HardwareCounterGroup &&) = delete;
+    HardwareCounterGroup & operator=(HardwareCounterGroup const &) = delete;
+    HardwareCounterGroup & operator=(HardwareCounterGroup &&) = delete;
+
+    ~HardwareCounterGroup()
+    {
+        for (int fd : m_fds)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+        }
+    }
+
+    bool opened() const { return m_fds[0] >= 0; }
+    std::string const & reason() const { return m_reason; }
+
+    HardwareCounterValues read() const
+    {
+        HardwareCounterValues ret;
+        if (!opened())
+        {
+            return ret;
+        }
+        // The format of PERF_FORMAT_GROUP: the number of the counters and the values.
+        uint64_t buffer[1 + NCOUNTER] = {};
+        if (::read(m_fds[0], buffer, sizeof(buffer)) <= 0)
+        {
+            return ret;
+        }
+        uint64_t * const fields[NCOUNTER] = {&ret.cycles, &ret.instructions, &ret.llc_misses, &ret.branch_misses};
+        for (size_t i = 0; i < NCOUNTER; ++i)
+        {
+            if (m_index[i] >= 0 && static_cast<uint64_t>(m_index[i]) < buffer[0])
+            {
+                *fields[i] = buffer[1 + m_index[i]];
+            }
+        }
+        return ret;
+    }
+
+private:
+
+    HardwareCounterGroup()
+    {
+        uint64_t const configs[NCOUNTER] = {
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_MISSES, // usually the last-level cache
+            PERF_COUNT_HW_BRANCH_MISSES,
+        };
+        int nopened = 0;
+        for (size_t i = 0; i < NCOUNTER; ++i)
+        {
+            m_fds[i] = open(configs[i], 0 == i ? -1 : m_fds[0]);
+            if (m_fds[i] < 0)
+            {
+                if (0 == i)
+                {
+                    m_reason = Formatter() << "perf_event_open: " << std::strerror(errno);
+                    return;
+                }
+                // Count the rest without the unsupported one.
+                continue;
+            }
+            m_index[i] = nopened++;
+        }
+        ioctl(m_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(m_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    static int open(uint64_t config, int group_fd)
+    {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.disabled = -1 == group_fd ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        // The calling thread on any CPU.
+        return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+    }
+
+    int m_fds[NCOUNTER] = {-1, -1, -1, -1};
+    int m_index[NCOUNTER] = {-1, -1, -1, -1}; /// positions in the group read
+    std::string m_reason;
+
+}; /* end class HardwareCounterGroup */
+
+#endif // __linux__
+
+} /* end namespace detail */
+
+HardwareCounter & HardwareCounter::me()
+{
+    static HardwareCounter instance;
+    return instance;
+}
+
+bool HardwareCounter::available()
+{
+    return unavailable_reason().empty();
+}
+
+std::string HardwareCounter::unavailable_reason()
+{
+#if defined(__linux__)
+    return detail::HardwareCounterGroup::me().reason();
+#else
+    return "HardwareCounter: no backend on this platform";
+#endif
+}
+
+void HardwareCounter::enable()
+{
+    std::string const reason = unavailable_reason();
+    if (!reason.empty())
+    {
+        throw std::runtime_error(Formatter() << "HardwareCounter: cannot enable: " << reason);
+    }
+    m_enabled.store(true, std::memory_order_relaxed);
+}
+
+HardwareCounterValues HardwareCounter::read()
+{
+#if defined(__linux__)
+    return detail::HardwareCounterGroup::me().read();
+#else
+    return HardwareCounterValues{};
+#endif
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,134 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Opt-in hardware performance counters of the calling thread.
+ */
+
+#include <modmesh/base.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace modmesh
+{
+
+/// Values of the hardware counters, or their differences over a scope.
+struct HardwareCounterValues
+{
+    /// The bytes moved by a last-level cache miss.
+    static constexpr uint64_t CACHE_LINE_SIZE = 64;
+
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t llc_misses = 0; /// last-level cache misses
+    uint64_t branch_misses = 0;
+
+    /// Instructions per cycle; 0 when no cycle is counted.
+    double ipc() const { return 0 == cycles ? 0.0 : static_cast<double>(instructions) / static_cast<double>(cycles); }
+
+    /// Bytes per second moved by the last-level cache misses over the time in seconds.
+    double llc_bandwidth(double time) const
+    {
+        return time <= 0.0 ? 0.0 : static_cast<double>(llc_misses * CACHE_LINE_SIZE) / time;
+    }
+
+    HardwareCounterValues & operator+=(HardwareCounterValues const & other)
+    {
+        cycles += other.cycles;
+        instructions += other.instructions;
+        llc_misses += other.llc_misses;
+        branch_misses += other.branch_misses;
+        return *this;
+    }
+
+    HardwareCounterValues operator-(HardwareCounterValues const & other) const
+    {
+        HardwareCounterValues ret;
+        ret.cycles = cycles - other.cycles;
+        ret.instructions = instructions - other.instructions;
+        ret.llc_misses = llc_misses - other.llc_misses;
+        ret.branch_misses = branch_misses - other.branch_misses;
+        return ret;
+    }
+}; /* end struct HardwareCounterValues */
+
+/**
+ * Count cycles, instructions, last-level cache misses, and branch misses of
+ * the calling thread in user space.  The timed scopes (MODMESH_TIME and the
+ * def_timed wrappers) add the counts to their TimedEntry when enabled, and
+ * TimeRegistry::report() shows the derived IPC and bandwidth.
+ *
+ * The backend is perf_event_open on Linux; it is not available on the other
+ * platforms, or when the kernel does not permit it (see
+ * /proc/sys/kernel/perf_event_paranoid).  A counter that the CPU does not
+ * support reads zero.  Each thread opens its counters at its first read.
+ * The recorder is disabled by default and costs an atomic load per scope
+ * then; a read costs a system call.
+ */
+class HardwareCounter
+{
+
+public:
+
+    /// The singleton.
+    static HardwareCounter & me();
+
+    HardwareCounter(HardwareCounter const &) = delete;
+    HardwareCounter(HardwareCounter &&) = delete;
+    HardwareCounter & operator=(HardwareCounter const &) = delete;
+    HardwareCounter & operator=(HardwareCounter &&) = delete;
+    ~HardwareCounter() = default;
+
+    /// Whether the counters open in the calling thread.
+    static bool available();
+    /// Why the counters do not open in the calling thread; empty if they do.
+    static std::string unavailable_reason();
+
+    bool enabled() const noexcept { return m_enabled.load(std::memory_order_relaxed); }
+    /// Throw std::runtime_error when the counters are not available.
+    void enable();
+    void disable() noexcept { m_enabled.store(false, std::memory_order_relaxed); }
+
+    /// The counts of the calling thread since its counters opened.
+    static HardwareCounterValues read();
+
+private:
+
+    HardwareCounter() = default;
+
+    std::atomic<bool> m_enabled{false};
+
+}; /* end class HardwareCounter */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
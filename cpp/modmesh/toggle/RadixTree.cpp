@@ -31,22 +31,94 @@
 namespace modmesh
 {
 
+CallProfiler::key_type CallProfiler::intern(std::string const & caller_name)
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    auto [it, inserted] = m_keys.try_emplace(caller_name, static_cast<key_type>(m_keys.size()));
+    return it->second;
+}
+
 void CallProfiler::reset()
 {
-    while (!m_radix_tree.is_root())
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    for (std::unique_ptr<tree_type> const & tree : m_trees)
     {
-        CallerProfile & profile = m_radix_tree.get_current_node()->data();
-        if (profile.is_running)
+        while (!tree->is_root())
         {
-            profile.stop_stopwatch();
+            CallerProfile & profile = tree->get_current_node()->data();
+            if (profile.is_running)
+            {
+                profile.stop_stopwatch();
+            }
+            tree->move_current_to_parent();
         }
-        m_radix_tree.move_current_to_parent();
+        tree->reset();
+    }
+}
+
+size_t CallProfiler::nthread() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_trees.size();
+}
+
+RadixTreeNode<CallerProfile> const & CallProfiler::thread_result(size_t ithread) const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    if (ithread >= m_trees.size())
+    {
+        throw std::out_of_range(Formatter() << "CallProfiler: thread " << ithread << " is out of range of " << m_trees.size());
+    }
+    return m_trees[ithread]->get_root();
+}
+
+std::unique_ptr<RadixTree<CallerProfile>> CallProfiler::merged_result() const
+{
+    auto ret = std::make_unique<tree_type>();
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    for (std::unique_ptr<tree_type> const & tree : m_trees)
+    {
+        merge(*ret, tree->get_root());
+    }
+    return ret;
+}
+
+// NOLINTNEXTLINE(misc-no-recursion)
+void CallProfiler::merge(tree_type & dst, node_type const & src)
+{
+    // The merged tree interns the names by itself.
+    for (node_type const * child : src.children())
+    {
+        CallerProfile & target = dst.entry(child->name());
+        if (target.caller_name.empty())
+        {
+            target.caller_name = child->data().caller_name;
+        }
+        target.total_time += child->data().total_time;
+        target.call_count += child->data().call_count;
+        // NOLINTNEXTLINE(misc-no-recursion)
+        merge(dst, *child);
+        dst.move_current_to_parent();
+    }
+}
+
+void CallProfiler::print_profiling_result(std::ostream & outstream) const
+{
+    print_profiling_result(merged_result()->get_root(), 0, outstream);
+}
+
+void CallProfiler::print_thread_profiling_result(std::ostream & outstream) const
+{
+    size_t const nthd = nthread();
+    for (size_t ithread = 0; ithread < nthd; ++ithread)
+    {
+        outstream << "Thread " << ithread << ": ";
+        print_profiling_result(thread_result(ithread), 0, outstream);
     }
-    m_radix_tree.reset();
 }
 
 // NOLINTNEXTLINE(misc-no-recursion)
-void CallProfiler::print_profiling_result(const RadixTreeNode<CallerProfile> & node, const int depth, std::ostream & outstream) const
+void CallProfiler::print_profiling_result(const RadixTreeNode<CallerProfile> & node, const int depth, std::ostream & outstream)
 {
     for (int i = 0; i < depth; ++i)
     {
@@ -28,66 +28,47 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <modmesh/toggle/profile.hpp>
+
 #include <algorithm>
 #include <chrono>
 #include <functional>
 #include <iostream>
-#include <list>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <stack>
 #include <unordered_map>
+#include <vector>
 
 namespace modmesh
 {
-/**
- * Simple Timed Entry
- */
-class TimedEntry
-{
-public:
-    size_t count() const { return m_count; }
-    double time() const { return m_time; }
-
-    TimedEntry & add_time(double time)
-    {
-        ++m_count;
-        m_time += time;
-        return *this;
-    }
-
-    friend std::ostream & operator<<(std::ostream & os, const TimedEntry & entry)
-    {
-        os << "Count: " << entry.count() << " - Time: " << entry.time();
-        return os;
-    }
 
-private:
-    size_t m_count = 0;
-    double m_time = 0.0;
-}; /* end class TimedEntry */
+template <typename T>
+class RadixTree;
 
 template <typename T>
 class RadixTreeNode
 {
 public:
 
-    using child_list_type = std::list<std::unique_ptr<RadixTreeNode<T>>>;
+    using child_list_type = std::vector<RadixTreeNode<T> *>;
     using key_type = int32_t;
 
     static_assert(std::is_integral_v<key_type> && std::is_signed_v<key_type>, "signed integral required");
 
     RadixTreeNode(std::string const & name, key_type key)
-        : m_name(name)
-        , m_key(key)
+        : m_key(key)
+        , m_name(name)
         , m_prev(nullptr)
     {
     }
 
     RadixTreeNode() = default;
-    RadixTreeNode(RadixTreeNode const &) = default;
+    // The children are not owned; the nodes live in the arena of the tree.
+    RadixTreeNode(RadixTreeNode const &) = delete;
     RadixTreeNode(RadixTreeNode &&) = default;
-    RadixTreeNode & operator=(RadixTreeNode const &) = default;
+    RadixTreeNode & operator=(RadixTreeNode const &) = delete;
     RadixTreeNode & operator=(RadixTreeNode &&) = default;
     ~RadixTreeNode() = default;
 
@@ -97,106 +78,227 @@ public:
     const T & data() const { return m_data; }
     const child_list_type & children() const { return m_children; }
 
-    RadixTreeNode<T> * add_child(std::string const & name, key_type key)
-    {
-        auto new_child = std::make_unique<RadixTreeNode<T>>(name, key);
-        new_child->m_prev = this;
-        m_children.push_back(std::move(new_child));
-        return m_children.back().get();
-    }
-
+    /// Linear search; RadixTree::find_child() is the constant-time lookup.
     RadixTreeNode<T> * get_child(key_type key) const
     {
         auto it = std::find_if(m_children.begin(), m_children.end(), [&](const auto & child)
                                { return child->key() == key; });
-        return (it != m_children.end()) ? it->get() : nullptr;
+        return (it != m_children.end()) ? *it : nullptr;
     }
 
-    RadixTreeNode<T> * get_child(std::string name) const
+    RadixTreeNode<T> * get_child(std::string const & name) const
     {
         auto it = std::find_if(m_children.begin(), m_children.end(), [&](const auto & child)
                                { return child->name() == name; });
-        return (it != m_children.end()) ? it->get() : nullptr;
+        return (it != m_children.end()) ? *it : nullptr;
     }
 
     RadixTreeNode<T> * get_prev() const { return m_prev; }
 
 private:
     key_type m_key = -1;
+    uint32_t m_serial = 0; /// index in the arena of the tree
     std::string m_name;
     T m_data;
     child_list_type m_children;
     RadixTreeNode<T> * m_prev = nullptr;
+
+    friend RadixTree<T>;
 }; /* end class RadixTreeNode */
 
-/*
-Ref:
-https://kalkicode.com/radix-tree-implementation
-https://www.algotree.org/algorithms/trie/
-*/
+/**
+ * The call tree keyed by integral IDs.  The nodes are allocated from chunks
+ * owned by the tree and the children are found by a flat open-addressing
+ * table keyed by (parent, key), so that entering a visited node neither
+ * allocates nor compares strings.
+ *
+ * entry(name) interns the names in the tree.  entry(key, name) takes the key
+ * interned by the caller, e.g., CallProfiler::intern(); do not mix the two on
+ * the same tree.
+ *
+ * Ref:
+ * https://kalkicode.com/radix-tree-implementation
+ * https://www.algotree.org/algorithms/trie/
+ */
 template <typename T>
 class RadixTree
 {
 public:
-    using key_type = typename RadixTreeNode<T>::key_type;
-    RadixTree()
-        : m_root(std::make_unique<RadixTreeNode<T>>())
-        , m_current_node(m_root.get())
-    {
-    }
+    using node_type = RadixTreeNode<T>;
+    using key_type = typename node_type::key_type;
+
+    RadixTree() { reset(); }
+
+    RadixTree(RadixTree const &) = delete;
+    RadixTree(RadixTree &&) = default;
+    RadixTree & operator=(RadixTree const &) = delete;
+    RadixTree & operator=(RadixTree &&) = default;
+    ~RadixTree() = default;
 
     T & entry(const std::string & name)
     {
-        key_type id = get_id(name);
-
-        RadixTreeNode<T> * child = m_current_node->get_child(id);
+        return entry(get_id(name), name.c_str());
+    }
 
-        if (!child)
-        {
-            m_current_node = m_current_node->add_child(name, id);
-        }
-        else
+    /// Enter the child of the key.  The name is copied only when the child is added.
+    T & entry(key_type key, char const * name)
+    {
+        node_type * child = find_child(*m_current_node, key);
+        if (nullptr == child)
         {
-            m_current_node = child;
+            child = add_child(*m_current_node, key, name);
         }
-
-        return m_current_node->data();
+        m_current_node = child;
+        return child->data();
     }
 
     void move_current_to_parent()
     {
-        if (m_current_node != m_root.get())
+        if (m_current_node != m_root)
         {
             m_current_node = m_current_node->get_prev();
         }
     }
 
+    /// Clear the tree and keep the allocated chunks for the new nodes.
     void reset()
     {
-        m_root = std::move(std::make_unique<RadixTreeNode<T>>());
-        m_current_node = m_root.get();
+        m_nnode = 0;
+        m_slots.assign(INITIAL_NSLOT, slot_type{});
+        m_nslot_used = 0;
+        m_shift = 64 - log2(INITIAL_NSLOT);
+        m_root = allocate("", -1);
+        m_current_node = m_root;
         m_id_map.clear();
         m_unique_id = 0;
     }
 
     bool is_root() const
     {
-        return m_current_node == m_root.get();
+        return m_current_node == m_root;
+    }
+
+    /// The child of the key in constant time, or nullptr.
+    node_type * find_child(node_type const & parent, key_type key) const
+    {
+        uint64_t const code = make_code(parent, key);
+        size_t const mask = m_slots.size() - 1;
+        for (size_t i = home(code);; i = (i + 1) & mask)
+        {
+            slot_type const & slot = m_slots[i];
+            if (nullptr == slot.node || code == slot.code)
+            {
+                return slot.node;
+            }
+        }
     }
 
     RadixTreeNode<T> * get_current_node() const { return m_current_node; }
+    RadixTreeNode<T> const & get_root() const { return *m_root; }
     key_type get_unique_node() const { return m_unique_id; }
+    size_t nnode() const { return m_nnode; }
 
 private:
+    struct slot_type
+    {
+        uint64_t code = 0;
+        node_type * node = nullptr;
+    }; /* end struct slot_type */
+
+    static constexpr size_t CHUNK_SIZE = 256;
+    static constexpr size_t INITIAL_NSLOT = 64;
+
+    static uint64_t make_code(node_type const & parent, key_type key)
+    {
+        return (static_cast<uint64_t>(parent.m_serial) << 32) | static_cast<uint32_t>(key);
+    }
+
+    static int log2(size_t value)
+    {
+        int ret = 0;
+        while (value > 1)
+        {
+            value >>= 1;
+            ++ret;
+        }
+        return ret;
+    }
+
+    // Fibonacci hashing to the upper bits.
+    size_t home(uint64_t code) const { return static_cast<size_t>((code * 0x9E3779B97F4A7C15ULL) >> m_shift); }
+
     key_type get_id(const std::string & name)
     {
-        auto [it, inserted] = m_id_map.try_emplace(name, m_unique_id++);
+        auto [it, inserted] = m_id_map.try_emplace(name, m_unique_id);
+        if (inserted)
+        {
+            ++m_unique_id;
+        }
         return it->second;
     }
 
-    // FIXME: Use raw pointer for m_root.
-    std::unique_ptr<RadixTreeNode<T>> m_root;
-    RadixTreeNode<T> * m_current_node;
+    node_type * allocate(char const * name, key_type key)
+    {
+        if (m_nnode == m_chunks.size() * CHUNK_SIZE)
+        {
+            m_chunks.push_back(std::make_unique<node_type[]>(CHUNK_SIZE));
+        }
+        node_type * node = &m_chunks[m_nnode / CHUNK_SIZE][m_nnode % CHUNK_SIZE];
+        // A chunk kept by reset() holds the old node.
+        *node = node_type(name, key);
+        node->m_serial = static_cast<uint32_t>(m_nnode);
+        ++m_nnode;
+        return node;
+    }
+
+    node_type * add_child(node_type & parent, key_type key, char const * name)
+    {
+        node_type * child = allocate(name, key);
+        child->m_prev = &parent;
+        parent.m_children.push_back(child);
+        if (2 * (m_nslot_used + 1) > m_slots.size())
+        {
+            rehash(2 * m_slots.size());
+        }
+        insert_slot(make_code(parent, key), child);
+        return child;
+    }
+
+    void insert_slot(uint64_t code, node_type * node)
+    {
+        size_t const mask = m_slots.size() - 1;
+        size_t i = home(code);
+        while (nullptr != m_slots[i].node)
+        {
+            i = (i + 1) & mask;
+        }
+        m_slots[i].code = code;
+        m_slots[i].node = node;
+        ++m_nslot_used;
+    }
+
+    void rehash(size_t nslot)
+    {
+        std::vector<slot_type> old(nslot);
+        std::swap(old, m_slots);
+        m_shift = 64 - log2(nslot);
+        m_nslot_used = 0;
+        for (slot_type const & slot : old)
+        {
+            if (nullptr != slot.node)
+            {
+                insert_slot(slot.code, slot.node);
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<node_type[]>> m_chunks; /// the arena of the nodes
+    size_t m_nnode = 0;
+    std::vector<slot_type> m_slots; /// the power-of-two table of the children
+    size_t m_nslot_used = 0;
+    int m_shift = 0;
+    node_type * m_root = nullptr;
+    node_type * m_current_node = nullptr;
     std::unordered_map<std::string, key_type> m_id_map;
     key_type m_unique_id = 0;
 }; /* end class RadixTree */
@@ -219,7 +321,6 @@ struct CallerProfile
     }
 
     std::chrono::high_resolution_clock::time_point start_time;
-    std::function<void()> cancel_callback;
     std::string caller_name;
     std::chrono::nanoseconds total_time = std::chrono::nanoseconds(0); /// use nanoseconds to have higher precision
     int call_count = 0;
@@ -231,13 +332,24 @@ namespace detail
 class CallProfilerTest; // for gtest
 } /* end namespace detail */
 
-/// The profiler that profiles the hierarchical caller stack.
+/**
+ * The profiler that profiles the hierarchical caller stack.  Each thread
+ * profiles into its own call tree, so that the probes take no lock after
+ * the first one of the thread.  The trees are merged when reported.
+ *
+ * Report and reset when the other threads are not in a probe, e.g., after a
+ * parallel loop.
+ */
 class CallProfiler
 {
 private:
     CallProfiler() = default;
 
 public:
+    using tree_type = RadixTree<CallerProfile>;
+    using node_type = RadixTreeNode<CallerProfile>;
+    using key_type = node_type::key_type;
+
     /// A singleton.
     static CallProfiler & instance()
     {
@@ -251,55 +363,116 @@ public:
     CallProfiler & operator=(CallProfiler &&) = delete;
     ~CallProfiler() = default;
 
+    /// Intern the caller name to the key shared by the threads
+    key_type intern(std::string const & caller_name);
+
     // Called when a function starts
-    void start_caller(const std::string & caller_name, std::function<void()> cancel_callback)
+    void start_caller(key_type key, char const * caller_name)
     {
-        auto start_time = std::chrono::high_resolution_clock::now();
-        m_radix_tree.entry(caller_name);
-        CallerProfile & callProfile = m_radix_tree.get_current_node()->data();
-        callProfile.caller_name = caller_name;
-        callProfile.start_stopwatch();
+        CallerProfile & call_profile = radix_tree().entry(key, caller_name);
+        if (call_profile.caller_name.empty())
+        {
+            call_profile.caller_name = caller_name;
+        }
+        call_profile.start_stopwatch();
     }
 
-    // Called when a function ends
-    void end_caller(const std::string & caller_name)
+    void start_caller(const std::string & caller_name, std::function<void()> /* cancel_callback */)
     {
-        CallerProfile & call_profile = m_radix_tree.get_current_node()->data();
-        call_profile.stop_stopwatch(); // Update profiling information
-        m_radix_tree.move_current_to_parent(); // Pop the caller from the call stack
+        start_caller(intern(caller_name), caller_name.c_str());
     }
 
-    /// Print the profiling information
-    void print_profiling_result(std::ostream & outstream) const
+    // Called when a function ends
+    void end_caller()
     {
-        print_profiling_result(*(m_radix_tree.get_current_node()), 0, outstream);
+        tree_type & tree = radix_tree();
+        CallerProfile & call_profile = tree.get_current_node()->data();
+        call_profile.stop_stopwatch(); // Update profiling information
+        tree.move_current_to_parent(); // Pop the caller from the call stack
     }
 
+    void end_caller(const std::string & /* caller_name */) { end_caller(); }
+
+    /// Print the profiling information merged over the threads
+    void print_profiling_result(std::ostream & outstream) const;
+
+    /// Print the profiling information of each thread
+    void print_thread_profiling_result(std::ostream & outstream) const;
+
+    /// Number of the threads that have profiled, in the order of their first probes
+    size_t nthread() const;
+
+    /// The call tree of a thread
+    node_type const & thread_result(size_t ithread) const;
+
+    /// The call trees of the threads merged by the caller names along the stack
+    std::unique_ptr<tree_type> merged_result() const;
+
     /// Reset the profiler
     void reset();
 
 private:
-    void print_profiling_result(const RadixTreeNode<CallerProfile> & node, const int depth, std::ostream & outstream) const;
+    /// The call tree of the calling thread, registered at its first probe
+    tree_type & radix_tree();
+
+    static void print_profiling_result(const node_type & node, const int depth, std::ostream & outstream);
+    static void merge(tree_type & dst, node_type const & src);
 
 private:
-    RadixTree<CallerProfile> m_radix_tree; /// the data structure of the callers
+    mutable std::mutex m_mutex; /// guards the registration of the trees and the interned names
+    std::vector<std::unique_ptr<tree_type>> m_trees; /// the data structures of the callers of each thread
+    std::unordered_map<std::string, key_type> m_keys; /// the interned caller names
 
     friend detail::CallProfilerTest;
 }; /* end class CallProfiler */
 
+inline RadixTree<CallerProfile> & CallProfiler::radix_tree()
+{
+    // The tree outlives the thread, and reset() clears it in place, so that
+    // the pointer stays valid.
+    thread_local tree_type * tree = nullptr;
+    if (nullptr == tree)
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_trees.push_back(std::make_unique<tree_type>());
+        tree = m_trees.back().get();
+    }
+    return *tree;
+}
+
+/// A profiled call site, whose name is interned once
+class CallProfilerSite
+{
+public:
+    CallProfilerSite(CallProfiler & profiler, char const * caller_name)
+        : m_caller_name(caller_name)
+        , m_key(profiler.intern(caller_name))
+    {
+    }
+
+    char const * caller_name() const { return m_caller_name; }
+    CallProfiler::key_type key() const { return m_key; }
+
+private:
+    char const * m_caller_name;
+    CallProfiler::key_type m_key;
+}; /* end class CallProfilerSite */
+
 /// Utility to profile a call
 class CallProfilerProbe
 {
 public:
+    CallProfilerProbe(CallProfiler & profiler, CallProfilerSite const & site)
+        : m_profiler(profiler)
+    {
+        m_profiler.start_caller(site.key(), site.caller_name());
+    }
+
+    // Interns the name at every call; prefer the site.
     CallProfilerProbe(CallProfiler & profiler, const char * caller_name)
         : m_profiler(profiler)
-        , m_caller_name(caller_name)
     {
-        auto cancel_callback = [&]()
-        {
-            cancel();
-        };
-        m_profiler.start_caller(m_caller_name, cancel_callback);
+        m_profiler.start_caller(m_profiler.intern(caller_name), caller_name);
     }
 
     CallProfilerProbe(CallProfilerProbe const &) = delete;
@@ -311,7 +484,7 @@ public:
     {
         if (!m_cancel)
         {
-            m_profiler.end_caller(m_caller_name);
+            m_profiler.end_caller();
         }
     }
 
@@ -321,7 +494,6 @@ public:
     }
 
 private:
-    const char * m_caller_name;
     bool m_cancel = false;
     CallProfiler & m_profiler;
 }; /* end struct CallProfilerProbe */
@@ -335,8 +507,14 @@ private:
 // ref: https://gcc.gnu.org/onlinedocs/gcc/Function-Names.html
 #define __CROSS_PRETTY_FUNCTION__ __PRETTY_FUNCTION__
 #endif
-#define USE_CALLPROFILER_PROFILE_THIS_FUNCTION() modmesh::CallProfilerProbe __profilerProbe##__COUNTER__(modmesh::CallProfiler::instance(), __CROSS_PRETTY_FUNCTION__)
-#define USE_CALLPROFILER_PROFILE_THIS_SCOPE(scopeName) modmesh::CallProfilerProbe __profilerProbe##__COUNTER__(modmesh::CallProfiler::instance(), scopeName)
+// The site is static, so that the name is interned at the first call; the
+// scope name must be the same at every call.
+#define USE_CALLPROFILER_PROFILE_THIS_FUNCTION()                                                                                   \
+    static modmesh::CallProfilerSite const __profilerSite##__COUNTER__(modmesh::CallProfiler::instance(), __CROSS_PRETTY_FUNCTION__); \
+    modmesh::CallProfilerProbe __profilerProbe##__COUNTER__(modmesh::CallProfiler::instance(), __profilerSite##__COUNTER__)
+#define USE_CALLPROFILER_PROFILE_THIS_SCOPE(scopeName)                                                                \
+    static modmesh::CallProfilerSite const __profilerSite##__COUNTER__(modmesh::CallProfiler::instance(), scopeName); \
+    modmesh::CallProfilerProbe __profilerProbe##__COUNTER__(modmesh::CallProfiler::instance(), __profilerSite##__COUNTER__)
 #else
 #define USE_CALLPROFILER_PROFILE_THIS_FUNCTION() // do nothing
 #define USE_CALLPROFILER_PROFILE_THIS_SCOPE(scopeName) // do nothing
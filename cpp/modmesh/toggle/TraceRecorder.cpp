@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/toggle/TraceRecorder.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+void write_json_string(std::ostream & os, char const * value)
+{
+    os << '"';
+    for (char const * c = value; *c != '\0'; ++c)
+    {
+        if ('"' == *c || '\\' == *c)
+        {
+            os << '\\' << *c;
+        }
+        else if (static_cast<unsigned char>(*c) < 0x20)
+        {
+            os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(*c) << std::dec;
+        }
+        else
+        {
+            os << *c;
+        }
+    }
+    os << '"';
+}
+
+} /* end namespace detail */
+
+TraceRecorder & TraceRecorder::me()
+{
+    static TraceRecorder instance;
+    return instance;
+}
+
+TraceRecorder::TraceRecorder()
+    : m_epoch(std::chrono::steady_clock::now())
+{
+}
+
+char const * TraceRecorder::intern(std::string const & name)
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    // The nodes of the set do not move on rehash.
+    return m_names.insert(name).first->c_str();
+}
+
+size_t TraceRecorder::capacity() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_capacity;
+}
+
+void TraceRecorder::set_capacity(size_t capacity)
+{
+    size_t rounded = 1;
+    while (rounded < capacity)
+    {
+        rounded <<= 1;
+    }
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    m_capacity = rounded;
+    for (std::unique_ptr<Ring> const & r : m_rings)
+    {
+        r->events.assign(m_capacity, TraceEvent{});
+        r->head.store(0, std::memory_order_relaxed);
+    }
+}
+
+size_t TraceRecorder::nthread() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    return m_rings.size();
+}
+
+std::vector<TraceEvent> TraceRecorder::events(size_t ithread) const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    if (ithread >= m_rings.size())
+    {
+        throw std::out_of_range(Formatter() << "TraceRecorder: thread " << ithread << " is out of range of " << m_rings.size());
+    }
+    Ring const & r = *m_rings[ithread];
+    uint64_t const head = r.head.load(std::memory_order_acquire);
+    uint64_t const size = r.events.size();
+    uint64_t const first = head > size ? head - size : 0;
+    std::vector<TraceEvent> ret;
+    ret.reserve(static_cast<size_t>(head - first));
+    for (uint64_t i = first; i < head; ++i)
+    {
+        ret.push_back(r.events[i & (size - 1)]);
+    }
+    return ret;
+}
+
+size_t TraceRecorder::nrecorded() const
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    size_t ret = 0;
+    for (std::unique_ptr<Ring> const & r : m_rings)
+    {
+        ret += static_cast<size_t>(r->head.load(std::memory_order_acquire));
+    }
+    return ret;
+}
+
+void TraceRecorder::clear()
+{
+    std::lock_guard<std::mutex> const lock(m_mutex);
+    for (std::unique_ptr<Ring> const & r : m_rings)
+    {
+        r->head.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::string TraceRecorder::chrome_trace() const
+{
+    std::ostringstream ostm;
+    ostm << std::fixed << std::setprecision(3);
+    ostm << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    auto const separate = [&]()
+    {
+        ostm << (first ? "\n" : ",\n");
+        first = false;
+    };
+    size_t const nthd = nthread();
+    for (size_t ithread = 0; ithread < nthd; ++ithread)
+    {
+        separate();
+        ostm << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << ithread
+             << ",\"args\":{\"name\":\"thread " << ithread << "\"}}";
+        // The ends whose beginnings are overwritten in the ring are dropped.
+        size_t depth = 0;
+        for (TraceEvent const & event : events(ithread))
+        {
+            if (TraceEvent::END == event.phase)
+            {
+                if (0 == depth)
+                {
+                    continue;
+                }
+                --depth;
+            }
+            else
+            {
+                ++depth;
+            }
+            separate();
+            ostm << "{\"ph\":\"" << event.phase << "\",\"pid\":0,\"tid\":" << ithread
+                 << ",\"ts\":" << static_cast<double>(event.time) / 1e3;
+            if (nullptr != event.name)
+            {
+                ostm << ",\"name\":";
+                detail::write_json_string(ostm, event.name);
+            }
+            ostm << "}";
+        }
+    }
+    ostm << "\n]}\n";
+    return ostm.str();
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
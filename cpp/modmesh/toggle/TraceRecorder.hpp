@@ -0,0 +1,178 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Opt-in recording of the timed scopes as events, for the timeline views.
+ */
+
+#include <modmesh/base.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace modmesh
+{
+
+/// The beginning or the end of a timed scope.
+struct TraceEvent
+{
+    static constexpr char BEGIN = 'B';
+    static constexpr char END = 'E';
+
+    char const * name = nullptr; /// nullptr for the end
+    int64_t time = 0; /// nanoseconds since the recorder is constructed
+    char phase = BEGIN;
+}; /* end struct TraceEvent */
+
+/**
+ * Record the beginnings and ends of the timed scopes (MODMESH_TIME and the
+ * def_timed wrappers) in a ring buffer of each thread, and export them in
+ * the Chrome trace-event format, which Perfetto also reads.  The recorder is
+ * disabled by default and costs an atomic load per scope then.
+ *
+ * The writing thread owns its ring and takes no lock after the first event.
+ * A full ring overwrites the oldest events.  Export, clear, and resize when
+ * the other threads are not recording, e.g., after a parallel loop.
+ */
+class TraceRecorder
+{
+
+public:
+
+    static constexpr size_t DEFAULT_CAPACITY = size_t(1) << 16;
+
+    /// The singleton.
+    static TraceRecorder & me();
+
+    TraceRecorder(TraceRecorder const &) = delete;
+    TraceRecorder(TraceRecorder &&) = delete;
+    TraceRecorder & operator=(TraceRecorder const &) = delete;
+    TraceRecorder & operator=(TraceRecorder &&) = delete;
+    ~TraceRecorder() = default;
+
+    bool enabled() const noexcept { return m_enabled.load(std::memory_order_relaxed); }
+    void enable() noexcept { m_enabled.store(true, std::memory_order_relaxed); }
+    void disable() noexcept { m_enabled.store(false, std::memory_order_relaxed); }
+
+    /**
+     * Record the beginning of a scope in the calling thread and return true,
+     * or return false when disabled.  Call end() only when it returns true.
+     * The name must outlive the recorder; see intern().
+     */
+    bool begin(char const * name)
+    {
+        if (!enabled())
+        {
+            return false;
+        }
+        record(name, TraceEvent::BEGIN);
+        return true;
+    }
+
+    void end() { record(nullptr, TraceEvent::END); }
+
+    /// Keep a copy of the name for the lifetime of the recorder.
+    char const * intern(std::string const & name);
+
+    /// Number of the events each ring holds, a power of two.
+    size_t capacity() const;
+    /// Round the capacity up to a power of two and clear the rings.
+    void set_capacity(size_t capacity);
+
+    /// Number of the threads that have recorded, in the order of their first events.
+    size_t nthread() const;
+    /// The events held by the ring of a thread, oldest first.
+    std::vector<TraceEvent> events(size_t ithread) const;
+    /// Number of the events recorded by all threads, including the overwritten ones.
+    size_t nrecorded() const;
+    void clear();
+
+    /// The events in the JSON object format of the Chrome trace events.
+    std::string chrome_trace() const;
+
+private:
+
+    struct Ring
+    {
+        std::vector<TraceEvent> events;
+        std::atomic<uint64_t> head{0}; /// number of the events written
+    }; /* end struct Ring */
+
+    TraceRecorder();
+
+    void record(char const * name, char phase)
+    {
+        int64_t const time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::steady_clock::now() - m_epoch)
+                                 .count();
+        Ring & r = ring();
+        uint64_t const head = r.head.load(std::memory_order_relaxed);
+        TraceEvent & event = r.events[head & (r.events.size() - 1)];
+        event.name = name;
+        event.time = time;
+        event.phase = phase;
+        r.head.store(head + 1, std::memory_order_release);
+    }
+
+    /// The ring of the calling thread, registered at its first event
+    Ring & ring();
+
+    std::atomic<bool> m_enabled{false};
+    std::chrono::steady_clock::time_point const m_epoch;
+
+    mutable std::mutex m_mutex; /// guards the registration of the rings and the interned names
+    size_t m_capacity = DEFAULT_CAPACITY;
+    std::vector<std::unique_ptr<Ring>> m_rings;
+    std::unordered_set<std::string> m_names;
+
+}; /* end class TraceRecorder */
+
+inline TraceRecorder::Ring & TraceRecorder::ring()
+{
+    // The ring outlives the thread, so that the pointer stays valid.
+    thread_local Ring * ring = nullptr;
+    if (nullptr == ring)
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_rings.push_back(std::make_unique<Ring>());
+        m_rings.back()->events.resize(m_capacity);
+        ring = m_rings.back().get();
+    }
+    return *ring;
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -29,10 +29,21 @@
  */
 
 #include <modmesh/base.hpp>
-
+#include <modmesh/buffer/AllocationTracker.hpp>
+#include <modmesh/toggle/HardwareCounter.hpp>
+#include <modmesh/toggle/TraceRecorder.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <chrono>
+#include <optional>
+#include <ostream>
 
 namespace modmesh
 {
@@ -99,6 +110,110 @@ private:
 
 }; /* end struct StopWatch */
 
+/**
+ * Log-bucketed histogram of the durations in fixed memory, in the way of HDR
+ * histograms.  The durations are counted in nanoseconds; below 2^SUB_BITS ns
+ * each value has its own bucket, and above, each power of two is split into
+ * 2^SUB_BITS buckets, so that a percentile is within 1/2^SUB_BITS of the
+ * recorded value.
+ */
+class LatencyHistogram
+{
+
+public:
+
+    static constexpr size_t SUB_BITS = 3;
+    static constexpr size_t NSUB = size_t(1) << SUB_BITS;
+    static constexpr size_t NBUCKET = (64 - SUB_BITS + 1) * NSUB;
+
+    /// The bucket of a duration in nanoseconds.
+    static size_t bucket(uint64_t nanoseconds)
+    {
+        if (nanoseconds < NSUB)
+        {
+            return static_cast<size_t>(nanoseconds);
+        }
+        size_t exponent = 0;
+        for (uint64_t v = nanoseconds; v > 1; v >>= 1)
+        {
+            ++exponent;
+        }
+        size_t const sub = static_cast<size_t>(nanoseconds >> (exponent - SUB_BITS)) & (NSUB - 1);
+        return ((exponent - SUB_BITS + 1) << SUB_BITS) + sub;
+    }
+
+    /// The smallest duration in nanoseconds of a bucket.
+    static uint64_t bucket_lower(size_t index)
+    {
+        if (index < NSUB)
+        {
+            return index;
+        }
+        size_t const exponent = (index >> SUB_BITS) + SUB_BITS - 1;
+        return (uint64_t(1) << exponent) + (uint64_t(index & (NSUB - 1)) << (exponent - SUB_BITS));
+    }
+
+    void add(double seconds)
+    {
+        double const nanoseconds = std::max(seconds, 0.0) * 1e9;
+        // The last bucket takes everything beyond 2^63 ns.
+        uint64_t const value = nanoseconds >= 9.2e18 ? std::numeric_limits<uint64_t>::max() / 2 : static_cast<uint64_t>(nanoseconds);
+        ++m_counts[bucket(value)];
+        ++m_total;
+        m_max = std::max(m_max, seconds);
+    }
+
+    size_t count() const { return m_total; }
+    /// The longest duration in seconds, exact.
+    double max() const { return m_max; }
+
+    /// The duration in seconds below which p percent of the durations are, p in [0, 100].
+    double percentile(double p) const
+    {
+        if (p < 0.0 || p > 100.0)
+        {
+            throw std::invalid_argument(Formatter() << "LatencyHistogram: percentile " << p << " is not in [0, 100]");
+        }
+        if (0 == m_total)
+        {
+            return 0.0;
+        }
+        uint64_t const rank = std::max(uint64_t(1), static_cast<uint64_t>(std::ceil(p / 100.0 * static_cast<double>(m_total))));
+        if (rank >= m_total)
+        {
+            return m_max;
+        }
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < NBUCKET; ++i)
+        {
+            cumulative += m_counts[i];
+            if (cumulative >= rank)
+            {
+                // The middle of the bucket, not beyond the maximum.
+                uint64_t const lower = bucket_lower(i);
+                uint64_t const upper = i + 1 < NBUCKET ? bucket_lower(i + 1) : lower;
+                double const middle = 0.5 * static_cast<double>(lower + upper) * 1e-9;
+                return std::min(middle, m_max);
+            }
+        }
+        return m_max;
+    }
+
+    void clear()
+    {
+        m_counts.fill(0);
+        m_total = 0;
+        m_max = 0.0;
+    }
+
+private:
+
+    std::array<uint64_t, NBUCKET> m_counts{};
+    uint64_t m_total = 0;
+    double m_max = 0.0;
+
+}; /* end class LatencyHistogram */
+
 class TimedEntry
 {
 
@@ -106,12 +221,33 @@ public:
 
     size_t count() const { return m_count; }
     double time() const { return m_time; }
+    LatencyHistogram const & histogram() const { return m_histogram; }
+    double percentile(double p) const { return m_histogram.percentile(p); }
+    double max() const { return m_histogram.max(); }
+    /// The hardware counts summed over the scopes timed with HardwareCounter enabled.
+    HardwareCounterValues const & counters() const { return m_counters; }
+    /// The part of time() spent in the Python binding layer outside the wrapped C++ body.
+    double overhead() const { return m_overhead; }
+
+    double start()
+    {
+        m_counting = HardwareCounter::me().enabled();
+        if (m_counting)
+        {
+            m_counter_start = HardwareCounter::read();
+        }
+        return m_sw.lap();
+    }
 
-    double start() { return m_sw.lap(); }
     double stop()
     {
         double const time = m_sw.lap();
         add_time(time);
+        if (m_counting)
+        {
+            add_counters(HardwareCounter::read() - m_counter_start);
+            m_counting = false;
+        }
         return time;
     }
 
@@ -119,6 +255,29 @@ public:
     {
         ++m_count;
         m_time += time;
+        m_histogram.add(time);
+        return *this;
+    }
+
+    TimedEntry & add_overhead(double time)
+    {
+        m_overhead += time;
+        return *this;
+    }
+
+    /// Zero the count, the time, the histogram, the overhead, and the counters.
+    void clear()
+    {
+        m_count = 0;
+        m_time = 0.0;
+        m_histogram.clear();
+        m_overhead = 0.0;
+        m_counters = HardwareCounterValues{};
+    }
+
+    TimedEntry & add_counters(HardwareCounterValues const & counters)
+    {
+        m_counters += counters;
         return *this;
     }
 
@@ -126,10 +285,21 @@ private:
 
     size_t m_count = 0;
     double m_time = 0.0;
+    LatencyHistogram m_histogram;
+    double m_overhead = 0.0;
     StopWatch m_sw;
+    HardwareCounterValues m_counters;
+    HardwareCounterValues m_counter_start;
+    bool m_counting = false;
 
 }; /* end class TimedEntry */
 
+inline std::ostream & operator<<(std::ostream & os, TimedEntry const & entry)
+{
+    os << "Count: " << entry.count() << " - Time: " << entry.time();
+    return os;
+}
+
 class TimeRegistry
 {
 
@@ -144,21 +314,99 @@ public:
 
     std::string report() const
     {
+        std::lock_guard<std::mutex> const lock(m_mutex);
         std::ostringstream ostm;
         for (auto it = m_entry.begin(); it != m_entry.end(); ++it)
         {
+            if (0 == it->second.count())
+            {
+                continue;
+            }
             ostm
                 << it->first << " : "
                 << "count = " << it->second.count() << " , "
-                << "time = " << it->second.time() << " (second)"
-                << std::endl;
+                << "time = " << it->second.time() << " , "
+                << "p50 = " << it->second.percentile(50) << " , "
+                << "p90 = " << it->second.percentile(90) << " , "
+                << "p99 = " << it->second.percentile(99) << " , "
+                << "max = " << it->second.max() << " (second)";
+            if (0.0 != it->second.overhead())
+            {
+                ostm << " , overhead = " << it->second.overhead() << " (second)";
+            }
+            HardwareCounterValues const & counters = it->second.counters();
+            if (0 != counters.cycles)
+            {
+                ostm
+                    << " , cycles = " << counters.cycles << " , "
+                    << "instructions = " << counters.instructions << " , "
+                    << "IPC = " << counters.ipc() << " , "
+                    << "LLC misses = " << counters.llc_misses << " , "
+                    << "branch misses = " << counters.branch_misses << " , "
+                    << "LLC bandwidth = " << counters.llc_bandwidth(it->second.time()) / 1e9 << " (GB/s)";
+            }
+            ostm << std::endl;
+        }
+        return ostm.str();
+    }
+
+    /**
+     * The entries of the most binding overhead, the worst first, at most
+     * limit of them.  The ones of large per-call overhead or fraction are the
+     * Python APIs that want a batched variant.
+     */
+    std::string overhead_report(size_t limit = 10) const
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        std::vector<std::pair<std::string const *, TimedEntry const *>> items;
+        for (auto const & item : m_entry)
+        {
+            if (0.0 != item.second.overhead())
+            {
+                items.emplace_back(&item.first, &item.second); // NOLINT(performance-inefficient-vector-operation)
+            }
+        }
+        std::sort(
+            items.begin(),
+            items.end(),
+            [](auto const & a, auto const & b)
+            { return a.second->overhead() > b.second->overhead(); });
+        if (items.size() > limit)
+        {
+            items.resize(limit);
+        }
+
+        std::ostringstream ostm;
+        for (auto const & [name, entry] : items)
+        {
+            ostm
+                << *name << " : "
+                << "count = " << entry->count() << " , "
+                << "time = " << entry->time() << " , "
+                << "overhead = " << entry->overhead() << " , "
+                << "per call = " << entry->overhead() / static_cast<double>(entry->count()) << " (second) , "
+                << "fraction = " << entry->overhead() / entry->time() << std::endl;
         }
         return ostm.str();
     }
 
     void add(std::string const & name, double time)
     {
-        entry(name).add_time(time);
+        add(entry(name), time);
+    }
+
+    /**
+     * Add the time and the hardware counts to the entry.  The scopes timed in
+     * the threads running without the GIL accumulate through here.
+     */
+    void add(TimedEntry & entry, double time, HardwareCounterValues const * counters = nullptr)
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        entry.add_time(time);
+        if (nullptr != counters)
+        {
+            entry.add_counters(*counters);
+        }
     }
 
     void add(const char * name, double time)
@@ -168,16 +416,26 @@ public:
 
     std::vector<std::string> names() const
     {
+        std::lock_guard<std::mutex> const lock(m_mutex);
         std::vector<std::string> ret;
         for (auto const & item : m_entry)
         {
-            ret.push_back(item.first); // NOLINT(performance-inefficient-vector-operation)
+            if (0 != item.second.count())
+            {
+                ret.push_back(item.first); // NOLINT(performance-inefficient-vector-operation)
+            }
         }
         return ret;
     }
 
+    /**
+     * The entry of the name, added if missing.  The entry is never removed,
+     * so that a call site may keep the reference as a handle and skip the
+     * lookup (MODMESH_TIME does).
+     */
     TimedEntry & entry(std::string const & name)
     {
+        std::lock_guard<std::mutex> const lock(m_mutex);
         auto it = m_entry.find(name);
         if (it == m_entry.end())
         {
@@ -186,7 +444,15 @@ public:
         return it->second;
     }
 
-    void clear() { m_entry.clear(); }
+    /// Zero the entries in place; the names and reports skip the empty entries.
+    void clear()
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        for (auto & item : m_entry)
+        {
+            item.second.clear();
+        }
+    }
 
     TimeRegistry(TimeRegistry const &) = delete;
     TimeRegistry(TimeRegistry &&) = delete;
@@ -203,10 +469,91 @@ private:
 
     TimeRegistry() = default;
 
+    mutable std::mutex m_mutex; /// guards the map and the accumulation
     std::map<std::string, TimedEntry> m_entry;
 
 }; /* end struct TimeRegistry */
 
+/**
+ * The switch of the scope instrumentation (MODMESH_TIME).  The scopes are
+ * always compiled in, and a scope costs a relaxed atomic load and a branch
+ * when the switch is off.  When it is on, a thread times 1 in every
+ * sampling_period() scopes it enters, and the TimeRegistry counts only the
+ * sampled ones.
+ *
+ * The switch is off by default unless built with MODMESH_PROFILE.  The
+ * environment variables MODMESH_PROFILE (1/on or 0/off) and
+ * MODMESH_PROFILE_SAMPLE (the period) override the defaults at load time.
+ */
+class ScopeProfilerStatus
+{
+
+public:
+
+    /// The singleton.
+    static ScopeProfilerStatus & me()
+    {
+        static ScopeProfilerStatus instance;
+        return instance;
+    }
+
+    ScopeProfilerStatus(ScopeProfilerStatus const &) = delete;
+    ScopeProfilerStatus(ScopeProfilerStatus &&) = delete;
+    ScopeProfilerStatus & operator=(ScopeProfilerStatus const &) = delete;
+    ScopeProfilerStatus & operator=(ScopeProfilerStatus &&) = delete;
+    ~ScopeProfilerStatus() = default;
+
+    static bool enabled() noexcept { return s_enabled.load(std::memory_order_relaxed); }
+    static void enable() noexcept { s_enabled.store(true, std::memory_order_relaxed); }
+    static void disable() noexcept { s_enabled.store(false, std::memory_order_relaxed); }
+
+    static uint32_t sampling_period() noexcept { return s_sampling_period.load(std::memory_order_relaxed); }
+    static void set_sampling_period(uint32_t period)
+    {
+        if (0 == period)
+        {
+            throw std::invalid_argument("ScopeProfilerStatus: sampling period must be positive");
+        }
+        s_sampling_period.store(period, std::memory_order_relaxed);
+    }
+
+    /// Whether the calling thread times the scope it enters.
+    static bool sample() noexcept
+    {
+        if (!enabled())
+        {
+            return false;
+        }
+        uint32_t const period = sampling_period();
+        if (1 == period)
+        {
+            return true;
+        }
+        thread_local uint32_t count = 0;
+        if (++count < period)
+        {
+            return false;
+        }
+        count = 0;
+        return true;
+    }
+
+    /// Apply MODMESH_PROFILE and MODMESH_PROFILE_SAMPLE if set.
+    static void load_environment();
+
+private:
+
+    ScopeProfilerStatus() = default;
+
+#ifdef MODMESH_PROFILE
+    static inline std::atomic<bool> s_enabled{true};
+#else // MODMESH_PROFILE
+    static inline std::atomic<bool> s_enabled{false};
+#endif // MODMESH_PROFILE
+    static inline std::atomic<uint32_t> s_sampling_period{1};
+
+}; /* end class ScopeProfilerStatus */
+
 class ScopedTimer
 {
 
@@ -221,40 +568,85 @@ public:
     explicit ScopedTimer(const char * name)
         : m_name(name)
     {
+        if (ScopeProfilerStatus::sample())
+        {
+            start();
+        }
+    }
+
+    /// Take the entry of the name from TimeRegistry::entry() to skip the lookup.
+    ScopedTimer(const char * name, TimedEntry & entry)
+        : m_name(name)
+        , m_entry(&entry)
+    {
+        if (ScopeProfilerStatus::sample())
+        {
+            start();
+        }
     }
 
     ~ScopedTimer()
     {
-        TimeRegistry::me().add(m_name, m_sw.lap());
+        if (m_started)
+        {
+            stop();
+        }
     }
 
 private:
 
-    StopWatch m_sw;
-    char const * m_name;
-
-}; /* end class ScopedTimer */
+    using clock_type = std::chrono::high_resolution_clock;
 
-} /* end namespace modmesh */
+    void start()
+    {
+        m_started = true;
+        // Charge buffer allocations in the timed scope to the same name.
+        m_allocation_scope.emplace(m_name);
+        m_traced = TraceRecorder::me().begin(m_name);
+        m_counting = HardwareCounter::me().enabled();
+        if (m_counting)
+        {
+            m_counters = HardwareCounter::read();
+        }
+        m_start = clock_type::now();
+    }
 
-/*
- * MODMESH_PROFILE defined: Enable profiling API.
- */
-#ifdef MODMESH_PROFILE
+    void stop()
+    {
+        double const time = std::chrono::duration<double>(clock_type::now() - m_start).count();
+        if (m_counting)
+        {
+            m_counters = HardwareCounter::read() - m_counters;
+        }
+        if (m_traced)
+        {
+            TraceRecorder::me().end();
+        }
+        TimeRegistry & registry = TimeRegistry::me();
+        TimedEntry & entry = nullptr == m_entry ? registry.entry(m_name) : *m_entry;
+        registry.add(entry, time, m_counting ? &m_counters : nullptr);
+        m_allocation_scope.reset();
+    }
 
-#define MODMESH_TIME(NAME) \
-    ScopedTimer _local_scoped_timer_##__LINE__(NAME);
+    char const * m_name;
+    TimedEntry * m_entry = nullptr;
+    bool m_started = false;
+    bool m_traced = false;
+    bool m_counting = false;
+    clock_type::time_point m_start;
+    std::optional<AllocationScope> m_allocation_scope;
+    HardwareCounterValues m_counters; /// the start, then the difference
 
-/*
- * No MODMESH_PROFILE defined: Disable profiling API.
- */
-#else // MODMESH_PROFILE
+}; /* end class ScopedTimer */
 
-#define MODMESH_TIME(NAME)
+} /* end namespace modmesh */
 
-#endif // MODMESH_PROFILE
 /*
- * End MODMESH_PROFILE.
+ * The scope is always compiled in and switched by ScopeProfilerStatus.  The
+ * entry is registered at the first pass, so NAME must not change.
  */
+#define MODMESH_TIME(NAME)                                                               \
+    static TimedEntry & _local_timed_entry_##__LINE__ = TimeRegistry::me().entry(NAME); \
+    ScopedTimer _local_scoped_timer_##__LINE__(NAME, _local_timed_entry_##__LINE__);
 
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -65,6 +65,52 @@ protected:
 
 }; /* end class WrapWrapperTimerStatus */
 
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapScopeProfilerStatus
+    : public WrapBase<WrapScopeProfilerStatus, ScopeProfilerStatus>
+{
+
+public:
+
+    friend root_base_type;
+
+protected:
+
+    WrapScopeProfilerStatus(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def_property_readonly_static(
+                "me",
+                [](py::object const &) -> wrapped_type &
+                { return wrapped_type::me(); })
+            .def_property_readonly(
+                "enabled",
+                [](wrapped_type const &)
+                { return wrapped_type::enabled(); })
+            .def(
+                "enable",
+                [](wrapped_type &)
+                { wrapped_type::enable(); })
+            .def(
+                "disable",
+                [](wrapped_type &)
+                { wrapped_type::disable(); })
+            .def_property(
+                "sampling_period",
+                [](wrapped_type const &)
+                { return wrapped_type::sampling_period(); },
+                [](wrapped_type &, uint32_t period)
+                { wrapped_type::set_sampling_period(period); })
+            //
+            ;
+
+        mod.attr("scope_profiler_status") = mod.attr("ScopeProfilerStatus").attr("me");
+    }
+
+}; /* end class WrapScopeProfilerStatus */
+
 class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapStopWatch
     : public WrapBase<WrapStopWatch, StopWatch>
 {
@@ -99,6 +145,67 @@ protected:
 
 }; /* end class WrapStopWatch */
 
+namespace detail
+{
+
+/// The counts and the figures derived over the time in seconds.
+pybind11::dict hardware_counter_values_to_dict(HardwareCounterValues const & values, double time)
+{
+    pybind11::dict ret;
+    ret["cycles"] = values.cycles;
+    ret["instructions"] = values.instructions;
+    ret["llc_misses"] = values.llc_misses;
+    ret["branch_misses"] = values.branch_misses;
+    ret["ipc"] = values.ipc();
+    ret["llc_bandwidth"] = values.llc_bandwidth(time);
+    return ret;
+}
+
+} /* end namespace detail */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapHardwareCounter
+    : public WrapBase<WrapHardwareCounter, HardwareCounter>
+{
+
+public:
+
+    friend root_base_type;
+
+protected:
+
+    WrapHardwareCounter(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def_property_readonly_static(
+                "me",
+                [](py::object const &) -> wrapped_type &
+                { return wrapped_type::me(); })
+            .def_property_readonly_static(
+                "available",
+                [](py::object const &)
+                { return wrapped_type::available(); })
+            .def_property_readonly_static(
+                "unavailable_reason",
+                [](py::object const &)
+                { return wrapped_type::unavailable_reason(); })
+            .def_property_readonly("enabled", &wrapped_type::enabled)
+            .def("enable", &wrapped_type::enable)
+            .def("disable", &wrapped_type::disable)
+            .def(
+                "read",
+                [](wrapped_type const &)
+                { return detail::hardware_counter_values_to_dict(wrapped_type::read(), 0.0); })
+            //
+            ;
+
+        mod.attr("hardware_counter") = mod.attr("HardwareCounter").attr("me");
+    }
+
+}; /* end class WrapHardwareCounter */
+
 class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapTimedEntry
     : public WrapBase<WrapTimedEntry, TimedEntry>
 {
@@ -117,9 +224,16 @@ protected:
         (*this)
             .def_property_readonly("count", &wrapped_type::count)
             .def_property_readonly("time", &wrapped_type::time)
+            .def_property_readonly("max", &wrapped_type::max)
+            .def_property_readonly("overhead", &wrapped_type::overhead)
+            .def("percentile", &wrapped_type::percentile, py::arg("p"))
             .def("start", &wrapped_type::start)
             .def("stop", &wrapped_type::stop)
             .def("add_time", &wrapped_type::add_time, py::arg("time"))
+            .def_property_readonly(
+                "counters",
+                [](wrapped_type const & self)
+                { return detail::hardware_counter_values_to_dict(self.counters(), self.time()); })
             //
             ;
     }
@@ -155,6 +269,7 @@ protected:
                 py::arg("time"))
             .def_property_readonly("names", &wrapped_type::names)
             .def("report", &wrapped_type::report)
+            .def("overhead_report", &wrapped_type::overhead_report, py::arg("limit") = 10)
             //
             ;
 
@@ -163,12 +278,332 @@ protected:
 
 }; /* end class WrapTimeRegistry */
 
+namespace detail
+{
+
+pybind11::dict allocation_record_to_dict(AllocationRecord const & record)
+{
+    pybind11::dict ret;
+    ret["scope"] = record.scope;
+    ret["allocate_count"] = record.allocate_count;
+    ret["deallocate_count"] = record.deallocate_count;
+    ret["allocated_bytes"] = record.allocated_bytes;
+    ret["live_bytes"] = record.live_bytes;
+    ret["peak_bytes"] = record.peak_bytes;
+    return ret;
+}
+
+/**
+ * Python context manager charging the buffer allocations of the calling
+ * thread to a named scope between __enter__ and __exit__.
+ */
+class AllocationScopeContext
+{
+
+public:
+
+    explicit AllocationScopeContext(std::string name)
+        : m_name(std::move(name))
+    {
+    }
+
+    void enter() { m_scope = std::make_unique<AllocationScope>(m_name.c_str()); }
+    void exit() { m_scope.reset(); }
+
+    std::string const & name() const { return m_name; }
+
+private:
+
+    std::string m_name;
+    std::unique_ptr<AllocationScope> m_scope;
+
+}; /* end class AllocationScopeContext */
+
+// NOLINTNEXTLINE(misc-no-recursion)
+pybind11::dict call_profile_to_dict(RadixTreeNode<CallerProfile> const & node)
+{
+    pybind11::dict ret;
+    ret["name"] = node.data().caller_name;
+    ret["total_time"] = std::chrono::duration<double>(node.data().total_time).count();
+    ret["count"] = node.data().call_count;
+    pybind11::list children;
+    for (auto const & child : node.children())
+    {
+        children.append(call_profile_to_dict(*child));
+    }
+    ret["children"] = children;
+    return ret;
+}
+
+/**
+ * Python context manager profiling the code between __enter__ and __exit__
+ * as a caller in the call tree of the calling thread.
+ */
+class CallProfilerScopeContext
+{
+
+public:
+
+    explicit CallProfilerScopeContext(std::string name)
+        : m_name(std::move(name))
+        , m_key(CallProfiler::instance().intern(m_name))
+    {
+    }
+
+    void enter() { CallProfiler::instance().start_caller(m_key, m_name.c_str()); }
+    void exit() { CallProfiler::instance().end_caller(); }
+
+    std::string const & name() const { return m_name; }
+
+private:
+
+    std::string m_name;
+    CallProfiler::key_type m_key;
+
+}; /* end class CallProfilerScopeContext */
+
+} /* end namespace detail */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapCallProfiler
+    : public WrapBase<WrapCallProfiler, CallProfiler>
+{
+
+public:
+
+    friend root_base_type;
+
+protected:
+
+    WrapCallProfiler(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def_property_readonly_static(
+                "me",
+                [](py::object const &) -> wrapped_type &
+                { return wrapped_type::instance(); })
+            .def_property_readonly("nthread", &wrapped_type::nthread)
+            .def("reset", &wrapped_type::reset)
+            .def(
+                "result",
+                [](wrapped_type const & self)
+                { return detail::call_profile_to_dict(self.merged_result()->get_root()); })
+            .def(
+                "thread_result",
+                [](wrapped_type const & self, size_t ithread)
+                { return detail::call_profile_to_dict(self.thread_result(ithread)); },
+                py::arg("ithread"))
+            .def(
+                "report",
+                [](wrapped_type const & self)
+                {
+                    std::ostringstream ostm;
+                    self.print_profiling_result(ostm);
+                    return ostm.str();
+                })
+            .def(
+                "thread_report",
+                [](wrapped_type const & self)
+                {
+                    std::ostringstream ostm;
+                    self.print_thread_profiling_result(ostm);
+                    return ostm.str();
+                })
+            //
+            ;
+
+        mod.attr("call_profiler") = mod.attr("CallProfiler").attr("me");
+    }
+
+}; /* end class WrapCallProfiler */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapCallProfilerScopeContext
+    : public WrapBase<WrapCallProfilerScopeContext, detail::CallProfilerScopeContext>
+{
+
+public:
+
+    friend root_base_type;
+
+protected:
+
+    WrapCallProfilerScopeContext(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(py::init<std::string>(), py::arg("name"))
+            .def_property_readonly("name", &wrapped_type::name)
+            .def(
+                "__enter__",
+                [](wrapped_type & self) -> wrapped_type &
+                {
+                    self.enter();
+                    return self;
+                },
+                py::return_value_policy::reference_internal)
+            .def(
+                "__exit__",
+                [](wrapped_type & self, py::object const &, py::object const &, py::object const &)
+                { self.exit(); })
+            //
+            ;
+    }
+
+}; /* end class WrapCallProfilerScopeContext */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapAllocationTracker
+    : public WrapBase<WrapAllocationTracker, AllocationTracker>
+{
+
+public:
+
+    friend root_base_type;
+
+protected:
+
+    WrapAllocationTracker(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def_property_readonly_static(
+                "me",
+                [](py::object const &) -> wrapped_type &
+                { return wrapped_type::me(); })
+            .def_property_readonly("enabled", &wrapped_type::enabled)
+            .def("enable", &wrapped_type::enable)
+            .def("disable", &wrapped_type::disable)
+            .def("reset", &wrapped_type::reset)
+            .def_property_readonly(
+                "records",
+                [](wrapped_type const & self)
+                {
+                    py::list ret;
+                    for (AllocationRecord const & record : self.records())
+                    {
+                        ret.append(detail::allocation_record_to_dict(record));
+                    }
+                    return ret;
+                })
+            .def_property_readonly(
+                "total",
+                [](wrapped_type const & self)
+                { return detail::allocation_record_to_dict(self.total()); })
+            .def("report", &wrapped_type::report)
+            //
+            ;
+
+        mod.attr("allocation_tracker") = mod.attr("AllocationTracker").attr("me");
+    }
+
+}; /* end class WrapAllocationTracker */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapAllocationScopeContext
+    : public WrapBase<WrapAllocationScopeContext, detail::AllocationScopeContext>
+{
+
+public:
+
+    friend root_base_type;
+
+protected:
+
+    WrapAllocationScopeContext(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def(py::init<std::string>(), py::arg("name"))
+            .def_property_readonly("name", &wrapped_type::name)
+            .def(
+                "__enter__",
+                [](wrapped_type & self) -> wrapped_type &
+                {
+                    self.enter();
+                    return self;
+                },
+                py::return_value_policy::reference_internal)
+            .def(
+                "__exit__",
+                [](wrapped_type & self, py::object const &, py::object const &, py::object const &)
+                { self.exit(); })
+            //
+            ;
+    }
+
+}; /* end class WrapAllocationScopeContext */
+
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapTraceRecorder
+    : public WrapBase<WrapTraceRecorder, TraceRecorder>
+{
+
+public:
+
+    friend root_base_type;
+
+protected:
+
+    WrapTraceRecorder(pybind11::module & mod, char const * pyname, char const * pydoc)
+        : root_base_type(mod, pyname, pydoc)
+    {
+        namespace py = pybind11;
+
+        (*this)
+            .def_property_readonly_static(
+                "me",
+                [](py::object const &) -> wrapped_type &
+                { return wrapped_type::me(); })
+            .def_property_readonly("enabled", &wrapped_type::enabled)
+            .def("enable", &wrapped_type::enable)
+            .def("disable", &wrapped_type::disable)
+            .def("clear", &wrapped_type::clear)
+            .def_property("capacity", &wrapped_type::capacity, &wrapped_type::set_capacity)
+            .def_property_readonly("nthread", &wrapped_type::nthread)
+            .def_property_readonly("nrecorded", &wrapped_type::nrecorded)
+            .def(
+                "events",
+                [](wrapped_type const & self, size_t ithread)
+                {
+                    py::list ret;
+                    for (TraceEvent const & event : self.events(ithread))
+                    {
+                        // The time is in seconds, and the name of an end is None.
+                        ret.append(py::make_tuple(
+                            std::string(1, event.phase),
+                            nullptr == event.name ? py::object(py::none()) : py::object(py::str(event.name)),
+                            static_cast<double>(event.time) / 1e9));
+                    }
+                    return ret;
+                },
+                py::arg("ithread"))
+            .def("chrome_trace", &wrapped_type::chrome_trace)
+            //
+            ;
+
+        mod.attr("trace_recorder") = mod.attr("TraceRecorder").attr("me");
+    }
+
+}; /* end class WrapTraceRecorder */
+
 void wrap_profile(pybind11::module & mod)
 {
     WrapWrapperProfilerStatus::commit(mod, "WrapperProfilerStatus", "WrapperProfilerStatus");
+    WrapScopeProfilerStatus::commit(mod, "ScopeProfilerStatus", "ScopeProfilerStatus");
     WrapStopWatch::commit(mod, "StopWatch", "StopWatch");
+    WrapHardwareCounter::commit(mod, "HardwareCounter", "HardwareCounter");
     WrapTimedEntry::commit(mod, "TimedEntry", "TimeEntry");
     WrapTimeRegistry::commit(mod, "TimeRegistry", "TimeRegistry");
+    WrapAllocationTracker::commit(mod, "AllocationTracker", "AllocationTracker");
+    WrapAllocationScopeContext::commit(mod, "AllocationScope", "AllocationScope");
+    WrapCallProfiler::commit(mod, "CallProfiler", "CallProfiler");
+    WrapCallProfilerScopeContext::commit(mod, "CallProfilerScope", "CallProfilerScope");
+    WrapTraceRecorder::commit(mod, "TraceRecorder", "TraceRecorder");
 }
 
 } /* end namespace python */
@@ -57,6 +57,42 @@ int setenv(const char * name, const char * value, int overwrite)
 #endif // _WIN32
 }
 
+void ScopeProfilerStatus::load_environment()
+{
+    // NOLINTNEXTLINE(concurrency-mt-unsafe) read before the threads start
+    char const * const profile = std::getenv("MODMESH_PROFILE");
+    if (nullptr != profile)
+    {
+        std::string const value(profile);
+        if ("1" == value || "on" == value || "ON" == value || "true" == value)
+        {
+            enable();
+        }
+        else if ("0" == value || "off" == value || "OFF" == value || "false" == value)
+        {
+            disable();
+        }
+    }
+    // NOLINTNEXTLINE(concurrency-mt-unsafe) read before the threads start
+    char const * const sample = std::getenv("MODMESH_PROFILE_SAMPLE");
+    if (nullptr != sample)
+    {
+        long const period = std::strtol(sample, nullptr, 10);
+        if (period > 0)
+        {
+            set_sampling_period(static_cast<uint32_t>(period));
+        }
+    }
+}
+
+namespace
+{
+
+// Switch the scopes of a running job without rebuilding.
+bool const scope_profiler_environment_loaded = (ScopeProfilerStatus::load_environment(), true);
+
+} /* end namespace */
+
 Toggle & Toggle::instance()
 {
     static Toggle o;
@@ -111,6 +147,7 @@ MM_DECL_DYNGET(std::string const &, string, sentinel_string)
             if (it->second.is_##MTYPE())                                                                                       \
             {                                                                                                                  \
                 m_vector_##MTYPE.at(it->second.index) = value;                                                                 \
+                ++m_epoch;                                                                                                     \
             }                                                                                                                  \
             else                                                                                                               \
             {                                                                                                                  \
@@ -122,6 +159,7 @@ MM_DECL_DYNGET(std::string const &, string, sentinel_string)
             DynamicToggleIndex const index{static_cast<uint32_t>(m_vector_##MTYPE.size()), DynamicToggleIndex::TYPE_##MTYPEC}; \
             m_key2index.insert({key, index});                                                                                  \
             m_vector_##MTYPE.push_back(value);                                                                                 \
+            ++m_epoch;                                                                                                         \
         }                                                                                                                      \
     }                                                                                                                          \
     void HierarchicalToggleAccess::set_##MTYPE(std::string const & key, CTYPE value)                                           \
@@ -170,6 +208,8 @@ std::vector<std::string> DynamicToggleTable::keys() const
 
 void DynamicToggleTable::clear()
 {
+    ++m_epoch;
+    ++m_generation;
     m_key2index.clear();
     m_vector_bool.clear();
     m_vector_int8.clear();
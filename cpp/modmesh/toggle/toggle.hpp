@@ -31,8 +31,10 @@
 #include <modmesh/base.hpp>
 #include <modmesh/buffer/buffer.hpp>
 #include <modmesh/toggle/profile.hpp>
+#include <modmesh/toggle/RadixTree.hpp>
 
 #include <string>
+#include <type_traits>
 #include <vector>
 #include <unordered_map>
 
@@ -76,6 +78,28 @@ struct DynamicToggleIndex
 
 class DynamicToggleTable;
 
+template <typename T>
+class DynamicToggleHandle;
+
+/// The type tag of the C++ type of a dynamic toggle.
+template <typename T>
+struct DynamicToggleType;
+
+#define MM_DECL_DYNTYPE(CTYPE, MTYPEC)                                            \
+    template <>                                                                   \
+    struct DynamicToggleType<CTYPE>                                               \
+    {                                                                             \
+        static constexpr DynamicToggleIndex::Type type = DynamicToggleIndex::MTYPEC; \
+    };
+MM_DECL_DYNTYPE(bool, TYPE_BOOL)
+MM_DECL_DYNTYPE(int8_t, TYPE_INT8)
+MM_DECL_DYNTYPE(int16_t, TYPE_INT16)
+MM_DECL_DYNTYPE(int32_t, TYPE_INT32)
+MM_DECL_DYNTYPE(int64_t, TYPE_INT64)
+MM_DECL_DYNTYPE(double, TYPE_REAL)
+MM_DECL_DYNTYPE(std::string, TYPE_STRING)
+#undef MM_DECL_DYNTYPE
+
 class HierarchicalToggleAccess
 {
 
@@ -112,6 +136,9 @@ public:
 
     DynamicToggleIndex get_index(std::string const & key) const;
 
+    template <typename T>
+    DynamicToggleHandle<T> get_handle(std::string const & key) const;
+
     std::string rekey(std::string const & key) const
     {
         return m_base.empty() ? key : (Formatter() << m_base << "." << key);
@@ -162,8 +189,28 @@ public:
     std::vector<std::string> keys() const;
     void clear();
 
+    /**
+     * Resolve the key to a handle reading the value in O(1) without hashing.
+     * Throw std::invalid_argument if the key does not hold a value of T.
+     */
+    template <typename T>
+    DynamicToggleHandle<T> get_handle(std::string const & key);
+
+    /// Incremented when a value is set or the table is cleared.
+    uint64_t epoch() const { return m_epoch; }
+    /// Incremented when the table is cleared, which invalidates the handles.
+    uint64_t generation() const { return m_generation; }
+
 private:
 
+    template <typename T>
+    friend class DynamicToggleHandle;
+
+    template <typename T>
+    std::vector<T> & storage();
+
+    uint64_t m_epoch = 0;
+    uint64_t m_generation = 0;
     keymap_type m_key2index;
     std::vector<bool> m_vector_bool;
     std::vector<int8_t> m_vector_int8;
@@ -180,6 +227,84 @@ inline DynamicToggleIndex HierarchicalToggleAccess::get_index(std::string const
     return m_table->get_index(rekey(key));
 }
 
+#define MM_DECL_DYNSTORAGE(CTYPE, MTYPE)                                   \
+    template <>                                                            \
+    inline std::vector<CTYPE> & DynamicToggleTable::storage<CTYPE>()       \
+    {                                                                      \
+        return m_vector_##MTYPE;                                           \
+    }
+MM_DECL_DYNSTORAGE(bool, bool)
+MM_DECL_DYNSTORAGE(int8_t, int8)
+MM_DECL_DYNSTORAGE(int16_t, int16)
+MM_DECL_DYNSTORAGE(int32_t, int32)
+MM_DECL_DYNSTORAGE(int64_t, int64)
+MM_DECL_DYNSTORAGE(double, real)
+MM_DECL_DYNSTORAGE(std::string, string)
+#undef MM_DECL_DYNSTORAGE
+
+/**
+ * A dynamic toggle resolved to its storage, for reading the value in hot
+ * loops at the cost of a couple of loads.  The handle stays valid until the
+ * table is cleared; compare epoch() with a saved one to see whether any
+ * value of the table is set since.
+ */
+template <typename T>
+class DynamicToggleHandle
+{
+
+public:
+
+    using value_type = T;
+    using reference_type = std::conditional_t<std::is_same_v<T, std::string>, T const &, T>;
+
+    DynamicToggleHandle() = default;
+
+    DynamicToggleHandle(DynamicToggleTable & table, uint32_t index)
+        : m_table(&table)
+        , m_index(index)
+        , m_generation(table.generation())
+    {
+    }
+
+    /// False if default-constructed or the table is cleared since resolved.
+    bool valid() const { return nullptr != m_table && m_generation == m_table->generation(); }
+
+    reference_type get() const { return m_table->template storage<T>()[m_index]; }
+
+    void set(T const & value)
+    {
+        m_table->template storage<T>()[m_index] = value;
+        ++m_table->m_epoch;
+    }
+
+    uint64_t epoch() const { return m_table->epoch(); }
+    uint32_t index() const { return m_index; }
+
+private:
+
+    DynamicToggleTable * m_table = nullptr;
+    uint32_t m_index = 0;
+    uint64_t m_generation = 0;
+
+}; /* end class DynamicToggleHandle */
+
+template <typename T>
+DynamicToggleHandle<T> DynamicToggleTable::get_handle(std::string const & key)
+{
+    DynamicToggleIndex const index = get_index(key);
+    if (index.type != DynamicToggleType<T>::type)
+    {
+        throw std::invalid_argument(Formatter() << "DynamicToggleTable: key \"" << key << "\" does not hold the type of the handle");
+    }
+    return DynamicToggleHandle<T>(*this, index.index);
+}
+
+template <typename T>
+DynamicToggleHandle<T> HierarchicalToggleAccess::get_handle(std::string const & key) const
+{
+    return m_table->template get_handle<T>(rekey(key));
+}
+
 #define MM_TOGGLE_SOLID_BOOL(NAME)         \
 public:                                    \
     bool NAME() const { return m_##NAME; } \
@@ -298,6 +423,8 @@ public:
     void set_string(std::string const & key, std::string const & value) { m_dynamic_table.set_string(key, value); }
     HierarchicalToggleAccess get_subkey(std::string const & key) { return m_dynamic_table.get_subkey(key); }
     void add_subkey(std::string const & key) { m_dynamic_table.add_subkey(key); }
+    template <typename T>
+    DynamicToggleHandle<T> get_handle(std::string const & key) { return m_dynamic_table.get_handle<T>(key); }
 
 private:
 
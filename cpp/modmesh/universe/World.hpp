@@ -29,6 +29,7 @@
  */
 
 #include <modmesh/base.hpp>
+#include <modmesh/buffer/buffer.hpp>
 #include <modmesh/universe/bernstein.hpp>
 #include <modmesh/universe/bezier.hpp>
 
@@ -37,6 +38,30 @@
 namespace modmesh
 {
 
+/**
+ * Packed geometry of the curves in a World, in the compressed sparse row
+ * (CSR) fashion.  The control points of curve i are the columns
+ * control_offsets[i]:control_offsets[i+1] of controls in [3, ncontrol], and
+ * the loci are the same in loci.  The x, y, and z each take a contiguous row.
+ */
+template <typename T>
+struct WorldGeometry
+{
+    SimpleArray<uint64_t> control_offsets;
+    SimpleArray<T> controls;
+    SimpleArray<uint64_t> locus_offsets;
+    SimpleArray<T> loci;
+
+    size_t nbezier() const { return 0 == control_offsets.size() ? 0 : control_offsets.size() - 1; }
+    size_t ncontrol() const { return 0 == control_offsets.size() ? 0 : control_offsets[nbezier()]; }
+    size_t nlocus() const { return 0 == locus_offsets.size() ? 0 : locus_offsets[nbezier()]; }
+
+    /// Copy the control points into packed vectors.
+    Vector3dArray<T> control_vectors() const { return 0 == ncontrol() ? Vector3dArray<T>() : Vector3dArray<T>(controls); }
+    /// Copy the loci into packed vectors.
+    Vector3dArray<T> locus_vectors() const { return 0 == nlocus() ? Vector3dArray<T>() : Vector3dArray<T>(loci); }
+}; /* end struct WorldGeometry */
+
 /**
  * Manage all geometry entities.
  */
@@ -89,8 +114,46 @@ public:
         return m_beziers[i];
     }
 
+    /**
+     * Sample all Bezier curves at nlocus uniform parameters, in parallel
+     * across the curves.
+     *
+     * @param[in] nlocus number of loci on each curve.
+     * @return           loci in [nbezier, 3, nlocus].
+     */
+    SimpleArray<T> sample_beziers(size_t nlocus) const;
+
+    /**
+     * Pack the control points and the loci of all Bezier curves into
+     * geometry().  The packed geometry is a snapshot; pack again after the
+     * curves change.
+     */
+    void pack_geometry();
+
+    /**
+     * Sample the packed control points into the packed loci at nlocus
+     * uniform parameters for each curve.  The Bezier3d objects are not
+     * touched.
+     */
+    void sample_geometry(size_t nlocus);
+
+    WorldGeometry<T> const & geometry() const { return m_geometry; }
+
+    /// Sample all Bezier curves by Bezier3d::sample_adaptive(), in parallel
+    /// across the curves.
+    void sample_adaptive(T tolerance, size_t max_depth = 16);
+
+    /// Sample all Bezier curves by Bezier3d::sample_adaptive_view(), in
+    /// parallel across the curves.
+    void sample_adaptive_view(vector_type const & eye, T angle, size_t max_depth = 16);
+
 private:
 
+    /// Call body(ibezier) for all curves, in groups on the ThreadPool when
+    /// the nwork items are enough.
+    template <typename F>
+    static void for_each_bezier(size_t nbezier, size_t nwork, F && body);
+
     void check_size(size_t i, size_t s, char const * msg) const
     {
         if (i >= s)
@@ -100,6 +163,7 @@ private:
     }
 
     std::deque<Bezier3d<T>> m_beziers;
+    WorldGeometry<T> m_geometry;
 
 }; /* end class World */
 
@@ -109,6 +173,158 @@ void World<T>::add_bezier(std::vector<vector_type> const & controls)
     m_beziers.emplace_back(controls);
 }
 
+template <typename T>
+SimpleArray<T> World<T>::sample_beziers(size_t nlocus) const
+{
+    if (nlocus < 2)
+    {
+        throw std::invalid_argument(Formatter() << "World::sample_beziers: nlocus " << nlocus << " < 2");
+    }
+    size_t const nbezier = m_beziers.size();
+    SimpleArray<T> ret(small_vector<size_t>{nbezier, 3, nlocus}, SimpleArrayUninitialized{});
+    for_each_bezier(
+        nbezier,
+        nbezier * nlocus,
+        [&](size_t ib)
+        { m_beziers[ib].sample_to(nlocus, ret.data() + ib * 3 * nlocus); });
+    return ret;
+}
+
+template <typename T>
+void World<T>::pack_geometry()
+{
+    size_t const nbezier = m_beziers.size();
+    WorldGeometry<T> geom;
+    geom.control_offsets = SimpleArray<uint64_t>(nbezier + 1);
+    geom.locus_offsets = SimpleArray<uint64_t>(nbezier + 1);
+    geom.control_offsets[0] = geom.locus_offsets[0] = 0;
+    for (size_t ib = 0; ib < nbezier; ++ib)
+    {
+        geom.control_offsets[ib + 1] = geom.control_offsets[ib] + m_beziers[ib].ncontrol();
+        geom.locus_offsets[ib + 1] = geom.locus_offsets[ib] + m_beziers[ib].nlocus();
+    }
+    size_t const ncontrol = geom.ncontrol();
+    size_t const nlocus = geom.nlocus();
+    geom.controls = SimpleArray<T>(small_vector<size_t>{3, ncontrol}, SimpleArrayUninitialized{});
+    geom.loci = SimpleArray<T>(small_vector<size_t>{3, nlocus}, SimpleArrayUninitialized{});
+    for_each_bezier(
+        nbezier,
+        ncontrol + nlocus,
+        [&](size_t ib)
+        {
+            bezier_type const & b = m_beziers[ib];
+            for (size_t idim = 0; idim < 3; ++idim)
+            {
+                T * controls = geom.controls.data() + idim * ncontrol + geom.control_offsets[ib];
+                for (size_t i = 0; i < b.ncontrol(); ++i)
+                {
+                    controls[i] = b.control(i)[idim];
+                }
+                T * loci = geom.loci.data() + idim * nlocus + geom.locus_offsets[ib];
+                for (size_t i = 0; i < b.nlocus(); ++i)
+                {
+                    loci[i] = b.locus(i)[idim];
+                }
+            }
+        });
+    m_geometry = std::move(geom);
+}
+
+template <typename T>
+void World<T>::sample_geometry(size_t nlocus)
+{
+    if (nlocus < 2)
+    {
+        throw std::invalid_argument(Formatter() << "World::sample_geometry: nlocus " << nlocus << " < 2");
+    }
+    WorldGeometry<T> & geom = m_geometry;
+    size_t const nbezier = geom.nbezier();
+    size_t const ntotal = nbezier * nlocus;
+    geom.locus_offsets = SimpleArray<uint64_t>(nbezier + 1);
+    for (size_t ib = 0; ib <= nbezier; ++ib)
+    {
+        geom.locus_offsets[ib] = ib * nlocus;
+    }
+    geom.loci = SimpleArray<T>(small_vector<size_t>{3, ntotal}, SimpleArrayUninitialized{});
+    size_t const ncontrol = geom.ncontrol();
+    T const * controls = geom.controls.data();
+    T * loci = geom.loci.data();
+    for_each_bezier(
+        nbezier,
+        ntotal,
+        [&](size_t ib)
+        {
+            size_t const first = geom.control_offsets[ib];
+            size_t const offset = ib * nlocus;
+            detail::sample_bezier_impl<T>(
+                geom.control_offsets[ib + 1] - first,
+                [&](size_t i, size_t idim)
+                { return controls[idim * ncontrol + first + i]; },
+                nlocus,
+                {loci + offset, loci + ntotal + offset, loci + 2 * ntotal + offset});
+        });
+}
+
+template <typename T>
+void World<T>::sample_adaptive(T tolerance, size_t max_depth)
+{
+    // Validate up front rather than throwing from a task.
+    if (!(tolerance > 0))
+    {
+        throw std::invalid_argument(Formatter() << "World::sample_adaptive: tolerance " << tolerance << " <= 0");
+    }
+    // A curve takes tens of loci or so.
+    for_each_bezier(
+        m_beziers.size(),
+        m_beziers.size() * 64,
+        [&](size_t ib)
+        { m_beziers[ib].sample_adaptive(tolerance, max_depth); });
+}
+
+template <typename T>
+void World<T>::sample_adaptive_view(vector_type const & eye, T angle, size_t max_depth)
+{
+    if (!(angle > 0))
+    {
+        throw std::invalid_argument(Formatter() << "World::sample_adaptive_view: angle " << angle << " <= 0");
+    }
+    for_each_bezier(
+        m_beziers.size(),
+        m_beziers.size() * 64,
+        [&](size_t ib)
+        { m_beziers[ib].sample_adaptive_view(eye, angle, max_depth); });
+}
+
+template <typename T>
+template <typename F>
+void World<T>::for_each_bezier(size_t nbezier, size_t nwork, F && body)
+{
+    // A task takes a group of curves, as a curve alone is too little work.
+    constexpr size_t GROUP = 256;
+    size_t const ngroup = (nbezier + GROUP - 1) / GROUP;
+    auto const group = [&](size_t igroup)
+    {
+        size_t const end = std::min(nbezier, (igroup + 1) * GROUP);
+        for (size_t ib = igroup * GROUP; ib < end; ++ib)
+        {
+            body(ib);
+        }
+    };
+    if (ngroup > 1 && ThreadPool::instance().use_parallel(nwork))
+    {
+        ThreadPool::instance().run(ngroup, group);
+    }
+    else
+    {
+        for (size_t igroup = 0; igroup < ngroup; ++igroup)
+        {
+            group(igroup);
+        }
+    }
+}
+
+using WorldGeometryFp32 = WorldGeometry<float>;
+using WorldGeometryFp64 = WorldGeometry<double>;
 using WorldFp32 = World<float>;
 using WorldFp64 = World<double>;
 
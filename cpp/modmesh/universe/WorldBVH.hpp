@@ -0,0 +1,676 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/universe/World.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace modmesh
+{
+
+/**
+ * Bounding volume hierarchy of the segments of the curves in a World, for
+ * picking and proximity queries.  A curve contributes the segments between
+ * its loci, or between its control points when it is not sampled, as the
+ * control polygon hulls the curve.  Like StaticMeshBVH, the tree is binary,
+ * split at the median segment along the longest extent of the box centers,
+ * and laid out in depth-first order with the node boxes in structure of
+ * arrays.  The subtrees are built in parallel.
+ *
+ * refit() follows the points of the curves when they move and the numbers of
+ * the segments stay.  Other changes of the world need a new hierarchy.
+ */
+template <typename T>
+class WorldBVH
+{
+
+public:
+
+    using real_type = T;
+    using world_type = World<T>;
+
+    static constexpr size_t DEFAULT_LEAF_SIZE = 4;
+
+    explicit WorldBVH(std::shared_ptr<world_type const> world, size_t leaf_size = DEFAULT_LEAF_SIZE);
+
+    WorldBVH() = delete;
+    WorldBVH(WorldBVH const &) = delete;
+    WorldBVH(WorldBVH &&) = delete;
+    WorldBVH & operator=(WorldBVH const &) = delete;
+    WorldBVH & operator=(WorldBVH &&) = delete;
+    ~WorldBVH() = default;
+
+    std::shared_ptr<world_type const> const & world() const { return m_world; }
+    size_t leaf_size() const { return m_leaf_size; }
+    size_t node_count() const { return m_right.size(); }
+    size_t segment_count() const { return m_segments.size(); }
+
+    /// Lower corners of the node boxes in [3, node_count].
+    SimpleArray<real_type> const & lower() const { return m_lower; }
+    /// Upper corners of the node boxes in [3, node_count].
+    SimpleArray<real_type> const & upper() const { return m_upper; }
+
+    /// Update the boxes to the current points of the curves.
+    void refit();
+
+    /**
+     * Find the nearest curve to each point.  Ties go to the lowest curve
+     * index.
+     *
+     * @param[in] points coordinates in [npoint, 3].
+     * @return           the curve of each point, or -1 without a segment,
+     *                   and the distance to it.
+     */
+    std::pair<SimpleArray<int32_t>, SimpleArray<real_type>> nearest(SimpleArray<real_type> const & points) const;
+
+    /**
+     * Pick the first curve along each ray that passes within radius of it.
+     *
+     * @param[in] origins    origins of the rays in [nray, 3].
+     * @param[in] directions directions of the rays in [nray, 3], not
+     *                       necessarily normalized.
+     * @param[in] radius     distance from a ray within which a curve is hit.
+     * @return               the curve hit by each ray, or -1, and the
+     *                       distance along the ray to the hit.
+     */
+    std::pair<SimpleArray<int32_t>, SimpleArray<real_type>> pick(
+        SimpleArray<real_type> const & origins,
+        SimpleArray<real_type> const & directions,
+        real_type radius) const;
+
+private:
+
+    struct Task
+    {
+        size_t node;
+        size_t begin;
+        size_t end;
+    }; /* end struct Task */
+
+    /// Count the segments of each curve into m_offsets.
+    void count_segments();
+    /// Copy the end points of the segments into m_points.
+    void gather_points();
+    /// The box of a segment along an axis.
+    real_type seg_lower(size_t iseg, size_t axis) const { return std::min(m_points[iseg * 6 + axis], m_points[iseg * 6 + 3 + axis]); }
+    real_type seg_upper(size_t iseg, size_t axis) const { return std::max(m_points[iseg * 6 + axis], m_points[iseg * 6 + 3 + axis]); }
+
+    void build(size_t node, size_t begin, size_t end, size_t depth, size_t task_depth, std::vector<Task> * deferred);
+    void fit_node(size_t node);
+    void validate_rows(SimpleArray<real_type> const & array, char const * name) const;
+
+    /// Squared distance from the point to the node box.
+    real_type box_distance2(size_t node, real_type const * point) const;
+    /// Entry of the ray to the node box expanded by radius, or infinity.
+    real_type box_entry(size_t node, real_type const * origin, real_type const * inverse, real_type radius) const;
+
+    static size_t node_count_of(size_t n, size_t leaf);
+    static std::pair<size_t, size_t> node_count_pair(size_t n, size_t leaf);
+
+    std::shared_ptr<world_type const> m_world;
+    size_t m_leaf_size = DEFAULT_LEAF_SIZE;
+
+    // Segments: curve i has segments m_offsets[i]:m_offsets[i+1], and the
+    // end points of segment s are m_points[6s:6s+3] and m_points[6s+3:6s+6].
+    std::vector<size_t> m_offsets;
+    std::vector<int32_t> m_curves;
+    std::vector<real_type> m_points;
+
+    // Tree nodes.  The left child of an internal node follows it, and leaves
+    // have the right child -1 and the segments m_segments[m_first:m_first+m_count].
+    SimpleArray<real_type> m_lower;
+    SimpleArray<real_type> m_upper;
+    std::vector<int32_t> m_right;
+    std::vector<uint32_t> m_first;
+    std::vector<uint32_t> m_count;
+    std::vector<int32_t> m_segments;
+
+}; /* end class WorldBVH */
+
+namespace detail
+{
+
+/// Squared distance from the point p to the segment from a to b.
+template <typename T>
+T distance2_point_segment(T const * p, T const * a, T const * b)
+{
+    T ab2 = 0;
+    T abap = 0;
+    for (size_t idm = 0; idm < 3; ++idm)
+    {
+        ab2 += (b[idm] - a[idm]) * (b[idm] - a[idm]);
+        abap += (b[idm] - a[idm]) * (p[idm] - a[idm]);
+    }
+    T const u = ab2 > 0 ? std::clamp(abap / ab2, T(0), T(1)) : T(0);
+    T ret = 0;
+    for (size_t idm = 0; idm < 3; ++idm)
+    {
+        T const d = p[idm] - (a[idm] + u * (b[idm] - a[idm]));
+        ret += d * d;
+    }
+    return ret;
+}
+
+/**
+ * Closest approach between the ray o + s * d, s >= 0, and the segment from a
+ * to b.  Return the squared distance and set s.
+ */
+template <typename T>
+T distance2_ray_segment(T const * o, T const * d, T const * a, T const * b, T & s)
+{
+    T e[3];
+    T r[3];
+    T dd = 0;
+    T ee = 0;
+    T de = 0;
+    T dr = 0;
+    T er = 0;
+    for (size_t idm = 0; idm < 3; ++idm)
+    {
+        e[idm] = b[idm] - a[idm];
+        r[idm] = o[idm] - a[idm];
+        dd += d[idm] * d[idm];
+        ee += e[idm] * e[idm];
+        de += d[idm] * e[idm];
+        dr += d[idm] * r[idm];
+        er += e[idm] * r[idm];
+    }
+    T u = 0;
+    if (ee <= 0)
+    {
+        s = std::max(T(0), -dr / dd);
+    }
+    else
+    {
+        T const denom = dd * ee - de * de;
+        s = denom > 0 ? std::max(T(0), (de * er - dr * ee) / denom) : T(0);
+        u = (de * s + er) / ee;
+        if (u < 0)
+        {
+            u = 0;
+            s = std::max(T(0), -dr / dd);
+        }
+        else if (u > 1)
+        {
+            u = 1;
+            s = std::max(T(0), (de - dr) / dd);
+        }
+    }
+    T ret = 0;
+    for (size_t idm = 0; idm < 3; ++idm)
+    {
+        T const v = o[idm] + s * d[idm] - (a[idm] + u * e[idm]);
+        ret += v * v;
+    }
+    return ret;
+}
+
+} /* end namespace detail */
+
+template <typename T>
+WorldBVH<T>::WorldBVH(std::shared_ptr<world_type const> world, size_t leaf_size)
+    : m_world(std::move(world))
+    , m_leaf_size(leaf_size)
+{
+    if (!m_world)
+    {
+        throw std::invalid_argument("WorldBVH: world must not be None");
+    }
+    if (0 == m_leaf_size)
+    {
+        throw std::invalid_argument("WorldBVH: leaf_size must be positive");
+    }
+    count_segments();
+    size_t const nseg = m_curves.size();
+    gather_points();
+
+    size_t const nnode = node_count_of(nseg, m_leaf_size);
+    m_lower = SimpleArray<real_type>(small_vector<size_t>{3, nnode}, SimpleArrayUninitialized{});
+    m_upper = SimpleArray<real_type>(small_vector<size_t>{3, nnode}, SimpleArrayUninitialized{});
+    m_right.resize(nnode);
+    m_first.resize(nnode);
+    m_count.resize(nnode);
+    m_segments.resize(nseg);
+    std::iota(m_segments.begin(), m_segments.end(), 0);
+
+    // Build the top of the tree serially, and the subtrees below it in
+    // parallel.  The subtrees write to disjoint nodes and segments.
+    if (ThreadPool::instance().use_parallel(nseg))
+    {
+        size_t task_depth = 0;
+        while ((size_t(1) << task_depth) < 4 * ThreadPool::instance().nthread())
+        {
+            ++task_depth;
+        }
+        std::vector<Task> tasks;
+        build(0, 0, nseg, 0, task_depth, &tasks);
+        ThreadPool::instance().run(
+            tasks.size(),
+            [this, &tasks, task_depth](size_t it)
+            { build(tasks[it].node, tasks[it].begin, tasks[it].end, task_depth, task_depth, nullptr); });
+    }
+    else
+    {
+        build(0, 0, nseg, 0, 0, nullptr);
+    }
+}
+
+template <typename T>
+void WorldBVH<T>::count_segments()
+{
+    world_type const & world = *m_world;
+    m_offsets.assign(world.nbezier() + 1, 0);
+    for (size_t ib = 0; ib < world.nbezier(); ++ib)
+    {
+        Bezier3d<T> const & b = world.bezier(ib);
+        size_t const npt = b.nlocus() > 0 ? b.nlocus() : b.ncontrol();
+        m_offsets[ib + 1] = m_offsets[ib] + (npt > 1 ? npt - 1 : 0);
+    }
+    m_curves.resize(m_offsets.back());
+    for (size_t ib = 0; ib < world.nbezier(); ++ib)
+    {
+        std::fill(m_curves.begin() + m_offsets[ib], m_curves.begin() + m_offsets[ib + 1], static_cast<int32_t>(ib));
+    }
+}
+
+template <typename T>
+void WorldBVH<T>::gather_points()
+{
+    world_type const & world = *m_world;
+    size_t const nbezier = world.nbezier();
+    m_points.resize(m_curves.size() * 6);
+    parallel_for_chunks(
+        nbezier,
+        ThreadPool::instance().use_parallel(m_curves.size()),
+        [&](size_t begin, size_t end)
+        {
+            for (size_t ib = begin; ib < end; ++ib)
+            {
+                Bezier3d<T> const & b = world.bezier(ib);
+                bool const sampled = b.nlocus() > 0;
+                for (size_t iseg = m_offsets[ib]; iseg < m_offsets[ib + 1]; ++iseg)
+                {
+                    size_t const it = iseg - m_offsets[ib];
+                    Vector3d<T> const & p0 = sampled ? b.locus(it) : b.control(it);
+                    Vector3d<T> const & p1 = sampled ? b.locus(it + 1) : b.control(it + 1);
+                    for (size_t idm = 0; idm < 3; ++idm)
+                    {
+                        m_points[iseg * 6 + idm] = p0[idm];
+                        m_points[iseg * 6 + 3 + idm] = p1[idm];
+                    }
+                }
+            }
+        });
+}
+
+template <typename T>
+void WorldBVH<T>::refit()
+{
+    std::vector<size_t> const offsets = m_offsets;
+    count_segments();
+    if (offsets != m_offsets)
+    {
+        m_offsets = offsets;
+        throw std::invalid_argument("WorldBVH::refit: the segments of the curves changed; build a new hierarchy");
+    }
+    gather_points();
+    // The children follow the parent in the depth-first order.
+    for (size_t node = node_count(); node-- > 0;)
+    {
+        fit_node(node);
+    }
+}
+
+template <typename T>
+void WorldBVH<T>::fit_node(size_t node)
+{
+    size_t const nnode = node_count();
+    for (size_t idm = 0; idm < 3; ++idm)
+    {
+        real_type lower = std::numeric_limits<real_type>::infinity();
+        real_type upper = -std::numeric_limits<real_type>::infinity();
+        if (m_right[node] < 0)
+        {
+            for (uint32_t it = m_first[node]; it < m_first[node] + m_count[node]; ++it)
+            {
+                lower = std::min(lower, seg_lower(m_segments[it], idm));
+                upper = std::max(upper, seg_upper(m_segments[it], idm));
+            }
+        }
+        else
+        {
+            size_t const left = node + 1;
+            size_t const right = static_cast<size_t>(m_right[node]);
+            lower = std::min(m_lower.data()[idm * nnode + left], m_lower.data()[idm * nnode + right]);
+            upper = std::max(m_upper.data()[idm * nnode + left], m_upper.data()[idm * nnode + right]);
+        }
+        m_lower.data()[idm * nnode + node] = lower;
+        m_upper.data()[idm * nnode + node] = upper;
+    }
+}
+
+template <typename T>
+void WorldBVH<T>::build(size_t node, size_t begin, size_t end, size_t depth, size_t task_depth, std::vector<Task> * deferred)
+{
+    if (nullptr != deferred && depth == task_depth)
+    {
+        deferred->push_back(Task{node, begin, end});
+        return;
+    }
+
+    // Box of the segments and extent of their box centers.
+    size_t const nnode = node_count();
+    std::array<real_type, 3> center_lower{0, 0, 0};
+    std::array<real_type, 3> center_upper{0, 0, 0};
+    for (size_t idm = 0; idm < 3; ++idm)
+    {
+        real_type lower = std::numeric_limits<real_type>::infinity();
+        real_type upper = -std::numeric_limits<real_type>::infinity();
+        center_lower[idm] = std::numeric_limits<real_type>::infinity();
+        center_upper[idm] = -std::numeric_limits<real_type>::infinity();
+        for (size_t it = begin; it < end; ++it)
+        {
+            size_t const iseg = static_cast<size_t>(m_segments[it]);
+            lower = std::min(lower, seg_lower(iseg, idm));
+            upper = std::max(upper, seg_upper(iseg, idm));
+            real_type const center = seg_lower(iseg, idm) + seg_upper(iseg, idm);
+            center_lower[idm] = std::min(center_lower[idm], center);
+            center_upper[idm] = std::max(center_upper[idm], center);
+        }
+        m_lower.data()[idm * nnode + node] = lower;
+        m_upper.data()[idm * nnode + node] = upper;
+    }
+    size_t const nseg = end - begin;
+    m_first[node] = static_cast<uint32_t>(begin);
+    m_count[node] = static_cast<uint32_t>(nseg);
+    if (nseg <= m_leaf_size)
+    {
+        m_right[node] = -1;
+        return;
+    }
+
+    // Split at the median along the longest extent of the centers.
+    size_t axis = 0;
+    for (size_t idm = 1; idm < 3; ++idm)
+    {
+        if (center_upper[idm] - center_lower[idm] > center_upper[axis] - center_lower[axis])
+        {
+            axis = idm;
+        }
+    }
+    size_t const mid = begin + nseg / 2;
+    std::nth_element(
+        m_segments.begin() + begin,
+        m_segments.begin() + mid,
+        m_segments.begin() + end,
+        [this, axis](int32_t lhs, int32_t rhs)
+        {
+            real_type const lc = seg_lower(lhs, axis) + seg_upper(lhs, axis);
+            real_type const rc = seg_lower(rhs, axis) + seg_upper(rhs, axis);
+            return lc != rc ? lc < rc : lhs < rhs;
+        });
+    size_t const left_node = node + 1;
+    size_t const right_node = left_node + node_count_of(nseg / 2, m_leaf_size);
+    m_right[node] = static_cast<int32_t>(right_node);
+    build(left_node, begin, mid, depth + 1, task_depth, deferred);
+    build(right_node, mid, end, depth + 1, task_depth, deferred);
+}
+
+/**
+ * Numbers of the tree nodes over n and n + 1 segments, the same as those of
+ * StaticMeshBVH.
+ */
+template <typename T>
+std::pair<size_t, size_t> WorldBVH<T>::node_count_pair(size_t n, size_t leaf)
+{
+    if (n + 1 <= leaf)
+    {
+        return {1, 1};
+    }
+    std::pair<size_t, size_t> const half = node_count_pair(n / 2, leaf);
+    if (0 == n % 2)
+    {
+        return {n <= leaf ? 1 : 1 + 2 * half.first, 1 + half.first + half.second};
+    }
+    return {n <= leaf ? 1 : 1 + half.first + half.second, 1 + 2 * half.second};
+}
+
+template <typename T>
+size_t WorldBVH<T>::node_count_of(size_t n, size_t leaf) { return node_count_pair(n, leaf).first; }
+
+template <typename T>
+void WorldBVH<T>::validate_rows(SimpleArray<real_type> const & array, char const * name) const
+{
+    if (2 != array.ndim() || 3 != array.shape(1))
+    {
+        throw std::invalid_argument(Formatter() << "WorldBVH: " << name << " must be in the shape of (n, 3)");
+    }
+}
+
+template <typename T>
+typename WorldBVH<T>::real_type WorldBVH<T>::box_distance2(size_t node, real_type const * point) const
+{
+    size_t const nnode = node_count();
+    real_type ret = 0;
+    for (size_t idm = 0; idm < 3; ++idm)
+    {
+        real_type const below = m_lower.data()[idm * nnode + node] - point[idm];
+        real_type const above = point[idm] - m_upper.data()[idm * nnode + node];
+        real_type const gap = std::max({below, above, real_type(0)});
+        ret += gap * gap;
+    }
+    return ret;
+}
+
+template <typename T>
+typename WorldBVH<T>::real_type WorldBVH<T>::box_entry(size_t node, real_type const * origin, real_type const * inverse, real_type radius) const
+{
+    size_t const nnode = node_count();
+    real_type enter = 0;
+    real_type leave = std::numeric_limits<real_type>::infinity();
+    for (size_t idm = 0; idm < 3; ++idm)
+    {
+        real_type const lower = m_lower.data()[idm * nnode + node] - radius;
+        real_type const upper = m_upper.data()[idm * nnode + node] + radius;
+        if (std::isinf(inverse[idm]))
+        {
+            // Parallel to the slab.
+            if (origin[idm] < lower || origin[idm] > upper)
+            {
+                return std::numeric_limits<real_type>::infinity();
+            }
+            continue;
+        }
+        real_type t0 = (lower - origin[idm]) * inverse[idm];
+        real_type t1 = (upper - origin[idm]) * inverse[idm];
+        if (t0 > t1)
+        {
+            std::swap(t0, t1);
+        }
+        enter = std::max(enter, t0);
+        leave = std::min(leave, t1);
+    }
+    return enter <= leave ? enter : std::numeric_limits<real_type>::infinity();
+}
+
+template <typename T>
+std::pair<SimpleArray<int32_t>, SimpleArray<T>> WorldBVH<T>::nearest(SimpleArray<real_type> const & points) const
+{
+    validate_rows(points, "points");
+    size_t const npoint = points.shape(0);
+    SimpleArray<int32_t> curves(npoint);
+    SimpleArray<real_type> distances(npoint);
+    parallel_for_chunks(
+        npoint,
+        ThreadPool::instance().use_parallel(npoint),
+        [&](size_t begin, size_t end)
+        {
+            // The depth of the tree is bounded by the bits of the segment count.
+            std::array<int32_t, 64> stack; // NOLINT(cppcoreguidelines-pro-type-member-init)
+            for (size_t ipt = begin; ipt < end; ++ipt)
+            {
+                real_type const point[3] = {points(ipt, 0), points(ipt, 1), points(ipt, 2)};
+                int32_t found = -1;
+                real_type best = std::numeric_limits<real_type>::infinity();
+                size_t top = 0;
+                if (0 != m_segments.size())
+                {
+                    stack[top++] = 0;
+                }
+                while (top > 0)
+                {
+                    size_t const node = static_cast<size_t>(stack[--top]);
+                    if (box_distance2(node, point) > best)
+                    {
+                        continue;
+                    }
+                    if (m_right[node] < 0)
+                    {
+                        for (uint32_t it = m_first[node]; it < m_first[node] + m_count[node]; ++it)
+                        {
+                            size_t const iseg = static_cast<size_t>(m_segments[it]);
+                            real_type const d2 = detail::distance2_point_segment(point, &m_points[iseg * 6], &m_points[iseg * 6 + 3]);
+                            int32_t const icv = m_curves[iseg];
+                            if (d2 < best || (d2 == best && icv < found))
+                            {
+                                best = d2;
+                                found = icv;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        // Visit the nearer child first.
+                        size_t const left = node + 1;
+                        size_t const right = static_cast<size_t>(m_right[node]);
+                        bool const left_first = box_distance2(left, point) <= box_distance2(right, point);
+                        stack[top++] = static_cast<int32_t>(left_first ? right : left);
+                        stack[top++] = static_cast<int32_t>(left_first ? left : right);
+                    }
+                }
+                curves(ipt) = found;
+                distances(ipt) = found < 0 ? std::numeric_limits<real_type>::infinity() : std::sqrt(best);
+            }
+        });
+    return {std::move(curves), std::move(distances)};
+}
+
+template <typename T>
+std::pair<SimpleArray<int32_t>, SimpleArray<T>> WorldBVH<T>::pick(
+    SimpleArray<real_type> const & origins,
+    SimpleArray<real_type> const & directions,
+    real_type radius) const
+{
+    validate_rows(origins, "origins");
+    validate_rows(directions, "directions");
+    if (origins.shape(0) != directions.shape(0))
+    {
+        throw std::invalid_argument(Formatter() << "WorldBVH: " << origins.shape(0) << " origins differ from "
+                                                << directions.shape(0) << " directions");
+    }
+    if (!(radius >= 0))
+    {
+        throw std::invalid_argument(Formatter() << "WorldBVH: radius " << radius << " must not be negative");
+    }
+    size_t const nray = origins.shape(0);
+    real_type const radius2 = radius * radius;
+    SimpleArray<int32_t> curves(nray);
+    SimpleArray<real_type> distances(nray);
+    parallel_for_chunks(
+        nray,
+        ThreadPool::instance().use_parallel(nray),
+        [&](size_t begin, size_t end)
+        {
+            std::array<int32_t, 64> stack; // NOLINT(cppcoreguidelines-pro-type-member-init)
+            for (size_t iray = begin; iray < end; ++iray)
+            {
+                real_type const origin[3] = {origins(iray, 0), origins(iray, 1), origins(iray, 2)};
+                real_type const direction[3] = {directions(iray, 0), directions(iray, 1), directions(iray, 2)};
+                real_type const length = std::sqrt(direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]);
+                int32_t found = -1;
+                // The best hit in the parameter of the ray.  It starts finite
+                // to prune the boxes that the ray misses at infinity.
+                real_type best = std::numeric_limits<real_type>::max();
+                size_t top = 0;
+                if (0 != m_segments.size() && length > 0)
+                {
+                    stack[top++] = 0;
+                }
+                real_type const inverse[3] = {1 / direction[0], 1 / direction[1], 1 / direction[2]};
+                while (top > 0)
+                {
+                    size_t const node = static_cast<size_t>(stack[--top]);
+                    if (box_entry(node, origin, inverse, radius) > best)
+                    {
+                        continue;
+                    }
+                    if (m_right[node] < 0)
+                    {
+                        for (uint32_t it = m_first[node]; it < m_first[node] + m_count[node]; ++it)
+                        {
+                            size_t const iseg = static_cast<size_t>(m_segments[it]);
+                            real_type s = 0;
+                            real_type const d2 = detail::distance2_ray_segment(origin, direction, &m_points[iseg * 6], &m_points[iseg * 6 + 3], s);
+                            int32_t const icv = m_curves[iseg];
+                            if (d2 <= radius2 && (s < best || (s == best && icv < found)))
+                            {
+                                best = s;
+                                found = icv;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        size_t const left = node + 1;
+                        size_t const right = static_cast<size_t>(m_right[node]);
+                        bool const left_first = box_entry(left, origin, inverse, radius) <= box_entry(right, origin, inverse, radius);
+                        stack[top++] = static_cast<int32_t>(left_first ? right : left);
+                        stack[top++] = static_cast<int32_t>(left_first ? left : right);
+                    }
+                }
+                curves(iray) = found;
+                distances(iray) = found < 0 ? std::numeric_limits<real_type>::infinity() : best * length;
+            }
+        });
+    return {std::move(curves), std::move(distances)};
+}
+
+using WorldBVHFp32 = WorldBVH<float>;
+using WorldBVHFp64 = WorldBVH<double>;
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -29,6 +29,9 @@
  */
 
 #include <modmesh/math.hpp>
+
+#include <algorithm>
+#include <array>
 #include <vector>
 
 namespace modmesh
@@ -37,46 +40,151 @@ namespace modmesh
 namespace detail
 {
 
+/// Degree up to which the binomial coefficients are tabulated at compile time.
+constexpr size_t BINOMIAL_TABLE_DEGREE = 24;
+
+struct BinomialTable
+{
+    double values[BINOMIAL_TABLE_DEGREE + 1][BINOMIAL_TABLE_DEGREE + 1];
+}; /* end struct BinomialTable */
+
+constexpr BinomialTable make_binomial_table()
+{
+    BinomialTable table{};
+    for (size_t n = 0; n <= BINOMIAL_TABLE_DEGREE; ++n)
+    {
+        table.values[n][0] = table.values[n][n] = 1.0;
+        for (size_t k = 1; k < n; ++k)
+        {
+            table.values[n][k] = table.values[n - 1][k - 1] + table.values[n - 1][k];
+        }
+    }
+    return table;
+}
+
+inline constexpr BinomialTable binomial_table = make_binomial_table();
+
+/// The binomial coefficient C(n, k), looked up from the table or computed by
+/// the multiplicative formula beyond it.
 template <typename T>
-T calc_bernstein_polynomial_impl(T t, size_t i, size_t n)
+T calc_binomial_impl(size_t n, size_t k)
 {
-    T ret = 1.0;
+    if (n <= BINOMIAL_TABLE_DEGREE)
     {
-        T const v = (i > 0) ? std::pow(t, i) : 1.0;
-        ret *= v;
+        return static_cast<T>(binomial_table.values[n][k]);
     }
+    k = std::min(k, n - k);
+    double ret = 1.0;
+    for (size_t it = 0; it < k; ++it)
     {
-        T const v = (n > i) ? std::pow(1.0 - t, n - i) : 1.0;
-        ret *= v;
+        ret = ret * static_cast<double>(n - it) / static_cast<double>(it + 1);
     }
-    for (size_t it = n; it > 1; --it)
+    return static_cast<T>(ret);
+}
+
+template <typename T>
+T calc_bernstein_polynomial_impl(T t, size_t i, size_t n)
+{
+    T ret = calc_binomial_impl<T>(n, i);
+    T const s = 1.0 - t;
+    for (size_t it = 0; it < i; ++it)
     {
-        ret *= it;
+        ret *= t;
     }
-    for (size_t it = i; it > 1; --it)
+    for (size_t it = i; it < n; ++it)
     {
-        ret /= it;
+        ret *= s;
     }
-    for (size_t it = (n - i); it > 1; --it)
+    return ret;
+}
+
+/**
+ * Evaluate sum_k weights[k] * t^k * (1-t)^(n-k) for k in [0, n] by the
+ * recurrence R_k = R_{k-1} * (1-t) + weights[k] * t^k, in O(n) without
+ * std::pow or division.  With weights[k] = C(n, k) * P_k it is the Bezier
+ * curve of the control values P_k, exact at both ends.
+ */
+template <typename T>
+T evaluate_bernstein_impl(T t, T const * weights, size_t n)
+{
+    T const s = 1.0 - t;
+    T tk = 1.0;
+    T ret = weights[0];
+    for (size_t it = 1; it <= n; ++it)
     {
-        ret /= it;
+        tk *= t;
+        ret = ret * s + weights[it] * tk;
     }
     return ret;
 }
 
+/**
+ * Evaluate the sums of evaluate_bernstein_impl() for D sets of weights at the
+ * nlocus uniform parameters t_i = i / (nlocus - 1), into out[d][0:nlocus].
+ * The parameters are processed in tiles with the loop over them innermost,
+ * so that the recurrence is vectorized across t and the powers of t are
+ * shared by the D sets.
+ */
+template <typename T, size_t D>
+void evaluate_bernstein_uniform_impl(std::array<T const *, D> const & weights, size_t n, size_t nlocus, std::array<T *, D> const & out)
+{
+    constexpr size_t TILE = 64;
+    std::array<T, TILE> ts; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    std::array<T, TILE> ss; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    std::array<T, TILE> tks; // NOLINT(cppcoreguidelines-pro-type-member-init)
+    for (size_t i0 = 0; i0 < nlocus; i0 += TILE)
+    {
+        size_t const m = std::min(TILE, nlocus - i0);
+        for (size_t i = 0; i < m; ++i)
+        {
+            ts[i] = ((T)(i0 + i)) / (nlocus - 1);
+            ss[i] = 1.0 - ts[i];
+            tks[i] = 1.0;
+        }
+        for (size_t d = 0; d < D; ++d)
+        {
+            std::fill(out[d] + i0, out[d] + i0 + m, weights[d][0]);
+        }
+        for (size_t k = 1; k <= n; ++k)
+        {
+            for (size_t i = 0; i < m; ++i)
+            {
+                tks[i] *= ts[i];
+            }
+            for (size_t d = 0; d < D; ++d)
+            {
+                T const w = weights[d][k];
+                T * r = out[d] + i0;
+                for (size_t i = 0; i < m; ++i)
+                {
+                    r[i] = r[i] * ss[i] + w * tks[i];
+                }
+            }
+        }
+    }
+}
+
+/// The weights of evaluate_bernstein_impl(): C(n, k) * values[k], where a
+/// missing value is taken as 1.
 template <typename T>
-T interpolate_bernstein_impl(T t, std::vector<T> const & values, size_t n)
+std::vector<T> make_bernstein_weights_impl(std::vector<T> const & values, size_t n)
 {
-    T ret = 0.0;
+    std::vector<T> ret(n + 1);
     for (size_t it = 0; it <= n; ++it)
     {
-        T v = (it >= values.size()) ? 1.0 : values[it];
-        v *= calc_bernstein_polynomial_impl(t, it, n);
-        ret += v;
+        T const v = (it >= values.size()) ? 1.0 : values[it];
+        ret[it] = calc_binomial_impl<T>(n, it) * v;
     }
     return ret;
 }
 
+template <typename T>
+T interpolate_bernstein_impl(T t, std::vector<T> const & values, size_t n)
+{
+    std::vector<T> const weights = make_bernstein_weights_impl(values, n);
+    return evaluate_bernstein_impl(t, weights.data(), n);
+}
+
 } /* end namespace detail */
 
 double calc_bernstein_polynomial(double t, size_t i, size_t n);
@@ -29,85 +29,95 @@
  */
 
 #include <modmesh/base.hpp>
+#include <modmesh/buffer/buffer.hpp>
 #include <modmesh/universe/bernstein.hpp>
+#include <modmesh/universe/vector3d.hpp>
 
+#include <cmath>
 #include <deque>
 
 namespace modmesh
 {
 
+namespace detail
+{
+
 /**
- * Vector or point in three-dimensional space.
- *
- * @tparam T floating-point type
+ * Sample the Bezier curve of ncontrol control points, the coordinate idim of
+ * point i given by control(i, idim), at nlocus uniform parameters into
+ * out[idim][0:nlocus].
  */
-template <typename T>
-class Vector3d
-    : public NumberBase<int32_t, T>
+template <typename T, typename F>
+void sample_bezier_impl(size_t ncontrol, F && control, size_t nlocus, std::array<T *, 3> const & out)
 {
-
-public:
-
-    using value_type = T;
-
-    Vector3d(T x, T y, T z)
-        : m_coord{x, y, z}
+    if (0 == ncontrol)
     {
+        // No control point leaves the loci at the origin.
+        for (T * o : out)
+        {
+            std::fill(o, o + nlocus, T(0));
+        }
+        return;
     }
-
-    Vector3d() = default;
-    Vector3d(Vector3d const &) = default;
-    Vector3d(Vector3d &&) = default;
-    Vector3d & operator=(Vector3d const &) = default;
-    Vector3d & operator=(Vector3d &&) = default;
-    ~Vector3d() = default;
-
-    value_type x() const { return m_coord[0]; }
-    value_type & x() { return m_coord[0]; }
-    void set_x(value_type v) { x() = v; }
-
-    value_type y() const { return m_coord[1]; }
-    value_type & y() { return m_coord[1]; }
-    void set_y(value_type v) { y() = v; }
-
-    value_type z() const { return m_coord[2]; }
-    value_type & z() { return m_coord[2]; }
-    void set_z(value_type v) { z() = v; }
-
-    T operator[](size_t i) const { return m_coord[i]; }
-    T & operator[](size_t i) { return m_coord[i]; }
-
-    T at(size_t i) const
-    {
-        check_size(i, 3);
-        return m_coord[i];
-    }
-    T & at(size_t i)
+    size_t const n = ncontrol - 1;
+    // The binomial coefficients are folded into the weights once, so that
+    // each locus takes O(n).
+    small_vector<T, 32> weights(3 * (n + 1));
+    for (size_t i = 0; i <= n; ++i)
     {
-        check_size(i, 3);
-        return m_coord[i];
+        T const binomial = calc_binomial_impl<T>(n, i);
+        for (size_t idim = 0; idim < 3; ++idim)
+        {
+            weights[idim * (n + 1) + i] = binomial * control(i, idim);
+        }
     }
+    evaluate_bernstein_uniform_impl<T, 3>(
+        {weights.data(), weights.data() + (n + 1), weights.data() + 2 * (n + 1)},
+        n,
+        nlocus,
+        out);
+}
 
-    size_t size() const { return 3; }
+} /* end namespace detail */
 
-    void fill(T v) { m_coord[0] = m_coord[1] = m_coord[2] = v; }
+namespace detail
+{
 
-private:
+template <typename T>
+T distance3d(Vector3d<T> const & a, Vector3d<T> const & b)
+{
+    T const dx = a[0] - b[0];
+    T const dy = a[1] - b[1];
+    T const dz = a[2] - b[2];
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
 
-    void check_size(size_t i, size_t s) const
+/// Distance from the point p to the segment from a to b.
+template <typename T>
+T distance_to_segment3d(Vector3d<T> const & p, Vector3d<T> const & a, Vector3d<T> const & b)
+{
+    T ab[3];
+    T ap[3];
+    T ab2 = 0;
+    T abap = 0;
+    for (size_t idim = 0; idim < 3; ++idim)
     {
-        if (i >= s)
-        {
-            throw std::out_of_range(Formatter() << "Vector3d: i " << i << " >= size " << s);
-        }
+        ab[idim] = b[idim] - a[idim];
+        ap[idim] = p[idim] - a[idim];
+        ab2 += ab[idim] * ab[idim];
+        abap += ab[idim] * ap[idim];
     }
+    T const s = ab2 > 0 ? std::min(std::max(abap / ab2, T(0)), T(1)) : T(0);
+    T ret = 0;
+    for (size_t idim = 0; idim < 3; ++idim)
+    {
+        T const d = ap[idim] - s * ab[idim];
+        ret += d * d;
+    }
+    return std::sqrt(ret);
+}
 
-    T m_coord[3];
-
-}; /* end class Vector3d */
-
-using Vector3dFp32 = Vector3d<float>;
-using Vector3dFp64 = Vector3d<double>;
+} /* end namespace detail */
 
 /**
  * Bezier curve in three-dimensional space.
@@ -128,6 +138,11 @@ public:
     {
     }
 
+    explicit Bezier3d(Vector3dArray<T> const & controls)
+        : m_controls(controls.to_vector())
+    {
+    }
+
     Bezier3d() = default;
     Bezier3d(Bezier3d const &) = default;
     Bezier3d(Bezier3d &&) = default;
@@ -169,8 +184,42 @@ public:
 
     void sample(size_t nlocus);
 
+    /// Sample the curve at nlocus uniform parameters into packed vectors,
+    /// without storing them.
+    Vector3dArray<T> sample_array(size_t nlocus) const;
+
+    /**
+     * Sample the curve at nlocus uniform parameters into out of [3, nlocus],
+     * the x, y, and z of the loci one after another, without storing them.
+     */
+    void sample_to(size_t nlocus, T * out) const;
+
+    /**
+     * Sample the curve adaptively.  The curve is halved by de Casteljau's
+     * algorithm until a bound of the distance between each piece and its
+     * chord is within tolerance.  The polyline of the loci is then within
+     * tolerance of the curve, and the straight parts take few loci.
+     *
+     * @param[in] tolerance largest distance between the curve and the chords.
+     * @param[in] max_depth the most times a piece is halved.
+     */
+    void sample_adaptive(T tolerance, size_t max_depth = 16);
+
+    /**
+     * Sample the curve adaptively for a perspective view from eye.  The
+     * tolerance of a piece is angle times the distance from eye to the
+     * nearer end of the piece, where angle is subtended by the tolerated
+     * error on the screen, e.g., a pixel.
+     */
+    void sample_adaptive_view(vector_type const & eye, T angle, size_t max_depth = 16);
+
 private:
 
+    /// Halve the curve until the piece from the controls p0 to pn is as flat
+    /// as tolerance(p0, pn).
+    template <typename F>
+    void sample_adaptive_impl(F && tolerance, size_t max_depth);
+
     void check_size(size_t i, size_t s, char const * msg) const
     {
         if (i >= s)
@@ -191,20 +240,126 @@ void Bezier3d<T>::sample(size_t nlocus)
     {
         throw std::invalid_argument(Formatter() << "Bezier3d::sample: nlocus " << nlocus << " < 2");
     }
-    m_loci.resize(nlocus);
-    for (size_t idim = 0; idim < 3; ++idim)
+    m_loci = sample_array(nlocus).to_vector();
+}
+
+template <typename T>
+Vector3dArray<T> Bezier3d<T>::sample_array(size_t nlocus) const
+{
+    if (nlocus < 2)
     {
-        std::vector<T> cvalues(ncontrol());
-        for (size_t i = 0; i < ncontrol(); ++i)
+        throw std::invalid_argument(Formatter() << "Bezier3d::sample_array: nlocus " << nlocus << " < 2");
+    }
+    Vector3dArray<T> ret(SimpleArray<T>(small_vector<size_t>{3, nlocus}, SimpleArrayUninitialized{}));
+    sample_to(nlocus, ret.x());
+    return ret;
+}
+
+template <typename T>
+void Bezier3d<T>::sample_to(size_t nlocus, T * out) const
+{
+    detail::sample_bezier_impl<T>(
+        ncontrol(),
+        [this](size_t i, size_t idim)
+        { return control(i)[idim]; },
+        nlocus,
+        {out, out + nlocus, out + 2 * nlocus});
+}
+
+template <typename T>
+void Bezier3d<T>::sample_adaptive(T tolerance, size_t max_depth)
+{
+    if (!(tolerance > 0))
+    {
+        throw std::invalid_argument(Formatter() << "Bezier3d::sample_adaptive: tolerance " << tolerance << " <= 0");
+    }
+    sample_adaptive_impl(
+        [tolerance](vector_type const &, vector_type const &)
+        { return tolerance; },
+        max_depth);
+}
+
+template <typename T>
+void Bezier3d<T>::sample_adaptive_view(vector_type const & eye, T angle, size_t max_depth)
+{
+    if (!(angle > 0))
+    {
+        throw std::invalid_argument(Formatter() << "Bezier3d::sample_adaptive_view: angle " << angle << " <= 0");
+    }
+    sample_adaptive_impl(
+        [&eye, angle](vector_type const & p0, vector_type const & pn)
+        { return angle * std::min(detail::distance3d(p0, eye), detail::distance3d(pn, eye)); },
+        max_depth);
+}
+
+template <typename T>
+template <typename F>
+void Bezier3d<T>::sample_adaptive_impl(F && tolerance, size_t max_depth)
+{
+    m_loci.clear();
+    if (0 == ncontrol())
+    {
+        return;
+    }
+    size_t const npt = ncontrol();
+    // The interior Bernstein basis sums to at most 1 - 2^(1-n).
+    size_t const n = npt - 1;
+    T const bound = n < 2 ? T(0) : 1 - std::ldexp(T(1), 1 - static_cast<int>(std::min(n, size_t(64))));
+    // The pieces to be tested, the left one on the top so that the loci come
+    // out in order.
+    std::vector<std::pair<std::vector<vector_type>, size_t>> stack;
+    stack.emplace_back(m_controls, 0);
+    m_loci.push_back(m_controls.front());
+    while (!stack.empty())
+    {
+        std::vector<vector_type> piece = std::move(stack.back().first);
+        size_t const depth = stack.back().second;
+        stack.pop_back();
+
+        vector_type const & p0 = piece.front();
+        vector_type const & pn = piece.back();
+        // The curve is in the convex hull of the control points, and the
+        // curve minus the chord is the curve of the control points minus
+        // the chord at i/n, whose basis sums to at most the bound.
+        T hull = 0;
+        T chord = 0;
+        for (size_t i = 1; i + 1 < npt; ++i)
+        {
+            hull = std::max(hull, detail::distance_to_segment3d(piece[i], p0, pn));
+            T const s = static_cast<T>(i) / static_cast<T>(n);
+            T d2 = 0;
+            for (size_t idim = 0; idim < 3; ++idim)
+            {
+                T const d = piece[i][idim] - (p0[idim] * (1 - s) + pn[idim] * s);
+                d2 += d * d;
+            }
+            chord = std::max(chord, std::sqrt(d2));
+        }
+        T const flatness = std::min(hull, bound * chord);
+        if (depth >= max_depth || flatness <= tolerance(p0, pn))
         {
-            cvalues[i] = control(i)[idim];
+            m_loci.push_back(pn);
+            continue;
         }
-        for (size_t i = 0; i < nlocus; ++i)
+
+        // Halve the piece by de Casteljau's algorithm.
+        std::vector<vector_type> left(npt);
+        std::vector<vector_type> right(npt);
+        for (size_t level = 0; level < npt; ++level)
         {
-            T const t = ((T)i) / (nlocus - 1);
-            T const v = detail::interpolate_bernstein_impl(t, cvalues, cvalues.size() - 1);
-            m_loci[i][idim] = v;
+            size_t const last = npt - 1 - level;
+            left[level] = piece[0];
+            right[last] = piece[last];
+            for (size_t i = 0; i < last; ++i)
+            {
+                for (size_t idim = 0; idim < 3; ++idim)
+                {
+                    piece[i][idim] = (piece[i][idim] + piece[i + 1][idim]) / 2;
+                }
+            }
         }
+        stack.emplace_back(std::move(right), depth + 1);
+        stack.emplace_back(std::move(left), depth + 1);
     }
 }
 
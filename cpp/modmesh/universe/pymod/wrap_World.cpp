@@ -96,6 +96,63 @@ WrapVector3d<T>::WrapVector3d(pybind11::module & mod, const char * pyname, const
     // clang-format on
 }
 
+template <typename T>
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapVector3dArray
+    : public WrapBase<WrapVector3dArray<T>, Vector3dArray<T>>
+{
+
+public:
+
+    using base_type = WrapBase<WrapVector3dArray<T>, Vector3dArray<T>>;
+    using wrapped_type = typename base_type::wrapped_type;
+
+    friend typename base_type::root_base_type;
+
+protected:
+
+    WrapVector3dArray(pybind11::module & mod, char const * pyname, char const * pydoc);
+};
+/* end class WrapVector3dArray */
+
+template <typename T>
+WrapVector3dArray<T>::WrapVector3dArray(pybind11::module & mod, const char * pyname, const char * pydoc)
+    : base_type(mod, pyname, pydoc)
+{
+    namespace py = pybind11;
+
+    using vector_type = typename wrapped_type::vector_type;
+
+    (*this)
+        .def(py::init<size_t>(), py::arg("size") = 0)
+        .def(py::init<std::vector<vector_type> const &>(), py::arg("vectors"))
+        .def(py::init<SimpleArray<T> const &>(), py::arg("data"))
+        .def(
+            "__len__",
+            [](wrapped_type const & self)
+            { return self.size(); })
+        .def(
+            "__getitem__",
+            [](wrapped_type const & self, size_t it)
+            { return self.at(it); })
+        .def(
+            "__setitem__",
+            [](wrapped_type & self, size_t it, vector_type const & val)
+            { self.set_at(it, val); })
+        .def_property_readonly(
+            "data",
+            [](wrapped_type & self) -> auto &
+            { return self.data(); },
+            py::return_value_policy::reference_internal)
+        .def("to_list", &wrapped_type::to_vector)
+        .def("dot", &wrapped_type::dot, py::arg("other"))
+        .def("cross", &wrapped_type::cross, py::arg("other"))
+        .def("norm", &wrapped_type::norm)
+        .def("normalize", &wrapped_type::normalize, py::return_value_policy::reference_internal)
+        .def("axpy", &wrapped_type::axpy, py::arg("alpha"), py::arg("x"), py::return_value_policy::reference_internal)
+        //
+        ;
+}
+
 template <typename T>
 class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapBezier3d
     : public WrapBase<WrapBezier3d<T>, Bezier3d<T>>
@@ -122,6 +179,7 @@ WrapBezier3d<T>::WrapBezier3d(pybind11::module & mod, const char * pyname, const
 
     (*this)
         .def(py::init<std::vector<typename wrapped_type::vector_type> const &>(), py::arg("controls"))
+        .def(py::init<Vector3dArray<T> const &>(), py::arg("controls"))
         .def(
             "__len__",
             [](wrapped_type const & self)
@@ -168,6 +226,14 @@ WrapBezier3d<T>::WrapBezier3d(pybind11::module & mod, const char * pyname, const
     // Locus points
     (*this)
         .def("sample", &wrapped_type::sample, py::arg("nlocus"))
+        .def("sample_array", &wrapped_type::sample_array, py::arg("nlocus"))
+        .def("sample_adaptive", &wrapped_type::sample_adaptive, py::arg("tolerance"), py::arg("max_depth") = 16)
+        .def(
+            "sample_adaptive_view",
+            &wrapped_type::sample_adaptive_view,
+            py::arg("eye"),
+            py::arg("angle"),
+            py::arg("max_depth") = 16)
         .def_property_readonly("nlocus", &wrapped_type::nlocus)
         .def_property_readonly(
             "locus_points",
@@ -235,6 +301,141 @@ WrapWorld<T>::WrapWorld(pybind11::module & mod, const char * pyname, const char
                 return self.bezier_at(i);
             },
             py::return_value_policy::reference_internal)
+        .def(
+            "sample_beziers",
+            [](wrapped_type const & self, size_t nlocus)
+            {
+                py::gil_scoped_release const release;
+                return self.sample_beziers(nlocus);
+            },
+            py::arg("nlocus"))
+        .def("pack_geometry", &wrapped_type::pack_geometry)
+        .def(
+            "sample_adaptive",
+            [](wrapped_type & self, typename wrapped_type::value_type tolerance, size_t max_depth)
+            {
+                py::gil_scoped_release const release;
+                self.sample_adaptive(tolerance, max_depth);
+            },
+            py::arg("tolerance"),
+            py::arg("max_depth") = 16)
+        .def(
+            "sample_adaptive_view",
+            [](wrapped_type & self, typename wrapped_type::vector_type const & eye, typename wrapped_type::value_type angle, size_t max_depth)
+            {
+                py::gil_scoped_release const release;
+                self.sample_adaptive_view(eye, angle, max_depth);
+            },
+            py::arg("eye"),
+            py::arg("angle"),
+            py::arg("max_depth") = 16)
+        .def(
+            "sample_geometry",
+            [](wrapped_type & self, size_t nlocus)
+            {
+                py::gil_scoped_release const release;
+                self.sample_geometry(nlocus);
+            },
+            py::arg("nlocus"))
+        .def(
+            "control_vectors",
+            [](wrapped_type const & self)
+            { return self.geometry().control_vectors(); })
+        .def(
+            "locus_vectors",
+            [](wrapped_type const & self)
+            { return self.geometry().locus_vectors(); })
+        .def_property_readonly(
+            "geometry",
+            [](wrapped_type const & self)
+            {
+                WorldGeometry<T> const & geom = self.geometry();
+                return py::make_tuple(
+                    SimpleArray<uint64_t>(geom.control_offsets),
+                    SimpleArray<T>(geom.controls),
+                    SimpleArray<uint64_t>(geom.locus_offsets),
+                    SimpleArray<T>(geom.loci));
+            })
+        //
+        ;
+}
+
+template <typename T>
+class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapWorldBVH
+    : public WrapBase<WrapWorldBVH<T>, WorldBVH<T>, std::shared_ptr<WorldBVH<T>>>
+{
+
+public:
+
+    using base_type = WrapBase<WrapWorldBVH<T>, WorldBVH<T>, std::shared_ptr<WorldBVH<T>>>;
+    using wrapped_type = typename base_type::wrapped_type;
+
+    friend typename base_type::root_base_type;
+
+protected:
+
+    WrapWorldBVH(pybind11::module & mod, char const * pyname, char const * pydoc);
+};
+/* end class WrapWorldBVH */
+
+template <typename T>
+WrapWorldBVH<T>::WrapWorldBVH(pybind11::module & mod, const char * pyname, const char * pydoc)
+    : base_type(mod, pyname, pydoc)
+{
+    namespace py = pybind11;
+
+    using real_type = typename wrapped_type::real_type;
+
+    (*this)
+        .def(
+            py::init(
+                [](std::shared_ptr<World<T>> const & world, size_t leaf_size)
+                {
+                    py::gil_scoped_release const release;
+                    return std::make_shared<wrapped_type>(world, leaf_size);
+                }),
+            py::arg("world"),
+            py::arg("leaf_size") = wrapped_type::DEFAULT_LEAF_SIZE)
+        .def_property_readonly(
+            "world",
+            [](wrapped_type const & self)
+            { return std::const_pointer_cast<World<T>>(self.world()); })
+        .def_property_readonly("leaf_size", &wrapped_type::leaf_size)
+        .def_property_readonly("node_count", &wrapped_type::node_count)
+        .def_property_readonly("segment_count", &wrapped_type::segment_count)
+        .def(
+            "refit",
+            [](wrapped_type & self)
+            {
+                py::gil_scoped_release const release;
+                self.refit();
+            })
+        .def(
+            "nearest",
+            [](wrapped_type const & self, SimpleArray<real_type> const & points)
+            {
+                std::pair<SimpleArray<int32_t>, SimpleArray<real_type>> ret;
+                {
+                    py::gil_scoped_release const release;
+                    ret = self.nearest(points);
+                }
+                return py::make_tuple(std::move(ret.first), std::move(ret.second));
+            },
+            py::arg("points"))
+        .def(
+            "pick",
+            [](wrapped_type const & self, SimpleArray<real_type> const & origins, SimpleArray<real_type> const & directions, real_type radius)
+            {
+                std::pair<SimpleArray<int32_t>, SimpleArray<real_type>> ret;
+                {
+                    py::gil_scoped_release const release;
+                    ret = self.pick(origins, directions, radius);
+                }
+                return py::make_tuple(std::move(ret.first), std::move(ret.second));
+            },
+            py::arg("origins"),
+            py::arg("directions"),
+            py::arg("radius"))
         //
         ;
 }
@@ -243,10 +444,14 @@ void wrap_World(pybind11::module & mod)
 {
     WrapVector3d<float>::commit(mod, "Vector3dFp32", "Vector3dFp32");
     WrapVector3d<double>::commit(mod, "Vector3dFp64", "Vector3dFp64");
+    WrapVector3dArray<float>::commit(mod, "Vector3dArrayFp32", "Vector3dArrayFp32");
+    WrapVector3dArray<double>::commit(mod, "Vector3dArrayFp64", "Vector3dArrayFp64");
     WrapBezier3d<float>::commit(mod, "Bezier3dFp32", "Bezier3dFp32");
     WrapBezier3d<double>::commit(mod, "Bezier3dFp64", "Bezier3dFp64");
     WrapWorld<float>::commit(mod, "WorldFp32", "WorldFp32");
     WrapWorld<double>::commit(mod, "WorldFp64", "WorldFp64");
+    WrapWorldBVH<float>::commit(mod, "WorldBVHFp32", "WorldBVHFp32");
+    WrapWorldBVH<double>::commit(mod, "WorldBVHFp64", "WorldBVHFp64");
 }
 
 } /* end namespace python */
@@ -29,8 +29,10 @@
  */
 
 #include <modmesh/universe/bernstein.hpp>
+#include <modmesh/universe/vector3d.hpp>
 #include <modmesh/universe/bezier.hpp>
 #include <modmesh/universe/World.hpp>
+#include <modmesh/universe/WorldBVH.hpp>
 
 namespace modmesh
 {
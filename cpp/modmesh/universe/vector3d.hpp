@@ -0,0 +1,539 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/base.hpp>
+#include <modmesh/buffer/buffer.hpp>
+#include <modmesh/buffer/simd.hpp>
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace modmesh
+{
+
+/**
+ * Vector or point in three-dimensional space.
+ *
+ * @tparam T floating-point type
+ */
+template <typename T>
+class Vector3d
+    : public NumberBase<int32_t, T>
+{
+
+public:
+
+    using value_type = T;
+
+    Vector3d(T x, T y, T z)
+        : m_coord{x, y, z}
+    {
+    }
+
+    Vector3d() = default;
+    Vector3d(Vector3d const &) = default;
+    Vector3d(Vector3d &&) = default;
+    Vector3d & operator=(Vector3d const &) = default;
+    Vector3d & operator=(Vector3d &&) = default;
+    ~Vector3d() = default;
+
+    value_type x() const { return m_coord[0]; }
+    value_type & x() { return m_coord[0]; }
+    void set_x(value_type v) { x() = v; }
+
+    value_type y() const { return m_coord[1]; }
+    value_type & y() { return m_coord[1]; }
+    void set_y(value_type v) { y() = v; }
+
+    value_type z() const { return m_coord[2]; }
+    value_type & z() { return m_coord[2]; }
+    void set_z(value_type v) { z() = v; }
+
+    T operator[](size_t i) const { return m_coord[i]; }
+    T & operator[](size_t i) { return m_coord[i]; }
+
+    T at(size_t i) const
+    {
+        check_size(i, 3);
+        return m_coord[i];
+    }
+    T & at(size_t i)
+    {
+        check_size(i, 3);
+        return m_coord[i];
+    }
+
+    size_t size() const { return 3; }
+
+    void fill(T v) { m_coord[0] = m_coord[1] = m_coord[2] = v; }
+
+private:
+
+    void check_size(size_t i, size_t s) const
+    {
+        if (i >= s)
+        {
+            throw std::out_of_range(Formatter() << "Vector3d: i " << i << " >= size " << s);
+        }
+    }
+
+    T m_coord[3];
+
+}; /* end class Vector3d */
+
+using Vector3dFp32 = Vector3d<float>;
+using Vector3dFp64 = Vector3d<double>;
+
+namespace detail
+{
+
+// The batch kernels of Vector3dArray work on the x, y, and z rows.  The
+// explicit kernels do the same operations in the same order as the scalar
+// ones.  The results differ only where the compiler fuses a multiply and an
+// add, e.g., GCC for AVX-512, which implies FMA.
+
+template <typename T>
+using vector3d_rows = std::array<T const *, 3>;
+
+template <typename T>
+T vector3d_dot_at(vector3d_rows<T> const & a, vector3d_rows<T> const & b, size_t i)
+{
+    return a[0][i] * b[0][i] + a[1][i] * b[1][i] + a[2][i] * b[2][i];
+}
+
+/// Zero vectors are divided by the smallest normal number instead and stay
+/// zero.
+template <typename T>
+T vector3d_divisor(T norm)
+{
+    constexpr T tiny = std::numeric_limits<T>::min();
+    return norm > tiny ? norm : tiny;
+}
+
+template <typename T>
+void vector3d_dot_generic(vector3d_rows<T> const & a, vector3d_rows<T> const & b, size_t size, T * out)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        out[i] = vector3d_dot_at(a, b, i);
+    }
+}
+
+template <typename T>
+void vector3d_cross_generic(vector3d_rows<T> const & a, vector3d_rows<T> const & b, size_t size, std::array<T *, 3> const & out)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        out[0][i] = a[1][i] * b[2][i] - a[2][i] * b[1][i];
+        out[1][i] = a[2][i] * b[0][i] - a[0][i] * b[2][i];
+        out[2][i] = a[0][i] * b[1][i] - a[1][i] * b[0][i];
+    }
+}
+
+template <typename T>
+void vector3d_norm_generic(vector3d_rows<T> const & a, size_t size, T * out)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        out[i] = std::sqrt(vector3d_dot_at(a, a, i));
+    }
+}
+
+template <typename T>
+void vector3d_normalize_generic(std::array<T *, 3> const & a, size_t size)
+{
+    vector3d_rows<T> const ca{a[0], a[1], a[2]};
+    for (size_t i = 0; i < size; ++i)
+    {
+        T const divisor = vector3d_divisor(std::sqrt(vector3d_dot_at(ca, ca, i)));
+        a[0][i] /= divisor;
+        a[1][i] /= divisor;
+        a[2][i] /= divisor;
+    }
+}
+
+template <typename T>
+void vector3d_axpy_generic(T alpha, vector3d_rows<T> const & x, size_t size, std::array<T *, 3> const & y)
+{
+    for (size_t idim = 0; idim < 3; ++idim)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            y[idim][i] = y[idim][i] + alpha * x[idim][i];
+        }
+    }
+}
+
+// The kernel bodies are shared by the instruction sets through the macro
+// because the target attribute cannot be a template parameter.
+// clang-format off
+#define MM_DECL_VECTOR3D_KERNELS(SUFFIX, TARGET)                                                                      \
+    template <typename V, typename T = typename V::value_type>                                                        \
+    TARGET typename V::vector_type vector3d_dot_lanes_##SUFFIX(vector3d_rows<T> const & a,                            \
+                                                               vector3d_rows<T> const & b, size_t i)                  \
+    {                                                                                                                 \
+        return V::add(V::add(V::mul(V::load(a[0] + i), V::load(b[0] + i)),                                            \
+                             V::mul(V::load(a[1] + i), V::load(b[1] + i))),                                           \
+                      V::mul(V::load(a[2] + i), V::load(b[2] + i)));                                                  \
+    }                                                                                                                 \
+                                                                                                                      \
+    template <typename V, typename T = typename V::value_type>                                                        \
+    TARGET void vector3d_dot_##SUFFIX(vector3d_rows<T> const & a, vector3d_rows<T> const & b, size_t size,            \
+                                      T * out)                                                                        \
+    {                                                                                                                 \
+        size_t i = 0;                                                                                                 \
+        for (; i + V::WIDTH <= size; i += V::WIDTH)                                                                   \
+        {                                                                                                             \
+            V::store(out + i, vector3d_dot_lanes_##SUFFIX<V>(a, b, i));                                               \
+        }                                                                                                             \
+        vector3d_dot_generic<T>({a[0] + i, a[1] + i, a[2] + i}, {b[0] + i, b[1] + i, b[2] + i}, size - i,             \
+                                out + i);                                                                             \
+    }                                                                                                                 \
+                                                                                                                      \
+    template <typename V, typename T = typename V::value_type>                                                        \
+    TARGET void vector3d_cross_##SUFFIX(vector3d_rows<T> const & a, vector3d_rows<T> const & b, size_t size,          \
+                                        std::array<T *, 3> const & out)                                               \
+    {                                                                                                                 \
+        size_t i = 0;                                                                                                 \
+        for (; i + V::WIDTH <= size; i += V::WIDTH)                                                                   \
+        {                                                                                                             \
+            typename V::vector_type const ax = V::load(a[0] + i);                                                     \
+            typename V::vector_type const ay = V::load(a[1] + i);                                                     \
+            typename V::vector_type const az = V::load(a[2] + i);                                                     \
+            typename V::vector_type const bx = V::load(b[0] + i);                                                     \
+            typename V::vector_type const by = V::load(b[1] + i);                                                     \
+            typename V::vector_type const bz = V::load(b[2] + i);                                                     \
+            V::store(out[0] + i, V::sub(V::mul(ay, bz), V::mul(az, by)));                                             \
+            V::store(out[1] + i, V::sub(V::mul(az, bx), V::mul(ax, bz)));                                             \
+            V::store(out[2] + i, V::sub(V::mul(ax, by), V::mul(ay, bx)));                                             \
+        }                                                                                                             \
+        vector3d_cross_generic<T>({a[0] + i, a[1] + i, a[2] + i}, {b[0] + i, b[1] + i, b[2] + i}, size - i,           \
+                                  {out[0] + i, out[1] + i, out[2] + i});                                              \
+    }                                                                                                                 \
+                                                                                                                      \
+    template <typename V, typename T = typename V::value_type>                                                        \
+    TARGET void vector3d_norm_##SUFFIX(vector3d_rows<T> const & a, size_t size, T * out)                              \
+    {                                                                                                                 \
+        size_t i = 0;                                                                                                 \
+        for (; i + V::WIDTH <= size; i += V::WIDTH)                                                                   \
+        {                                                                                                             \
+            V::store(out + i, V::sqrt(vector3d_dot_lanes_##SUFFIX<V>(a, a, i)));                                      \
+        }                                                                                                             \
+        vector3d_norm_generic<T>({a[0] + i, a[1] + i, a[2] + i}, size - i, out + i);                                  \
+    }                                                                                                                 \
+                                                                                                                      \
+    template <typename V, typename T = typename V::value_type>                                                        \
+    TARGET void vector3d_normalize_##SUFFIX(std::array<T *, 3> const & a, size_t size)                                \
+    {                                                                                                                 \
+        vector3d_rows<T> const ca{a[0], a[1], a[2]};                                                                  \
+        typename V::vector_type const tiny = V::set1(std::numeric_limits<T>::min());                                  \
+        size_t i = 0;                                                                                                 \
+        for (; i + V::WIDTH <= size; i += V::WIDTH)                                                                   \
+        {                                                                                                             \
+            typename V::vector_type const divisor = V::max(V::sqrt(vector3d_dot_lanes_##SUFFIX<V>(ca, ca, i)), tiny); \
+            for (size_t idim = 0; idim < 3; ++idim)                                                                   \
+            {                                                                                                         \
+                V::store(a[idim] + i, V::div(V::load(a[idim] + i), divisor));                                         \
+            }                                                                                                         \
+        }                                                                                                             \
+        vector3d_normalize_generic<T>({a[0] + i, a[1] + i, a[2] + i}, size - i);                                      \
+    }                                                                                                                 \
+                                                                                                                      \
+    template <typename V, typename T = typename V::value_type>                                                        \
+    TARGET void vector3d_axpy_##SUFFIX(T alpha, vector3d_rows<T> const & x, size_t size,                              \
+                                       std::array<T *, 3> const & y)                                                  \
+    {                                                                                                                 \
+        typename V::vector_type const va = V::set1(alpha);                                                            \
+        size_t i = 0;                                                                                                 \
+        for (; i + V::WIDTH <= size; i += V::WIDTH)                                                                   \
+        {                                                                                                             \
+            for (size_t idim = 0; idim < 3; ++idim)                                                                   \
+            {                                                                                                         \
+                V::store(y[idim] + i, V::add(V::load(y[idim] + i), V::mul(va, V::load(x[idim] + i))));                \
+            }                                                                                                         \
+        }                                                                                                             \
+        vector3d_axpy_generic<T>(alpha, {x[0] + i, x[1] + i, x[2] + i}, size - i,                                     \
+                                 {y[0] + i, y[1] + i, y[2] + i});                                                     \
+    }
+// clang-format on
+
+#if defined(MODMESH_SIMD_X86)
+MM_DECL_VECTOR3D_KERNELS(avx2, MODMESH_SIMD_TARGET_AVX2)
+MM_DECL_VECTOR3D_KERNELS(avx512, MODMESH_SIMD_TARGET_AVX512)
+#elif defined(MODMESH_SIMD_NEON)
+MM_DECL_VECTOR3D_KERNELS(neon, )
+#endif
+
+#undef MM_DECL_VECTOR3D_KERNELS
+
+// Call the kernel NAME of the selected instruction set, or the generic one.
+#if defined(MODMESH_SIMD_X86)
+#define MM_VECTOR3D_DISPATCH(T, NAME, ...)                                                               \
+    switch (simd::level())                                                                               \
+    {                                                                                                    \
+    case simd::SimdLevel::AVX512: NAME##_avx512<simd::detail::avx512_traits<T>>(__VA_ARGS__); return;     \
+    case simd::SimdLevel::AVX2: NAME##_avx2<simd::detail::avx2_traits<T>>(__VA_ARGS__); return;           \
+    default: NAME##_generic<T>(__VA_ARGS__); return;                                                     \
+    }
+#elif defined(MODMESH_SIMD_NEON)
+#define MM_VECTOR3D_DISPATCH(T, NAME, ...)                                                               \
+    if (simd::SimdLevel::NEON == simd::level())                                                          \
+    {                                                                                                    \
+        NAME##_neon<simd::detail::neon_traits<T>>(__VA_ARGS__);                                          \
+        return;                                                                                          \
+    }                                                                                                    \
+    NAME##_generic<T>(__VA_ARGS__);
+#else
+#define MM_VECTOR3D_DISPATCH(T, NAME, ...) NAME##_generic<T>(__VA_ARGS__);
+#endif
+
+template <typename T>
+void vector3d_dot(vector3d_rows<T> const & a, vector3d_rows<T> const & b, size_t size, T * out)
+{
+    MM_VECTOR3D_DISPATCH(T, vector3d_dot, a, b, size, out)
+}
+
+template <typename T>
+void vector3d_cross(vector3d_rows<T> const & a, vector3d_rows<T> const & b, size_t size, std::array<T *, 3> const & out)
+{
+    MM_VECTOR3D_DISPATCH(T, vector3d_cross, a, b, size, out)
+}
+
+template <typename T>
+void vector3d_norm(vector3d_rows<T> const & a, size_t size, T * out)
+{
+    MM_VECTOR3D_DISPATCH(T, vector3d_norm, a, size, out)
+}
+
+template <typename T>
+void vector3d_normalize(std::array<T *, 3> const & a, size_t size)
+{
+    MM_VECTOR3D_DISPATCH(T, vector3d_normalize, a, size)
+}
+
+template <typename T>
+void vector3d_axpy(T alpha, vector3d_rows<T> const & x, size_t size, std::array<T *, 3> const & y)
+{
+    MM_VECTOR3D_DISPATCH(T, vector3d_axpy, alpha, x, size, y)
+}
+
+#undef MM_VECTOR3D_DISPATCH
+
+} /* end namespace detail */
+
+/**
+ * Packed array of Vector3d in the structure-of-arrays layout: the x, y, and
+ * z of the vectors each take a contiguous row of a SimpleArray in [3, size],
+ * the same as the loci of WorldGeometry.  The batch operations run the
+ * explicit SIMD kernels of the instruction set selected by simd::level() for
+ * float and double.
+ *
+ * @tparam T floating-point type
+ */
+template <typename T>
+class Vector3dArray
+    : public NumberBase<int32_t, T>
+{
+
+public:
+
+    using value_type = T;
+    using vector_type = Vector3d<T>;
+    using array_type = SimpleArray<T>;
+
+    /// Zero vectors.
+    explicit Vector3dArray(size_t size = 0)
+        : m_data(small_vector<size_t>{3, size}, T(0))
+    {
+    }
+
+    explicit Vector3dArray(std::vector<vector_type> const & vectors)
+        : m_data(small_vector<size_t>{3, vectors.size()}, SimpleArrayUninitialized{})
+    {
+        for (size_t i = 0; i < vectors.size(); ++i)
+        {
+            set(i, vectors[i]);
+        }
+    }
+
+    /// Take the rows of data in [3, size].
+    explicit Vector3dArray(array_type data)
+        : m_data(std::move(data))
+    {
+        if (2 != m_data.ndim() || 3 != m_data.shape(0) || 0 != m_data.nghost())
+        {
+            throw std::invalid_argument("Vector3dArray: data must be in [3, size] without ghost");
+        }
+    }
+
+    Vector3dArray(Vector3dArray const &) = default;
+    Vector3dArray(Vector3dArray &&) = default;
+    Vector3dArray & operator=(Vector3dArray const &) = default;
+    Vector3dArray & operator=(Vector3dArray &&) = default;
+    ~Vector3dArray() = default;
+
+    size_t size() const { return m_data.shape(1); }
+    array_type const & data() const { return m_data; }
+    array_type & data() { return m_data; }
+
+    T const * x() const { return m_data.data(); }
+    T * x() { return m_data.data(); }
+    T const * y() const { return m_data.data() + size(); }
+    T * y() { return m_data.data() + size(); }
+    T const * z() const { return m_data.data() + 2 * size(); }
+    T * z() { return m_data.data() + 2 * size(); }
+
+    std::array<T const *, 3> rows() const { return {x(), y(), z()}; }
+    std::array<T *, 3> rows() { return {x(), y(), z()}; }
+
+    vector_type operator[](size_t i) const { return vector_type(x()[i], y()[i], z()[i]); }
+    vector_type at(size_t i) const
+    {
+        check_size(i, size());
+        return (*this)[i];
+    }
+
+    void set(size_t i, vector_type const & v)
+    {
+        x()[i] = v[0];
+        y()[i] = v[1];
+        z()[i] = v[2];
+    }
+    void set_at(size_t i, vector_type const & v)
+    {
+        check_size(i, size());
+        set(i, v);
+    }
+
+    std::vector<vector_type> to_vector() const
+    {
+        std::vector<vector_type> ret(size());
+        for (size_t i = 0; i < ret.size(); ++i)
+        {
+            ret[i] = (*this)[i];
+        }
+        return ret;
+    }
+
+    /// Dot products with the vectors of other.
+    SimpleArray<T> dot(Vector3dArray const & other) const
+    {
+        check_same_size(other, "dot");
+        SimpleArray<T> ret(small_vector<size_t>{size()}, SimpleArrayUninitialized{});
+        detail::vector3d_dot<T>(rows(), other.rows(), size(), ret.data());
+        return ret;
+    }
+
+    /// Cross products with the vectors of other.
+    Vector3dArray cross(Vector3dArray const & other) const
+    {
+        check_same_size(other, "cross");
+        Vector3dArray ret(array_type(small_vector<size_t>{3, size()}, SimpleArrayUninitialized{}));
+        detail::vector3d_cross<T>(rows(), other.rows(), size(), ret.rows());
+        return ret;
+    }
+
+    /// Euclidean lengths of the vectors.
+    SimpleArray<T> norm() const
+    {
+        SimpleArray<T> ret(small_vector<size_t>{size()}, SimpleArrayUninitialized{});
+        detail::vector3d_norm<T>(rows(), size(), ret.data());
+        return ret;
+    }
+
+    /// Scale the vectors to unit length in place.  Zero vectors stay zero.
+    Vector3dArray & normalize()
+    {
+        detail::vector3d_normalize<T>(rows(), size());
+        return *this;
+    }
+
+    /// Add alpha times the vectors of x in place.
+    Vector3dArray & axpy(T alpha, Vector3dArray const & x)
+    {
+        check_same_size(x, "axpy");
+        detail::vector3d_axpy<T>(alpha, x.rows(), size(), rows());
+        return *this;
+    }
+
+    /// Write the vectors interleaved as x, y, z, x, y, z, ... into out of
+    /// 3 * size() elements.
+    template <typename U>
+    void interleave_to(U * out) const { interleave(rows(), size(), out); }
+
+    /// Write the vectors of the x, y, and z rows interleaved into out, e.g.,
+    /// for the vertex buffer of a renderer.
+    template <typename U>
+    static void interleave(std::array<T const *, 3> const & rows, size_t size, U * out);
+
+private:
+
+    void check_size(size_t i, size_t s) const
+    {
+        if (i >= s)
+        {
+            throw std::out_of_range(Formatter() << "Vector3dArray: i " << i << " >= size " << s);
+        }
+    }
+
+    void check_same_size(Vector3dArray const & other, char const * name) const
+    {
+        if (other.size() != size())
+        {
+            throw std::invalid_argument(Formatter() << "Vector3dArray::" << name << ": size " << other.size()
+                                                    << " != " << size());
+        }
+    }
+
+    array_type m_data;
+
+}; /* end class Vector3dArray */
+
+template <typename T>
+template <typename U>
+void Vector3dArray<T>::interleave(std::array<T const *, 3> const & rows, size_t size, U * out)
+{
+    // The compiler vectorizes the loop, and explicit shuffles are not faster.
+    for (size_t i = 0; i < size; ++i)
+    {
+        out[3 * i] = static_cast<U>(rows[0][i]);
+        out[3 * i + 1] = static_cast<U>(rows[1][i]);
+        out[3 * i + 2] = static_cast<U>(rows[2][i]);
+    }
+}
+
+using Vector3dArrayFp32 = Vector3dArray<float>;
+using Vector3dArrayFp64 = Vector3dArray<double>;
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
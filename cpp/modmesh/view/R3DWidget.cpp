@@ -29,6 +29,10 @@
 #include <modmesh/view/R3DWidget.hpp> // Must be the first include.
 #include <modmesh/view/RAxisMark.hpp>
 #include <modmesh/view/RStaticMesh.hpp>
+#include <modmesh/view/RViewStats.hpp>
+
+#include <QGeometryRenderer>
+#include <Qt3DLogic/QFrameAction>
 
 namespace modmesh
 {
@@ -38,9 +42,18 @@ R3DWidget::R3DWidget(Qt3DExtras::Qt3DWindow * window, RScene * scene, QWidget *
     , m_view(nullptr == window ? new Qt3DExtras::Qt3DWindow : window)
     , m_scene(nullptr == scene ? new RScene : scene)
     , m_container(createWindowContainer(m_view, this, Qt::Widget))
+    , m_frame_action(new Qt3DLogic::QFrameAction(m_scene))
+    , m_stats(new QLabel(this))
 {
     m_view->setRootEntity(m_scene);
 
+    // Count every frame, and show the counts on demand.
+    m_scene->addComponent(m_frame_action);
+    connect(m_frame_action, &Qt3DLogic::QFrameAction::triggered, this, &R3DWidget::onFrame);
+    m_stats->setAttribute(Qt::WA_TransparentForMouseEvents);
+    m_stats->setStyleSheet("QLabel { color: white; background-color: rgba(0, 0, 0, 160); padding: 4px; font-family: monospace; }");
+    m_stats->hide();
+
     // Set up the camera.
     Qt3DRender::QCamera * camera = m_view->camera();
     camera->lens()->setPerspectiveProjection(45.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
@@ -71,7 +84,7 @@ void R3DWidget::showMark()
     new RAxisMark(m_scene);
 }
 
-void R3DWidget::updateMesh(std::shared_ptr<StaticMesh> const & mesh)
+void R3DWidget::updateMesh(std::shared_ptr<StaticMesh> const & mesh, double lod_pixels)
 {
     for (Qt3DCore::QNode * child : m_scene->childNodes())
     {
@@ -80,12 +93,85 @@ void R3DWidget::updateMesh(std::shared_ptr<StaticMesh> const & mesh)
             child->deleteLater();
         }
     }
-    new RStaticMesh(mesh, m_scene);
+    auto * rmesh = new RStaticMesh(mesh, m_scene);
     m_mesh = mesh;
+    m_mesh_fp32.reset();
+
+    if (lod_pixels > 0.0)
+    {
+        // Follow the camera with the angle of lod_pixels through the
+        // vertical field of view.  The connection goes with the entity.
+        auto const follow = [this, rmesh, lod_pixels]()
+        {
+            Qt3DRender::QCamera const * cam = camera();
+            int const height = std::max(m_view->height(), 1);
+            double const fov = static_cast<double>(cam->fieldOfView()) * M_PI / 180.0;
+            rmesh->update_lod(cam->position(), lod_pixels * fov / static_cast<double>(height));
+        };
+        connect(camera(), &Qt3DRender::QCamera::positionChanged, rmesh, follow);
+        follow();
+        rmesh->enable_lod();
+    }
 }
 
-void R3DWidget::updateWorld(std::shared_ptr<WorldFp64> const & world)
+void R3DWidget::updateMesh(std::shared_ptr<StaticMeshFp32> const & mesh)
 {
+    for (Qt3DCore::QNode * child : m_scene->childNodes())
+    {
+        if (typeid(*child) == typeid(RStaticMesh))
+        {
+            child->deleteLater();
+        }
+    }
+    new RStaticMesh(mesh, m_scene);
+    m_mesh.reset();
+    m_mesh_fp32 = mesh;
+}
+
+void R3DWidget::showField(
+    std::shared_ptr<SimpleArraySnapshot<double>> const & snapshot,
+    bool on_cell,
+    size_t column,
+    double vmin,
+    double vmax,
+    int interval)
+{
+    if (!m_mesh && !m_mesh_fp32)
+    {
+        throw std::runtime_error("R3DWidget::showField: no mesh is shown");
+    }
+    for (Qt3DCore::QNode * child : m_scene->childNodes())
+    {
+        if (typeid(*child) == typeid(RStaticMesh))
+        {
+            static_cast<RStaticMesh *>(child)->show_field(snapshot, on_cell, column, vmin, vmax, interval);
+        }
+    }
+}
+
+void R3DWidget::hideField()
+{
+    for (Qt3DCore::QNode * child : m_scene->childNodes())
+    {
+        if (typeid(*child) == typeid(RStaticMesh))
+        {
+            static_cast<RStaticMesh *>(child)->hide_field();
+        }
+    }
+}
+
+void R3DWidget::updateWorld(std::shared_ptr<WorldFp64> const & world, double pixel_tolerance, bool on_gpu)
+{
+    if (!on_gpu && pixel_tolerance > 0.0 && m_view->height() > 0)
+    {
+        // The angle subtended by the tolerance through the vertical field of
+        // view.
+        Qt3DRender::QCamera const * cam = camera();
+        double const fov = static_cast<double>(cam->fieldOfView()) * M_PI / 180.0;
+        double const angle = pixel_tolerance * fov / static_cast<double>(m_view->height());
+        QVector3D const eye = cam->position();
+        world->sample_adaptive_view(Vector3dFp64(eye.x(), eye.y(), eye.z()), angle);
+    }
     for (Qt3DCore::QNode * child : m_scene->childNodes())
     {
         if (typeid(*child) == typeid(RWorld))
@@ -93,7 +179,39 @@ void R3DWidget::updateWorld(std::shared_ptr<WorldFp64> const & world)
             child->deleteLater();
         }
     }
-    new RWorld(world, m_scene);
+    float const gpu_tolerance = pixel_tolerance > 0.0 ? static_cast<float>(pixel_tolerance) : 1.0f;
+    new RWorld(world, m_scene, on_gpu, gpu_tolerance);
+}
+
+void R3DWidget::showStats(bool visible)
+{
+    m_stats->setVisible(visible);
+    if (visible)
+    {
+        m_stats->setText(QString::fromStdString(RViewStats::instance().report()));
+        m_stats->adjustSize();
+        m_stats->raise();
+    }
+}
+
+void R3DWidget::onFrame(float dt)
+{
+    size_t ndraw = 0;
+    for (auto const * renderer : m_scene->findChildren<Qt3DRender::QGeometryRenderer *>())
+    {
+        ndraw += renderer->isEnabled() ? 1 : 0;
+    }
+    RViewStats & stats = RViewStats::instance();
+    stats.add_frame(static_cast<double>(dt), ndraw);
+
+    // Refresh the overlay a few times a second to keep it readable.
+    m_stats_age += static_cast<double>(dt);
+    if (m_stats->isVisible() && m_stats_age > 0.25)
+    {
+        m_stats_age = 0.0;
+        m_stats->setText(QString::fromStdString(stats.report()));
+        m_stats->adjustSize();
+    }
 }
 
 void R3DWidget::resizeEvent(QResizeEvent * event)
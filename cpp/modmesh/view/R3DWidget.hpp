@@ -43,8 +43,16 @@
 #include <QOrbitCameraController>
 #include <QFirstPersonCameraController>
 
+#include <QLabel>
 #include <QResizeEvent>
 
+namespace Qt3DLogic
+{
+
+class QFrameAction;
+
+} /* end namespace Qt3DLogic */
+
 namespace modmesh
 {
 
@@ -115,17 +123,62 @@ public:
     QPixmap grabPixmap() const { return m_view->screen()->grabWindow(m_view->winId()); }
 
     void showMark();
-    void updateMesh(std::shared_ptr<StaticMesh> const & mesh);
-    void updateWorld(std::shared_ptr<WorldFp64> const & world);
+    /**
+     * Show the mesh.  A positive lod_pixels builds its levels of detail in
+     * the background and then draws the boundary and clusters of about that
+     * many pixels in place of the full mesh as the camera moves away.
+     */
+    void updateMesh(std::shared_ptr<StaticMesh> const & mesh, double lod_pixels = 0.0);
+    /// Show the single-precision mesh, whose coordinates are uploaded as is.
+    void updateMesh(std::shared_ptr<StaticMeshFp32> const & mesh);
+    /**
+     * Color the mesh by a column of the field published to the snapshot,
+     * polled every interval milliseconds.  See RStaticMesh::show_field().
+     */
+    void showField(
+        std::shared_ptr<SimpleArraySnapshot<double>> const & snapshot,
+        bool on_cell = false,
+        size_t column = 0,
+        double vmin = 0.0,
+        double vmax = 0.0,
+        int interval = 100);
+    void hideField();
+    /**
+     * Show the world.  A positive pixel_tolerance first samples the curves
+     * adaptively to the error of that many pixels from the current camera.
+     * With on_gpu, the curves are instead evaluated in the vertex shader
+     * from the control points to the tolerance (1 pixel if not positive)
+     * from whatever camera, and are not sampled.  See RWorld.
+     */
+    void updateWorld(std::shared_ptr<WorldFp64> const & world, double pixel_tolerance = 0.0, bool on_gpu = false);
 
     std::shared_ptr<StaticMesh> mesh() const { return m_mesh; }
+    std::shared_ptr<StaticMeshFp32> meshFp32() const { return m_mesh_fp32; }
+
+    /**
+     * Show the frame time, the time of preparing and delivering the
+     * geometry, the bytes uploaded, and the draw calls of the last frame
+     * over the view.  The counts are kept in RViewStats whether or not they
+     * are shown.
+     */
+    void showStats(bool visible);
+    bool statsVisible() const { return m_stats->isVisible(); }
 
 private:
 
+    /// Close the frame in RViewStats and refresh the overlay.
+    void onFrame(float dt);
+
     Qt3DExtras::Qt3DWindow * m_view = nullptr;
     RScene * m_scene = nullptr;
     QWidget * m_container = nullptr;
+    // Only one of the meshes is shown.
     std::shared_ptr<StaticMesh> m_mesh;
+    std::shared_ptr<StaticMeshFp32> m_mesh_fp32;
+    Qt3DLogic::QFrameAction * m_frame_action = nullptr;
+    QLabel * m_stats = nullptr;
+    // Seconds since the overlay was refreshed.
+    double m_stats_age = 0.0;
 
 }; /* end class R3DWidget */
 
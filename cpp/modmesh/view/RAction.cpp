@@ -54,6 +54,8 @@ RAppAction::RAppAction(const QString & text, const QString & tipText, const QStr
 void RAppAction::run()
 {
     namespace py = pybind11;
+    // The event loop runs without the GIL.
+    py::gil_scoped_acquire const acquire;
     try
     {
         py::module_ appmod = py::module_::import(m_appName.toStdString().c_str());
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/view/RBezierMaterial.hpp> // Must be the first include.
+
+#include <QColor>
+
+#include <Qt3DRender/QEffect>
+#include <Qt3DRender/QFilterKey>
+#include <Qt3DRender/QGraphicsApiFilter>
+#include <Qt3DRender/QRenderPass>
+#include <Qt3DRender/QShaderProgram>
+#include <Qt3DRender/QTechnique>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+// The second differences of the control points bound the second derivative
+// of the curve.  Wang's formula takes from the bound the number of uniform
+// segments whose chords are within the tolerance.
+static char const * const bezier_vertex_shader = R"(#version 330 core
+in float vertexSegment;
+in vec3 control0;
+in vec3 control1;
+in vec3 control2;
+in vec3 control3;
+uniform mat4 modelViewProjection;
+uniform mat4 viewportMatrix;
+uniform float pixelTolerance;
+uniform float maxSegment;
+vec2 toPixel(vec4 clip)
+{
+    return (viewportMatrix * vec4(clip.xyz / clip.w, 1.0)).xy;
+}
+void main()
+{
+    vec4 c0 = modelViewProjection * vec4(control0, 1.0);
+    vec4 c1 = modelViewProjection * vec4(control1, 1.0);
+    vec4 c2 = modelViewProjection * vec4(control2, 1.0);
+    vec4 c3 = modelViewProjection * vec4(control3, 1.0);
+    float nseg = maxSegment;
+    // A control point behind the eye takes all segments.
+    if (min(min(c0.w, c1.w), min(c2.w, c3.w)) > 0.0)
+    {
+        vec2 s0 = toPixel(c0);
+        vec2 s1 = toPixel(c1);
+        vec2 s2 = toPixel(c2);
+        vec2 s3 = toPixel(c3);
+        float m = max(length(s0 - 2.0 * s1 + s2), length(s1 - 2.0 * s2 + s3));
+        nseg = clamp(ceil(sqrt(0.75 * m / max(pixelTolerance, 1.0e-3))), 1.0, maxSegment);
+    }
+    float t = min(vertexSegment, nseg) / nseg;
+    float u = 1.0 - t;
+    vec4 p = (u * u * u) * c0 + (3.0 * u * u * t) * c1 + (3.0 * u * t * t) * c2 + (t * t * t) * c3;
+    gl_Position = p;
+}
+)";
+
+static char const * const bezier_fragment_shader = R"(#version 330 core
+out vec4 fragColor;
+uniform vec4 lineColor;
+void main()
+{
+    fragColor = lineColor;
+}
+)";
+
+} /* end namespace detail */
+
+RBezierMaterial::RBezierMaterial(Qt3DCore::QNode * parent)
+    : Qt3DRender::QMaterial(parent)
+    , m_pixel_tolerance(new Qt3DRender::QParameter(QStringLiteral("pixelTolerance"), 1.0f, this))
+    , m_max_segment(new Qt3DRender::QParameter(QStringLiteral("maxSegment"), static_cast<float>(MAX_SEGMENT), this))
+    , m_color(new Qt3DRender::QParameter(QStringLiteral("lineColor"), QColor::fromRgbF(0.7f, 0.7f, 0.7f), this))
+{
+    auto * program = new Qt3DRender::QShaderProgram(this);
+    program->setVertexShaderCode(QByteArray(detail::bezier_vertex_shader));
+    program->setFragmentShaderCode(QByteArray(detail::bezier_fragment_shader));
+
+    auto * pass = new Qt3DRender::QRenderPass(this);
+    pass->setShaderProgram(program);
+
+    // The forward renderer of Qt3DWindow selects the techniques by this key.
+    auto * key = new Qt3DRender::QFilterKey(this);
+    key->setName(QStringLiteral("renderingStyle"));
+    key->setValue(QStringLiteral("forward"));
+
+    auto * technique = new Qt3DRender::QTechnique(this);
+    technique->graphicsApiFilter()->setApi(Qt3DRender::QGraphicsApiFilter::OpenGL);
+    technique->graphicsApiFilter()->setProfile(Qt3DRender::QGraphicsApiFilter::CoreProfile);
+    technique->graphicsApiFilter()->setMajorVersion(3);
+    technique->graphicsApiFilter()->setMinorVersion(3);
+    technique->addFilterKey(key);
+    technique->addRenderPass(pass);
+
+    auto * effect = new Qt3DRender::QEffect(this);
+    effect->addTechnique(technique);
+    setEffect(effect);
+
+    addParameter(m_pixel_tolerance);
+    addParameter(m_max_segment);
+    addParameter(m_color);
+}
+
+void RBezierMaterial::set_pixel_tolerance(float value)
+{
+    m_pixel_tolerance->setValue(value);
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,74 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/view/common_detail.hpp> // Must be the first include.
+
+#include <Qt3DRender/QMaterial>
+#include <Qt3DRender/QParameter>
+
+namespace modmesh
+{
+
+/**
+ * Draw cubic Bezier curves from their control points.  Each curve is an
+ * instance of a line strip of MAX_SEGMENT segments, and the vertex shader
+ * evaluates the curve at the vertices.  The number of segments is taken per
+ * frame from the projected control points by Wang's formula, so that the
+ * chord is within the pixel tolerance of the curve, and the vertices beyond
+ * it collapse to the end point.
+ */
+class RBezierMaterial
+    : public Qt3DRender::QMaterial
+{
+
+public:
+
+    static constexpr size_t MAX_SEGMENT = 64;
+    /// The per-vertex attribute of the segment index, 0 to MAX_SEGMENT.
+    static constexpr char const * SEGMENT_ATTRIBUTE_NAME = "vertexSegment";
+    /// The per-instance attributes of the 4 control points.
+    static constexpr char const * CONTROL_ATTRIBUTE_NAMES[4] = {"control0", "control1", "control2", "control3"};
+
+    explicit RBezierMaterial(Qt3DCore::QNode * parent = nullptr);
+
+    void set_pixel_tolerance(float value);
+    float pixel_tolerance() const { return m_pixel_tolerance->value().toFloat(); }
+
+private:
+
+    Qt3DRender::QParameter * m_pixel_tolerance = nullptr;
+    Qt3DRender::QParameter * m_max_segment = nullptr;
+    Qt3DRender::QParameter * m_color = nullptr;
+
+}; /* end class RBezierMaterial */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
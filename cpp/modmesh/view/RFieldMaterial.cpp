@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/view/RFieldMaterial.hpp> // Must be the first include.
+
+#include <Qt3DRender/QEffect>
+#include <Qt3DRender/QFilterKey>
+#include <Qt3DRender/QGraphicsApiFilter>
+#include <Qt3DRender/QRenderPass>
+#include <Qt3DRender/QShaderProgram>
+#include <Qt3DRender/QTechnique>
+
+namespace modmesh
+{
+
+namespace detail
+{
+
+static char const * const field_vertex_shader = R"(#version 330 core
+in vec3 vertexPosition;
+in float vertexScalar;
+out float scalar;
+uniform mat4 modelViewProjection;
+void main()
+{
+    scalar = vertexScalar;
+    gl_Position = modelViewProjection * vec4(vertexPosition, 1.0);
+}
+)";
+
+// The polynomial fit of viridis by Matt Zucker (CC0).
+static char const * const field_fragment_shader = R"(#version 330 core
+in float scalar;
+out vec4 fragColor;
+uniform float vmin;
+uniform float vmax;
+vec3 viridis(float t)
+{
+    const vec3 c0 = vec3(0.2777273272234177, 0.005407344544966578, 0.3340998053353061);
+    const vec3 c1 = vec3(0.1050930431085774, 1.404613529898575, 1.384590162594685);
+    const vec3 c2 = vec3(-0.3308618287255563, 0.214847559468213, 0.09509516302823659);
+    const vec3 c3 = vec3(-4.634230498983486, -5.799100973351585, -19.33244095627987);
+    const vec3 c4 = vec3(6.228269936347081, 14.17993336680509, 56.69055260068105);
+    const vec3 c5 = vec3(4.776384997670288, -13.74514537774601, -65.35303263337234);
+    const vec3 c6 = vec3(-5.435455855934631, 4.645852612178535, 26.3124352495832);
+    return c0 + t * (c1 + t * (c2 + t * (c3 + t * (c4 + t * (c5 + t * c6)))));
+}
+void main()
+{
+    float t = clamp((scalar - vmin) / max(vmax - vmin, 1.0e-30), 0.0, 1.0);
+    fragColor = vec4(viridis(t), 1.0);
+}
+)";
+
+} /* end namespace detail */
+
+RFieldMaterial::RFieldMaterial(Qt3DCore::QNode * parent)
+    : Qt3DRender::QMaterial(parent)
+    , m_vmin(new Qt3DRender::QParameter(QStringLiteral("vmin"), 0.0f, this))
+    , m_vmax(new Qt3DRender::QParameter(QStringLiteral("vmax"), 1.0f, this))
+{
+    auto * program = new Qt3DRender::QShaderProgram(this);
+    program->setVertexShaderCode(QByteArray(detail::field_vertex_shader));
+    program->setFragmentShaderCode(QByteArray(detail::field_fragment_shader));
+
+    auto * pass = new Qt3DRender::QRenderPass(this);
+    pass->setShaderProgram(program);
+
+    // The forward renderer of Qt3DWindow selects the techniques by this key.
+    auto * key = new Qt3DRender::QFilterKey(this);
+    key->setName(QStringLiteral("renderingStyle"));
+    key->setValue(QStringLiteral("forward"));
+
+    auto * technique = new Qt3DRender::QTechnique(this);
+    technique->graphicsApiFilter()->setApi(Qt3DRender::QGraphicsApiFilter::OpenGL);
+    technique->graphicsApiFilter()->setProfile(Qt3DRender::QGraphicsApiFilter::CoreProfile);
+    technique->graphicsApiFilter()->setMajorVersion(3);
+    technique->graphicsApiFilter()->setMinorVersion(3);
+    technique->addFilterKey(key);
+    technique->addRenderPass(pass);
+
+    auto * effect = new Qt3DRender::QEffect(this);
+    effect->addTechnique(technique);
+    setEffect(effect);
+
+    addParameter(m_vmin);
+    addParameter(m_vmax);
+}
+
+void RFieldMaterial::set_range(float vmin, float vmax)
+{
+    m_vmin->setValue(vmin);
+    m_vmax->setValue(vmax);
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
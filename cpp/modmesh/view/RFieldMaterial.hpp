@@ -0,0 +1,68 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/view/common_detail.hpp> // Must be the first include.
+
+#include <Qt3DRender/QMaterial>
+#include <Qt3DRender/QParameter>
+
+namespace modmesh
+{
+
+/**
+ * Color the lines of a geometry by the scalar of each vertex in the
+ * "vertexScalar" attribute.  The scalar is mapped from [vmin, vmax] to the
+ * viridis colormap in the fragment shader, so that a new field uploads only
+ * one float per vertex.
+ */
+class RFieldMaterial
+    : public Qt3DRender::QMaterial
+{
+
+public:
+
+    static constexpr char const * SCALAR_ATTRIBUTE_NAME = "vertexScalar";
+
+    explicit RFieldMaterial(Qt3DCore::QNode * parent = nullptr);
+
+    void set_range(float vmin, float vmax);
+    float vmin() const { return m_vmin->value().toFloat(); }
+    float vmax() const { return m_vmax->value().toFloat(); }
+
+private:
+
+    Qt3DRender::QParameter * m_vmin = nullptr;
+    Qt3DRender::QParameter * m_vmax = nullptr;
+
+}; /* end class RFieldMaterial */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
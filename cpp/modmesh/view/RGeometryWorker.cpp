@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/view/RGeometryWorker.hpp> // Must be the first include.
+
+namespace modmesh
+{
+
+void RGeometryBytes::set_indices(QByteArray && value, QByteArray const & last)
+{
+    same_indices = value == last;
+    if (!same_indices)
+    {
+        indices = std::move(value);
+    }
+}
+
+void RGeometryBytes::apply(
+    Qt3DCore::QAttribute * vertex_attribute,
+    Qt3DCore::QBuffer * vertex_buffer,
+    Qt3DCore::QAttribute * index_attribute,
+    Qt3DCore::QBuffer * index_buffer) const
+{
+    vertex_buffer->setData(vertices);
+    vertex_attribute->setCount(nvertex);
+    size_t nbytes = static_cast<size_t>(vertices.size());
+    if (!same_indices)
+    {
+        index_buffer->setData(indices);
+        index_attribute->setCount(nindex);
+        nbytes += static_cast<size_t>(indices.size());
+    }
+    RViewStats::instance().add_upload(nbytes);
+}
+
+RGeometryWorker & RGeometryWorker::instance()
+{
+    static RGeometryWorker inst;
+    return inst;
+}
+
+RGeometryWorker::RGeometryWorker()
+    : m_thread([this]()
+               { run(); })
+{
+}
+
+RGeometryWorker::~RGeometryWorker()
+{
+    // The jobs not started yet are dropped.
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_stop = true;
+    }
+    m_cond.notify_one();
+    m_thread.join();
+}
+
+void RGeometryWorker::push(std::function<void()> job)
+{
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_jobs.push_back(std::move(job));
+    }
+    m_cond.notify_one();
+    ++m_npending;
+    emit pendingChanged(m_npending);
+}
+
+void RGeometryWorker::finish()
+{
+    --m_npending;
+    emit pendingChanged(m_npending);
+}
+
+void RGeometryWorker::run()
+{
+    while (true)
+    {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cond.wait(lock, [this]()
+                        { return m_stop || !m_jobs.empty(); });
+            if (m_stop)
+            {
+                return;
+            }
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+        job();
+    }
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,170 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/view/common_detail.hpp> // Must be the first include.
+
+#include <modmesh/view/RViewStats.hpp>
+
+#include <QByteArray>
+#include <QObject>
+#include <QPointer>
+
+#include <Qt3DCore/QAttribute>
+#include <Qt3DCore/QBuffer>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace modmesh
+{
+
+/**
+ * The bytes of a vertex buffer of float triplets and of an index buffer of
+ * unsigned int pairs, prepared off the GUI thread.
+ */
+struct RGeometryBytes
+{
+    QByteArray vertices;
+    size_t nvertex = 0;
+    QByteArray indices;
+    size_t nindex = 0;
+    /// The indices equal those set last time and are not set again.
+    bool same_indices = false;
+
+    /// Keep indices unless they equal last.
+    void set_indices(QByteArray && value, QByteArray const & last);
+
+    /// Set the bytes to the buffers and the counts to the attributes, on the
+    /// GUI thread.
+    void apply(
+        Qt3DCore::QAttribute * vertex_attribute,
+        Qt3DCore::QBuffer * vertex_buffer,
+        Qt3DCore::QAttribute * index_attribute,
+        Qt3DCore::QBuffer * index_buffer) const;
+}; /* end struct RGeometryBytes */
+
+/**
+ * A worker thread that prepares the data of the geometry buffers off the GUI
+ * thread.  The jobs run one at a time in the order of submission, and their
+ * results are queued back to the GUI thread for the receivers still alive.
+ */
+class RGeometryWorker
+    : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    static RGeometryWorker & instance();
+
+    RGeometryWorker(RGeometryWorker const &) = delete;
+    RGeometryWorker(RGeometryWorker &&) = delete;
+    RGeometryWorker & operator=(RGeometryWorker const &) = delete;
+    RGeometryWorker & operator=(RGeometryWorker &&) = delete;
+    ~RGeometryWorker() override;
+
+    /**
+     * Run prepare() on the worker thread, and then deliver() with its result
+     * on the GUI thread unless receiver is gone.  prepare() must not touch
+     * the receiver.  The times of both are added to RViewStats, and that of
+     * prepare() under the name.
+     */
+    template <typename Prepare, typename Deliver>
+    void submit(QObject * receiver, char const * name, Prepare prepare, Deliver deliver);
+
+    /// Number of the jobs not delivered yet.
+    int npending() const { return m_npending; }
+
+signals:
+
+    void pendingChanged(int npending);
+
+private:
+
+    RGeometryWorker();
+
+    void push(std::function<void()> job);
+    void finish();
+    void run();
+
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::deque<std::function<void()>> m_jobs;
+    bool m_stop = false;
+    // Only touched on the GUI thread.
+    int m_npending = 0;
+    std::thread m_thread;
+
+}; /* end class RGeometryWorker */
+
+template <typename Prepare, typename Deliver>
+void RGeometryWorker::submit(QObject * receiver, char const * name, Prepare prepare, Deliver deliver)
+{
+    QPointer<QObject> guard(receiver);
+    push(
+        [this, guard, name, prepare = std::move(prepare), deliver = std::move(deliver)]() mutable
+        {
+            using result_type = decltype(prepare());
+            std::shared_ptr<result_type> result;
+            StopWatch sw;
+            try
+            {
+                result = std::make_shared<result_type>(prepare());
+            }
+            catch (std::exception const & e)
+            {
+                qWarning("RGeometryWorker: %s", e.what());
+            }
+            double const prepare_time = sw.lap();
+            QMetaObject::invokeMethod(
+                this,
+                [this, guard, name, prepare_time, result, deliver]() mutable
+                {
+                    RViewStats & stats = RViewStats::instance();
+                    stats.add_prepare(name, prepare_time);
+                    if (result && guard)
+                    {
+                        StopWatch sw;
+                        deliver(std::move(*result));
+                        stats.add_deliver(sw.lap());
+                    }
+                    finish();
+                },
+                Qt::QueuedConnection);
+        });
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -32,11 +32,13 @@
 
 #include <modmesh/view/RAction.hpp>
 #include <modmesh/view/RParameter.hpp>
+#include <modmesh/view/RGeometryWorker.hpp>
 #include <Qt>
 #include <QMenuBar>
 #include <QMenu>
 #include <QAction>
 #include <QActionGroup>
+#include <QStatusBar>
 
 namespace modmesh
 {
@@ -72,6 +74,7 @@ RManager & RManager::setUp()
         this->setUpConsole();
         this->setUpCentral();
         this->setUpMenu();
+        this->setUpStatus();
 
         m_already_setup = true;
     }
@@ -111,6 +114,26 @@ void RManager::setUpCentral()
     m_mainWindow->setCentralWidget(m_mdiArea);
 }
 
+void RManager::setUpStatus()
+{
+    // A busy indicator while the geometry worker has pending jobs.
+    m_geometryLabel = new QLabel(QString("Preparing geometry"), m_mainWindow);
+    m_geometryProgress = new QProgressBar(m_mainWindow);
+    m_geometryProgress->setRange(0, 0);
+    m_geometryProgress->setMaximumWidth(120);
+    m_mainWindow->statusBar()->addPermanentWidget(m_geometryLabel);
+    m_mainWindow->statusBar()->addPermanentWidget(m_geometryProgress);
+
+    auto const show = [this](int npending)
+    {
+        m_geometryLabel->setVisible(npending > 0);
+        m_geometryProgress->setVisible(npending > 0);
+    };
+    RGeometryWorker & worker = RGeometryWorker::instance();
+    QObject::connect(&worker, &RGeometryWorker::pendingChanged, m_mainWindow, show);
+    show(worker.npending());
+}
+
 void RManager::setUpMenu()
 {
     m_mainWindow->setMenuBar(new QMenuBar(nullptr));
@@ -225,6 +248,7 @@ void RManager::setUpMenu()
             QString("Runtime parameters"),
             []()
             {
+                pybind11::gil_scoped_acquire const acquire;
                 static int64_t int64V = 5566;
                 static double doubleV = 77.88;
                 auto params = createParameters();
@@ -37,6 +37,8 @@
 #include <QMainWindow>
 #include <QMdiArea>
 #include <QMdiSubWindow>
+#include <QLabel>
+#include <QProgressBar>
 #include <QApplication>
 #include <Qt>
 
@@ -81,6 +83,7 @@ private:
     void setUpConsole();
     void setUpCentral();
     void setUpMenu();
+    void setUpStatus();
 
     bool m_already_setup = false;
 
@@ -94,6 +97,8 @@ private:
 
     RPythonConsoleDockWidget * m_pycon = nullptr;
     QMdiArea * m_mdiArea = nullptr;
+    QLabel * m_geometryLabel = nullptr;
+    QProgressBar * m_geometryProgress = nullptr;
 }; /* end class RManager */
 
 template <typename... Args>
@@ -27,12 +27,200 @@
  */
 
 #include <modmesh/view/RPythonConsoleDockWidget.hpp>
+#include <QCoreApplication>
+#include <QHBoxLayout>
 #include <QVBoxLayout>
 #include <QKeyEvent>
 
+#include <chrono>
+#include <iostream>
+
 namespace modmesh
 {
 
+RPythonConsoleWorker::RPythonConsoleWorker(QObject * parent)
+    : QObject(parent)
+{
+}
+
+RPythonConsoleWorker::~RPythonConsoleWorker()
+{
+    stop();
+}
+
+void RPythonConsoleWorker::submit(std::string code, bool redirect)
+{
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        if (m_stop)
+        {
+            return;
+        }
+        m_jobs.push_back(Job{std::move(code), redirect});
+    }
+    // The thread starts with the first command.
+    if (!m_thread.joinable())
+    {
+        m_thread = std::thread([this]()
+                               { run(); });
+    }
+    m_cond.notify_one();
+    ++m_npending;
+    emit pendingChanged(m_npending);
+}
+
+void RPythonConsoleWorker::cancel()
+{
+    if (0 == m_npending || !Py_IsInitialized())
+    {
+        return;
+    }
+    pybind11::gil_scoped_acquire const acquire;
+    if (0 != m_thread_ident)
+    {
+        PyThreadState_SetAsyncExc(m_thread_ident, PyExc_KeyboardInterrupt);
+    }
+}
+
+void RPythonConsoleWorker::stop()
+{
+    if (!m_thread.joinable())
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_stop = true;
+        m_jobs.clear();
+    }
+    m_cond.notify_one();
+    cancel();
+    // Keep serving the running command, which may wait for the GUI thread.
+    while (true)
+    {
+        QCoreApplication::processEvents();
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_cond.wait_for(lock, std::chrono::milliseconds(10), [this]()
+                            { return m_done; }))
+        {
+            break;
+        }
+    }
+    m_thread.join();
+}
+
+void RPythonConsoleWorker::run()
+{
+    while (true)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cond.wait(lock, [this]()
+                        { return m_stop || !m_jobs.empty(); });
+            if (m_stop)
+            {
+                break;
+            }
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+        execute(job);
+        QMetaObject::invokeMethod(
+            this,
+            [this]()
+            {
+                flushOutput();
+                --m_npending;
+                emit pendingChanged(m_npending);
+            },
+            Qt::QueuedConnection);
+    }
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_done = true;
+    }
+    m_cond.notify_all();
+}
+
+void RPythonConsoleWorker::execute(Job const & job)
+{
+    namespace py = pybind11;
+
+    py::gil_scoped_acquire const acquire;
+    m_thread_ident = PyThread_get_thread_ident();
+    py::module_ sys = py::module_::import("sys");
+    py::object stdout_backup;
+    py::object stderr_backup;
+    try
+    {
+        if (job.redirect)
+        {
+            py::object stream = py::module_::import("types").attr("SimpleNamespace")(
+                py::arg("write") = py::cpp_function(
+                    [this](std::string const & text)
+                    {
+                        write(text);
+                        return text.size();
+                    }),
+                py::arg("flush") = py::cpp_function([]() {}),
+                py::arg("isatty") = py::cpp_function([]()
+                                                     { return false; }));
+            stdout_backup = sys.attr("stdout");
+            stderr_backup = sys.attr("stderr");
+            sys.attr("stdout") = stream;
+            sys.attr("stderr") = stream;
+        }
+        python::Interpreter::instance().exec_code(job.code);
+    }
+    catch (py::error_already_set const & e)
+    {
+        std::cerr << e.what() << std::endl;
+    }
+    if (stdout_backup)
+    {
+        sys.attr("stdout") = stdout_backup;
+        sys.attr("stderr") = stderr_backup;
+    }
+    // Drop the cancellation that came after the command ended.
+    PyThreadState_SetAsyncExc(m_thread_ident, nullptr);
+    m_thread_ident = 0;
+}
+
+void RPythonConsoleWorker::write(std::string const & text)
+{
+    bool post = false;
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_output += text;
+        post = !m_output_posted;
+        m_output_posted = true;
+    }
+    // Writes before the GUI thread takes the output are sent together.
+    if (post)
+    {
+        QMetaObject::invokeMethod(
+            this,
+            [this]()
+            { flushOutput(); },
+            Qt::QueuedConnection);
+    }
+}
+
+void RPythonConsoleWorker::flushOutput()
+{
+    std::string text;
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        text.swap(m_output);
+        m_output_posted = false;
+    }
+    if (!text.empty())
+    {
+        emit output(QString::fromStdString(text));
+    }
+}
+
 void RPythonConsoleDockWidget::appendPastCommand(const std::string & code)
 {
     if (code.size() > 0)
@@ -81,6 +269,8 @@ RPythonConsoleDockWidget::RPythonConsoleDockWidget(const QString & title, QWidge
     : QDockWidget(title, parent, flags)
     , m_history_edit(new RPythonHistoryTextEdit)
     , m_command_edit(new RPythonCommandTextEdit)
+    , m_cancel_button(new QPushButton(QString("Cancel")))
+    , m_worker(new RPythonConsoleWorker(this))
     , m_python_redirect(Toggle::instance().fixed().get_python_redirect())
 {
     setWidget(new QWidget);
@@ -99,13 +289,43 @@ RPythonConsoleDockWidget::RPythonConsoleDockWidget(const QString & title, QWidge
     m_command_edit->setPlainText(QString(""));
     m_command_edit->setFixedHeight(40);
     m_command_edit->setPalette(pal);
-    widget()->layout()->addWidget(m_command_edit);
+
+    m_cancel_button->setToolTip(QString("Interrupt the running command"));
+    m_cancel_button->setEnabled(false);
+
+    {
+        auto * row = new QWidget;
+        auto * layout = new QHBoxLayout;
+        layout->setContentsMargins(0, 0, 0, 0);
+        layout->addWidget(m_command_edit);
+        layout->addWidget(m_cancel_button);
+        row->setLayout(layout);
+        widget()->layout()->addWidget(row);
+    }
 
     widget()->setAutoFillBackground(true);
     widget()->setPalette(pal);
 
     connect(m_command_edit, &RPythonCommandTextEdit::execute, this, &RPythonConsoleDockWidget::executeCommand);
     connect(m_command_edit, &RPythonCommandTextEdit::navigate, this, &RPythonConsoleDockWidget::navigateCommand);
+    connect(m_cancel_button, &QPushButton::clicked, this, &RPythonConsoleDockWidget::cancelCommand);
+    connect(
+        m_worker,
+        &RPythonConsoleWorker::output,
+        this,
+        [this](QString const & text)
+        { writeToHistory(text.toStdString()); });
+    connect(
+        m_worker,
+        &RPythonConsoleWorker::pendingChanged,
+        m_cancel_button,
+        [this](int npending)
+        { m_cancel_button->setEnabled(npending > 0); });
+    // The running command must end before the interpreter is finalized.
+    if (QCoreApplication * app = QCoreApplication::instance())
+    {
+        connect(app, &QCoreApplication::aboutToQuit, m_worker, &RPythonConsoleWorker::stop);
+    }
 }
 
 QString RPythonConsoleDockWidget::command() const
@@ -138,16 +358,14 @@ void RPythonConsoleDockWidget::executeCommand()
     m_command_edit->setPlainText("");
     m_command_string = "";
     m_current_command_index = static_cast<int>(m_past_command_strings.size());
-    auto & interp = modmesh::python::Interpreter::instance();
 
-    m_python_redirect.activate();
-    interp.exec_code(code);
-    if (m_python_redirect.is_activated())
-    {
-        printCommandStdout(m_python_redirect.stdout_string());
-        printCommandStderr(m_python_redirect.stderr_string());
-    }
-    m_python_redirect.deactivate();
+    // Run on the worker thread to keep the GUI responsive.
+    m_worker->submit(code, m_python_redirect.is_enabled());
+}
+
+void RPythonConsoleDockWidget::cancelCommand()
+{
+    m_worker->cancel();
 }
 
 void RPythonConsoleDockWidget::printCommandHistory()
@@ -171,26 +389,6 @@ void RPythonConsoleDockWidget::printCommandHistory()
     m_history_edit->setTextCursor(cursor);
 }
 
-void RPythonConsoleDockWidget::printCommandStdout(const std::string & stdout_message)
-{
-    QTextCursor cursor = m_history_edit->textCursor();
-    cursor.movePosition(QTextCursor::End);
-    m_history_edit->setTextCursor(cursor);
-    m_history_edit->insertPlainText(QString::fromStdString(stdout_message));
-    cursor.movePosition(QTextCursor::End);
-    m_history_edit->setTextCursor(cursor);
-}
-
-void RPythonConsoleDockWidget::printCommandStderr(const std::string & stderr_message)
-{
-    QTextCursor cursor = m_history_edit->textCursor();
-    cursor.movePosition(QTextCursor::End);
-    m_history_edit->setTextCursor(cursor);
-    m_history_edit->insertPlainText(QString::fromStdString(stderr_message));
-    cursor.movePosition(QTextCursor::End);
-    m_history_edit->setTextCursor(cursor);
-}
-
 void RPythonConsoleDockWidget::navigateCommand(int offset)
 {
     int const cmdsize = static_cast<int>(m_past_command_strings.size()); // make msc happy.
@@ -34,9 +34,13 @@
 #include <deque>
 #include <stdexcept>
 #include <fstream>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 #include <Qt>
 #include <QDockWidget>
+#include <QPushButton>
 #include <QTextEdit>
 
 namespace modmesh
@@ -71,6 +75,74 @@ class RPythonHistoryTextEdit
     }
 }; /* end class RPythonHistoryTextEdit */
 
+/**
+ * The thread that runs the commands of the console, so that the GUI thread
+ * keeps drawing while they run.  The commands run one at a time in the order
+ * of submission, and hold the GIL only when running Python.  Their output is
+ * queued back to the GUI thread as it is written.
+ */
+class RPythonConsoleWorker
+    : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    explicit RPythonConsoleWorker(QObject * parent = nullptr);
+
+    RPythonConsoleWorker(RPythonConsoleWorker const &) = delete;
+    RPythonConsoleWorker(RPythonConsoleWorker &&) = delete;
+    RPythonConsoleWorker & operator=(RPythonConsoleWorker const &) = delete;
+    RPythonConsoleWorker & operator=(RPythonConsoleWorker &&) = delete;
+    ~RPythonConsoleWorker() override;
+
+    /// Queue the code to run.  With redirect, sys.stdout and sys.stderr go to
+    /// the output signal while it runs.
+    void submit(std::string code, bool redirect);
+
+    /// Raise KeyboardInterrupt in the running command.  It takes effect at
+    /// the next Python statement, after a call into C++ returns.
+    void cancel();
+
+    /// Drop the queued commands, cancel the running one, and wait for it.
+    void stop();
+
+    /// Number of the commands submitted and not finished.
+    int npending() const { return m_npending; }
+
+signals:
+
+    void output(QString const & text);
+    void pendingChanged(int npending);
+
+private:
+
+    struct Job
+    {
+        std::string code;
+        bool redirect = false;
+    }; /* end struct Job */
+
+    void run();
+    void execute(Job const & job);
+    void write(std::string const & text);
+    void flushOutput();
+
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::deque<Job> m_jobs;
+    bool m_stop = false;
+    bool m_done = false;
+    std::string m_output;
+    bool m_output_posted = false;
+    // Guarded by the GIL.
+    unsigned long m_thread_ident = 0;
+    // Only touched on the GUI thread.
+    int m_npending = 0;
+    std::thread m_thread;
+
+}; /* end class RPythonConsoleWorker */
+
 class RPythonConsoleDockWidget
     : public QDockWidget
 {
@@ -99,18 +171,18 @@ public slots:
 
     void setCommand(QString const & value);
     void executeCommand();
+    void cancelCommand();
     void navigateCommand(int offset);
 
 private:
 
     void appendPastCommand(std::string const & code);
-    void printCommandOutput();
     void printCommandHistory();
-    void printCommandStdout(const std::string & stdout_message);
-    void printCommandStderr(const std::string & stderr_message);
 
     RPythonHistoryTextEdit * m_history_edit = nullptr;
     RPythonCommandTextEdit * m_command_edit = nullptr;
+    QPushButton * m_cancel_button = nullptr;
+    RPythonConsoleWorker * m_worker = nullptr;
     std::string m_command_string;
     std::deque<std::string> m_past_command_strings;
     int m_current_command_index = 0;
@@ -30,66 +30,477 @@
 
 #include <modmesh/view/common_detail.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
 namespace modmesh
 {
 
 RStaticMesh::RStaticMesh(std::shared_ptr<StaticMesh> const & static_mesh, Qt3DCore::QNode * parent)
+    : RStaticMesh(static_mesh, nullptr, parent)
+{
+}
+
+RStaticMesh::RStaticMesh(std::shared_ptr<StaticMeshFp32> const & static_mesh, Qt3DCore::QNode * parent)
+    : RStaticMesh(nullptr, static_mesh, parent)
+{
+}
+
+RStaticMesh::RStaticMesh(
+    std::shared_ptr<StaticMesh> const & mesh,
+    std::shared_ptr<StaticMeshFp32> const & mesh_fp32,
+    Qt3DCore::QNode * parent)
     : Qt3DCore::QEntity(parent)
+    , m_mesh(mesh)
+    , m_mesh_fp32(mesh_fp32)
     , m_geometry(new Qt3DCore::QGeometry(this))
     , m_renderer(new Qt3DRender::QGeometryRenderer())
     , m_material(new Qt3DExtras::QDiffuseSpecularMaterial())
 {
-    update_geometry(*static_mesh);
+    {
+        // The Qt node (vertex) coordinate buffer.
+        m_vertices = new Qt3DCore::QAttribute(m_geometry);
+        m_vertices->setName(Qt3DCore::QAttribute::defaultPositionAttributeName());
+        m_vertices->setAttributeType(Qt3DCore::QAttribute::VertexAttribute);
+        m_vertices->setVertexBaseType(Qt3DCore::QAttribute::Float);
+        m_vertices->setVertexSize(3);
+        m_vertices->setByteStride(3 * sizeof(float));
+        m_vertex_buffer = new Qt3DCore::QBuffer(m_geometry);
+        m_vertices->setBuffer(m_vertex_buffer);
+        m_geometry->addAttribute(m_vertices);
+    }
+    {
+        // The Qt node index buffer.
+        m_indices = new Qt3DCore::QAttribute(m_geometry);
+        m_indices->setVertexBaseType(Qt3DCore::QAttribute::UnsignedInt);
+        m_indices->setAttributeType(Qt3DCore::QAttribute::IndexAttribute);
+        m_index_buffer = new Qt3DCore::QBuffer(m_geometry);
+        m_indices->setBuffer(m_index_buffer);
+        m_geometry->addAttribute(m_indices);
+    }
+
+    update_geometry();
     m_renderer->setGeometry(m_geometry);
     m_renderer->setPrimitiveType(Qt3DRender::QGeometryRenderer::Lines);
     addComponent(m_renderer);
     addComponent(m_material);
 }
 
-void RStaticMesh::update_geometry_impl(StaticMesh const & mh, Qt3DCore::QGeometry * geom)
+RStaticMesh::Source RStaticMesh::make_source() const
+{
+    Source ret;
+    auto const fill = [&ret](auto const & mh)
+    {
+        ret.nnode = mh.nnode();
+        ret.ndim = mh.ndim();
+        ret.nedge = mh.nedge();
+        ret.ndcrd_holder = mh.ndcrd().buffer().shared_from_this();
+        ret.ednds_holder = mh.ednds().buffer().shared_from_this();
+        ret.ednds = 0 == ret.nedge ? nullptr : &mh.ednds()(0, 0);
+    };
+    if (m_mesh)
+    {
+        fill(*m_mesh);
+        ret.ndcrd = 0 == ret.nnode ? nullptr : &m_mesh->ndcrd()(0, 0);
+    }
+    else
+    {
+        fill(*m_mesh_fp32);
+        ret.ndcrd_fp32 = 0 == ret.nnode ? nullptr : &m_mesh_fp32->ndcrd()(0, 0);
+    }
+    return ret;
+}
+
+void RStaticMesh::update_geometry()
 {
+    if (0 != m_request && m_level < 0)
     {
-        // Build the Qt node (vertex) coordinate buffer.
-        auto * vertices = new Qt3DCore::QAttribute(geom);
+        Source const source = make_source();
+        if (source.ndcrd_holder->epoch() == m_ndcrd_epoch && source.ednds_holder->epoch() == m_ednds_epoch)
+        {
+            return;
+        }
+    }
+    request_geometry(-1);
+}
 
-        vertices->setName(Qt3DCore::QAttribute::defaultPositionAttributeName());
-        vertices->setAttributeType(Qt3DCore::QAttribute::VertexAttribute);
-        vertices->setVertexBaseType(Qt3DCore::QAttribute::Float);
-        vertices->setVertexSize(3);
-        auto * buf = new Qt3DCore::QBuffer(geom);
+void RStaticMesh::request_geometry(int level)
+{
+    uint64_t const token = ++m_request;
+    m_level = level;
+    Source source = make_source();
+    m_ndcrd_epoch = source.ndcrd_holder->epoch();
+    m_ednds_epoch = source.ednds_holder->epoch();
+    RGeometryWorker::instance().submit(
+        this,
+        level < 0 ? "RStaticMesh::prepare_mesh" : "RStaticMesh::prepare_lod",
+        [source = std::move(source), lod = m_lod, level, vertices = std::move(m_vertex_bytes), last_indices = m_index_bytes]() mutable
+        {
+            return level < 0 ? prepare_mesh(source, std::move(vertices), last_indices)
+                             : prepare_lod(source, *lod, level, std::move(vertices), last_indices);
+        },
+        [this, token](RGeometryBytes && bytes)
         {
-            // Copy mesh node coordinates into the Qt buffer.
-            QByteArray barray;
-            barray.resize(mh.nnode() * 3 * sizeof(float));
-            SimpleArray<float> sarr = makeSimpleArray<float>(barray, small_vector<size_t>{mh.nnode(), 3}, /*view*/ true);
-            for (uint32_t ind = 0; ind < mh.nnode(); ++ind)
+            if (token != m_request)
+            {
+                return;
+            }
+            bytes.apply(m_vertices, m_vertex_buffer, m_indices, m_index_buffer);
+            m_vertex_bytes = std::move(bytes.vertices);
+            if (!bytes.same_indices)
             {
-                sarr(ind, 0) = mh.ndcrd(ind, 0);
-                sarr(ind, 1) = mh.ndcrd(ind, 1);
-                sarr(ind, 2) = (3 == mh.ndim()) ? mh.ndcrd(ind, 2) : 0;
+                m_index_bytes = std::move(bytes.indices);
             }
-            buf->setData(barray);
+        });
+}
+
+void RStaticMesh::enable_lod()
+{
+    if (m_lod_requested || !m_mesh)
+    {
+        return;
+    }
+    m_lod_requested = true;
+    RGeometryWorker::instance().submit(
+        this,
+        "RStaticMesh::build_lod",
+        [mesh = m_mesh]()
+        { return std::shared_ptr<StaticMeshLod const>(std::make_shared<StaticMeshLod const>(mesh)); },
+        [this](std::shared_ptr<StaticMeshLod const> && lod)
+        {
+            m_lod = std::move(lod);
+            update_lod(m_lod_eye, m_lod_angle);
+        });
+}
+
+void RStaticMesh::update_lod(QVector3D const & eye, double angle)
+{
+    m_lod_eye = eye;
+    m_lod_angle = angle;
+    if (!m_lod)
+    {
+        return;
+    }
+    double distance2 = 0;
+    for (size_t idm = 0; idm < m_lod->lower().size(); ++idm)
+    {
+        double const gap = std::max({m_lod->lower()(idm) - eye[static_cast<int>(idm)], eye[static_cast<int>(idm)] - m_lod->upper()(idm), 0.0});
+        distance2 += gap * gap;
+    }
+    // The scalars of a field are for the nodes of the full mesh.
+    int const level = has_field() ? -1 : m_lod->select_level(std::sqrt(distance2), angle);
+    if (level != m_level)
+    {
+        request_geometry(level);
+    }
+}
+
+void RStaticMesh::show_field(
+    std::shared_ptr<SimpleArraySnapshot<double>> const & snapshot,
+    bool on_cell,
+    size_t column,
+    double vmin,
+    double vmax,
+    int interval)
+{
+    if (!snapshot)
+    {
+        throw std::invalid_argument("RStaticMesh::show_field: snapshot is null");
+    }
+    if (interval <= 0)
+    {
+        throw std::invalid_argument(Formatter() << "RStaticMesh::show_field: interval " << interval << " <= 0");
+    }
+
+    Field field;
+    field.snapshot = snapshot;
+    field.on_cell = on_cell;
+    field.column = column;
+    auto const fill = [&field, on_cell](auto const & mh)
+    {
+        field.nnode = mh.nnode();
+        field.ncell = mh.ncell();
+        if (on_cell)
+        {
+            StaticMeshAdjacency const & clnds = mh.clnds_csr();
+            field.offsets_holder = clnds.offsets.buffer().shared_from_this();
+            field.indices_holder = clnds.indices.buffer().shared_from_this();
+            field.offsets = clnds.offsets.data();
+            field.indices = clnds.indices.data();
         }
-        vertices->setBuffer(buf);
-        vertices->setByteStride(3 * sizeof(float));
-        vertices->setCount(mh.nnode());
+    };
+    if (m_mesh)
+    {
+        fill(*m_mesh);
+    }
+    else
+    {
+        fill(*m_mesh_fp32);
+    }
+    m_field = std::move(field);
+    ++m_field_request;
+    m_field_polling = false;
+
+    if (!m_field_material)
+    {
+        m_scalars = new Qt3DCore::QAttribute(m_geometry);
+        m_scalars->setName(QString(RFieldMaterial::SCALAR_ATTRIBUTE_NAME));
+        m_scalars->setAttributeType(Qt3DCore::QAttribute::VertexAttribute);
+        m_scalars->setVertexBaseType(Qt3DCore::QAttribute::Float);
+        m_scalars->setVertexSize(1);
+        m_scalars->setByteStride(sizeof(float));
+        m_scalar_buffer = new Qt3DCore::QBuffer(m_geometry);
+        m_scalars->setBuffer(m_scalar_buffer);
+        m_geometry->addAttribute(m_scalars);
 
-        geom->addAttribute(vertices);
+        m_field_material = new RFieldMaterial(this);
+        m_field_timer = new QTimer(this);
+        connect(m_field_timer, &QTimer::timeout, this, &RStaticMesh::poll_field);
+    }
+    m_field_auto_range = !(vmin < vmax);
+    if (!m_field_auto_range)
+    {
+        m_field_material->set_range(static_cast<float>(vmin), static_cast<float>(vmax));
+    }
+    // Wait for the first snapshot with the plain material, whose scalars may
+    // not match the nodes yet.
+    removeComponent(m_field_material);
+    addComponent(m_material);
+    if (m_level >= 0)
+    {
+        request_geometry(-1);
     }
+    m_field_timer->start(interval);
+    poll_field();
+}
+
+void RStaticMesh::hide_field()
+{
+    if (!has_field())
+    {
+        return;
+    }
+    m_field = Field();
+    ++m_field_request;
+    m_field_polling = false;
+    m_field_timer->stop();
+    removeComponent(m_field_material);
+    addComponent(m_material);
+    update_lod(m_lod_eye, m_lod_angle);
+}
 
+void RStaticMesh::poll_field()
+{
+    if (m_field_polling || !has_field())
     {
-        // Build the Qt node index buffer.
-        auto * indices = new Qt3DCore::QAttribute(geom);
+        return;
+    }
+    m_field_polling = true;
+    uint64_t const token = m_field_request;
+    RGeometryWorker::instance().submit(
+        this,
+        "RStaticMesh::prepare_field",
+        [field = m_field, scalars = std::move(m_scalar_bytes)]() mutable
+        { return prepare_field(field, std::move(scalars)); },
+        [this, token](FieldBytes && bytes)
+        {
+            if (token != m_field_request)
+            {
+                return;
+            }
+            m_field_polling = false;
+            if (bytes.changed)
+            {
+                m_scalar_buffer->setData(bytes.scalars);
+                RViewStats::instance().add_upload(static_cast<size_t>(bytes.scalars.size()));
+                m_scalars->setCount(static_cast<uint>(m_field.nnode));
+                if (m_field_auto_range)
+                {
+                    m_field_material->set_range(bytes.vmin, bytes.vmax);
+                }
+                if (!components().contains(m_field_material))
+                {
+                    removeComponent(m_material);
+                    addComponent(m_field_material);
+                }
+            }
+            m_scalar_bytes = std::move(bytes.scalars);
+        });
+}
 
-        indices->setVertexBaseType(Qt3DCore::QAttribute::UnsignedInt);
-        indices->setAttributeType(Qt3DCore::QAttribute::IndexAttribute);
-        auto * buf = new Qt3DCore::QBuffer(geom);
-        buf->setData(makeQByteArray(mh.ednds()));
-        indices->setBuffer(buf);
-        indices->setCount(mh.nedge() * 2);
+RStaticMesh::FieldBytes RStaticMesh::prepare_field(Field const & field, QByteArray && scalars)
+{
+    FieldBytes ret;
+    ret.scalars = std::move(scalars);
+    // Report an unfit field here; the next snapshot may fit.
+    try
+    {
+        if (!field.snapshot->acquire())
+        {
+            return ret;
+        }
+        SimpleArray<double> const & values = field.snapshot->front();
+        size_t const nvalue = field.on_cell ? field.ncell : field.nnode;
+        size_t const nrow = 0 == values.ndim() ? 0 : values.shape(0);
+        size_t const ncolumn = 0 == nrow ? 0 : values.size() / nrow;
+        if (nrow != nvalue || field.column >= ncolumn)
+        {
+            throw std::out_of_range(
+                Formatter() << "RStaticMesh: the field of " << nrow << " rows and " << ncolumn
+                            << " columns has no column " << field.column << " for " << nvalue
+                            << (field.on_cell ? " cells" : " nodes"));
+        }
 
-        geom->addAttribute(indices);
+        size_t const nnode = field.nnode;
+        ret.scalars.resize(static_cast<qsizetype>(nnode * sizeof(float)));
+        auto * out = reinterpret_cast<float *>(ret.scalars.data());
+        double const * data = values.data() + field.column;
+        if (field.on_cell)
+        {
+            // Average the values of the cells around each node.
+            std::fill_n(out, nnode, 0.0f);
+            std::vector<uint32_t> count(nnode, 0);
+            for (size_t icl = 0; icl < field.ncell; ++icl)
+            {
+                float const value = static_cast<float>(data[icl * ncolumn]);
+                for (uint64_t it = field.offsets[icl]; it < field.offsets[icl + 1]; ++it)
+                {
+                    size_t const ind = static_cast<size_t>(field.indices[it]);
+                    out[ind] += value;
+                    ++count[ind];
+                }
+            }
+            for (size_t ind = 0; ind < nnode; ++ind)
+            {
+                out[ind] = 0 == count[ind] ? 0.0f : out[ind] / static_cast<float>(count[ind]);
+            }
+        }
+        else
+        {
+            for (size_t ind = 0; ind < nnode; ++ind)
+            {
+                out[ind] = static_cast<float>(data[ind * ncolumn]);
+            }
+        }
+        if (nnode > 0)
+        {
+            auto const [lo, hi] = std::minmax_element(out, out + nnode);
+            ret.vmin = *lo;
+            ret.vmax = *hi;
+        }
+        ret.changed = true;
+    }
+    catch (std::exception const & e)
+    {
+        qWarning("%s", e.what());
+    }
+    return ret;
+}
+
+RGeometryBytes RStaticMesh::prepare_mesh(Source const & source, QByteArray && vertices, QByteArray const & last_indices)
+{
+    RGeometryBytes ret;
+
+    // Convert the node coordinates straight into the vertex bytes.
+    // Resizing to the same size keeps the allocation; it is copied only when
+    // Qt still shares the bytes of the previous update.
+    size_t const nnode = source.nnode;
+    size_t const ndim = source.ndim;
+    vertices.resize(static_cast<qsizetype>(nnode * 3 * sizeof(float)));
+    auto * out = reinterpret_cast<float *>(vertices.data());
+    auto const convert = [nnode, ndim, out](auto const * crd)
+    {
+        parallel_for_chunks(
+            nnode,
+            ThreadPool::instance().use_parallel(nnode),
+            [crd, out, ndim](size_t begin, size_t end)
+            {
+                if (3 == ndim)
+                {
+                    // The same layout; the copy vectorizes, and it is a plain
+                    // memory copy for the float coordinates.
+                    std::copy(crd + begin * 3, crd + end * 3, out + begin * 3);
+                }
+                else
+                {
+                    for (size_t ind = begin; ind < end; ++ind)
+                    {
+                        out[ind * 3] = static_cast<float>(crd[ind * ndim]);
+                        out[ind * 3 + 1] = static_cast<float>(crd[ind * ndim + 1]);
+                        out[ind * 3 + 2] = 0;
+                    }
+                }
+            });
+    };
+    if (source.ndcrd_fp32)
+    {
+        convert(source.ndcrd_fp32);
+    }
+    else
+    {
+        convert(source.ndcrd);
+    }
+    ret.vertices = std::move(vertices);
+    ret.nvertex = nnode;
+
+    // Copy the edges only when the topology changed.
+    auto const nbytes = static_cast<qsizetype>(source.nedge * 2 * sizeof(int32_t));
+    char const * data = reinterpret_cast<char const *>(source.ednds);
+    ret.nindex = source.nedge * 2;
+    ret.same_indices = last_indices.size() == nbytes && (0 == nbytes || 0 == std::memcmp(last_indices.constData(), data, nbytes));
+    if (!ret.same_indices)
+    {
+        ret.indices = QByteArray(data, nbytes);
+    }
+    return ret;
+}
+
+RGeometryBytes RStaticMesh::prepare_lod(Source const & source, StaticMeshLod const & lod, int level, QByteArray && vertices, QByteArray const & last_indices)
+{
+    SimpleArray<int32_t> const & bnodes = lod.boundary_nodes();
+    SimpleArray<int32_t> const & bedges = lod.boundary_edges();
+    SimpleArray<double> const & cnodes = lod.level_nodes(static_cast<size_t>(level));
+    SimpleArray<int32_t> const & cedges = lod.level_edges(static_cast<size_t>(level));
+    size_t const ndim = source.ndim;
+    size_t const nbnode = bnodes.size();
+    size_t const nvertex = nbnode + cnodes.shape(0);
+    size_t const nedge = bedges.shape(0) + cedges.shape(0);
+    RGeometryBytes ret;
+
+    {
+        vertices.resize(static_cast<qsizetype>(nvertex * 3 * sizeof(float)));
+        auto * out = reinterpret_cast<float *>(vertices.data());
+        for (size_t ivx = 0; ivx < nvertex; ++ivx)
+        {
+            double const * crd = ivx < nbnode ? source.ndcrd + static_cast<size_t>(bnodes(ivx)) * ndim
+                                              : &cnodes(ivx - nbnode, 0);
+            out[ivx * 3] = static_cast<float>(crd[0]);
+            out[ivx * 3 + 1] = static_cast<float>(crd[1]);
+            out[ivx * 3 + 2] = 3 == ndim ? static_cast<float>(crd[2]) : 0.0f;
+        }
+        ret.vertices = std::move(vertices);
+        ret.nvertex = nvertex;
+    }
+
+    {
+        QByteArray indices(static_cast<qsizetype>(nedge * 2 * sizeof(uint32_t)), Qt::Uninitialized);
+        auto * out = reinterpret_cast<uint32_t *>(indices.data());
+        for (size_t ied = 0; ied < bedges.shape(0); ++ied)
+        {
+            *out++ = static_cast<uint32_t>(bedges(ied, 0));
+            *out++ = static_cast<uint32_t>(bedges(ied, 1));
+        }
+        for (size_t ied = 0; ied < cedges.shape(0); ++ied)
+        {
+            *out++ = static_cast<uint32_t>(nbnode + cedges(ied, 0));
+            *out++ = static_cast<uint32_t>(nbnode + cedges(ied, 1));
+        }
+        ret.nindex = nedge * 2;
+        ret.set_indices(std::move(indices), last_indices);
     }
+    return ret;
 }
 
 } /* end namespace modmesh */
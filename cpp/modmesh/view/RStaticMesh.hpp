@@ -31,6 +31,8 @@
 #include <modmesh/view/common_detail.hpp> // Must be the first include.
 
 #include <modmesh/modmesh.hpp>
+#include <modmesh/view/RGeometryWorker.hpp>
+#include <modmesh/view/RFieldMaterial.hpp>
 
 #include <Qt>
 #include <QWidget>
@@ -38,6 +40,8 @@
 
 #include <QByteArray>
 #include <QGeometryRenderer>
+#include <QTimer>
+#include <QVector3D>
 
 #include <Qt3DCore/QBuffer>
 #include <Qt3DCore/QEntity>
@@ -57,20 +61,173 @@ class RStaticMesh
 public:
 
     RStaticMesh(std::shared_ptr<StaticMesh> const & static_mesh, Qt3DCore::QNode * parent = nullptr);
+    /// The float coordinates are uploaded without conversion.
+    RStaticMesh(std::shared_ptr<StaticMeshFp32> const & static_mesh, Qt3DCore::QNode * parent = nullptr);
+
+    RStaticMesh() = delete;
+    RStaticMesh(RStaticMesh const &) = delete;
+    RStaticMesh(RStaticMesh &&) = delete;
+    RStaticMesh & operator=(RStaticMesh const &) = delete;
+    RStaticMesh & operator=(RStaticMesh &&) = delete;
+    ~RStaticMesh() override = default;
+
+    /**
+     * Draw the full mesh.  The bytes of the buffers are prepared on the
+     * geometry worker, and the previous geometry stays until they arrive.
+     * Nothing is requested when the full mesh is drawn from the coordinate
+     * and edge arrays of the same epochs.
+     */
+    void update_geometry();
+
+    /**
+     * Build the levels of detail of the mesh on the geometry worker.  Once
+     * they are ready, update_lod() draws the boundary and a clustered proxy
+     * of the interior in place of the full mesh when the camera is far.  The
+     * mesh should not be rebuilt meanwhile.  The levels of detail are
+     * built for StaticMesh only, and this does nothing for StaticMeshFp32.
+     */
+    void enable_lod();
+    bool has_lod() const { return bool(m_lod); }
+
+    /**
+     * Choose the level of detail by the distance from the eye to the
+     * bounding box of the mesh, so that the clusters subtend no more than
+     * angle.  The eye and the angle are kept for when the levels are not
+     * ready yet.
+     */
+    void update_lod(QVector3D const & eye, double angle);
+
+    /**
+     * Color the mesh by a column of the field published to the snapshot,
+     * e.g., by a solver marching on another thread.  The snapshot is polled
+     * every interval milliseconds, and a new one is converted on the
+     * geometry worker, so that neither the solver nor the GUI waits.
+     *
+     * The field is in the shape of (nnode, ...) or, when on_cell is true,
+     * (ncell, ...) of the body cells, whose values are averaged to the
+     * nodes.  vmin and vmax are the range of the colormap; the range of
+     * each snapshot is used when vmin is not less than vmax.  The levels of
+     * detail are not drawn while a field is shown.
+     */
+    void show_field(
+        std::shared_ptr<SimpleArraySnapshot<double>> const & snapshot,
+        bool on_cell,
+        size_t column,
+        double vmin,
+        double vmax,
+        int interval);
+    /// Stop polling and draw the mesh with the plain material.
+    void hide_field();
+    bool has_field() const { return bool(m_field.snapshot); }
 
-    void update_geometry(StaticMesh const & mh)
+private:
+
+    RStaticMesh(
+        std::shared_ptr<StaticMesh> const & mesh,
+        std::shared_ptr<StaticMeshFp32> const & mesh_fp32,
+        Qt3DCore::QNode * parent);
+
+    /**
+     * The arrays of the mesh read by the worker.  Their buffers are held so
+     * that rebuilding the mesh meanwhile does not free them.
+     */
+    struct Source
+    {
+        std::shared_ptr<ConcreteBuffer const> ndcrd_holder;
+        std::shared_ptr<ConcreteBuffer const> ednds_holder;
+        // Only one of the coordinate pointers is set.
+        double const * ndcrd = nullptr;
+        float const * ndcrd_fp32 = nullptr;
+        int32_t const * ednds = nullptr;
+        size_t nnode = 0;
+        size_t ndim = 0;
+        size_t nedge = 0;
+    }; /* end struct Source */
+
+    Source make_source() const;
+
+    /// The field shown and what the worker needs to map it to the nodes.
+    struct Field
+    {
+        std::shared_ptr<SimpleArraySnapshot<double>> snapshot;
+        bool on_cell = false;
+        size_t column = 0;
+        size_t nnode = 0;
+        size_t ncell = 0;
+        // The nodes of each body cell, held like Source.
+        std::shared_ptr<ConcreteBuffer const> offsets_holder;
+        std::shared_ptr<ConcreteBuffer const> indices_holder;
+        uint64_t const * offsets = nullptr;
+        int32_t const * indices = nullptr;
+    }; /* end struct Field */
+
+    /// The scalar of each node, and their range.
+    struct FieldBytes
     {
-        update_geometry_impl(mh, m_geometry);
-    }
+        QByteArray scalars;
+        bool changed = false;
+        float vmin = 0;
+        float vmax = 0;
+    }; /* end struct FieldBytes */
 
-private:
+    /// Convert a new snapshot on the worker, one at a time.
+    void poll_field();
+    static FieldBytes prepare_field(Field const & field, QByteArray && scalars);
+
+    /// Prepare the full mesh (level -1) or a level of detail on the worker.
+    void request_geometry(int level);
 
-    static void update_geometry_impl(StaticMesh const & mh, Qt3DCore::QGeometry * geom);
+    /// Convert the node coordinates to float in the reused vertex bytes.
+    static RGeometryBytes prepare_mesh(Source const & source, QByteArray && vertices, QByteArray const & last_indices);
+    /// The boundary nodes followed by the clusters of the level.
+    static RGeometryBytes prepare_lod(Source const & source, StaticMeshLod const & lod, int level, QByteArray && vertices, QByteArray const & last_indices);
+
+    // Only one of the meshes is set.
+    std::shared_ptr<StaticMesh const> m_mesh;
+    std::shared_ptr<StaticMeshFp32 const> m_mesh_fp32;
 
     Qt3DCore::QGeometry * m_geometry = nullptr;
+    // The attributes and buffers are created once and refilled by
+    // request_geometry().
+    Qt3DCore::QAttribute * m_vertices = nullptr;
+    Qt3DCore::QBuffer * m_vertex_buffer = nullptr;
+    Qt3DCore::QAttribute * m_indices = nullptr;
+    Qt3DCore::QBuffer * m_index_buffer = nullptr;
+    // The bytes last set to the buffers.  The vertex bytes are handed back to
+    // the worker to keep their allocation, and the index bytes tell whether
+    // the edges changed.
+    QByteArray m_vertex_bytes;
+    QByteArray m_index_bytes;
     Qt3DRender::QGeometryRenderer * m_renderer = nullptr;
     Qt3DRender::QMaterial * m_material = nullptr;
 
+    // Only the latest request is applied.
+    uint64_t m_request = 0;
+    // The level of the latest request; -1 for the full mesh.
+    int m_level = -1;
+    // The epochs of the arrays read by the latest request.
+    uint64_t m_ndcrd_epoch = 0;
+    uint64_t m_ednds_epoch = 0;
+
+    // Levels of detail.
+    bool m_lod_requested = false;
+    std::shared_ptr<StaticMeshLod const> m_lod;
+    QVector3D m_lod_eye;
+    double m_lod_angle = 0.0;
+
+    // Field.
+    Field m_field;
+    bool m_field_auto_range = false;
+    // A poll is on the worker.
+    bool m_field_polling = false;
+    // Drops the polls of a field replaced or hidden meanwhile.
+    uint64_t m_field_request = 0;
+    QTimer * m_field_timer = nullptr;
+    RFieldMaterial * m_field_material = nullptr;
+    Qt3DCore::QAttribute * m_scalars = nullptr;
+    Qt3DCore::QBuffer * m_scalar_buffer = nullptr;
+    QByteArray m_scalar_bytes;
+
 }; /* end class RStaticMesh */
 
 } /* end namespace modmesh */
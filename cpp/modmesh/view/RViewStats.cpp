@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/view/RViewStats.hpp> // Must be the first include.
+
+#include <iomanip>
+#include <sstream>
+
+namespace modmesh
+{
+
+RViewStats & RViewStats::instance()
+{
+    static RViewStats inst;
+    return inst;
+}
+
+void RViewStats::add_prepare(std::string const & name, double seconds)
+{
+    m_current.prepare_time += seconds;
+    TimeRegistry::me().add("RView::prepare::" + name, seconds);
+}
+
+void RViewStats::add_deliver(double seconds)
+{
+    m_current.deliver_time += seconds;
+    TimeRegistry::me().add("RView::deliver", seconds);
+}
+
+void RViewStats::add_frame(double seconds, size_t ndraw)
+{
+    m_current.nframe = m_last.nframe + 1;
+    m_current.time = seconds;
+    m_current.ndraw = ndraw;
+    m_total_upload_bytes += m_current.upload_bytes;
+    TimeRegistry::me().add("RView::frame", seconds);
+    m_last = m_current;
+    m_current = Frame();
+}
+
+std::string RViewStats::report() const
+{
+    std::ostringstream ostm;
+    ostm << std::fixed << std::setprecision(2)
+         << "frame " << m_last.nframe << ": " << m_last.time * 1.e3 << " ms"
+         << "\nprepare: " << m_last.prepare_time * 1.e3 << " ms"
+         << "\ndeliver: " << m_last.deliver_time * 1.e3 << " ms"
+         << "\nupload: " << m_last.upload_bytes / 1024.0 << " KiB"
+         << "\ndraw calls: " << m_last.ndraw;
+    return ostm.str();
+}
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,99 @@
+#pragma once
+
+/*
+ * Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its contributors
+ *   may be used to endorse or promote products derived from this software
+ *   without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <modmesh/view/common_detail.hpp> // Must be the first include.
+
+#include <string>
+
+namespace modmesh
+{
+
+/**
+ * Counters of the viewer, to tell the time of preparing the geometry on the
+ * worker, the bytes handed to Qt for upload, and the rendering apart.  The
+ * counts between two frames are charged to the later frame.  The times are
+ * also added to TimeRegistry under "RView::..." names.
+ *
+ * The counters are shared by all views.  All members are used on the GUI
+ * thread.
+ */
+class RViewStats
+{
+
+public:
+
+    /// The counts of a frame.
+    struct Frame
+    {
+        size_t nframe = 0;
+        /// Seconds since the previous frame.
+        double time = 0.0;
+        /// Seconds spent by the worker preparing the geometry delivered.
+        double prepare_time = 0.0;
+        /// Seconds spent on the GUI thread setting the prepared buffers.
+        double deliver_time = 0.0;
+        size_t upload_bytes = 0;
+        /// Geometry renderers enabled in the scene, one draw call each.
+        size_t ndraw = 0;
+    }; /* end struct Frame */
+
+    static RViewStats & instance();
+
+    RViewStats(RViewStats const &) = delete;
+    RViewStats(RViewStats &&) = delete;
+    RViewStats & operator=(RViewStats const &) = delete;
+    RViewStats & operator=(RViewStats &&) = delete;
+    ~RViewStats() = default;
+
+    void add_prepare(std::string const & name, double seconds);
+    void add_deliver(double seconds);
+    void add_upload(size_t nbytes) { m_current.upload_bytes += nbytes; }
+    /// Close the current frame.
+    void add_frame(double seconds, size_t ndraw);
+
+    /// The last closed frame.
+    Frame const & last() const { return m_last; }
+    size_t total_upload_bytes() const { return m_total_upload_bytes; }
+
+    std::string report() const;
+
+private:
+
+    RViewStats() = default;
+
+    Frame m_current;
+    Frame m_last;
+    size_t m_total_upload_bytes = 0;
+
+}; /* end class RViewStats */
+
+} /* end namespace modmesh */
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -30,16 +30,44 @@
 
 #include <modmesh/view/common_detail.hpp>
 
+#include <array>
+#include <limits>
+
 namespace modmesh
 {
 
-RWorld::RWorld(std::shared_ptr<WorldFp64> const & world, Qt3DCore::QNode * parent)
+RWorld::RWorld(std::shared_ptr<WorldFp64> const & world, Qt3DCore::QNode * parent, bool on_gpu, float pixel_tolerance)
     : Qt3DCore::QEntity(parent)
     , m_world(world)
     , m_geometry(new Qt3DCore::QGeometry(this))
     , m_renderer(new Qt3DRender::QGeometryRenderer())
     , m_material(new Qt3DExtras::QDiffuseSpecularMaterial())
 {
+    {
+        m_vertices = new Qt3DCore::QAttribute(m_geometry);
+        m_vertices->setName(Qt3DCore::QAttribute::defaultPositionAttributeName());
+        m_vertices->setAttributeType(Qt3DCore::QAttribute::VertexAttribute);
+        m_vertices->setVertexBaseType(Qt3DCore::QAttribute::Float);
+        m_vertices->setVertexSize(3);
+        m_vertices->setByteStride(3 * sizeof(float));
+        m_vertex_buffer = new Qt3DCore::QBuffer(m_geometry);
+        m_vertices->setBuffer(m_vertex_buffer);
+        m_geometry->addAttribute(m_vertices);
+    }
+    {
+        m_indices = new Qt3DCore::QAttribute(m_geometry);
+        m_indices->setVertexBaseType(Qt3DCore::QAttribute::UnsignedInt);
+        m_indices->setAttributeType(Qt3DCore::QAttribute::IndexAttribute);
+        m_index_buffer = new Qt3DCore::QBuffer(m_geometry);
+        m_indices->setBuffer(m_index_buffer);
+        m_geometry->addAttribute(m_indices);
+    }
+
+    if (on_gpu)
+    {
+        set_up_cubic(pixel_tolerance);
+    }
+
     update_geometry();
     m_renderer->setGeometry(m_geometry);
     m_renderer->setPrimitiveType(Qt3DRender::QGeometryRenderer::Lines);
@@ -47,97 +75,279 @@ RWorld::RWorld(std::shared_ptr<WorldFp64> const & world, Qt3DCore::QNode * paren
     addComponent(m_material);
 }
 
-void RWorld::update_geometry()
+void RWorld::set_up_cubic(float pixel_tolerance)
 {
-    size_t npoint = 0;
-    for (size_t i = 0; i < m_world->nbezier(); ++i)
+    m_cubic_entity = new Qt3DCore::QEntity(this);
+    auto * geometry = new Qt3DCore::QGeometry(m_cubic_entity);
+
     {
-        npoint += m_world->bezier(i).nlocus();
+        // The segment indices of the line strip drawn for each curve.
+        QByteArray bytes(static_cast<qsizetype>((RBezierMaterial::MAX_SEGMENT + 1) * sizeof(float)), Qt::Uninitialized);
+        auto * out = reinterpret_cast<float *>(bytes.data());
+        for (size_t i = 0; i <= RBezierMaterial::MAX_SEGMENT; ++i)
+        {
+            out[i] = static_cast<float>(i);
+        }
+        auto * buffer = new Qt3DCore::QBuffer(geometry);
+        buffer->setData(bytes);
+        auto * attribute = new Qt3DCore::QAttribute(geometry);
+        attribute->setName(QString(RBezierMaterial::SEGMENT_ATTRIBUTE_NAME));
+        attribute->setAttributeType(Qt3DCore::QAttribute::VertexAttribute);
+        attribute->setVertexBaseType(Qt3DCore::QAttribute::Float);
+        attribute->setVertexSize(1);
+        attribute->setByteStride(sizeof(float));
+        attribute->setCount(RBezierMaterial::MAX_SEGMENT + 1);
+        attribute->setBuffer(buffer);
+        geometry->addAttribute(attribute);
     }
 
-    /* Fence the geometry building code to prevent the exception from Qt:
-     * "QByteArray size disagrees with the requested shape"
-     */
-    if (npoint > 0)
+    // The 4 control points of a curve are adjacent in the buffer and advance
+    // by instance.
+    m_cubic_buffer = new Qt3DCore::QBuffer(geometry);
+    for (size_t i = 0; i < 4; ++i)
     {
-        {
-            // Build the Qt node (vertex) coordinate buffer.
-            auto * vertices = new Qt3DCore::QAttribute(m_geometry);
+        auto * attribute = new Qt3DCore::QAttribute(geometry);
+        attribute->setName(QString(RBezierMaterial::CONTROL_ATTRIBUTE_NAMES[i]));
+        attribute->setAttributeType(Qt3DCore::QAttribute::VertexAttribute);
+        attribute->setVertexBaseType(Qt3DCore::QAttribute::Float);
+        attribute->setVertexSize(3);
+        attribute->setByteOffset(static_cast<uint>(i * 3 * sizeof(float)));
+        attribute->setByteStride(12 * sizeof(float));
+        attribute->setDivisor(1);
+        attribute->setBuffer(m_cubic_buffer);
+        geometry->addAttribute(attribute);
+    }
+
+    m_cubic_renderer = new Qt3DRender::QGeometryRenderer();
+    m_cubic_renderer->setGeometry(geometry);
+    m_cubic_renderer->setPrimitiveType(Qt3DRender::QGeometryRenderer::LineStrip);
+    m_cubic_renderer->setVertexCount(static_cast<int>(RBezierMaterial::MAX_SEGMENT + 1));
+    m_cubic_renderer->setInstanceCount(0);
+
+    // There is no position attribute to bound the curves, which are in the
+    // box of the control points.
+    m_cubic_bounds = new Qt3DCore::QBoundingVolume();
+
+    m_cubic_material = new RBezierMaterial();
+    m_cubic_material->set_pixel_tolerance(pixel_tolerance);
 
-            vertices->setName(Qt3DCore::QAttribute::defaultPositionAttributeName());
-            vertices->setAttributeType(Qt3DCore::QAttribute::VertexAttribute);
-            vertices->setVertexBaseType(Qt3DCore::QAttribute::Float);
-            vertices->setVertexSize(3);
+    m_cubic_entity->addComponent(m_cubic_renderer);
+    m_cubic_entity->addComponent(m_cubic_bounds);
+    m_cubic_entity->addComponent(m_cubic_material);
+}
 
-            auto * buf = new Qt3DCore::QBuffer(m_geometry);
+void RWorld::apply_cubic(RCubicBytes && bytes)
+{
+    m_cubic_buffer->setData(bytes.controls);
+    m_cubic_renderer->setInstanceCount(static_cast<int>(bytes.ncubic));
+    m_cubic_bounds->setMinPoint(bytes.lower);
+    m_cubic_bounds->setMaxPoint(bytes.upper);
+    RViewStats::instance().add_upload(static_cast<size_t>(bytes.controls.size()));
+    m_cubic_bytes = std::move(bytes.controls);
+}
+
+void RWorld::update_geometry()
+{
+    // Packing changes the world and stays on this thread.  The packed
+    // arrays are held for the worker in case the world is packed again.
+    m_world->pack_geometry();
+    WorldGeometryFp64 const & geom = m_world->geometry();
+    std::shared_ptr<ConcreteBuffer const> loci_holder = geom.loci.buffer().shared_from_this();
+    std::shared_ptr<ConcreteBuffer const> offsets_holder = geom.locus_offsets.buffer().shared_from_this();
+    std::shared_ptr<ConcreteBuffer const> control_offsets_holder = geom.control_offsets.buffer().shared_from_this();
+    double const * loci = geom.loci.data();
+    uint64_t const * offsets = geom.locus_offsets.data();
+    uint64_t const * control_offsets = geom.control_offsets.data();
+    size_t const nbezier = geom.nbezier();
+    size_t const max_gpu_control = on_gpu() ? 4 : 0;
+
+    uint64_t const token = ++m_request;
+    if (on_gpu())
+    {
+        std::shared_ptr<ConcreteBuffer const> controls_holder = geom.controls.buffer().shared_from_this();
+        double const * controls = geom.controls.data();
+        RGeometryWorker::instance().submit(
+            this,
+            "RWorld::prepare_cubic",
+            [controls_holder, control_offsets_holder, controls, control_offsets, nbezier, bytes = std::move(m_cubic_bytes)]() mutable
+            { return prepare_cubic(controls, control_offsets, nbezier, std::move(bytes)); },
+            [this, token](RCubicBytes && bytes)
             {
-                QByteArray barray;
-                barray.resize(npoint * 3 * sizeof(float));
-                SimpleArray<float> sarr = makeSimpleArray<float>(barray, small_vector<size_t>{npoint, 3}, /*view*/ true);
-                size_t ipt = 0;
-                for (size_t i = 0; i < m_world->nbezier(); ++i)
+                if (token == m_request)
                 {
-                    Bezier3dFp64 const & b = m_world->bezier(i);
-                    for (size_t j = 0; j < b.nlocus(); ++j)
-                    {
-                        Vector3dFp64 const & v = b.locus(j);
-                        sarr(ipt, 0) = v[0];
-                        sarr(ipt, 1) = v[1];
-                        sarr(ipt, 2) = v[2];
-                        ++ipt;
-                    }
+                    apply_cubic(std::move(bytes));
                 }
-                buf->setData(barray);
+            });
+    }
+    RGeometryWorker::instance().submit(
+        this,
+        "RWorld::prepare",
+        [loci_holder, offsets_holder, control_offsets_holder, loci, offsets, control_offsets, nbezier, max_gpu_control, vertices = std::move(m_vertex_bytes), last_indices = m_index_bytes]() mutable
+        { return prepare(loci, offsets, control_offsets, nbezier, max_gpu_control, std::move(vertices), last_indices); },
+        [this, token](RGeometryBytes && bytes)
+        {
+            if (token != m_request)
+            {
+                return;
             }
-            vertices->setBuffer(buf);
-            vertices->setByteStride(3 * sizeof(float));
-            vertices->setCount(npoint);
+            bytes.apply(m_vertices, m_vertex_buffer, m_indices, m_index_buffer);
+            m_vertex_bytes = std::move(bytes.vertices);
+            if (!bytes.same_indices)
+            {
+                m_index_bytes = std::move(bytes.indices);
+            }
+        });
+}
 
-            m_geometry->addAttribute(vertices);
-        }
+RCubicBytes RWorld::prepare_cubic(
+    double const * controls,
+    uint64_t const * control_offsets,
+    size_t nbezier,
+    QByteArray && bytes)
+{
+    RCubicBytes ret;
+    size_t const ncontrol = 0 == nbezier ? 0 : control_offsets[nbezier];
+    // The controls are in [3, ncontrol].
+    auto point = [&](size_t i)
+    {
+        return QVector3D(
+            static_cast<float>(controls[i]),
+            static_cast<float>(controls[ncontrol + i]),
+            static_cast<float>(controls[2 * ncontrol + i]));
+    };
 
+    size_t ncubic = 0;
+    for (size_t ib = 0; ib < nbezier; ++ib)
+    {
+        size_t const count = control_offsets[ib + 1] - control_offsets[ib];
+        ncubic += (count >= 2 && count <= 4) ? 1 : 0;
+    }
+    bytes.resize(static_cast<qsizetype>(ncubic * 12 * sizeof(float)));
+    auto * out = reinterpret_cast<float *>(bytes.data());
+    float const big = std::numeric_limits<float>::max();
+    QVector3D lower(big, big, big);
+    QVector3D upper(-big, -big, -big);
+    for (size_t ib = 0; ib < nbezier; ++ib)
+    {
+        size_t const begin = control_offsets[ib];
+        size_t const count = control_offsets[ib + 1] - begin;
+        if (count < 2 || count > 4)
+        {
+            continue;
+        }
+        std::array<QVector3D, 4> cubic;
+        // Raising the degree keeps the curve.
+        if (2 == count)
+        {
+            QVector3D const p0 = point(begin);
+            QVector3D const p1 = point(begin + 1);
+            cubic = {p0, (2.0f * p0 + p1) / 3.0f, (p0 + 2.0f * p1) / 3.0f, p1};
+        }
+        else if (3 == count)
+        {
+            QVector3D const p0 = point(begin);
+            QVector3D const p1 = point(begin + 1);
+            QVector3D const p2 = point(begin + 2);
+            cubic = {p0, (p0 + 2.0f * p1) / 3.0f, (2.0f * p1 + p2) / 3.0f, p2};
+        }
+        else
+        {
+            cubic = {point(begin), point(begin + 1), point(begin + 2), point(begin + 3)};
+        }
+        for (QVector3D const & p : cubic)
         {
-            // Build the Qt node index buffer.
-            auto * indices = new Qt3DCore::QAttribute(m_geometry);
+            *out++ = p.x();
+            *out++ = p.y();
+            *out++ = p.z();
+            lower = QVector3D(std::min(lower.x(), p.x()), std::min(lower.y(), p.y()), std::min(lower.z(), p.z()));
+            upper = QVector3D(std::max(upper.x(), p.x()), std::max(upper.y(), p.y()), std::max(upper.z(), p.z()));
+        }
+    }
+    ret.controls = std::move(bytes);
+    ret.ncubic = ncubic;
+    if (ncubic > 0)
+    {
+        ret.lower = lower;
+        ret.upper = upper;
+    }
+    return ret;
+}
+
+RGeometryBytes RWorld::prepare(
+    double const * loci,
+    uint64_t const * locus_offsets,
+    uint64_t const * control_offsets,
+    size_t nbezier,
+    size_t max_gpu_control,
+    QByteArray && vertices,
+    QByteArray const & last_indices)
+{
+    RGeometryBytes ret;
+    size_t const npoint = 0 == nbezier ? 0 : locus_offsets[nbezier];
+    // The curves drawn on the GPU are skipped.
+    auto on_gpu = [&](size_t ib)
+    { return control_offsets[ib + 1] - control_offsets[ib] <= max_gpu_control; };
 
-            indices->setVertexBaseType(Qt3DCore::QAttribute::UnsignedInt);
-            indices->setAttributeType(Qt3DCore::QAttribute::IndexAttribute);
+    size_t nvertex = 0;
+    size_t nedge = 0;
+    for (size_t ib = 0; ib < nbezier; ++ib)
+    {
+        size_t const count = locus_offsets[ib + 1] - locus_offsets[ib];
+        if (count > 0 && !on_gpu(ib))
+        {
+            nvertex += count;
+            nedge += count - 1;
+        }
+    }
 
-            size_t nedge = 0;
+    {
+        // The loci are in [3, npoint].  The kept curves are interleaved by
+        // runs, which is one run when none is skipped.
+        vertices.resize(static_cast<qsizetype>(nvertex * 3 * sizeof(float)));
+        auto * out = reinterpret_cast<float *>(vertices.data());
+        size_t ib = 0;
+        while (ib < nbezier)
+        {
+            if (on_gpu(ib))
             {
-                for (size_t i = 0; i < m_world->nbezier(); ++i)
-                {
-                    Bezier3dFp64 const & b = m_world->bezier(i);
-                    nedge += b.nlocus() - 1;
-                }
+                ++ib;
+                continue;
             }
-
-            auto * buf = new Qt3DCore::QBuffer(m_geometry);
+            size_t const begin = locus_offsets[ib];
+            while (ib < nbezier && !on_gpu(ib))
             {
-                QByteArray barray;
-                barray.resize(nedge * 2 * sizeof(uint32_t));
-                SimpleArray<uint32_t> sarr = makeSimpleArray<uint32_t>(barray, small_vector<size_t>{nedge, 2}, /*view*/ true);
-                size_t ied = 0;
-                size_t ipt = 0;
-                for (size_t i = 0; i < m_world->nbezier(); ++i)
-                {
-                    Bezier3dFp64 const & b = m_world->bezier(i);
-                    for (size_t j = 0; j < b.nlocus() - 1; ++j)
-                    {
-                        sarr(ied, 0) = ipt++;
-                        sarr(ied, 1) = ipt;
-                        ++ied;
-                    }
-                    ++ipt;
-                }
-                buf->setData(barray);
+                ++ib;
             }
-            indices->setBuffer(buf);
-            indices->setCount(nedge * 2);
+            size_t const count = locus_offsets[ib] - begin;
+            Vector3dArrayFp64::interleave({loci + begin, loci + npoint + begin, loci + 2 * npoint + begin}, count, out);
+            out += count * 3;
+        }
+        ret.vertices = std::move(vertices);
+        ret.nvertex = nvertex;
+    }
 
-            m_geometry->addAttribute(indices);
+    {
+        QByteArray indices(static_cast<qsizetype>(nedge * 2 * sizeof(uint32_t)), Qt::Uninitialized);
+        auto * out = reinterpret_cast<uint32_t *>(indices.data());
+        uint32_t base = 0;
+        for (size_t ib = 0; ib < nbezier; ++ib)
+        {
+            size_t const count = locus_offsets[ib + 1] - locus_offsets[ib];
+            if (0 == count || on_gpu(ib))
+            {
+                continue;
+            }
+            for (size_t ipt = 0; ipt + 1 < count; ++ipt)
+            {
+                *out++ = base + static_cast<uint32_t>(ipt);
+                *out++ = base + static_cast<uint32_t>(ipt + 1);
+            }
+            base += static_cast<uint32_t>(count);
         }
+        ret.nindex = nedge * 2;
+        ret.set_indices(std::move(indices), last_indices);
     }
+    return ret;
 }
 
 } /* end namespace modmesh */
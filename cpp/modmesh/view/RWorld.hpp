@@ -31,6 +31,8 @@
 #include <modmesh/view/common_detail.hpp> // Must be the first include.
 
 #include <modmesh/universe/universe.hpp>
+#include <modmesh/view/RBezierMaterial.hpp>
+#include <modmesh/view/RGeometryWorker.hpp>
 
 #include <Qt>
 #include <QWidget>
@@ -43,6 +45,7 @@
 #include <Qt3DCore/QEntity>
 #include <Qt3DCore/QGeometry>
 #include <Qt3DCore/QAttribute>
+#include <Qt3DCore/QBoundingVolume>
 #include <Qt3DCore/QTransform>
 
 #include <Qt3DExtras/QDiffuseSpecularMaterial>
@@ -50,6 +53,18 @@
 namespace modmesh
 {
 
+/**
+ * The control points of the cubic Bezier curves as float, 4 per curve, with
+ * their bounding box, prepared off the GUI thread.
+ */
+struct RCubicBytes
+{
+    QByteArray controls;
+    size_t ncubic = 0;
+    QVector3D lower;
+    QVector3D upper;
+}; /* end struct RCubicBytes */
+
 /**
  * Make a world viewable.
  */
@@ -59,23 +74,78 @@ class RWorld
 
 public:
 
-    RWorld(std::shared_ptr<WorldFp64> const & world, Qt3DCore::QNode * parent = nullptr);
+    /**
+     * With on_gpu, the curves of up to 4 control points are uploaded as
+     * control points and drawn by RBezierMaterial within pixel_tolerance,
+     * however the camera moves.  The curves of more control points are drawn
+     * by their loci.
+     */
+    RWorld(
+        std::shared_ptr<WorldFp64> const & world,
+        Qt3DCore::QNode * parent = nullptr,
+        bool on_gpu = false,
+        float pixel_tolerance = 1.0f);
 
     void set_world(std::shared_ptr<WorldFp64> const & world) { m_world = world; }
     bool has_world() const { return bool(m_world); }
     WorldFp64 const & world() const { return *m_world; }
     WorldFp64 & world() { return *m_world; }
 
+    /**
+     * Pack the geometry of the world and draw its loci.  The bytes of the
+     * buffers are prepared on the geometry worker, and the previous geometry
+     * stays until they arrive.
+     */
     void update_geometry();
 
+    bool on_gpu() const { return nullptr != m_cubic_material; }
+
 private:
 
+    /// Interleave the loci as float and connect the loci of each curve,
+    /// except those of up to max_gpu_control control points.
+    static RGeometryBytes prepare(
+        double const * loci,
+        uint64_t const * locus_offsets,
+        uint64_t const * control_offsets,
+        size_t nbezier,
+        size_t max_gpu_control,
+        QByteArray && vertices,
+        QByteArray const & last_indices);
+
+    /// Raise the degree of the curves of up to 4 control points to 3, and
+    /// write their control points as float.
+    static RCubicBytes prepare_cubic(
+        double const * controls,
+        uint64_t const * control_offsets,
+        size_t nbezier,
+        QByteArray && bytes);
+
+    void set_up_cubic(float pixel_tolerance);
+    void apply_cubic(RCubicBytes && bytes);
+
     std::shared_ptr<WorldFp64> m_world;
 
     Qt3DCore::QGeometry * m_geometry = nullptr;
+    Qt3DCore::QAttribute * m_vertices = nullptr;
+    Qt3DCore::QBuffer * m_vertex_buffer = nullptr;
+    Qt3DCore::QAttribute * m_indices = nullptr;
+    Qt3DCore::QBuffer * m_index_buffer = nullptr;
+    QByteArray m_vertex_bytes;
+    QByteArray m_index_bytes;
+    // Only the latest update is applied.
+    uint64_t m_request = 0;
     Qt3DRender::QGeometryRenderer * m_renderer = nullptr;
     Qt3DRender::QMaterial * m_material = nullptr;
 
+    // The instanced cubic curves drawn on the GPU.
+    Qt3DCore::QEntity * m_cubic_entity = nullptr;
+    Qt3DCore::QBuffer * m_cubic_buffer = nullptr;
+    QByteArray m_cubic_bytes;
+    Qt3DRender::QGeometryRenderer * m_cubic_renderer = nullptr;
+    Qt3DCore::QBoundingVolume * m_cubic_bounds = nullptr;
+    RBezierMaterial * m_cubic_material = nullptr;
+
 }; /* end class R3DWorld */
 
 } /* end namespace modmesh */
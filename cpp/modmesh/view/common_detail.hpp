@@ -36,6 +36,12 @@
 #include <modmesh/modmesh.hpp>
 
 #include <QByteArray>
+#include <QCoreApplication>
+#include <QThread>
+
+#include <exception>
+#include <optional>
+#include <type_traits>
 
 namespace modmesh
 {
@@ -47,7 +53,7 @@ namespace modmesh
  * buffer of the input array, and gives up (does not own) the memory buffer.
  */
 template <typename T>
-SimpleArray<T> makeSimpleArray(QByteArray & qbarr, small_vector<size_t> shape, bool view = false)
+SimpleArray<T> makeSimpleArray(QByteArray & qbarr, typename SimpleArray<T>::shape_type const & shape, bool view = false)
 {
     size_t nbytes = sizeof(T);
     for (size_t v : shape)
@@ -75,7 +81,7 @@ SimpleArray<T> makeSimpleArray(QByteArray & qbarr, small_vector<size_t> shape, b
         std::copy_n(ptr, nbytes, cbuf->begin());
     }
 
-    return SimpleArray<T>(small_vector<size_t>(shape), cbuf);
+    return SimpleArray<T>(shape, cbuf);
 }
 
 template <typename T>
@@ -87,6 +93,98 @@ QByteArray makeQByteArray(SimpleArray<T> const & sarr)
     return barray;
 }
 
+/**
+ * @brief Run the callable on the GUI thread and return its result.
+ *
+ * On the GUI thread it is simply called.  From another thread, which must
+ * hold the GIL, the call gives up the GIL and blocks until the GUI thread has
+ * run the callable with the GIL.  An exception is rethrown to the caller.
+ */
+template <typename F>
+auto runOnGuiThread(F && func) -> decltype(func())
+{
+    using result_type = decltype(func());
+
+    QCoreApplication * app = QCoreApplication::instance();
+    if (nullptr == app || QThread::currentThread() == app->thread())
+    {
+        return func();
+    }
+
+    // A reference result is kept by its address.
+    using stored_type = std::conditional_t<
+        std::is_reference_v<result_type>,
+        std::remove_reference_t<result_type> *,
+        result_type>;
+    std::optional<std::conditional_t<std::is_void_v<result_type>, bool, stored_type>> result;
+    std::exception_ptr error;
+    {
+        pybind11::gil_scoped_release const release;
+        QMetaObject::invokeMethod(
+            app,
+            [&]()
+            {
+                pybind11::gil_scoped_acquire const acquire;
+                try
+                {
+                    if constexpr (std::is_void_v<result_type>)
+                    {
+                        func();
+                    }
+                    else if constexpr (std::is_reference_v<result_type>)
+                    {
+                        result.emplace(&func());
+                    }
+                    else
+                    {
+                        result.emplace(func());
+                    }
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+            },
+            Qt::BlockingQueuedConnection);
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+    if constexpr (std::is_reference_v<result_type>)
+    {
+        return static_cast<result_type>(**result);
+    }
+    else if constexpr (!std::is_void_v<result_type>)
+    {
+        return result_type(std::move(*result));
+    }
+}
+
+/**
+ * @brief Adapt a member function to be wrapped in Python and always run on
+ * the GUI thread, from whatever thread Python calls it.
+ */
+template <typename R, typename C, typename... Args>
+auto onGuiThread(R (C::*method)(Args...))
+{
+    return [method](C & self, Args... args) -> R
+    {
+        return runOnGuiThread([&]() -> R
+                              { return (self.*method)(std::forward<Args>(args)...); });
+    };
+}
+
+template <typename R, typename C, typename... Args>
+auto onGuiThread(R (C::*method)(Args...) const)
+{
+    return [method](C const & self, Args... args) -> R
+    {
+        return runOnGuiThread([&]() -> R
+                              { return (self.*method)(std::forward<Args>(args)...); });
+    };
+}
+
 } /* end namespace modmesh */
 
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -33,6 +33,10 @@
 #include <modmesh/view/R3DWidget.hpp>
 #include <modmesh/view/RManager.hpp>
 #include <modmesh/view/RPythonConsoleDockWidget.hpp>
+#include <modmesh/view/RGeometryWorker.hpp>
+#include <modmesh/view/RViewStats.hpp>
+#include <modmesh/view/RFieldMaterial.hpp>
+#include <modmesh/view/RBezierMaterial.hpp>
 #include <modmesh/view/RStaticMesh.hpp>
 #include <modmesh/view/RWorld.hpp>
 #include <modmesh/view/RAxisMark.hpp>
@@ -152,63 +152,96 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapR3DWidget
         namespace py = pybind11;
 
         (*this)
-            .def_property_readonly("mesh", &wrapped_type::mesh)
-            .def("updateMesh", &wrapped_type::updateMesh, py::arg("mesh"))
-            .def("updateWorld", &wrapped_type::updateWorld, py::arg("world"))
-            .def("showMark", &wrapped_type::showMark)
+            .def_property_readonly("mesh", onGuiThread(&wrapped_type::mesh))
+            .def_property_readonly("meshFp32", onGuiThread(&wrapped_type::meshFp32))
+            .def(
+                "updateMesh",
+                onGuiThread(py::overload_cast<std::shared_ptr<StaticMesh> const &, double>(&wrapped_type::updateMesh)),
+                py::arg("mesh"),
+                py::arg("lod_pixels") = 0.0)
+            .def("updateMesh", onGuiThread(py::overload_cast<std::shared_ptr<StaticMeshFp32> const &>(&wrapped_type::updateMesh)), py::arg("mesh"))
+            .def(
+                "updateWorld",
+                onGuiThread(&wrapped_type::updateWorld),
+                py::arg("world"),
+                py::arg("pixel_tolerance") = 0.0,
+                py::arg("on_gpu") = false)
+            .def(
+                "showField",
+                onGuiThread(&wrapped_type::showField),
+                py::arg("snapshot"),
+                py::arg("on_cell") = false,
+                py::arg("column") = 0,
+                py::arg("vmin") = 0.0,
+                py::arg("vmax") = 0.0,
+                py::arg("interval") = 100)
+            .def("hideField", onGuiThread(&wrapped_type::hideField))
+            .def_property("statsVisible", onGuiThread(&wrapped_type::statsVisible), onGuiThread(&wrapped_type::showStats))
+            .def("showMark", onGuiThread(&wrapped_type::showMark))
             .def(
                 "clipImage",
                 [](wrapped_type & self)
                 {
-                    QClipboard * clipboard = QGuiApplication::clipboard();
-                    clipboard->setPixmap(self.grabPixmap());
+                    runOnGuiThread(
+                        [&]()
+                        {
+                            QClipboard * clipboard = QGuiApplication::clipboard();
+                            clipboard->setPixmap(self.grabPixmap());
+                        });
                 })
             .def(
                 "saveImage",
                 [](wrapped_type & self, std::string const & filename)
                 {
-                    self.grabPixmap().save(filename.c_str());
+                    runOnGuiThread([&]()
+                                   { self.grabPixmap().save(filename.c_str()); });
                 },
                 py::arg("filename"))
             .def(
                 "setCameraType",
                 [](wrapped_type & self, std::string const & name)
                 {
-                    if (name == "orbit")
-                    {
-                        qDebug() << "Use Orbit Camera Controller";
-                        self.scene()->setOrbitCameraController();
-                        self.scene()->controller()->setCamera(self.camera());
-                    }
-                    else if (name == "fps")
-                    {
-                        qDebug() << "Use First Person Camera (fps) Controller";
-                        self.scene()->setFirstPersonCameraController();
-                        self.scene()->controller()->setCamera(self.camera());
-                    }
-                    else
-                    {
-                        qDebug() << "name needs to be either orbit or fps";
-                    }
+                    runOnGuiThread(
+                        [&]()
+                        {
+                            if (name == "orbit")
+                            {
+                                qDebug() << "Use Orbit Camera Controller";
+                                self.scene()->setOrbitCameraController();
+                                self.scene()->controller()->setCamera(self.camera());
+                            }
+                            else if (name == "fps")
+                            {
+                                qDebug() << "Use First Person Camera (fps) Controller";
+                                self.scene()->setFirstPersonCameraController();
+                                self.scene()->controller()->setCamera(self.camera());
+                            }
+                            else
+                            {
+                                qDebug() << "name needs to be either orbit or fps";
+                            }
+                        });
                 },
                 py::arg("name"))
             //
             ;
 
-#define DECL_QVECTOR3D_PROPERTY(NAME, GETTER, SETTER)          \
-    .def_property(                                             \
-        #NAME,                                                 \
-        [](wrapped_type & self)                                \
-        {                                                      \
-            QVector3D const v = self.camera()->GETTER();       \
-            return py::make_tuple(v.x(), v.y(), v.z());        \
-        },                                                     \
-        [](wrapped_type & self, std::vector<double> const & v) \
-        {                                                      \
-            double const x = v.at(0);                          \
-            double const y = v.at(1);                          \
-            double const z = v.at(2);                          \
-            self.camera()->SETTER(QVector3D(x, y, z));         \
+#define DECL_QVECTOR3D_PROPERTY(NAME, GETTER, SETTER)                       \
+    .def_property(                                                          \
+        #NAME,                                                              \
+        [](wrapped_type & self)                                             \
+        {                                                                   \
+            QVector3D const v = runOnGuiThread([&]()                        \
+                                               { return self.camera()->GETTER(); }); \
+            return py::make_tuple(v.x(), v.y(), v.z());                     \
+        },                                                                  \
+        [](wrapped_type & self, std::vector<double> const & v)              \
+        {                                                                   \
+            double const x = v.at(0);                                       \
+            double const y = v.at(1);                                       \
+            double const z = v.at(2);                                       \
+            runOnGuiThread([&]()                                            \
+                           { self.camera()->SETTER(QVector3D(x, y, z)); }); \
         })
 
         (*this)
@@ -240,13 +273,17 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapRLine
                 py::init(
                     [](R3DWidget & w, float x0, float y0, float z0, float x1, float y1, float z1, uint8_t color_r, uint8_t color_g, uint8_t color_b)
                     {
-                        auto * scene = w.scene();
-                        QVector3D v0(x0, y0, z0);
-                        QVector3D v1(x1, y1, z1);
-                        QColor color(color_r, color_g, color_b, 255);
-                        auto * ret = new RLine(v0, v1, color, scene);
-                        ret->addArrowHead(0.2f, 0.4f);
-                        return ret;
+                        return runOnGuiThread(
+                            [&]()
+                            {
+                                auto * scene = w.scene();
+                                QVector3D v0(x0, y0, z0);
+                                QVector3D v1(x1, y1, z1);
+                                QColor color(color_r, color_g, color_b, 255);
+                                auto * ret = new RLine(v0, v1, color, scene);
+                                ret->addArrowHead(0.2f, 0.4f);
+                                return ret;
+                            });
                     }));
     }
 
@@ -265,16 +302,18 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapRPythonConsoleDockWidget
         namespace py = pybind11;
 
         (*this)
-            .def("writeToHistory", &wrapped_type::writeToHistory)
+            .def("writeToHistory", onGuiThread(&wrapped_type::writeToHistory))
             .def_property(
                 "command",
                 [](wrapped_type const & self)
                 {
-                    return self.command().toStdString();
+                    return runOnGuiThread([&]()
+                                          { return self.command().toStdString(); });
                 },
                 [](wrapped_type & self, std::string const & command)
                 {
-                    return self.setCommand(QString::fromStdString(command));
+                    runOnGuiThread([&]()
+                                   { self.setCommand(QString::fromStdString(command)); });
                 })
             .def_property(
                 "python_redirect",
@@ -286,6 +325,7 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapRPythonConsoleDockWidget
                 {
                     self.setPythonRedirect(enabled);
                 })
+            .def("cancelCommand", onGuiThread(&wrapped_type::cancelCommand))
             //
             ;
     }
@@ -317,11 +357,14 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapRManager
                 {
                     return RManager::instance().core();
                 })
-            .def("setUp", &RManager::setUp)
+            .def("setUp", onGuiThread(&RManager::setUp))
             .def(
                 "exec",
                 [](wrapped_type & self)
                 {
+                    // The console runs Python on its own thread while the
+                    // event loop runs.
+                    py::gil_scoped_release const release;
                     return self.core()->exec();
                 })
             .wrap_widget()
@@ -346,7 +389,8 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapRManager
                 "add3DWidget",
                 [](wrapped_type & self)
                 {
-                    return self.add3DWidget();
+                    return runOnGuiThread([&]()
+                                          { return self.add3DWidget(); });
                 })
             //
             ;
@@ -360,12 +404,13 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapRManager
 
         (*this)
             .wrap_mainWindow()
-            .def("clearApplications", &wrapped_type::clearApplications)
+            .def("clearApplications", onGuiThread(&wrapped_type::clearApplications))
             .def(
                 "addApplication",
                 [](wrapped_type & self, std::string const & name)
                 {
-                    self.addApplication(QString::fromStdString(name));
+                    runOnGuiThread([&]()
+                                   { self.addApplication(QString::fromStdString(name)); });
                 },
                 py::arg("name"))
             //
@@ -389,13 +434,15 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapRManager
                 "show",
                 [](wrapped_type & self)
                 {
-                    self.mainWindow()->show();
+                    runOnGuiThread([&]()
+                                   { self.mainWindow()->show(); });
                 })
             .def(
                 "resize",
                 [](wrapped_type & self, int w, int h)
                 {
-                    self.mainWindow()->resize(w, h);
+                    runOnGuiThread([&]()
+                                   { self.mainWindow()->resize(w, h); });
                 },
                 py::arg("w"),
                 py::arg("h"))
@@ -403,21 +450,27 @@ class MODMESH_PYTHON_WRAPPER_VISIBILITY WrapRManager
                 "addSubWindow",
                 [](wrapped_type & self, QWidget * widget)
                 {
-                    QMdiSubWindow * subwin = self.addSubWindow(widget);
-                    subwin->resize(300, 200);
-                    subwin->setAttribute(Qt::WA_DeleteOnClose);
-                    return subwin;
+                    return runOnGuiThread(
+                        [&]()
+                        {
+                            QMdiSubWindow * subwin = self.addSubWindow(widget);
+                            subwin->resize(300, 200);
+                            subwin->setAttribute(Qt::WA_DeleteOnClose);
+                            return subwin;
+                        });
                 },
                 py::arg("widget"))
             .def_property(
                 "windowTitle",
                 [](wrapped_type & self)
                 {
-                    return self.mainWindow()->windowTitle().toStdString();
+                    return runOnGuiThread([&]()
+                                          { return self.mainWindow()->windowTitle().toStdString(); });
                 },
                 [](wrapped_type & self, std::string const & name)
                 {
-                    self.mainWindow()->setWindowTitle(QString::fromStdString(name));
+                    runOnGuiThread([&]()
+                                   { self.mainWindow()->setWindowTitle(QString::fromStdString(name)); });
                 })
             //
             ;
@@ -469,6 +522,34 @@ void wrap_view(pybind11::module & mod)
 
     mod.attr("mgr") = RManagerProxy();
 
+    mod.def(
+        "view_stats",
+        []()
+        {
+            RViewStats const & stats = RViewStats::instance();
+            RViewStats::Frame const & last = stats.last();
+            py::dict ret;
+            ret["nframe"] = last.nframe;
+            ret["frame_time"] = last.time;
+            ret["prepare_time"] = last.prepare_time;
+            ret["deliver_time"] = last.deliver_time;
+            ret["upload_bytes"] = last.upload_bytes;
+            ret["ndraw"] = last.ndraw;
+            ret["total_upload_bytes"] = stats.total_upload_bytes();
+            return ret;
+        },
+        "The counts of the last frame of the viewer; the times are also in time_registry");
+
+    mod.def(
+        "run_on_gui",
+        [](py::function const & func)
+        {
+            return runOnGuiThread([&]()
+                                  { return func(); });
+        },
+        py::arg("func"),
+        "Call func on the GUI thread and return its result, e.g., for PySide6 from the console");
+
     try
     {
         // Creating module level variable to handle Qt MainWindow which is
@@ -2,6 +2,15 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <thread>
+
 #ifdef Py_PYTHON_H
 #error "Python.h should not be included."
 #endif
@@ -62,4 +71,1762 @@ TEST(SimpleArray, abs)
     EXPECT_EQ(brr.sum(), 10.0);
 }
 
+TEST(SimpleArray, abs_out)
+{
+    using namespace modmesh;
+
+    SimpleArray<int32_t> arr(small_vector<size_t>{37});
+    for (size_t i = 0; i < arr.size(); ++i)
+    {
+        arr(i) = static_cast<int32_t>(i) - 20;
+    }
+    SimpleArray<int32_t> out(small_vector<size_t>{37}, 0);
+    EXPECT_EQ(&arr.abs(out), &out);
+    EXPECT_EQ(out(0), 20);
+    EXPECT_EQ(out(36), 16);
+    EXPECT_EQ(arr(0), -20);
+    arr.abs_inplace();
+    EXPECT_EQ(arr(0), 20);
+    EXPECT_EQ(arr.sum(), out.sum());
+
+    SimpleArray<int32_t> bad(small_vector<size_t>{36});
+    EXPECT_THROW(arr.abs(bad), std::invalid_argument);
+}
+
+namespace
+{
+
+template <typename T>
+void check_simd_kernels(modmesh::simd::SimdLevel level)
+{
+    using namespace modmesh;
+
+    simd::SimdLevel const saved = simd::level();
+    simd::set_level(level);
+    // Odd sizes exercise both the vector blocks and the scalar tails.
+    for (size_t const size : {1, 7, 31, 32, 33, 100, 1027})
+    {
+        SimpleArray<T> arr(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            arr(i) = static_cast<T>((static_cast<int>(i * 37 % 101) - 50) / 4);
+        }
+        T smin = std::numeric_limits<T>::max();
+        T smax = std::numeric_limits<T>::lowest();
+        T ssum = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            smin = arr(i) < smin ? arr(i) : smin;
+            smax = arr(i) > smax ? arr(i) : smax;
+            ssum += arr(i);
+        }
+        EXPECT_EQ(arr.min(), smin) << simd::to_string(level) << " size " << size;
+        EXPECT_EQ(arr.max(), smax) << simd::to_string(level) << " size " << size;
+        // The values are multiples of 1/4, so any summation order is exact.
+        EXPECT_EQ(arr.sum(), ssum) << simd::to_string(level) << " size " << size;
+        SimpleArray<T> brr = arr.abs();
+        for (size_t i = 0; i < size; ++i)
+        {
+            EXPECT_EQ(brr(i), arr(i) < 0 ? -arr(i) : arr(i));
+        }
+    }
+    simd::set_level(saved);
+}
+
+} /* end namespace */
+
+TEST(SimpleArray, simd_kernels)
+{
+    using namespace modmesh;
+
+    std::vector<simd::SimdLevel> levels{simd::SimdLevel::Generic};
+    if (simd::SimdLevel::Generic != simd::detect_level())
+    {
+        levels.push_back(simd::detect_level());
+    }
+    if (simd::SimdLevel::AVX512 == simd::detect_level())
+    {
+        levels.push_back(simd::SimdLevel::AVX2);
+    }
+    for (simd::SimdLevel const level : levels)
+    {
+        check_simd_kernels<float>(level);
+        check_simd_kernels<double>(level);
+        check_simd_kernels<int32_t>(level);
+        check_simd_kernels<int64_t>(level);
+    }
+}
+
+TEST(SimpleArray, simd_nan)
+{
+    using namespace modmesh;
+
+    SimpleArray<double> arr(small_vector<size_t>{64}, 1.0);
+    arr(3) = std::numeric_limits<double>::quiet_NaN();
+    arr(40) = -2.0;
+    arr(50) = 5.0;
+    EXPECT_EQ(arr.min(), -2.0);
+    EXPECT_EQ(arr.max(), 5.0);
+    EXPECT_TRUE(std::isnan(arr.min(std::numeric_limits<double>::quiet_NaN())));
+}
+
+TEST(ThreadPool, run)
+{
+    using namespace modmesh;
+
+    ThreadPool pool;
+    pool.set_nthread(4);
+    std::vector<int> hits(100, 0);
+    pool.run(hits.size(), [&](size_t it)
+             { hits[it] += 1; });
+    EXPECT_EQ(std::count(hits.begin(), hits.end(), 1), 100);
+
+    // Nested calls run serially inside the task.
+    std::atomic<size_t> count{0};
+    pool.run(4, [&](size_t)
+             { pool.run(3, [&](size_t)
+                        { ++count; }); });
+    EXPECT_EQ(count.load(), 12);
+
+    EXPECT_THROW(pool.run(8, [](size_t it)
+                          { if (5 == it) { throw std::runtime_error("task failed"); } }),
+                 std::runtime_error);
+    // The pool is still usable after a failed run.
+    count = 0;
+    pool.run(8, [&](size_t)
+             { ++count; });
+    EXPECT_EQ(count.load(), 8);
+}
+
+TEST(ThreadPool, static_schedule)
+{
+    using namespace modmesh;
+
+    ThreadPool pool;
+    pool.set_nthread(4);
+    // Uneven tasks make the threads steal the blocks of the others.
+    std::vector<std::atomic<int>> hits(103);
+    pool.run(
+        hits.size(),
+        [&](size_t it)
+        {
+            if (it < 10)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+            hits[it] += 1;
+        },
+        ThreadPool::Schedule::STATIC);
+    for (size_t it = 0; it < hits.size(); ++it)
+    {
+        EXPECT_EQ(hits[it].load(), 1) << it;
+    }
+
+    EXPECT_THROW(pool.run(
+                     8,
+                     [](size_t it)
+                     { if (5 == it) { throw std::runtime_error("task failed"); } },
+                     ThreadPool::Schedule::STATIC),
+                 std::runtime_error);
+
+    // Pinning restarts the workers and keeps the results.
+    pool.set_pin(true);
+    EXPECT_TRUE(pool.pin());
+    std::atomic<size_t> count{0};
+    pool.run(
+        50,
+        [&](size_t)
+        { ++count; },
+        ThreadPool::Schedule::STATIC);
+    EXPECT_EQ(count.load(), 50);
+    pool.set_pin(false);
+    count = 0;
+    pool.run(50, [&](size_t)
+             { ++count; });
+    EXPECT_EQ(count.load(), 50);
+}
+
+TEST(SimpleArray, parallel_deterministic)
+{
+    using namespace modmesh;
+
+    size_t const size = ThreadPool::CHUNK_SIZE * 5 + 123;
+    SimpleArray<double> arr(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        arr(i) = std::sin(static_cast<double>(i)) * 1.0e3;
+    }
+    ThreadPool & pool = ThreadPool::instance();
+    size_t const saved = pool.nthread();
+
+    pool.set_nthread(1);
+    double const serial_sum = arr.sum(0.0, false);
+    double const serial_min = arr.min(std::numeric_limits<double>::max(), false);
+    double const serial_max = arr.max(std::numeric_limits<double>::lowest(), false);
+    for (size_t const nthread : {2, 3, 8})
+    {
+        pool.set_nthread(nthread);
+        // Bit-identical results regardless of the number of threads.
+        EXPECT_EQ(arr.sum(0.0, true), serial_sum) << nthread;
+        EXPECT_EQ(arr.min(std::numeric_limits<double>::max(), true), serial_min) << nthread;
+        EXPECT_EQ(arr.max(std::numeric_limits<double>::lowest(), true), serial_max) << nthread;
+    }
+
+    SimpleArray<int64_t> iarr(size);
+    iarr.fill(3, true);
+    EXPECT_EQ(iarr.sum(0, true), static_cast<int64_t>(3 * size));
+    iarr(size - 1) = -7;
+    EXPECT_EQ(iarr.abs().sum(), static_cast<int64_t>(3 * size + 4));
+    EXPECT_EQ(iarr.min(), -7);
+
+    pool.set_nthread(saved);
+}
+
+TEST(SimpleArray, reduce_axis)
+{
+    using namespace modmesh;
+
+    SimpleArray<int32_t> arr(small_vector<size_t>{2, 3, 4});
+    for (size_t i = 0; i < arr.size(); ++i)
+    {
+        arr.data()[i] = static_cast<int32_t>(i);
+    }
+    SimpleArray<int32_t> const s0 = arr.sum_axis(0);
+    ASSERT_EQ(s0.ndim(), 2);
+    EXPECT_EQ(s0.shape(0), 3);
+    EXPECT_EQ(s0.shape(1), 4);
+    EXPECT_EQ(s0(1, 2), 6 + 18);
+    SimpleArray<int32_t> const s1 = arr.sum_axis(1);
+    EXPECT_EQ(s1(1, 3), 15 + 19 + 23);
+    SimpleArray<int32_t> const s2 = arr.sum_axis(2);
+    EXPECT_EQ(s2(0, 1), 4 + 5 + 6 + 7);
+    EXPECT_EQ(arr.min_axis(1)(1, 0), 12);
+    EXPECT_EQ(arr.max_axis(2)(1, 2), 23);
+    EXPECT_EQ(arr.mean_axis(0)(0, 0), 6);
+
+    // The output is preallocated and reused.
+    SimpleArray<int32_t> out(small_vector<size_t>{2, 4}, -1);
+    EXPECT_EQ(&arr.max_axis(1, out, false), &out);
+    EXPECT_EQ(out(0, 1), 9);
+    SimpleArray<int32_t> bad(small_vector<size_t>{2, 3});
+    EXPECT_THROW(arr.sum_axis(1, bad), std::invalid_argument);
+    EXPECT_THROW(arr.sum_axis(3), std::out_of_range);
+    EXPECT_THROW(SimpleArray<int32_t>(4).sum_axis(0), std::invalid_argument);
+
+    // Only the sum is defined for an empty axis.
+    SimpleArray<double> empty(small_vector<size_t>{3, 0});
+    EXPECT_EQ(empty.sum_axis(1)(2), 0.0);
+    EXPECT_THROW(empty.min_axis(1), std::invalid_argument);
+    EXPECT_THROW(empty.mean_axis(1), std::invalid_argument);
+
+    // The ghost rows stay in the output of the other axes.
+    SimpleArray<double> garr(small_vector<size_t>{4, 2}, 1.0);
+    garr.set_nghost(1);
+    SimpleArray<double> const gsum = garr.sum_axis(1);
+    EXPECT_EQ(gsum.nghost(), 1);
+    EXPECT_EQ(gsum(-1), 2.0);
+    EXPECT_EQ(garr.sum_axis(0).nghost(), 0);
+}
+
+TEST(SimpleArray, reduce_axis_parallel)
+{
+    using namespace modmesh;
+
+    ThreadPool & pool = ThreadPool::instance();
+    size_t const saved = pool.nthread();
+    pool.set_nthread(4);
+    for (small_vector<size_t> const & shape : {small_vector<size_t>{ThreadPool::CHUNK_SIZE / 2 + 17, 5},
+                                             small_vector<size_t>{7, 3000, 3},
+                                             small_vector<size_t>{3, ThreadPool::CHUNK_SIZE + 9}})
+    {
+        SimpleArray<double> arr(shape);
+        for (size_t i = 0; i < arr.size(); ++i)
+        {
+            arr.data()[i] = std::sin(static_cast<double>(i)) * 1.0e3;
+        }
+        for (size_t axis = 0; axis < arr.ndim(); ++axis)
+        {
+            SimpleArray<double> const serial_sum = arr.sum_axis(axis);
+            SimpleArray<double> const serial_max = arr.max_axis(axis);
+            SimpleArray<double> psum(serial_sum.shape());
+            SimpleArray<double> pmax(serial_max.shape());
+            // Bit-identical results with and without the pool.
+            arr.sum_axis(axis, psum, true);
+            arr.max_axis(axis, pmax, true);
+            for (size_t i = 0; i < psum.size(); ++i)
+            {
+                ASSERT_EQ(psum.data()[i], serial_sum.data()[i]) << axis;
+                ASSERT_EQ(pmax.data()[i], serial_max.data()[i]) << axis;
+            }
+        }
+        // Check the first axis against the direct loop, which may add the
+        // floating-point values in another order.
+        SimpleArray<int64_t> iarr(shape);
+        for (size_t i = 0; i < iarr.size(); ++i)
+        {
+            iarr.data()[i] = static_cast<int64_t>(i % 1013) - 500;
+        }
+        SimpleArray<int64_t> const sum0 = iarr.sum_axis(0);
+        for (size_t j = 0; j < sum0.size(); ++j)
+        {
+            int64_t expected = 0;
+            for (size_t i = 0; i < shape[0]; ++i)
+            {
+                expected += iarr.data()[i * sum0.size() + j];
+            }
+            ASSERT_EQ(sum0.data()[j], expected) << j;
+        }
+    }
+    pool.set_nthread(saved);
+}
+
+TEST(SimpleArray, take_put_select)
+{
+    using namespace modmesh;
+
+    SimpleArray<int32_t> arr(small_vector<size_t>{5, 2});
+    for (size_t i = 0; i < arr.size(); ++i)
+    {
+        arr.data()[i] = static_cast<int32_t>(i);
+    }
+    arr.set_nghost(1);
+
+    // The indices count from the body; the ghost row is -1.
+    SimpleArray<int64_t> indices{-1, 3, 0};
+    SimpleArray<int32_t> const taken = arr.take(indices, false);
+    ASSERT_EQ(taken.shape(0), 3);
+    ASSERT_EQ(taken.shape(1), 2);
+    EXPECT_EQ(std::vector<int32_t>(taken.begin(), taken.end()), (std::vector<int32_t>{0, 1, 8, 9, 2, 3}));
+    indices(1) = 4;
+    EXPECT_THROW(arr.take(indices, false), std::out_of_range);
+
+    SimpleArray<bool> const mask{false, true, false, true, false};
+    for (bool const parallel : {false, true})
+    {
+        SimpleArray<int32_t> const selected = arr.select(mask, parallel);
+        EXPECT_EQ(std::vector<int32_t>(selected.begin(), selected.end()), (std::vector<int32_t>{2, 3, 6, 7}));
+    }
+    arr.assign(mask, -1, false);
+    arr.put(SimpleArray<uint32_t>{3}, SimpleArray<int32_t>(small_vector<size_t>{1, 2}, 42), false);
+    EXPECT_EQ(std::vector<int32_t>(arr.begin(), arr.end()), (std::vector<int32_t>{0, 1, -1, -1, 4, 5, -1, -1, 42, 42}));
+    EXPECT_THROW(arr.select(SimpleArray<bool>{true, true, true}, false), std::invalid_argument);
+}
+
+TEST(DeviceMirror, lazy_sync)
+{
+    using namespace modmesh;
+
+    std::shared_ptr<EmulatedDeviceBackend> const backend = EmulatedDeviceBackend::construct();
+    SimpleArray<double> arr(small_vector<size_t>{1000}, 1.5);
+    EXPECT_EQ(arr.buffer().mirror(), nullptr);
+    arr.to_host(); // No-op without a mirror.
+
+    auto * device = arr.to_device(backend);
+    DeviceMirror * mirror = arr.buffer().mirror();
+    ASSERT_NE(mirror, nullptr);
+    EXPECT_EQ(mirror->state(), DeviceMirror::State::SYNCED);
+    mirror->wait();
+    EXPECT_EQ(device[999], 1.5);
+    EXPECT_EQ(backend->stats().to_device_count, 1);
+    EXPECT_EQ(backend->stats().device_bytes_in_use, 8000);
+    EXPECT_EQ(backend->stats().pinned_bytes_in_use, 8000);
+
+    // Without modification nothing is copied.
+    EXPECT_EQ(arr.to_device(backend), device);
+    arr.to_host();
+    EXPECT_EQ(backend->stats().to_device_count, 1);
+    EXPECT_EQ(backend->stats().to_host_count, 0);
+
+    // A "kernel" writes the device copy.
+    std::fill_n(device, 1000, -2.0);
+    mirror->modify_device();
+    EXPECT_THROW(mirror->modify_host(), std::runtime_error);
+    EXPECT_EQ(arr[0], 1.5);
+    arr.to_host();
+    EXPECT_EQ(arr[0], -2.0);
+    EXPECT_EQ(backend->stats().to_host_count, 1);
+    EXPECT_EQ(backend->stats().to_host_bytes, 8000);
+
+    // The host writes go to the device on the next sync only.
+    arr[3] = 7.0;
+    mirror->modify_host();
+    EXPECT_THROW(mirror->modify_device(), std::runtime_error);
+    arr.to_device();
+    mirror->wait();
+    EXPECT_EQ(device[3], 7.0);
+    EXPECT_EQ(backend->stats().to_device_count, 2);
+
+    // A buffer is mirrored on a single backend.
+    EXPECT_THROW(arr.to_device(EmulatedDeviceBackend::construct()), std::invalid_argument);
+
+    arr = SimpleArray<double>();
+    EXPECT_EQ(backend->stats().device_bytes_in_use, 0);
+    EXPECT_EQ(backend->stats().pinned_bytes_in_use, 0);
+}
+
+TEST(ArrayExpression, arithmetic)
+{
+    using namespace modmesh;
+
+    SimpleArray<double> a(small_vector<size_t>{3, 5});
+    SimpleArray<double> b(small_vector<size_t>{3, 5});
+    SimpleArray<double> c(small_vector<size_t>{3, 5}, 2.0);
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        a.data(i) = static_cast<double>(i);
+        b.data(i) = static_cast<double>(i) - 7.0;
+    }
+
+    SimpleArray<double> d = evaluate(a + b * c);
+    EXPECT_EQ(d.shape(), a.shape());
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        EXPECT_EQ(d.data(i), a.data(i) + b.data(i) * 2.0);
+    }
+
+    // Assignment into an existing array, with scalars on both sides.
+    d = 1.5 * a - b / 2.0 + 1;
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        EXPECT_EQ(d.data(i), 1.5 * a.data(i) - b.data(i) / 2.0 + 1);
+    }
+
+    // The output may alias an operand.
+    d = -d + d * 2.0;
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        EXPECT_EQ(d.data(i), 1.5 * a.data(i) - b.data(i) / 2.0 + 1);
+    }
+
+    // Conversion on assignment to another element type.
+    SimpleArray<int32_t> e(small_vector<size_t>{3, 5});
+    e = a * 2.0;
+    EXPECT_EQ(e(2, 4), 28);
+
+    SimpleArray<double> f(small_vector<size_t>{5, 3});
+    EXPECT_THROW(a + f, std::invalid_argument);
+    EXPECT_THROW(f = a + b, std::invalid_argument);
+}
+
+TEST(ArrayExpression, mask)
+{
+    using namespace modmesh;
+
+    SimpleArray<double> a(small_vector<size_t>{10});
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        a(i) = static_cast<double>(i) - 4.5;
+    }
+    SimpleArray<bool> m = evaluate(a > 0.0);
+    EXPECT_FALSE(m(4));
+    EXPECT_TRUE(m(5));
+    EXPECT_EQ(evaluate(a <= -1.5).sum(), true);
+
+    SimpleArray<double> absval = evaluate(where(a > 0.0, a, -a));
+    EXPECT_EQ(absval.min(), 0.5);
+    EXPECT_EQ(absval.max(), 4.5);
+
+    SimpleArray<double> relu = evaluate(a * (a > 0.0));
+    EXPECT_EQ(relu(0), 0.0);
+    EXPECT_EQ(relu(9), 4.5);
+}
+
+TEST(strided_copy, layouts)
+{
+    using namespace modmesh;
+
+    // Source of shape (4, 3, 5) taken from a (4, 6, 5) block with step 2 on
+    // the middle axis, written transposed into a (5, 3, 4) destination.
+    std::vector<double> src(4 * 6 * 5);
+    for (size_t i = 0; i < src.size(); ++i)
+    {
+        src[i] = static_cast<double>(i);
+    }
+    size_t const shape[3] = {4, 3, 5};
+    ssize_t const src_strides[3] = {30, 10, 1};
+    ssize_t const dst_strides[3] = {1, 4, 12};
+    std::vector<float> dst(5 * 3 * 4, -1.0f);
+    strided_copy(src.data(), src_strides, dst.data(), dst_strides, shape, 3);
+    for (size_t i = 0; i < 4; ++i)
+    {
+        for (size_t j = 0; j < 3; ++j)
+        {
+            for (size_t k = 0; k < 5; ++k)
+            {
+                EXPECT_EQ(dst[k * 12 + j * 4 + i], static_cast<float>(src[i * 30 + j * 10 + k]));
+            }
+        }
+    }
+
+    // Contiguous dimensions merge into one memcpy; negative strides reverse.
+    std::vector<int32_t> isrc(24);
+    for (size_t i = 0; i < isrc.size(); ++i)
+    {
+        isrc[i] = static_cast<int32_t>(i);
+    }
+    std::vector<int32_t> idst(24, 0);
+    size_t const ishape[3] = {2, 3, 4};
+    ssize_t const istrides[3] = {12, 4, 1};
+    strided_copy(isrc.data(), istrides, idst.data(), istrides, ishape, 3);
+    EXPECT_EQ(idst, isrc);
+    ssize_t const rstrides[3] = {-12, -4, -1};
+    strided_copy(isrc.data() + 23, rstrides, idst.data(), istrides, ishape, 3);
+    for (size_t i = 0; i < idst.size(); ++i)
+    {
+        EXPECT_EQ(idst[i], static_cast<int32_t>(23 - i));
+    }
+}
+
+template <typename T>
+void check_transpose(size_t nrow, size_t ncol, bool parallel)
+{
+    using namespace modmesh;
+
+    std::vector<T> src(nrow * ncol);
+    for (size_t i = 0; i < src.size(); ++i)
+    {
+        src[i] = static_cast<T>(i % 251);
+    }
+    std::vector<T> dst(nrow * ncol, T(-1));
+    transpose(src.data(), nrow, ncol, dst.data(), parallel);
+    for (size_t i = 0; i < nrow; ++i)
+    {
+        for (size_t j = 0; j < ncol; ++j)
+        {
+            ASSERT_EQ(dst[j * nrow + i], src[i * ncol + j]) << nrow << "x" << ncol << " at " << i << ", " << j;
+        }
+    }
+}
+
+TEST(transpose, shapes)
+{
+    using namespace modmesh;
+
+    std::vector<simd::SimdLevel> levels{simd::SimdLevel::Generic};
+    if (simd::SimdLevel::Generic != simd::detect_level())
+    {
+        levels.push_back(simd::detect_level());
+    }
+    simd::SimdLevel const saved = simd::level();
+    // The small sides take interleave/deinterleave, the others the tiles
+    // with the remainders of the vector blocks.
+    std::vector<std::pair<size_t, size_t>> const shapes{
+        {1, 1}, {7, 1}, {9, 2}, {33, 3}, {2, 45}, {130, 4}, {8, 8}, {37, 29}, {100, 37}, {5, 301}, {1000, 70}};
+    for (simd::SimdLevel const level : levels)
+    {
+        simd::set_level(level);
+        for (auto const & [nrow, ncol] : shapes)
+        {
+            check_transpose<double>(nrow, ncol, false);
+            check_transpose<float>(nrow, ncol, false);
+            check_transpose<int64_t>(nrow, ncol, false);
+            check_transpose<int16_t>(nrow, ncol, false);
+        }
+    }
+    simd::set_level(saved);
+
+    ThreadPool & pool = ThreadPool::instance();
+    size_t const nthread = pool.nthread();
+    pool.set_nthread(4);
+    check_transpose<double>(ThreadPool::CHUNK_SIZE / 4 + 3, 9, true);
+    check_transpose<float>(7, ThreadPool::CHUNK_SIZE / 2 + 5, true);
+    check_transpose<int32_t>(ThreadPool::CHUNK_SIZE + 1, 3, true);
+    pool.set_nthread(nthread);
+}
+
+TEST(transpose, interleave)
+{
+    using namespace modmesh;
+
+    size_t const n = 1003;
+    for (size_t const k : {1, 2, 3, 4, 7})
+    {
+        std::vector<double> aos(n * k);
+        for (size_t i = 0; i < aos.size(); ++i)
+        {
+            aos[i] = static_cast<double>(i);
+        }
+        std::vector<std::vector<double>> soa(k, std::vector<double>(n));
+        std::vector<double *> ptrs;
+        for (auto & component : soa)
+        {
+            ptrs.push_back(component.data());
+        }
+        deinterleave(aos.data(), n, k, ptrs.data(), false);
+        for (size_t j = 0; j < k; ++j)
+        {
+            EXPECT_EQ(soa[j][n - 1], static_cast<double>((n - 1) * k + j)) << k;
+        }
+        std::vector<double> back(n * k, -1.0);
+        std::vector<double const *> cptrs(ptrs.begin(), ptrs.end());
+        interleave(cptrs.data(), n, k, back.data(), false);
+        EXPECT_EQ(back, aos) << k;
+    }
+
+    SimpleArray<int32_t> arr(small_vector<size_t>{5, 3});
+    for (size_t i = 0; i < arr.size(); ++i)
+    {
+        arr.data()[i] = static_cast<int32_t>(i);
+    }
+    arr.set_nghost(1);
+    SimpleArray<int32_t> const tarr = arr.transpose();
+    ASSERT_EQ(tarr.shape(), (small_vector<size_t>{3, 5}));
+    EXPECT_EQ(tarr.nghost(), 0);
+    EXPECT_EQ(tarr(2, 4), 14);
+    EXPECT_EQ(tarr(1, 0), 1);
+    EXPECT_THROW(SimpleArray<int32_t>(small_vector<size_t>{2, 3, 4}).transpose(), std::invalid_argument);
+
+    // Copying a transposed view takes the same kernel.
+    SimpleArray<int32_t> const tcopy = arr.view().transpose().copy();
+    for (size_t i = 0; i < tarr.size(); ++i)
+    {
+        EXPECT_EQ(tcopy.data()[i], tarr.data()[i]);
+    }
+}
+
+TEST(SimpleArrayView, slice_transpose_reshape)
+{
+    using namespace modmesh;
+
+    SimpleArray<int32_t> arr(small_vector<size_t>{4, 6});
+    for (size_t i = 0; i < arr.size(); ++i)
+    {
+        arr.data(i) = static_cast<int32_t>(i);
+    }
+
+    SimpleArrayView<int32_t> view = arr.view();
+    EXPECT_TRUE(view.is_contiguous());
+    EXPECT_EQ(view.buffer().get(), &arr.buffer());
+
+    // Sub-block with steps, including a negative step.
+    SimpleArrayView<int32_t> sub = view.slice({SimpleArraySlice{1, 4, 2}, SimpleArraySlice{std::nullopt, std::nullopt, -2}});
+    EXPECT_EQ(sub.shape(), (small_vector<size_t>{2, 3}));
+    EXPECT_FALSE(sub.is_contiguous());
+    EXPECT_EQ(sub(0, 0), 11);
+    EXPECT_EQ(sub(0, 2), 7);
+    EXPECT_EQ(sub(1, 0), 23);
+    EXPECT_EQ(sub.at({-1, -1}), 19);
+    EXPECT_THROW(sub.at({2, 0}), std::out_of_range);
+
+    // Writing through a view changes the array.
+    sub(1, 1) = -1;
+    EXPECT_EQ(arr(3, 3), -1);
+    sub.fill(100);
+    EXPECT_EQ(arr(1, 1), 100);
+    EXPECT_EQ(arr(1, 2), 8);
+
+    SimpleArrayView<int32_t> trans = view.transpose();
+    EXPECT_EQ(trans.shape(), (small_vector<size_t>{6, 4}));
+    EXPECT_EQ(trans(5, 2), arr(2, 5));
+    SimpleArray<int32_t> copied = trans.copy();
+    EXPECT_EQ(copied(5, 2), arr(2, 5));
+    EXPECT_EQ(copied.shape(), trans.shape());
+
+    SimpleArrayView<int32_t> flat = view.reshape(small_vector<size_t>{24});
+    EXPECT_EQ(flat(17), arr(2, 5));
+    EXPECT_THROW(trans.reshape(small_vector<size_t>{24}), std::invalid_argument);
+    EXPECT_THROW(view.reshape(small_vector<size_t>{25}), std::invalid_argument);
+
+    SimpleArrayView<int32_t> row = view.select(0, 2);
+    EXPECT_EQ(row.shape(), (small_vector<size_t>{6}));
+    EXPECT_EQ(row(4), arr(2, 4));
+
+    EXPECT_THROW(SimpleArrayView<int32_t>(view.buffer(), arr.data() + 1, arr.shape(), view.stride()), std::out_of_range);
+}
+
+TEST(SimpleArrayView, ghost_body)
+{
+    using namespace modmesh;
+
+    SimpleArray<double> arr(small_vector<size_t>{7, 2});
+    for (size_t i = 0; i < arr.size(); ++i)
+    {
+        arr.data(i) = static_cast<double>(i);
+    }
+    arr.set_nghost(3);
+    SimpleArrayView<double> body = arr.view_body();
+    EXPECT_EQ(body.shape(), (small_vector<size_t>{4, 2}));
+    EXPECT_EQ(body(0, 1), arr(0, 1));
+    SimpleArrayView<double> ghost = arr.view_ghost();
+    EXPECT_EQ(ghost.shape(), (small_vector<size_t>{3, 2}));
+    EXPECT_EQ(ghost(0, 0), arr(-3, 0));
+
+    // Views of views cost nothing and keep sharing the buffer.
+    SimpleArrayView<double> tail = body.slice(0, SimpleArraySlice{-2, std::nullopt, 1}).select(1, 0);
+    EXPECT_EQ(tail.shape(), (small_vector<size_t>{2}));
+    EXPECT_EQ(tail(1), arr(3, 0));
+
+    SimpleArray<double> const & carr = arr;
+    SimpleArrayView<double const> cview = carr.view_body();
+    EXPECT_EQ(cview(1, 1), arr(1, 1));
+    body.slice(0, SimpleArraySlice{0, 3, 1}).assign(carr.view_ghost());
+    EXPECT_EQ(arr(1, 1), 3.0);
+    EXPECT_THROW(body.assign(carr.view_ghost()), std::invalid_argument);
+}
+
+TEST(SimpleArray, body_ghost_range)
+{
+    using namespace modmesh;
+
+    SimpleArray<double> arr(small_vector<size_t>{size_t(7), size_t(2)});
+    for (size_t i = 0; i < arr.size(); ++i)
+    {
+        arr.data(i) = static_cast<double>(i);
+    }
+    arr.set_nghost(3);
+
+    SimpleArraySpan<double> body = arr.body_range();
+    EXPECT_EQ(body.size(), 8);
+    EXPECT_EQ(body.data(), &arr(0, 0));
+    SimpleArraySpan<double const> ghost = static_cast<SimpleArray<double> const &>(arr).ghost_range();
+    EXPECT_EQ(ghost.size(), 6);
+    EXPECT_EQ(ghost.data(), &arr(-3, 0));
+    EXPECT_EQ(ghost.end(), body.begin());
+
+    // A kernel over restrict-qualified spans.
+    SimpleArray<double> out(small_vector<size_t>{size_t(4), size_t(2)}, 0.0);
+    double const * MODMESH_RESTRICT src = body.data();
+    double * MODMESH_RESTRICT dst = out.body_range().data();
+    for (size_t i = 0; i < body.size(); ++i)
+    {
+        dst[i] = 2.0 * src[i];
+    }
+    EXPECT_EQ(out(3, 1), 2.0 * arr(3, 1));
+
+    SimpleArrayRows<double> rows = arr.body_rows();
+    EXPECT_EQ(rows.size(), 4);
+    EXPECT_EQ(rows.width(), 2);
+    ssize_t irow = 0;
+    for (SimpleArraySpan<double> row : rows)
+    {
+        EXPECT_EQ(row.size(), 2);
+        EXPECT_EQ(row[1], arr(irow, 1));
+        ++irow;
+    }
+    EXPECT_EQ(irow, 4);
+    EXPECT_EQ(rows.end() - rows.begin(), 4);
+    EXPECT_EQ(rows.begin()[2][0], arr(2, 0));
+    EXPECT_EQ(arr.ghost_rows().size(), 3);
+    EXPECT_EQ(arr.ghost_rows()[0][0], arr(-3, 0));
+    EXPECT_EQ(arr.rows().size(), 7);
+
+    // Rows with zero width are still counted.
+    SimpleArray<double> narrow(small_vector<size_t>{size_t(3), size_t(0)});
+    EXPECT_EQ(std::distance(narrow.rows().begin(), narrow.rows().end()), 3);
+
+    SimpleArray<double> arr1d(small_vector<size_t>{size_t(5)}, 1.0);
+    arr1d.set_nghost(1);
+    EXPECT_EQ(arr1d.body_range().size(), 4);
+    EXPECT_EQ(arr1d.ghost_range().size(), 1);
+    EXPECT_THROW(arr1d.body_rows(), std::out_of_range);
+}
+
+TEST(SimpleArrayFixedView, index)
+{
+    using namespace modmesh;
+
+    SimpleArray<int32_t> arr(small_vector<size_t>{5, 3, 2});
+    for (size_t i = 0; i < arr.size(); ++i)
+    {
+        arr.data(i) = static_cast<int32_t>(i);
+    }
+    arr.set_nghost(2);
+
+    SimpleArrayFixedView<int32_t, 3> fixed = arr.fixed_view<3>();
+    EXPECT_EQ(fixed.nghost(), 2);
+    EXPECT_EQ(fixed.nbody(), 3);
+    EXPECT_EQ(fixed.size(), arr.size());
+    for (int i = -2; i < 3; ++i)
+    {
+        for (size_t j = 0; j < 3; ++j)
+        {
+            for (size_t k = 0; k < 2; ++k)
+            {
+                EXPECT_EQ(fixed(i, j, k), arr(i, j, k));
+            }
+        }
+    }
+    fixed(-1, 2, 1) = -7;
+    EXPECT_EQ(arr(-1, 2, 1), -7);
+    EXPECT_EQ(fixed.at(-2, 0, 0), 0);
+    EXPECT_THROW(fixed.at(-3, 0, 0), std::out_of_range);
+    EXPECT_THROW(fixed.at(0, 0, 2), std::out_of_range);
+    EXPECT_THROW(arr.fixed_view<2>(), std::invalid_argument);
+
+    // Round trip to the dynamic types shares the buffer.
+    SimpleArray<int32_t> back = fixed.to_array();
+    EXPECT_EQ(back.data(), arr.data());
+    EXPECT_EQ(back.nghost(), 2);
+    EXPECT_EQ(fixed.view()(1, 2, 1), -7);
+
+    SimpleArray<int32_t> const & carr = arr;
+    SimpleArrayFixedView<int32_t const, 3> cfixed = carr.fixed_view<3>();
+    EXPECT_EQ(cfixed(2, 1, 0), arr(2, 1, 0));
+}
+
+TEST(ConcreteBuffer, alignment)
+{
+    using namespace modmesh;
+
+    auto buf = ConcreteBuffer::construct(100, ConcreteBuffer::CACHELINE_ALIGNMENT);
+    EXPECT_EQ(buf->alignment(), 64);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(buf->data()) % 64, 0);
+    EXPECT_TRUE(buf->has_remover());
+
+    auto buf2 = buf->clone();
+    EXPECT_EQ(buf2->alignment(), 64);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(buf2->data()) % 64, 0);
+
+    auto buf3 = ConcreteBuffer::construct(4096, ConcreteBuffer::HUGEPAGE_ALIGNMENT);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(buf3->data()) % ConcreteBuffer::HUGEPAGE_ALIGNMENT, 0);
+
+    EXPECT_THROW(ConcreteBuffer::construct(100, 48), std::invalid_argument);
+}
+
+TEST(ConcreteBuffer, default_alignment)
+{
+    using namespace modmesh;
+
+    EXPECT_EQ(ConcreteBuffer::default_alignment(), 0);
+    ConcreteBuffer::set_default_alignment(128);
+    SimpleArray<double> arr(small_vector<size_t>{3, 5});
+    EXPECT_EQ(arr.alignment(), 128);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(arr.data()) % 128, 0);
+    ConcreteBuffer::set_default_alignment(0);
+    EXPECT_EQ(ConcreteBuffer::construct(10)->alignment(), 0);
+    EXPECT_THROW(ConcreteBuffer::set_default_alignment(3), std::invalid_argument);
+}
+
+TEST(SimpleArray, alignment)
+{
+    using namespace modmesh;
+
+    SimpleArray<float> arr(small_vector<size_t>{7, 3}, SimpleArrayAlignment{64});
+    EXPECT_EQ(arr.alignment(), 64);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(arr.data()) % 64, 0);
+    SimpleArray<float> brr(arr);
+    EXPECT_EQ(brr.alignment(), 64);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(brr.data()) % 64, 0);
+}
+
+TEST(SimpleArray, epoch)
+{
+    using namespace modmesh;
+
+    SimpleArray<double> arr(small_vector<size_t>{4, 3}, 1.0);
+    SimpleArray<double> brr(small_vector<size_t>{4, 3}, 2.0);
+    // Every buffer starts at its own epoch.
+    EXPECT_NE(arr.epoch(), 0);
+    EXPECT_NE(arr.epoch(), brr.epoch());
+
+    // A write through the elements is not noticed until bumped.
+    uint64_t last = arr.epoch();
+    arr(0, 0) = 3.0;
+    EXPECT_EQ(arr.epoch(), last);
+    arr.bump_epoch();
+    EXPECT_GT(arr.epoch(), last);
+
+    // The modifiers bump the epoch of the written array only.
+    last = arr.epoch();
+    uint64_t const blast = brr.epoch();
+    arr.fill(5.0);
+    EXPECT_GT(arr.epoch(), last);
+    EXPECT_EQ(brr.epoch(), blast);
+    last = arr.epoch();
+    arr.sort();
+    EXPECT_GT(arr.epoch(), last);
+    last = arr.epoch();
+    arr = arr + brr;
+    EXPECT_GT(arr.epoch(), last);
+    last = arr.epoch();
+    arr = brr;
+    EXPECT_GT(arr.epoch(), last);
+    EXPECT_EQ(brr.epoch(), blast);
+    SimpleArray<double> trr(small_vector<size_t>{3, 4});
+    last = trr.epoch();
+    arr.transpose(trr);
+    EXPECT_GT(trr.epoch(), last);
+
+    // The views share the epoch of the buffer.
+    SimpleArray<double> crr(arr.shape(), arr.buffer().shared_from_this());
+    EXPECT_EQ(crr.epoch(), arr.epoch());
+    last = arr.epoch();
+    crr.view().fill(0.0);
+    EXPECT_GT(arr.epoch(), last);
+    EXPECT_EQ(crr.epoch(), arr.epoch());
+}
+
+TEST(MemoryResource, pool)
+{
+    using namespace modmesh;
+
+    auto pool = PoolMemoryResource::construct();
+    int8_t const * first = nullptr;
+    {
+        auto buf = ConcreteBuffer::construct(1000, 0, pool);
+        first = buf->data();
+        EXPECT_EQ(pool->stats().bytes_in_use, 1000);
+        EXPECT_EQ(pool->stats().upstream_allocate_count, 1);
+    }
+    EXPECT_EQ(pool->stats().bytes_in_use, 0);
+    EXPECT_EQ(pool->cached_bytes(), 1024);
+    {
+        // A request of the same size class reuses the cached block.
+        auto buf = ConcreteBuffer::construct(600, 0, pool);
+        EXPECT_EQ(buf->data(), first);
+        EXPECT_EQ(pool->stats().upstream_allocate_count, 1);
+        EXPECT_EQ(pool->stats().allocate_count, 2);
+    }
+    pool->release();
+    EXPECT_EQ(pool->cached_bytes(), 0);
+    EXPECT_EQ(pool->stats().upstream_bytes, 0);
+}
+
+TEST(MemoryResource, arena)
+{
+    using namespace modmesh;
+
+    auto arena = ArenaMemoryResource::construct(4096);
+    {
+        MemoryResourceScope const scope(arena);
+        SimpleArray<double> arr1(small_vector<size_t>{10});
+        SimpleArray<double> arr2(small_vector<size_t>{10}, SimpleArrayAlignment{64});
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(arr2.data()) % 64, 0);
+        EXPECT_EQ(arena->nchunk(), 1);
+        EXPECT_EQ(arena->live_count(), 2);
+        EXPECT_THROW(arena->reset(), std::runtime_error);
+    }
+    EXPECT_EQ(MemoryResource::get_current(), nullptr);
+    EXPECT_EQ(arena->live_count(), 0);
+    arena->reset();
+    {
+        // Larger than the chunk size.
+        auto buf = ConcreteBuffer::construct(10000, 0, arena);
+        EXPECT_EQ(arena->nchunk(), 2);
+    }
+    arena->release();
+    EXPECT_EQ(arena->nchunk(), 0);
+    EXPECT_EQ(arena->stats().upstream_bytes, 0);
+}
+
+TEST(MemoryResource, numa)
+{
+    using namespace modmesh;
+    using Policy = NumaMemoryResource::Policy;
+
+    EXPECT_GE(NumaMemoryResource::node_count(), 1);
+    EXPECT_EQ(NumaMemoryResource::policy_from_string("interleave"), Policy::Interleave);
+    EXPECT_THROW(NumaMemoryResource::policy_from_string("spread"), std::invalid_argument);
+    EXPECT_THROW(NumaMemoryResource::construct(Policy::Bind, NumaMemoryResource::node_count()), std::invalid_argument);
+
+    size_t const nthread = ThreadPool::instance().nthread();
+    ThreadPool::instance().set_nthread(4);
+    for (Policy policy : {Policy::FirstTouch, Policy::Interleave, Policy::Bind})
+    {
+        if (!NumaMemoryResource::is_supported(policy))
+        {
+            continue;
+        }
+        auto resource = NumaMemoryResource::construct(policy, 0);
+        {
+            SimpleArray<double> arr = [&]()
+            {
+                MemoryResourceScope const scope(resource);
+                return SimpleArray<double>(small_vector<size_t>{300000}, 1.0);
+            }();
+            EXPECT_EQ(arr.sum(), 300000.0);
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(arr.data()) % NumaMemoryResource::page_size(), 0);
+            EXPECT_EQ(resource->stats().upstream_bytes % NumaMemoryResource::page_size(), 0);
+            EXPECT_GE(resource->stats().upstream_bytes, 300000 * sizeof(double));
+        }
+        EXPECT_EQ(resource->stats().upstream_bytes, 0);
+        EXPECT_EQ(resource->stats().bytes_in_use, 0);
+    }
+    ThreadPool::instance().set_nthread(nthread);
+}
+
+TEST(MemoryResource, copy_on_write)
+{
+    using namespace modmesh;
+
+    auto resource = CopyOnWriteMemoryResource::construct();
+    {
+        SimpleArray<double> arr = [&]()
+        {
+            MemoryResourceScope const scope(resource);
+            return SimpleArray<double>(small_vector<size_t>{3000}, 1.0);
+        }();
+        double const * const body = arr.body();
+
+        SimpleArray<double> cpy1(arr);
+        SimpleArray<double> cpy2(arr);
+        EXPECT_EQ(cpy1.sum(), 3000.0);
+        EXPECT_EQ(cpy2.sum(), 3000.0);
+        if (CopyOnWriteMemoryResource::is_supported())
+        {
+            // The source is not written in between, so both clones share it.
+            EXPECT_EQ(resource->shared_clone_count(), 2);
+            EXPECT_EQ(resource->copied_clone_count(), 0);
+        }
+
+        // Writing to either side does not show on the others.
+        arr(0) = 5.0;
+        cpy1(2999) = 7.0;
+        EXPECT_EQ(arr.body(), body);
+        EXPECT_EQ(arr(0), 5.0);
+        EXPECT_EQ(arr(2999), 1.0);
+        EXPECT_EQ(cpy1(0), 1.0);
+        EXPECT_EQ(cpy1(2999), 7.0);
+        EXPECT_EQ(cpy2(0), 1.0);
+        EXPECT_EQ(cpy2(2999), 1.0);
+
+        // The written source is frozen into a new file for the next clone.
+        SimpleArray<double> cpy3(arr);
+        EXPECT_EQ(cpy3(0), 5.0);
+        arr(1) = 9.0;
+        EXPECT_EQ(cpy3(1), 1.0);
+        EXPECT_EQ(cpy1(1), 1.0);
+        if (CopyOnWriteMemoryResource::is_supported())
+        {
+            EXPECT_EQ(resource->copied_clone_count(), 1);
+        }
+        EXPECT_EQ(resource->stats().allocate_count, 4);
+    }
+    EXPECT_EQ(resource->stats().bytes_in_use, 0);
+    EXPECT_EQ(resource->stats().upstream_bytes, 0);
+
+    // A buffer that is not from the resource is copied as usual.
+    auto buffer = ConcreteBuffer::construct(16);
+    EXPECT_NE(buffer->clone()->data(), buffer->data());
+}
+
+TEST(MappedBuffer, map_file)
+{
+    using namespace modmesh;
+
+    std::string const path = std::string(testing::TempDir()) + "modmesh_test_mapped_buffer.bin";
+    {
+        std::vector<double> values(1000);
+        for (size_t it = 0; it < values.size(); ++it)
+        {
+            values[it] = static_cast<double>(it);
+        }
+        std::ofstream ofs(path, std::ios::binary);
+        ofs.write(reinterpret_cast<char const *>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(double)));
+    }
+
+    {
+        auto buf = map_buffer(path);
+        EXPECT_EQ(buf->nbytes(), 8000);
+        EXPECT_TRUE(buf->is_readonly());
+        SimpleArray<double> arr(small_vector<size_t>{10, 100}, buf);
+        EXPECT_EQ(arr(3, 7), 307.0);
+        EXPECT_EQ(arr.sum(), 999.0 * 1000 / 2);
+    }
+
+    {
+        // The offset does not need to be page-aligned.
+        auto buf = map_buffer(path, MapMode::CopyOnWrite, 8 * 600, 8 * 10);
+        EXPECT_FALSE(buf->is_readonly());
+        SimpleArray<double> arr(buf);
+        EXPECT_EQ(arr.size(), 10);
+        EXPECT_EQ(arr[0], 600.0);
+        arr[0] = -1.0;
+        EXPECT_EQ(map_buffer(path)->data<double>()[600], 600.0);
+    }
+
+    {
+        auto buf = map_buffer(path, MapMode::ReadWrite, 8 * 5, 8);
+        buf->data<double>()[0] = -5.0;
+    }
+    EXPECT_EQ(map_buffer(path)->data<double>()[5], -5.0);
+
+    EXPECT_THROW(map_buffer(path, MapMode::ReadOnly, 8000, 8), std::out_of_range);
+    EXPECT_THROW(map_buffer(path + ".nonexist"), std::runtime_error);
+    EXPECT_THROW(get_map_mode_from_string("w"), std::invalid_argument);
+
+    std::remove(path.c_str());
+}
+
+#ifndef _WIN32
+TEST(SharedMemory, publish_attach)
+{
+    using namespace modmesh;
+
+    std::string const name = "/modmesh_test_shared_memory";
+    SharedMemory::remove(name);
+    std::shared_ptr<SharedMemory> owner = SharedMemory::create(name, 8 * 100);
+    EXPECT_THROW(SharedMemory::create(name, 8), std::runtime_error);
+    EXPECT_THROW(SharedMemory::attach(name), std::runtime_error); // Not published.
+    EXPECT_THROW(SharedMemory::create("no_slash", 8), std::invalid_argument);
+    std::iota(reinterpret_cast<double *>(owner->data()), reinterpret_cast<double *>(owner->data()) + 100, 0.0);
+    owner->publish();
+    EXPECT_EQ(owner->refcount(), 1);
+
+    SimpleArray<double> arr;
+    {
+        std::shared_ptr<SharedMemory> other = SharedMemory::attach(name);
+        EXPECT_TRUE(other->is_readonly());
+        EXPECT_EQ(other->nbytes(), 8 * 100);
+        EXPECT_EQ(owner->refcount(), 2);
+        arr = SimpleArray<double>(small_vector<size_t>{10, 10}, other->buffer(8 * 0, 8 * 100));
+        EXPECT_TRUE(arr.buffer().is_readonly());
+        EXPECT_THROW(other->buffer(8, 8 * 100), std::out_of_range);
+    }
+    // The array holds the attached handle.
+    EXPECT_EQ(owner->refcount(), 2);
+    EXPECT_EQ(arr(3, 7), 37.0);
+    reinterpret_cast<double *>(owner->data())[37] = -1.0;
+    EXPECT_EQ(arr(3, 7), -1.0);
+
+    // The last handle unlinks the segment.
+    owner.reset();
+    EXPECT_EQ(arr(0, 1), 1.0);
+    arr = SimpleArray<double>();
+    EXPECT_THROW(SharedMemory::attach(name), std::runtime_error);
+    EXPECT_FALSE(SharedMemory::remove(name));
+}
+#endif
+
+TEST(Checkpoint, save_load)
+{
+    using namespace modmesh;
+
+    std::string const path = std::string(testing::TempDir()) + "modmesh_test_checkpoint.bin";
+    SimpleArray<double> so0(small_vector<size_t>{7, 3});
+    for (size_t it = 0; it < so0.size(); ++it)
+    {
+        so0.data()[it] = static_cast<double>(it) * 0.5;
+    }
+    so0.set_nghost(2);
+    SimpleArray<double> cfl(small_vector<size_t>{5}, 0.25);
+
+    Checkpoint ckpt("test");
+    ckpt.add_array("so0", so0);
+    ckpt.add_array("cfl", cfl);
+    ckpt.add_array("lossy", so0, 1.e-3);
+    ckpt.add_scalar("nstep", 42);
+    EXPECT_THROW(ckpt.add_array("bad", so0, -1.0), std::invalid_argument);
+    // The checkpoint keeps a snapshot.
+    so0(0, 0) = -1.0;
+    EXPECT_THROW(ckpt.add_scalar("a_name_longer_than_thirty_one_chars", 0), std::invalid_argument);
+
+    {
+        CheckpointWriter writer;
+        writer.write(path, ckpt);
+        writer.flush();
+        EXPECT_EQ(writer.nwritten(), 1);
+        writer.write(path + ".nonexist/dir", ckpt);
+        EXPECT_THROW(writer.flush(), std::runtime_error);
+    }
+
+    for (bool const mmap : {true, false})
+    {
+        Checkpoint const loaded = Checkpoint::load(path, mmap);
+        EXPECT_EQ(loaded.kind(), "test");
+        EXPECT_EQ(loaded.narray(), 3);
+        EXPECT_EQ(loaded.scalar("nstep"), 42.0);
+        SimpleArray<double> const & arr = loaded.array("so0");
+        EXPECT_EQ(arr.shape(0), 7);
+        EXPECT_EQ(arr.shape(1), 3);
+        EXPECT_EQ(arr.nghost(), 2);
+        EXPECT_EQ(arr(0, 0), 3.0);
+        EXPECT_EQ(arr(4, 2), 10.0);
+        if (mmap)
+        {
+            // The offset of each array in the file is 64-byte aligned.
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(arr.data()) % 64, 0);
+        }
+        EXPECT_EQ(loaded.array("cfl")(4), 0.25);
+        // The lossy array is loaded within the tolerance.
+        SimpleArray<double> const & lossy = loaded.array("lossy");
+        EXPECT_EQ(lossy.shape(), arr.shape());
+        EXPECT_EQ(lossy.nghost(), 2);
+        EXPECT_EQ(loaded.tolerance("lossy"), 1.e-3);
+        EXPECT_EQ(loaded.tolerance("so0"), 0.0);
+        for (size_t it = 0; it < arr.size(); ++it)
+        {
+            EXPECT_NEAR(lossy.data()[it], arr.data()[it], 1.e-3);
+        }
+        EXPECT_THROW(loaded.array("so1"), std::out_of_range);
+        EXPECT_THROW(loaded.check_kind("other"), std::runtime_error);
+    }
+
+    EXPECT_THROW(Checkpoint::load(path + ".nonexist"), std::runtime_error);
+    std::remove(path.c_str());
+}
+
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
+
+TEST(AllocationTracker, scopes)
+{
+    namespace mm = modmesh;
+    mm::AllocationTracker & tracker = mm::AllocationTracker::me();
+
+    auto find = [&tracker](std::string const & scope)
+    {
+        for (mm::AllocationRecord const & record : tracker.records())
+        {
+            if (record.scope == scope)
+            {
+                return record;
+            }
+        }
+        return mm::AllocationRecord{};
+    };
+
+    {
+        // Nothing is recorded when the tracker is disabled.
+        mm::AllocationScope const scope("gtest::disabled");
+        EXPECT_FALSE(tracker.enabled());
+        mm::ConcreteBuffer::construct(64);
+    }
+    EXPECT_EQ(find("gtest::disabled").allocate_count, 0);
+
+    tracker.enable();
+    std::shared_ptr<mm::ConcreteBuffer> held;
+    {
+        mm::AllocationScope const outer("gtest::outer");
+        held = mm::ConcreteBuffer::construct(128);
+        {
+            mm::AllocationScope const inner("gtest::inner");
+            mm::ConcreteBuffer::construct(256);
+            mm::ConcreteBuffer::construct(32);
+        }
+        // Zero-sized buffers hold no memory and are not counted.
+        mm::ConcreteBuffer::construct(0);
+    }
+    tracker.disable();
+
+    mm::AllocationRecord record = find("gtest::inner");
+    EXPECT_EQ(record.allocate_count, 2);
+    EXPECT_EQ(record.deallocate_count, 2);
+    EXPECT_EQ(record.allocated_bytes, 288);
+    EXPECT_EQ(record.live_bytes, 0);
+    EXPECT_EQ(record.peak_bytes, 256);
+
+    record = find("gtest::outer");
+    EXPECT_EQ(record.allocate_count, 1);
+    EXPECT_EQ(record.deallocate_count, 0);
+    EXPECT_EQ(record.live_bytes, 128);
+    EXPECT_EQ(record.peak_bytes, 128);
+
+    // The release is charged back to the allocating scope after disabling.
+    held.reset();
+    record = find("gtest::outer");
+    EXPECT_EQ(record.deallocate_count, 1);
+    EXPECT_EQ(record.live_bytes, 0);
+
+    tracker.reset();
+    record = find("gtest::inner");
+    EXPECT_EQ(record.allocate_count, 0);
+    EXPECT_EQ(record.peak_bytes, 0);
+    EXPECT_NE(tracker.report().find("gtest::inner"), std::string::npos);
+    EXPECT_EQ(mm::AllocationTracker::current_scope(), nullptr);
+}
+
+TEST(SimpleArray, sort)
+{
+    using namespace modmesh;
+
+    size_t const nthread = ThreadPool::instance().nthread();
+    ThreadPool::instance().set_nthread(4);
+
+    // Span several chunks so that the parallel passes and merges run.
+    size_t const n = 3 * ThreadPool::CHUNK_SIZE + 123;
+    uint64_t state = 88172645463325252ULL;
+    auto next = [&state]()
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    };
+
+    SimpleArray<int32_t> iarr(n);
+    SimpleArray<double> darr(n);
+    for (size_t it = 0; it < n; ++it)
+    {
+        iarr(it) = static_cast<int32_t>(next() % 2001) - 1000; // many ties
+        darr(it) = static_cast<double>(next() % 100000) / 7.0 - 5000.0;
+    }
+    darr(17) = std::nan("");
+    darr(n - 1) = std::nan("");
+
+    for (bool parallel : {false, true})
+    {
+        std::vector<int32_t> iref(iarr.begin(), iarr.end());
+        std::stable_sort(iref.begin(), iref.end());
+        SimpleArray<int32_t> isorted(iarr);
+        isorted.sort(parallel);
+        EXPECT_TRUE(std::equal(iref.begin(), iref.end(), isorted.begin()));
+
+        std::vector<uint64_t> iidx(n);
+        std::iota(iidx.begin(), iidx.end(), 0);
+        std::stable_sort(iidx.begin(), iidx.end(), [&](uint64_t a, uint64_t b)
+                         { return iarr(a) < iarr(b); });
+        SimpleArray<uint64_t> iargs = iarr.argsort(parallel);
+        EXPECT_TRUE(std::equal(iidx.begin(), iidx.end(), iargs.begin()));
+
+        SimpleArray<double> dsorted(darr);
+        dsorted.sort(parallel);
+        EXPECT_TRUE(std::is_sorted(dsorted.begin(), dsorted.end() - 2));
+        EXPECT_TRUE(std::isnan(dsorted(n - 1)));
+        EXPECT_TRUE(std::isnan(dsorted(n - 2)));
+
+        std::vector<uint64_t> didx(n);
+        std::iota(didx.begin(), didx.end(), 0);
+        std::stable_sort(didx.begin(), didx.end(), [&](uint64_t a, uint64_t b)
+                         { return detail::SortLess<double>()(darr(a), darr(b)); });
+        SimpleArray<uint64_t> dargs = darr.argsort(parallel);
+        EXPECT_TRUE(std::equal(didx.begin(), didx.end(), dargs.begin()));
+
+        SimpleArray<int32_t> iuniq = iarr.unique(parallel);
+        EXPECT_EQ(iuniq.size(), 2001);
+        EXPECT_EQ(iuniq(0), -1000);
+        EXPECT_EQ(iuniq(2000), 1000);
+        // The two NaN are collapsed into one.
+        SimpleArray<double> duniq = darr.unique(parallel);
+        EXPECT_TRUE(std::isnan(duniq(duniq.size() - 1)));
+        EXPECT_FALSE(std::isnan(duniq(duniq.size() - 2)));
+    }
+
+    SimpleArray<int64_t> sorted(small_vector<size_t>{5}, 0);
+    for (size_t it = 0; it < 5; ++it)
+    {
+        sorted(it) = static_cast<int64_t>(it / 2) * 10; // 0 0 10 10 20
+    }
+    SimpleArray<int64_t> values(small_vector<size_t>{2, 2}, 0);
+    values(0, 0) = -1;
+    values(0, 1) = 10;
+    values(1, 0) = 15;
+    values(1, 1) = 30;
+    SimpleArray<uint64_t> left = sorted.searchsorted(values);
+    SimpleArray<uint64_t> right = sorted.searchsorted(values, /* right */ true);
+    EXPECT_EQ(left.shape(), values.shape());
+    EXPECT_EQ(left(0, 0), 0);
+    EXPECT_EQ(left(0, 1), 2);
+    EXPECT_EQ(right(0, 1), 4);
+    EXPECT_EQ(left(1, 0), 4);
+    EXPECT_EQ(right(1, 1), 5);
+
+    SimpleArray<uint8_t> bytes(small_vector<size_t>{4}, 7);
+    bytes(1) = 200;
+    EXPECT_EQ(bytes.sort()(3), 200);
+    SimpleArray<bool> flags(small_vector<size_t>{3}, true);
+    flags(1) = false;
+    EXPECT_FALSE(flags.sort()(0));
+
+    ThreadPool::instance().set_nthread(nthread);
+}
+
+TEST(Float16, conversion)
+{
+    using namespace modmesh;
+
+    EXPECT_EQ(Float16(1.0f).bits(), 0x3c00);
+    EXPECT_EQ(Float16(-2.0).bits(), 0xc000);
+    EXPECT_EQ(Float16(65504.0f).bits(), 0x7bff);
+    EXPECT_EQ(Float16(65520.0f).bits(), 0x7c00); // ties to even overflows
+    EXPECT_EQ(Float16(std::ldexp(1.0f, -24)).bits(), 0x0001);
+    EXPECT_EQ(Float16(std::ldexp(1.0f, -25)).bits(), 0x0000); // ties to even
+    EXPECT_EQ(Float16(std::ldexp(3.0f, -26)).bits(), 0x0001);
+    EXPECT_TRUE(isnan(Float16(std::nanf(""))));
+    EXPECT_TRUE(isinf(Float16(-std::numeric_limits<float>::infinity())));
+    // A double slightly above a tie of float must not be rounded twice.
+    EXPECT_EQ(Float16(1.0 + std::ldexp(1.0, -11) + std::ldexp(1.0, -40)).bits(), 0x3c01);
+    EXPECT_EQ(BFloat16(1.0f).bits(), 0x3f80);
+    EXPECT_EQ(BFloat16(1.0 + std::ldexp(1.0, -8)).bits(), 0x3f80); // ties to even
+    EXPECT_EQ(BFloat16(1.0 + 3 * std::ldexp(1.0, -8)).bits(), 0x3f82);
+    EXPECT_EQ(BFloat16(1.0 + std::ldexp(1.0, -8) + std::ldexp(1.0, -30)).bits(), 0x3f81);
+    EXPECT_EQ(static_cast<float>(std::numeric_limits<Float16>::max()), 65504.0f);
+    EXPECT_EQ(static_cast<float>(std::numeric_limits<BFloat16>::epsilon()), std::ldexp(1.0f, -7));
+
+    // Every 16-bit pattern survives the round trip and the vectorized
+    // kernels agree with the scalar conversion.
+    size_t const n = 1 << 16;
+    std::vector<Float16> half(n);
+    std::vector<BFloat16> bhalf(n);
+    for (size_t it = 0; it < n; ++it)
+    {
+        half[it] = Float16::from_bits(static_cast<uint16_t>(it));
+        bhalf[it] = BFloat16::from_bits(static_cast<uint16_t>(it));
+    }
+    std::vector<float> wide(n);
+    std::vector<float> bwide(n);
+    std::vector<double> dwide(n);
+    simd::convert(half.data(), n, wide.data());
+    simd::convert(bhalf.data(), n, bwide.data());
+    simd::convert(half.data(), n, dwide.data());
+    std::vector<Float16> back(n);
+    std::vector<BFloat16> bback(n);
+    std::vector<Float16> dback(n);
+    simd::convert(wide.data(), n, back.data());
+    simd::convert(bwide.data(), n, bback.data());
+    simd::convert(dwide.data(), n, dback.data());
+    for (size_t it = 0; it < n; ++it)
+    {
+        EXPECT_EQ(detail::float_to_bits(wide[it]), detail::float_to_bits(static_cast<float>(half[it])));
+        EXPECT_EQ(detail::float_to_bits(bwide[it]), detail::float_to_bits(static_cast<float>(bhalf[it])));
+        EXPECT_EQ(detail::float_to_bits(static_cast<float>(dwide[it])), detail::float_to_bits(wide[it]));
+        // NaN is quieted.
+        uint16_t const expect = isnan(half[it]) ? half[it].bits() | 0x200 : half[it].bits();
+        EXPECT_EQ(back[it].bits(), expect);
+        EXPECT_EQ(dback[it].bits(), expect);
+        uint16_t const bexpect = isnan(bhalf[it]) ? bhalf[it].bits() | 0x40 : bhalf[it].bits();
+        EXPECT_EQ(bback[it].bits(), bexpect);
+    }
+
+    // Narrow arbitrary float bit patterns with both the vectorized and the
+    // generic kernels.
+    uint32_t state = 2463534242U;
+    std::vector<float> values(n + 5);
+    for (float & value : values)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        value = detail::bits_to_float(state);
+    }
+    simd::SimdLevel const level = simd::level();
+    std::vector<Float16> simd_half(values.size());
+    std::vector<BFloat16> simd_bhalf(values.size());
+    simd::convert(values.data(), values.size(), simd_half.data());
+    simd::convert(values.data(), values.size(), simd_bhalf.data());
+    simd::set_level(simd::SimdLevel::Generic);
+    std::vector<Float16> generic_half(values.size());
+    std::vector<BFloat16> generic_bhalf(values.size());
+    simd::convert(values.data(), values.size(), generic_half.data());
+    simd::convert(values.data(), values.size(), generic_bhalf.data());
+    simd::set_level(level);
+    for (size_t it = 0; it < values.size(); ++it)
+    {
+        EXPECT_EQ(simd_half[it].bits(), generic_half[it].bits()) << values[it];
+        EXPECT_EQ(simd_bhalf[it].bits(), generic_bhalf[it].bits()) << values[it];
+    }
+}
+
+TEST(SimpleArray, half)
+{
+    using namespace modmesh;
+
+    SimpleArrayFloat16 arr(small_vector<size_t>{40}, Float16(0.5f));
+    arr(3) = -8;
+    arr(7) = Float16(std::nanf(""));
+    EXPECT_EQ(static_cast<float>(arr.max()), 0.5f);
+    EXPECT_EQ(static_cast<float>(arr.min()), -8.0f);
+    arr(7) = 1.5;
+    EXPECT_EQ(static_cast<float>(arr.sum()), 38 * 0.5f - 8.0f + 1.5f);
+    EXPECT_EQ(static_cast<float>(arr.abs()(3)), 8.0f);
+    arr(0) = Float16(std::nanf(""));
+    arr.sort();
+    EXPECT_EQ(static_cast<float>(arr(0)), -8.0f);
+    EXPECT_TRUE(isnan(arr(39)));
+    EXPECT_EQ(arr.unique().size(), 4);
+
+    SimpleArrayBFloat16 barr(small_vector<size_t>{4}, BFloat16(2.0f));
+    barr(1) *= 3;
+    EXPECT_EQ(static_cast<float>(barr.sum()), 12.0f);
+
+    EXPECT_EQ(get_data_type_from_string("float16"), DataType::Float16);
+    EXPECT_EQ(get_data_type_from_string("bfloat16"), DataType::BFloat16);
+    EXPECT_EQ(get_data_type_from_type<BFloat16>(), DataType::BFloat16);
+    SimpleArrayPlex plex(small_vector<size_t>{2, 3}, "float16");
+    SimpleArrayPlex const copied(plex);
+    EXPECT_EQ(copied.data_type(), DataType::Float16);
+    EXPECT_EQ(copied.get_if<SimpleArrayFloat16>()->size(), 6);
+    EXPECT_NE(copied.instance_ptr(), plex.instance_ptr());
+}
+
+TEST(SimpleArrayPlex, dispatch)
+{
+    using namespace modmesh;
+
+    SimpleArrayPlex empty;
+    EXPECT_EQ(empty.data_type(), DataType::Undefined);
+    EXPECT_FALSE(empty.has_instance());
+    EXPECT_EQ(empty.instance_ptr(), nullptr);
+    EXPECT_EQ(empty.size(), 0);
+    EXPECT_THROW(empty.sum(), std::runtime_error);
+
+    EXPECT_EQ(get_data_type_from_string("int64"), DataType::Int64);
+    EXPECT_EQ(get_string_from_data_type(DataType::Uint32), "uint32");
+
+    SimpleArrayPlex plex(small_vector<size_t>{3, 4}, DataType::Int32);
+    EXPECT_EQ(plex.ndim(), 2);
+    EXPECT_EQ(plex.size(), 12);
+    EXPECT_EQ(plex.nbytes(), 48);
+    EXPECT_EQ(plex.get_if<SimpleArrayFloat64>(), nullptr);
+    plex.fill(-3);
+    plex.get_if<SimpleArrayInt32>()->at(size_t(5)) = 9;
+    EXPECT_EQ(plex.sum<int64_t>(), -3 * 11 + 9);
+    EXPECT_EQ(plex.min(), -3.0);
+    EXPECT_EQ(plex.max(), 9.0);
+    EXPECT_EQ(plex.visit([](auto const & array)
+                         { return array.itemsize(); }),
+              4);
+
+    SimpleArrayPlex const moved(SimpleArrayFloat64(small_vector<size_t>{2}, 1.5));
+    EXPECT_EQ(moved.data_type(), DataType::Float64);
+    EXPECT_EQ(moved.sum(), 3.0);
+
+    SimpleArrayPlex other(small_vector<size_t>{5}, DataType::Float64);
+    EXPECT_THROW(other.copy_from(plex), std::invalid_argument);
+}
+
+TEST(SimpleArrayPlex, convert)
+{
+    using namespace modmesh;
+
+    size_t const n = 5000;
+    SimpleArrayFloat64 src(small_vector<size_t>{n / 10, 10});
+    for (size_t it = 0; it < n; ++it)
+    {
+        src.data()[it] = static_cast<double>(it % 128) - 64.0;
+    }
+    src.set_nghost(2);
+    SimpleArrayPlex const plex(src);
+
+    // Every type pair runs the converting kernel; the values are exact in all
+    // the signed types, and the round trip recovers them.
+    for (char const * name : {"int8", "int16", "int32", "int64", "float32", "float16", "bfloat16"})
+    {
+        SimpleArrayPlex const converted = plex.astype(name);
+        EXPECT_EQ(converted.data_type(), get_data_type_from_string(name));
+        EXPECT_EQ(converted.shape(), src.shape());
+        EXPECT_EQ(converted.visit([](auto const & array)
+                                  { return array.nghost(); }),
+                  2);
+        SimpleArrayPlex back(small_vector<size_t>{n}, DataType::Float64);
+        back.copy_from(converted);
+        SimpleArrayFloat64 const & typed = *back.get_if<SimpleArrayFloat64>();
+        for (size_t it = 0; it < n; ++it)
+        {
+            EXPECT_EQ(typed.data()[it], src.data()[it]) << name << " " << it;
+        }
+    }
+
+    // Half to integer goes through the float block buffer.
+    SimpleArrayPlex const half = plex.astype(DataType::Float16);
+    SimpleArrayPlex const int16 = half.astype(DataType::Int16);
+    EXPECT_EQ(int16.sum<int64_t>(), static_cast<int64_t>(src.sum()));
+
+    SimpleArrayPlex const flag = plex.astype("bool");
+    EXPECT_FALSE(flag.get_if<SimpleArrayBool>()->data()[64]);
+    EXPECT_TRUE(flag.get_if<SimpleArrayBool>()->data()[65]);
+}
+
+TEST(CompressedBuffer, round_trip)
+{
+    using namespace modmesh;
+
+    // A smooth field compresses once the exponent bytes are shuffled together.
+    size_t const n = 100000;
+    SimpleArray<double> field(small_vector<size_t>{n / 4, 4});
+    for (size_t it = 0; it < n; ++it)
+    {
+        field.data()[it] = 300.0 + static_cast<double>(it / 64) * 0.125;
+    }
+    field.set_nghost(2);
+    for (bool parallel : {false, true})
+    {
+        std::shared_ptr<CompressedBuffer> const compressed = CompressedBuffer::compress(field, 1 << 16, parallel);
+        EXPECT_EQ(compressed->nbytes(), n * sizeof(double));
+        EXPECT_EQ(compressed->nblock(), (n * sizeof(double) + (1 << 16) - 1) >> 16);
+        EXPECT_GT(compressed->ratio(), 3.0);
+        SimpleArray<double> const restored = compressed->decompress_array<double>(parallel);
+        EXPECT_EQ(restored.shape(), field.shape());
+        EXPECT_EQ(restored.nghost(), 2);
+        EXPECT_EQ(std::memcmp(restored.data(), field.data(), field.nbytes()), 0);
+        EXPECT_THROW(compressed->decompress_array<float>(parallel), std::invalid_argument);
+    }
+
+    // Incompressible bytes are stored as is, and short tails round trip.
+    uint32_t state = 2463534242U;
+    for (size_t size : {size_t(0), size_t(1), size_t(13), size_t(1000), size_t(70001)})
+    {
+        std::vector<int8_t> noise(size);
+        for (int8_t & byte : noise)
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            byte = static_cast<int8_t>(state);
+        }
+        std::shared_ptr<CompressedBuffer> const compressed = CompressedBuffer::compress(noise.data(), size, 4, 1 << 12, false);
+        EXPECT_LE(compressed->compressed_nbytes(), size);
+        std::vector<int8_t> restored(size);
+        compressed->decompress_into(restored.data(), false);
+        EXPECT_EQ(restored, noise);
+    }
+
+    // Long runs exercise the extended lengths and the overlapping matches.
+    std::vector<int8_t> runs(5000, 7);
+    std::fill(runs.begin() + 3000, runs.end(), 9);
+    std::shared_ptr<CompressedBuffer> const compressed = CompressedBuffer::compress(runs.data(), runs.size(), 1, 1 << 16, false);
+    EXPECT_LT(compressed->compressed_nbytes(), 100);
+    std::vector<int8_t> restored(runs.size());
+    compressed->decompress_block(0, restored.data());
+    EXPECT_EQ(restored, runs);
+
+    EXPECT_THROW(CompressedBuffer::compress(runs.data(), runs.size(), 8, 100, false), std::invalid_argument);
+    std::vector<int8_t> corrupt = {static_cast<int8_t>(0x1f), 1, 0x10, 0};
+    EXPECT_THROW(detail::lz4_decompress(corrupt.data(), corrupt.size(), restored.data(), 100), std::runtime_error);
+}
+
+TEST(SimpleArrayMonitor, evaluate)
+{
+    using namespace modmesh;
+
+    // A (ghost + body, 2) field with the row index in column 0.
+    SimpleArray<double> field(small_vector<size_t>{12, 2});
+    for (size_t it = 0; it < 12; ++it)
+    {
+        field(it, 0) = static_cast<double>(it) - 2.0;
+        field(it, 1) = 1.0;
+    }
+    field.set_nghost(2);
+
+    SimpleArrayMonitor<double> monitor;
+    monitor.add_probe("p", 3);
+    monitor.add_probe("ghost", -2);
+    monitor.add_line("line", 1, 4);
+    monitor.add_reduction("min", 0, 10, 0, MonitorReduction::MIN);
+    monitor.add_reduction("max", -2, 10, 0, MonitorReduction::MAX);
+    monitor.add_reduction("mean", 0, 10, 0, MonitorReduction::MEAN);
+    monitor.add_reduction("sum", 0, 10, 1, MonitorReduction::SUM);
+    EXPECT_EQ(monitor.width(), 9);
+    EXPECT_THROW(monitor.add_probe("p", 0), std::invalid_argument);
+    EXPECT_THROW(monitor.add_line("empty", 2, 2), std::invalid_argument);
+
+    monitor.evaluate(field, 0.5);
+    field.fill(1.0);
+    monitor.evaluate(field, 1.5);
+    EXPECT_EQ(monitor.nsample(), 2);
+    EXPECT_EQ(monitor.times()(1), 1.5);
+    EXPECT_EQ(monitor.series("p")(0), 3.0);
+    EXPECT_EQ(monitor.series("ghost")(0), -2.0);
+    SimpleArray<double> const line = monitor.series("line");
+    EXPECT_EQ(line.shape(), (small_vector<size_t>{2, 3}));
+    EXPECT_EQ(line(0, 0), 1.0);
+    EXPECT_EQ(line(0, 2), 3.0);
+    EXPECT_EQ(line(1, 2), 1.0);
+    EXPECT_EQ(monitor.series("min")(0), 0.0);
+    EXPECT_EQ(monitor.series("max")(0), 9.0);
+    EXPECT_EQ(monitor.series("mean")(0), 4.5);
+    EXPECT_EQ(monitor.series("sum")(0), 10.0);
+    EXPECT_EQ(monitor.series("mean")(1), 1.0);
+    EXPECT_EQ(monitor.values().shape(), (small_vector<size_t>{2, 9}));
+    EXPECT_THROW(monitor.series("none"), std::out_of_range);
+    EXPECT_THROW(monitor.add_probe("late", 0), std::runtime_error);
+
+    // An item out of the field adds no sample.
+    SimpleArray<double> const small(small_vector<size_t>{5, 2});
+    EXPECT_THROW(monitor.evaluate(small, 2.5), std::out_of_range);
+    EXPECT_EQ(monitor.nsample(), 2);
+    monitor.clear();
+    EXPECT_EQ(monitor.nsample(), 0);
+    EXPECT_EQ(monitor.nitem(), 7);
+}
+
+TEST(QuantizedBuffer, round_trip)
+{
+    using namespace modmesh;
+
+    // A smooth field of 3 variables with a jump.
+    size_t const nrow = 100000;
+    SimpleArray<double> field(small_vector<size_t>{nrow, 3});
+    for (size_t it = 0; it < nrow; ++it)
+    {
+        double const x = static_cast<double>(it) / static_cast<double>(nrow);
+        field(it, 0) = std::sin(6.0 * x) + (x > 0.5 ? 1.0 : 0.0);
+        field(it, 1) = 300.0 + std::cos(3.0 * x);
+        field(it, 2) = x * x;
+    }
+    field.set_nghost(2);
+    field(17, 1) = std::numeric_limits<double>::infinity();
+    field(23, 2) = std::numeric_limits<double>::quiet_NaN();
+
+    double const tolerance = 1.e-5;
+    for (bool parallel : {false, true})
+    {
+        std::shared_ptr<QuantizedBuffer> const quantized = QuantizedBuffer::compress(field, tolerance, 1 << 14, parallel);
+        EXPECT_EQ(quantized->stride(), 3);
+        EXPECT_EQ(quantized->block_size() % 3, 0);
+        EXPECT_EQ(quantized->noutlier(), 2);
+        EXPECT_GT(quantized->ratio(), 20.0);
+        SimpleArray<double> const restored = quantized->decompress_array<double>(parallel);
+        EXPECT_EQ(restored.shape(), field.shape());
+        EXPECT_EQ(restored.nghost(), 2);
+        EXPECT_EQ(restored(17, 1), field(17, 1));
+        EXPECT_TRUE(std::isnan(restored(23, 2)));
+        double error = 0.0;
+        for (size_t it = 0; it < field.size(); ++it)
+        {
+            if (std::isfinite(field.data()[it]))
+            {
+                error = std::max(error, std::fabs(restored.data()[it] - field.data()[it]));
+            }
+        }
+        EXPECT_LE(error, tolerance);
+        EXPECT_THROW(quantized->decompress_array<float>(parallel), std::invalid_argument);
+
+        // The serialized data decompress to the same values.
+        std::vector<int8_t> bytes(quantized->serialized_nbytes());
+        quantized->serialize(bytes.data());
+        std::shared_ptr<QuantizedBuffer> const loaded = QuantizedBuffer::deserialize(bytes.data(), bytes.size());
+        SimpleArray<double> const reloaded = loaded->decompress_array<double>(!parallel);
+        EXPECT_EQ(std::memcmp(reloaded.data(), restored.data(), field.nbytes()), 0);
+        EXPECT_THROW(QuantizedBuffer::deserialize(bytes.data(), bytes.size() - 1), std::runtime_error);
+    }
+
+    // A float array meets the tolerance too.
+    SimpleArray<float> single(small_vector<size_t>{1000});
+    for (size_t it = 0; it < single.size(); ++it)
+    {
+        single(it) = static_cast<float>(std::sin(0.01 * static_cast<double>(it)));
+    }
+    SimpleArray<float> const restored = QuantizedBuffer::compress(single, 1.e-4)->decompress_array<float>();
+    for (size_t it = 0; it < single.size(); ++it)
+    {
+        EXPECT_NEAR(restored(it), single(it), 1.e-4);
+    }
+    EXPECT_THROW(QuantizedBuffer::compress(single, 0.0), std::invalid_argument);
+}
+
+TEST(small_vector, inline_capacity)
+{
+    using namespace modmesh;
+
+    // The shape of a rank-6 array stays inline and a rank-7 one does not.
+    SimpleArray<double>::shape_type shape6(size_t(6), size_t(2));
+    EXPECT_EQ(shape6.capacity(), MODMESH_SHAPE_INLINE_CAPACITY);
+    SimpleArray<int8_t> const arr(shape6, int8_t(0));
+    EXPECT_EQ(arr.shape().capacity(), MODMESH_SHAPE_INLINE_CAPACITY);
+    EXPECT_EQ(arr.stride().capacity(), MODMESH_SHAPE_INLINE_CAPACITY);
+    EXPECT_EQ(arr.at(SimpleArray<int8_t>::sshape_type{1, 1, 1, 1, 1, 1}), 0);
+    SimpleArray<double>::shape_type shape7(size_t(7), size_t(2));
+    EXPECT_EQ(shape7.capacity(), 7);
+
+    // Vectors of different inline capacities convert and compare.
+    small_vector<size_t> const shape3 = shape6;
+    EXPECT_EQ(shape3.size(), 6);
+    EXPECT_EQ(shape3, shape6);
+    EXPECT_NE(shape3, shape7);
+    EXPECT_NE((small_vector<size_t>{2, 2}), shape6);
+    EXPECT_EQ(arr.shape(), (small_vector<size_t>{2, 2, 2, 2, 2, 2}));
+
+    // Moving a heap vector onto another heap vector takes over the storage.
+    small_vector<size_t, 2> heap1(size_t(5), size_t(1));
+    small_vector<size_t, 2> heap2(size_t(9), size_t(2));
+    size_t const * storage = heap2.data();
+    heap1 = std::move(heap2);
+    EXPECT_EQ(heap1.data(), storage);
+    EXPECT_EQ(heap1.size(), 9);
+    EXPECT_EQ(heap1.capacity(), 9);
+    EXPECT_TRUE(heap2.empty());
+    small_vector<size_t, 2> heap3(std::move(heap1));
+    EXPECT_EQ(heap3.data(), storage);
+    heap3.push_back(3);
+    EXPECT_EQ(heap3.size(), 10);
+}
@@ -23,7 +23,7 @@ protected:
 
     RadixTree<CallerProfile> & radix_tree()
     {
-        return pProfiler->m_radix_tree;
+        return pProfiler->radix_tree();
     }
 
     CallProfiler * pProfiler;
@@ -191,5 +191,81 @@ TEST_F(CallProfilerTest, simple_case_2)
     }
 }
 
+TEST_F(CallProfilerTest, threads)
+{
+    pProfiler->reset();
+
+    foo3();
+    std::thread thread(
+        []()
+        {
+            foo2();
+            foo3();
+        });
+    thread.join();
+
+    // The threads profile into their own trees.
+    EXPECT_GE(pProfiler->nthread(), 2);
+    auto * node1 = radix_tree().get_current_node()->get_child(foo3Name);
+    EXPECT_NE(node1, nullptr);
+    EXPECT_EQ(node1->data().call_count, 1);
+    EXPECT_EQ(radix_tree().get_current_node()->get_child(foo2Name), nullptr);
+
+    // The merged tree adds up the callers of the same stack.
+    std::unique_ptr<RadixTree<CallerProfile>> merged_tree = pProfiler->merged_result();
+    RadixTreeNode<CallerProfile> const * merged = &merged_tree->get_root();
+    auto * merged3 = merged->get_child(foo3Name);
+    EXPECT_NE(merged3, nullptr);
+    EXPECT_EQ(merged3->data().call_count, 2);
+    EXPECT_TRUE(diff_time(merged3->data().total_time, uniqueTime1 * 2));
+    auto * merged2 = merged->get_child(foo2Name);
+    EXPECT_NE(merged2, nullptr);
+    EXPECT_EQ(merged2->data().call_count, 1);
+    EXPECT_NE(merged2->get_child(foo3Name), nullptr);
+
+    std::stringstream ss;
+    pProfiler->print_thread_profiling_result(ss);
+    EXPECT_NE(ss.str().find("Thread 1: "), std::string::npos);
+}
+
+void probe_leaf()
+{
+    USE_CALLPROFILER_PROFILE_THIS_FUNCTION();
+}
+
+void probe_branch()
+{
+    USE_CALLPROFILER_PROFILE_THIS_FUNCTION();
+    probe_leaf();
+}
+
+TEST_F(CallProfilerTest, probe_overhead)
+{
+    pProfiler->reset();
+
+    // The timing is in benchmarks/bench_nopython_toggle.cpp.
+    constexpr int niter = 1000;
+
+    CallProfiler::key_type const key1 = pProfiler->intern("probe_overhead::outer");
+    CallProfiler::key_type const key2 = pProfiler->intern("probe_overhead::inner");
+    RadixTree<CallerProfile> & tree = radix_tree();
+    for (int i = 0; i < niter; ++i)
+    {
+        tree.entry(key1, "probe_overhead::outer").call_count++;
+        tree.entry(key2, "probe_overhead::inner").call_count++;
+        tree.move_current_to_parent();
+        tree.move_current_to_parent();
+    }
+    EXPECT_TRUE(tree.is_root());
+    EXPECT_EQ(tree.nnode(), 3);
+
+    for (int i = 0; i < niter; ++i)
+    {
+        probe_branch();
+    }
+    EXPECT_TRUE(tree.is_root());
+    EXPECT_EQ(tree.nnode(), 5);
+}
+
 } // namespace detail
 } // namespace modmesh
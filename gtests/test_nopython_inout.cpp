@@ -1,5 +1,7 @@
 #include <modmesh/inout/inout.hpp>
 
+#include <sstream>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
@@ -9,6 +11,125 @@
 
 std::string g_test_file_path;
 
+// The same as tests/data/gmsh_triangle.msh.
+constexpr char const * GMSH_TRIANGLE = R"($MeshFormat
+2.2 0 8
+$EndMeshFormat
+$PhysicalNames
+5
+1 1 "top"
+1 2 "left"
+1 3 "bottom"
+1 4 "right"
+2 5 "domain"
+$EndPhysicalNames
+$Nodes
+4
+1 0 0 0
+2 -1 -1 0
+3 1 -1 0
+4 0 1 0
+$EndNodes
+$Elements
+3
+1 2 2 5 3 1 2 3
+2 2 2 5 3 1 3 4
+3 2 2 5 3 1 4 2
+$EndElements
+)";
+
+TEST(Gmsh_Block, Triangle2DNodeCoordinates)
+{
+    modmesh::inout::Gmsh gmsh(GMSH_TRIANGLE);
+    std::shared_ptr<modmesh::StaticMesh> blk = gmsh.to_block();
+    ASSERT_EQ(blk->ndim(), 2);
+    ASSERT_EQ(blk->nnode(), 4);
+    // Gmsh reads 3 coordinates of each node, and the ghost nodes are built
+    // over the 2 columns of the mesh.
+    modmesh::SimpleArray<double> const & ndcrd = blk->ndcrd();
+    ASSERT_EQ(ndcrd.shape(1), 2);
+    double const golden[4][2] = {{0.0, 0.0}, {-1.0, -1.0}, {1.0, -1.0}, {0.0, 1.0}};
+    for (int it = 0; it < 4; ++it)
+    {
+        EXPECT_EQ(ndcrd(it, 0), golden[it][0]) << "node " << it;
+        EXPECT_EQ(ndcrd(it, 1), golden[it][1]) << "node " << it;
+    }
+}
+
+/// Gmsh text of an n-by-n grid of triangles, 2 of each square.
+std::string make_gmsh_triangle_grid(size_t n)
+{
+    std::ostringstream os;
+    os << "$MeshFormat\n2.2 0 8\n$EndMeshFormat\n$Nodes\n" << (n + 1) * (n + 1) << "\n";
+    for (size_t j = 0; j <= n; ++j)
+    {
+        for (size_t i = 0; i <= n; ++i)
+        {
+            os << j * (n + 1) + i + 1 << " " << i << " " << j << " 0\n";
+        }
+    }
+    os << "$EndNodes\n$Elements\n" << 2 * n * n << "\n";
+    size_t iel = 1;
+    for (size_t j = 0; j < n; ++j)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            size_t const nd = j * (n + 1) + i + 1;
+            os << iel++ << " 2 2 1 1 " << nd << " " << nd + 1 << " " << nd + n + 2 << "\n";
+            os << iel++ << " 2 2 1 1 " << nd << " " << nd + n + 2 << " " << nd + n + 1 << "\n";
+        }
+    }
+    os << "$EndElements\n";
+    return os.str();
+}
+
+TEST(Gmsh_Block, ReorderWithGhost)
+{
+    using modmesh::StaticMesh;
+    std::string const data = make_gmsh_triangle_grid(12);
+    for (auto const method : {StaticMesh::ReorderMethod::ReverseCuthillMcKee, StaticMesh::ReorderMethod::Hilbert, StaticMesh::ReorderMethod::Morton})
+    {
+        std::shared_ptr<StaticMesh> const old = modmesh::inout::Gmsh(data).to_block();
+        std::shared_ptr<StaticMesh> const blk = modmesh::inout::Gmsh(data).to_block();
+        ASSERT_GT(blk->ngstcell(), 0);
+        modmesh::StaticMeshPermutation const perm = blk->reorder(method);
+        std::string const name = StaticMesh::to_string(method);
+
+        ASSERT_EQ(blk->ngstnode(), old->ngstnode()) << name;
+        ASSERT_EQ(blk->ngstface(), old->ngstface()) << name;
+        ASSERT_EQ(blk->ngstcell(), old->ngstcell()) << name;
+        // The interior is permuted.
+        for (size_t it = 0; it < blk->nnode(); ++it)
+        {
+            EXPECT_EQ(blk->ndcrd(it, 0), old->ndcrd(perm.node[it], 0)) << name;
+            EXPECT_EQ(blk->ndcrd(it, 1), old->ndcrd(perm.node[it], 1)) << name;
+        }
+        for (size_t it = 0; it < blk->ncell(); ++it)
+        {
+            EXPECT_EQ(blk->clvol(it), old->clvol(perm.cell[it])) << name;
+        }
+        // The boundary faces keep their order, and so do the ghost entities
+        // built from them.
+        for (size_t it = 0; it < blk->nbound(); ++it)
+        {
+            int32_t const ifc = blk->bndfcs(it, 0);
+            EXPECT_EQ(perm.face[ifc], old->bndfcs(it, 0)) << name;
+            EXPECT_EQ(blk->fccls(ifc, 1), -static_cast<int32_t>(it) - 1) << name;
+        }
+        for (int32_t it = 1; it <= static_cast<int32_t>(blk->ngstnode()); ++it)
+        {
+            EXPECT_EQ(blk->ndcrd(-it, 0), old->ndcrd(-it, 0)) << name;
+            EXPECT_EQ(blk->ndcrd(-it, 1), old->ndcrd(-it, 1)) << name;
+        }
+        for (int32_t it = 1; it <= static_cast<int32_t>(blk->ngstcell()); ++it)
+        {
+            EXPECT_EQ(blk->clvol(-it), old->clvol(-it)) << name;
+            EXPECT_EQ(blk->clcnd(-it, 0), old->clcnd(-it, 0)) << name;
+            EXPECT_EQ(blk->clcnd(-it, 1), old->clcnd(-it, 1)) << name;
+        }
+    }
+}
+
 TEST(Gmsh_Parser, NonCellTypeDefinition)
 {
     auto ele_def = modmesh::inout::GmshElementDef::by_id(0);
@@ -314,3 +435,26 @@ TEST(Gmsh_Parser, Hexahedron125NodeDefinition)
     EXPECT_EQ(ele_def.mmtpn(), 5);
     EXPECT_THAT(ele_def.mmcl(), testing::ElementsAre(0, 1, 2, 3, 4, 5, 6, 7));
 }
+
+TEST(Gmsh_Parser, TextCursor)
+{
+    modmesh::inout::detail::GmshTextCursor cursor("$Nodes\r\n2\n1 0.5 -1e-3 2\n\n  \n$EndNodes");
+    EXPECT_EQ(cursor.next_line(), "$Nodes");
+    size_t nnode = 0;
+    EXPECT_TRUE(cursor.read(nnode));
+    EXPECT_EQ(nnode, 2);
+    size_t ind = 0;
+    double crd[3] = {0.0, 0.0, 0.0};
+    EXPECT_TRUE(cursor.read(ind));
+    EXPECT_TRUE(cursor.read(crd[0]));
+    EXPECT_TRUE(cursor.read(crd[1]));
+    EXPECT_TRUE(cursor.read(crd[2]));
+    EXPECT_EQ(ind, 1);
+    EXPECT_DOUBLE_EQ(crd[0], 0.5);
+    EXPECT_DOUBLE_EQ(crd[1], -1e-3);
+    EXPECT_DOUBLE_EQ(crd[2], 2.0);
+    // A keyword is not a number and the cursor stays.
+    EXPECT_FALSE(cursor.read(ind));
+    EXPECT_EQ(cursor.next_nonempty_line(), "$EndNodes");
+    EXPECT_TRUE(cursor.eof());
+}
@@ -0,0 +1,426 @@
+#include <modmesh/mesh/mesh.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <vector>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+namespace
+{
+
+using modmesh::SimpleArray;
+using modmesh::StaticMesh;
+using modmesh::ThreadPool;
+
+/// Set the thread count and the threshold of the pool, and restore them.
+class ThreadPoolSetting
+{
+
+public:
+
+    ThreadPoolSetting(size_t nthread, size_t threshold)
+        : m_nthread(ThreadPool::instance().nthread())
+        , m_threshold(ThreadPool::instance().threshold())
+    {
+        ThreadPool::instance().set_nthread(nthread);
+        ThreadPool::instance().set_threshold(threshold);
+    }
+
+    ThreadPoolSetting(ThreadPoolSetting const &) = delete;
+    ThreadPoolSetting(ThreadPoolSetting &&) = delete;
+    ThreadPoolSetting & operator=(ThreadPoolSetting const &) = delete;
+    ThreadPoolSetting & operator=(ThreadPoolSetting &&) = delete;
+
+    ~ThreadPoolSetting()
+    {
+        ThreadPool::instance().set_nthread(m_nthread);
+        ThreadPool::instance().set_threshold(m_threshold);
+    }
+
+private:
+
+    size_t m_nthread;
+    size_t m_threshold;
+
+}; /* end class ThreadPoolSetting */
+
+/**
+ * An n-by-n grid of triangles, 2 of each square, with the coordinates in
+ * ncol columns like Gmsh keeps them.  The triangles of the odd squares list
+ * their nodes clockwise when cw_odd is true.
+ */
+std::shared_ptr<StaticMesh> make_triangle_grid(size_t n, size_t ncol, bool cw_odd)
+{
+    size_t const nnode = (n + 1) * (n + 1);
+    size_t const ncell = 2 * n * n;
+    std::shared_ptr<StaticMesh> mh = StaticMesh::construct(2, nnode, 0, ncell);
+    SimpleArray<double> ndcrd(modmesh::small_vector<size_t>{nnode, ncol}, 0.0);
+    for (size_t j = 0; j <= n; ++j)
+    {
+        for (size_t i = 0; i <= n; ++i)
+        {
+            // Perturb the nodes so that the metric is not all the same.
+            ndcrd(j * (n + 1) + i, 0) = static_cast<double>(i) + 0.01 * static_cast<double>((i * 7 + j * 3) % 5);
+            ndcrd(j * (n + 1) + i, 1) = static_cast<double>(j) + 0.01 * static_cast<double>((i * 3 + j * 7) % 5);
+        }
+    }
+    mh->ndcrd().swap(ndcrd);
+    for (size_t j = 0; j < n; ++j)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            int32_t const nd = static_cast<int32_t>(j * (n + 1) + i);
+            int32_t const nn = static_cast<int32_t>(n);
+            bool const cw = cw_odd && (i + j) % 2;
+            size_t const icl = 2 * (j * n + i);
+            mh->cltpn(icl) = mh->cltpn(icl + 1) = modmesh::CellType::TRIANGLE;
+            mh->clnds(icl, 0) = mh->clnds(icl + 1, 0) = 3;
+            mh->clnds(icl, 1) = nd;
+            mh->clnds(icl, 2) = cw ? nd + nn + 2 : nd + 1;
+            mh->clnds(icl, 3) = cw ? nd + 1 : nd + nn + 2;
+            mh->clnds(icl + 1, 1) = nd;
+            mh->clnds(icl + 1, 2) = cw ? nd + nn + 1 : nd + nn + 2;
+            mh->clnds(icl + 1, 3) = cw ? nd + nn + 2 : nd + nn + 1;
+        }
+    }
+    return mh;
+}
+
+/// Whether the arrays, including the ghost rows, are bitwise the same.
+template <typename T>
+::testing::AssertionResult same_array(char const * name, SimpleArray<T> const & lhs, SimpleArray<T> const & rhs)
+{
+    if (lhs.shape() != rhs.shape() || lhs.nghost() != rhs.nghost())
+    {
+        return ::testing::AssertionFailure() << name << ": different shape or ghost";
+    }
+    if (0 != std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T)))
+    {
+        return ::testing::AssertionFailure() << name << ": different values";
+    }
+    return ::testing::AssertionSuccess();
+}
+
+} /* end namespace */
+
+TEST(StaticMesh, build_ghost_wide_ndcrd)
+{
+    // More rows than a chunk, for the parallel copy of the body.
+    size_t const n = 200;
+    ThreadPoolSetting const setting(4, ThreadPool::CHUNK_SIZE);
+
+    // The same mesh having ndcrd of 2 and 3 columns.
+    std::shared_ptr<StaticMesh> const narrow = make_triangle_grid(n, 2, false);
+    std::shared_ptr<StaticMesh> const wide = make_triangle_grid(n, 3, false);
+    ASSERT_GT(wide->ncell(), ThreadPool::CHUNK_SIZE);
+    for (std::shared_ptr<StaticMesh> const & mh : {narrow, wide})
+    {
+        mh->build_interior(true);
+        mh->build_boundary();
+    }
+    // The body copied element by element before the ghost is built.
+    SimpleArray<double> const ndcrd_body = narrow->ndcrd();
+    SimpleArray<int32_t> const clfcs_body = narrow->clfcs();
+
+    narrow->build_ghost();
+    wide->build_ghost();
+
+    ASSERT_EQ(wide->ndcrd().shape(1), 2);
+    ASSERT_EQ(wide->ngstnode(), narrow->ngstnode());
+    for (size_t it = 0; it < wide->nnode(); ++it)
+    {
+        ASSERT_EQ(wide->ndcrd(it, 0), ndcrd_body(it, 0)) << "node " << it;
+        ASSERT_EQ(wide->ndcrd(it, 1), ndcrd_body(it, 1)) << "node " << it;
+    }
+    for (size_t it = 0; it < wide->ncell(); ++it)
+    {
+        for (size_t jt = 0; jt <= StaticMesh::CLMFC; ++jt)
+        {
+            ASSERT_EQ(wide->clfcs(it, jt), clfcs_body(it, jt)) << "cell " << it;
+        }
+    }
+    EXPECT_TRUE(same_array("ndcrd", wide->ndcrd(), narrow->ndcrd()));
+    EXPECT_TRUE(same_array("fccnd", wide->fccnd(), narrow->fccnd()));
+    EXPECT_TRUE(same_array("fcnml", wide->fcnml(), narrow->fcnml()));
+    EXPECT_TRUE(same_array("fcara", wide->fcara(), narrow->fcara()));
+    EXPECT_TRUE(same_array("clcnd", wide->clcnd(), narrow->clcnd()));
+    EXPECT_TRUE(same_array("clvol", wide->clvol(), narrow->clvol()));
+    EXPECT_TRUE(same_array("fctpn", wide->fctpn(), narrow->fctpn()));
+    EXPECT_TRUE(same_array("cltpn", wide->cltpn(), narrow->cltpn()));
+    EXPECT_TRUE(same_array("clgrp", wide->clgrp(), narrow->clgrp()));
+    EXPECT_TRUE(same_array("fcnds", wide->fcnds(), narrow->fcnds()));
+    EXPECT_TRUE(same_array("fccls", wide->fccls(), narrow->fccls()));
+    EXPECT_TRUE(same_array("clnds", wide->clnds(), narrow->clnds()));
+    EXPECT_TRUE(same_array("clfcs", wide->clfcs(), narrow->clfcs()));
+}
+
+TEST(StaticMesh, calc_metric_parallel_bitwise)
+{
+    // The faces and cells span several chunks.
+    size_t const n = 300;
+
+    std::shared_ptr<StaticMesh> serial;
+    {
+        ThreadPoolSetting const setting(1, ThreadPool::CHUNK_SIZE);
+        serial = make_triangle_grid(n, 2, true);
+        serial->build_interior(true);
+    }
+    std::shared_ptr<StaticMesh> parallel;
+    {
+        ThreadPoolSetting const setting(4, ThreadPool::CHUNK_SIZE);
+        parallel = make_triangle_grid(n, 2, true);
+        parallel->build_interior(true);
+    }
+    ASSERT_GT(parallel->nface(), 4 * ThreadPool::CHUNK_SIZE);
+    ASSERT_GT(parallel->ncell(), 2 * ThreadPool::CHUNK_SIZE);
+
+    // The clockwise cells have their faces flipped by the metric.
+    std::shared_ptr<StaticMesh> const unoriented = make_triangle_grid(n, 2, true);
+    unoriented->build_interior(false);
+    size_t nflip = 0;
+    for (size_t ifc = 0; ifc < parallel->nface(); ++ifc)
+    {
+        if (parallel->fcnds(ifc, 1) != unoriented->fcnds(ifc, 1))
+        {
+            ++nflip;
+        }
+    }
+    EXPECT_GT(nflip, ThreadPool::CHUNK_SIZE);
+
+    EXPECT_TRUE(same_array("fcnds", parallel->fcnds(), serial->fcnds()));
+    EXPECT_TRUE(same_array("fccls", parallel->fccls(), serial->fccls()));
+    EXPECT_TRUE(same_array("fccnd", parallel->fccnd(), serial->fccnd()));
+    EXPECT_TRUE(same_array("fcnml", parallel->fcnml(), serial->fcnml()));
+    EXPECT_TRUE(same_array("fcara", parallel->fcara(), serial->fcara()));
+    EXPECT_TRUE(same_array("clcnd", parallel->clcnd(), serial->clcnd()));
+    EXPECT_TRUE(same_array("clvol", parallel->clvol(), serial->clvol()));
+    EXPECT_TRUE(same_array("clfcs", parallel->clfcs(), serial->clfcs()));
+}
+
+TEST(StaticMesh, build_faces_dedup)
+{
+    // Quadrilaterals and triangles on an n-by-n grid, for more faces than a
+    // chunk.
+    size_t const n = 200;
+    ThreadPoolSetting const setting(4, ThreadPool::CHUNK_SIZE);
+
+    std::vector<std::vector<int32_t>> cells;
+    for (size_t j = 0; j < n; ++j)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            int32_t const nd = static_cast<int32_t>(j * (n + 1) + i);
+            int32_t const nn = static_cast<int32_t>(n);
+            if ((i + j) % 3 == 0)
+            {
+                cells.push_back({nd, nd + 1, nd + nn + 2, nd + nn + 1});
+            }
+            else
+            {
+                cells.push_back({nd, nd + 1, nd + nn + 2});
+                cells.push_back({nd, nd + nn + 2, nd + nn + 1});
+            }
+        }
+    }
+    // Edge (p, q) is shared by 3 triangles, and the last 2 triangles have the
+    // same nodes in different orders.
+    int32_t const p = static_cast<int32_t>((n + 1) * (n + 1));
+    int32_t const q = p + 1;
+    int32_t const r = p + 2;
+    int32_t const s = p + 3;
+    cells.push_back({p, q, r});
+    cells.push_back({q, p, s});
+    cells.push_back({p, s, q});
+    size_t const nnode = static_cast<size_t>(s) + 1;
+
+    std::shared_ptr<StaticMesh> mh = StaticMesh::construct(2, nnode, 0, cells.size());
+    for (size_t icl = 0; icl < cells.size(); ++icl)
+    {
+        std::vector<int32_t> const & nds = cells[icl];
+        mh->cltpn(icl) = 3 == nds.size() ? modmesh::CellType::TRIANGLE : modmesh::CellType::QUADRILATERAL;
+        mh->clnds(icl, 0) = static_cast<int32_t>(nds.size());
+        std::copy(nds.begin(), nds.end(), &mh->clnds(icl, 1));
+    }
+    mh->build_interior(false);
+
+    // Reference: map each face to the first face with the same node set,
+    // and number the faces in the order they are first met.
+    std::map<std::vector<int32_t>, int32_t> first;
+    std::vector<std::vector<int32_t>> fcnds;
+    std::vector<std::vector<int32_t>> fccls;
+    std::vector<std::vector<int32_t>> clfcs;
+    for (size_t icl = 0; icl < cells.size(); ++icl)
+    {
+        std::vector<int32_t> const & nds = cells[icl];
+        clfcs.emplace_back();
+        for (size_t it = 0; it < nds.size(); ++it)
+        {
+            std::vector<int32_t> const face{nds[it], nds[(it + 1) % nds.size()]};
+            std::vector<int32_t> key = face;
+            std::sort(key.begin(), key.end());
+            auto const found = first.emplace(key, static_cast<int32_t>(fcnds.size()));
+            int32_t const ifc = found.first->second;
+            if (found.second)
+            {
+                fcnds.push_back(face);
+                fccls.push_back({static_cast<int32_t>(icl), -1});
+            }
+            else if (-1 == fccls[ifc][1])
+            {
+                fccls[ifc][1] = static_cast<int32_t>(icl);
+            }
+            clfcs.back().push_back(ifc);
+        }
+    }
+
+    ASSERT_EQ(mh->nface(), fcnds.size());
+    ASSERT_GT(mh->nface(), ThreadPool::CHUNK_SIZE);
+    for (size_t ifc = 0; ifc < fcnds.size(); ++ifc)
+    {
+        ASSERT_EQ(mh->fctpn(ifc), modmesh::CellType::LINE) << "face " << ifc;
+        ASSERT_EQ(mh->fcnds(ifc, 0), 2) << "face " << ifc;
+        ASSERT_EQ(mh->fcnds(ifc, 1), fcnds[ifc][0]) << "face " << ifc;
+        ASSERT_EQ(mh->fcnds(ifc, 2), fcnds[ifc][1]) << "face " << ifc;
+        ASSERT_EQ(mh->fccls(ifc, 0), fccls[ifc][0]) << "face " << ifc;
+        ASSERT_EQ(mh->fccls(ifc, 1), fccls[ifc][1]) << "face " << ifc;
+    }
+    for (size_t icl = 0; icl < clfcs.size(); ++icl)
+    {
+        ASSERT_EQ(mh->clfcs(icl, 0), static_cast<int32_t>(clfcs[icl].size())) << "cell " << icl;
+        for (size_t it = 0; it < clfcs[icl].size(); ++it)
+        {
+            ASSERT_EQ(mh->clfcs(icl, it + 1), clfcs[icl][it]) << "cell " << icl;
+        }
+    }
+    // The 3rd triangle on edge (p, q) is not recorded in fccls.
+    int32_t const ipq = first.at({p, q});
+    EXPECT_EQ(mh->fccls(ipq, 0), static_cast<int32_t>(cells.size() - 3));
+    EXPECT_EQ(mh->fccls(ipq, 1), static_cast<int32_t>(cells.size() - 2));
+}
+
+TEST(StaticMesh, build_boundary_bc)
+{
+    using modmesh::StaticMeshBC;
+
+    auto make_mesh = []()
+    {
+        std::shared_ptr<StaticMesh> mh = make_triangle_grid(4, 2, false);
+        mh->build_interior(true);
+        return mh;
+    };
+    std::vector<int32_t> bndfaces;
+    {
+        std::shared_ptr<StaticMesh> const mh = make_mesh();
+        for (size_t ifc = 0; ifc < mh->nface(); ++ifc)
+        {
+            if (mh->fccls(ifc, 1) < 0)
+            {
+                bndfaces.push_back(static_cast<int32_t>(ifc));
+            }
+        }
+    }
+    ASSERT_EQ(bndfaces.size(), 16);
+    auto make_bc = [&bndfaces](size_t begin, size_t end)
+    {
+        StaticMeshBC bc(end - begin);
+        for (size_t it = begin; it < end; ++it)
+        {
+            bc.facn()(it - begin, 0) = bndfaces[it % bndfaces.size()];
+        }
+        return bc;
+    };
+
+    // The conditions list the first 10 faces, and the rest go to a new one.
+    {
+        std::shared_ptr<StaticMesh> const mh = make_mesh();
+        mh->add_bc(make_bc(0, 4));
+        mh->add_bc(make_bc(4, 10));
+        mh->build_boundary();
+        ASSERT_EQ(mh->nbound(), 16);
+        ASSERT_EQ(mh->nbcs(), 3);
+        for (size_t it = 0; it < 16; ++it)
+        {
+            EXPECT_EQ(mh->bndfcs(it, 0), bndfaces[it]);
+            EXPECT_EQ(mh->bndfcs(it, 1), it < 4 ? 0 : (it < 10 ? 1 : 2));
+        }
+        EXPECT_EQ(mh->bcs()[1].facn()(0, 1), 4);
+        EXPECT_EQ(mh->bcs()[2].nbound(), 6);
+    }
+
+    // One more face than the boundary has, in the second condition.
+    {
+        std::shared_ptr<StaticMesh> const mh = make_mesh();
+        mh->add_bc(make_bc(0, 10));
+        mh->add_bc(make_bc(10, 17));
+        EXPECT_THROW(mh->build_boundary(), std::invalid_argument);
+    }
+}
+
+TEST(StaticMesh, calc_metric_after_moving_nodes)
+{
+    size_t const n = 8;
+    auto double_nodes = [](StaticMesh & mh)
+    {
+        for (size_t ind = 0; ind < mh.nnode(); ++ind)
+        {
+            mh.ndcrd(ind, 0) *= 2.0;
+            mh.ndcrd(ind, 1) *= 2.0;
+        }
+    };
+    // The mesh built on the doubled nodes, for the expected metric.
+    std::shared_ptr<StaticMesh> const expected = make_triangle_grid(n, 2, true);
+    double_nodes(*expected);
+    expected->build_interior(true);
+    std::shared_ptr<StaticMesh> const original = make_triangle_grid(n, 2, true);
+    original->build_interior(true);
+
+    // Doubling the nodes and recalculating gives the metric of the mesh
+    // built on them.
+    {
+        std::shared_ptr<StaticMesh> const mh = make_triangle_grid(n, 2, true);
+        mh->build_interior(true);
+        double_nodes(*mh);
+        mh->calc_metric();
+        EXPECT_TRUE(same_array("fcnds", mh->fcnds(), expected->fcnds()));
+        EXPECT_TRUE(same_array("fccnd", mh->fccnd(), expected->fccnd()));
+        EXPECT_TRUE(same_array("fcnml", mh->fcnml(), expected->fcnml()));
+        EXPECT_TRUE(same_array("fcara", mh->fcara(), expected->fcara()));
+        EXPECT_TRUE(same_array("clcnd", mh->clcnd(), expected->clcnd()));
+        EXPECT_TRUE(same_array("clvol", mh->clvol(), expected->clvol()));
+    }
+
+    // With the lists of the faces and cells of a moved node, only they are
+    // recalculated.
+    {
+        size_t const ind = (n / 2) * (n + 1) + n / 2;
+        std::shared_ptr<StaticMesh> const moved = make_triangle_grid(n, 2, true);
+        moved->ndcrd(ind, 0) += 0.3;
+        moved->build_interior(true);
+        std::shared_ptr<StaticMesh> const mh = make_triangle_grid(n, 2, true);
+        mh->build_interior(true);
+        mh->ndcrd(ind, 0) += 0.3;
+        modmesh::SimpleArraySpan<int32_t const> const fcs = mh->node_faces().row(static_cast<int32_t>(ind));
+        modmesh::SimpleArraySpan<int32_t const> const cls = mh->node_cells().row(static_cast<int32_t>(ind));
+        std::vector<int32_t> faces(fcs.begin(), fcs.end());
+        std::vector<int32_t> cells(cls.begin(), cls.end());
+        std::sort(faces.begin(), faces.end());
+        std::sort(cells.begin(), cells.end());
+        ASSERT_EQ(cells.size(), 6);
+        mh->calc_metric(&faces, &cells);
+        EXPECT_FALSE(same_array("clvol", mh->clvol(), original->clvol()));
+        EXPECT_TRUE(same_array("fcnds", mh->fcnds(), moved->fcnds()));
+        EXPECT_TRUE(same_array("fccnd", mh->fccnd(), moved->fccnd()));
+        EXPECT_TRUE(same_array("fcnml", mh->fcnml(), moved->fcnml()));
+        EXPECT_TRUE(same_array("fcara", mh->fcara(), moved->fcara()));
+        EXPECT_TRUE(same_array("clcnd", mh->clcnd(), moved->clcnd()));
+        EXPECT_TRUE(same_array("clvol", mh->clvol(), moved->clvol()));
+    }
+}
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,148 @@
+#include <modmesh/mesh/mesh.hpp>
+
+#include <gtest/gtest.h>
+
+#include <mpi.h>
+
+#include <set>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+#ifndef MODMESH_MPI
+#error "MODMESH_MPI should be defined."
+#endif
+
+namespace
+{
+
+using modmesh::HaloExchange;
+using modmesh::SimpleArray;
+using modmesh::StaticMesh;
+using modmesh::StaticMeshGenerator;
+using modmesh::StaticMeshPart;
+
+/// The part of this rank of a mesh decomposed over all the ranks.
+class HaloExchangeTest
+    : public ::testing::Test
+{
+
+protected:
+
+    void SetUp() override
+    {
+        MPI_Comm_rank(MPI_COMM_WORLD, &m_rank);
+        MPI_Comm_size(MPI_COMM_WORLD, &m_size);
+        std::shared_ptr<StaticMesh> const mesh = StaticMeshGenerator(StaticMeshGenerator::Shape::Mixed2D, {16, 12}).generate();
+        mesh->build_interior(true);
+        size_t const npart = static_cast<size_t>(m_size);
+        std::vector<StaticMeshPart> parts = modmesh::decompose_mesh(*mesh, modmesh::partition_cells_rcb(*mesh, npart), npart);
+        m_part = std::move(parts[static_cast<size_t>(m_rank)]);
+    }
+
+    /// The value of element k of the global cell.
+    static double value(int32_t icl, size_t k) { return static_cast<double>(icl) * 10.0 + static_cast<double>(k); }
+
+    /// Owned cells hold their values, and the halo holds -1.
+    SimpleArray<double> make_field(size_t width) const
+    {
+        size_t const ncell = m_part.mesh->ncell();
+        SimpleArray<double> field(modmesh::small_vector<size_t>{ncell, width}, -1.0);
+        for (size_t icl = 0; icl < m_part.nowned_cell; ++icl)
+        {
+            for (size_t k = 0; k < width; ++k)
+            {
+                field(icl, k) = value(m_part.cell_global(icl), k);
+            }
+        }
+        return field;
+    }
+
+    /// Whether all cells, owned and halo, hold their values.
+    ::testing::AssertionResult check_field(SimpleArray<double> const & field) const
+    {
+        for (size_t icl = 0; icl < m_part.mesh->ncell(); ++icl)
+        {
+            for (size_t k = 0; k < field.shape(1); ++k)
+            {
+                if (field(icl, k) != value(m_part.cell_global(icl), k))
+                {
+                    return ::testing::AssertionFailure() << "rank " << m_rank << " cell " << icl << " element " << k
+                                                         << ": " << field(icl, k);
+                }
+            }
+        }
+        return ::testing::AssertionSuccess();
+    }
+
+    int m_rank = 0;
+    int m_size = 0;
+    StaticMeshPart m_part;
+
+}; /* end class HaloExchangeTest */
+
+} /* end namespace */
+
+TEST_F(HaloExchangeTest, exchange)
+{
+    if (m_size > 1)
+    {
+        ASSERT_LT(m_part.nowned_cell, m_part.mesh->ncell());
+    }
+
+    HaloExchange<double> halo(m_part, MPI_COMM_WORLD, 2);
+    SimpleArray<double> field = make_field(2);
+    halo.exchange(field);
+    EXPECT_TRUE(check_field(field));
+
+    // The persistent requests are reused.
+    field = make_field(2);
+    halo.exchange(field);
+    EXPECT_TRUE(check_field(field));
+}
+
+TEST_F(HaloExchangeTest, overlap)
+{
+    HaloExchange<double> halo(m_part, MPI_COMM_WORLD, 1);
+
+    // The interior and border cells split the owned cells, and only the
+    // border cells have halo neighbors.
+    std::set<int32_t> owned(halo.interior_cells().begin(), halo.interior_cells().end());
+    owned.insert(halo.border_cells().begin(), halo.border_cells().end());
+    EXPECT_EQ(owned.size(), m_part.nowned_cell);
+    EXPECT_EQ(halo.interior_cells().size() + halo.border_cells().size(), m_part.nowned_cell);
+    if (m_size > 1)
+    {
+        EXPECT_FALSE(halo.border_cells().empty());
+    }
+    modmesh::StaticMeshAdjacency const & cell_cells = m_part.mesh->cell_cells();
+    for (int32_t const icl : halo.interior_cells())
+    {
+        for (int32_t const jcl : cell_cells.row(icl))
+        {
+            EXPECT_LT(static_cast<size_t>(jcl), m_part.nowned_cell) << "interior cell " << icl;
+        }
+    }
+
+    SimpleArray<double> field = make_field(1);
+    halo.start(field);
+    EXPECT_THROW(halo.start(field), std::runtime_error);
+    halo.finish(field);
+    EXPECT_THROW(halo.finish(field), std::runtime_error);
+    EXPECT_TRUE(check_field(field));
+
+    SimpleArray<double> wrong(modmesh::small_vector<size_t>{m_part.mesh->ncell(), 2}, 0.0);
+    EXPECT_THROW(halo.start(wrong), std::invalid_argument);
+}
+
+int main(int argc, char ** argv)
+{
+    MPI_Init(&argc, &argv);
+    ::testing::InitGoogleTest(&argc, argv);
+    int const result = RUN_ALL_TESTS();
+    MPI_Finalize();
+    return result;
+}
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
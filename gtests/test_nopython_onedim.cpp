@@ -0,0 +1,139 @@
+#include <modmesh/onedim/onedim.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+namespace
+{
+
+using modmesh::SimpleArray;
+using modmesh::onedim::BasicEuler1DCore;
+using modmesh::onedim::BasicEuler1DKernel;
+
+/**
+ * The gradients of march_half_so1_alpha() calculated point by point with
+ * BasicEuler1DKernel, as the solver did before the chunked kernel.  The two
+ * are the same bit for bit when the file is built without FMA contraction.
+ */
+template <size_t ALPHA, typename T>
+void reference_so1(BasicEuler1DCore<T> const & core, bool odd_plane, SimpleArray<T> & so1)
+{
+    using int_type = ssize_t;
+    constexpr int_type nbound = BasicEuler1DCore<T>::BOUND_COUNT;
+    int_type const start = nbound - (odd_plane ? 1 : 0);
+    int_type const stop = static_cast<int_type>(core.ncoord()) - nbound - (odd_plane ? 0 : 1);
+    if (start >= stop)
+    {
+        return;
+    }
+    BasicEuler1DKernel<T> kernxn{};
+    kernxn.set_time_increment(core.time_increment());
+    BasicEuler1DKernel<T> kernxp{};
+    kernxp
+        .set_time_increment(core.time_increment())
+        .set_value(start, core.gamma(), core.coord(), core.so0(), core.so1())
+        .derive();
+    for (int_type ic = start; ic < stop; ic += 2)
+    {
+        kernxn = kernxp;
+        kernxp
+            .set_value(ic + 2, core.gamma(), core.coord(), core.so0(), core.so1())
+            .derive();
+        for (size_t iv = 0; iv < 3; ++iv)
+        {
+            T const utp = core.so0()(ic + 1, iv);
+            T const duxn = (utp - kernxn.up[iv]) / (kernxn.xpos - kernxn.x);
+            T const duxp = (kernxp.up[iv] - utp) / (kernxp.x - kernxp.xneg);
+            T const fan = modmesh::pow<ALPHA>(std::abs(duxn));
+            T const fap = modmesh::pow<ALPHA>(std::abs(duxp));
+            so1(ic + 1, iv) = (fap * duxn + fan * duxp) / (fap + fan + BasicEuler1DKernel<T>::tiny);
+        }
+    }
+}
+
+/// A shock tube on a graded grid, marched for some steps.
+template <typename T>
+std::shared_ptr<BasicEuler1DCore<T>> make_core(size_t ncoord)
+{
+    std::shared_ptr<BasicEuler1DCore<T>> core = BasicEuler1DCore<T>::construct(ncoord, T(0.2) / static_cast<T>(ncoord));
+    core->set_coord(T(-1), T(1), T(1.001));
+    for (size_t it = 0; it < ncoord; ++it)
+    {
+        core->gamma()(it) = T(1.4) + T(0.01) * static_cast<T>(it % 3);
+    }
+    core->set_primitive(
+        [](T x)
+        { return x < T(0) ? std::array<T, 3>{T(1), T(0), T(1)} : std::array<T, 3>{T(0.125), T(0), T(0.1)}; });
+    core->setup_march();
+    core->template march_alpha<2>(20);
+    // Perturb so0, so that so1 is not already its gradient.
+    for (size_t it = 0; it < ncoord; ++it)
+    {
+        for (size_t iv = 0; iv < 3; ++iv)
+        {
+            core->so0()(it, iv) *= T(1) + T(0.001) * static_cast<T>((it + iv) % 7);
+        }
+    }
+    return core;
+}
+
+template <typename T>
+bool same_array(SimpleArray<T> const & lhs, SimpleArray<T> const & rhs)
+{
+    return lhs.shape() == rhs.shape() && 0 == std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T));
+}
+
+template <typename T>
+class Euler1DCoreTest
+    : public ::testing::Test
+{
+}; /* end class Euler1DCoreTest */
+
+using Euler1DCoreTypes = ::testing::Types<double, float>;
+TYPED_TEST_SUITE(Euler1DCoreTest, Euler1DCoreTypes);
+
+} /* end namespace */
+
+TYPED_TEST(Euler1DCoreTest, march_half_so1_alpha_reference)
+{
+    using T = TypeParam;
+    // More than 2 chunks of the CEs, and a partial one.
+    for (size_t ncoord : {9, 2 * 128 * 2 + 77})
+    {
+        std::shared_ptr<BasicEuler1DCore<T>> const core = make_core<T>(ncoord);
+        for (bool odd_plane : {false, true})
+        {
+            SimpleArray<T> expected(core->so1());
+            std::shared_ptr<BasicEuler1DCore<T>> const alpha1 = core->clone();
+            reference_so1<1>(*core, odd_plane, expected);
+            alpha1->template march_half_so1_alpha<1>(odd_plane);
+            EXPECT_TRUE(same_array(alpha1->so1(), expected)) << "ncoord " << ncoord << " odd " << odd_plane;
+
+            expected = SimpleArray<T>(core->so1());
+            std::shared_ptr<BasicEuler1DCore<T>> const alpha2 = core->clone();
+            reference_so1<2>(*core, odd_plane, expected);
+            alpha2->template march_half_so1_alpha<2>(odd_plane);
+            EXPECT_TRUE(same_array(alpha2->so1(), expected)) << "ncoord " << ncoord << " odd " << odd_plane;
+            EXPECT_FALSE(same_array(alpha2->so1(), core->so1())) << "ncoord " << ncoord << " odd " << odd_plane;
+        }
+    }
+}
+
+TYPED_TEST(Euler1DCoreTest, march_alpha_time_skewing)
+{
+    using T = TypeParam;
+    std::shared_ptr<BasicEuler1DCore<T>> const plain = make_core<T>(2 * 128 * 2 + 77);
+    std::shared_ptr<BasicEuler1DCore<T>> const skewed = plain->clone();
+    skewed->set_block_steps(8);
+    plain->template march_alpha<2>(30);
+    skewed->template march_alpha<2>(30);
+    EXPECT_TRUE(same_array(skewed->so0(), plain->so0()));
+    EXPECT_TRUE(same_array(skewed->so1(), plain->so1()));
+}
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -75,4 +75,37 @@ TEST(RadixTree, move_current_pointer)
     EXPECT_EQ(node2, node1);
 }
 
+TEST(RadixTree, many_children)
+{
+    namespace mm = modmesh;
+    mm::RadixTree<mm::TimedEntry> radix_tree;
+    // Enough nodes to grow the lookup table and the arena.
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::string const name = std::to_string(i);
+        radix_tree.entry(name).add_time(1.0);
+        radix_tree.entry(name).add_time(2.0);
+        radix_tree.move_current_to_parent();
+        radix_tree.move_current_to_parent();
+    }
+    radix_tree.entry("7").add_time(1.0);
+    radix_tree.move_current_to_parent();
+
+    EXPECT_EQ(radix_tree.get_unique_node(), 1000);
+    EXPECT_EQ(radix_tree.nnode(), 2001);
+    mm::RadixTreeNode<mm::TimedEntry> const & root = radix_tree.get_root();
+    EXPECT_EQ(root.children().size(), 1000);
+    mm::RadixTreeNode<mm::TimedEntry> const * node = radix_tree.find_child(root, 7);
+    ASSERT_NE(node, nullptr);
+    EXPECT_EQ(node->name(), "7");
+    EXPECT_EQ(node->data().count(), 2);
+    EXPECT_EQ(radix_tree.find_child(*node, 7)->data().count(), 1);
+    EXPECT_EQ(radix_tree.find_child(*node, 8), nullptr);
+
+    radix_tree.reset();
+    EXPECT_EQ(radix_tree.nnode(), 1);
+    EXPECT_TRUE(radix_tree.get_root().children().empty());
+    EXPECT_EQ(radix_tree.find_child(radix_tree.get_root(), 7), nullptr);
+}
+
 // vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
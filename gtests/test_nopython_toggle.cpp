@@ -0,0 +1,60 @@
+#include <modmesh/toggle/toggle.hpp>
+
+#include <gtest/gtest.h>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+namespace mm = modmesh;
+
+TEST(DynamicToggleHandle, read_and_write)
+{
+    mm::DynamicToggleTable table;
+    table.set_int32("steps", 10);
+    table.set_bool("flag", false);
+    table.add_subkey("solver");
+    table.set_real("solver.cfl", 0.8);
+    table.set_string("solver.name", "euler");
+
+    mm::DynamicToggleHandle<int32_t> steps = table.get_handle<int32_t>("steps");
+    mm::DynamicToggleHandle<bool> flag = table.get_handle<bool>("flag");
+    mm::DynamicToggleHandle<double> cfl = table.get_subkey("solver").get_handle<double>("cfl");
+    mm::DynamicToggleHandle<std::string> name = table.get_handle<std::string>("solver.name");
+    EXPECT_TRUE(steps.valid());
+    EXPECT_EQ(steps.get(), 10);
+    EXPECT_FALSE(flag.get());
+    EXPECT_DOUBLE_EQ(cfl.get(), 0.8);
+    EXPECT_EQ(name.get(), "euler");
+
+    // The handles and the keyed access share the storage.
+    uint64_t const epoch = steps.epoch();
+    table.set_int32("steps", 20);
+    EXPECT_EQ(steps.get(), 20);
+    EXPECT_GT(steps.epoch(), epoch);
+    flag.set(true);
+    EXPECT_TRUE(table.get_bool("flag"));
+    EXPECT_GT(table.epoch(), epoch + 1);
+
+    // Adding keys moves the storage but keeps the handles.
+    for (int i = 0; i < 100; ++i)
+    {
+        table.set_int32("key" + std::to_string(i), i);
+    }
+    EXPECT_EQ(steps.get(), 20);
+}
+
+TEST(DynamicToggleHandle, invalid)
+{
+    mm::DynamicToggleTable table;
+    table.set_int32("steps", 10);
+    EXPECT_THROW(table.get_handle<int32_t>("missing"), std::invalid_argument);
+    EXPECT_THROW(table.get_handle<int64_t>("steps"), std::invalid_argument);
+    EXPECT_FALSE(mm::DynamicToggleHandle<int32_t>().valid());
+
+    mm::DynamicToggleHandle<int32_t> steps = table.get_handle<int32_t>("steps");
+    table.clear();
+    EXPECT_FALSE(steps.valid());
+}
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,126 @@
+#include <modmesh/toggle/profile.hpp>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#ifdef Py_PYTHON_H
+#error "Python.h should not be included."
+#endif
+
+namespace mm = modmesh;
+
+class TraceRecorderTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // The scopes record only when switched on.
+        mm::ScopeProfilerStatus::enable();
+        mm::TraceRecorder::me().set_capacity(mm::TraceRecorder::DEFAULT_CAPACITY);
+    }
+
+    void TearDown() override
+    {
+        mm::ScopeProfilerStatus::disable();
+        mm::TraceRecorder::me().disable();
+        mm::TraceRecorder::me().set_capacity(mm::TraceRecorder::DEFAULT_CAPACITY);
+    }
+
+    /// The events of the threads that have any.
+    static std::vector<std::vector<mm::TraceEvent>> recorded()
+    {
+        std::vector<std::vector<mm::TraceEvent>> ret;
+        for (size_t i = 0; i < mm::TraceRecorder::me().nthread(); ++i)
+        {
+            std::vector<mm::TraceEvent> events = mm::TraceRecorder::me().events(i);
+            if (!events.empty())
+            {
+                ret.push_back(std::move(events));
+            }
+        }
+        return ret;
+    }
+};
+
+TEST_F(TraceRecorderTest, disabled)
+{
+    {
+        mm::ScopedTimer const timer("TraceRecorderTest::disabled");
+    }
+    EXPECT_EQ(mm::TraceRecorder::me().nrecorded(), 0);
+}
+
+TEST_F(TraceRecorderTest, scoped_timer)
+{
+    mm::TraceRecorder::me().enable();
+    {
+        mm::ScopedTimer const outer("outer");
+        {
+            mm::ScopedTimer const inner("inner \"quoted\"");
+        }
+    }
+    std::thread thread(
+        []()
+        {
+            mm::ScopedTimer const timer("thread");
+        });
+    thread.join();
+    mm::TraceRecorder::me().disable();
+
+    std::vector<std::vector<mm::TraceEvent>> const threads = recorded();
+    ASSERT_EQ(threads.size(), 2);
+    std::vector<mm::TraceEvent> const & events = threads[0];
+    ASSERT_EQ(events.size(), 4);
+    EXPECT_EQ(events[0].phase, mm::TraceEvent::BEGIN);
+    EXPECT_STREQ(events[0].name, "outer");
+    EXPECT_STREQ(events[1].name, "inner \"quoted\"");
+    EXPECT_EQ(events[2].phase, mm::TraceEvent::END);
+    EXPECT_EQ(events[3].phase, mm::TraceEvent::END);
+    EXPECT_LE(events[0].time, events[1].time);
+    EXPECT_LE(events[2].time, events[3].time);
+    EXPECT_EQ(threads[1].size(), 2);
+
+    std::string const trace = mm::TraceRecorder::me().chrome_trace();
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"inner \\\"quoted\\\"\""), std::string::npos);
+    EXPECT_NE(trace.find("\"thread_name\""), std::string::npos);
+}
+
+TEST_F(TraceRecorderTest, ring)
+{
+    mm::TraceRecorder::me().set_capacity(5);
+    EXPECT_EQ(mm::TraceRecorder::me().capacity(), 8);
+    mm::TraceRecorder::me().enable();
+    {
+        mm::ScopedTimer const outer("outer");
+        for (int i = 0; i < 4; ++i)
+        {
+            mm::ScopedTimer const inner("inner");
+        }
+    }
+    mm::TraceRecorder::me().disable();
+
+    EXPECT_EQ(mm::TraceRecorder::me().nrecorded(), 10);
+    std::vector<std::vector<mm::TraceEvent>> const threads = recorded();
+    ASSERT_EQ(threads.size(), 1);
+    ASSERT_EQ(threads[0].size(), 8);
+    // The beginnings of the outer and the first inner are overwritten.
+    EXPECT_EQ(threads[0][0].phase, mm::TraceEvent::END);
+    EXPECT_STREQ(threads[0][1].name, "inner");
+
+    // The export drops the ends whose beginnings are overwritten.
+    std::string const trace = mm::TraceRecorder::me().chrome_trace();
+    size_t nbegin = 0;
+    size_t nend = 0;
+    for (size_t pos = trace.find("\"ph\":\""); pos != std::string::npos; pos = trace.find("\"ph\":\"", pos + 1))
+    {
+        char const phase = trace[pos + 6];
+        nbegin += mm::TraceEvent::BEGIN == phase;
+        nend += mm::TraceEvent::END == phase;
+    }
+    EXPECT_EQ(nbegin, 3);
+    EXPECT_EQ(nend, 3);
+}
+
+// vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -33,16 +33,37 @@ modmesh: the description of the package is intentionally left blank
 # Use flake8 http://flake8.pycqa.org/en/latest/user/error-codes.html
 
 
+import importlib
+
 from . import core
-from .core import *  # noqa: F401, F403
 from . import apputil  # noqa: F401
-from . import view  # noqa: F401
-from . import spacetime  # noqa: F401
-from . import onedim  # noqa: F401
-from . import system  # noqa: F401
 from . import toggle  # noqa: F401
 
 
+# The submodules and the names of core are loaded on first access, to keep
+# importing the package cheap for the short-lived processes.
+_lazy_submodules = ('view', 'spacetime', 'onedim', 'system')
+# Star import takes the names of core and the submodules, as it did when
+# they were imported eagerly.
+__all__ = core.__all__ + list(_lazy_submodules)
+
+
+def __getattr__(name):
+    if name in core.__all__:
+        value = getattr(core, name)
+    elif name in _lazy_submodules:
+        value = importlib.import_module('.' + name, __name__)
+    else:
+        raise AttributeError(
+            f"module {__name__!r} has no attribute {name!r}")
+    globals()[name] = value
+    return value
+
+
+def __dir__():
+    return sorted(set(globals()) | set(core.__all__) | set(_lazy_submodules))
+
+
 clinfo = core.ProcessInfo.instance.command_line
 
 
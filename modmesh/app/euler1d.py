@@ -283,6 +283,8 @@ class Euler1DApp():
     def __init__(self):
         self.config = SolverConfig()
         self.data_lines = {}
+        # The output arrays of Euler1DCore.fill_quantities().
+        self.quantity_buffers = {}
         self.density = QuantityLine(name="density",
                                     unit=r"$\mathrm{kg}/\mathrm{m}^3$")
         self.data_lines[self.density.name] = [self.density, True]
@@ -480,7 +482,7 @@ class Euler1DApp():
 
         self.st.svr.march_alpha2(steps=steps)
         self.current_step += steps
-        time_current = self.current_step * self.st.svr.time_increment
+        time_current = self.st.svr.time
         self.st.build_field(t=time_current)
         cfl = self.st.svr.cfl
         self.log(f"CFL: min {cfl.min()} max {cfl.max()}")
@@ -593,25 +595,22 @@ class Euler1DApp():
 
         :return: None
         """
-        if self.use_grid_layout:
-            self.density.update(adata=self.st.density_field,
-                                ndata=self.st.svr.density[::2])
-            self.pressure.update(adata=self.st.pressure_field,
-                                 ndata=self.st.svr.pressure[::2])
-            self.velocity.update(adata=self.st.velocity_field,
-                                 ndata=self.st.svr.velocity[::2])
-            self.temperature.update(adata=self.st.temperature_field,
-                                    ndata=self.st.svr.temperature[::2])
-            self.internal_energy.update(adata=(self.st.internal_energy_field),
-                                        ndata=(self.st.svr.
-                                               internal_energy[::2]))
-            self.entropy.update(adata=self.st.entropy_field,
-                                ndata=self.st.svr.entropy[::2])
-        else:
-            for name, data_line in self.data_lines.items():
-                if data_line[1]:
-                    eval(f'(data_line[0].update(adata=self.st.{name}_field,'
-                         f' ndata=self.st.svr.{name}[::2]))')
+        svr = self.st.svr
+        names = [name for name, data_line in self.data_lines.items()
+                 if self.use_grid_layout or data_line[1]]
+        # Fill the quantities in one pass into the arrays kept over frames.
+        quantities = {}
+        for name in names:
+            buf = self.quantity_buffers.get(name)
+            if buf is None or buf.shape != (svr.ncoord,):
+                buf = np.empty(svr.ncoord, dtype='float64')
+                self.quantity_buffers[name] = buf
+            quantities[name] = buf
+        svr.fill_quantities(**quantities)
+        for name in names:
+            self.data_lines[name][0].update(
+                adata=getattr(self.st, f'{name}_field'),
+                ndata=quantities[name][::2])
 
 
 class PlotArea(PuiInQt):
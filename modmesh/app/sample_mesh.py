@@ -135,8 +135,7 @@ w = make_bezier()
 
 
 def make_mesh_viewer(path):
-    data = open(path, 'rb').read()
-    gm = core.Gmsh(data)
+    gm = core.Gmsh.from_file(path)
     mh = gm.to_block()
     return mh
 
@@ -39,10 +39,47 @@ __all__ = [  # noqa: F822
     'wrapper_profiler_status',
     'StopWatch',
     'stop_watch',
+    'ScopeProfilerStatus',
+    'scope_profiler_status',
+    'HardwareCounter',
+    'hardware_counter',
     'TimeRegistry',
     'time_registry',
+    'AllocationTracker',
+    'allocation_tracker',
+    'AllocationScope',
+    'CallProfiler',
+    'call_profiler',
+    'CallProfilerScope',
+    'TraceRecorder',
+    'trace_recorder',
     'ConcreteBuffer',
+    'CompressedBuffer',
+    'QuantizedBuffer',
+    'Checkpoint',
+    'CheckpointWriter',
+    'MemoryResource',
+    'SystemMemoryResource',
+    'PoolMemoryResource',
+    'ArenaMemoryResource',
+    'NumaMemoryResource',
+    'CopyOnWriteMemoryResource',
+    'MemoryResourceScope',
+    'DeviceBackend',
+    'EmulatedDeviceBackend',
+    'get_memory_resource',
+    'set_memory_resource',
+    'get_num_threads',
+    'set_num_threads',
+    'get_pin_threads',
+    'set_pin_threads',
+    'get_parallel_threshold',
+    'set_parallel_threshold',
+    'ArrayExpression',
+    'from_dlpack',
     'Gmsh',
+    'MeshCache',
+    'XdmfWriter',
     'SimpleArray',
     'SimpleArrayBool',
     'SimpleArrayInt8',
@@ -55,10 +92,36 @@ __all__ = [  # noqa: F822
     'SimpleArrayUint64',
     'SimpleArrayFloat32',
     'SimpleArrayFloat64',
+    'SimpleArraySnapshotFloat32',
+    'SimpleArraySnapshotFloat64',
+    'SimpleArrayMonitorFloat32',
+    'SimpleArrayMonitorFloat64',
+    'SimpleArrayViewBool',
+    'SimpleArrayViewInt8',
+    'SimpleArrayViewInt16',
+    'SimpleArrayViewInt32',
+    'SimpleArrayViewInt64',
+    'SimpleArrayViewUint8',
+    'SimpleArrayViewUint16',
+    'SimpleArrayViewUint32',
+    'SimpleArrayViewUint64',
+    'SimpleArrayViewFloat32',
+    'SimpleArrayViewFloat64',
     'StaticGrid1d',
     'StaticGrid2d',
     'StaticGrid3d',
     'StaticMesh',
+    'StaticMeshFp32',
+    'StaticMeshBVH',
+    'StaticMeshLod',
+    'StaticMeshQuality',
+    'StaticMeshGenerator',
+    'StaticMeshPart',
+    'accumulate_upwind_advection',
+    'SparseMatrixFloat64',
+    'SparseMatrixFloat32',
+    'partition_cells_rcb',
+    'decompose_mesh',
     'HierarchicalToggleAccess',
     'Toggle',
     'CommandLineInfo',
@@ -70,10 +133,14 @@ __all__ = [  # noqa: F822
     'interpolate_bernstein',
     'Vector3dFp32',
     'Vector3dFp64',
+    'Vector3dArrayFp32',
+    'Vector3dArrayFp64',
     'Bezier3dFp32',
     'Bezier3dFp64',
     'WorldFp32',
     'WorldFp64',
+    'WorldBVHFp32',
+    'WorldBVHFp64',
     'testhelper',
 ]
 
@@ -86,12 +153,17 @@ except ImportError:
     from . import _modmesh as _impl  # noqa: F401
 
 
-def _load():
-    for name in __all__:
-        globals()[name] = getattr(_impl, name)
+def __getattr__(name):
+    # Take the names from the extension on first access, so that importing
+    # does not register the subsystems of the names that are not used.
+    if name in __all__:
+        value = getattr(_impl, name)
+        globals()[name] = value
+        return value
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
 
 
-_load()
-del _load
+def __dir__():
+    return sorted(set(globals()) | set(__all__))
 
 # vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -8,6 +8,8 @@ One-dimensional Solver for the Euler Equations
 
 import numpy as np
 
+from .. import core
+
 try:
     from _modmesh import onedim as _impl  # noqa: F401
 except ImportError:
@@ -15,9 +17,15 @@ except ImportError:
 
 __all__ = [
     'Euler1DSolver',
+    'Euler1DEnsemble',
+    'ShockTubeCore',
 ]
 
 
+Euler1DEnsemble = _impl.Euler1DEnsemble
+ShockTubeCore = _impl.ShockTubeCore
+
+
 class Euler1DSolver:
     """
     Numerical solver for the one-dimensional Euler equation by using the CESE
@@ -32,13 +40,47 @@ class Euler1DSolver:
     def __getattr__(self, name):
         return getattr(self._core, name)
 
+    def march_alpha2(self, steps, checkpoint_every=0, checkpoint_path=None,
+                     writer=None):
+        """
+        March the solver, optionally saving a checkpoint every
+        checkpoint_every steps (counted by :py:attr:`nstep`).  The
+        checkpoints are saved to checkpoint_path by a background
+        :py:class:`modmesh.core.CheckpointWriter`, so that marching goes on
+        while a checkpoint is written.
+
+        :param steps: Number of steps to march.
+        :param checkpoint_every: Steps between checkpoints; 0 disables them.
+        :param checkpoint_path: File overwritten by each checkpoint.
+        :param writer: The writer to use.  A new one is created and flushed
+            before returning when it is None.
+        :return: None
+        """
+        if not checkpoint_every:
+            self._core.march_alpha2(steps=steps)
+            return
+        if None is checkpoint_path:
+            raise ValueError("checkpoint_path is required with "
+                             "checkpoint_every")
+        own_writer = None is writer
+        if own_writer:
+            writer = core.CheckpointWriter()
+        # The steps are marched in C++ without the GIL, which is taken back
+        # only to hand each checkpoint to the writer.
+        self._core.run_alpha2(
+            steps=steps, every=checkpoint_every,
+            hook=lambda: writer.write(checkpoint_path,
+                                      self._core.checkpoint()))
+        if own_writer:
+            writer.flush()
+
     @staticmethod
     def init_solver(xmin, xmax, ncoord, time_increment, gamma):
         # Create the solver object.
         svr = _impl.Euler1DCore(ncoord=ncoord, time_increment=time_increment)
 
-        # Initialize spatial grid.
-        svr.coord[...] = np.linspace(xmin, xmax, num=ncoord)
+        # Initialize spatial grid, the same as numpy.linspace().
+        svr.set_coord(xmin, xmax)
 
         # Initialize field.
         svr.cfl.fill(0)
@@ -115,6 +157,9 @@ class ShockTube:
         # Numerical solver (Euler1DSolver).
         self.svr = None
 
+        # Exact solution in C++ (ShockTubeCore).
+        self._core = None
+
     def build_numerical(self, xmin, xmax, ncoord, time_increment=0.05,
                         xdiaphragm=0.0):
         """
@@ -137,86 +182,30 @@ class ShockTube:
 
         # Fill gamma.
         self.svr.gamma.fill(self.gamma)
-        # Determine u0 and u2 value at left and right.
-        u0_left = self.density1
-        u0_right = self.density5
-        u2_left = self.svr.calc_u2(self.gamma, self.density1, 0.0,
-                                   self.pressure1)
-        u2_right = self.svr.calc_u2(self.gamma, self.density5, 0.0,
-                                    self.pressure5)
-        # Create Boolean selection arrays for left and right.
-        slct_left = self.svr.coord < xdiaphragm
-        slct_right = np.logical_not(slct_left)
-        # u0
-        self.svr.so0[slct_left, 0] = u0_left
-        self.svr.so0[slct_right, 0] = u0_right
-        # u1
-        self.svr.so0[:, 1] = 0.0
-        # u2
-        self.svr.so0[slct_left, 2] = u2_left
-        self.svr.so0[slct_right, 2] = u2_right
-        # Initialize derivative to zero.
-        self.svr.so1.fill(0)
+        # Zone 1 is left of the diaphragm and zone 5 right, both at rest.
+        # The derivatives are zeroed.
+        self.svr.set_piecewise_primitive(
+            boundaries=[xdiaphragm],
+            density=[self.density1, self.density5],
+            velocity=[0.0, 0.0],
+            pressure=[self.pressure1, self.pressure5])
         # Setup the rest in the solver for time-marching.
         self.svr.setup_march()
 
     def build_constant(self, gamma, pressure1, density1, pressure5, density5):
-        # Set the given value in zones 1 (left) and 5 (right).
+        # The exact solution is solved by ShockTubeCore, given the values in
+        # zones 1 (left) and 5 (right).
+        self._core = ShockTubeCore(gamma=gamma, pressure1=pressure1,
+                                   density1=density1, pressure5=pressure5,
+                                   density5=density5)
         self.gamma = gamma
-        self.velocity1 = 0.0
-        self.pressure1 = pressure1
-        self.density1 = density1
-        self.temperature1 = pressure1 / (density1 * self.R)
-        self.speedofsound1 = self.calc_speedofsound(
-            pressure=pressure1, density=density1)
-        self.internal_energy1 = self.calc_internal_energy(self.pressure1,
-                                                          self.density1)
-        self.entropy1 = self.calc_entropy(self.pressure1, self.density1)
-
-        self.velocity5 = 0.0
-        self.pressure5 = pressure5
-        self.density5 = density5
-        self.temperature5 = pressure5 / (density5 * self.R)
-        self.speedofsound5 = self.calc_speedofsound(
-            pressure=pressure5, density=density5)
-        self.internal_energy5 = self.calc_internal_energy(self.pressure5,
-                                                          self.density5)
-        self.entropy5 = self.calc_entropy(self.pressure5, self.density5)
-
-        # Use the given value to determine the shock strength (between zones 4
-        # and 5).
-        p45 = self.calc_pressure45()
-
-        # Use the normal shock relationship.
-        self.velocity4 = self.calc_velocity4(pressure45=p45)
-        self.pressure4 = p45 * self.pressure5
-        self.density4 = self.calc_density45(pressure45=p45) * self.density5
-        self.temperature4 = self.calc_temperature45(p45) * self.temperature5
-        self.speedofsound4 = self.calc_speedofsound(
-            pressure=self.pressure4, density=self.density4)
-        self.internal_energy4 = self.calc_internal_energy(self.pressure4,
-                                                          self.density4)
-        self.entropy4 = self.calc_entropy(self.pressure4, self.density4)
-
-        _ = np.sqrt((gamma + 1) / (2 * gamma) * (p45 - 1) + 1)
-        self.velocity_shock = self.speedofsound5 * _
+        # Zone 2 is the expansion wave and not constant.
+        for index in (1, 3, 4, 5):
+            for key, value in self._core.zone(index).items():
+                setattr(self, f"{key}{index}", value)
+        self.velocity_shock = self._core.velocity_shock
         self.velocity_con = self.velocity4
 
-        # Velocity and pressure are the same in zones 3 and 4.
-        self.velocity3 = self.velocity4
-        self.pressure3 = self.pressure4
-
-        # Use the expansion wave for density in zone 3.
-        self.density3 = self.calc_density2(x=0, t=0, velocity2=self.velocity3)
-        self.temperature3 = self.calc_temperature2(x=0, t=0,
-                                                   velocity2=self.velocity3)
-        self.internal_energy3 = self.calc_internal_energy(self.pressure3,
-                                                          self.density3)
-        self.entropy3 = self.calc_entropy(self.pressure3, self.density3)
-
-        self.speedofsound3 = self.calc_speedofsound(
-            pressure=self.pressure3, density=self.density3)
-
     def calc_pressure45(self, tolerance=1.e-10, maxiter=50):
         """
         Use secant method to calculate the shock strength.
@@ -225,34 +214,10 @@ class ShockTube:
         :param maxiter: Maximum iterations of the secant method
         :return: Pressure ratio in zones 4 and 5 ($p_4/p_5$)
         """
-        p15 = self.pressure1 / self.pressure5
-        a51 = self.speedofsound5 / self.speedofsound1
-        gamma = self.gamma
-
-        def _f(p45):
-            v = p45 - 1
-            nume = (gamma - 1) * a51 * v
-            deno = np.sqrt(2 * gamma * (2 * gamma + (gamma + 1) * v))
-            v = (1 - nume / deno) ** (-2 * gamma / (gamma - 1))
-            return p15 - p45 * v
-
-        p45prev = p15
-        residue_prev = _f(p45prev)
-        p45 = p45prev / 2
-        residue = _f(p45)
-        slope = (residue - residue_prev) / (p45 - p45prev)
-        count = maxiter
-        while np.abs(residue) > tolerance and count > 0:
-            p45prev = p45
-            p45 -= residue / slope
-            residue_prev = residue
-            residue = _f(p45)
-            slope = (residue - residue_prev) / (p45 - p45prev)
-            # DEBUG
-            # print("count: %d, p45: %f, residue: %f" % (count, p45, residue))
-            count -= 1
-
-        return p45
+        return ShockTubeCore.calc_pressure45(
+            gamma=self.gamma, pressure1=self.pressure1,
+            density1=self.density1, pressure5=self.pressure5,
+            density5=self.density5, tolerance=tolerance, maxiter=maxiter)
 
     def calc_density45(self, pressure45):
         gpn1 = (self.gamma + 1) / (self.gamma - 1)
@@ -304,7 +269,8 @@ class ShockTube:
 
     def build_field(self, t, coord=None):
         """
-        Populate the field data using the analytical solution.
+        Populate the field data using the analytical solution.  The points
+        are calculated by :py:meth:`ShockTubeCore.build_field` in one pass.
 
         :param t:
         :param coord: If None, take the coordinate from the numerical solver.
@@ -312,71 +278,31 @@ class ShockTube:
         """
         if None is coord:
             coord = self.svr.coord[::2]  # Use the numerical solver.
-        self.coord = coord.copy()  # Make a copy; no write back to argument.
-
-        # Determine the zone location and the Boolean selection arrays.
-        loc12, loc23, loc34, loc45 = self.calc_locations(t=t)
-        slct1 = self.coord < loc12
-        slct2 = np.logical_and(self.coord >= loc12, self.coord < loc23)
-        slct3 = np.logical_and(self.coord >= loc23, self.coord < loc34)
-        slct4 = np.logical_and(self.coord >= loc34, self.coord < loc45)
-        slct5 = self.coord >= loc45
+        # Make a copy; no write back to argument.
+        self.coord = np.array(coord, dtype='float64')
 
         # Create the field buffers.
-        self.density_field = np.zeros(self.coord.shape, dtype='float64')
-        self.velocity_field = np.zeros(self.coord.shape, dtype='float64')
-        self.pressure_field = np.zeros(self.coord.shape, dtype='float64')
-        self.temperature_field = np.zeros(self.coord.shape, dtype='float64')
-        self.internal_energy_field = np.zeros(self.coord.shape,
+        self.density_field = np.empty(self.coord.shape, dtype='float64')
+        self.velocity_field = np.empty(self.coord.shape, dtype='float64')
+        self.pressure_field = np.empty(self.coord.shape, dtype='float64')
+        self.temperature_field = np.empty(self.coord.shape, dtype='float64')
+        self.internal_energy_field = np.empty(self.coord.shape,
                                               dtype='float64')
-        self.entropy_field = np.zeros(self.coord.shape, dtype='float64')
-
-        # Set value in the zones whose value is constant.
-        def _set_zone(slct, zone_density, zone_velocity, zone_pressure,
-                      zone_temperature, zone_int_energy, zone_entropy):
-            self.density_field[slct] = zone_density
-            self.velocity_field[slct] = zone_velocity
-            self.pressure_field[slct] = zone_pressure
-            self.temperature_field[slct] = zone_temperature
-            self.internal_energy_field[slct] = zone_int_energy
-            self.entropy_field[slct] = zone_entropy
-
-        _set_zone(slct1, self.density1, self.velocity1, self.pressure1,
-                  self.temperature1, self.internal_energy1, self.entropy1)
-        _set_zone(slct3, self.density3, self.velocity3, self.pressure3,
-                  self.temperature3, self.internal_energy3, self.entropy3)
-        _set_zone(slct4, self.density4, self.velocity4, self.pressure4,
-                  self.temperature4, self.internal_energy4, self.entropy4)
-        _set_zone(slct5, self.density5, self.velocity5, self.pressure5,
-                  self.temperature5, self.internal_energy5, self.entropy5)
-
-        # Expansion wave in zone 2 needs an explicit loop.
-        xidx = np.arange(len(coord), dtype='uint64')
-        for _idx, _x in zip(xidx[slct2], coord[slct2]):
-            self.density_field[_idx] = self.calc_density2(_x, t)
-            self.velocity_field[_idx] = self.calc_velocity2(_x, t)
-            self.pressure_field[_idx] = self.calc_pressure2(_x, t)
-            self.temperature_field[_idx] = self.calc_temperature2(
-                _x, t, self.velocity_field[_idx])
-            self.internal_energy_field[_idx] = self.calc_internal_energy(
-                self.pressure_field[_idx], self.density_field[_idx])
-            self.entropy_field[_idx] = self.calc_entropy(
-                    self.pressure_field[_idx],
-                    self.density_field[_idx])
+        self.entropy_field = np.empty(self.coord.shape, dtype='float64')
+
+        self._core.build_field(
+            t, self.coord,
+            density=self.density_field,
+            velocity=self.velocity_field,
+            pressure=self.pressure_field,
+            temperature=self.temperature_field,
+            internal_energy=self.internal_energy_field,
+            entropy=self.entropy_field)
 
     def calc_locations(self, t):
         """
         Return array of [x_zone12, x_zone23, x_zone34, x_zone45]
         """
-        return np.array([
-            # zone12; use speed of sound in zone 1:
-            -self.speedofsound1 * t,
-            # zone23; the right-most characteristic in zone 2 (expansion wave):
-            (self.velocity3 - self.speedofsound3) * t,
-            # zone34; contact surface moves at the speed ov v_3 = v_4:
-            self.velocity3 * t,
-            # zone45; shock wave speed:
-            self.velocity_shock * t,
-        ], dtype='float64')
+        return self._core.locations(t)
 
 # vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -22,6 +22,7 @@ _toload = [
     'InviscidBurgersSolver',
     'LinearScalarSolver',
     'BadEuler1DSolver',
+    'Euler1DSolver',
 ]
 
 
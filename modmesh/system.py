@@ -117,6 +117,9 @@ def enter_main(argv):
 def exec_code(code):
     try:
         apputil.run_code(code)
+    except KeyboardInterrupt:
+        # The viewer console cancels a command with it.
+        sys.stdout.write("KeyboardInterrupt\n")
     except Exception as e:
         sys.stdout.write("code:\n{}\n".format(code))
         sys.stdout.write("{}: {}\n".format(type(e).__name__, str(e)))
@@ -41,6 +41,7 @@ _from_impl = [  # noqa: F822
     'RPythonConsoleDockWidget',
     'RManager',
     'mgr',
+    'run_on_gui',
 ]
 
 __all__ = _from_impl + [  # noqa: F822
@@ -0,0 +1,153 @@
+# Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# - Redistributions of source code must retain the above copyright notice, this
+#   list of conditions and the following disclaimer.
+# - Redistributions in binary form must reproduce the above copyright notice,
+#   this list of conditions and the following disclaimer in the documentation
+#   and/or other materials provided with the distribution.
+# - Neither the name of the copyright holder nor the names of its contributors
+#   may be used to endorse or promote products derived from this software
+#   without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+import argparse
+import contextlib
+import importlib.util
+import io
+import json
+import os
+import tempfile
+import unittest
+
+
+def _load_bench():
+    path = os.path.join(os.path.dirname(__file__), os.pardir, 'benchmarks',
+                        'modmesh_bench.py')
+    spec = importlib.util.spec_from_file_location('modmesh_bench', path)
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return module
+
+
+bench = _load_bench()
+
+
+def _run(name, real_time, time_unit='ns', **counters):
+    run = {'name': name, 'run_name': name, 'run_type': 'iteration',
+           'real_time': real_time, 'cpu_time': real_time,
+           'time_unit': time_unit}
+    run.update(counters)
+    return run
+
+
+class RooflineTC(unittest.TestCase):
+
+    # The ridge is at 10 FLOP/byte.
+    RESULTS = {
+        'Roofline_probe_stream/1': {'bytes_per_second': 10e9},
+        'Roofline_probe_flops/1': {'flops_per_second': 100e9},
+        # Attainable 10 GFLOP/s, achieved 5: headroom 2.
+        'Roofline_memory/1': {'intensity': 1.0, 'flops_per_second': 5e9,
+                              'bytes_per_second': 5e9},
+        # Attainable 100 GFLOP/s, achieved 80: headroom 1.25.
+        'Roofline_compute/1': {'intensity': 20.0, 'flops_per_second': 80e9,
+                               'bytes_per_second': 4e9},
+        # Attainable 50 GFLOP/s, achieved 10: headroom 5.
+        'Roofline_slow/1': {'intensity': 5.0, 'flops_per_second': 10e9,
+                            'bytes_per_second': 2e9},
+        # Not a roofline kernel.
+        'SimpleArray_sum/1': {'real_ns': 1.0},
+    }
+
+    def test_summarize_counters(self):
+        runs = [
+            _run('Roofline_memory/1', 2.0, 'us', intensity=1.0,
+                 flops_per_second=4e9, bytes_per_second=4e9),
+            _run('Roofline_memory/1', 4.0, 'us', intensity=1.0,
+                 flops_per_second=6e9, bytes_per_second=6e9),
+            _run('Roofline_memory/1', 3.0, 'us', intensity=1.0,
+                 flops_per_second=5e9, bytes_per_second=5e9),
+            dict(_run('Roofline_memory/1', 3.0, 'us'),
+                 run_type='aggregate'),
+        ]
+        result = bench._summarize(runs)['Roofline_memory/1']
+        self.assertEqual(result['repetitions'], 3)
+        self.assertEqual(result['real_ns'], 3000.0)
+        self.assertEqual(result['flops_per_second'], 5e9)
+        self.assertEqual(result['bytes_per_second'], 5e9)
+        self.assertEqual(result['intensity'], 1.0)
+        self.assertNotIn('intensity',
+                         bench._summarize([_run('SimpleArray_sum/1', 1.0)])
+                         ['SimpleArray_sum/1'])
+
+    def test_probe_ceilings(self):
+        ceilings, rows = bench.roofline(self.RESULTS)
+        self.assertEqual(ceilings, {'bandwidth': 10e9, 'peak': 100e9,
+                                    'ridge_intensity': 10.0})
+        # Ranked by the headroom, without the probes.
+        self.assertEqual([row['name'] for row in rows],
+                         ['Roofline_slow/1', 'Roofline_memory/1',
+                          'Roofline_compute/1'])
+        slow, memory, compute = rows
+        self.assertEqual(slow['bound'], 'memory')
+        self.assertEqual(slow['attainable'], 50e9)
+        self.assertAlmostEqual(slow['headroom'], 5.0)
+        self.assertAlmostEqual(slow['efficiency'], 0.2)
+        self.assertEqual(memory['bound'], 'memory')
+        self.assertAlmostEqual(memory['headroom'], 2.0)
+        self.assertEqual(compute['bound'], 'compute')
+        self.assertEqual(compute['attainable'], 100e9)
+        self.assertAlmostEqual(compute['headroom'], 1.25)
+
+    def test_given_ceilings(self):
+        # A bandwidth of 100 GB/s moves the ridge to 1 FLOP/byte.
+        ceilings, rows = bench.roofline(self.RESULTS, bandwidth=100e9)
+        self.assertEqual(ceilings['ridge_intensity'], 1.0)
+        self.assertEqual([row['bound'] for row in rows],
+                         ['compute', 'compute', 'compute'])
+        self.assertEqual([row['name'] for row in rows],
+                         ['Roofline_memory/1', 'Roofline_slow/1',
+                          'Roofline_compute/1'])
+
+    def test_no_ceilings(self):
+        results = {name: result for name, result in self.RESULTS.items()
+                   if not name.startswith('Roofline_probe_')}
+        with self.assertRaises(ValueError):
+            bench.roofline(results)
+        _, rows = bench.roofline(results, bandwidth=10e9, peak=100e9)
+        self.assertEqual(len(rows), 3)
+
+    def test_cmd_roofline(self):
+        with tempfile.TemporaryDirectory() as tmpdir:
+            result = os.path.join(tmpdir, 'result.json')
+            out = os.path.join(tmpdir, 'roofline.json')
+            with open(result, 'w') as fobj:
+                json.dump({'results': self.RESULTS}, fobj)
+            args = argparse.Namespace(result=result, bandwidth=None,
+                                      peak=200.0, out=out)
+            stdout = io.StringIO()
+            with contextlib.redirect_stdout(stdout):
+                self.assertEqual(bench.cmd_roofline(args), 0)
+            self.assertIn("peak 200.00 GFLOP/s, ridge at 20.000 FLOP/byte",
+                          stdout.getvalue())
+            with open(out) as fobj:
+                data = json.load(fobj)
+        self.assertEqual(data['ceilings']['peak'], 200e9)
+        self.assertEqual(data['kernels'][0]['name'], 'Roofline_slow/1')
+        self.assertEqual(data['kernels'][-1]['bound'], 'memory')
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
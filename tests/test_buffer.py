@@ -25,6 +25,8 @@
 # POSSIBILITY OF SUCH DAMAGE.
 
 
+import os
+import tempfile
 import unittest
 
 import numpy as np
@@ -69,6 +71,31 @@ class ConcreteBufferBasicTC(unittest.TestCase):
         buf2[5] = 19
         self.assertEqual(19, ndarr2[5])
 
+    def test_ConcreteBuffer_alignment(self):
+
+        buf = modmesh.ConcreteBuffer(100)
+        self.assertEqual(0, buf.alignment)
+
+        buf = modmesh.ConcreteBuffer(100, alignment=64)
+        self.assertEqual(64, buf.alignment)
+        self.assertEqual(0, buf.ndarray.ctypes.data % 64)
+        self.assertEqual(64, buf.clone().alignment)
+
+        with self.assertRaisesRegex(
+                ValueError,
+                "ConcreteBuffer: alignment 24 is not a power of 2"
+        ):
+            modmesh.ConcreteBuffer(100, alignment=24)
+
+        self.assertEqual(0, modmesh.ConcreteBuffer.get_default_alignment())
+        modmesh.ConcreteBuffer.set_default_alignment(256)
+        try:
+            sarr = modmesh.SimpleArrayFloat64((4, 3))
+            self.assertEqual(256, sarr.alignment)
+            self.assertEqual(0, sarr.ndarray.ctypes.data % 256)
+        finally:
+            modmesh.ConcreteBuffer.set_default_alignment(0)
+
     def test_ConcreteBuffer_from_ndarray(self):
 
         buf = modmesh.ConcreteBuffer(24)
@@ -86,6 +113,305 @@ class ConcreteBufferBasicTC(unittest.TestCase):
         self.assertTrue((ndarr == 0).all())
 
 
+class ConcreteBufferMmapTC(unittest.TestCase):
+
+    def setUp(self):
+        fd, self.path = tempfile.mkstemp(suffix='.bin')
+        os.close(fd)
+        np.arange(24, dtype='float64').tofile(self.path)
+
+    def tearDown(self):
+        os.remove(self.path)
+
+    def test_readonly(self):
+        buf = modmesh.ConcreteBuffer.mmap(self.path)
+        self.assertTrue(buf.is_mapped)
+        self.assertTrue(buf.is_readonly)
+        self.assertEqual(24 * 8, buf.nbytes)
+        self.assertFalse(buf.ndarray.flags.writeable)
+        with self.assertRaisesRegex(
+                RuntimeError,
+                "ConcreteBuffer: cannot write to read-only buffer"
+        ):
+            buf[0] = 1
+
+        sarr = modmesh.SimpleArrayFloat64((2, 3, 4), buffer=buf)
+        self.assertEqual(np.arange(24).reshape((2, 3, 4)).tolist(),
+                         sarr.ndarray.tolist())
+        self.assertFalse(sarr.ndarray.flags.writeable)
+        with self.assertRaisesRegex(
+                RuntimeError,
+                "SimpleArray: cannot write to read-only buffer"
+        ):
+            sarr[0, 0, 0] = 1.0
+
+    def test_copy_on_write(self):
+        buf = modmesh.ConcreteBuffer.mmap(self.path, mode="c",
+                                          offset=8 * 4, nbytes=8 * 8)
+        self.assertFalse(buf.is_readonly)
+        sarr = modmesh.SimpleArrayFloat64((8,), buffer=buf)
+        self.assertEqual(list(range(4, 12)), sarr.ndarray.tolist())
+        sarr[0] = -1.0
+        self.assertEqual(4.0, np.fromfile(self.path)[4])
+
+    def test_read_write(self):
+        buf = modmesh.ConcreteBuffer.mmap(self.path, mode="r+")
+        sarr = modmesh.SimpleArrayFloat64((24,), buffer=buf)
+        sarr[2] = -2.0
+        del sarr, buf
+        self.assertEqual(-2.0, np.fromfile(self.path)[2])
+
+    def test_error(self):
+        with self.assertRaisesRegex(ValueError, 'unsupported mode "w"'):
+            modmesh.ConcreteBuffer.mmap(self.path, mode="w")
+        with self.assertRaisesRegex(IndexError, "exceeds file size 192"):
+            modmesh.ConcreteBuffer.mmap(self.path, offset=8, nbytes=192)
+
+
+class MemoryResourceTC(unittest.TestCase):
+
+    def test_pool(self):
+        pool = modmesh.PoolMemoryResource()
+        self.assertEqual("PoolMemoryResource", pool.name)
+        with modmesh.MemoryResourceScope(pool):
+            self.assertIs(pool, modmesh.get_memory_resource())
+            for _ in range(10):
+                sarr = modmesh.SimpleArrayFloat64((100,))
+                del sarr
+        self.assertIsNone(modmesh.get_memory_resource())
+        stats = pool.stats
+        self.assertEqual(10, stats["allocate_count"])
+        self.assertEqual(10, stats["deallocate_count"])
+        self.assertEqual(1, stats["upstream_allocate_count"])
+        self.assertEqual(0, stats["bytes_in_use"])
+        self.assertEqual(800, stats["peak_bytes_in_use"])
+        self.assertEqual(1024, pool.cached_bytes)
+        pool.release()
+        self.assertEqual(0, pool.cached_bytes)
+
+    def test_arena(self):
+        arena = modmesh.ArenaMemoryResource(chunk_size=1024)
+        modmesh.set_memory_resource(arena)
+        try:
+            sarr = modmesh.SimpleArrayInt32((16,))
+            self.assertEqual(1, arena.live_count)
+            with self.assertRaisesRegex(
+                    RuntimeError,
+                    r"ArenaMemoryResource: cannot reset with 1 live"
+            ):
+                arena.reset()
+            del sarr
+        finally:
+            modmesh.set_memory_resource(None)
+        self.assertEqual(0, arena.live_count)
+        arena.reset()
+        self.assertEqual(1, arena.nchunk)
+
+    def test_numa(self):
+        self.assertGreaterEqual(modmesh.NumaMemoryResource.node_count(), 1)
+        with self.assertRaisesRegex(ValueError, r"unknown policy"):
+            modmesh.NumaMemoryResource(policy="spread")
+        numa = modmesh.NumaMemoryResource()
+        self.assertEqual("first_touch", numa.policy)
+        with modmesh.MemoryResourceScope(numa):
+            sarr = modmesh.SimpleArrayFloat64((1000,), 2.0)
+        self.assertEqual(2000.0, sarr.sum())
+        page_size = modmesh.NumaMemoryResource.page_size()
+        self.assertEqual(0, numa.stats["upstream_bytes"] % page_size)
+        del sarr
+        self.assertEqual(0, numa.stats["upstream_bytes"])
+
+    def test_copy_on_write(self):
+        cow = modmesh.CopyOnWriteMemoryResource()
+        with modmesh.MemoryResourceScope(cow):
+            buf = modmesh.ConcreteBuffer(8000)
+        src = buf.ndarray.view('float64')
+        src.fill(2.0)
+        cpy = buf.clone()
+        self.assertEqual(2 * buf.nbytes, cow.stats["bytes_in_use"])
+        ndarr = cpy.ndarray.view('float64')
+        ndarr[0] = 3.0
+        self.assertEqual(2.0, src[0])
+        self.assertEqual(3.0, ndarr[0])
+        if modmesh.CopyOnWriteMemoryResource.is_supported():
+            self.assertEqual(1, cow.shared_clone_count)
+            self.assertEqual(0, cow.copied_clone_count)
+
+
+class DeviceMirrorTC(unittest.TestCase):
+
+    def test_lazy_sync(self):
+        backend = modmesh.EmulatedDeviceBackend()
+        self.assertEqual("EmulatedDeviceBackend", backend.name)
+        sarr = modmesh.SimpleArrayFloat64(array=np.arange(100.0))
+        self.assertIsNone(sarr.device_state)
+        self.assertEqual(0, sarr.device_address)
+        with self.assertRaisesRegex(RuntimeError, r"before to_device"):
+            sarr.modify_device()
+
+        self.assertIs(sarr, sarr.to_device(backend))
+        self.assertEqual("synced", sarr.device_state)
+        self.assertNotEqual(0, sarr.device_address)
+        stats = backend.stats
+        self.assertEqual(1, stats['to_device_count'])
+        self.assertEqual(800, stats['to_device_bytes'])
+        self.assertEqual(800, stats['device_bytes_in_use'])
+
+        # Steps on the device copy nothing until the host asks.
+        for _ in range(10):
+            sarr.to_device(backend)
+        sarr.modify_device()
+        self.assertEqual("device_modified", sarr.device_state)
+        with self.assertRaisesRegex(RuntimeError, r"sync the host first"):
+            sarr.modify_host()
+        sarr.to_host()
+        sarr.to_host()
+        self.assertEqual("synced", sarr.device_state)
+        stats = backend.stats
+        self.assertEqual(1, stats['to_device_count'])
+        self.assertEqual(1, stats['to_host_count'])
+        np.testing.assert_equal(sarr.ndarray, np.arange(100.0))
+
+        sarr.ndarray[0] = -1.0
+        sarr.modify_host()
+        self.assertEqual("host_modified", sarr.device_state)
+        sarr.to_device()
+        self.assertEqual(2, backend.stats['to_device_count'])
+        with self.assertRaisesRegex(ValueError, r"already mirrored"):
+            sarr.to_device(modmesh.EmulatedDeviceBackend())
+
+    def test_default(self):
+        backend = modmesh.DeviceBackend.get_default()
+        self.assertIsNotNone(backend)
+        self.assertIs(backend, modmesh.DeviceBackend.get_default())
+        emulated = modmesh.EmulatedDeviceBackend()
+        modmesh.DeviceBackend.set_default(emulated)
+        try:
+            sarr = modmesh.SimpleArrayInt32((16,), 3)
+            sarr.to_device()
+            self.assertEqual(1, emulated.stats['to_device_count'])
+        finally:
+            modmesh.DeviceBackend.set_default(backend)
+
+
+@unittest.skipUnless(hasattr(modmesh.core._impl, "MetalArrayKernel")
+                     and "TEST_METAL" in os.environ,
+                     "Metal kernels are not built")
+class MetalArrayKernelTC(unittest.TestCase):
+
+    def setUp(self):
+        self.kernel = modmesh.core._impl.MetalArrayKernel.me
+        self.resource = modmesh.core._impl.MetalMemoryResource()
+
+    def _make(self, ndarr):
+        with modmesh.MemoryResourceScope(self.resource):
+            sarr = modmesh.SimpleArrayFloat32(ndarr.shape)
+        sarr.ndarray[...] = ndarr
+        return sarr
+
+    def test_offloadable(self):
+        kernel = self.kernel
+        sarr = self._make(np.zeros(1000, dtype='float32'))
+        self.assertFalse(kernel.offloadable(sarr))
+        threshold = kernel.threshold
+        kernel.threshold = 100
+        try:
+            self.assertTrue(kernel.offloadable(sarr))
+            self.assertFalse(kernel.offloadable(
+                modmesh.SimpleArrayFloat32(1000)))
+            self.assertFalse(kernel.offloadable(
+                modmesh.SimpleArrayFloat64(1000)))
+        finally:
+            kernel.threshold = threshold
+        with self.assertRaisesRegex(ValueError, r"MetalMemoryResource"):
+            kernel.fill(modmesh.SimpleArrayFloat32(10), 1.0, offload=True)
+        with self.assertRaisesRegex(ValueError, r"array of double"):
+            kernel.sum(modmesh.SimpleArrayFloat64(10), offload=True)
+
+    def test_elementwise(self):
+        kernel = self.kernel
+        rng = np.random.default_rng(17)
+        x = rng.random(1000003).astype('float32')
+        y = rng.random(1000003).astype('float32')
+        sx = self._make(x)
+        sy = self._make(y)
+        kernel.axpby(2.0, sx, 0.5, sy, offload=True)
+        np.testing.assert_allclose(sy.ndarray, 2.0 * x + 0.5 * y, rtol=1e-6)
+        kernel.fill(sy, 3.0, offload=True)
+        np.testing.assert_equal(sy.ndarray, 3.0)
+
+    def test_reduce(self):
+        kernel = self.kernel
+        ndarr = np.random.default_rng(19).random(3000017).astype('float32')
+        sarr = self._make(ndarr)
+        for offload in (False, True):
+            self.assertEqual(ndarr.min(), kernel.min(sarr, offload=offload))
+            self.assertEqual(ndarr.max(), kernel.max(sarr, offload=offload))
+            # The GPU sums in a different order.
+            self.assertAlmostEqual(
+                ndarr.sum(dtype='float64') / ndarr.size,
+                kernel.sum(sarr, offload=offload) / ndarr.size, places=4)
+        darr = modmesh.SimpleArrayFloat64(array=ndarr.astype('float64'))
+        self.assertEqual(ndarr.max(), kernel.max(darr))
+
+
+class CompressedBufferTC(unittest.TestCase):
+
+    def test_array_round_trip(self):
+        ndarr = np.repeat(np.linspace(300.0, 310.0, 1000), 64).reshape((-1, 4))
+        sarr = modmesh.SimpleArrayFloat64(array=ndarr)
+        compressed = sarr.compress(block_size=1 << 16)
+        self.assertEqual(ndarr.nbytes, compressed.nbytes)
+        self.assertEqual(8, compressed.element_size)
+        self.assertEqual(ndarr.shape, compressed.shape)
+        self.assertGreater(compressed.ratio, 3.0)
+        restored = modmesh.SimpleArrayFloat64.from_compressed(compressed)
+        self.assertEqual(ndarr.tolist(), restored.ndarray.tolist())
+        with self.assertRaisesRegex(ValueError, r"element size 8 differs"):
+            modmesh.SimpleArrayFloat32.from_compressed(compressed)
+
+    def test_buffer(self):
+        buf = modmesh.ConcreteBuffer(10000)
+        buf.ndarray.fill(3)
+        compressed = modmesh.CompressedBuffer(buf, element_size=1,
+                                              block_size=4096)
+        self.assertEqual(3, compressed.nblock)
+        restored = compressed.decompress(parallel=True)
+        self.assertEqual(buf.nbytes, restored.nbytes)
+        self.assertTrue((restored.ndarray == 3).all())
+        with self.assertRaisesRegex(ValueError, r"multiple of the element"):
+            modmesh.CompressedBuffer(buf, element_size=8, block_size=100)
+
+
+class QuantizedBufferTC(unittest.TestCase):
+
+    def test_round_trip(self):
+        x = np.linspace(0.0, 1.0, 20000)
+        ndarr = np.stack([np.sin(6 * x), 300 + np.cos(3 * x), x * x], axis=1)
+        ndarr[5, 1] = np.inf
+        sarr = modmesh.SimpleArrayFloat64(array=ndarr)
+        quantized = modmesh.QuantizedBuffer(sarr, tolerance=1.e-5,
+                                            block_size=1 << 12)
+        self.assertEqual(ndarr.nbytes, quantized.nbytes)
+        self.assertEqual(ndarr.shape, quantized.shape)
+        self.assertEqual(3, quantized.stride)
+        self.assertEqual(1, quantized.noutlier)
+        self.assertGreater(quantized.ratio, 20.0)
+        restored = quantized.decompress(parallel=True).ndarray
+        self.assertEqual(np.inf, restored[5, 1])
+        finite = np.isfinite(ndarr)
+        self.assertLessEqual(np.abs(restored - ndarr)[finite].max(), 1.e-5)
+
+        single = modmesh.SimpleArrayFloat32(array=ndarr[:, 0].copy()
+                                            .astype('float32'))
+        restored = modmesh.QuantizedBuffer(single, tolerance=1.e-3) \
+            .decompress().ndarray
+        self.assertEqual(np.float32, restored.dtype)
+        self.assertLessEqual(np.abs(restored - single.ndarray).max(), 1.e-3)
+        with self.assertRaisesRegex(ValueError, r"must be positive"):
+            modmesh.QuantizedBuffer(sarr, tolerance=0.0)
+
+
 class SimpleArrayBasicTC(unittest.TestCase):
 
     def test_SimpleArray(self):
@@ -137,6 +463,45 @@ class SimpleArrayBasicTC(unittest.TestCase):
         self.assertEqual((1, 24), sarr.reshape((1, 24)).shape)
         self.assertEqual((12, 2), sarr.reshape((12, 2)).shape)
 
+    def test_SimpleArray_alignment(self):
+
+        sarr = modmesh.SimpleArrayFloat64((5, 3), alignment=64)
+        self.assertEqual((5, 3), sarr.shape)
+        self.assertEqual(64, sarr.alignment)
+        self.assertEqual(0, sarr.ndarray.ctypes.data % 64)
+
+    def test_SimpleArray_epoch(self):
+
+        sarr = modmesh.SimpleArrayFloat64((4, 3), 1.0)
+        sarr2 = modmesh.SimpleArrayFloat64((4, 3), 1.0)
+        self.assertNotEqual(sarr.epoch, sarr2.epoch)
+
+        # Reading does not change the epoch.
+        epoch = sarr.epoch
+        self.assertEqual(1.0, sarr[0, 0])
+        self.assertEqual(epoch, sarr.epoch)
+
+        # The writing paths bump it.
+        sarr[0, 0] = 2.0
+        self.assertGreater(sarr.epoch, epoch)
+        epoch = sarr.epoch
+        sarr.fill(3.0)
+        self.assertGreater(sarr.epoch, epoch)
+        epoch = sarr.epoch
+        self.assertIs(sarr, sarr.bump_epoch())
+        self.assertGreater(sarr.epoch, epoch)
+        # A writable ndarray may be written behind the array.
+        epoch = sarr.epoch
+        sarr.ndarray[1, 1] = 4.0
+        self.assertGreater(sarr.epoch, epoch)
+
+        # The arrays sharing a buffer share the epoch.
+        view = sarr.reshape((12,))
+        self.assertEqual(sarr.epoch, view.epoch)
+        view.fill(5.0)
+        self.assertEqual(sarr.epoch, view.epoch)
+        self.assertNotEqual(sarr.epoch, sarr2.epoch)
+
     def test_SimpleArray_ghost_1d(self):
 
         sarr = modmesh.SimpleArrayFloat64(4 * 3 * 2)
@@ -540,6 +905,25 @@ class SimpleArrayBasicTC(unittest.TestCase):
         ndarr[::2, ::3, ::, :, ::1] = ndarr_input[...]
         check(sarr, ndarr)
 
+    def test_SimpleArray_broadcast_slice_start(self):
+        sarr = modmesh.SimpleArrayFloat64((10, 6))
+        sarr.fill(-1)
+        ndarr = np.full((10, 6), -1.0)
+        src = np.arange(3 * 2, dtype='int32').reshape((3, 2))
+        sarr[2:8:2, 1:5:2] = src
+        ndarr[2:8:2, 1:5:2] = src
+        np.testing.assert_equal(sarr.ndarray, ndarr)
+
+        # A large contiguous assignment takes the memcpy path.
+        sarr = modmesh.SimpleArrayFloat64((300, 400))
+        src = np.random.rand(300, 400)
+        sarr[...] = src
+        np.testing.assert_equal(sarr.ndarray, src)
+        # Transposed input takes the strided path.
+        sarr = modmesh.SimpleArrayFloat64((400, 300))
+        sarr[...] = src.T
+        np.testing.assert_equal(sarr.ndarray, src.T)
+
     def test_SimpleArray_broadcast_slice_shape(self):
         ndarr = np.arange(2 * 3 * 4, dtype='float64').reshape((2, 3, 4))
 
@@ -665,6 +1049,35 @@ class SimpleArrayBasicTC(unittest.TestCase):
         self.assertEqual(
             str(type(arrayplex_int32_2)), "<class '_modmesh.SimpleArray'>")
 
+    def test_SimpleArrayPlex_bulk(self):
+        plex = modmesh.SimpleArray((2, 3), value=4, dtype="uint32")
+        self.assertEqual(plex.dtype, "uint32")
+        self.assertEqual(plex.shape, (2, 3))
+        self.assertEqual(plex.ndim, 2)
+        self.assertEqual(plex.size, 6)
+        self.assertEqual(plex.nbytes, 24)
+        self.assertEqual(plex.sum(), 24)
+        # The value of uint32 is not truncated to int32.
+        plex.fill(2 ** 31 + 1)
+        self.assertEqual(plex.max(), 2 ** 31 + 1)
+        with self.assertRaisesRegex(RuntimeError, "expected Python int"):
+            plex.fill(1.5)
+
+        converted = plex.astype("float64")
+        self.assertEqual(converted.dtype, "float64")
+        self.assertEqual(converted.min(), float(2 ** 31 + 1))
+
+        ndarr = np.arange(-3, 3, dtype='int64').reshape((2, 3))
+        plex = modmesh.SimpleArray(ndarr)
+        self.assertEqual(plex.dtype, "int64")
+        self.assertEqual(plex.min(), -3)
+        target = modmesh.SimpleArray((6,), dtype="float32")
+        target.copy_from(plex)
+        np.testing.assert_equal(
+            target.typed.ndarray, ndarr.ravel().astype('float32'))
+        with self.assertRaises(ValueError):
+            target.copy_from(modmesh.SimpleArray((5,), dtype="int64"))
+
 
 class SimpleArrayCalculatorsTC(unittest.TestCase):
 
@@ -701,6 +1114,390 @@ class SimpleArrayCalculatorsTC(unittest.TestCase):
         sarr = sarr.abs()
         self.assertEqual(sarr.sum(), True)
 
+    def test_abs_out(self):
+        ndarr = np.arange(-50, 50, dtype='float64').reshape((4, 25))
+        sarr = modmesh.SimpleArrayFloat64(array=ndarr.copy())
+        out = modmesh.SimpleArrayFloat64(shape=(4, 25), value=0)
+        ret = sarr.abs(out=out)
+        self.assertIs(ret, out)
+        np.testing.assert_equal(out.ndarray, np.abs(ndarr))
+        self.assertEqual(sarr[0, 0], -50)
+
+        with self.assertRaisesRegex(
+                ValueError,
+                r"SimpleArray: abs output must have the same shape"):
+            sarr.abs(out=modmesh.SimpleArrayFloat64(shape=(100,)))
+
+        ret = sarr.abs_inplace()
+        self.assertIs(ret, sarr)
+        np.testing.assert_equal(sarr.ndarray, np.abs(ndarr))
+
+    def test_parallel(self):
+        nthread = modmesh.get_num_threads()
+        threshold = modmesh.get_parallel_threshold()
+        pin = modmesh.get_pin_threads()
+        try:
+            modmesh.set_num_threads(4)
+            self.assertEqual(modmesh.get_num_threads(), 4)
+            modmesh.set_parallel_threshold(1024)
+            self.assertEqual(modmesh.get_parallel_threshold(), 1024)
+
+            ndarr = np.sin(np.arange(300000, dtype='float64'))
+            sarr = modmesh.SimpleArrayFloat64(array=ndarr)
+            # The reduction tree does not depend on the threads.
+            self.assertEqual(sarr.sum(parallel=True), sarr.sum(parallel=False))
+            self.assertEqual(sarr.sum(), sarr.sum(parallel=False))
+            self.assertEqual(sarr.min(parallel=True), ndarr.min())
+            self.assertEqual(sarr.max(parallel=True), ndarr.max())
+            self.assertAlmostEqual(sarr.sum(), ndarr.sum(), places=8)
+
+            sarr.fill(2.0, parallel=True)
+            self.assertEqual(sarr.sum(), 2.0 * 300000)
+
+            # Pinning the workers does not change the results.
+            modmesh.set_pin_threads(True)
+            self.assertTrue(modmesh.get_pin_threads())
+            self.assertEqual(sarr.sum(parallel=True), 2.0 * 300000)
+        finally:
+            modmesh.set_num_threads(nthread)
+            modmesh.set_parallel_threshold(threshold)
+            modmesh.set_pin_threads(pin)
+
+    def test_minmaxsum_large(self):
+        # Cover both the vectorized blocks and the scalar tails.
+        for dtype, cls in (('float32', modmesh.SimpleArrayFloat32),
+                           ('float64', modmesh.SimpleArrayFloat64),
+                           ('int32', modmesh.SimpleArrayInt32)):
+            ndarr = ((np.arange(1027) * 37 % 101) - 50).astype(dtype)
+            sarr = cls(array=ndarr)
+            self.assertEqual(sarr.min(), ndarr.min())
+            self.assertEqual(sarr.max(), ndarr.max())
+            self.assertEqual(sarr.sum(), ndarr.sum())
+
+    def test_reduce_axis(self):
+        ndarr = ((np.arange(4 * 300 * 6) * 37 % 101) - 50).astype('int64')
+        ndarr = ndarr.reshape((4, 300, 6))
+        sarr = modmesh.SimpleArrayInt64(array=ndarr)
+        for axis in range(3):
+            for parallel in (None, False, True):
+                np.testing.assert_equal(
+                    sarr.sum_axis(axis, parallel=parallel).ndarray,
+                    ndarr.sum(axis=axis))
+            np.testing.assert_equal(sarr.min_axis(axis).ndarray,
+                                    ndarr.min(axis=axis))
+            np.testing.assert_equal(sarr.max_axis(axis).ndarray,
+                                    ndarr.max(axis=axis))
+
+        ndarr = np.sin(np.arange(1000 * 5, dtype='float64')).reshape((-1, 5))
+        sarr = modmesh.SimpleArrayFloat64(array=ndarr)
+        np.testing.assert_allclose(sarr.mean_axis(0).ndarray,
+                                   ndarr.mean(axis=0), rtol=1e-12)
+        out = modmesh.SimpleArrayFloat64(shape=(1000,), value=0)
+        ret = sarr.sum_axis(1, out=out)
+        self.assertIs(ret, out)
+        np.testing.assert_allclose(out.ndarray, ndarr.sum(axis=1),
+                                   rtol=1e-12)
+
+        with self.assertRaisesRegex(ValueError, r"wrong shape"):
+            sarr.sum_axis(0, out=out)
+        with self.assertRaisesRegex(IndexError, r"axis 2 >= ndim 2"):
+            sarr.max_axis(2)
+        with self.assertRaisesRegex(ValueError, r"1-dimensional"):
+            out.sum_axis(0)
+
+    def test_transpose(self):
+        for shape in ((1000, 3), (4, 777), (130, 70)):
+            ndarr = np.arange(shape[0] * shape[1], dtype='float64')
+            ndarr = ndarr.reshape(shape)
+            sarr = modmesh.SimpleArrayFloat64(array=ndarr)
+            for parallel in (None, False, True):
+                np.testing.assert_equal(
+                    sarr.transpose(parallel=parallel).ndarray, ndarr.T)
+            out = modmesh.SimpleArrayFloat64(shape=shape[::-1], value=0)
+            self.assertIs(sarr.transpose(out=out), out)
+            np.testing.assert_equal(out.ndarray, ndarr.T)
+
+        with self.assertRaisesRegex(ValueError, r"wrong shape"):
+            sarr.transpose(out=sarr)
+        with self.assertRaisesRegex(ValueError, r"1-dimensional"):
+            modmesh.SimpleArrayInt32(shape=(4,)).transpose()
+
+    def test_sort(self):
+        rng = np.random.default_rng(7)
+        for dtype, cls in (('int32', modmesh.SimpleArrayInt32),
+                           ('uint64', modmesh.SimpleArrayUint64),
+                           ('float64', modmesh.SimpleArrayFloat64)):
+            ndarr = rng.integers(-500, 500, size=200000).astype(dtype)
+            for parallel in (False, True):
+                sarr = cls(array=ndarr.copy())
+                self.assertIs(sarr, sarr.sort(parallel=parallel))
+                np.testing.assert_equal(sarr.ndarray, np.sort(ndarr))
+
+                sarr = cls(array=ndarr)
+                idx = sarr.argsort(parallel=parallel)
+                self.assertIsInstance(idx, modmesh.SimpleArrayUint64)
+                np.testing.assert_equal(
+                    idx.ndarray, np.argsort(ndarr, kind='stable'))
+                np.testing.assert_equal(
+                    sarr.unique(parallel=parallel).ndarray, np.unique(ndarr))
+
+    def test_sort_nan(self):
+        ndarr = np.array([3.0, np.nan, -1.0, np.nan, 2.0])
+        sarr = modmesh.SimpleArrayFloat64(array=ndarr.copy())
+        np.testing.assert_equal(sarr.sort().ndarray, np.sort(ndarr))
+        np.testing.assert_equal(
+            modmesh.SimpleArrayFloat64(array=ndarr).unique().ndarray,
+            np.unique(ndarr))
+
+    def test_searchsorted(self):
+        ndarr = np.array([0, 0, 10, 10, 20], dtype='int64')
+        sarr = modmesh.SimpleArrayInt64(array=ndarr)
+        values = np.array([[-1, 10], [15, 30]], dtype='int64')
+        svalues = modmesh.SimpleArrayInt64(array=values)
+        for side in ('left', 'right'):
+            ret = sarr.searchsorted(svalues, side=side)
+            self.assertEqual((2, 2), ret.shape)
+            np.testing.assert_equal(
+                ret.ndarray, np.searchsorted(ndarr, values, side=side))
+        with self.assertRaisesRegex(ValueError, r"side must be"):
+            sarr.searchsorted(svalues, side='middle')
+
+    def test_take_put(self):
+        rng = np.random.default_rng(11)
+        ndarr = rng.random((300000, 3))
+        sarr = modmesh.SimpleArrayFloat64(array=ndarr.copy())
+        ind = rng.integers(0, 300000, size=(1000, 4)).astype('int64')
+        sind = modmesh.SimpleArrayInt64(array=ind)
+        for parallel in (False, True):
+            ret = sarr.take(sind, parallel=parallel)
+            self.assertEqual((1000, 4, 3), ret.shape)
+            np.testing.assert_equal(ret.ndarray, ndarr[ind])
+            out = modmesh.SimpleArrayFloat64((1000, 4, 3))
+            self.assertIs(out, sarr.take(sind, out=out, parallel=parallel))
+            np.testing.assert_equal(out.ndarray, ndarr[ind])
+
+        uind = np.arange(0, 300000, 7, dtype='uint32')
+        values = rng.random((uind.size, 3))
+        self.assertIs(sarr, sarr.put(modmesh.SimpleArrayUint32(array=uind),
+                                     modmesh.SimpleArrayFloat64(array=values),
+                                     parallel=True))
+        ndarr[uind] = values
+        np.testing.assert_equal(sarr.ndarray, ndarr)
+
+        small = modmesh.SimpleArrayFloat64((5, 3))
+        with self.assertRaisesRegex(IndexError, r"index 5 at 1 is out of"):
+            small.take(modmesh.SimpleArrayInt32(array=np.array(
+                [0, 5], dtype='int32')))
+        with self.assertRaisesRegex(ValueError, r"take output shape"):
+            sarr.take(sind, out=modmesh.SimpleArrayFloat64((1000, 3)))
+
+    def test_take_ghost(self):
+        sarr = modmesh.SimpleArrayInt32(array=np.arange(10, dtype='int32'))
+        sarr.nghost = 2
+        ind = modmesh.SimpleArrayInt64(array=np.array([-2, 7, 0], 'int64'))
+        np.testing.assert_equal(sarr.take(ind).ndarray, [0, 9, 2])
+        with self.assertRaisesRegex(IndexError, r"range \[-2, 8\)"):
+            sarr.take(modmesh.SimpleArrayInt64(array=np.array([-3], 'int64')))
+
+    def test_select_assign(self):
+        rng = np.random.default_rng(13)
+        ndarr = rng.random((200000, 2))
+        for mask in (rng.random(200000) < 0.3, rng.random((200000, 2)) < 0.3):
+            smask = modmesh.SimpleArrayBool(array=mask)
+            for parallel in (False, True):
+                sarr = modmesh.SimpleArrayFloat64(array=ndarr.copy())
+                np.testing.assert_equal(
+                    sarr.select(smask, parallel=parallel).ndarray,
+                    ndarr[mask])
+                out = modmesh.SimpleArrayFloat64(ndarr[mask].shape)
+                self.assertIs(out, sarr.select(smask, out=out,
+                                               parallel=parallel))
+                np.testing.assert_equal(out.ndarray, ndarr[mask])
+
+                expect = ndarr.copy()
+                expect[mask] = -1.0
+                self.assertIs(sarr, sarr.assign(smask, -1.0,
+                                                parallel=parallel))
+                np.testing.assert_equal(sarr.ndarray, expect)
+
+                values = rng.random(ndarr[mask].shape)
+                expect[mask] = values
+                sarr.assign(smask, modmesh.SimpleArrayFloat64(array=values),
+                            parallel=parallel)
+                np.testing.assert_equal(sarr.ndarray, expect)
+
+        sarr = modmesh.SimpleArrayFloat64(array=ndarr)
+        with self.assertRaisesRegex(ValueError, r"mask"):
+            sarr.select(modmesh.SimpleArrayBool(array=np.ones(3, bool)))
+
+
+class ArrayExpressionTC(unittest.TestCase):
+
+    def test_arithmetic(self):
+        E = modmesh.ArrayExpression
+        a = modmesh.SimpleArrayFloat64(array=np.arange(12.0).reshape((3, 4)))
+        b = modmesh.SimpleArrayFloat64(array=np.arange(12.0).reshape((3, 4)) - 5)
+
+        expr = E(a) + E(b) * 2.0 - 1
+        self.assertEqual(expr.shape, (3, 4))
+        self.assertEqual(expr.dtype, 'float64')
+        ret = expr.evaluate()
+        self.assertIsInstance(ret, modmesh.SimpleArrayFloat64)
+        np.testing.assert_equal(ret.ndarray, a.ndarray + b.ndarray * 2 - 1)
+
+        ret = (3 / (-E(a) - 1)).evaluate()
+        np.testing.assert_equal(ret.ndarray, 3 / (-a.ndarray - 1))
+
+        out = modmesh.SimpleArrayFloat64(shape=(3, 4), value=0)
+        self.assertIs(abs(E(b)).evaluate(out=out), out)
+        np.testing.assert_equal(out.ndarray, abs(b.ndarray))
+
+        with self.assertRaisesRegex(ValueError, r"shape of the operands"):
+            E(a) + modmesh.SimpleArrayFloat64(shape=(4, 3))
+        with self.assertRaisesRegex(ValueError, r"shape of the output"):
+            E(a).evaluate(out=modmesh.SimpleArrayFloat64(shape=(12,)))
+
+    def test_types(self):
+        E = modmesh.ArrayExpression
+        i = modmesh.SimpleArrayInt32(array=np.arange(10, dtype='int32'))
+        f = modmesh.SimpleArrayFloat32(array=np.arange(10, dtype='float32'))
+
+        self.assertEqual((E(i) + 1).dtype, 'int32')
+        self.assertEqual((E(i) + 1.5).dtype, 'float64')
+        self.assertEqual((E(i) / 2).dtype, 'float64')
+        self.assertEqual((E(f) * 2.0).dtype, 'float32')
+        self.assertEqual((E(i) > 4).dtype, 'bool')
+
+        # Evaluate into an array of another type.
+        out = modmesh.SimpleArrayInt64(shape=10, value=0)
+        (E(f) * 3).evaluate(out=out)
+        np.testing.assert_equal(out.ndarray, np.arange(10) * 3)
+
+    def test_mask(self):
+        E = modmesh.ArrayExpression
+        ndarr = np.linspace(-1.0, 1.0, 9)
+        a = modmesh.SimpleArrayFloat64(array=ndarr)
+
+        mask = (E(a) > 0).evaluate()
+        self.assertIsInstance(mask, modmesh.SimpleArrayBool)
+        np.testing.assert_equal(mask.ndarray, ndarr > 0)
+
+        relu = E.where(E(a) > 0, a, 0.0).evaluate()
+        np.testing.assert_equal(relu.ndarray, np.where(ndarr > 0, ndarr, 0))
+
+        masked = (E(a) * (E(a) < 0)).evaluate()
+        np.testing.assert_equal(masked.ndarray, ndarr * (ndarr < 0))
+
+
+class SimpleArrayViewTC(unittest.TestCase):
+
+    def test_slice(self):
+        ndarr = np.arange(24, dtype='float64').reshape((4, 6))
+        sarr = modmesh.SimpleArrayFloat64(array=ndarr)
+
+        view = sarr.view()
+        self.assertIsInstance(view, modmesh.SimpleArrayViewFloat64)
+        self.assertEqual(view.shape, (4, 6))
+        self.assertEqual(view.stride, (6, 1))
+        self.assertTrue(view.is_contiguous)
+        self.assertEqual(view[2, 3], ndarr[2, 3])
+        self.assertEqual(view[-1, -1], ndarr[-1, -1])
+
+        sub = view[1:4, ::-2]
+        self.assertEqual(sub.shape, (3, 3))
+        self.assertEqual(sub.stride, (6, -2))
+        self.assertFalse(sub.is_contiguous)
+        np.testing.assert_equal(sub.ndarray, ndarr[1:4, ::-2])
+        np.testing.assert_equal(view[..., 2].ndarray, ndarr[..., 2])
+        np.testing.assert_equal(sub.copy().ndarray, ndarr[1:4, ::-2])
+
+        with self.assertRaises(IndexError):
+            view[1, 2, 3]
+        with self.assertRaisesRegex(IndexError, r"out of range"):
+            view[4, 0]
+
+    def test_zero_copy(self):
+        ndarr = np.arange(24, dtype='int32').reshape((2, 3, 4))
+        sarr = modmesh.SimpleArrayInt32(array=ndarr)
+
+        tview = sarr.view().transpose()
+        self.assertEqual(tview.shape, (4, 3, 2))
+        np.testing.assert_equal(tview.ndarray, ndarr.T)
+        np.testing.assert_equal(sarr.view().transpose((1, 0, 2)).ndarray,
+                                ndarr.transpose((1, 0, 2)))
+        np.testing.assert_equal(sarr.view().reshape((6, 4)).ndarray,
+                                ndarr.reshape((6, 4)))
+        with self.assertRaisesRegex(ValueError, r"non-contiguous"):
+            tview.reshape(24)
+
+        # Writes through any view land in the shared buffer.
+        sarr.view()[:, 1:, ::2] = -1
+        self.assertEqual(ndarr[0, 1, 0], -1)
+        self.assertEqual(ndarr[1, 2, 2], -1)
+        self.assertEqual(ndarr[0, 0, 0], 0)
+        tview[3, 2, 1] = 100
+        self.assertEqual(ndarr[1, 2, 3], 100)
+        sarr.view()[0] = np.full((3, 4), 7, dtype='int32')
+        np.testing.assert_equal(ndarr[0], 7)
+        tview.ndarray[0, 0, 1] = 9
+        self.assertEqual(ndarr[1, 0, 0], 9)
+
+    def test_ghost_body(self):
+        sarr = modmesh.SimpleArrayFloat64(shape=(5, 2), value=0)
+        sarr.nghost = 2
+        sarr.view_ghost().fill(-1.0)
+        sarr.view_body().fill(1.0)
+        self.assertEqual(sarr.view_ghost().shape, (2, 2))
+        self.assertEqual(sarr.view_body().shape, (3, 2))
+        np.testing.assert_equal(sarr.ndarray[:2], -1.0)
+        np.testing.assert_equal(sarr.ndarray[2:], 1.0)
+        # Slicing a body view again does not copy.
+        sarr.view_body()[1:, 1] = 5.0
+        self.assertEqual(list(sarr.ndarray[:, 1]), [-1, -1, 1, 5, 5])
+
+
+class DLPackTC(unittest.TestCase):
+
+    def test_export(self):
+        sarr = modmesh.SimpleArrayFloat64(shape=(3, 4), value=1.5)
+        self.assertEqual(sarr.__dlpack_device__(), (1, 0))
+        ndarr = np.from_dlpack(sarr)
+        self.assertEqual(ndarr.shape, (3, 4))
+        self.assertEqual(ndarr.dtype, np.float64)
+        # The exported tensor shares the buffer.
+        ndarr[1, 2] = -3.0
+        self.assertEqual(sarr[1 * 4 + 2], -3.0)
+
+        plex = modmesh.SimpleArrayPlex(shape=(2, 3), value=7, dtype="int32")
+        ndarr = np.from_dlpack(plex)
+        self.assertEqual(ndarr.dtype, np.int32)
+        np.testing.assert_equal(ndarr, 7)
+
+    def test_import(self):
+        ndarr = np.arange(12, dtype='int16').reshape((3, 4))
+        sarr = modmesh.from_dlpack(ndarr)
+        self.assertIsInstance(sarr, modmesh.SimpleArrayInt16)
+        self.assertEqual(sarr.shape, (3, 4))
+        # The imported array borrows the memory and keeps the owner alive.
+        ndarr[2, 3] = 100
+        del ndarr
+        self.assertEqual(sarr[11], 100)
+
+        sarr = modmesh.from_dlpack(np.zeros((0, 3), dtype='float32'))
+        self.assertIsInstance(sarr, modmesh.SimpleArrayFloat32)
+        self.assertEqual(sarr.shape, (0, 3))
+
+        # Round trip back to modmesh.
+        src = modmesh.SimpleArrayUint32(shape=5, value=9)
+        dst = modmesh.from_dlpack(src)
+        self.assertEqual(dst.ndarray.__array_interface__['data'][0],
+                         src.ndarray.__array_interface__['data'][0])
+
+        with self.assertRaisesRegex(ValueError, r"C-contiguous"):
+            modmesh.from_dlpack(np.arange(10.0)[::2])
+        with self.assertRaisesRegex(ValueError, r"unsupported dtype"):
+            modmesh.from_dlpack(np.zeros(3, dtype='complex128'))
+
 
 class SimpleArrayPlexTC(unittest.TestCase):
 
@@ -754,4 +1551,64 @@ class SimpleArrayPlexTC(unittest.TestCase):
         boolean_array = np.array([True, False, True], dtype='bool')
         modmesh.SimpleArray(boolean_array)
 
+
+class SimpleArraySnapshotTC(unittest.TestCase):
+
+    def test_publish_acquire(self):
+        snapshot = modmesh.SimpleArraySnapshotFloat64()
+        self.assertEqual(0, snapshot.npublished)
+        self.assertEqual(0, snapshot.serial)
+        self.assertFalse(snapshot.acquire())
+
+        arr = modmesh.SimpleArrayFloat64((2, 3))
+        arr.ndarray[...] = np.arange(6).reshape((2, 3))
+        self.assertEqual(1, snapshot.publish(arr, time=0.5))
+        arr.ndarray[...] += 10
+        self.assertEqual(2, snapshot.publish(arr, time=1.5))
+        self.assertTrue(snapshot.acquire())
+        self.assertEqual(2, snapshot.serial)
+        self.assertEqual(1.5, snapshot.time)
+        self.assertEqual(arr.ndarray.tolist(),
+                         snapshot.front.ndarray.tolist())
+        self.assertFalse(snapshot.acquire())
+
+        # The front stays while the next snapshot of another shape is
+        # published.
+        other = modmesh.SimpleArrayFloat64((4,))
+        other.ndarray[...] = -1
+        self.assertEqual(3, snapshot.publish(other))
+        self.assertEqual((2, 3), tuple(snapshot.front.shape))
+        self.assertTrue(snapshot.acquire())
+        self.assertEqual([-1] * 4, snapshot.front.ndarray.tolist())
+
+
+class SimpleArrayMonitorTC(unittest.TestCase):
+
+    def test_evaluate(self):
+        monitor = modmesh.SimpleArrayMonitorFloat32()
+        monitor.add_probe("p", row=1, column=1)
+        monitor.add_line("line", begin=0, end=3)
+        monitor.add_reduction("sum", begin=0, end=4, op="sum", column=2)
+        self.assertEqual(["p", "line", "sum"], monitor.names)
+        self.assertEqual(5, monitor.width)
+        with self.assertRaises(ValueError):
+            monitor.add_probe("p", row=0)
+        with self.assertRaises(ValueError):
+            monitor.add_reduction("bad", begin=0, end=4, op="median")
+
+        arr = modmesh.SimpleArrayFloat32((4, 3))
+        arr.ndarray[...] = np.arange(12).reshape((4, 3))
+        monitor.evaluate(arr, time=0.5)
+        arr.ndarray[...] *= 2
+        monitor.evaluate(arr, time=1.0)
+        self.assertEqual([0.5, 1.0], monitor.times.ndarray.tolist())
+        self.assertEqual([4, 8], monitor.series("p").ndarray.tolist())
+        self.assertEqual([[0, 3, 6], [0, 6, 12]],
+                         monitor.series("line").ndarray.tolist())
+        self.assertEqual([26, 52], monitor.series("sum").ndarray.tolist())
+        self.assertEqual((2, 5), tuple(monitor.values.shape))
+        with self.assertRaises(IndexError):
+            monitor.evaluate(modmesh.SimpleArrayFloat32((2, 3)))
+        self.assertEqual(2, monitor.nsample)
+
 # vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -1,4 +1,5 @@
 import os
+import struct
 
 import unittest
 
@@ -33,3 +34,183 @@ class GmshTC(unittest.TestCase):
         self.assertEqual(blk.clnds.ndarray[3:, :4].tolist(), [[3, 0, 1, 2],
                                                               [3, 0, 2, 3],
                                                               [3, 0, 3, 1]])
+
+    def test_gmsh_from_file(self):
+        path = os.path.join(os.path.abspath(os.path.dirname(__file__)),
+                            "data", "gmsh_triangle.msh")
+
+        blk = modmesh.core.Gmsh.from_file(path).to_block()
+
+        self.assertEqual(blk.nnode, 4)
+        self.assertEqual(blk.ncell, 3)
+        self.assertEqual(blk.clnds.ndarray[3:, :4].tolist(), [[3, 0, 1, 2],
+                                                              [3, 0, 2, 3],
+                                                              [3, 0, 3, 1]])
+
+    def test_gmsh_fp32(self):
+        path = os.path.join(os.path.abspath(os.path.dirname(__file__)),
+                            "data", "gmsh_triangle.msh")
+
+        ref = modmesh.core.Gmsh.from_file(path).to_block()
+        blk = modmesh.core.Gmsh.from_file(path).to_block_fp32()
+
+        self.assertIsInstance(blk, modmesh.StaticMeshFp32)
+        self.assertEqual(np.float32, blk.ndcrd.ndarray.dtype)
+        self.assertEqual(ref.nface, blk.nface)
+        np.testing.assert_equal(ref.clnds.ndarray, blk.clnds.ndarray)
+        np.testing.assert_allclose(ref.clvol.ndarray, blk.clvol.ndarray,
+                                   rtol=1e-6)
+
+    def test_gmsh_crlf(self):
+        path = os.path.join(os.path.abspath(os.path.dirname(__file__)),
+                            "data", "gmsh_triangle.msh")
+
+        data = open(path, 'rb').read().replace(b'\n', b'\r\n')
+        blk = modmesh.core.Gmsh(data).to_block()
+
+        self.assertEqual(blk.nnode, 4)
+        self.assertEqual(blk.ncell, 3)
+        np.testing.assert_almost_equal(blk.ndcrd.ndarray[3:, :].tolist(),
+                                       [[0.0, 0.0],
+                                        [-1.0, -1.0],
+                                        [1.0, -1.0],
+                                        [0.0, 1.0]])
+
+    def test_gmsh_invalid(self):
+        path = os.path.join(os.path.abspath(os.path.dirname(__file__)),
+                            "data", "gmsh_triangle.msh")
+        data = open(path, 'rb').read()
+
+        # A node refers to an index beyond the number of nodes.
+        with self.assertRaisesRegex(ValueError, "node index 5 is not in"):
+            modmesh.core.Gmsh(data.replace(b'\n4 0 1 0\n', b'\n5 0 1 0\n'))
+
+        # An element uses a node that does not exist.
+        with self.assertRaisesRegex(ValueError, "uses node 9 not in"):
+            modmesh.core.Gmsh(data.replace(b'3 2 2 5 3 1 4 2', b'3 2 2 5 3 1 4 9'))
+
+        # A coordinate is not a number.
+        with self.assertRaisesRegex(ValueError, "invalid node "2 -1 x 0""):
+            modmesh.core.Gmsh(data.replace(b'2 -1 -1 0', b'2 -1 x 0'))
+
+    def test_gmsh_many_chunks(self):
+        # The sections span many chunks of lines, which are parsed separately
+        # and merged in order.
+        n = 150
+        lines = ['$MeshFormat', '2.2 0 8', '$EndMeshFormat',
+                 '$Nodes', str((n + 1) ** 2)]
+        for j in range(n + 1):
+            for i in range(n + 1):
+                lines.append('%d %d %d 0' % (j * (n + 1) + i + 1, i, j))
+        lines += ['$EndNodes', '$Elements', str(n * n)]
+        for j in range(n):
+            for i in range(n):
+                nd = j * (n + 1) + i + 1
+                lines.append('%d 3 2 1 1 %d %d %d %d'
+                             % (j * n + i + 1, nd, nd + 1, nd + n + 2,
+                                nd + n + 1))
+        lines.append('$EndElements')
+        data = ('\n'.join(lines) + '\n').encode()
+
+        blk = modmesh.core.Gmsh(data).to_block()
+
+        self.assertEqual(blk.nnode, (n + 1) ** 2)
+        self.assertEqual(blk.ncell, n * n)
+        ngstcell = blk.ngstcell
+        clnds = blk.clnds.ndarray[ngstcell:, :5]
+        self.assertEqual(clnds[0].tolist(), [4, 0, 1, n + 2, n + 1])
+        last = (n - 1) * (n + 1) + n - 1
+        self.assertEqual(clnds[-1].tolist(),
+                         [4, last, last + 1, last + n + 2, last + n + 1])
+        np.testing.assert_almost_equal(blk.clvol.ndarray[ngstcell:],
+                                       np.ones(n * n))
+
+    def test_gmsh_reorder(self):
+        path = os.path.join(os.path.abspath(os.path.dirname(__file__)),
+                            "data", "gmsh_triangle.msh")
+        old = modmesh.core.Gmsh.from_file(path).to_block()
+        for method in ("rcm", "hilbert", "morton"):
+            blk = modmesh.core.Gmsh.from_file(path).to_block()
+            perm = blk.reorder(method)
+            ndp = perm["node"].ndarray
+            clp = perm["cell"].ndarray
+            # The ghost layer built by to_block() is rebuilt.
+            self.assertEqual(old.ngstnode, blk.ngstnode)
+            self.assertEqual(old.ngstcell, blk.ngstcell)
+            ngstnode = blk.ngstnode
+            ngstcell = blk.ngstcell
+            np.testing.assert_equal(blk.ndcrd.ndarray[ngstnode:],
+                                    old.ndcrd.ndarray[ngstnode:][ndp])
+            np.testing.assert_equal(blk.clvol.ndarray[ngstcell:],
+                                    old.clvol.ndarray[ngstcell:][clp])
+            np.testing.assert_equal(blk.ndcrd.ndarray[:ngstnode],
+                                    old.ndcrd.ndarray[:ngstnode])
+            np.testing.assert_equal(blk.clvol.ndarray[:ngstcell],
+                                    old.clvol.ndarray[:ngstcell])
+
+    def test_gmsh_v41_ascii(self):
+        path = os.path.join(os.path.abspath(os.path.dirname(__file__)),
+                            "data", "gmsh_triangle_v41.msh")
+
+        blk = modmesh.core.Gmsh.from_file(path).to_block()
+
+        self.assertEqual(blk.nnode, 4)
+        np.testing.assert_almost_equal(blk.ndcrd.ndarray[3:, :].tolist(),
+                                       [[0.0, 0.0],
+                                        [-1.0, -1.0],
+                                        [1.0, -1.0],
+                                        [0.0, 1.0]])
+        self.assertEqual(blk.ncell, 3)
+        self.assertEqual(blk.cltpn.ndarray[3:].tolist(), [4, 4, 4])
+        self.assertEqual(blk.clnds.ndarray[3:, :4].tolist(), [[3, 0, 1, 2],
+                                                              [3, 0, 2, 3],
+                                                              [3, 0, 3, 1]])
+
+    @staticmethod
+    def _make_v41_binary(byteorder):
+        # The same triangles as gmsh_triangle.msh with sparse node tags.
+        def ints(*v):
+            return struct.pack(byteorder + '%di' % len(v), *v)
+
+        def sizes(*v):
+            return struct.pack(byteorder + '%dQ' % len(v), *v)
+
+        def reals(*v):
+            return struct.pack(byteorder + '%dd' % len(v), *v)
+
+        tags = [10, 20, 30, 40]
+        data = b'$MeshFormat\n4.1 1 8\n' + ints(1) + b'\n$EndMeshFormat\n'
+        data += b'$Entities\n' + sizes(0, 0, 1, 0)
+        data += ints(3) + reals(-1, -1, 0, 1, 1, 0) + sizes(1) + ints(5)
+        data += sizes(0) + b'\n$EndEntities\n'
+        data += b'$Nodes\n' + sizes(1, 4, 10, 40)
+        data += ints(2, 3, 0) + sizes(4) + sizes(*tags)
+        data += reals(0, 0, 0, -1, -1, 0, 1, -1, 0, 0, 1, 0)
+        data += b'\n$EndNodes\n'
+        data += b'$Elements\n' + sizes(1, 3, 1, 3)
+        data += ints(2, 3, 2) + sizes(3)
+        data += sizes(1, 10, 20, 30) + sizes(2, 10, 30, 40)
+        data += sizes(3, 10, 40, 20)
+        data += b'\n$EndElements\n'
+        return data
+
+    def test_gmsh_v41_binary(self):
+        for byteorder in ('<', '>'):
+            data = self._make_v41_binary(byteorder)
+            blk = modmesh.core.Gmsh(data).to_block()
+
+            self.assertEqual(blk.nnode, 4)
+            np.testing.assert_almost_equal(blk.ndcrd.ndarray[3:, :].tolist(),
+                                           [[0.0, 0.0],
+                                            [-1.0, -1.0],
+                                            [1.0, -1.0],
+                                            [0.0, 1.0]])
+            self.assertEqual(blk.ncell, 3)
+            self.assertEqual(blk.clnds.ndarray[3:, :4].tolist(),
+                             [[3, 0, 1, 2],
+                              [3, 0, 2, 3],
+                              [3, 0, 3, 1]])
+
+        data = self._make_v41_binary('<')
+        with self.assertRaisesRegex(ValueError, "truncated node block 0"):
+            modmesh.core.Gmsh(data[:data.index(b'$EndNodes') - 40])
@@ -38,4 +38,66 @@ class StaticGridTC(unittest.TestCase):
         self.assertEqual(2, modmesh.StaticGrid2d.NDIM)
         self.assertEqual(3, modmesh.StaticGrid3d.NDIM)
 
+    def test_shape2d(self):
+
+        for blocked in (False, True):
+            gd = modmesh.StaticGrid2d(10, 3, blocked=blocked)
+            self.assertEqual(blocked, gd.blocked)
+            self.assertEqual((10, 3), (gd.nx, gd.ny))
+            self.assertEqual((10, 3), tuple(gd.shape))
+            self.assertEqual(30, len(gd))
+            self.assertEqual((10,), gd.x.shape)
+            self.assertEqual((3,), gd.y.shape)
+        # The blocked layout pads the values to whole 8x8 bricks.
+        self.assertEqual(30, modmesh.StaticGrid2d(10, 3).values.shape[0])
+        self.assertEqual(
+            128, modmesh.StaticGrid2d(10, 3, blocked=True).values.shape[0])
+
+    def test_shape3d(self):
+
+        for blocked in (False, True):
+            gd = modmesh.StaticGrid3d(13, 9, 17, blocked=blocked)
+            self.assertEqual(blocked, gd.blocked)
+            self.assertEqual((13, 9, 17), (gd.nx, gd.ny, gd.nz))
+            self.assertEqual(13 * 9 * 17, len(gd))
+            self.assertEqual((17,), gd.z.shape)
+        self.assertEqual(
+            2 * 2 * 3 * 512,
+            modmesh.StaticGrid3d(13, 9, 17, blocked=True).values.shape[0])
+
+    def test_layouts_agree(self):
+
+        shape = (11, 9, 10)
+        rgd = modmesh.StaticGrid3d(*shape)
+        bgd = modmesh.StaticGrid3d(*shape, blocked=True)
+        for k in range(shape[2]):
+            for j in range(shape[1]):
+                for i in range(shape[0]):
+                    rgd[i, j, k] = i + 100 * j + 10000 * k
+        bgd.copy_values(rgd)
+        for k in range(shape[2]):
+            for j in range(shape[1]):
+                for i in range(shape[0]):
+                    self.assertEqual(i + 100 * j + 10000 * k, bgd[i, j, k])
+        # Row-major puts x fastest.
+        self.assertEqual(rgd[1, 0, 0], rgd.values[1])
+        self.assertEqual(rgd[0, 1, 0], rgd.values[shape[0]])
+
+        bgd.fill(2.5)
+        self.assertEqual(2.5, bgd[10, 8, 9])
+        with self.assertRaises(ValueError):
+            bgd.copy_values(modmesh.StaticGrid3d(11, 9, 11))
+
+    def test_index_error(self):
+
+        gd = modmesh.StaticGrid2d(4, 5, blocked=True)
+        gd[3, 4] = 1.0
+        self.assertEqual(1.0, gd[3, 4])
+        with self.assertRaisesRegex(
+                IndexError,
+                r"StaticGrid2d: index \(4, 0\) is out of the shape \(4, 5\)"):
+            gd[4, 0]
+        with self.assertRaises(IndexError):
+            gd[0, 5] = 1.0
+
 # vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
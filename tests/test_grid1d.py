@@ -87,4 +87,35 @@ class StaticGrid1dTC(unittest.TestCase):
         gd.fill(102)
         self.assertEqual([102] * gd.nx, list(gd))
 
+    def _check_locate(self, coord, xs):
+
+        gd = modmesh.StaticGrid1d(len(coord))
+        gd.coord.ndarray[:] = coord
+        points = modmesh.SimpleArrayFloat64(array=np.array(xs, dtype='float64'))
+        golden = np.searchsorted(coord, xs, side='right') - 1
+        # The last interval is closed.
+        golden[np.array(xs) == coord[-1]] = len(coord) - 2
+        golden[(np.array(xs) < coord[0]) | (np.array(xs) > coord[-1])] = -1
+        self.assertEqual(golden.tolist(), gd.locate(points).ndarray.tolist())
+
+    def test_locate(self):
+
+        xs = [-0.5, 0.0, 0.3, 1.0, 2.5, 9.99, 10.0, 10.5]
+        # Uniform.
+        self._check_locate(np.arange(11, dtype='float64'), xs)
+        # Non-uniform.
+        self._check_locate(np.arange(11, dtype='float64') ** 2 / 10, xs)
+
+        rng = np.random.default_rng(7)
+        coord = np.cumsum(rng.uniform(0.1, 1.0, 1000))
+        self._check_locate(coord, rng.uniform(-1, coord[-1] + 1, 5000))
+
+        gd = modmesh.StaticGrid1d(3)
+        gd.coord.ndarray[:] = [0, 1, 2]
+        self.assertEqual(
+            [-1], gd.locate(modmesh.SimpleArrayFloat64(
+                array=np.array([np.nan]))).ndarray.tolist())
+        with self.assertRaisesRegex(ValueError, r"points must be 1D"):
+            gd.locate(modmesh.SimpleArrayFloat64((2, 2)))
+
 # vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
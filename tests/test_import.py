@@ -0,0 +1,78 @@
+# Copyright (c) 2026, Yung-Yu Chen <yyc@solvcon.net>
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# - Redistributions of source code must retain the above copyright notice, this
+#   list of conditions and the following disclaimer.
+# - Redistributions in binary form must reproduce the above copyright notice,
+#   this list of conditions and the following disclaimer in the documentation
+#   and/or other materials provided with the distribution.
+# - Neither the name of the copyright holder nor the names of its contributors
+#   may be used to endorse or promote products derived from this software
+#   without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+import os
+import subprocess
+import sys
+import unittest
+
+import modmesh
+
+
+def _run(code):
+    # A fresh interpreter, for the registration is once per process.
+    env = dict(os.environ)
+    env['PYTHONPATH'] = os.pathsep.join(sys.path)
+    ret = subprocess.run([sys.executable, '-c', code], env=env,
+                         capture_output=True, text=True, check=True)
+    return ret.stdout.split()
+
+
+class LazyImportTC(unittest.TestCase):
+
+    def test_import_registers_core(self):
+        out = _run(
+            "import modmesh\n"
+            "impl = vars(modmesh.core._impl)\n"
+            "print('SimpleArrayFloat64' in impl, 'StaticMesh' in impl,\n"
+            "      'onedim' in impl, 'spacetime' in impl)\n")
+        self.assertEqual(['True', 'False', 'False', 'False'], out)
+
+    def test_first_access(self):
+        out = _run(
+            "import modmesh\n"
+            "impl = vars(modmesh.core._impl)\n"
+            "modmesh.StaticMesh\n"
+            "print('StaticMesh' in impl, 'onedim' in impl)\n"
+            "modmesh.onedim.euler1d\n"
+            "print('onedim' in impl, 'spacetime' in impl)\n")
+        self.assertEqual(['True', 'False', 'True', 'False'], out)
+
+    def test_star_import(self):
+        out = _run(
+            "from modmesh import *\n"
+            "print('StaticMesh' in dir(), 'SimpleArrayFloat64' in dir(),\n"
+            "      'onedim' in dir(), 'spacetime' in dir())\n")
+        self.assertEqual(['True', 'True', 'True', 'True'], out)
+
+    def test_missing(self):
+        with self.assertRaises(AttributeError):
+            modmesh.no_such_name
+        with self.assertRaises(AttributeError):
+            modmesh.core._impl.no_such_name
+        self.assertIn('StaticMesh', dir(modmesh))
+
+# vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -25,6 +25,9 @@
 # POSSIBILITY OF SUCH DAMAGE.
 
 
+import os
+import sys
+import tempfile
 import unittest
 
 import numpy as np
@@ -79,6 +82,8 @@ class StaticMeshTC(unittest.TestCase):
 
         _test(modmesh.StaticMesh, ndim=2)
         _test(modmesh.StaticMesh, ndim=3)
+        _test(modmesh.StaticMeshFp32, ndim=2)
+        _test(modmesh.StaticMeshFp32, ndim=3)
 
     def test_2d_trivial_triangles(self):
         mh = modmesh.StaticMesh(ndim=2, nnode=4, nface=0, ncell=3)
@@ -101,6 +106,10 @@ class StaticMeshTC(unittest.TestCase):
         self._check_shape(mh, ndim=2, nnode=4, nface=6, ncell=3,
                           nbound=0, ngstnode=0, ngstface=0, ngstcell=0,
                           nedge=6)
+        # Edges are listed in the order they first appear in fcnds.
+        self.assertEqual(
+            [[0, 1], [1, 2], [0, 2], [2, 3], [0, 3], [1, 3]],
+            mh.ednds.ndarray.tolist())
         np.testing.assert_almost_equal(
             mh.fccnd,
             [[-0.5, -0.5], [0.0, -1.0], [0.5, -0.5],
@@ -200,6 +209,11 @@ class StaticMeshTC(unittest.TestCase):
         self._check_shape(mh, ndim=3, nnode=4, nface=4, ncell=1,
                           nbound=4, ngstnode=4, ngstface=12, ngstcell=4,
                           nedge=6)
+        # The ghost cells mirror the interior one.
+        np.testing.assert_almost_equal(
+            mh.clvol.ndarray, [0.1666667] * 5)
+        np.testing.assert_almost_equal(
+            np.linalg.norm(mh.fcnml.ndarray, axis=1), [1.0] * 16)
 
     def test_1d_single_line(self):
         mh = modmesh.StaticMesh(ndim=1, nnode=2, nface=0, ncell=1)
@@ -227,4 +241,596 @@ class StaticMeshTC(unittest.TestCase):
         self._check_metric_trivial(mh)
         # TODO: Need to add build_boundary and build_ghost to make sure
         #       Line type behavior.
+
+    def _make_triangles(self):
+        mh = modmesh.StaticMesh(ndim=2, nnode=4, nface=0, ncell=3)
+        mh.ndcrd.ndarray[:, :] = (0, 0), (-1, -1), (1, -1), (0, 1)
+        mh.cltpn.ndarray[:] = modmesh.StaticMesh.TRIANGLE
+        mh.clnds.ndarray[:, :4] = (3, 0, 1, 2), (3, 0, 2, 3), (3, 0, 3, 1)
+        mh.build_interior()
+        mh.build_boundary()
+        return mh
+
+    def test_adjacency(self):
+        mh = self._make_triangles()
+
+        offsets, indices = mh.node_cells()
+        self.assertEqual([0, 3, 5, 7, 9], offsets.ndarray.tolist())
+        self.assertEqual([0, 1, 2, 0, 2, 0, 1, 1, 2],
+                         indices.ndarray.tolist())
+
+        offsets, indices = mh.node_faces()
+        self.assertEqual(2 * mh.nface, offsets.ndarray[-1])
+        for ind in range(mh.nnode):
+            for ifc in indices.ndarray[offsets.ndarray[ind]:
+                                       offsets.ndarray[ind + 1]]:
+                self.assertIn(ind, mh.fcnds.ndarray[ifc, 1:3].tolist())
+
+        # Every cell neighbors the other two before the ghost is built.
+        offsets, indices = mh.cell_cells()
+        self.assertEqual([0, 2, 4, 6], offsets.ndarray.tolist())
+        for icl in range(mh.ncell):
+            self.assertEqual(
+                sorted(set(range(3)) - {icl}),
+                sorted(indices.ndarray[2 * icl:2 * icl + 2].tolist()))
+
+        # The boundary faces lead to the ghost cells after build_ghost.
+        mh.build_ghost()
+        offsets, indices = mh.cell_cells()
+        self.assertEqual([0, 3, 6, 9], offsets.ndarray.tolist())
+        self.assertEqual(3, (indices.ndarray < 0).sum())
+
+    def test_colors(self):
+        mh = self._make_triangles()
+        mh.refine_uniform(levels=2)
+        mh.build_ghost()
+
+        offsets, indices = mh.face_colors()
+        self.assertEqual(mh.nface, offsets.ndarray[-1])
+        self.assertEqual(list(range(mh.nface)),
+                         sorted(indices.ndarray.tolist()))
+        fccls = mh.fccls.ndarray[mh.ngstface:]
+        for icr in range(len(offsets.ndarray) - 1):
+            faces = indices.ndarray[offsets.ndarray[icr]:
+                                    offsets.ndarray[icr + 1]]
+            # No cell is shared by two faces of a color.
+            cells = fccls[faces, :2].ravel()
+            cells = cells[cells >= -mh.ngstcell]
+            self.assertEqual(len(cells), len(set(cells.tolist())))
+
+        offsets, indices = mh.cell_colors()
+        self.assertEqual(list(range(mh.ncell)),
+                         sorted(indices.ndarray.tolist()))
+        clfcs = mh.clfcs.ndarray[mh.ngstcell:]
+        for icr in range(len(offsets.ndarray) - 1):
+            cells = indices.ndarray[offsets.ndarray[icr]:
+                                    offsets.ndarray[icr + 1]]
+            faces = np.concatenate([clfcs[icl, 1:clfcs[icl, 0] + 1]
+                                    for icl in cells])
+            self.assertEqual(len(faces), len(set(faces.tolist())))
+
+    def test_accumulate_upwind_advection(self):
+        mh = self._make_triangles()
+        mh.refine_uniform(levels=2)
+        mh.build_ghost()
+
+        def make(values):
+            arr = modmesh.SimpleArrayFloat64(array=np.array(
+                values, dtype="float64").reshape((-1, 1)))
+            arr.nghost = mh.ngstcell
+            return arr
+
+        # A uniform field does not change.
+        u = make(np.ones(mh.ngstcell + mh.ncell))
+        residual = make(np.zeros(mh.ngstcell + mh.ncell))
+        modmesh.accumulate_upwind_advection(mh, u, residual, [1.0, 0.5])
+        np.testing.assert_allclose(residual.ndarray, 0, atol=1e-12)
+
+        # The strategies give the same residuals.
+        u = make(mh.clcnd.ndarray[:, 0])
+        results = []
+        for strategy in ("color", "gather"):
+            residual = make(np.zeros(mh.ngstcell + mh.ncell))
+            modmesh.accumulate_upwind_advection(mh, u, residual, [1.0, 0.5],
+                                                strategy=strategy)
+            results.append(residual.ndarray[mh.ngstcell:])
+            # The ghost cells are not written.
+            self.assertTrue((residual.ndarray[:mh.ngstcell] == 0).all())
+        np.testing.assert_allclose(results[0], results[1], atol=1e-12)
+        self.assertTrue((results[0] != 0).any())
+
+        with self.assertRaisesRegex(ValueError, "unknown strategy"):
+            modmesh.accumulate_upwind_advection(mh, u, residual, [1.0, 0.5],
+                                                strategy="scatter")
+        with self.assertRaisesRegex(ValueError, "velocity has 3"):
+            modmesh.accumulate_upwind_advection(mh, u, residual,
+                                                [1.0, 0.5, 0.0])
+        with self.assertRaisesRegex(ValueError, "ghost rows"):
+            modmesh.accumulate_upwind_advection(
+                mh, u, make(np.zeros(mh.ncell + mh.ngstcell + 1)),
+                [1.0, 0.5])
+
+    def test_sparse_matrix(self):
+        mh = self._make_triangles()
+        mh.refine_uniform()
+
+        mat = modmesh.SparseMatrixFloat64.from_cell_cells(mh)
+        self.assertEqual((mh.ncell, mh.ncell), (mat.nrow, mat.ncol))
+        offsets, indices = mh.cell_cells()
+        self.assertEqual(mh.ncell + offsets.ndarray[-1], mat.nnz)
+        self.assertEqual(np.int32, mat.offsets.ndarray.dtype)
+
+        # The graph Laplacian of the nodes sums to zero in each row.
+        mat = modmesh.SparseMatrixFloat64.from_node_nodes(mh)
+        self.assertEqual(mh.nnode + 2 * mh.nedge, mat.nnz)
+        for _ in range(2):
+            # The pattern is reused by the numeric assembly of each step.
+            mat.zero()
+            for ied in range(mh.nedge):
+                nd0, nd1 = mh.ednds.ndarray[ied].tolist()
+                mat.add(nd0, nd0, 1.0)
+                mat.add(nd1, nd1, 1.0)
+                mat.add(nd0, nd1, -1.0)
+                mat.add(nd1, nd0, -1.0)
+        ones = modmesh.SimpleArrayFloat64((mh.nnode,), 1.0)
+        np.testing.assert_allclose(mat.multiply(ones).ndarray, 0,
+                                   atol=1e-12)
+        x = modmesh.SimpleArrayFloat64(
+            array=mh.ndcrd.ndarray[:, 0].copy())
+        y = modmesh.SimpleArrayFloat64((mh.nnode,))
+        mat.multiply(x, y)
+        dense = np.zeros((mat.nrow, mat.ncol))
+        for irow in range(mat.nrow):
+            for it in range(mat.offsets.ndarray[irow],
+                            mat.offsets.ndarray[irow + 1]):
+                dense[irow, mat.indices.ndarray[it]] = mat.values.ndarray[it]
+        np.testing.assert_allclose(y.ndarray, dense @ x.ndarray)
+
+        row0 = mat.indices.ndarray[mat.offsets.ndarray[0]:
+                                   mat.offsets.ndarray[1]].tolist()
+        far = min(set(range(mh.nnode)) - set(row0))
+        with self.assertRaisesRegex(IndexError, "not in the pattern"):
+            mat.add(0, far, 1.0)
+        with self.assertRaisesRegex(ValueError, "x must be"):
+            mat.multiply(modmesh.SimpleArrayFloat64((mh.nnode + 1,)))
+        with self.assertRaisesRegex(ValueError, "ascending and unique"):
+            modmesh.SparseMatrixFloat64(
+                2,
+                modmesh.SimpleArrayInt32(array=np.array([0, 2, 2],
+                                                        dtype="int32")),
+                modmesh.SimpleArrayInt32(array=np.array([1, 0],
+                                                        dtype="int32")))
+
+        try:
+            import scipy.sparse  # noqa: F401
+        except ImportError:
+            return
+        csr = mat.to_scipy()
+        np.testing.assert_allclose(csr.toarray(), dense)
+        # The values are shared without copying.
+        mat.values.ndarray[0] += 1.0
+        self.assertEqual(mat.values.ndarray[0], csr.data[0])
+
+    def test_refine_uniform(self):
+        mh = self._make_triangles()
+        volume = mh.clvol.ndarray.sum()
+        nnode, nedge, nbound = mh.nnode, mh.nedge, mh.nbound
+
+        mh.refine_uniform()
+        self.assertEqual(nnode + nedge, mh.nnode)
+        self.assertEqual(12, mh.ncell)
+        self.assertEqual(2 * nbound, mh.nbound)
+        self.assertEqual(1, mh.nbcs)
+        self.assertTrue((mh.clvol.ndarray > 0).all())
+        self.assertAlmostEqual(volume, mh.clvol.ndarray.sum())
+
+        mh.refine_uniform(levels=2)
+        self.assertEqual(12 * 16, mh.ncell)
+        self.assertEqual(8 * nbound, mh.nbound)
+        self.assertAlmostEqual(volume, mh.clvol.ndarray.sum())
+
+        mh.build_ghost()
+        with self.assertRaisesRegex(RuntimeError, "before build_ghost"):
+            mh.refine_uniform()
+
+    def test_csr_connectivity(self):
+        mh = self._make_triangles()
+
+        offsets, indices = mh.clnds_csr()
+        self.assertEqual([0, 3, 6, 9], offsets.ndarray.tolist())
+        self.assertEqual(mh.clnds.ndarray[:mh.ncell, 1:4].ravel().tolist(),
+                         indices.ndarray.tolist())
+
+        offsets, indices = mh.fcnds_csr()
+        self.assertEqual(2 * mh.nface, offsets.ndarray[-1])
+        for ifc in range(mh.nface):
+            self.assertEqual(
+                mh.fcnds.ndarray[ifc, 1:3].tolist(),
+                indices.ndarray[offsets.ndarray[ifc]:
+                                offsets.ndarray[ifc + 1]].tolist())
+
+        offsets, indices = mh.clfcs_csr()
+        self.assertEqual(3 * mh.ncell, offsets.ndarray[-1])
+        self.assertEqual(mh.clfcs.ndarray[:mh.ncell, 1:4].ravel().tolist(),
+                         indices.ndarray.tolist())
+
+    def test_mmesh(self):
+        mh = self._make_triangles()
+        mh.build_ghost()
+        with tempfile.TemporaryDirectory() as tmpdir:
+            path = os.path.join(tmpdir, "triangles.mmesh")
+            mh.save_mmesh(path)
+            for mmap in (True, False):
+                loaded = modmesh.StaticMesh.load_mmesh(path, mmap=mmap)
+                for name in ("ndim", "nnode", "nface", "ncell", "nbound",
+                             "ngstnode", "ngstface", "ngstcell", "nedge",
+                             "nbcs"):
+                    self.assertEqual(getattr(mh, name),
+                                     getattr(loaded, name))
+                for name in ("ndcrd", "fccnd", "fcnml", "fcara", "clcnd",
+                             "clvol", "fctpn", "cltpn", "clgrp", "fcnds",
+                             "fccls", "clnds", "clfcs", "ednds", "bndfcs"):
+                    np.testing.assert_equal(getattr(mh, name).ndarray,
+                                            getattr(loaded, name).ndarray)
+                # The mapping is copy-on-write.
+                loaded.ndcrd.ndarray[:] = 0
+            loaded = modmesh.StaticMesh.load_mmesh(path)
+            np.testing.assert_equal(mh.ndcrd.ndarray, loaded.ndcrd.ndarray)
+            del loaded
+
+            with open(path, "wb") as fobj:
+                fobj.write(b"not a mesh" * 10)
+            with self.assertRaisesRegex(RuntimeError, "is not a mmesh file"):
+                modmesh.StaticMesh.load_mmesh(path)
+
+    @unittest.skipIf(sys.platform.startswith("win"),
+                     "POSIX shared memory is not available")
+    def test_shared(self):
+        mh = self._make_triangles()
+        mh.build_ghost()
+        name = "/modmesh_test_mesh_%d" % os.getpid()
+        modmesh.SharedMemory.remove(name)
+        segment = mh.publish_shared(name)
+        self.assertEqual(name, segment.name)
+        self.assertTrue(segment.is_published)
+        self.assertEqual(1, segment.refcount)
+
+        attached = modmesh.StaticMesh.attach_shared(name)
+        self.assertEqual(2, segment.refcount)
+        for name_ in ("nnode", "nface", "ncell", "nbound", "ngstcell",
+                      "nedge"):
+            self.assertEqual(getattr(mh, name_), getattr(attached, name_))
+        for name_ in ("ndcrd", "clvol", "fcnds", "clfcs", "bndfcs"):
+            np.testing.assert_equal(getattr(mh, name_).ndarray,
+                                    getattr(attached, name_).ndarray)
+        # The attached arrays are read-only views of the segment.
+        self.assertFalse(attached.ndcrd.ndarray.flags.writeable)
+        with self.assertRaises(ValueError):
+            attached.ndcrd.ndarray[0, 0] = 1
+        with self.assertRaisesRegex(RuntimeError, "cannot create"):
+            mh.publish_shared(name)
+
+        # The segment is unlinked with the last handle.
+        del attached
+        self.assertEqual(1, segment.refcount)
+        del segment
+        with self.assertRaises(RuntimeError):
+            modmesh.SharedMemory.attach(name)
+        self.assertFalse(modmesh.SharedMemory.remove(name))
+
+    def test_fp32(self):
+        ref = self._make_triangles()
+        ref.build_ghost()
+        mh = modmesh.StaticMeshFp32(ndim=2, nnode=4, nface=0, ncell=3)
+        mh.ndcrd.ndarray[:, :] = (0, 0), (-1, -1), (1, -1), (0, 1)
+        mh.cltpn.ndarray[:] = modmesh.StaticMeshFp32.TRIANGLE
+        mh.clnds.ndarray[:, :4] = (3, 0, 1, 2), (3, 0, 2, 3), (3, 0, 3, 1)
+        mh.build_interior()
+        mh.build_boundary()
+        mh.build_ghost()
+        for name in ("nface", "nbound", "ngstnode", "ngstface", "ngstcell",
+                     "nedge"):
+            self.assertEqual(getattr(ref, name), getattr(mh, name))
+        for name in ("ndcrd", "fccnd", "fcnml", "fcara", "clcnd", "clvol"):
+            arr = getattr(mh, name).ndarray
+            self.assertEqual(np.float32, arr.dtype)
+            np.testing.assert_allclose(arr, getattr(ref, name).ndarray,
+                                       rtol=1e-6, atol=1e-6)
+        for name in ("fcnds", "fccls", "clnds", "clfcs", "ednds"):
+            np.testing.assert_equal(getattr(ref, name).ndarray,
+                                    getattr(mh, name).ndarray)
+
+        with tempfile.TemporaryDirectory() as tmpdir:
+            path = os.path.join(tmpdir, "triangles.mmesh")
+            mh.save_mmesh(path)
+            loaded = modmesh.StaticMeshFp32.load_mmesh(path)
+            np.testing.assert_equal(mh.clvol.ndarray, loaded.clvol.ndarray)
+            # The precision of the file has to match.
+            with self.assertRaisesRegex(RuntimeError,
+                                        "real numbers of 4 bytes"):
+                modmesh.StaticMesh.load_mmesh(path)
+
+    def test_bvh(self):
+        mh = self._make_triangles()
+        bvh = modmesh.StaticMeshBVH(mh, leaf_size=1)
+        self.assertEqual(1, bvh.leaf_size)
+        self.assertEqual(5, bvh.node_count)
+
+        points = modmesh.SimpleArrayFloat64(array=np.array(
+            [mh.clcnd.ndarray[2], mh.clcnd.ndarray[0], (5.0, 5.0)]))
+        self.assertEqual([2, 0, -1], bvh.locate(points).ndarray.tolist())
+
+        # The cell centers are within 1 from each other.
+        offsets, indices = bvh.within(points, 1.0)
+        self.assertEqual([0, 3, 6, 6], offsets.ndarray.tolist())
+        self.assertEqual([0, 1, 2], indices.ndarray[:3].tolist())
+
+        with self.assertRaisesRegex(ValueError, r"shape of \(npoint, 2\)"):
+            bvh.locate(modmesh.SimpleArrayFloat64(3))
+
+    def test_lod(self):
+        mh = self._make_triangles()
+        lod = modmesh.StaticMeshLod(mh, depth=1)
+        self.assertEqual(1, lod.depth)
+        self.assertEqual([-1, -1], lod.lower.ndarray.tolist())
+        self.assertEqual([1, 1], lod.upper.ndarray.tolist())
+
+        # The outer edges of the three triangles.
+        self.assertEqual([1, 2, 3], lod.boundary_nodes.ndarray.tolist())
+        self.assertEqual([[0, 1], [0, 2], [1, 2]],
+                         lod.boundary_edges.ndarray.tolist())
+
+        # Nodes 0 and 3 share the upper right cell of the 2x2 quadtree.
+        self.assertEqual(1, lod.nlevel)
+        self.assertEqual(1.0, lod.cell_size(0))
+        np.testing.assert_allclose(lod.level_nodes(0).ndarray,
+                                   [[-1, -1], [1, -1], [0, 0.5]])
+        self.assertEqual([[0, 1], [0, 2], [1, 2]],
+                         lod.level_edges(0).ndarray.tolist())
+
+        self.assertEqual(0, lod.select_level(distance=10.0, angle=0.1))
+        self.assertEqual(-1, lod.select_level(distance=1.0, angle=0.1))
+        with self.assertRaisesRegex(IndexError, "level 1 is out of range"):
+            lod.level_nodes(1)
+        with self.assertRaisesRegex(ValueError, "depth 0 must be in"):
+            modmesh.StaticMeshLod(mh, depth=0)
+
+    def test_quality(self):
+        mh = self._make_triangles()
+        quality = modmesh.StaticMeshQuality(mh)
+        self.assertEqual(0, quality.ninverted)
+        for name in ("aspect_ratio", "skewness", "min_dihedral",
+                     "scaled_jacobian"):
+            self.assertEqual((mh.ncell,), getattr(quality, name).shape)
+        self.assertTrue((quality.aspect_ratio.ndarray >= 1).all())
+        self.assertTrue((quality.skewness.ndarray >= 0).all())
+        # The three corner angles of each triangle sum up to pi.
+        self.assertTrue((quality.min_dihedral.ndarray <= np.pi / 3).all())
+        self.assertTrue((quality.scaled_jacobian.ndarray > 0).all())
+
+        hist = modmesh.StaticMeshQuality.histogram(
+            quality.scaled_jacobian, nbin=4, lower=0.0, upper=1.0)
+        self.assertEqual(mh.ncell, hist.ndarray.sum())
+
+        # Swapping two nodes inverts the cell.
+        mh.clnds.ndarray[0, 1:3] = mh.clnds.ndarray[0, 2:0:-1].copy()
+        mh.build_interior()
+        quality = modmesh.StaticMeshQuality(mh)
+        self.assertEqual(1, quality.ninverted)
+        self.assertLess(quality.scaled_jacobian.ndarray[0], 0)
+
+    def test_generator(self):
+        gen = modmesh.StaticMeshGenerator("mixed2d", [3, 2])
+        self.assertEqual("mixed2d", gen.shape)
+        self.assertEqual(2, gen.ndim)
+        self.assertEqual([3, 2], gen.resolution)
+        # 3 quadrilaterals and 3 triangle pairs in the checkerboard.
+        self.assertEqual(12, gen.nnode)
+        self.assertEqual(9, gen.ncell)
+        gen.set_box([-1.0, 0.0], [2.0, 4.0]).set_grading(axis=1, ratio=3.0)
+        np.testing.assert_allclose([-1, 0, 1, 2], gen.coordinates(0))
+        np.testing.assert_allclose([0, 1, 4], gen.coordinates(1))
+
+        mh = gen.generate()
+        self.assertEqual((12, 9), (mh.nnode, mh.ncell))
+        self.assertEqual(
+            [modmesh.StaticMesh.QUADRILATERAL] + [modmesh.StaticMesh.TRIANGLE]
+            * 2 + [modmesh.StaticMesh.QUADRILATERAL],
+            mh.cltpn.ndarray[:4].tolist())
+        mh.build_interior()
+        mh.build_boundary()
+        mh.build_ghost()
+        self.assertAlmostEqual(12.0, mh.clvol.ndarray[mh.ngstcell:].sum())
+
+        for shape, ndim, ncell in (("triangle", 2, 8),
+                                   ("quadrilateral", 2, 4),
+                                   ("tetrahedron", 3, 48),
+                                   ("hexahedron", 3, 8),
+                                   ("prism", 3, 16),
+                                   ("mixed3d", 3, 12)):
+            mh = modmesh.StaticMeshGenerator(shape, [2] * ndim).generate()
+            self.assertEqual(ncell, mh.ncell)
+            mh.build_interior()
+            self.assertAlmostEqual(1.0, mh.clvol.ndarray.sum())
+            quality = modmesh.StaticMeshQuality(mh)
+            self.assertEqual(0, quality.ninverted)
+
+        gen3d = modmesh.StaticMeshGenerator("hexahedron", [1, 1, 1])
+        self.assertEqual(8, gen3d.generate_fp32().nnode)
+        with self.assertRaisesRegex(ValueError, "unknown shape"):
+            modmesh.StaticMeshGenerator("pyramid", [1, 1, 1])
+        with self.assertRaisesRegex(ValueError, "takes 3 resolutions"):
+            modmesh.StaticMeshGenerator("hexahedron", [1, 1])
+        with self.assertRaisesRegex(IndexError, "axis 2 is out of"):
+            gen.set_grading(axis=2, ratio=2.0)
+
+    def test_update_metric(self):
+        mh = self._make_triangles()
+        mh.ndcrd.ndarray[0, :] = (0.2, -0.1)
+        mh.update_metric(
+            modmesh.SimpleArrayInt32(array=np.array([0], dtype="int32")))
+
+        # The same as calculating the metric from scratch.
+        ref = modmesh.StaticMesh(ndim=2, nnode=4, nface=0, ncell=3)
+        ref.ndcrd.ndarray[:, :] = mh.ndcrd.ndarray
+        ref.cltpn.ndarray[:] = modmesh.StaticMesh.TRIANGLE
+        ref.clnds.ndarray[:, :4] = mh.clnds.ndarray[:, :4]
+        ref.build_interior()
+        for name in ("fccnd", "fcnml", "fcara", "clcnd", "clvol"):
+            np.testing.assert_allclose(getattr(mh, name).ndarray,
+                                       getattr(ref, name).ndarray)
+
+        with self.assertRaisesRegex(IndexError, "changed node 4"):
+            mh.update_metric(
+                modmesh.SimpleArrayInt32(array=np.array([4], dtype="int32")))
+
+    @unittest.skipUnless(hasattr(modmesh.core._impl, "StaticMeshMetal")
+                         and "TEST_METAL" in os.environ,
+                         "Metal kernels are not built")
+    def test_metal_metric(self):
+        # The Metal kernels calculate in float32.
+        metal = modmesh.core._impl.StaticMeshMetal.me
+        mh = self._make_triangles()
+        mh.ndcrd.ndarray[0, :] = (0.2, -0.1)
+        ref = self._make_triangles()
+        ref.ndcrd.ndarray[0, :] = (0.2, -0.1)
+        ref.build_interior()
+        metal.calc_metric(mh)
+        for name in ("fccnd", "fcnml", "fcara", "clcnd", "clvol"):
+            np.testing.assert_allclose(getattr(mh, name).ndarray,
+                                       getattr(ref, name).ndarray,
+                                       rtol=1.e-5, atol=1.e-6)
+        np.testing.assert_equal(mh.fcnds.ndarray, ref.fcnds.ndarray)
+
+        # A 3D mesh of a tetrahedron.
+        mh = modmesh.StaticMesh(ndim=3, nnode=4, nface=0, ncell=1)
+        mh.ndcrd.ndarray[:, :] = (0, 0, 0), (0, 1, 0), (-1, 1, 0), (0, 1, 1)
+        mh.cltpn.ndarray[:] = modmesh.StaticMesh.TETRAHEDRON
+        mh.clnds.ndarray[:, :5] = [(4, 0, 1, 2, 3)]
+        mh.build_interior()
+        fccnd = mh.fccnd.ndarray.copy()
+        clvol = mh.clvol.ndarray.copy()
+        mh.fccnd.ndarray.fill(0)
+        mh.clvol.ndarray.fill(0)
+        metal.calc_metric(mh)
+        np.testing.assert_allclose(mh.fccnd.ndarray, fccnd,
+                                   rtol=1.e-5, atol=1.e-6)
+        np.testing.assert_allclose(mh.clvol.ndarray, clvol, rtol=1.e-5)
+
+        with self.assertRaisesRegex(ValueError, "2D or 3D"):
+            metal.calc_metric(modmesh.StaticMesh(ndim=1, nnode=2, nface=0,
+                                                 ncell=1))
+
+    def test_soa(self):
+        mh = self._make_triangles()
+        self.assertFalse(mh.soa)
+        with self.assertRaisesRegex(RuntimeError, "SoA is not enabled"):
+            mh.ndcrd_x
+
+        mh.soa = True
+        for name in ("ndcrd", "fccnd", "fcnml", "clcnd"):
+            aos = getattr(mh, name).ndarray
+            for idim, suffix in enumerate("xy"):
+                np.testing.assert_equal(
+                    getattr(mh, "%s_%s" % (name, suffix)).ndarray,
+                    aos[:, idim])
+        with self.assertRaisesRegex(IndexError, "ndcrd has no component 2"):
+            mh.ndcrd_z
+
+        # The copies follow the ghost and explicit synchronization.
+        mh.build_ghost()
+        self.assertEqual(mh.ngstcell, mh.clcnd_x.nghost)
+        np.testing.assert_equal(mh.clcnd_y.ndarray, mh.clcnd.ndarray[:, 1])
+        mh.ndcrd.ndarray[mh.ngstnode, 0] = 0.5
+        self.assertNotEqual(0.5, mh.ndcrd_x.ndarray[mh.ngstnode])
+        mh.sync_soa()
+        self.assertEqual(0.5, mh.ndcrd_x.ndarray[mh.ngstnode])
+
+    def test_decompose(self):
+        # 4x4 quadrilaterals.
+        nx = 4
+        mh = modmesh.StaticMesh(ndim=2, nnode=(nx + 1) ** 2, nface=0,
+                                ncell=nx * nx)
+        for j in range(nx + 1):
+            for i in range(nx + 1):
+                mh.ndcrd.ndarray[j * (nx + 1) + i] = (i, j)
+        mh.cltpn.ndarray[:] = modmesh.StaticMesh.QUADRILATERAL
+        for j in range(nx):
+            for i in range(nx):
+                nd = j * (nx + 1) + i
+                mh.clnds.ndarray[j * nx + i, :5] = (
+                    4, nd, nd + 1, nd + nx + 2, nd + nx + 1)
+        mh.build_interior()
+        mh.build_boundary()
+
+        cell_part = modmesh.partition_cells_rcb(mh, 2)
+        self.assertEqual([8, 8], np.bincount(cell_part.ndarray).tolist())
+        parts = modmesh.decompose_mesh(mh, cell_part, 2)
+        self.assertEqual(2, len(parts))
+        for ipart, part in enumerate(parts):
+            # A straight cut leaves one column or row of halo.
+            self.assertEqual(8, part.nowned_cell)
+            self.assertEqual(12, part.mesh.ncell)
+            cell_global = part.cell_global.ndarray
+            self.assertTrue(
+                (cell_part.ndarray[cell_global[:8]] == ipart).all())
+            self.assertEqual([1 - ipart] * 4, part.halo_owner.ndarray.tolist())
+            np.testing.assert_almost_equal(
+                part.mesh.clvol.ndarray, mh.clvol.ndarray[cell_global])
+            np.testing.assert_almost_equal(
+                part.mesh.ndcrd.ndarray,
+                mh.ndcrd.ndarray[part.node_global.ndarray])
+            self.assertEqual([1 - ipart], part.neighbor_parts.ndarray.tolist())
+            self.assertEqual([0, 4], part.recv_offsets.ndarray.tolist())
+            self.assertEqual([0, 4], part.send_offsets.ndarray.tolist())
+        # What one part sends is what the other receives.
+        for ipart in range(2):
+            src = parts[ipart]
+            dst = parts[1 - ipart]
+            self.assertEqual(
+                src.cell_global.ndarray[src.send_cells.ndarray].tolist(),
+                dst.cell_global.ndarray[dst.recv_cells.ndarray].tolist())
+
+    def test_reorder(self):
+        for method in ("rcm", "hilbert", "morton"):
+            old = self._make_triangles()
+            mh = self._make_triangles()
+            perm = mh.reorder(method)
+            ndp = perm["node"].ndarray
+            fcp = perm["face"].ndarray
+            clp = perm["cell"].ndarray
+            self.assertEqual(list(range(4)), sorted(ndp.tolist()))
+            self.assertEqual(list(range(6)), sorted(fcp.tolist()))
+            self.assertEqual(list(range(3)), sorted(clp.tolist()))
+
+            # Fields map back by new[i] = old[perm[i]].
+            np.testing.assert_equal(mh.ndcrd.ndarray, old.ndcrd.ndarray[ndp])
+            np.testing.assert_equal(mh.clvol.ndarray, old.clvol.ndarray[clp])
+            np.testing.assert_equal(mh.fcara.ndarray, old.fcara.ndarray[fcp])
+            # Connectivity refers to the renumbered entities.
+            np.testing.assert_equal(ndp[mh.clnds.ndarray[:, 1:4]],
+                                    old.clnds.ndarray[clp, 1:4])
+            np.testing.assert_equal(fcp[mh.clfcs.ndarray[:, 1:4]],
+                                    old.clfcs.ndarray[clp, 1:4])
+            np.testing.assert_equal(ndp[mh.fcnds.ndarray[:, 1:3]],
+                                    old.fcnds.ndarray[fcp, 1:3])
+            np.testing.assert_equal(clp[mh.fccls.ndarray[:, 0]],
+                                    old.fccls.ndarray[fcp, 0])
+            np.testing.assert_equal(fcp[mh.bndfcs.ndarray[:, 0]],
+                                    old.bndfcs.ndarray[:, 0])
+            self.assertEqual(6, mh.nedge)
+
+            # The ghost layer is rebuilt over the renumbered interior.
+            mh.build_ghost()
+            self.assertEqual(3, mh.ngstcell)
+            ghost_clvol = mh.clvol.ndarray[:3].copy()
+            mh.reorder(method)
+            self.assertEqual(3, mh.ngstcell)
+            np.testing.assert_equal(mh.clvol.ndarray[:3], ghost_clvol)
+            ifc = mh.bndfcs.ndarray[:, 0] + mh.ngstface
+            self.assertEqual([-1, -2, -3], mh.fccls.ndarray[ifc, 1].tolist())
+
+        with self.assertRaisesRegex(ValueError, "unknown reorder method"):
+            self._make_triangles().reorder("random")
+
 # vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
@@ -0,0 +1,68 @@
+import os
+import tempfile
+import unittest
+
+import numpy as np
+
+import modmesh
+
+
+class MeshCacheTC(unittest.TestCase):
+
+    def setUp(self):
+        self.cache = modmesh.MeshCache.instance
+        self.saved = self.cache.directory
+        self.tmpdir = tempfile.TemporaryDirectory()
+        self.cache.directory = self.tmpdir.name
+
+    def tearDown(self):
+        self.cache.directory = self.saved
+        self.tmpdir.cleanup()
+
+    def test_make_key(self):
+        key = modmesh.MeshCache.make_key(b'abc', 'opt')
+        self.assertEqual(32, len(key))
+        self.assertEqual(key, modmesh.MeshCache.make_key(b'abc', 'opt'))
+        self.assertNotEqual(key, modmesh.MeshCache.make_key(b'abd', 'opt'))
+        self.assertNotEqual(key, modmesh.MeshCache.make_key(b'abc', 'opu'))
+        # Moving bytes between the data and the options changes the key.
+        self.assertNotEqual(key, modmesh.MeshCache.make_key(b'abco', 'pt'))
+
+    def test_gmsh(self):
+        path = os.path.join(os.path.abspath(os.path.dirname(__file__)),
+                            "data", "gmsh_triangle.msh")
+        nhit = self.cache.nhit
+        blk0 = modmesh.core.Gmsh.from_file(path).to_block()
+        self.assertEqual(nhit, self.cache.nhit)
+        blk1 = modmesh.core.Gmsh.from_file(path).to_block()
+        self.assertEqual(nhit + 1, self.cache.nhit)
+        self.assertEqual(blk0.nface, blk1.nface)
+        np.testing.assert_equal(blk0.ndcrd.ndarray, blk1.ndcrd.ndarray)
+        np.testing.assert_equal(blk0.fccls.ndarray, blk1.fccls.ndarray)
+
+    def test_build(self):
+        mh = modmesh.StaticMesh(ndim=2, nnode=4, nface=0, ncell=3)
+        mh.ndcrd.ndarray[:, :] = (0, 0), (-1, -1), (1, -1), (0, 1)
+        mh.cltpn.ndarray[:] = modmesh.StaticMesh.TRIANGLE
+        mh.clnds.ndarray[:, :4] = (3, 0, 1, 2), (3, 0, 2, 3), (3, 0, 3, 1)
+        nhit = self.cache.nhit
+        blk0 = self.cache.build(mh)
+        blk1 = self.cache.build(mh)
+        self.assertEqual(nhit + 1, self.cache.nhit)
+        self.assertEqual(6, blk1.nface)
+        np.testing.assert_equal(blk0.fcnds.ndarray, blk1.fcnds.ndarray)
+        # The input mesh is left unbuilt.
+        self.assertEqual(0, mh.nface)
+
+    def test_corrupt_entry(self):
+        path = os.path.join(os.path.abspath(os.path.dirname(__file__)),
+                            "data", "gmsh_triangle.msh")
+        with open(path, 'rb') as f:
+            key = modmesh.MeshCache.make_key(f.read(), 'Gmsh.to_block')
+        with open(self.cache.path_of(key), 'wb') as f:
+            f.write(b'garbage')
+        nmiss = self.cache.nmiss
+        blk = modmesh.core.Gmsh.from_file(path).to_block()
+        self.assertEqual(nmiss + 1, self.cache.nmiss)
+        self.assertEqual(6, blk.nface)
+        self.assertGreater(os.path.getsize(self.cache.path_of(key)), 7)
@@ -1,10 +1,14 @@
 # Copyright (c) 2018, Yung-Yu Chen <yyc@solvcon.net>
 # BSD 3-Clause License, see COPYING
 
+import os
+import tempfile
+import threading
 import unittest
 
 import numpy as np
 
+import modmesh
 from modmesh.onedim import euler1d
 
 
@@ -50,6 +54,88 @@ class Euler1DSolverTC(unittest.TestCase):
         self.assertEqual((ncoord, nvar), self.svr.so0.shape)
         self.assertEqual((ncoord, nvar), self.svr.so1.shape)
 
+    def test_fill_quantities(self):
+        self.svr.march_alpha2(steps=10)
+        names = ('density', 'velocity', 'pressure', 'temperature',
+                 'internal_energy', 'entropy')
+        outs = {name: np.empty(self.svr.ncoord) for name in names}
+        self.svr.fill_quantities(**outs)
+        for name in names:
+            self.assertEqual(getattr(self.svr, name).tolist(),
+                             outs[name].tolist())
+        # Only the given arrays are written.
+        entropy = np.zeros(self.svr.ncoord)
+        self.svr.fill_quantities(entropy=entropy)
+        self.assertEqual(self.svr.entropy.tolist(), entropy.tolist())
+        with self.assertRaisesRegex(IndexError, "pressure size"):
+            self.svr.fill_quantities(pressure=np.empty(3))
+        with self.assertRaisesRegex(TypeError, "float64"):
+            self.svr.fill_quantities(pressure=np.empty(3, dtype='int32'))
+
+    def test_set_coord(self):
+        ncoord = self.svr.ncoord
+        self.svr.set_coord(-1.0, 3.0)
+        self.assertEqual(np.linspace(-1.0, 3.0, num=ncoord).tolist(),
+                         self.svr.coord.tolist())
+        # Each interval is 1.5 times the one before it.
+        self.svr.set_coord(0.0, 1.0, ratio=1.5)
+        dx = np.diff(self.svr.coord)
+        np.testing.assert_allclose(dx[1:] / dx[:-1], 1.5, rtol=1.e-12)
+        self.assertEqual([0.0, 1.0], self.svr.coord[[0, -1]].tolist())
+        with self.assertRaisesRegex(ValueError, "xmin 1 >= xmax 0"):
+            self.svr.set_coord(1.0, 0.0)
+        with self.assertRaisesRegex(ValueError, "ratio 0 not positive"):
+            self.svr.set_coord(0.0, 1.0, ratio=0.0)
+
+    def test_set_primitive(self):
+        svr = self.svr
+        ncoord = svr.ncoord
+        svr.so1.fill(1)
+        density = np.linspace(1.0, 2.0, num=ncoord)
+        velocity = np.full(ncoord, 0.5)
+        pressure = np.linspace(3.0, 1.0, num=ncoord)
+        svr.set_primitive(density=density, velocity=velocity,
+                          pressure=pressure)
+        u2 = svr.calc_u2(1.4, density, velocity, pressure)
+        self.assertEqual(density.tolist(), svr.so0[:, 0].tolist())
+        self.assertEqual((density * velocity).tolist(),
+                         svr.so0[:, 1].tolist())
+        self.assertEqual(u2.tolist(), svr.so0[:, 2].tolist())
+        np.testing.assert_equal(0, svr.so1)
+        np.testing.assert_allclose(svr.pressure, pressure, rtol=1.e-12)
+        with self.assertRaisesRegex(IndexError, "array size 3 != ncoord"):
+            svr.set_primitive(density=np.ones(3), velocity=velocity,
+                              pressure=pressure)
+
+    def test_set_piecewise_primitive(self):
+        svr = self.svr
+        xmid = svr.coord[svr.ncoord // 2]
+        # A point on a boundary belongs to the zone on the right.
+        svr.set_piecewise_primitive(boundaries=[xmid],
+                                    density=[1.0, 0.125],
+                                    velocity=[0.0, 0.5],
+                                    pressure=[1.0, 0.1])
+        left = svr.coord < xmid
+        np.testing.assert_equal(1.0, svr.so0[left, 0])
+        np.testing.assert_equal(0.125, svr.so0[~left, 0])
+        np.testing.assert_equal(0.0, svr.so0[left, 1])
+        np.testing.assert_equal(0.0625, svr.so0[~left, 1])
+        np.testing.assert_allclose(svr.pressure[left], 1.0, rtol=1.e-12)
+        np.testing.assert_allclose(svr.pressure[~left], 0.1, rtol=1.e-12)
+        # No boundary is a uniform state.
+        svr.set_piecewise_primitive(boundaries=[], density=[2.0],
+                                    velocity=[0.0], pressure=[1.0])
+        np.testing.assert_equal(2.0, svr.so0[:, 0])
+        with self.assertRaisesRegex(IndexError, "array size 1 != 2 zones"):
+            svr.set_piecewise_primitive(boundaries=[0.0], density=[1.0],
+                                        velocity=[0.0, 0.0],
+                                        pressure=[1.0, 1.0])
+        with self.assertRaisesRegex(ValueError, r"boundaries\[0\]=1 >= "):
+            svr.set_piecewise_primitive(boundaries=[1.0, 0.0],
+                                        density=[1.0] * 3,
+                                        velocity=[0.0] * 3,
+                                        pressure=[1.0] * 3)
+
     def test_march_fine_interface(self):
         def _march():
             # first half step.
@@ -70,6 +156,271 @@ class Euler1DSolverTC(unittest.TestCase):
             svr2.march_alpha2(steps=1)
             self.assertEqual(self.svr.so0.tolist(), svr2.so0.tolist())
 
+    def test_march_blocked(self):
+        svr = self._build_solver(2000)[-1]
+        svr2 = self._build_solver(2000)[-1]
+        self.assertEqual(0, svr2.block_steps)
+        svr2._core.block_steps = 4
+        svr2._core.block_width = 64
+        svr.march_alpha2(steps=21)
+        svr2.march_alpha2(steps=21)
+        self.assertEqual(21, svr2.nstep)
+        for name in ('cfl', 'so0', 'so1'):
+            self.assertEqual(getattr(svr, name).tolist(),
+                             getattr(svr2, name).tolist())
+
+    def test_march_parallel(self):
+        nthread = modmesh.get_num_threads()
+        threshold = modmesh.get_parallel_threshold()
+        try:
+            modmesh.set_num_threads(4)
+            modmesh.set_parallel_threshold(1024)
+            # More points in a plane than a chunk of the thread pool.
+            svr = self._build_solver(140000)[-1]
+            svr2 = self._build_solver(140000)[-1]
+            self.assertTrue(svr.parallel)
+            svr2._core.parallel = False
+            svr.march_alpha2(steps=5)
+            svr2.march_alpha2(steps=5)
+            svr._core.block_steps = 4
+            svr2._core.block_steps = 4
+            svr.march_alpha2(steps=8)
+            svr2.march_alpha2(steps=8)
+            # The chunks and the tiles do not depend on the threads.
+            for name in ('so0', 'so1'):
+                np.testing.assert_equal(getattr(svr, name),
+                                        getattr(svr2, name))
+            # The CFL numbers at the boundary points are not calculated.
+            np.testing.assert_equal(svr.cfl[2:-2], svr2.cfl[2:-2])
+            self.assertEqual(svr.max_cfl, svr2.max_cfl)
+        finally:
+            modmesh.set_num_threads(nthread)
+            modmesh.set_parallel_threshold(threshold)
+
+    def test_march_threads(self):
+        # The march releases the GIL, so that independent solvers may be
+        # driven from Python threads at once.
+        svrs = [self._build_solver(2000)[-1] for _ in range(4)]
+        refs = [self._build_solver(2000)[-1] for _ in range(4)]
+        threads = [threading.Thread(target=svr.march_alpha2,
+                                    kwargs=dict(steps=50))
+                   for svr in svrs]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        for svr, ref in zip(svrs, refs):
+            ref.march_alpha2(steps=50)
+            self.assertEqual(50, svr.nstep)
+            for name in ('cfl', 'so0', 'so1'):
+                np.testing.assert_equal(getattr(svr, name),
+                                        getattr(ref, name))
+
+    def test_target_cfl(self):
+        svr = self._build_solver(200)[-1]
+        dt = svr.time_increment
+        svr.march_alpha2(steps=2)
+        self.assertAlmostEqual(2 * dt, svr.time)
+        # The maximum is reduced over the CFL numbers of the last step.
+        self.assertEqual(svr.cfl.max(), svr.max_cfl)
+        svr._core.target_cfl = 0.8
+        svr.march_alpha2(steps=10)
+        self.assertNotEqual(dt, svr.time_increment)
+        self.assertEqual(svr.cfl.max(), svr.max_cfl)
+        self.assertAlmostEqual(0.8, svr.max_cfl, delta=0.05)
+
+    def test_run(self):
+        svr = self._build_solver(200)[-1]
+        svr2 = self._build_solver(200)[-1]
+        sampled = []
+        svr.run_alpha2(steps=7, every=3,
+                       hook=lambda: sampled.append(svr.density.copy()))
+        self.assertEqual(7, svr.nstep)
+        self.assertEqual(2, len(sampled))
+        time_history = np.zeros(2, dtype='float64')
+        so0_history = np.zeros((2,) + svr2.so0.shape, dtype='float64')
+        self.assertEqual(2, svr2.record_alpha2(
+            steps=7, every=3, time_history=time_history,
+            so0_history=so0_history))
+        self.assertEqual(svr.so0.tolist(), svr2.so0.tolist())
+        self.assertAlmostEqual(6 * svr2.time_increment, time_history[1])
+        self.assertEqual(sampled[1].tolist(), so0_history[1, :, 0].tolist())
+        with self.assertRaises(ValueError):
+            svr2.record_alpha2(steps=3, every=3, time_history=time_history,
+                               so0_history=so0_history[:, ::2])
+
+    def test_stream(self):
+        svr = self._build_solver(200)[-1]
+        svr2 = self._build_solver(200)[-1]
+        snapshot = modmesh.SimpleArraySnapshotFloat64()
+        self.assertFalse(snapshot.acquire())
+        self.assertEqual(2, svr.stream_alpha2(steps=7, every=3,
+                                              snapshot=snapshot))
+        self.assertEqual(2, snapshot.npublished)
+        # Only the latest snapshot is taken.
+        self.assertTrue(snapshot.acquire())
+        self.assertFalse(snapshot.acquire())
+        self.assertEqual(2, snapshot.serial)
+        svr2.march_alpha2(steps=6)
+        self.assertAlmostEqual(svr2.time, snapshot.time)
+        self.assertEqual(svr2.so0.tolist(), snapshot.front.ndarray.tolist())
+
+    def test_monitor(self):
+        svr = self._build_solver(200)[-1]
+        svr2 = self._build_solver(200)[-1]
+        ncoord = svr.ncoord
+        monitor = modmesh.SimpleArrayMonitorFloat64()
+        monitor.add_probe("rho", row=ncoord // 2, column=0)
+        monitor.add_line("energy", begin=0, end=ncoord, column=2)
+        monitor.add_reduction("rho_max", begin=0, end=ncoord, op="max",
+                              column=0)
+        self.assertEqual(2, svr.monitor_alpha2(steps=7, every=3,
+                                               monitor=monitor))
+        self.assertEqual(2, monitor.nsample)
+        svr2.march_alpha2(steps=6)
+        self.assertAlmostEqual(svr2.time, monitor.times.ndarray[1])
+        self.assertEqual(svr2.so0[ncoord // 2, 0],
+                         monitor.series("rho").ndarray[1])
+        self.assertEqual(svr2.so0[:, 2].tolist(),
+                         monitor.series("energy").ndarray[1].tolist())
+        self.assertEqual(svr2.so0[:, 0].max(),
+                         monitor.series("rho_max").ndarray[1])
+        with self.assertRaises(RuntimeError):
+            monitor.add_probe("late", row=0)
+
+    def test_ensemble(self):
+        svrs = [self._build_solver(200)[-1] for _ in range(11)]
+        ens = euler1d.Euler1DEnsemble(ncoord=svrs[0].ncoord, ninstance=11)
+        ens.coord[:] = svrs[0].coord
+        for k, svr in enumerate(svrs):
+            svr.time_increment = svr.time_increment * (1 - 0.02 * k)
+            ens.set_instance(k, svr._core)
+        self.assertEqual((svrs[0].ncoord, 3, 11), ens.so0.shape)
+        ens.setup_march()
+        ens.march_alpha2(steps=15)
+        self.assertEqual(15, ens.nstep)
+        for k, svr in enumerate(svrs):
+            svr.setup_march()
+            svr.march_alpha2(steps=15)
+            core = ens.instance(k)
+            for name in ('cfl', 'so0', 'so1'):
+                self.assertEqual(getattr(svr, name).tolist(),
+                                 getattr(core, name).tolist())
+
+    def test_checkpoint_restart(self):
+        svr2 = self._build_solver(self.resolution)[-1]
+        with tempfile.TemporaryDirectory() as tmpdir:
+            path = os.path.join(tmpdir, 'euler.ckpt')
+            writer = modmesh.CheckpointWriter()
+            self.svr.march_alpha2(steps=7, checkpoint_every=3,
+                                  checkpoint_path=path, writer=writer)
+            writer.flush()
+            self.assertEqual(7, self.svr.nstep)
+            self.assertEqual(2, writer.nwritten)
+
+            # The last checkpoint is at step 6.
+            svr2.march_alpha2(steps=6)
+            for mmap in (True, False):
+                restarted = euler1d._impl.Euler1DCore.restart(path, mmap=mmap)
+                self.assertEqual(6, restarted.nstep)
+                self.assertEqual(svr2.time_increment,
+                                 restarted.time_increment)
+                for name in ('coord', 'cfl', 'so0', 'so1', 'gamma'):
+                    self.assertEqual(getattr(svr2, name).tolist(),
+                                     getattr(restarted, name).tolist())
+                restarted.march_alpha2(steps=1)
+                self.assertEqual(self.svr.so0.tolist(),
+                                 restarted.so0.tolist())
+
+            ckpt = modmesh.Checkpoint.load(path)
+            self.assertEqual('Euler1DCore', ckpt.kind)
+            self.assertEqual(6, ckpt.scalar('nstep'))
+            svr2.restore(ckpt)
+            self.assertEqual(6, svr2.nstep)
+
+    def test_lossy_history(self):
+        svr = self._build_solver(200)[-1]
+        # A smooth acoustic wave.
+        svr.so0[:, 0] = 1 + 0.1 * np.sin(svr.coord)
+        svr.so0[:, 2] = 1 / (1.4 - 1)
+        svr.setup_march()
+        time_history = np.zeros(10, dtype='float64')
+        so0_history = np.zeros((10,) + svr.so0.shape, dtype='float64')
+        svr.record_alpha2(steps=20, every=2, time_history=time_history,
+                          so0_history=so0_history)
+        ckpt = modmesh.Checkpoint('history')
+        ckpt.add_array('time', modmesh.SimpleArrayFloat64(
+            array=time_history))
+        ckpt.add_array('so0', modmesh.SimpleArrayFloat64(array=so0_history),
+                       tolerance=1.e-6)
+        with tempfile.TemporaryDirectory() as tmpdir:
+            path = os.path.join(tmpdir, 'history.ckpt')
+            # The compression runs in the thread of the writer.
+            writer = modmesh.CheckpointWriter()
+            writer.write(path, ckpt)
+            writer.flush()
+            self.assertLess(os.path.getsize(path), so0_history.nbytes / 4)
+            loaded = modmesh.Checkpoint.load(path)
+        self.assertEqual(1.e-6, loaded.tolerance('so0'))
+        self.assertEqual(0, loaded.tolerance('time'))
+        self.assertEqual(time_history.tolist(),
+                         loaded.array('time').ndarray.tolist())
+        np.testing.assert_allclose(loaded.array('so0').ndarray, so0_history,
+                                   rtol=0, atol=1.e-6)
+
+    def test_fp32(self):
+        svr = self._build_solver(200)[-1]
+        core = euler1d._impl.Euler1DCoreFp32(
+            ncoord=svr.ncoord, time_increment=svr.time_increment)
+        self.assertEqual(np.float32, core.so0.dtype)
+        for name in ('coord', 'gamma', 'so0', 'so1'):
+            getattr(core, name)[...] = getattr(svr, name)
+        core.setup_march()
+        svr.march_alpha2(steps=20)
+        core.march_alpha2(steps=20)
+        self.assertEqual(20, core.nstep)
+        np.testing.assert_allclose(svr.so0, core.so0, rtol=1.e-4, atol=1.e-5)
+        density = np.empty(core.ncoord, dtype='float32')
+        core.fill_quantities(density=density)
+        self.assertEqual(core.density.tolist(), density.tolist())
+        with self.assertRaises(TypeError):
+            core.fill_quantities(density=np.empty(core.ncoord))
+
+        ckpt = core.checkpoint()
+        self.assertEqual('Euler1DCoreFp32', ckpt.kind)
+        core2 = euler1d._impl.Euler1DCoreFp32(
+            ncoord=core.ncoord, time_increment=1.0)
+        core2.restore(ckpt)
+        self.assertEqual(core.so0.tolist(), core2.so0.tolist())
+        self.assertEqual(core.time_increment, core2.time_increment)
+        # A checkpoint is restored only to the same precision.
+        with self.assertRaises(RuntimeError):
+            svr.restore(ckpt)
+
+    @unittest.skipUnless(hasattr(euler1d._impl, "Euler1DMetal")
+                         and "TEST_METAL" in os.environ,
+                         "Metal kernels are not built")
+    def test_metal(self):
+        svr = self._build_solver(200)[-1]
+        cpu = euler1d._impl.Euler1DCoreFp32(
+            ncoord=svr.ncoord, time_increment=svr.time_increment)
+        gpu = euler1d._impl.Euler1DMetal(
+            ncoord=svr.ncoord, time_increment=svr.time_increment)
+        for name in ('coord', 'gamma', 'so0', 'so1'):
+            getattr(cpu, name)[...] = getattr(svr, name)
+            getattr(gpu.core, name)[...] = getattr(svr, name)
+        cpu.setup_march()
+        gpu.core.setup_march()
+        cpu.march_alpha2(steps=20)
+        gpu.march_alpha2(steps=20)
+        self.assertEqual(20, gpu.core.nstep)
+        self.assertAlmostEqual(cpu.time, gpu.core.time, places=5)
+        self.assertAlmostEqual(cpu.max_cfl, gpu.core.max_cfl, places=5)
+        for name in ('so0', 'so1'):
+            np.testing.assert_allclose(getattr(cpu, name),
+                                       getattr(gpu.core, name),
+                                       rtol=1.e-4, atol=1.e-5)
+
 
 class ShockTubeTC(unittest.TestCase):
 
@@ -140,6 +491,56 @@ class ShockTubeTC(unittest.TestCase):
              0.17521557320301784],
             rtol=1e-7)
 
+    def test_field_zones(self):
+        st = self.st
+        t = 0.4
+        coord = np.linspace(-1, 1, num=201)
+        st.build_field(t=t, coord=coord)
+        loc12, loc23, loc34, loc45 = st.calc_locations(t=t)
+        # The expansion wave agrees with the scalar calculation.
+        slct2 = np.logical_and(coord >= loc12, coord < loc23)
+        self.assertTrue(slct2.any())
+        for idx in np.flatnonzero(slct2):
+            x = coord[idx]
+            self.assertAlmostEqual(st.calc_density2(x, t),
+                                   st.density_field[idx], delta=1e-14)
+            self.assertAlmostEqual(st.calc_velocity2(x, t),
+                                   st.velocity_field[idx], delta=1e-14)
+            self.assertAlmostEqual(st.calc_pressure2(x, t),
+                                   st.pressure_field[idx], delta=1e-14)
+        # The constant zones.
+        for index, lower, upper in ((1, -np.inf, loc12), (3, loc23, loc34),
+                                    (4, loc34, loc45), (5, loc45, np.inf)):
+            slct = np.logical_and(coord >= lower, coord < upper)
+            for name in ("density", "velocity", "pressure", "entropy"):
+                np.testing.assert_equal(
+                    getattr(st, f"{name}{index}"),
+                    getattr(st, f"{name}_field")[slct])
+
+    def test_core(self):
+        core = euler1d.ShockTubeCore(gamma=1.4, pressure1=1.0, density1=1.0,
+                                     pressure5=0.1, density5=0.125)
+        self.assertEqual(self.st.calc_pressure45(), core.pressure45)
+        with self.assertRaisesRegex(IndexError, "zone 2"):
+            core.zone(2)
+        with self.assertRaisesRegex(ValueError, "gamma"):
+            euler1d.ShockTubeCore(gamma=1.0, pressure1=1.0, density1=1.0,
+                                  pressure5=0.1, density5=0.125)
+
+        coord = np.linspace(-1, 1, num=100001)
+        density = np.empty_like(coord)
+        pressure = np.empty_like(coord)
+        core.build_field(0.3, coord, density=density, pressure=pressure)
+        # The result does not depend on the threads.
+        core.parallel = False
+        serial = np.empty_like(coord)
+        core.build_field(0.3, coord, density=serial)
+        np.testing.assert_equal(density, serial)
+        with self.assertRaisesRegex(IndexError, "size"):
+            core.build_field(0.3, coord, density=np.empty(3))
+        with self.assertRaisesRegex(ValueError, "negative time"):
+            core.build_field(-1.0, coord, density=density)
+
     def test_speedofsound(self):
         st = self.st
         self.assertEqual(
@@ -25,8 +25,10 @@
 # POSSIBILITY OF SUCH DAMAGE.
 
 
+import json
 import os
 import unittest
+import threading
 import time
 
 import modmesh
@@ -142,4 +144,249 @@ class TimeRegistryTC(unittest.TestCase):
             modmesh.time_registry.entry('ConcreteBuffer.clone').time,
             0)
 
+    def test_overhead(self):
+
+        modmesh.time_registry.clear()
+        buf = modmesh.ConcreteBuffer(10)
+        for i in range(10):
+            buf.clone()
+        entry = modmesh.time_registry.entry('ConcreteBuffer.clone')
+        self.assertEqual(10, entry.count)
+        # The binding layer is a part of the call.
+        self.assertGreater(entry.overhead, 0)
+        self.assertLess(entry.overhead, entry.time)
+        ret = modmesh.time_registry.overhead_report()
+        self.assertIn("ConcreteBuffer.clone : count = 10", ret)
+        self.assertEqual(1, len(
+            modmesh.time_registry.overhead_report(limit=1).splitlines()))
+
+
+class TimedEntryTC(unittest.TestCase):
+
+    def test_percentile(self):
+
+        modmesh.time_registry.clear()
+        entry = modmesh.time_registry.entry('TimedEntryTC.percentile')
+        for ms in range(1, 101):
+            entry.add_time(ms * 1e-3)
+        self.assertEqual(100, entry.count)
+        self.assertEqual(0.1, entry.max)
+        # The buckets are within 1/8 of the values.
+        for p in (50, 90, 99):
+            self.assertAlmostEqual(p * 1e-3, entry.percentile(p),
+                                   delta=p * 1e-3 / 8)
+        self.assertEqual(0.1, entry.percentile(100))
+        with self.assertRaises(ValueError):
+            entry.percentile(101)
+        self.assertIn("p99 = ", modmesh.time_registry.report())
+
+    def test_clear_keeps_entry(self):
+
+        entry = modmesh.time_registry.entry('TimedEntryTC.clear')
+        entry.add_time(1.0)
+        modmesh.time_registry.clear()
+        self.assertEqual(0, entry.count)
+        self.assertEqual(0, entry.max)
+        self.assertNotIn('TimedEntryTC.clear', modmesh.time_registry.names)
+        entry.add_time(1.0)
+        self.assertIs(entry, modmesh.time_registry.entry('TimedEntryTC.clear'))
+        self.assertIn('TimedEntryTC.clear', modmesh.time_registry.names)
+
+
+class ScopeProfilerStatusTC(unittest.TestCase):
+
+    def setUp(self):
+
+        self.status = modmesh.scope_profiler_status
+        self.enabled = self.status.enabled
+        self.period = self.status.sampling_period
+
+    def tearDown(self):
+
+        if self.enabled:
+            self.status.enable()
+        else:
+            self.status.disable()
+        self.status.sampling_period = self.period
+
+    def fill(self, ncall):
+
+        modmesh.time_registry.clear()
+        grid = modmesh.StaticGrid1d(10)
+        for _ in range(ncall):
+            grid.fill(1.0)
+        if "StaticGrid1d::fill" in modmesh.time_registry.names:
+            return modmesh.time_registry.entry("StaticGrid1d::fill").count
+        return 0
+
+    def test_singleton(self):
+
+        self.assertIs(modmesh.scope_profiler_status,
+                      modmesh.ScopeProfilerStatus.me)
+
+    def test_switch(self):
+
+        self.status.sampling_period = 1
+        self.status.disable()
+        self.assertFalse(self.status.enabled)
+        self.assertEqual(0, self.fill(3))
+        self.status.enable()
+        self.assertTrue(self.status.enabled)
+        self.assertEqual(3, self.fill(3))
+
+    def test_sampling(self):
+
+        self.status.enable()
+        self.status.sampling_period = 4
+        self.assertEqual(4, self.status.sampling_period)
+        # The counter of the thread carries over, so the first sample may
+        # come early.
+        self.assertIn(self.fill(8), (2, 3))
+        with self.assertRaises(ValueError):
+            self.status.sampling_period = 0
+
+
+class HardwareCounterTC(unittest.TestCase):
+
+    def tearDown(self):
+
+        modmesh.hardware_counter.disable()
+
+    def test_singleton(self):
+
+        self.assertIs(modmesh.hardware_counter, modmesh.HardwareCounter.me)
+        self.assertFalse(modmesh.hardware_counter.enabled)
+
+    def test_unavailable(self):
+
+        if modmesh.HardwareCounter.available:
+            raise unittest.SkipTest("hardware counters are available")
+        self.assertNotEqual("", modmesh.HardwareCounter.unavailable_reason)
+        with self.assertRaises(RuntimeError):
+            modmesh.hardware_counter.enable()
+        self.assertFalse(modmesh.hardware_counter.enabled)
+
+    def test_report(self):
+
+        if not modmesh.HardwareCounter.available:
+            raise unittest.SkipTest(modmesh.HardwareCounter.unavailable_reason)
+        modmesh.hardware_counter.enable()
+        modmesh.time_registry.clear()
+        buf = modmesh.ConcreteBuffer(1024 * 1024)
+        buf.clone()
+        modmesh.hardware_counter.disable()
+
+        counters = modmesh.time_registry.entry('ConcreteBuffer.clone').counters
+        self.assertGreater(counters["cycles"], 0)
+        self.assertGreater(counters["instructions"], 0)
+        self.assertGreater(counters["ipc"], 0)
+        self.assertIn("IPC = ", modmesh.time_registry.report())
+
+
+class CallProfilerTC(unittest.TestCase):
+
+    def test_singleton(self):
+
+        self.assertIs(modmesh.call_profiler, modmesh.CallProfiler.me)
+
+    def test_threads(self):
+
+        profiler = modmesh.call_profiler
+        profiler.reset()
+
+        def work():
+            with modmesh.CallProfilerScope("outer"):
+                with modmesh.CallProfilerScope("inner"):
+                    pass
+
+        work()
+        thread = threading.Thread(target=work)
+        thread.start()
+        thread.join()
+
+        self.assertGreaterEqual(profiler.nthread, 2)
+        result = profiler.result()
+        self.assertEqual(["outer"],
+                         [c["name"] for c in result["children"]])
+        outer = result["children"][0]
+        self.assertEqual(2, outer["count"])
+        self.assertEqual(["inner"], [c["name"] for c in outer["children"]])
+        self.assertEqual(2, outer["children"][0]["count"])
+
+        # Each thread has its own tree.
+        counts = []
+        for ithread in range(profiler.nthread):
+            children = profiler.thread_result(ithread)["children"]
+            counts.extend(c["count"] for c in children if "outer" == c["name"])
+        self.assertEqual([1, 1], counts)
+        self.assertIn("outer", profiler.report())
+        self.assertIn("Thread 1: ", profiler.thread_report())
+        with self.assertRaises(IndexError):
+            profiler.thread_result(profiler.nthread)
+
+
+class TraceRecorderTC(unittest.TestCase):
+
+    def setUp(self):
+
+        self.recorder = modmesh.trace_recorder
+        self.capacity = self.recorder.capacity
+        self.recorder.clear()
+
+    def tearDown(self):
+
+        self.recorder.disable()
+        # Resetting the capacity also clears the events.
+        self.recorder.capacity = self.capacity
+
+    def test_singleton(self):
+
+        self.assertIs(modmesh.trace_recorder, modmesh.TraceRecorder.me)
+
+    def test_disabled(self):
+
+        self.recorder.disable()
+        buf = modmesh.ConcreteBuffer(10)
+        buf.clone()
+        self.assertEqual(0, self.recorder.nrecorded)
+
+    def test_chrome_trace(self):
+
+        self.recorder.enable()
+        buf = modmesh.ConcreteBuffer(10)
+        buf.clone()
+        self.recorder.disable()
+
+        self.assertEqual(4, self.recorder.nrecorded)
+        trace = json.loads(self.recorder.chrome_trace())
+        events = [e for e in trace["traceEvents"] if e["ph"] in "BE"]
+        self.assertEqual(["B", "E", "B", "E"], [e["ph"] for e in events])
+        self.assertEqual(["ConcreteBuffer.__init__", "ConcreteBuffer.clone"],
+                         [e["name"] for e in events if "B" == e["ph"]])
+        times = [e["ts"] for e in events]
+        self.assertEqual(sorted(times), times)
+
+    def test_ring(self):
+
+        self.recorder.capacity = 3
+        self.assertEqual(4, self.recorder.capacity)
+        self.recorder.enable()
+        buf = modmesh.ConcreteBuffer(10)
+        for _ in range(3):
+            buf.clone()
+        self.recorder.disable()
+
+        # The ring keeps the last 4 of the 8 events.
+        self.assertEqual(8, self.recorder.nrecorded)
+        nthread = self.recorder.nthread
+        events = [self.recorder.events(i) for i in range(nthread)]
+        events = [e for e in events if e]
+        self.assertEqual(1, len(events))
+        events = events[0]
+        self.assertEqual(4, len(events))
+        self.assertEqual(("B", "ConcreteBuffer.clone"), events[0][:2])
+        self.assertEqual(("E", None), events[-1][:2])
+        with self.assertRaises(IndexError):
+            self.recorder.events(self.recorder.nthread)
+
 # vim: set ff=unix fenc=utf8 et sw=4 ts=4 sts=4:
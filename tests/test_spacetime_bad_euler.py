@@ -93,6 +93,36 @@ class EulerSolverTC(unittest.TestCase):
             self.svr.get_so1(0).tolist(),
             np.zeros(self.resolution + 1, dtype='float64').tolist())
 
+    def test_soa(self):
+
+        def _build(soa):
+            grid = libst.Grid(self.xcrd)
+            svr = libst.BadEuler1DSolver(grid=grid, time_increment=0.1,
+                                         soa=soa)
+            rho = 1.0 + 0.1 * np.sin(self.xcrd)
+            svr.set_so0(0, rho)
+            svr.set_so0(1, 0.2 * rho)
+            svr.set_so0(2, 2.5 + 0.1 * np.cos(self.xcrd))
+            for iv in range(3):
+                svr.set_so1(iv, np.zeros_like(self.xcrd))
+            svr.setup_march()
+            return svr
+
+        self.assertFalse(self.svr.field.soa)
+        svr = _build(soa=False)
+        svr2 = _build(soa=True)
+        self.assertTrue(svr2.field.soa)
+        self.assertEqual(3, svr2.field.nvar)
+        svr.march_alpha2(steps=10)
+        svr2.march_alpha2(steps=10)
+        # The layout does not change the arithmetic.
+        for iv in range(3):
+            self.assertEqual(svr.get_so0(iv).tolist(),
+                             svr2.get_so0(iv).tolist())
+            self.assertEqual(svr.get_so1(iv).tolist(),
+                             svr2.get_so1(iv).tolist())
+        self.assertEqual(svr.get_cfl().tolist(), svr2.get_cfl().tolist())
+
     def test_march_fine_interface(self):
 
         def _march():
@@ -75,6 +75,24 @@ class GridTC(unittest.TestCase):
         self.assertEqual(10, self.grid10.ncelm)
         self.assertEqual(11, self.grid10.nselm)
 
+    def test_graded(self):
+
+        grid = libst.Grid(xmin=0.0, xmax=1.0, nelm=8, ratio=1.25)
+        bc = grid.BOUND_COUNT
+        xloc = grid.xcoord.ndarray[bc:-bc:2]
+        self.assertEqual([0.0, 1.0], xloc[[0, -1]].tolist())
+        dx = np.diff(xloc)
+        np.testing.assert_allclose(dx[1:] / dx[:-1], 1.25, rtol=1.e-12)
+        # The centers are in the middle of the CEs.
+        np.testing.assert_allclose(grid.xcoord.ndarray[bc+1:-bc:2],
+                                   (xloc[:-1] + xloc[1:]) / 2, rtol=1.e-15)
+        # The same as the grid of the array.
+        golden = libst.Grid(xloc=xloc.copy())
+        self.assertEqual(golden.xcoord.ndarray.tolist(),
+                         grid.xcoord.ndarray.tolist())
+        with self.assertRaisesRegex(ValueError, "ratio -1 not positive"):
+            libst.Grid(0.0, 1.0, 8, ratio=-1.0)
+
     def test_str(self):
 
         self.assertEqual("Grid(xmin=0, xmax=10, ncelm=10)",
@@ -1,10 +1,13 @@
 # Copyright (c) 2018, Yung-Yu Chen <yyc@solvcon.net>
 # BSD 3-Clause License, see COPYING
 
+import os
+import tempfile
 import unittest
 
 import numpy as np
 
+import modmesh
 from modmesh import spacetime as libst
 
 import math
@@ -96,6 +99,14 @@ class LinearScalarSolverTC(unittest.TestCase):
         self.assertEqual(self.svr.grid.ncelm, len(v2))
         self.assertEqual(v1, v2)
 
+    def test_static_kernel(self):
+
+        # The fluxes of the derived solver are inlined instead of calling the
+        # kernel, which is only for the generic solver.
+        self.assertTrue(libst.LinearScalarSolver.static_kernel)
+        self.assertTrue(libst.InviscidBurgersSolver.static_kernel)
+        self.assertFalse(libst.Solver.static_kernel)
+
     def test_initialized(self):
 
         self.assertEqual(self.svr.get_so0(0).ndarray.tolist(),
@@ -112,6 +123,212 @@ class LinearScalarSolverTC(unittest.TestCase):
         np.testing.assert_allclose(self.svr.get_cfl(), ones,
                                    rtol=0, atol=1.e-14)
 
+    def test_march_epoch(self):
+
+        epochs = (self.svr.so0.epoch, self.svr.so1.epoch, self.svr.cfl.epoch)
+        self.svr.march_alpha2(1)
+        self.assertGreater(self.svr.so0.epoch, epochs[0])
+        self.assertGreater(self.svr.so1.epoch, epochs[1])
+        self.assertGreater(self.svr.cfl.epoch, epochs[2])
+
+        epoch = self.svr.so0.epoch
+        self.svr.set_so0(0, np.sin(self.xcrd))
+        self.assertGreater(self.svr.so0.epoch, epoch)
+
+    def test_march_parallel(self):
+
+        nthread = modmesh.get_num_threads()
+        threshold = modmesh.get_parallel_threshold()
+        try:
+            modmesh.set_num_threads(4)
+            modmesh.set_parallel_threshold(1024)
+            # More elements than a chunk of the thread pool.
+            svr = self._build_solver(200000)[-1]
+            svr2 = self._build_solver(200000)[-1]
+            self.assertTrue(svr.parallel)
+            svr2.parallel = False
+            svr.march_alpha2(steps=20)
+            svr2.march_alpha2(steps=20)
+            # Each CE writes only its own SE, so the threads do not change
+            # the result.
+            np.testing.assert_equal(svr.get_so0(0), svr2.get_so0(0))
+            np.testing.assert_equal(svr.get_so1(0), svr2.get_so1(0))
+            np.testing.assert_equal(svr.get_cfl(), svr2.get_cfl())
+        finally:
+            modmesh.set_num_threads(nthread)
+            modmesh.set_parallel_threshold(threshold)
+
+    def test_march_batched(self):
+
+        svr = self._build_solver(1000)[-1]
+        svr2 = self._build_solver(1000)[-1]
+        self.assertFalse(svr.batched)
+        svr2.batched = True
+        self.assertTrue(svr2.batched)
+        svr.march_alpha2(steps=50)
+        svr2.march_alpha2(steps=50)
+        # The array form evaluates the same formulas as the element-wise
+        # form.  A compiler contracting to FMA may change the last bits.
+        for odd_plane in (False, True):
+            np.testing.assert_allclose(svr.get_so0(0, odd_plane=odd_plane),
+                                       svr2.get_so0(0, odd_plane=odd_plane),
+                                       rtol=0, atol=1.e-13)
+            np.testing.assert_allclose(svr.get_so1(0, odd_plane=odd_plane),
+                                       svr2.get_so1(0, odd_plane=odd_plane),
+                                       rtol=0, atol=1.e-13)
+            np.testing.assert_allclose(svr.get_cfl(odd_plane=odd_plane),
+                                       svr2.get_cfl(odd_plane=odd_plane),
+                                       rtol=0, atol=1.e-13)
+
+        grid = libst.Grid(0, 1, 10)
+        with self.assertRaisesRegex(ValueError, "array-form march"):
+            libst.Solver(grid=grid, time_increment=0.1, nvar=1).batched = True
+
+    def test_march_blocked(self):
+
+        svr = self._build_solver(10000)[-1]
+        svr2 = self._build_solver(10000)[-1]
+        self.assertEqual(0, svr.block_steps)
+        svr2.block_steps = 4
+        svr2.block_width = 256
+        svr.march_alpha2(steps=21)
+        svr2.march_alpha2(steps=21)
+        self.assertEqual(21, svr2.nstep)
+        # The tiles change only the order of the calculation.
+        for odd_plane in (False, True):
+            np.testing.assert_equal(svr.get_so0(0, odd_plane=odd_plane),
+                                    svr2.get_so0(0, odd_plane=odd_plane))
+            np.testing.assert_equal(svr.get_so1(0, odd_plane=odd_plane),
+                                    svr2.get_so1(0, odd_plane=odd_plane))
+            np.testing.assert_equal(svr.get_cfl(odd_plane=odd_plane),
+                                    svr2.get_cfl(odd_plane=odd_plane))
+
+    def test_march_multirate(self):
+
+        # The middle eighth of the CEs is refined by 4.
+        ncoarse = 64
+        xloc = []
+        levels = []
+        for it in range(ncoarse):
+            nsub = 4 if 28 <= it < 36 else 1
+            xloc.extend((it + np.arange(nsub) / nsub) / ncoarse * 2 * np.pi)
+            levels.extend([2 if nsub > 1 else 0] * nsub)
+        xloc.append(2 * np.pi)
+        xloc = np.array(xloc)
+        dt = 0.4 * 2 * np.pi / ncoarse
+
+        def _build(time_increment):
+            grid = libst.Grid(xloc)
+            svr = libst.LinearScalarSolver(grid=grid,
+                                           time_increment=time_increment)
+            xcrd = svr.x()
+            svr.set_so0(0, np.sin(xcrd))
+            svr.set_so1(0, np.cos(xcrd))
+            svr.setup_march()
+            return svr
+
+        def _total(svr):
+            # The last point duplicates the first one over the period.
+            so0 = svr.get_so0(0).ndarray[:-1]
+            xcoord = svr.grid.xcoord.ndarray
+            return (so0 * (xcoord[3:-2:2] - xcoord[1:-4:2])).sum()
+
+        svr = _build(dt)
+        svr2 = _build(dt / 4)
+        self.assertEqual(0, len(svr.time_levels))
+        svr.time_levels = levels
+        # The CEs next to the refined ones are graded to level 1.
+        self.assertEqual([0, 1, 1, 2], svr.time_levels.ndarray[25:29].tolist())
+        total = _total(svr)
+        svr.march_alpha2(steps=40)
+        svr2.march_alpha2(steps=160)
+        self.assertAlmostEqual(svr2.time, svr.time)
+        self.assertEqual(40, svr.nstep)
+        # The fluxes at the interfaces of the levels are corrected, and the
+        # sum is kept to the round-off.
+        self.assertAlmostEqual(total, _total(svr), delta=1.e-13)
+        # The coarse CEs march the large time increment.
+        self.assertLess(svr.nupdate, svr2.nupdate * 0.6)
+        self.assertAlmostEqual(0.4, svr.max_cfl)
+        np.testing.assert_allclose(svr.get_so0(0), svr2.get_so0(0),
+                                   rtol=0, atol=0.02)
+
+        bad = list(levels)
+        bad[1] = 1
+        with self.assertRaisesRegex(ValueError, "end of the grid"):
+            svr.time_levels = bad
+        with self.assertRaises(IndexError):
+            svr.time_levels = levels[:-1]
+        # All zeros return to the uniform march.
+        svr.time_levels = [0] * len(levels)
+        self.assertEqual(0, len(svr.time_levels))
+
+    def test_target_cfl(self):
+
+        svr = self._build_solver(100)[-1]
+        dt = svr.time_increment
+        # The CFL number of the linear wave is the time increment over the
+        # grid spacing.
+        self.assertAlmostEqual(1.0, svr.max_cfl)
+        self.assertEqual(0, svr.target_cfl)
+        svr.target_cfl = 0.5
+        svr.march_alpha2(steps=4)
+        self.assertAlmostEqual(dt / 2, svr.time_increment)
+        self.assertAlmostEqual(4 * dt / 2, svr.time)
+        self.assertAlmostEqual(0.5, svr.max_cfl)
+        self.assertEqual(svr.get_cfl().max(), svr.max_cfl)
+
+    def test_run(self):
+
+        svr = self._build_solver(100)[-1]
+        svr2 = self._build_solver(100)[-1]
+        sampled = []
+        svr.run_alpha2(steps=10, every=4,
+                       hook=lambda: sampled.append(
+                           (svr.nstep, svr.get_so0(0).ndarray.copy())))
+        self.assertEqual(10, svr.nstep)
+        self.assertEqual([4, 8], [nstep for nstep, _ in sampled])
+        time_history = np.zeros(2, dtype='float64')
+        so0_history = np.zeros((2,) + svr2.so0.ndarray.shape, dtype='float64')
+        self.assertEqual(2, svr2.record_alpha2(
+            steps=10, every=4, time_history=time_history,
+            so0_history=so0_history))
+        self.assertEqual(10, svr2.nstep)
+        self.assertAlmostEqual(8 * svr2.time_increment, time_history[1])
+        np.testing.assert_equal(svr.so0.ndarray, svr2.so0.ndarray)
+        # The history holds the whole so0 array, ghost points included.
+        svr3 = self._build_solver(100)[-1]
+        svr3.march_alpha2(steps=4)
+        np.testing.assert_equal(svr3.so0.ndarray, so0_history[0])
+        with self.assertRaises(IndexError):
+            svr3.record_alpha2(steps=10, every=4, time_history=time_history,
+                               so0_history=so0_history[:1])
+
+    def test_monitor(self):
+
+        svr = self._build_solver(100)[-1]
+        svr2 = self._build_solver(100)[-1]
+        nrow = svr.so0.ndarray.shape[0]
+        monitor = modmesh.SimpleArrayMonitorFloat64()
+        monitor.add_reduction("min", begin=0, end=nrow, op="min")
+        monitor.add_reduction("mean", begin=0, end=nrow, op="mean")
+        self.assertEqual(2, svr.monitor_alpha2(steps=10, every=4,
+                                               monitor=monitor))
+        self.assertEqual(10, svr.nstep)
+        svr2.march_alpha2(steps=8)
+        self.assertAlmostEqual(svr2.time, monitor.times.ndarray[1])
+        self.assertEqual(svr2.so0.ndarray[:, 0].min(),
+                         monitor.series("min").ndarray[1])
+        self.assertAlmostEqual(svr2.so0.ndarray[:, 0].mean(),
+                               monitor.series("mean").ndarray[1])
+        monitor.clear()
+        self.assertEqual(0, monitor.nsample)
+        # An item out of the field raises at the first sample.
+        bad = modmesh.SimpleArrayMonitorFloat64()
+        bad.add_probe("p", row=nrow)
+        with self.assertRaises(IndexError):
+            svr.monitor_alpha2(steps=4, every=4, monitor=bad)
+
     def test_march_fine_interface(self):
 
         def _march():
@@ -135,6 +352,36 @@ class LinearScalarSolverTC(unittest.TestCase):
             self.assertEqual(self.svr.get_so0(0).ndarray.tolist(),
                              svr2.get_so0(0).ndarray.tolist())
 
+    def test_checkpoint_restore(self):
+
+        self.svr.march_alpha2(5)
+        self.assertEqual(5, self.svr.nstep)
+        ckpt = self.svr.checkpoint()
+        self.assertEqual('LinearScalarSolver', ckpt.kind)
+
+        # Restore into a solver on another grid.
+        grid = libst.Grid(0, 1, 4)
+        svr2 = libst.LinearScalarSolver(grid=grid, time_increment=1)
+        with tempfile.TemporaryDirectory() as tmpdir:
+            path = os.path.join(tmpdir, 'linear.ckpt')
+            writer = modmesh.CheckpointWriter()
+            writer.write(path, ckpt)
+            writer.flush()
+            svr2.restore(path)
+        self.assertEqual(5, svr2.nstep)
+        self.assertEqual(self.svr.time_increment, svr2.time_increment)
+        self.assertEqual(self.svr.grid.ncelm, svr2.grid.ncelm)
+
+        self.svr.march_alpha2(5)
+        svr2.march_alpha2(5)
+        self.assertEqual(10, svr2.nstep)
+        self.assertEqual(self.svr.get_so0(0).ndarray.tolist(),
+                         svr2.get_so0(0).ndarray.tolist())
+
+        burgers = libst.InviscidBurgersSolver(grid=grid, time_increment=1)
+        with self.assertRaisesRegex(RuntimeError, 'LinearScalarSolver'):
+            burgers.restore(ckpt)
+
 
 class LinearScalarGridTestTC(unittest.TestCase):
     """
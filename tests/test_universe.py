@@ -25,6 +25,7 @@
 # POSSIBILITY OF SUCH DAMAGE.
 
 
+import math
 import unittest
 
 import numpy as np
@@ -171,6 +172,23 @@ class BernsteinInterpolationTC(BernsteinTB, unittest.TestCase):
         _check(t=0.7, values=values)
         _check(t=0.9, values=values)
 
+    def test_high_degree(self):
+        # Beyond the tabulated binomial coefficients.
+        f = modmesh.interpolate_bernstein
+
+        def _check(t, values, n):
+            golden = sum(v * math.comb(n, i) * t ** i * (1 - t) ** (n - i)
+                         for i, v in enumerate(values))
+            self.assert_allclose(golden, f(t=t, values=values, n=n))
+
+        for n in (10, 24, 25, 40):
+            values = [float(i % 5) + 1.0 for i in range(n + 1)]
+            self.assertEqual(values[0], f(t=0.0, values=values, n=n))
+            self.assertEqual(values[n], f(t=1.0, values=values, n=n))
+            _check(t=0.1, values=values, n=n)
+            _check(t=0.5, values=values, n=n)
+            _check(t=0.9, values=values, n=n)
+
 
 class Vector3dTB(ModMeshTB):
 
@@ -231,6 +249,86 @@ class Vector3dFp64TC(Vector3dTB, unittest.TestCase):
         self.assertIs(modmesh.Vector3dFp64, self.kls)
 
 
+class Vector3dArrayTB(ModMeshTB):
+
+    def test_construct(self):
+        Vector = self.vkls
+        Array = self.akls
+
+        arr = Array(3)
+        self.assertEqual(3, len(arr))
+        self.assertEqual((3, 3), arr.data.shape)
+        self.assertEqual([0, 0, 0], list(arr[2]))
+
+        arr = Array([Vector(1, 2, 3), Vector(4, 5, 6)])
+        self.assertEqual(2, len(arr))
+        # The x, y, and z each take a row.
+        self.assert_allclose(arr.data.ndarray, [[1, 4], [2, 5], [3, 6]])
+        arr[0] = Vector(7, 8, 9)
+        self.assert_allclose([list(v) for v in arr.to_list()],
+                             [[7, 8, 9], [4, 5, 6]])
+        with self.assertRaisesRegex(IndexError,
+                                    "Vector3dArray: i 2 >= size 2"):
+            arr[2]
+
+        arr = Array(arr.data)
+        self.assert_allclose(list(arr[1]), [4, 5, 6])
+        with self.assertRaisesRegex(ValueError, r"in \[3, size\]"):
+            Array(self.sakls(4))
+
+    def test_batch(self):
+        Array = self.akls
+
+        rng = np.random.default_rng(0)
+        # Longer than the SIMD width and with a remainder.
+        n = 37
+        va = rng.uniform(-2, 2, (3, n)).astype(self.dtype)
+        vb = rng.uniform(-2, 2, (3, n)).astype(self.dtype)
+        va[:, 5] = 0
+        a = Array(self.sakls(array=va))
+        b = Array(self.sakls(array=vb))
+
+        self.assert_allclose(a.dot(b).ndarray, (va * vb).sum(axis=0))
+        self.assert_allclose(a.cross(b).data.ndarray,
+                             np.cross(va.T, vb.T).T, atol=1.e-6)
+        norm = np.sqrt((va * va).sum(axis=0))
+        self.assert_allclose(a.norm().ndarray, norm)
+
+        c = Array(self.sakls(array=va)).normalize()
+        expected = va / np.where(norm > 0, norm, 1)
+        self.assert_allclose(c.data.ndarray, expected, atol=1.e-6)
+        # The zero vector stays zero.
+        self.assertEqual([0, 0, 0], list(c[5]))
+
+        b.axpy(0.5, a)
+        self.assert_allclose(b.data.ndarray, vb + 0.5 * va)
+
+        with self.assertRaisesRegex(ValueError, "dot: size 2 != 37"):
+            a.dot(Array(2))
+
+
+class Vector3dArrayFp32TC(Vector3dArrayTB, unittest.TestCase):
+
+    def setUp(self):
+        self.vkls = modmesh.Vector3dFp32
+        self.akls = modmesh.Vector3dArrayFp32
+        self.sakls = modmesh.SimpleArrayFloat32
+        self.dtype = 'float32'
+
+    def assert_allclose(self, *args, **kw):
+        if 'rtol' not in kw:
+            kw['rtol'] = 1.e-6
+        return super().assert_allclose(*args, **kw)
+
+
+class Vector3dArrayFp64TC(Vector3dArrayTB, unittest.TestCase):
+
+    def setUp(self):
+        self.vkls = modmesh.Vector3dFp64
+        self.akls = modmesh.Vector3dArrayFp64
+        self.sakls = modmesh.SimpleArrayFloat64
+        self.dtype = 'float64'
+
 class Bezier3dTB(ModMeshTB):
 
     def test_control_points(self):
@@ -311,6 +409,50 @@ class Bezier3dTB(ModMeshTB):
                               [3.09375, 0.5625, 0.0],
                               [3.58203125, 0.328125, 0.0], [4.0, 0.0, 0.0]])
 
+        # The packed loci are the same, and the stored ones are kept.
+        loci = b.sample_array(5)
+        self.assert_allclose(loci.data.ndarray,
+                             [[0.0, 0.90625, 2.0, 3.09375, 4.0],
+                              [0.0, 0.5625, 0.75, 0.5625, 0.0],
+                              [0.0, 0.0, 0.0, 0.0, 0.0]])
+        self.assertEqual(b.nlocus, 9)
+
+
+    def test_sample_adaptive(self):
+        Vector = self.vkls
+        Bezier = self.bkls
+
+        # A straight curve takes only the two ends.
+        b = Bezier([Vector(0, 0, 0), Vector(1, 1, 1), Vector(2, 2, 2)])
+        b.sample_adaptive(tolerance=1.e-3)
+        self.assertEqual(2, b.nlocus)
+
+        b = Bezier(
+            [Vector(0, 0, 0), Vector(1, 1, 0), Vector(3, 1, 0),
+             Vector(4, 0, 0)])
+        b.sample_adaptive(tolerance=1.e-2)
+        coarse = b.nlocus
+        loci = [list(p) for p in b.locus_points]
+        self.assert_allclose(loci[0], [0, 0, 0])
+        self.assert_allclose(loci[-1], [4, 0, 0])
+        # The loci are on the curve and in order.
+        xs = [p[0] for p in loci]
+        self.assertEqual(sorted(xs), xs)
+        b.sample_adaptive(tolerance=1.e-4)
+        self.assertGreater(b.nlocus, coarse)
+        b.sample_adaptive(tolerance=1.e-4, max_depth=2)
+        self.assertEqual(5, b.nlocus)
+
+        # A far curve takes fewer loci in the view.
+        b.sample_adaptive_view(eye=Vector(2, 0, 10), angle=1.e-3)
+        near = b.nlocus
+        b.sample_adaptive_view(eye=Vector(2, 0, 1000), angle=1.e-3)
+        self.assertLess(b.nlocus, near)
+
+        with self.assertRaisesRegex(
+                ValueError, r"Bezier3d::sample_adaptive: tolerance 0 <= 0"):
+            b.sample_adaptive(tolerance=0)
+
 
 class Bezier3dFp32TC(Bezier3dTB, unittest.TestCase):
 
@@ -380,12 +522,131 @@ class WorldTB(ModMeshTB):
         # Confirm we worked on the internal instead of copy
         self.assertEqual(w.bezier(0).nlocus, 5)
 
+    def test_sample_beziers(self):
+        Vector = self.vkls
+        World = self.wkls
+
+        w = World()
+        self.assertEqual((0, 3, 5), w.sample_beziers(5).ndarray.shape)
+        w.add_bezier([Vector(0, 0, 0), Vector(1, 1, 0), Vector(3, 1, 0),
+                      Vector(4, 0, 0)])
+        w.add_bezier([Vector(1, 2, 3), Vector(2, 4, 5)])
+
+        loci = w.sample_beziers(5).ndarray
+        self.assertEqual((2, 3, 5), loci.shape)
+        # The loci are stored as x, y, and z of each curve.
+        self.assert_allclose(loci[0], [[0.0, 0.90625, 2.0, 3.09375, 4.0],
+                                       [0.0, 0.5625, 0.75, 0.5625, 0.0],
+                                       [0.0] * 5])
+        self.assert_allclose(loci[1], [[1.0, 1.25, 1.5, 1.75, 2.0],
+                                       [2.0, 2.5, 3.0, 3.5, 4.0],
+                                       [3.0, 3.5, 4.0, 4.5, 5.0]])
+        # The same as sampling the curves one by one.
+        for i in range(w.nbezier):
+            b = w.bezier(i)
+            b.sample(5)
+            self.assert_allclose(loci[i].T, [list(p) for p in b.locus_points])
+
+        with self.assertRaisesRegex(
+                ValueError, r"World::sample_beziers: nlocus 1 < 2"):
+            w.sample_beziers(1)
+
+    def test_geometry(self):
+        Vector = self.vkls
+        World = self.wkls
+
+        w = World()
+        b0 = w.add_bezier([Vector(0, 0, 0), Vector(1, 1, 0), Vector(3, 1, 0),
+                           Vector(4, 0, 0)])
+        w.add_bezier([Vector(1, 2, 3), Vector(2, 4, 5)])
+        b0.sample(5)
+
+        w.pack_geometry()
+        coffsets, controls, loffsets, loci = w.geometry
+        self.assertEqual([0, 4, 6], coffsets.ndarray.tolist())
+        # The x, y, and z of the control points each take a row.
+        self.assert_allclose(controls.ndarray,
+                             [[0, 1, 3, 4, 1, 2], [0, 1, 1, 0, 2, 4],
+                              [0, 0, 0, 0, 3, 5]])
+        # The second curve is not sampled.
+        self.assertEqual([0, 5, 5], loffsets.ndarray.tolist())
+        self.assert_allclose(loci.ndarray[0], [0.0, 0.90625, 2.0, 3.09375, 4.0])
+        self.assert_allclose(w.control_vectors().data.ndarray,
+                             controls.ndarray)
+        self.assert_allclose(w.locus_vectors().data.ndarray, loci.ndarray)
+
+        # Sample the packed curves, the same as sample_beziers().
+        w.sample_geometry(5)
+        coffsets, controls, loffsets, loci = w.geometry
+        self.assertEqual([0, 5, 10], loffsets.ndarray.tolist())
+        golden = w.sample_beziers(5).ndarray
+        self.assert_allclose(loci.ndarray[:, :5], golden[0])
+        self.assert_allclose(loci.ndarray[:, 5:], golden[1])
+        # The Bezier3d objects are not touched.
+        self.assertEqual(0, w.bezier(1).nlocus)
+
+    def test_bvh(self):
+        Vector = self.vkls
+        World = self.wkls
+        Array = self.akls
+        dtype = self.dtype
+
+        w = World()
+        # A sampled curve on the x axis.
+        b0 = w.add_bezier([Vector(0, 0, 0), Vector(1, 0, 0), Vector(2, 0, 0),
+                           Vector(3, 0, 0)])
+        b0.sample(4)
+        # An unsampled curve whose control polygon climbs along z.
+        w.add_bezier([Vector(0, 5, 0), Vector(0, 5, 2), Vector(0, 5, 4)])
+
+        bvh = self.bkls(w, leaf_size=1)
+        self.assertIs(w, bvh.world)
+        self.assertEqual(1, bvh.leaf_size)
+        self.assertEqual(5, bvh.segment_count)
+        self.assertEqual(9, bvh.node_count)
+
+        points = Array(array=np.array(
+            [[1.5, 1, 0], [0, 5, 3], [0, 2.5, 0]], dtype=dtype))
+        curves, distances = bvh.nearest(points)
+        # Ties go to the lower curve.
+        self.assertEqual([0, 1, 0], curves.ndarray.tolist())
+        self.assert_allclose(distances.ndarray, [1, 0, 2.5])
+
+        origins = Array(array=np.array(
+            [[1, -1, 0], [0, 5, 10], [10, 10, 10]], dtype=dtype))
+        directions = Array(array=np.array(
+            [[0, 2, 0], [0, 0, -1], [1, 0, 0]], dtype=dtype))
+        curves, distances = bvh.pick(origins, directions, radius=0.1)
+        self.assertEqual([0, 1, -1], curves.ndarray.tolist())
+        self.assert_allclose(distances.ndarray[:2], [1, 6])
+        self.assertTrue(np.isinf(distances.ndarray[2]))
+
+        # Move the curve and refit the boxes.
+        b0.control_points = [Vector(0, 0, 9), Vector(1, 0, 9),
+                             Vector(2, 0, 9), Vector(3, 0, 9)]
+        b0.sample(4)
+        bvh.refit()
+        curves, distances = bvh.nearest(points)
+        self.assertEqual([1, 1, 1], curves.ndarray.tolist())
+
+        # A different number of segments needs a new hierarchy.
+        b0.sample(5)
+        with self.assertRaisesRegex(
+                ValueError, "WorldBVH::refit: the segments of the curves"):
+            bvh.refit()
+        with self.assertRaisesRegex(
+                ValueError, r"WorldBVH: points must be in the shape of"):
+            bvh.nearest(Array(array=np.zeros((2, 2), dtype=dtype)))
+
 
 class WorldFp32TC(WorldTB, unittest.TestCase):
 
     def setUp(self):
         self.vkls = modmesh.Vector3dFp32
         self.wkls = modmesh.WorldFp32
+        self.bkls = modmesh.WorldBVHFp32
+        self.akls = modmesh.SimpleArrayFloat32
+        self.dtype = 'float32'
 
     def assert_allclose(self, *args, **kw):
         if 'rtol' not in kw:
@@ -401,6 +662,9 @@ class WorldFp64TC(WorldTB, unittest.TestCase):
     def setUp(self):
         self.vkls = modmesh.Vector3dFp64
         self.wkls = modmesh.WorldFp64
+        self.bkls = modmesh.WorldBVHFp64
+        self.akls = modmesh.SimpleArrayFloat64
+        self.dtype = 'float64'
 
     def assert_allclose(self, *args, **kw):
         if 'rtol' not in kw:
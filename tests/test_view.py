@@ -52,6 +52,12 @@ class ViewTC(unittest.TestCase):
         self.assertEqual(PUI.PySide6.PUI_BACKEND, "PySide6",
                          "PUI backebd mismatch")
 
+    def test_run_on_gui(self):
+        # It is a plain call on the GUI thread.
+        self.assertEqual(3, view.run_on_gui(lambda: 1 + 2))
+        with self.assertRaisesRegex(ValueError, "from gui"):
+            view.run_on_gui(lambda: int("from gui"))
+
     @unittest.skip("headless testing is not ready")
     def test_pycon(self):
         self.assertTrue(view.mgr.pycon.python_redirect)
@@ -0,0 +1,79 @@
+import os
+import tempfile
+import unittest
+import xml.etree.ElementTree as ET
+
+import numpy as np
+
+import modmesh
+
+
+class XdmfWriterTC(unittest.TestCase):
+
+    @staticmethod
+    def _make_mesh():
+        mh = modmesh.StaticMesh(ndim=2, nnode=4, nface=0, ncell=3)
+        mh.ndcrd.ndarray[:, :] = (0, 0), (-1, -1), (1, -1), (0, 1)
+        mh.cltpn.ndarray[:] = modmesh.StaticMesh.TRIANGLE
+        mh.clnds.ndarray[:, :4] = (3, 0, 1, 2), (3, 0, 2, 3), (3, 0, 3, 1)
+        return mh
+
+    @staticmethod
+    def _read(path, item):
+        dims = [int(v) for v in item.get('Dimensions').split()]
+        with open(os.path.join(os.path.dirname(path), item.text), 'rb') as f:
+            f.seek(int(item.get('Seek')))
+            dtype = 'f8' if 'Float' == item.get('NumberType') else 'i4'
+            return np.fromfile(f, dtype=dtype,
+                               count=int(np.prod(dims))).reshape(dims)
+
+    def test_time_series(self):
+        mh = self._make_mesh()
+        with tempfile.TemporaryDirectory() as tmpdir:
+            path = os.path.join(tmpdir, 'out.xmf')
+            writer = modmesh.XdmfWriter(path, mh, max_pending=1)
+            self.assertEqual(os.path.join(tmpdir, 'out.bin'),
+                             writer.heavy_path)
+            rho = modmesh.SimpleArrayFloat64(3)
+            vel = modmesh.SimpleArrayFloat64((4, 2))
+            for it in range(4):
+                rho.ndarray[:] = it
+                vel.ndarray[:, :] = -it
+                writer.write(0.5 * it, cell={'rho': rho}, node={'vel': vel})
+            # The writer owns snapshots; changing the arrays later does not
+            # change the output.
+            rho.ndarray[:] = 100
+            writer.close()
+            self.assertTrue(writer.is_closed)
+            self.assertEqual(4, writer.nstep)
+            with self.assertRaises(RuntimeError):
+                writer.write(2.0)
+
+            grids = ET.parse(path).getroot().findall('./Domain/Grid/Grid')
+            self.assertEqual(4, len(grids))
+            for it, grid in enumerate(grids):
+                self.assertEqual(0.5 * it,
+                                 float(grid.find('Time').get('Value')))
+                np.testing.assert_array_equal(
+                    [4, 0, 1, 2, 4, 0, 2, 3, 4, 0, 3, 1],
+                    self._read(path, grid.find('Topology/DataItem')))
+                np.testing.assert_array_equal(
+                    mh.ndcrd.ndarray,
+                    self._read(path, grid.find('Geometry/DataItem')))
+                attrs = {a.get('Name'): a for a in grid.findall('Attribute')}
+                self.assertEqual('Cell', attrs['rho'].get('Center'))
+                self.assertEqual('Node', attrs['vel'].get('Center'))
+                np.testing.assert_array_equal(
+                    [it] * 3, self._read(path, attrs['rho'].find('DataItem')))
+                np.testing.assert_array_equal(
+                    np.full((4, 2), -it),
+                    self._read(path, attrs['vel'].find('DataItem')))
+
+    def test_bad_field(self):
+        mh = self._make_mesh()
+        with tempfile.TemporaryDirectory() as tmpdir:
+            writer = modmesh.XdmfWriter(os.path.join(tmpdir, 'out.xmf'), mh)
+            with self.assertRaisesRegex(ValueError, 'must have 3 body rows'):
+                writer.write(0.0, cell={'rho': modmesh.SimpleArrayFloat64(4)})
+            self.assertEqual(0, writer.nstep)
+            writer.close()